@@ -144,6 +144,65 @@ int ace_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with ACE.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa ace_aead_decrypt_vec(), ace_aead_encrypt()
+ */
+int ace_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with ACE.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa ace_aead_encrypt_vec(), ace_aead_decrypt()
+ */
+int ace_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
 /**
  * \brief Hashes a block of input data with ACE-HASH to generate a hash value.
  *
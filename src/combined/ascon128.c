@@ -22,6 +22,8 @@
 
 #include "ascon128.h"
 #include "internal-ascon.h"
+#include "internal-cpu.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 /**
@@ -39,6 +41,36 @@
  */
 #define ASCON80PQ_IV    0xa0400c06U
 
+static aead_cipher_incremental_t const ascon128_incremental = {
+    sizeof(ascon_aead_state_t),
+    (aead_incremental_init_t)ascon128_aead_init,
+    (aead_incremental_ad_t)ascon_aead_update_ad,
+    (aead_incremental_crypt_t)ascon_aead_encrypt_update,
+    (aead_incremental_crypt_t)ascon_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)ascon_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)ascon_aead_decrypt_final
+};
+
+static aead_cipher_incremental_t const ascon128a_incremental = {
+    sizeof(ascon_aead_state_t),
+    (aead_incremental_init_t)ascon128a_aead_init,
+    (aead_incremental_ad_t)ascon_aead_update_ad,
+    (aead_incremental_crypt_t)ascon_aead_encrypt_update,
+    (aead_incremental_crypt_t)ascon_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)ascon_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)ascon_aead_decrypt_final
+};
+
+static aead_cipher_incremental_t const ascon80pq_incremental = {
+    sizeof(ascon_aead_state_t),
+    (aead_incremental_init_t)ascon80pq_aead_init,
+    (aead_incremental_ad_t)ascon_aead_update_ad,
+    (aead_incremental_crypt_t)ascon_aead_encrypt_update,
+    (aead_incremental_crypt_t)ascon_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)ascon_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)ascon_aead_decrypt_final
+};
+
 aead_cipher_t const ascon128_cipher = {
     "ASCON-128",
     ASCON128_KEY_SIZE,
@@ -46,7 +78,18 @@ aead_cipher_t const ascon128_cipher = {
     ASCON128_TAG_SIZE,
     AEAD_FLAG_NONE,
     ascon128_aead_encrypt,
-    ascon128_aead_decrypt
+    ascon128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    ascon128_aead_encrypt_vec,
+    ascon128_aead_decrypt_vec,
+    &ascon128_incremental,
+    ascon128_aead_encrypt_batch,
+    ascon128_aead_decrypt_batch,
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const ascon128a_cipher = {
@@ -56,7 +99,18 @@ aead_cipher_t const ascon128a_cipher = {
     ASCON128_TAG_SIZE,
     AEAD_FLAG_NONE,
     ascon128a_aead_encrypt,
-    ascon128a_aead_decrypt
+    ascon128a_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    ascon128a_aead_encrypt_vec,
+    ascon128a_aead_decrypt_vec,
+    &ascon128a_incremental,
+    ascon128a_aead_encrypt_batch,
+    ascon128a_aead_decrypt_batch,
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const ascon80pq_cipher = {
@@ -66,7 +120,18 @@ aead_cipher_t const ascon80pq_cipher = {
     ASCON80PQ_TAG_SIZE,
     AEAD_FLAG_NONE,
     ascon80pq_aead_encrypt,
-    ascon80pq_aead_decrypt
+    ascon80pq_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    ascon80pq_aead_encrypt_vec,
+    ascon80pq_aead_decrypt_vec,
+    &ascon80pq_incremental,
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -145,6 +210,125 @@ static void ascon_decrypt
     state->B[(unsigned)len] ^= 0x80;
 }
 
+/**
+ * \brief Absorbs scatter/gather data into an ASCON state.
+ *
+ * \param state The state to absorb the data into.
+ * \param ad Points to the array of segments to be absorbed.
+ * \param ad_count Number of segments in \a ad.
+ * \param rate Block rate, which is either 8 or 16.
+ * \param first_round First round of the permutation to apply each block.
+ *
+ * Rate blocks may straddle segment boundaries.  The state is used to
+ * accumulate partial blocks so that no data is copied.
+ */
+static void ascon_absorb_vec
+    (ascon_state_t *state, const aead_iovec_t *ad, size_t ad_count,
+     uint8_t rate, uint8_t first_round)
+{
+    aead_iovec_cursor_t cursor;
+    unsigned posn = 0;
+    size_t len;
+    aead_iovec_start(&cursor, ad, ad_count);
+    while ((len = aead_iovec_chunk(&cursor, rate - posn)) > 0) {
+        lw_xor_block(state->B + posn, aead_iovec_ptr(&cursor), (unsigned)len);
+        aead_iovec_advance(&cursor, len);
+        posn += (unsigned)len;
+        if (posn >= rate) {
+            ascon_permute(state, first_round);
+            posn = 0;
+        }
+    }
+    state->B[posn] ^= 0x80;
+    ascon_permute(state, first_round);
+}
+
+/**
+ * \brief Gets the length of the next chunk that can be processed
+ * between two scatter/gather cursors.
+ *
+ * \param out The output cursor.
+ * \param in The input cursor.
+ * \param len Number of bytes left to process.
+ * \param space Number of bytes left in the current rate block.
+ *
+ * \return The chunk length, which is contiguous in both \a out and \a in.
+ */
+static size_t ascon_chunk_vec
+    (const aead_iovec_cursor_t *out, const aead_iovec_cursor_t *in,
+     unsigned long long len, unsigned space)
+{
+    size_t temp = space;
+    if (temp > len)
+        temp = (size_t)len;
+    temp = aead_iovec_chunk(in, temp);
+    return aead_iovec_chunk(out, temp);
+}
+
+/**
+ * \brief Encrypts scatter/gather data with an ASCON state.
+ *
+ * \param state The state to encrypt with.
+ * \param c Cursor for the ciphertext output, which is advanced.
+ * \param m Cursor for the plaintext input, which is advanced.
+ * \param len Length of the data to encrypt from \a m into \a c.
+ * \param rate Block rate, which is either 8 or 16.
+ * \param first_round First round of the permutation to apply each block.
+ */
+static void ascon_encrypt_vec
+    (ascon_state_t *state, aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long len, uint8_t rate, uint8_t first_round)
+{
+    unsigned posn = 0;
+    size_t temp;
+    while (len > 0) {
+        temp = ascon_chunk_vec(c, m, len, rate - posn);
+        lw_xor_block_2_dest(aead_iovec_ptr(c), state->B + posn,
+                            aead_iovec_ptr(m), (unsigned)temp);
+        aead_iovec_advance(c, temp);
+        aead_iovec_advance(m, temp);
+        len -= temp;
+        posn += (unsigned)temp;
+        if (posn >= rate) {
+            ascon_permute(state, first_round);
+            posn = 0;
+        }
+    }
+    state->B[posn] ^= 0x80;
+}
+
+/**
+ * \brief Decrypts scatter/gather data with an ASCON state.
+ *
+ * \param state The state to decrypt with.
+ * \param m Cursor for the plaintext output, which is advanced.
+ * \param c Cursor for the ciphertext input, which is advanced.
+ * \param len Length of the data to decrypt from \a c into \a m.
+ * \param rate Block rate, which is either 8 or 16.
+ * \param first_round First round of the permutation to apply each block.
+ */
+static void ascon_decrypt_vec
+    (ascon_state_t *state, aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long len, uint8_t rate, uint8_t first_round)
+{
+    unsigned posn = 0;
+    size_t temp;
+    while (len > 0) {
+        temp = ascon_chunk_vec(m, c, len, rate - posn);
+        lw_xor_block_swap(aead_iovec_ptr(m), state->B + posn,
+                          aead_iovec_ptr(c), (unsigned)temp);
+        aead_iovec_advance(m, temp);
+        aead_iovec_advance(c, temp);
+        len -= temp;
+        posn += (unsigned)temp;
+        if (posn >= rate) {
+            ascon_permute(state, first_round);
+            posn = 0;
+        }
+    }
+    state->B[posn] ^= 0x80;
+}
+
 int ascon128_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
@@ -381,3 +565,789 @@ int ascon80pq_aead_decrypt
     return aead_check_tag
         (m, *mlen, state.B + 24, c + *mlen, ASCON80PQ_TAG_SIZE);
 }
+
+int ascon128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    ascon_state_t state;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned char tag[ASCON128_TAG_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ASCON128_TAG_SIZE))
+        return -2;
+    *clen = mlen + ASCON128_TAG_SIZE;
+
+    /* Initialize the ASCON state */
+    be_store_word64(state.B, ASCON128_IV);
+    memcpy(state.B + 8, k, ASCON128_KEY_SIZE);
+    memcpy(state.B + 24, npub, ASCON128_NONCE_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k, ASCON128_KEY_SIZE);
+
+    /* Absorb the associated data into the state */
+    if (aead_iovec_length(ad, ad_count) > 0)
+        ascon_absorb_vec(&state, ad, ad_count, 8, 6);
+
+    /* Separator between the associated data and the payload */
+    state.B[39] ^= 0x01;
+
+    /* Encrypt the plaintext to create the ciphertext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ascon_encrypt_vec(&state, &ccur, &mcur, mlen, 8, 6);
+
+    /* Finalize and compute the authentication tag */
+    lw_xor_block(state.B + 8, k, ASCON128_KEY_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block_2_src(tag, state.B + 24, k, 16);
+    aead_iovec_write(&ccur, tag, ASCON128_TAG_SIZE);
+    return 0;
+}
+
+int ascon128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    ascon_state_t state;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned char tag[ASCON128_TAG_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned plaintext */
+    if (clen < ASCON128_TAG_SIZE)
+        return -1;
+    *mlen = clen - ASCON128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+
+    /* Initialize the ASCON state */
+    be_store_word64(state.B, ASCON128_IV);
+    memcpy(state.B + 8, k, ASCON128_KEY_SIZE);
+    memcpy(state.B + 24, npub, ASCON128_NONCE_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k, ASCON128_KEY_SIZE);
+
+    /* Absorb the associated data into the state */
+    if (aead_iovec_length(ad, ad_count) > 0)
+        ascon_absorb_vec(&state, ad, ad_count, 8, 6);
+
+    /* Separator between the associated data and the payload */
+    state.B[39] ^= 0x01;
+
+    /* Decrypt the ciphertext to create the plaintext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ascon_decrypt_vec(&state, &mcur, &ccur, *mlen, 8, 6);
+
+    /* Finalize and check the authentication tag */
+    lw_xor_block(state.B + 8, k, ASCON128_KEY_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k, 16);
+    aead_iovec_read(&ccur, tag, ASCON128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state.B + 24, tag, ASCON128_TAG_SIZE);
+}
+
+int ascon128a_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    ascon_state_t state;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned char tag[ASCON128_TAG_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ASCON128_TAG_SIZE))
+        return -2;
+    *clen = mlen + ASCON128_TAG_SIZE;
+
+    /* Initialize the ASCON state */
+    be_store_word64(state.B, ASCON128a_IV);
+    memcpy(state.B + 8, k, ASCON128_KEY_SIZE);
+    memcpy(state.B + 24, npub, ASCON128_NONCE_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k, ASCON128_KEY_SIZE);
+
+    /* Absorb the associated data into the state */
+    if (aead_iovec_length(ad, ad_count) > 0)
+        ascon_absorb_vec(&state, ad, ad_count, 16, 4);
+
+    /* Separator between the associated data and the payload */
+    state.B[39] ^= 0x01;
+
+    /* Encrypt the plaintext to create the ciphertext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ascon_encrypt_vec(&state, &ccur, &mcur, mlen, 16, 4);
+
+    /* Finalize and compute the authentication tag */
+    lw_xor_block(state.B + 16, k, ASCON128_KEY_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block_2_src(tag, state.B + 24, k, 16);
+    aead_iovec_write(&ccur, tag, ASCON128_TAG_SIZE);
+    return 0;
+}
+
+int ascon128a_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    ascon_state_t state;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned char tag[ASCON128_TAG_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned plaintext */
+    if (clen < ASCON128_TAG_SIZE)
+        return -1;
+    *mlen = clen - ASCON128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+
+    /* Initialize the ASCON state */
+    be_store_word64(state.B, ASCON128a_IV);
+    memcpy(state.B + 8, k, ASCON128_KEY_SIZE);
+    memcpy(state.B + 24, npub, ASCON128_NONCE_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k, ASCON128_KEY_SIZE);
+
+    /* Absorb the associated data into the state */
+    if (aead_iovec_length(ad, ad_count) > 0)
+        ascon_absorb_vec(&state, ad, ad_count, 16, 4);
+
+    /* Separator between the associated data and the payload */
+    state.B[39] ^= 0x01;
+
+    /* Decrypt the ciphertext to create the plaintext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ascon_decrypt_vec(&state, &mcur, &ccur, *mlen, 16, 4);
+
+    /* Finalize and check the authentication tag */
+    lw_xor_block(state.B + 16, k, ASCON128_KEY_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k, 16);
+    aead_iovec_read(&ccur, tag, ASCON128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state.B + 24, tag, ASCON128_TAG_SIZE);
+}
+
+int ascon80pq_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    ascon_state_t state;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned char tag[ASCON80PQ_TAG_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ASCON80PQ_TAG_SIZE))
+        return -2;
+    *clen = mlen + ASCON80PQ_TAG_SIZE;
+
+    /* Initialize the ASCON state */
+    be_store_word32(state.B, ASCON80PQ_IV);
+    memcpy(state.B + 4, k, ASCON80PQ_KEY_SIZE);
+    memcpy(state.B + 24, npub, ASCON80PQ_NONCE_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 20, k, ASCON80PQ_KEY_SIZE);
+
+    /* Absorb the associated data into the state */
+    if (aead_iovec_length(ad, ad_count) > 0)
+        ascon_absorb_vec(&state, ad, ad_count, 8, 6);
+
+    /* Separator between the associated data and the payload */
+    state.B[39] ^= 0x01;
+
+    /* Encrypt the plaintext to create the ciphertext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ascon_encrypt_vec(&state, &ccur, &mcur, mlen, 8, 6);
+
+    /* Finalize and compute the authentication tag */
+    lw_xor_block(state.B + 8, k, ASCON80PQ_KEY_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block_2_src(tag, state.B + 24, k + 4, 16);
+    aead_iovec_write(&ccur, tag, ASCON80PQ_TAG_SIZE);
+    return 0;
+}
+
+int ascon80pq_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    ascon_state_t state;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned char tag[ASCON80PQ_TAG_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned plaintext */
+    if (clen < ASCON80PQ_TAG_SIZE)
+        return -1;
+    *mlen = clen - ASCON80PQ_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+
+    /* Initialize the ASCON state */
+    be_store_word32(state.B, ASCON80PQ_IV);
+    memcpy(state.B + 4, k, ASCON80PQ_KEY_SIZE);
+    memcpy(state.B + 24, npub, ASCON80PQ_NONCE_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 20, k, ASCON80PQ_KEY_SIZE);
+
+    /* Absorb the associated data into the state */
+    if (aead_iovec_length(ad, ad_count) > 0)
+        ascon_absorb_vec(&state, ad, ad_count, 8, 6);
+
+    /* Separator between the associated data and the payload */
+    state.B[39] ^= 0x01;
+
+    /* Decrypt the ciphertext to create the plaintext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ascon_decrypt_vec(&state, &mcur, &ccur, *mlen, 8, 6);
+
+    /* Finalize and check the authentication tag */
+    lw_xor_block(state.B + 8, k, ASCON80PQ_KEY_SIZE);
+    ascon_permute(&state, 0);
+    lw_xor_block(state.B + 24, k + 4, 16);
+    aead_iovec_read(&ccur, tag, ASCON80PQ_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state.B + 24, tag, ASCON80PQ_TAG_SIZE);
+}
+
+/**
+ * \def ASCON_BATCH_LANES
+ * \brief Number of packets that are processed in lock-step by the
+ * batched ASCON functions.
+ *
+ * Eight lanes are used whenever the library may be running on a CPU with
+ * AVX-512, which also suits two groups of AVX2 registers.
+ */
+#if defined(LW_CPU_HAVE_AVX512F)
+#define ASCON_BATCH_LANES 8
+typedef ascon_x8_state_t ascon_batch_state_t;
+#define ascon_batch_permute(state, first_round) \
+    ascon_x8_permute((state), (first_round))
+#else
+#define ASCON_BATCH_LANES 4
+typedef ascon_x4_state_t ascon_batch_state_t;
+#define ascon_batch_permute(state, first_round) \
+    ascon_x4_permute((state), (first_round))
+#endif
+
+/**
+ * \brief Information about one lane of a batched ASCON operation.
+ */
+typedef struct
+{
+    aead_packet_t *packet;      /**< Packet in this lane, or NULL if idle */
+    const unsigned char *k;     /**< Key for the packet */
+    unsigned long long mlen;    /**< Length of the plaintext */
+    unsigned long long ad_blocks; /**< Associated data blocks with padding */
+    unsigned long long m_blocks;  /**< Full blocks of plaintext */
+
+} ascon_batch_lane_t;
+
+/**
+ * \brief Gets the rate bytes for one lane of a batched ASCON state.
+ *
+ * \param state The interleaved ASCON states.
+ * \param lane The lane to get.
+ * \param block Receives the first 16 bytes of the lane's state.
+ */
+static void ascon_batch_get
+    (const ascon_batch_state_t *state, unsigned lane, unsigned char *block)
+{
+    be_store_word64(block, state->S[0][lane]);
+    be_store_word64(block + 8, state->S[1][lane]);
+}
+
+/**
+ * \brief Sets the rate bytes for one lane of a batched ASCON state.
+ *
+ * \param state The interleaved ASCON states.
+ * \param lane The lane to set.
+ * \param block Points to the new first 16 bytes of the lane's state.
+ */
+static void ascon_batch_set
+    (ascon_batch_state_t *state, unsigned lane, const unsigned char *block)
+{
+    state->S[0][lane] = be_load_word64(block);
+    state->S[1][lane] = be_load_word64(block + 8);
+}
+
+/**
+ * \brief Permutes the active lanes of a batched ASCON state.
+ *
+ * \param state The interleaved ASCON states.
+ * \param active Flags that indicate which lanes should be permuted.
+ * \param first_round First round of the permutation to apply.
+ *
+ * All lanes are permuted together and then the inactive lanes are
+ * restored, which is cheaper than splitting the batch.
+ */
+static void ascon_batch_permute_active
+    (ascon_batch_state_t *state, const unsigned char *active,
+     uint8_t first_round)
+{
+    ascon_batch_state_t saved;
+    unsigned lane, word;
+    int all = 1;
+    for (lane = 0; lane < ASCON_BATCH_LANES; ++lane) {
+        if (!active[lane])
+            all = 0;
+    }
+    if (!all)
+        saved = *state;
+    ascon_batch_permute(state, first_round);
+    if (!all) {
+        for (lane = 0; lane < ASCON_BATCH_LANES; ++lane) {
+            if (active[lane])
+                continue;
+            for (word = 0; word < 5; ++word)
+                state->S[word][lane] = saved.S[word][lane];
+        }
+    }
+}
+
+/**
+ * \brief Encrypts or decrypts a group of packets with ASCON-128 or
+ * ASCON-128a in lock-step.
+ *
+ * \param packets Points to the packets in the group.
+ * \param count Number of packets, between 1 and ASCON_BATCH_LANES.
+ * \param iv Initialization vector for the ASCON variant.
+ * \param rate Block rate, which is either 8 or 16.
+ * \param first_round First round of the permutation to apply each block.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ *
+ * \return 0 if every packet succeeded, or the result of the first
+ * packet that failed.
+ */
+static int ascon_batch_group
+    (aead_packet_t *packets, unsigned count, uint64_t iv,
+     uint8_t rate, uint8_t first_round, int encrypt)
+{
+    ascon_batch_state_t state;
+    ascon_batch_lane_t lanes[ASCON_BATCH_LANES];
+    unsigned char active[ASCON_BATCH_LANES];
+    unsigned char block[16];
+    unsigned char tag[ASCON128_TAG_SIZE];
+    aead_packet_t *packet;
+    unsigned long long posn;
+    unsigned long long max_blocks;
+    unsigned long long offset;
+    unsigned key_word = rate / 8;
+    unsigned lane, len;
+    int result = 0;
+
+    /* Load the IV, key, and nonce into each lane.  Unused lanes and
+     * ciphertexts that are too short for a tag are left idle */
+    memset(&state, 0, sizeof(state));
+    memset(lanes, 0, sizeof(lanes));
+    for (lane = 0; lane < count; ++lane) {
+        packet = &(packets[lane]);
+        if (!encrypt && packet->inlen < ASCON128_TAG_SIZE) {
+            packet->outlen = 0;
+            packet->result = -1;
+            if (result == 0)
+                result = -1;
+            continue;
+        }
+        lanes[lane].packet = packet;
+        lanes[lane].k = packet->ctx ? (const unsigned char *)(packet->ctx)
+                                    : packet->key;
+        lanes[lane].mlen = encrypt ? packet->inlen
+                                   : packet->inlen - ASCON128_TAG_SIZE;
+        if (packet->adlen > 0)
+            lanes[lane].ad_blocks = packet->adlen / rate + 1;
+        lanes[lane].m_blocks = lanes[lane].mlen / rate;
+        state.S[0][lane] = iv;
+        state.S[1][lane] = be_load_word64(lanes[lane].k);
+        state.S[2][lane] = be_load_word64(lanes[lane].k + 8);
+        state.S[3][lane] = be_load_word64(packet->npub);
+        state.S[4][lane] = be_load_word64(packet->npub + 8);
+    }
+    ascon_batch_permute(&state, 0);
+    for (lane = 0; lane < count; ++lane) {
+        if (!lanes[lane].packet)
+            continue;
+        state.S[3][lane] ^= be_load_word64(lanes[lane].k);
+        state.S[4][lane] ^= be_load_word64(lanes[lane].k + 8);
+    }
+
+    /* Absorb the associated data into the lanes that have some */
+    max_blocks = 0;
+    for (lane = 0; lane < count; ++lane) {
+        if (lanes[lane].ad_blocks > max_blocks)
+            max_blocks = lanes[lane].ad_blocks;
+    }
+    for (posn = 0; posn < max_blocks; ++posn) {
+        for (lane = 0; lane < ASCON_BATCH_LANES; ++lane) {
+            active[lane] = (posn < lanes[lane].ad_blocks);
+            if (!active[lane])
+                continue;
+            packet = lanes[lane].packet;
+            offset = posn * rate;
+            ascon_batch_get(&state, lane, block);
+            if ((packet->adlen - offset) >= rate) {
+                lw_xor_block(block, packet->ad + offset, rate);
+            } else {
+                len = (unsigned)(packet->adlen - offset);
+                lw_xor_block(block, packet->ad + offset, len);
+                block[len] ^= 0x80;
+            }
+            ascon_batch_set(&state, lane, block);
+        }
+        ascon_batch_permute_active(&state, active, first_round);
+    }
+
+    /* Separator between the associated data and the payload */
+    for (lane = 0; lane < ASCON_BATCH_LANES; ++lane)
+        state.S[4][lane] ^= 0x01;
+
+    /* Encrypt or decrypt the full blocks of the payload */
+    max_blocks = 0;
+    for (lane = 0; lane < count; ++lane) {
+        if (lanes[lane].m_blocks > max_blocks)
+            max_blocks = lanes[lane].m_blocks;
+    }
+    for (posn = 0; posn < max_blocks; ++posn) {
+        for (lane = 0; lane < ASCON_BATCH_LANES; ++lane) {
+            active[lane] = (posn < lanes[lane].m_blocks);
+            if (!active[lane])
+                continue;
+            packet = lanes[lane].packet;
+            offset = posn * rate;
+            ascon_batch_get(&state, lane, block);
+            if (encrypt) {
+                lw_xor_block_2_dest
+                    (packet->out + offset, block, packet->in + offset, rate);
+            } else {
+                lw_xor_block_swap
+                    (packet->out + offset, block, packet->in + offset, rate);
+            }
+            ascon_batch_set(&state, lane, block);
+        }
+        ascon_batch_permute_active(&state, active, first_round);
+    }
+
+    /* Process the last partial block of the payload and finalize */
+    for (lane = 0; lane < count; ++lane) {
+        if (!lanes[lane].packet)
+            continue;
+        packet = lanes[lane].packet;
+        offset = lanes[lane].m_blocks * rate;
+        len = (unsigned)(lanes[lane].mlen - offset);
+        ascon_batch_get(&state, lane, block);
+        if (encrypt) {
+            lw_xor_block_2_dest
+                (packet->out + offset, block, packet->in + offset, len);
+        } else {
+            lw_xor_block_swap
+                (packet->out + offset, block, packet->in + offset, len);
+        }
+        block[len] ^= 0x80;
+        ascon_batch_set(&state, lane, block);
+        state.S[key_word][lane] ^= be_load_word64(lanes[lane].k);
+        state.S[key_word + 1][lane] ^= be_load_word64(lanes[lane].k + 8);
+    }
+    ascon_batch_permute(&state, 0);
+
+    /* Generate or check the authentication tags */
+    for (lane = 0; lane < count; ++lane) {
+        if (!lanes[lane].packet)
+            continue;
+        packet = lanes[lane].packet;
+        be_store_word64
+            (tag, state.S[3][lane] ^ be_load_word64(lanes[lane].k));
+        be_store_word64
+            (tag + 8, state.S[4][lane] ^ be_load_word64(lanes[lane].k + 8));
+        if (encrypt) {
+            memcpy(packet->out + lanes[lane].mlen, tag, ASCON128_TAG_SIZE);
+            packet->outlen = lanes[lane].mlen + ASCON128_TAG_SIZE;
+            packet->result = 0;
+        } else {
+            packet->outlen = lanes[lane].mlen;
+            packet->result = aead_check_tag
+                (packet->out, lanes[lane].mlen, tag,
+                 packet->in + lanes[lane].mlen, ASCON128_TAG_SIZE);
+            if (packet->result != 0 && result == 0)
+                result = packet->result;
+        }
+    }
+    return result;
+}
+
+/**
+ * \brief Encrypts or decrypts a batch of packets with ASCON-128 or
+ * ASCON-128a, ASCON_BATCH_LANES packets at a time.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ * \param iv Initialization vector for the ASCON variant.
+ * \param rate Block rate, which is either 8 or 16.
+ * \param first_round First round of the permutation to apply each block.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ *
+ * \return 0 if every packet succeeded, or the result of the first
+ * packet that failed.
+ */
+static int ascon_batch
+    (aead_packet_t *packets, size_t count, uint64_t iv,
+     uint8_t rate, uint8_t first_round, int encrypt)
+{
+    unsigned group;
+    int result = 0;
+    int group_result;
+    while (count > 0) {
+        group = (count > ASCON_BATCH_LANES) ? ASCON_BATCH_LANES
+                                            : (unsigned)count;
+        group_result = ascon_batch_group
+            (packets, group, iv, rate, first_round, encrypt);
+        if (group_result != 0 && result == 0)
+            result = group_result;
+        packets += group;
+        count -= group;
+    }
+    return result;
+}
+
+int ascon128_aead_encrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return ascon_batch(packets, count, ASCON128_IV, 8, 6, 1);
+}
+
+int ascon128_aead_decrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return ascon_batch(packets, count, ASCON128_IV, 8, 6, 0);
+}
+
+int ascon128a_aead_encrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return ascon_batch(packets, count, ASCON128a_IV, 16, 4, 1);
+}
+
+int ascon128a_aead_decrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return ascon_batch(packets, count, ASCON128a_IV, 16, 4, 0);
+}
+
+/**
+ * \brief Incremental mode before any associated data has been absorbed.
+ */
+#define ASCON_AEAD_MODE_INIT 0
+
+/**
+ * \brief Incremental mode while associated data is being absorbed.
+ */
+#define ASCON_AEAD_MODE_AD 1
+
+/**
+ * \brief Incremental mode while the payload is being encrypted or decrypted.
+ */
+#define ASCON_AEAD_MODE_PAYLOAD 2
+
+/**
+ * \brief Gets the ASCON permutation state from an incremental AEAD state.
+ */
+#define ascon_aead_state(state) ((ascon_state_t *)((state)->s.state))
+
+/**
+ * \brief Initializes an incremental ASCON AEAD state after the IV, key,
+ * and nonce have been loaded into the permutation state.
+ *
+ * \param state The incremental AEAD state.
+ * \param k Points to the key.
+ * \param key_len Length of the key in bytes.
+ * \param rate Block rate, which is either 8 or 16.
+ * \param first_round First round of the permutation to apply each block.
+ */
+static void ascon_aead_init
+    (ascon_aead_state_t *state, const unsigned char *k,
+     unsigned key_len, uint8_t rate, uint8_t first_round)
+{
+    ascon_permute(ascon_aead_state(state), 0);
+    lw_xor_block(state->s.state + 40 - key_len, k, key_len);
+    memcpy(state->s.key, k, key_len);
+    state->s.key_len = (unsigned char)key_len;
+    state->s.rate = rate;
+    state->s.first_round = first_round;
+    state->s.count = 0;
+    state->s.mode = ASCON_AEAD_MODE_INIT;
+}
+
+void ascon128_aead_init
+    (ascon_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    be_store_word64(state->s.state, ASCON128_IV);
+    memcpy(state->s.state + 8, k, ASCON128_KEY_SIZE);
+    memcpy(state->s.state + 24, npub, ASCON128_NONCE_SIZE);
+    ascon_aead_init(state, k, ASCON128_KEY_SIZE, 8, 6);
+}
+
+void ascon128a_aead_init
+    (ascon_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    be_store_word64(state->s.state, ASCON128a_IV);
+    memcpy(state->s.state + 8, k, ASCON128_KEY_SIZE);
+    memcpy(state->s.state + 24, npub, ASCON128_NONCE_SIZE);
+    ascon_aead_init(state, k, ASCON128_KEY_SIZE, 16, 4);
+}
+
+void ascon80pq_aead_init
+    (ascon_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    be_store_word32(state->s.state, ASCON80PQ_IV);
+    memcpy(state->s.state + 4, k, ASCON80PQ_KEY_SIZE);
+    memcpy(state->s.state + 24, npub, ASCON80PQ_NONCE_SIZE);
+    ascon_aead_init(state, k, ASCON80PQ_KEY_SIZE, 8, 6);
+}
+
+void ascon_aead_update_ad
+    (ascon_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen)
+{
+    unsigned temp;
+    if (!adlen)
+        return;
+    state->s.mode = ASCON_AEAD_MODE_AD;
+    while (adlen > 0) {
+        temp = state->s.rate - state->s.count;
+        if (temp > adlen)
+            temp = (unsigned)adlen;
+        lw_xor_block(state->s.state + state->s.count, ad, temp);
+        state->s.count += temp;
+        ad += temp;
+        adlen -= temp;
+        if (state->s.count >= state->s.rate) {
+            ascon_permute(ascon_aead_state(state), state->s.first_round);
+            state->s.count = 0;
+        }
+    }
+}
+
+/**
+ * \brief Pads the associated data and switches an incremental ASCON
+ * AEAD state into payload mode if it is not in payload mode already.
+ *
+ * \param state The incremental AEAD state.
+ */
+static void ascon_aead_start_payload(ascon_aead_state_t *state)
+{
+    if (state->s.mode == ASCON_AEAD_MODE_PAYLOAD)
+        return;
+    if (state->s.mode == ASCON_AEAD_MODE_AD) {
+        state->s.state[state->s.count] ^= 0x80;
+        ascon_permute(ascon_aead_state(state), state->s.first_round);
+    }
+    state->s.state[39] ^= 0x01;
+    state->s.count = 0;
+    state->s.mode = ASCON_AEAD_MODE_PAYLOAD;
+}
+
+void ascon_aead_encrypt_update
+    (ascon_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len)
+{
+    unsigned temp;
+    ascon_aead_start_payload(state);
+    while (len > 0) {
+        temp = state->s.rate - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        lw_xor_block_2_dest(c, state->s.state + state->s.count, m, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+        if (state->s.count >= state->s.rate) {
+            ascon_permute(ascon_aead_state(state), state->s.first_round);
+            state->s.count = 0;
+        }
+    }
+}
+
+void ascon_aead_decrypt_update
+    (ascon_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len)
+{
+    unsigned temp;
+    ascon_aead_start_payload(state);
+    while (len > 0) {
+        temp = state->s.rate - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        lw_xor_block_swap(m, state->s.state + state->s.count, c, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+        if (state->s.count >= state->s.rate) {
+            ascon_permute(ascon_aead_state(state), state->s.first_round);
+            state->s.count = 0;
+        }
+    }
+}
+
+void ascon_aead_encrypt_final(ascon_aead_state_t *state, unsigned char *tag)
+{
+    unsigned key_len = state->s.key_len;
+
+    /* Pad the last payload block */
+    ascon_aead_start_payload(state);
+    state->s.state[state->s.count] ^= 0x80;
+
+    /* Finalize and compute the authentication tag */
+    lw_xor_block(state->s.state + state->s.rate, state->s.key, key_len);
+    ascon_permute(ascon_aead_state(state), 0);
+    lw_xor_block_2_src
+        (tag, state->s.state + 24, state->s.key + key_len - 16, 16);
+}
+
+int ascon_aead_decrypt_final
+    (ascon_aead_state_t *state, const unsigned char *tag)
+{
+    unsigned char computed[16];
+    ascon_aead_encrypt_final(state, computed);
+    return aead_check_tag(0, 0, computed, tag, 16);
+}
@@ -22,6 +22,7 @@
 
 #include "drygascon.h"
 #include "internal-drysponge.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const drygascon128_cipher = {
@@ -31,7 +32,18 @@ aead_cipher_t const drygascon128_cipher = {
     DRYGASCON128_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     drygascon128_aead_encrypt,
-    drygascon128_aead_decrypt
+    drygascon128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    drygascon128_aead_encrypt_vec,
+    drygascon128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const drygascon256_cipher = {
@@ -41,7 +53,18 @@ aead_cipher_t const drygascon256_cipher = {
     DRYGASCON256_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     drygascon256_aead_encrypt,
-    drygascon256_aead_decrypt
+    drygascon256_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    drygascon256_aead_encrypt_vec,
+    drygascon256_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const drygascon128_hash_algorithm = {
@@ -74,20 +97,23 @@ aead_hash_algorithm_t const drygascon256_hash_algorithm = {
  * \brief Processes associated data for DryGASCON128.
  *
  * \param state DrySPONGE128 sponge state.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data, must not be zero.
  * \param finalize Non-zero to finalize packet processing because
  * the message is zero-length.
  */
 static void drygascon128_process_ad
-    (drysponge128_state_t *state, const unsigned char *ad,
+    (drysponge128_state_t *state, aead_iovec_cursor_t *ad,
      unsigned long long adlen, int finalize)
 {
+    unsigned char buf[DRYSPONGE128_RATE];
+    const unsigned char *in;
+
     /* Process all blocks except the last one */
     while (adlen > DRYSPONGE128_RATE) {
-        drysponge128_f_absorb(state, ad, DRYSPONGE128_RATE);
+        in = aead_iovec_load_block(ad, buf, DRYSPONGE128_RATE);
+        drysponge128_f_absorb(state, in, DRYSPONGE128_RATE);
         drysponge128_g_core(state);
-        ad += DRYSPONGE128_RATE;
         adlen -= DRYSPONGE128_RATE;
     }
 
@@ -97,7 +123,8 @@ static void drygascon128_process_ad
         state->domain |= DRYDOMAIN128_FINAL;
     if (adlen < DRYSPONGE128_RATE)
         state->domain |= DRYDOMAIN128_PADDED;
-    drysponge128_f_absorb(state, ad, (unsigned)adlen);
+    in = aead_iovec_load_block(ad, buf, (unsigned)adlen);
+    drysponge128_f_absorb(state, in, (unsigned)adlen);
     drysponge128_g(state);
 }
 
@@ -105,20 +132,23 @@ static void drygascon128_process_ad
  * \brief Processes associated data for DryGASCON256.
  *
  * \param state DrySPONGE256 sponge state.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data, must not be zero.
  * \param finalize Non-zero to finalize packet processing because
  * the message is zero-length.
  */
 static void drygascon256_process_ad
-    (drysponge256_state_t *state, const unsigned char *ad,
+    (drysponge256_state_t *state, aead_iovec_cursor_t *ad,
      unsigned long long adlen, int finalize)
 {
+    unsigned char buf[DRYSPONGE256_RATE];
+    const unsigned char *in;
+
     /* Process all blocks except the last one */
     while (adlen > DRYSPONGE256_RATE) {
-        drysponge256_f_absorb(state, ad, DRYSPONGE256_RATE);
+        in = aead_iovec_load_block(ad, buf, DRYSPONGE256_RATE);
+        drysponge256_f_absorb(state, in, DRYSPONGE256_RATE);
         drysponge256_g_core(state);
-        ad += DRYSPONGE256_RATE;
         adlen -= DRYSPONGE256_RATE;
     }
 
@@ -128,41 +158,55 @@ static void drygascon256_process_ad
         state->domain |= DRYDOMAIN256_FINAL;
     if (adlen < DRYSPONGE256_RATE)
         state->domain |= DRYDOMAIN256_PADDED;
-    drysponge256_f_absorb(state, ad, (unsigned)adlen);
+    in = aead_iovec_load_block(ad, buf, (unsigned)adlen);
+    drysponge256_f_absorb(state, in, (unsigned)adlen);
     drysponge256_g(state);
 }
 
-int drygascon128_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int drygascon128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     drysponge128_state_t state;
+    unsigned char inbuf[DRYSPONGE128_RATE];
+    unsigned char outbuf[DRYSPONGE128_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + DRYGASCON128_TAG_SIZE))
+        return -2;
     *clen = mlen + DRYGASCON128_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the sponge state with the key and nonce */
     drysponge128_setup(&state, k, npub, adlen == 0 && mlen == 0);
 
     /* Process the associated data */
     if (adlen > 0)
-        drygascon128_process_ad(&state, ad, adlen, mlen == 0);
+        drygascon128_process_ad(&state, &adcur, adlen, mlen == 0);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         /* Processs all blocks except the last one */
         while (mlen > DRYSPONGE128_RATE) {
-            drysponge128_f_absorb(&state, m, DRYSPONGE128_RATE);
-            lw_xor_block_2_src(c, m, state.r.B, DRYSPONGE128_RATE);
+            in = aead_iovec_load_block(&mcur, inbuf, DRYSPONGE128_RATE);
+            out = aead_iovec_store_begin(&ccur, outbuf, DRYSPONGE128_RATE);
+            drysponge128_f_absorb(&state, in, DRYSPONGE128_RATE);
+            lw_xor_block_2_src(out, in, state.r.B, DRYSPONGE128_RATE);
+            aead_iovec_store_end(&ccur, outbuf, out, DRYSPONGE128_RATE);
             drysponge128_g(&state);
-            c += DRYSPONGE128_RATE;
-            m += DRYSPONGE128_RATE;
             mlen -= DRYSPONGE128_RATE;
         }
 
@@ -171,34 +215,48 @@ int drygascon128_aead_encrypt
         if (mlen < DRYSPONGE128_RATE)
             state.domain |= DRYDOMAIN128_PADDED;
         temp = (unsigned)mlen;
-        drysponge128_f_absorb(&state, m, temp);
-        lw_xor_block_2_src(c, m, state.r.B, temp);
+        in = aead_iovec_load_block(&mcur, inbuf, temp);
+        out = aead_iovec_store_begin(&ccur, outbuf, temp);
+        drysponge128_f_absorb(&state, in, temp);
+        lw_xor_block_2_src(out, in, state.r.B, temp);
+        aead_iovec_store_end(&ccur, outbuf, out, temp);
         drysponge128_g(&state);
-        c += temp;
     }
 
     /* Generate the authentication tag */
-    memcpy(c, state.r.B, DRYGASCON128_TAG_SIZE);
+    aead_iovec_write(&ccur, state.r.B, DRYGASCON128_TAG_SIZE);
     return 0;
 }
 
-int drygascon128_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int drygascon128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     drysponge128_state_t state;
-    unsigned char *mtemp = m;
+    unsigned char inbuf[DRYSPONGE128_RATE];
+    unsigned char outbuf[DRYSPONGE128_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned char tag[DRYGASCON128_TAG_SIZE];
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < DRYGASCON128_TAG_SIZE)
         return -1;
     *mlen = clen - DRYGASCON128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the sponge state with the key and nonce */
     clen -= DRYGASCON128_TAG_SIZE;
@@ -206,17 +264,18 @@ int drygascon128_aead_decrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        drygascon128_process_ad(&state, ad, adlen, clen == 0);
+        drygascon128_process_ad(&state, &adcur, adlen, clen == 0);
 
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > 0) {
         /* Processs all blocks except the last one */
         while (clen > DRYSPONGE128_RATE) {
-            lw_xor_block_2_src(m, c, state.r.B, DRYSPONGE128_RATE);
-            drysponge128_f_absorb(&state, m, DRYSPONGE128_RATE);
+            in = aead_iovec_load_block(&ccur, inbuf, DRYSPONGE128_RATE);
+            out = aead_iovec_store_begin(&mcur, outbuf, DRYSPONGE128_RATE);
+            lw_xor_block_2_src(out, in, state.r.B, DRYSPONGE128_RATE);
+            drysponge128_f_absorb(&state, out, DRYSPONGE128_RATE);
+            aead_iovec_store_end(&mcur, outbuf, out, DRYSPONGE128_RATE);
             drysponge128_g(&state);
-            c += DRYSPONGE128_RATE;
-            m += DRYSPONGE128_RATE;
             clen -= DRYSPONGE128_RATE;
         }
 
@@ -225,47 +284,97 @@ int drygascon128_aead_decrypt
         if (clen < DRYSPONGE128_RATE)
             state.domain |= DRYDOMAIN128_PADDED;
         temp = (unsigned)clen;
-        lw_xor_block_2_src(m, c, state.r.B, temp);
-        drysponge128_f_absorb(&state, m, temp);
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
+        lw_xor_block_2_src(out, in, state.r.B, temp);
+        drysponge128_f_absorb(&state, out, temp);
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
         drysponge128_g(&state);
-        c += temp;
     }
 
     /* Check the authentication tag */
-    return aead_check_tag(mtemp, *mlen, state.r.B, c, DRYGASCON128_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, DRYGASCON128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state.r.B, tag, DRYGASCON128_TAG_SIZE);
 }
 
-int drygascon256_aead_encrypt
+int drygascon128_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + DRYGASCON128_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return drygascon128_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int drygascon128_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= DRYGASCON128_TAG_SIZE ?
+                   clen - DRYGASCON128_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return drygascon128_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int drygascon256_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     drysponge256_state_t state;
+    unsigned char inbuf[DRYSPONGE256_RATE];
+    unsigned char outbuf[DRYSPONGE256_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + DRYGASCON256_TAG_SIZE))
+        return -2;
     *clen = mlen + DRYGASCON256_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the sponge state with the key and nonce */
     drysponge256_setup(&state, k, npub, adlen == 0 && mlen == 0);
 
     /* Process the associated data */
     if (adlen > 0)
-        drygascon256_process_ad(&state, ad, adlen, mlen == 0);
+        drygascon256_process_ad(&state, &adcur, adlen, mlen == 0);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         /* Processs all blocks except the last one */
         while (mlen > DRYSPONGE256_RATE) {
-            drysponge256_f_absorb(&state, m, DRYSPONGE256_RATE);
-            lw_xor_block_2_src(c, m, state.r.B, DRYSPONGE256_RATE);
+            in = aead_iovec_load_block(&mcur, inbuf, DRYSPONGE256_RATE);
+            out = aead_iovec_store_begin(&ccur, outbuf, DRYSPONGE256_RATE);
+            drysponge256_f_absorb(&state, in, DRYSPONGE256_RATE);
+            lw_xor_block_2_src(out, in, state.r.B, DRYSPONGE256_RATE);
+            aead_iovec_store_end(&ccur, outbuf, out, DRYSPONGE256_RATE);
             drysponge256_g(&state);
-            c += DRYSPONGE256_RATE;
-            m += DRYSPONGE256_RATE;
             mlen -= DRYSPONGE256_RATE;
         }
 
@@ -274,37 +383,51 @@ int drygascon256_aead_encrypt
         if (mlen < DRYSPONGE256_RATE)
             state.domain |= DRYDOMAIN256_PADDED;
         temp = (unsigned)mlen;
-        drysponge256_f_absorb(&state, m, temp);
-        lw_xor_block_2_src(c, m, state.r.B, temp);
+        in = aead_iovec_load_block(&mcur, inbuf, temp);
+        out = aead_iovec_store_begin(&ccur, outbuf, temp);
+        drysponge256_f_absorb(&state, in, temp);
+        lw_xor_block_2_src(out, in, state.r.B, temp);
+        aead_iovec_store_end(&ccur, outbuf, out, temp);
         drysponge256_g(&state);
-        c += temp;
     }
 
     /* Generate the authentication tag */
-    memcpy(c, state.r.B, 16);
+    aead_iovec_write(&ccur, state.r.B, 16);
     drysponge256_g(&state);
-    memcpy(c + 16, state.r.B, 16);
+    aead_iovec_write(&ccur, state.r.B, 16);
     return 0;
 }
 
-int drygascon256_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int drygascon256_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     drysponge256_state_t state;
-    unsigned char *mtemp = m;
+    unsigned char inbuf[DRYSPONGE256_RATE];
+    unsigned char outbuf[DRYSPONGE256_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned char tag[DRYGASCON256_TAG_SIZE];
+    unsigned char expected[DRYGASCON256_TAG_SIZE];
     unsigned temp;
-    int result;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < DRYGASCON256_TAG_SIZE)
         return -1;
     *mlen = clen - DRYGASCON256_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the sponge state with the key and nonce */
     clen -= DRYGASCON256_TAG_SIZE;
@@ -312,17 +435,18 @@ int drygascon256_aead_decrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        drygascon256_process_ad(&state, ad, adlen, clen == 0);
+        drygascon256_process_ad(&state, &adcur, adlen, clen == 0);
 
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > 0) {
         /* Processs all blocks except the last one */
         while (clen > DRYSPONGE256_RATE) {
-            lw_xor_block_2_src(m, c, state.r.B, DRYSPONGE256_RATE);
-            drysponge256_f_absorb(&state, m, DRYSPONGE256_RATE);
+            in = aead_iovec_load_block(&ccur, inbuf, DRYSPONGE256_RATE);
+            out = aead_iovec_store_begin(&mcur, outbuf, DRYSPONGE256_RATE);
+            lw_xor_block_2_src(out, in, state.r.B, DRYSPONGE256_RATE);
+            drysponge256_f_absorb(&state, out, DRYSPONGE256_RATE);
+            aead_iovec_store_end(&mcur, outbuf, out, DRYSPONGE256_RATE);
             drysponge256_g(&state);
-            c += DRYSPONGE256_RATE;
-            m += DRYSPONGE256_RATE;
             clen -= DRYSPONGE256_RATE;
         }
 
@@ -331,17 +455,54 @@ int drygascon256_aead_decrypt
         if (clen < DRYSPONGE256_RATE)
             state.domain |= DRYDOMAIN256_PADDED;
         temp = (unsigned)clen;
-        lw_xor_block_2_src(m, c, state.r.B, temp);
-        drysponge256_f_absorb(&state, m, temp);
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
+        lw_xor_block_2_src(out, in, state.r.B, temp);
+        drysponge256_f_absorb(&state, out, temp);
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
         drysponge256_g(&state);
-        c += temp;
     }
 
-    /* Check the authentication tag which is split into two pieces */
-    result = aead_check_tag(0, 0, state.r.B, c, 16);
+    /* Check the authentication tag which is generated in two pieces */
+    memcpy(expected, state.r.B, 16);
     drysponge256_g(&state);
-    return aead_check_tag_precheck
-        (mtemp, *mlen, state.r.B, c + 16, 16, ~result);
+    memcpy(expected + 16, state.r.B, 16);
+    aead_iovec_read(&ccur, tag, DRYGASCON256_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, expected, tag, DRYGASCON256_TAG_SIZE);
+}
+
+int drygascon256_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + DRYGASCON256_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return drygascon256_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int drygascon256_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= DRYGASCON256_TAG_SIZE ?
+                   clen - DRYGASCON256_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return drygascon256_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 /**
@@ -366,12 +527,16 @@ int drygascon128_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen)
 {
     drysponge128_state_t state;
+    aead_iovec_t invec;
+    aead_iovec_cursor_t incur;
     memcpy(state.c.B, drygascon128_hash_init, sizeof(state.c.B));
     memcpy(state.x.B, drygascon128_hash_init + sizeof(state.c.B),
            sizeof(state.x.B));
     state.domain = 0;
     state.rounds = DRYSPONGE128_ROUNDS;
-    drygascon128_process_ad(&state, in, inlen, 1);
+    aead_iovec_set(&invec, in, inlen);
+    aead_iovec_start(&incur, &invec, 1);
+    drygascon128_process_ad(&state, &incur, inlen, 1);
     memcpy(out, state.r.B, 16);
     drysponge128_g(&state);
     memcpy(out + 16, state.r.B, 16);
@@ -404,12 +569,16 @@ int drygascon256_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen)
 {
     drysponge256_state_t state;
+    aead_iovec_t invec;
+    aead_iovec_cursor_t incur;
     memcpy(state.c.B, drygascon256_hash_init, sizeof(state.c.B));
     memcpy(state.x.B, drygascon256_hash_init + sizeof(state.c.B),
            sizeof(state.x.B));
     state.domain = 0;
     state.rounds = DRYSPONGE256_ROUNDS;
-    drygascon256_process_ad(&state, in, inlen, 1);
+    aead_iovec_set(&invec, in, inlen);
+    aead_iovec_start(&incur, &invec, 1);
+    drygascon256_process_ad(&state, &incur, inlen, 1);
     memcpy(out, state.r.B, 16);
     drysponge256_g(&state);
     memcpy(out + 16, state.r.B, 16);
@@ -22,6 +22,7 @@
 
 #include "forkae.h"
 #include "internal-forkskinny.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const forkae_paef_64_192_cipher = {
@@ -31,7 +32,18 @@ aead_cipher_t const forkae_paef_64_192_cipher = {
     FORKAE_PAEF_64_192_TAG_SIZE,
     AEAD_FLAG_NONE,
     forkae_paef_64_192_aead_encrypt,
-    forkae_paef_64_192_aead_decrypt
+    forkae_paef_64_192_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    forkae_paef_64_192_aead_encrypt_vec,
+    forkae_paef_64_192_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const forkae_paef_128_192_cipher = {
@@ -41,7 +53,18 @@ aead_cipher_t const forkae_paef_128_192_cipher = {
     FORKAE_PAEF_128_192_TAG_SIZE,
     AEAD_FLAG_NONE,
     forkae_paef_128_192_aead_encrypt,
-    forkae_paef_128_192_aead_decrypt
+    forkae_paef_128_192_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    forkae_paef_128_192_aead_encrypt_vec,
+    forkae_paef_128_192_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const forkae_paef_128_256_cipher = {
@@ -51,7 +74,18 @@ aead_cipher_t const forkae_paef_128_256_cipher = {
     FORKAE_PAEF_128_256_TAG_SIZE,
     AEAD_FLAG_NONE,
     forkae_paef_128_256_aead_encrypt,
-    forkae_paef_128_256_aead_decrypt
+    forkae_paef_128_256_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    forkae_paef_128_256_aead_encrypt_vec,
+    forkae_paef_128_256_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const forkae_paef_128_288_cipher = {
@@ -61,7 +95,18 @@ aead_cipher_t const forkae_paef_128_288_cipher = {
     FORKAE_PAEF_128_288_TAG_SIZE,
     AEAD_FLAG_NONE,
     forkae_paef_128_288_aead_encrypt,
-    forkae_paef_128_288_aead_decrypt
+    forkae_paef_128_288_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    forkae_paef_128_288_aead_encrypt_vec,
+    forkae_paef_128_288_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const forkae_saef_128_192_cipher = {
@@ -71,7 +116,18 @@ aead_cipher_t const forkae_saef_128_192_cipher = {
     FORKAE_SAEF_128_192_TAG_SIZE,
     AEAD_FLAG_NONE,
     forkae_saef_128_192_aead_encrypt,
-    forkae_saef_128_192_aead_decrypt
+    forkae_saef_128_192_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    forkae_saef_128_192_aead_encrypt_vec,
+    forkae_saef_128_192_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const forkae_saef_128_256_cipher = {
@@ -81,7 +137,18 @@ aead_cipher_t const forkae_saef_128_256_cipher = {
     FORKAE_SAEF_128_256_TAG_SIZE,
     AEAD_FLAG_NONE,
     forkae_saef_128_256_aead_encrypt,
-    forkae_saef_128_256_aead_decrypt
+    forkae_saef_128_256_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    forkae_saef_128_256_aead_encrypt_vec,
+    forkae_saef_128_256_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /* PAEF-ForkSkinny-64-192 */
@@ -100,6 +167,9 @@ aead_cipher_t const forkae_saef_128_256_cipher = {
 #define FORKAE_COUNTER_SIZE 2
 #define FORKAE_TWEAKEY_SIZE 32
 #define FORKAE_BLOCK_FUNC forkskinny_128_256
+#if FORKSKINNY_128_BLOCKS_MAX > 1
+#define FORKAE_PARALLEL_BLOCKS FORKSKINNY_128_BLOCKS_MAX
+#endif
 #include "internal-forkae-paef.h"
 
 /* PAEF-ForkSkinny-128-256 */
@@ -109,6 +179,9 @@ aead_cipher_t const forkae_saef_128_256_cipher = {
 #define FORKAE_COUNTER_SIZE 2
 #define FORKAE_TWEAKEY_SIZE 32
 #define FORKAE_BLOCK_FUNC forkskinny_128_256
+#if FORKSKINNY_128_BLOCKS_MAX > 1
+#define FORKAE_PARALLEL_BLOCKS FORKSKINNY_128_BLOCKS_MAX
+#endif
 #include "internal-forkae-paef.h"
 
 /* PAEF-ForkSkinny-128-288 */
@@ -118,6 +191,9 @@ aead_cipher_t const forkae_saef_128_256_cipher = {
 #define FORKAE_COUNTER_SIZE 7
 #define FORKAE_TWEAKEY_SIZE 48
 #define FORKAE_BLOCK_FUNC forkskinny_128_384
+#if FORKSKINNY_128_BLOCKS_MAX > 1
+#define FORKAE_PARALLEL_BLOCKS FORKSKINNY_128_BLOCKS_MAX
+#endif
 #include "internal-forkae-paef.h"
 
 /* SAEF-ForkSkinny-128-192 */
@@ -141,6 +217,193 @@ aead_cipher_t const forkae_saef_128_256_cipher = {
 /* Helper functions to implement the forking encrypt/decrypt block operations
  * on top of the basic "perform N rounds" functions in internal-forkskinny.c */
 
+/**
+ * \brief Operations and parameters for multi-block ForkSkinny-128.
+ */
+typedef struct
+{
+    unsigned key_size;      /**< Size of each tweakey in bytes */
+    unsigned before;        /**< Number of rounds before forking */
+    unsigned after;         /**< Number of rounds after forking */
+    void (*rounds)(forkskinny_128_blocks_state_t *state,
+                   unsigned first, unsigned last);
+    void (*inv_rounds)(forkskinny_128_blocks_state_t *state,
+                       unsigned first, unsigned last);
+    void (*forward_tk)(forkskinny_128_blocks_state_t *state, unsigned rounds);
+    void (*reverse_tk)(forkskinny_128_blocks_state_t *state, unsigned rounds);
+
+} forkskinny_128_blocks_ops_t;
+
+/**
+ * \brief Loads the tweakeys and input blocks into a multi-block state.
+ *
+ * \param state The multi-block state to load.
+ * \param key_size Size of each tweakey, 32 or 48.
+ * \param key Points to the tweakeys.
+ * \param input Points to the input blocks.
+ * \param count Number of blocks, between 1 and FORKSKINNY_128_BLOCKS_MAX.
+ */
+static void forkskinny_128_blocks_load
+    (forkskinny_128_blocks_state_t *state, unsigned key_size,
+     const unsigned char *key, const unsigned char *input, unsigned count)
+{
+    unsigned index, word;
+    if (count < FORKSKINNY_128_BLOCKS_MAX)
+        memset(state, 0, sizeof(forkskinny_128_blocks_state_t));
+    state->count = count;
+    for (index = 0; index < count; ++index) {
+        for (word = 0; word < 4; ++word) {
+            state->TK1[word][index] = le_load_word32(key + word * 4);
+            state->TK2[word][index] = le_load_word32(key + 16 + word * 4);
+            if (key_size > 32)
+                state->TK3[word][index] = le_load_word32(key + 32 + word * 4);
+            state->S[word][index] = le_load_word32(input + word * 4);
+        }
+        key += key_size;
+        input += 16;
+    }
+}
+
+/**
+ * \brief Stores the blocks from a multi-block state.
+ *
+ * \param state The multi-block state.
+ * \param output Points to the output buffer for the blocks.
+ */
+static void forkskinny_128_blocks_store
+    (const forkskinny_128_blocks_state_t *state, unsigned char *output)
+{
+    unsigned index, word;
+    for (index = 0; index < state->count; ++index) {
+        for (word = 0; word < 4; ++word)
+            le_store_word32(output + word * 4, state->S[word][index]);
+        output += 16;
+    }
+}
+
+/**
+ * \brief XOR's the branching constant with all blocks of a multi-block state.
+ *
+ * \param state The multi-block state.
+ */
+static void forkskinny_128_blocks_branch(forkskinny_128_blocks_state_t *state)
+{
+    unsigned index;
+    for (index = 0; index < state->count; ++index) {
+        state->S[0][index] ^= 0x08040201U;
+        state->S[1][index] ^= 0x82412010U;
+        state->S[2][index] ^= 0x28140a05U;
+        state->S[3][index] ^= 0x8844a251U;
+    }
+}
+
+/**
+ * \brief Encrypts multiple blocks with ForkSkinny-128.
+ *
+ * \param ops Operations and parameters for the ForkSkinny-128 variant.
+ * \param key Points to the tweakeys, one for each block.
+ * \param output_left Left output blocks, or NULL if not required.
+ * \param output_right Right output blocks, which are always generated.
+ * \param input Points to the input blocks.
+ * \param count Number of blocks to encrypt.
+ */
+static void forkskinny_128_encrypt_blocks
+    (const forkskinny_128_blocks_ops_t *ops, const unsigned char *key,
+     unsigned char *output_left, unsigned char *output_right,
+     const unsigned char *input, size_t count)
+{
+    forkskinny_128_blocks_state_t state;
+    uint32_t F[4][FORKSKINNY_128_BLOCKS_MAX];
+    unsigned n;
+    while (count > 0) {
+        n = count < FORKSKINNY_128_BLOCKS_MAX
+                ? (unsigned)count : FORKSKINNY_128_BLOCKS_MAX;
+
+        /* Run all of the rounds before the forking point */
+        forkskinny_128_blocks_load(&state, ops->key_size, key, input, n);
+        (*(ops->rounds))(&state, 0, ops->before);
+
+        /* Generate the right output blocks, saving the state at the
+         * forking point if we also need the left output blocks */
+        if (output_left)
+            memcpy(F, state.S, sizeof(F));
+        (*(ops->rounds))(&state, ops->before, ops->before + ops->after);
+        forkskinny_128_blocks_store(&state, output_right);
+        output_right += n * 16;
+
+        /* Generate the left output blocks from the forking point */
+        if (output_left) {
+            memcpy(state.S, F, sizeof(F));
+            forkskinny_128_blocks_branch(&state);
+            (*(ops->rounds))
+                (&state, ops->before + ops->after,
+                 ops->before + ops->after * 2);
+            forkskinny_128_blocks_store(&state, output_left);
+            output_left += n * 16;
+        }
+        key += n * ops->key_size;
+        input += n * 16;
+        count -= n;
+    }
+}
+
+/**
+ * \brief Decrypts multiple blocks with ForkSkinny-128.
+ *
+ * \param ops Operations and parameters for the ForkSkinny-128 variant.
+ * \param key Points to the tweakeys, one for each block.
+ * \param output_left Left output blocks, which are the plaintext.
+ * \param output_right Right output blocks for the authentication tags.
+ * \param input Points to the input blocks.
+ * \param count Number of blocks to decrypt.
+ */
+static void forkskinny_128_decrypt_blocks
+    (const forkskinny_128_blocks_ops_t *ops, const unsigned char *key,
+     unsigned char *output_left, unsigned char *output_right,
+     const unsigned char *input, size_t count)
+{
+    forkskinny_128_blocks_state_t state;
+    forkskinny_128_blocks_state_t fstate;
+    unsigned n;
+    while (count > 0) {
+        n = count < FORKSKINNY_128_BLOCKS_MAX
+                ? (unsigned)count : FORKSKINNY_128_BLOCKS_MAX;
+        forkskinny_128_blocks_load(&state, ops->key_size, key, input, n);
+
+        /* Fast-forward the tweakeys to the end of the key schedule */
+        (*(ops->forward_tk))(&state, ops->before + ops->after * 2);
+
+        /* Perform the "after" rounds on the input to get back
+         * to the forking point in the cipher */
+        (*(ops->inv_rounds))
+            (&state, ops->before + ops->after * 2, ops->before + ops->after);
+
+        /* Remove the branching constant */
+        forkskinny_128_blocks_branch(&state);
+
+        /* Roll the tweakeys back another "after" rounds */
+        (*(ops->reverse_tk))(&state, ops->after);
+
+        /* Save the state and the tweakeys at the forking point */
+        fstate = state;
+
+        /* Generate the left output blocks after another "before" rounds */
+        (*(ops->inv_rounds))(&state, ops->before, 0);
+        forkskinny_128_blocks_store(&state, output_left);
+
+        /* Generate the right output blocks by going forward "after"
+         * rounds from the forking point */
+        (*(ops->rounds))(&fstate, ops->before, ops->before + ops->after);
+        forkskinny_128_blocks_store(&fstate, output_right);
+
+        key += n * ops->key_size;
+        input += n * 16;
+        output_left += n * 16;
+        output_right += n * 16;
+        count -= n;
+    }
+}
+
 /**
  * \brief Number of rounds of ForkSkinny-128-256 before forking.
  */
@@ -157,6 +420,8 @@ void forkskinny_128_256_encrypt
 {
     forkskinny_128_256_state_t state;
 
+    aead_count_call(AEAD_PRIMITIVE_FORKSKINNY_128_256);
+
     /* Unpack the tweakey and the input */
     state.TK1[0] = le_load_word32(key);
     state.TK1[1] = le_load_word32(key + 4);
@@ -234,6 +499,8 @@ void forkskinny_128_256_decrypt
     forkskinny_128_256_state_t state;
     forkskinny_128_256_state_t fstate;
 
+    aead_count_call(AEAD_PRIMITIVE_FORKSKINNY_128_256);
+
     /* Unpack the tweakey and the input */
     state.TK1[0] = le_load_word32(key);
     state.TK1[1] = le_load_word32(key + 4);
@@ -293,6 +560,39 @@ void forkskinny_128_256_decrypt
     le_store_word32(output_right + 12, fstate.S[3]);
 }
 
+/**
+ * \brief Multi-block operations for ForkSkinny-128-256.
+ */
+static forkskinny_128_blocks_ops_t const forkskinny_128_256_blocks_ops = {
+    32,
+    FORKSKINNY_128_256_ROUNDS_BEFORE,
+    FORKSKINNY_128_256_ROUNDS_AFTER,
+    forkskinny_128_256_rounds_blocks,
+    forkskinny_128_256_inv_rounds_blocks,
+    forkskinny_128_256_forward_tk_blocks,
+    forkskinny_128_256_reverse_tk_blocks
+};
+
+void forkskinny_128_256_encrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count)
+{
+    aead_count_calls(AEAD_PRIMITIVE_FORKSKINNY_128_256, count);
+    forkskinny_128_encrypt_blocks
+        (&forkskinny_128_256_blocks_ops, key, output_left, output_right,
+         input, count);
+}
+
+void forkskinny_128_256_decrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count)
+{
+    aead_count_calls(AEAD_PRIMITIVE_FORKSKINNY_128_256, count);
+    forkskinny_128_decrypt_blocks
+        (&forkskinny_128_256_blocks_ops, key, output_left, output_right,
+         input, count);
+}
+
 /**
  * \brief Number of rounds of ForkSkinny-128-384 before forking.
  */
@@ -309,6 +609,8 @@ void forkskinny_128_384_encrypt
 {
     forkskinny_128_384_state_t state;
 
+    aead_count_call(AEAD_PRIMITIVE_FORKSKINNY_128_384);
+
     /* Unpack the tweakey and the input */
     state.TK1[0] = le_load_word32(key);
     state.TK1[1] = le_load_word32(key + 4);
@@ -390,6 +692,8 @@ void forkskinny_128_384_decrypt
     forkskinny_128_384_state_t state;
     forkskinny_128_384_state_t fstate;
 
+    aead_count_call(AEAD_PRIMITIVE_FORKSKINNY_128_384);
+
     /* Unpack the tweakey and the input */
     state.TK1[0] = le_load_word32(key);
     state.TK1[1] = le_load_word32(key + 4);
@@ -452,6 +756,39 @@ void forkskinny_128_384_decrypt
     le_store_word32(output_right + 12, fstate.S[3]);
 }
 
+/**
+ * \brief Multi-block operations for ForkSkinny-128-384.
+ */
+static forkskinny_128_blocks_ops_t const forkskinny_128_384_blocks_ops = {
+    48,
+    FORKSKINNY_128_384_ROUNDS_BEFORE,
+    FORKSKINNY_128_384_ROUNDS_AFTER,
+    forkskinny_128_384_rounds_blocks,
+    forkskinny_128_384_inv_rounds_blocks,
+    forkskinny_128_384_forward_tk_blocks,
+    forkskinny_128_384_reverse_tk_blocks
+};
+
+void forkskinny_128_384_encrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count)
+{
+    aead_count_calls(AEAD_PRIMITIVE_FORKSKINNY_128_384, count);
+    forkskinny_128_encrypt_blocks
+        (&forkskinny_128_384_blocks_ops, key, output_left, output_right,
+         input, count);
+}
+
+void forkskinny_128_384_decrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count)
+{
+    aead_count_calls(AEAD_PRIMITIVE_FORKSKINNY_128_384, count);
+    forkskinny_128_decrypt_blocks
+        (&forkskinny_128_384_blocks_ops, key, output_left, output_right,
+         input, count);
+}
+
 /**
  * \brief Number of rounds of ForkSkinny-64-192 before forking.
  */
@@ -468,6 +805,8 @@ void forkskinny_64_192_encrypt
 {
     forkskinny_64_192_state_t state;
 
+    aead_count_call(AEAD_PRIMITIVE_FORKSKINNY_64_192);
+
     /* Unpack the tweakey and the input */
     state.TK1[0] = be_load_word16(key);
     state.TK1[1] = be_load_word16(key + 2);
@@ -549,6 +888,8 @@ void forkskinny_64_192_decrypt
     forkskinny_64_192_state_t state;
     forkskinny_64_192_state_t fstate;
 
+    aead_count_call(AEAD_PRIMITIVE_FORKSKINNY_64_192);
+
     /* Unpack the tweakey and the input */
     state.TK1[0] = be_load_word16(key);
     state.TK1[1] = be_load_word16(key + 2);
@@ -77,6 +77,20 @@ typedef union
 
 } gimli24_hash_state_t;
 
+/**
+ * \brief State information for the incremental GIMLI-24 AEAD mode.
+ */
+typedef union
+{
+    struct {
+        unsigned char state[48]; /**< Current permutation state */
+        unsigned char count;     /**< Number of bytes in the current block */
+        unsigned char mode;      /**< Current phase of the operation */
+    } s;                         /**< State */
+    unsigned long long align;    /**< For alignment of this structure */
+
+} gimli24_aead_state_t;
+
 /**
  * \brief Meta-information block for the GIMLI-24 cipher.
  */
@@ -150,6 +164,177 @@ int gimli24_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet
+ * with GIMLI-24.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 32 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa gimli24_aead_decrypt_vec(), gimli24_aead_encrypt()
+ */
+int gimli24_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet
+ * with GIMLI-24.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 32 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa gimli24_aead_encrypt_vec(), gimli24_aead_decrypt()
+ */
+int gimli24_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a batch of packets with GIMLI-24.
+ *
+ * \param packets Points to the array of packet descriptors.  Each
+ * packet has a 32 byte key or key context and a 16 byte nonce.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was encrypted, or the result of the first
+ * packet that failed.
+ *
+ * Pairs of packets are processed in lock-step, which allows two
+ * GIMLI-24 states to be permuted at once with AVX2.  Throughput is
+ * best when the packets in a batch have similar lengths.
+ *
+ * \sa gimli24_aead_decrypt_batch(), aead_cipher_encrypt_batch()
+ */
+int gimli24_aead_encrypt_batch(aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Decrypts and authenticates a batch of packets with GIMLI-24.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was decrypted, or the result of the first
+ * packet that failed.
+ *
+ * \sa gimli24_aead_encrypt_batch(), aead_cipher_decrypt_batch()
+ */
+int gimli24_aead_decrypt_batch(aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Initializes the state for an incremental GIMLI-24 operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 16 bytes of the public nonce.
+ * \param k Points to the 32 bytes of the key.
+ *
+ * \sa gimli24_aead_update_ad(), gimli24_aead_encrypt_update(),
+ * gimli24_aead_decrypt_update()
+ */
+void gimli24_aead_init
+    (gimli24_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Absorbs more associated data into an incremental GIMLI-24 state.
+ *
+ * \param state The incremental AEAD state.
+ * \param ad Points to the associated data.
+ * \param adlen Length of the associated data in bytes.
+ *
+ * This function must not be called after encryption or decryption
+ * has started.
+ */
+void gimli24_aead_update_ad
+    (gimli24_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen);
+
+/**
+ * \brief Encrypts more plaintext with an incremental GIMLI-24 state.
+ *
+ * \param state The incremental AEAD state.
+ * \param c Buffer to receive the ciphertext, which may be the same
+ * as \a m.
+ * \param m Points to the plaintext to encrypt.
+ * \param len Number of bytes to encrypt.
+ *
+ * \sa gimli24_aead_encrypt_final()
+ */
+void gimli24_aead_encrypt_update
+    (gimli24_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len);
+
+/**
+ * \brief Decrypts more ciphertext with an incremental GIMLI-24 state.
+ *
+ * \param state The incremental AEAD state.
+ * \param m Buffer to receive the plaintext, which may be the same
+ * as \a c.
+ * \param c Points to the ciphertext to decrypt.
+ * \param len Number of bytes to decrypt.
+ *
+ * The plaintext is not authenticated until gimli24_aead_decrypt_final()
+ * succeeds and must be discarded if it fails.
+ */
+void gimli24_aead_decrypt_update
+    (gimli24_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len);
+
+/**
+ * \brief Finishes an incremental GIMLI-24 encryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Buffer to receive the 16 byte authentication tag.
+ */
+void gimli24_aead_encrypt_final
+    (gimli24_aead_state_t *state, unsigned char *tag);
+
+/**
+ * \brief Finishes an incremental GIMLI-24 decryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Points to the 16 byte authentication tag to check.
+ *
+ * \return 0 if the tag is correct or -1 if it is incorrect.
+ */
+int gimli24_aead_decrypt_final
+    (gimli24_aead_state_t *state, const unsigned char *tag);
+
 /**
  * \brief Hashes a block of input data with GIMLI-24 to generate a hash value.
  *
@@ -130,6 +130,65 @@ int hyena_v1_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with HYENA-v1.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 12 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa hyena_v1_aead_decrypt_vec(), hyena_v1_aead_encrypt()
+ */
+int hyena_v1_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with HYENA-v1.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 12 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa hyena_v1_aead_encrypt_vec(), hyena_v1_aead_decrypt()
+ */
+int hyena_v1_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
 /**
  * \brief Encrypts and authenticates a packet with HYENA-v2.
  *
@@ -189,6 +248,65 @@ int hyena_v2_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with HYENA-v2.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 12 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa hyena_v2_aead_decrypt_vec(), hyena_v2_aead_encrypt()
+ */
+int hyena_v2_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with HYENA-v2.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 12 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa hyena_v2_aead_encrypt_vec(), hyena_v2_aead_decrypt()
+ */
+int hyena_v2_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
 #ifdef __cplusplus
 }
 #endif
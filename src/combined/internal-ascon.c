@@ -21,6 +21,7 @@
  */
 
 #include "internal-ascon.h"
+#include "internal-cpu.h"
 
 #if !defined(__AVR__)
 
@@ -40,6 +41,8 @@ void ascon_permute(ascon_state_t *state, uint8_t first_round)
     uint64_t x3 = state->S[3];
     uint64_t x4 = state->S[4];
 #endif
+    aead_count_call(AEAD_PRIMITIVE_ASCON_PERMUTE);
+    aead_count_calls(AEAD_PRIMITIVE_ASCON_ROUNDS, 12 - first_round);
     while (first_round < 12) {
         /* Add the round constant to the state */
         x2 ^= ((0x0F - first_round) << 4) | first_round;
@@ -78,3 +81,290 @@ void ascon_permute(ascon_state_t *state, uint8_t first_round)
 }
 
 #endif /* !__AVR__ */
+
+/**
+ * \brief Permutes several interleaved ASCON states one lane at a time.
+ *
+ * \param S Points to the interleaved state words; word i of lane j is
+ * at S[i * lanes + j].
+ * \param lanes Number of lanes in the interleaved state.
+ * \param first_round The first round (of 12) to be performed.
+ */
+static void ascon_permute_lanes
+    (uint64_t *S, unsigned lanes, uint8_t first_round)
+{
+    uint64_t t0, t1, t2, t3, t4;
+    uint64_t x0, x1, x2, x3, x4;
+    unsigned lane;
+    uint8_t round;
+    for (lane = 0; lane < lanes; ++lane) {
+        x0 = S[lane];
+        x1 = S[lanes + lane];
+        x2 = S[2 * lanes + lane];
+        x3 = S[3 * lanes + lane];
+        x4 = S[4 * lanes + lane];
+        for (round = first_round; round < 12; ++round) {
+            /* Same round function as ascon_permute() */
+            x2 ^= ((0x0F - round) << 4) | round;
+            x0 ^= x4;   x4 ^= x3;   x2 ^= x1;
+            t0 = ~x0;   t1 = ~x1;   t2 = ~x2;   t3 = ~x3;   t4 = ~x4;
+            t0 &= x1;   t1 &= x2;   t2 &= x3;   t3 &= x4;   t4 &= x0;
+            x0 ^= t1;   x1 ^= t2;   x2 ^= t3;   x3 ^= t4;   x4 ^= t0;
+            x1 ^= x0;   x0 ^= x4;   x3 ^= x2;   x2 = ~x2;
+            x0 ^= rightRotate19_64(x0) ^ rightRotate28_64(x0);
+            x1 ^= rightRotate61_64(x1) ^ rightRotate39_64(x1);
+            x2 ^= rightRotate1_64(x2)  ^ rightRotate6_64(x2);
+            x3 ^= rightRotate10_64(x3) ^ rightRotate17_64(x3);
+            x4 ^= rightRotate7_64(x4)  ^ rightRotate41_64(x4);
+        }
+        S[lane] = x0;
+        S[lanes + lane] = x1;
+        S[2 * lanes + lane] = x2;
+        S[3 * lanes + lane] = x3;
+        S[4 * lanes + lane] = x4;
+    }
+}
+
+/* Portable kernels for the multi-lane permutations */
+static void ascon_x4_permute_c(ascon_x4_state_t *state, uint8_t first_round)
+{
+    ascon_permute_lanes(state->S[0], 4, first_round);
+}
+
+static void ascon_x8_permute_c(ascon_x8_state_t *state, uint8_t first_round)
+{
+    ascon_permute_lanes(state->S[0], 8, first_round);
+}
+
+#if defined(LW_CPU_HAVE_AVX2)
+
+#include <immintrin.h>
+
+/* Rotate the 64-bit lanes of a vector right by a number of bits */
+#if defined(__AVX512VL__)
+#define ascon_ror_x4(x, bits) _mm256_ror_epi64((x), (bits))
+#else
+#define ascon_ror_x4(x, bits) \
+    (_mm256_or_si256(_mm256_srli_epi64((x), (bits)), \
+                     _mm256_slli_epi64((x), 64 - (bits))))
+#endif
+
+/* Perform a single ASCON round on four lanes held in AVX2 registers */
+#define ascon_round_x4(x0, x1, x2, x3, x4, round) \
+    do { \
+        __m256i t0, t1, t2, t3, t4; \
+        x2 = _mm256_xor_si256 \
+            (x2, _mm256_set1_epi64x(((0x0F - (round)) << 4) | (round))); \
+        x0 = _mm256_xor_si256(x0, x4); \
+        x4 = _mm256_xor_si256(x4, x3); \
+        x2 = _mm256_xor_si256(x2, x1); \
+        t0 = _mm256_andnot_si256(x0, x1); \
+        t1 = _mm256_andnot_si256(x1, x2); \
+        t2 = _mm256_andnot_si256(x2, x3); \
+        t3 = _mm256_andnot_si256(x3, x4); \
+        t4 = _mm256_andnot_si256(x4, x0); \
+        x0 = _mm256_xor_si256(x0, t1); \
+        x1 = _mm256_xor_si256(x1, t2); \
+        x2 = _mm256_xor_si256(x2, t3); \
+        x3 = _mm256_xor_si256(x3, t4); \
+        x4 = _mm256_xor_si256(x4, t0); \
+        x1 = _mm256_xor_si256(x1, x0); \
+        x0 = _mm256_xor_si256(x0, x4); \
+        x3 = _mm256_xor_si256(x3, x2); \
+        x2 = _mm256_xor_si256(x2, _mm256_set1_epi64x(-1)); \
+        x0 = _mm256_xor_si256 \
+            (x0, _mm256_xor_si256(ascon_ror_x4(x0, 19), \
+                                  ascon_ror_x4(x0, 28))); \
+        x1 = _mm256_xor_si256 \
+            (x1, _mm256_xor_si256(ascon_ror_x4(x1, 61), \
+                                  ascon_ror_x4(x1, 39))); \
+        x2 = _mm256_xor_si256 \
+            (x2, _mm256_xor_si256(ascon_ror_x4(x2, 1), \
+                                  ascon_ror_x4(x2, 6))); \
+        x3 = _mm256_xor_si256 \
+            (x3, _mm256_xor_si256(ascon_ror_x4(x3, 10), \
+                                  ascon_ror_x4(x3, 17))); \
+        x4 = _mm256_xor_si256 \
+            (x4, _mm256_xor_si256(ascon_ror_x4(x4, 7), \
+                                  ascon_ror_x4(x4, 41))); \
+    } while (0)
+
+/* Load or store four lanes of a state word from an interleaved state */
+#define ascon_load_x4(ptr) _mm256_loadu_si256((const __m256i *)(ptr))
+#define ascon_store_x4(ptr, x) _mm256_storeu_si256((__m256i *)(ptr), (x))
+
+LW_CPU_TARGET("avx2") static void ascon_x4_permute_avx2
+    (ascon_x4_state_t *state, uint8_t first_round)
+{
+    __m256i x0 = ascon_load_x4(state->S[0]);
+    __m256i x1 = ascon_load_x4(state->S[1]);
+    __m256i x2 = ascon_load_x4(state->S[2]);
+    __m256i x3 = ascon_load_x4(state->S[3]);
+    __m256i x4 = ascon_load_x4(state->S[4]);
+    for (; first_round < 12; ++first_round)
+        ascon_round_x4(x0, x1, x2, x3, x4, first_round);
+    ascon_store_x4(state->S[0], x0);
+    ascon_store_x4(state->S[1], x1);
+    ascon_store_x4(state->S[2], x2);
+    ascon_store_x4(state->S[3], x3);
+    ascon_store_x4(state->S[4], x4);
+}
+
+LW_CPU_TARGET("avx2") static void ascon_x8_permute_avx2
+    (ascon_x8_state_t *state, uint8_t first_round)
+{
+    /* Run two groups of four lanes side by side so that the rounds
+     * of one group can fill the pipeline stalls of the other */
+    __m256i x0 = ascon_load_x4(state->S[0]);
+    __m256i x1 = ascon_load_x4(state->S[1]);
+    __m256i x2 = ascon_load_x4(state->S[2]);
+    __m256i x3 = ascon_load_x4(state->S[3]);
+    __m256i x4 = ascon_load_x4(state->S[4]);
+    __m256i y0 = ascon_load_x4(state->S[0] + 4);
+    __m256i y1 = ascon_load_x4(state->S[1] + 4);
+    __m256i y2 = ascon_load_x4(state->S[2] + 4);
+    __m256i y3 = ascon_load_x4(state->S[3] + 4);
+    __m256i y4 = ascon_load_x4(state->S[4] + 4);
+    for (; first_round < 12; ++first_round) {
+        ascon_round_x4(x0, x1, x2, x3, x4, first_round);
+        ascon_round_x4(y0, y1, y2, y3, y4, first_round);
+    }
+    ascon_store_x4(state->S[0], x0);
+    ascon_store_x4(state->S[1], x1);
+    ascon_store_x4(state->S[2], x2);
+    ascon_store_x4(state->S[3], x3);
+    ascon_store_x4(state->S[4], x4);
+    ascon_store_x4(state->S[0] + 4, y0);
+    ascon_store_x4(state->S[1] + 4, y1);
+    ascon_store_x4(state->S[2] + 4, y2);
+    ascon_store_x4(state->S[3] + 4, y3);
+    ascon_store_x4(state->S[4] + 4, y4);
+}
+
+#endif /* LW_CPU_HAVE_AVX2 */
+
+#if defined(LW_CPU_HAVE_AVX512F)
+
+
+/* Perform a single ASCON round on eight lanes held in AVX-512 registers */
+#define ascon_round_x8(x0, x1, x2, x3, x4, round) \
+    do { \
+        __m512i t0, t1, t2, t3, t4; \
+        x2 = _mm512_xor_si512 \
+            (x2, _mm512_set1_epi64(((0x0F - (round)) << 4) | (round))); \
+        x0 = _mm512_xor_si512(x0, x4); \
+        x4 = _mm512_xor_si512(x4, x3); \
+        x2 = _mm512_xor_si512(x2, x1); \
+        t0 = _mm512_andnot_si512(x0, x1); \
+        t1 = _mm512_andnot_si512(x1, x2); \
+        t2 = _mm512_andnot_si512(x2, x3); \
+        t3 = _mm512_andnot_si512(x3, x4); \
+        t4 = _mm512_andnot_si512(x4, x0); \
+        x0 = _mm512_xor_si512(x0, t1); \
+        x1 = _mm512_xor_si512(x1, t2); \
+        x2 = _mm512_xor_si512(x2, t3); \
+        x3 = _mm512_xor_si512(x3, t4); \
+        x4 = _mm512_xor_si512(x4, t0); \
+        x1 = _mm512_xor_si512(x1, x0); \
+        x0 = _mm512_xor_si512(x0, x4); \
+        x3 = _mm512_xor_si512(x3, x2); \
+        x2 = _mm512_xor_si512(x2, _mm512_set1_epi64(-1)); \
+        x0 = _mm512_xor_si512 \
+            (x0, _mm512_xor_si512(_mm512_ror_epi64(x0, 19), \
+                                  _mm512_ror_epi64(x0, 28))); \
+        x1 = _mm512_xor_si512 \
+            (x1, _mm512_xor_si512(_mm512_ror_epi64(x1, 61), \
+                                  _mm512_ror_epi64(x1, 39))); \
+        x2 = _mm512_xor_si512 \
+            (x2, _mm512_xor_si512(_mm512_ror_epi64(x2, 1), \
+                                  _mm512_ror_epi64(x2, 6))); \
+        x3 = _mm512_xor_si512 \
+            (x3, _mm512_xor_si512(_mm512_ror_epi64(x3, 10), \
+                                  _mm512_ror_epi64(x3, 17))); \
+        x4 = _mm512_xor_si512 \
+            (x4, _mm512_xor_si512(_mm512_ror_epi64(x4, 7), \
+                                  _mm512_ror_epi64(x4, 41))); \
+    } while (0)
+
+LW_CPU_TARGET("avx512f") static void ascon_x8_permute_avx512
+    (ascon_x8_state_t *state, uint8_t first_round)
+{
+    __m512i x0 = _mm512_loadu_si512(state->S[0]);
+    __m512i x1 = _mm512_loadu_si512(state->S[1]);
+    __m512i x2 = _mm512_loadu_si512(state->S[2]);
+    __m512i x3 = _mm512_loadu_si512(state->S[3]);
+    __m512i x4 = _mm512_loadu_si512(state->S[4]);
+    for (; first_round < 12; ++first_round)
+        ascon_round_x8(x0, x1, x2, x3, x4, first_round);
+    _mm512_storeu_si512(state->S[0], x0);
+    _mm512_storeu_si512(state->S[1], x1);
+    _mm512_storeu_si512(state->S[2], x2);
+    _mm512_storeu_si512(state->S[3], x3);
+    _mm512_storeu_si512(state->S[4], x4);
+}
+
+#endif /* LW_CPU_HAVE_AVX512F */
+
+/**
+ * \brief Kernel that has been bound to ascon_x4_permute() for this CPU.
+ */
+static void (*ascon_x4_permute_fn)
+    (ascon_x4_state_t *state, uint8_t first_round) = 0;
+
+/**
+ * \brief Kernel that has been bound to ascon_x8_permute() for this CPU.
+ */
+static void (*ascon_x8_permute_fn)
+    (ascon_x8_state_t *state, uint8_t first_round) = 0;
+
+/**
+ * \brief Binds the multi-lane ASCON permutations to the best kernels
+ * for the features of this CPU.
+ */
+static void ascon_lanes_bind(void)
+{
+    unsigned features = lw_cpu_features();
+    void (*x4)(ascon_x4_state_t *state, uint8_t first_round);
+    void (*x8)(ascon_x8_state_t *state, uint8_t first_round);
+    x4 = ascon_x4_permute_c;
+    x8 = ascon_x8_permute_c;
+#if defined(LW_CPU_HAVE_AVX2)
+    if (features & LW_CPU_AVX2) {
+        x4 = ascon_x4_permute_avx2;
+        x8 = ascon_x8_permute_avx2;
+    }
+#endif
+#if defined(LW_CPU_HAVE_AVX512F)
+    if (features & LW_CPU_AVX512F)
+        x8 = ascon_x8_permute_avx512;
+#endif
+    (void)features;
+    LW_CPU_STORE(ascon_x4_permute_fn, x4);
+    LW_CPU_STORE(ascon_x8_permute_fn, x8);
+}
+
+void ascon_x4_permute(ascon_x4_state_t *state, uint8_t first_round)
+{
+    void (*fn)(ascon_x4_state_t *state, uint8_t first_round) =
+        LW_CPU_LOAD(ascon_x4_permute_fn);
+    aead_count_calls(AEAD_PRIMITIVE_ASCON_PERMUTE, 4);
+    aead_count_calls(AEAD_PRIMITIVE_ASCON_ROUNDS, 4 * (12 - first_round));
+    if (!fn) {
+        ascon_lanes_bind();
+        fn = LW_CPU_LOAD(ascon_x4_permute_fn);
+    }
+    (*fn)(state, first_round);
+}
+
+void ascon_x8_permute(ascon_x8_state_t *state, uint8_t first_round)
+{
+    void (*fn)(ascon_x8_state_t *state, uint8_t first_round) =
+        LW_CPU_LOAD(ascon_x8_permute_fn);
+    aead_count_calls(AEAD_PRIMITIVE_ASCON_PERMUTE, 8);
+    aead_count_calls(AEAD_PRIMITIVE_ASCON_ROUNDS, 8 * (12 - first_round));
+    if (!fn) {
+        ascon_lanes_bind();
+        fn = LW_CPU_LOAD(ascon_x8_permute_fn);
+    }
+    (*fn)(state, first_round);
+}
@@ -57,6 +57,52 @@ typedef union
  */
 void ascon_permute(ascon_state_t *state, uint8_t first_round);
 
+/**
+ * \brief Four ASCON states that are interleaved for parallel permutation.
+ *
+ * Word i of lane j is stored in S[i][j] in host byte order.  Its value is
+ * the big-endian interpretation of bytes 8 * i to 8 * i + 7 of the
+ * equivalent ascon_state_t.
+ */
+typedef struct
+{
+    uint64_t S[5][4];   /**< Words of the states, grouped by word index */
+
+} ascon_x4_state_t;
+
+/**
+ * \brief Eight ASCON states that are interleaved for parallel permutation.
+ *
+ * The layout is the same as ascon_x4_state_t but with eight lanes.
+ */
+typedef struct
+{
+    uint64_t S[5][8];   /**< Words of the states, grouped by word index */
+
+} ascon_x8_state_t;
+
+/**
+ * \brief Permutes four ASCON states in parallel.
+ *
+ * \param state The interleaved ASCON states to be permuted.
+ * \param first_round The first round (of 12) to be performed; 0, 4, or 6.
+ *
+ * Uses AVX2 instructions if the CPU supports them, or a portable loop
+ * over the lanes otherwise.
+ */
+void ascon_x4_permute(ascon_x4_state_t *state, uint8_t first_round);
+
+/**
+ * \brief Permutes eight ASCON states in parallel.
+ *
+ * \param state The interleaved ASCON states to be permuted.
+ * \param first_round The first round (of 12) to be performed; 0, 4, or 6.
+ *
+ * Uses AVX-512 instructions if available, or two interleaved groups of
+ * AVX2 registers, or a portable loop over the lanes otherwise.
+ */
+void ascon_x8_permute(ascon_x8_state_t *state, uint8_t first_round);
+
 #ifdef __cplusplus
 }
 #endif
@@ -31,7 +31,18 @@ aead_cipher_t const internal_chachapoly_cipher = {
     CHACHAPOLY_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     internal_chachapoly_aead_encrypt,
-    internal_chachapoly_aead_decrypt
+    internal_chachapoly_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    0, /* encrypt_vec */
+    0, /* decrypt_vec */
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -33,6 +33,8 @@ void cham128_128_encrypt
     uint32_t k[8];
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_CHAM128_ENCRYPT);
+
     /* Unpack the key and generate the key schedule */
     k[0] = le_load_word32(key);
     k[1] = le_load_word32(key + 4);
@@ -80,6 +82,8 @@ void cham64_128_encrypt
     uint16_t k[16];
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_CHAM64_ENCRYPT);
+
     /* Unpack the key and generate the key schedule */
     k[0]  = le_load_word16(key);
     k[1]  = le_load_word16(key + 2);
@@ -29,6 +29,9 @@
  * FORKAE_COUNTER_SIZE    Size of the counter value for the cipher in bytes.
  * FORKAE_TWEAKEY_SIZE    Size of the tweakey for the underlying forked cipher.
  * FORKAE_BLOCK_FUNC      Name of the block function; e.g. forkskinny_128_256
+ * FORKAE_PARALLEL_BLOCKS Number of blocks to process at once with the
+ *                        multi-block versions of the block function, or
+ *                        undefined to process the blocks one at a time.
  */
 #if defined(FORKAE_ALG_NAME)
 
@@ -66,10 +69,104 @@ STATIC_INLINE int FORKAE_CONCAT(FORKAE_ALG_NAME,_is_padding)
     return (check - 1) >> 8;
 }
 
-int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+#if defined(FORKAE_PARALLEL_BLOCKS)
+
+/* Number of blocks to process at once, leaving the last block of
+ * the data for the caller because it uses a different domain */
+STATIC_INLINE unsigned FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel_count)
+    (unsigned long long len)
+{
+    unsigned long long count = (len - 1) / FORKAE_BLOCK_SIZE;
+    if (count > FORKAE_PARALLEL_BLOCKS)
+        count = FORKAE_PARALLEL_BLOCKS;
+    return (unsigned)count;
+}
+
+/* Encrypts or decrypts a run of blocks with consecutive counter values,
+ * XOR'ing the right output of each block into the tag */
+static void FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel)
+    (const unsigned char tweakey[FORKAE_TWEAKEY_SIZE],
+     unsigned long long counter, unsigned char domain,
+     unsigned char tag[FORKAE_BLOCK_SIZE], unsigned char *output,
+     const unsigned char *input, unsigned count, int decrypt)
+{
+    unsigned char tweakeys[FORKAE_PARALLEL_BLOCKS][FORKAE_TWEAKEY_SIZE];
+    unsigned char blocks[FORKAE_PARALLEL_BLOCKS][FORKAE_BLOCK_SIZE];
+    unsigned index;
+    for (index = 0; index < count; ++index) {
+        memcpy(tweakeys[index], tweakey, FORKAE_TWEAKEY_SIZE);
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)
+            (tweakeys[index], counter + index, domain);
+    }
+    if (decrypt) {
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt_blocks)
+            (tweakeys[0], output, blocks[0], input, count);
+    } else {
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt_blocks)
+            (tweakeys[0], output, blocks[0], input, count);
+    }
+    for (index = 0; index < count; ++index)
+        lw_xor_block(tag, blocks[index], FORKAE_BLOCK_SIZE);
+}
+
+#endif /* FORKAE_PARALLEL_BLOCKS */
+
+/* Processes the associated data in PAEF mode */
+static void FORKAE_CONCAT(FORKAE_ALG_NAME,_process_ad)
+    (unsigned char tweakey[FORKAE_TWEAKEY_SIZE],
+     unsigned char tag[FORKAE_BLOCK_SIZE],
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     unsigned long long mlen)
+{
+    unsigned char block[FORKAE_BLOCK_SIZE];
+    unsigned char buf[FORKAE_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned long long counter = 1;
+    while (adlen > FORKAE_BLOCK_SIZE) {
+#if defined(FORKAE_PARALLEL_BLOCKS)
+        unsigned count = FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel_count)(adlen);
+        count = (unsigned)aead_iovec_blocks
+            (ad, 0, adlen, FORKAE_BLOCK_SIZE, count);
+        if (count > 0) {
+            in = aead_iovec_ptr(ad);
+            aead_iovec_advance(ad, count * FORKAE_BLOCK_SIZE);
+        } else {
+            count = 1;
+            in = aead_iovec_load_block(ad, buf, FORKAE_BLOCK_SIZE);
+        }
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel)
+            (tweakey, counter, 0, tag, 0, in, count, 0);
+        adlen -= count * FORKAE_BLOCK_SIZE;
+        counter += count;
+#else
+        in = aead_iovec_load_block(ad, buf, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 0);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, in);
+        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
+        adlen -= FORKAE_BLOCK_SIZE;
+        ++counter;
+#endif
+    }
+    if (adlen == FORKAE_BLOCK_SIZE) {
+        in = aead_iovec_load_block(ad, buf, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 1);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, in);
+        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
+    } else if (adlen != 0 || mlen == 0) {
+        unsigned temp = (unsigned)adlen;
+        aead_iovec_read(ad, block, temp);
+        block[temp] = 0x80;
+        memset(block + temp + 1, 0, sizeof(block) - temp - 1);
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 3);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, block);
+        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
+    }
+}
+
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt_vec)
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -77,11 +174,23 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
     unsigned char tweakey[FORKAE_TWEAKEY_SIZE];
     unsigned char tag[FORKAE_BLOCK_SIZE];
     unsigned char block[FORKAE_BLOCK_SIZE];
+    unsigned char inbuf[FORKAE_BLOCK_SIZE];
+    unsigned char outbuf[FORKAE_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned long long counter;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + FORKAE_BLOCK_SIZE))
+        return -2;
     *clen = mlen + FORKAE_BLOCK_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Validate the size of the associated data and plaintext as there
      * is a limit on the size of the PAEF counter field */
@@ -99,79 +208,91 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
     memset(tag, 0, sizeof(tag));
 
     /* Process the associated data */
-    counter = 1;
-    while (adlen > FORKAE_BLOCK_SIZE) {
-        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 0);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, ad);
-        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-        ad += FORKAE_BLOCK_SIZE;
-        adlen -= FORKAE_BLOCK_SIZE;
-        ++counter;
-    }
-    if (adlen == FORKAE_BLOCK_SIZE) {
-        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 1);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, ad);
-        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-    } else if (adlen != 0 || mlen == 0) {
-        unsigned temp = (unsigned)adlen;
-        memcpy(block, ad, temp);
-        block[temp] = 0x80;
-        memset(block + temp + 1, 0, sizeof(block) - temp - 1);
-        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 3);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, block);
-        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-    }
+    FORKAE_CONCAT(FORKAE_ALG_NAME,_process_ad)
+        (tweakey, tag, &adcur, adlen, mlen);
 
     /* If there is no message payload, then generate the tag and we are done */
     if (!mlen) {
-        memcpy(c, tag, sizeof(tag));
+        aead_iovec_write(&ccur, tag, sizeof(tag));
         return 0;
     }
 
     /* Encrypt all plaintext blocks except the last */
     counter = 1;
     while (mlen > FORKAE_BLOCK_SIZE) {
+#if defined(FORKAE_PARALLEL_BLOCKS)
+        unsigned count = FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel_count)(mlen);
+        count = (unsigned)aead_iovec_blocks
+            (&mcur, &ccur, mlen, FORKAE_BLOCK_SIZE, count);
+        if (count > 0) {
+            in = aead_iovec_ptr(&mcur);
+            out = aead_iovec_ptr(&ccur);
+            aead_iovec_advance(&mcur, count * FORKAE_BLOCK_SIZE);
+        } else {
+            count = 1;
+            in = aead_iovec_load_block(&mcur, inbuf, FORKAE_BLOCK_SIZE);
+            out = aead_iovec_store_begin(&ccur, outbuf, FORKAE_BLOCK_SIZE);
+        }
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel)
+            (tweakey, counter, 4, tag, out, in, count, 0);
+        aead_iovec_store_end(&ccur, outbuf, out, count * FORKAE_BLOCK_SIZE);
+        mlen -= count * FORKAE_BLOCK_SIZE;
+        counter += count;
+#else
+        in = aead_iovec_load_block(&mcur, inbuf, FORKAE_BLOCK_SIZE);
+        out = aead_iovec_store_begin(&ccur, outbuf, FORKAE_BLOCK_SIZE);
         FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 4);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, c, block, m);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, out, block, in);
+        aead_iovec_store_end(&ccur, outbuf, out, FORKAE_BLOCK_SIZE);
         lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-        c += FORKAE_BLOCK_SIZE;
-        m += FORKAE_BLOCK_SIZE;
         mlen -= FORKAE_BLOCK_SIZE;
         ++counter;
+#endif
     }
 
     /* Encrypt the last block and generate the final authentication tag */
+    out = aead_iovec_store_begin(&ccur, outbuf, FORKAE_BLOCK_SIZE);
     if (mlen == FORKAE_BLOCK_SIZE) {
+        in = aead_iovec_load_block(&mcur, inbuf, FORKAE_BLOCK_SIZE);
         FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 5);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, c, block, m);
-        lw_xor_block(c, tag, FORKAE_BLOCK_SIZE);
-        memcpy(c + FORKAE_BLOCK_SIZE, block, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, out, block, in);
+        lw_xor_block(out, tag, FORKAE_BLOCK_SIZE);
+        aead_iovec_store_end(&ccur, outbuf, out, FORKAE_BLOCK_SIZE);
+        aead_iovec_write(&ccur, block, FORKAE_BLOCK_SIZE);
     } else {
         unsigned temp = (unsigned)mlen;
-        memcpy(block, m, temp);
+        aead_iovec_read(&mcur, block, temp);
         block[temp] = 0x80;
         memset(block + temp + 1, 0, sizeof(block) - temp - 1);
         FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 7);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, c, block, block);
-        lw_xor_block(c, tag, FORKAE_BLOCK_SIZE);
-        memcpy(c + FORKAE_BLOCK_SIZE, block, temp);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, out, block, block);
+        lw_xor_block(out, tag, FORKAE_BLOCK_SIZE);
+        aead_iovec_store_end(&ccur, outbuf, out, FORKAE_BLOCK_SIZE);
+        aead_iovec_write(&ccur, block, temp);
     }
     return 0;
 }
 
-int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
-    (unsigned char *m, unsigned long long *mlen,
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt_vec)
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char tweakey[FORKAE_TWEAKEY_SIZE];
     unsigned char tag[FORKAE_BLOCK_SIZE];
     unsigned char block[FORKAE_BLOCK_SIZE];
-    unsigned char *mtemp = m;
+    unsigned char received[FORKAE_BLOCK_SIZE];
+    unsigned char inbuf[FORKAE_BLOCK_SIZE];
+    unsigned char outbuf[FORKAE_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned long long counter;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
@@ -179,6 +300,11 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
         return -1;
     clen -= FORKAE_BLOCK_SIZE;
     *mlen = clen;
+    if (aead_iovec_length(m, m_count) < clen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Validate the size of the associated data and plaintext as there
      * is a limit on the size of the PAEF counter field */
@@ -196,68 +322,109 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
     memset(tag, 0, sizeof(tag));
 
     /* Process the associated data */
-    counter = 1;
-    while (adlen > FORKAE_BLOCK_SIZE) {
-        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 0);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, ad);
-        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-        ad += FORKAE_BLOCK_SIZE;
-        adlen -= FORKAE_BLOCK_SIZE;
-        ++counter;
-    }
-    if (adlen == FORKAE_BLOCK_SIZE) {
-        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 1);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, ad);
-        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-    } else if (adlen != 0 || clen == 0) {
-        unsigned temp = (unsigned)adlen;
-        memcpy(block, ad, temp);
-        block[temp] = 0x80;
-        memset(block + temp + 1, 0, sizeof(block) - temp - 1);
-        FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 3);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, block, block);
-        lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-    }
+    FORKAE_CONCAT(FORKAE_ALG_NAME,_process_ad)
+        (tweakey, tag, &adcur, adlen, clen);
 
     /* If there is no message payload, then check the tag and we are done */
-    if (!clen)
-        return aead_check_tag(m, clen, tag, c, sizeof(tag));
+    if (!clen) {
+        aead_iovec_read(&ccur, received, sizeof(tag));
+        return aead_check_tag_vec(m, m_count, 0, tag, received, sizeof(tag));
+    }
 
     /* Decrypt all ciphertext blocks except the last */
     counter = 1;
     while (clen > FORKAE_BLOCK_SIZE) {
+#if defined(FORKAE_PARALLEL_BLOCKS)
+        unsigned count = FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel_count)(clen);
+        count = (unsigned)aead_iovec_blocks
+            (&ccur, &mcur, clen, FORKAE_BLOCK_SIZE, count);
+        if (count > 0) {
+            in = aead_iovec_ptr(&ccur);
+            out = aead_iovec_ptr(&mcur);
+            aead_iovec_advance(&ccur, count * FORKAE_BLOCK_SIZE);
+        } else {
+            count = 1;
+            in = aead_iovec_load_block(&ccur, inbuf, FORKAE_BLOCK_SIZE);
+            out = aead_iovec_store_begin(&mcur, outbuf, FORKAE_BLOCK_SIZE);
+        }
+        FORKAE_CONCAT(FORKAE_ALG_NAME,_parallel)
+            (tweakey, counter, 4, tag, out, in, count, 1);
+        aead_iovec_store_end(&mcur, outbuf, out, count * FORKAE_BLOCK_SIZE);
+        clen -= count * FORKAE_BLOCK_SIZE;
+        counter += count;
+#else
+        in = aead_iovec_load_block(&ccur, inbuf, FORKAE_BLOCK_SIZE);
+        out = aead_iovec_store_begin(&mcur, outbuf, FORKAE_BLOCK_SIZE);
         FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 4);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, m, block, c);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, out, block, in);
+        aead_iovec_store_end(&mcur, outbuf, out, FORKAE_BLOCK_SIZE);
         lw_xor_block(tag, block, FORKAE_BLOCK_SIZE);
-        c += FORKAE_BLOCK_SIZE;
-        m += FORKAE_BLOCK_SIZE;
         clen -= FORKAE_BLOCK_SIZE;
         ++counter;
+#endif
     }
 
     /* Decrypt the last block and check the final authentication tag */
+    in = aead_iovec_load_block(&ccur, inbuf, FORKAE_BLOCK_SIZE);
     if (clen == FORKAE_BLOCK_SIZE) {
+        out = aead_iovec_store_begin(&mcur, outbuf, FORKAE_BLOCK_SIZE);
         FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 5);
-        lw_xor_block_2_src(m, c, tag, FORKAE_BLOCK_SIZE);
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, m, block, m);
-        return aead_check_tag
-            (mtemp, *mlen, block, c + FORKAE_BLOCK_SIZE, sizeof(tag));
+        lw_xor_block_2_src(out, in, tag, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, out, block, out);
+        aead_iovec_store_end(&mcur, outbuf, out, FORKAE_BLOCK_SIZE);
+        aead_iovec_read(&ccur, received, sizeof(tag));
+        return aead_check_tag_vec
+            (m, m_count, *mlen, block, received, sizeof(tag));
     } else {
         unsigned temp = (unsigned)clen;
         unsigned char block2[FORKAE_BLOCK_SIZE];
         int check;
         FORKAE_CONCAT(FORKAE_ALG_NAME,_set_counter)(tweakey, counter, 7);
-        lw_xor_block_2_src(block2, tag, c, FORKAE_BLOCK_SIZE);
+        lw_xor_block_2_src(block2, tag, in, FORKAE_BLOCK_SIZE);
         FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)
             (tweakey, block2, block, block2);
         check = FORKAE_CONCAT(FORKAE_ALG_NAME,_is_padding)
             (block2 + temp, FORKAE_BLOCK_SIZE - temp);
-        memcpy(m, block2, temp);
-        return aead_check_tag_precheck
-            (mtemp, *mlen, block, c + FORKAE_BLOCK_SIZE, temp, check);
+        aead_iovec_write(&mcur, block2, temp);
+        aead_iovec_read(&ccur, received, temp);
+        return aead_check_tag_precheck_vec
+            (m, m_count, *mlen, block, received, temp, check);
     }
 }
 
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + FORKAE_BLOCK_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt_vec)
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= FORKAE_BLOCK_SIZE ?
+                   clen - FORKAE_BLOCK_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt_vec)
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
 #endif /* FORKAE_ALG_NAME */
 
 /* Now undefine everything so that we can include this file again for
@@ -268,6 +435,7 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
 #undef FORKAE_COUNTER_SIZE
 #undef FORKAE_TWEAKEY_SIZE
 #undef FORKAE_BLOCK_FUNC
+#undef FORKAE_PARALLEL_BLOCKS
 #undef FORKAE_CONCAT_INNER
 #undef FORKAE_CONCAT
 #undef FORKAE_PAEF_DATA_LIMIT
@@ -47,10 +47,10 @@ STATIC_INLINE int FORKAE_CONCAT(FORKAE_ALG_NAME,_is_padding)
     return (check - 1) >> 8;
 }
 
-int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt_vec)
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -58,10 +58,22 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
     unsigned char tweakey[FORKAE_TWEAKEY_SIZE];
     unsigned char tag[FORKAE_BLOCK_SIZE];
     unsigned char block[FORKAE_BLOCK_SIZE];
+    unsigned char inbuf[FORKAE_BLOCK_SIZE];
+    unsigned char outbuf[FORKAE_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + FORKAE_BLOCK_SIZE))
+        return -2;
     *clen = mlen + FORKAE_BLOCK_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Format the initial tweakey with the key and nonce */
     memcpy(tweakey, k, 16);
@@ -76,22 +88,24 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
     /* Process the associated data */
     if (adlen > 0 || mlen == 0) {
         while (adlen > FORKAE_BLOCK_SIZE) {
-            lw_xor_block(tag, ad, FORKAE_BLOCK_SIZE);
+            in = aead_iovec_load_block(&adcur, inbuf, FORKAE_BLOCK_SIZE);
+            lw_xor_block(tag, in, FORKAE_BLOCK_SIZE);
             FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, tag, tag);
             memset(tweakey + 16, 0, FORKAE_TWEAKEY_SIZE - 16);
-            ad += FORKAE_BLOCK_SIZE;
             adlen -= FORKAE_BLOCK_SIZE;
         }
         if (mlen == 0)
             tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x04;
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x02;
         if (adlen == FORKAE_BLOCK_SIZE) {
-            lw_xor_block(tag, ad, FORKAE_BLOCK_SIZE);
+            in = aead_iovec_load_block(&adcur, inbuf, FORKAE_BLOCK_SIZE);
+            lw_xor_block(tag, in, FORKAE_BLOCK_SIZE);
             FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, tag, tag);
             memset(tweakey + 16, 0, FORKAE_TWEAKEY_SIZE - 16);
         } else if (adlen != 0 || mlen == 0) {
             unsigned temp = (unsigned)adlen;
-            lw_xor_block(tag, ad, temp);
+            in = aead_iovec_load_block(&adcur, inbuf, temp);
+            lw_xor_block(tag, in, temp);
             tag[temp] ^= 0x80;
             tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x01;
             FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, tag, tag);
@@ -101,55 +115,64 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
 
     /* If there is no message payload, then generate the tag and we are done */
     if (!mlen) {
-        memcpy(c, tag, sizeof(tag));
+        aead_iovec_write(&ccur, tag, sizeof(tag));
         return 0;
     }
 
     /* Encrypt all plaintext blocks except the last */
     while (mlen > FORKAE_BLOCK_SIZE) {
-        lw_xor_block_2_src(block, m, tag, FORKAE_BLOCK_SIZE);
+        in = aead_iovec_load_block(&mcur, inbuf, FORKAE_BLOCK_SIZE);
+        out = aead_iovec_store_begin(&ccur, outbuf, FORKAE_BLOCK_SIZE);
+        lw_xor_block_2_src(block, in, tag, FORKAE_BLOCK_SIZE);
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x01;
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, c, block, block);
-        lw_xor_block(c, tag, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, out, block, block);
+        lw_xor_block(out, tag, FORKAE_BLOCK_SIZE);
+        aead_iovec_store_end(&ccur, outbuf, out, FORKAE_BLOCK_SIZE);
         memcpy(tag, block, FORKAE_BLOCK_SIZE);
         memset(tweakey + 16, 0, FORKAE_TWEAKEY_SIZE - 16);
-        c += FORKAE_BLOCK_SIZE;
-        m += FORKAE_BLOCK_SIZE;
         mlen -= FORKAE_BLOCK_SIZE;
     }
 
     /* Encrypt the last block and generate the final authentication tag */
     if (mlen == FORKAE_BLOCK_SIZE) {
-        lw_xor_block_2_src(block, m, tag, FORKAE_BLOCK_SIZE);
+        in = aead_iovec_load_block(&mcur, inbuf, FORKAE_BLOCK_SIZE);
+        lw_xor_block_2_src(block, in, tag, FORKAE_BLOCK_SIZE);
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x04;
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, c, block, block);
-        lw_xor_block(c, tag, FORKAE_BLOCK_SIZE);
-        memcpy(c + FORKAE_BLOCK_SIZE, block, FORKAE_BLOCK_SIZE);
     } else {
         unsigned temp = (unsigned)mlen;
+        in = aead_iovec_load_block(&mcur, inbuf, temp);
         memcpy(block, tag, FORKAE_BLOCK_SIZE);
-        lw_xor_block(block, m, temp);
+        lw_xor_block(block, in, temp);
         block[temp] ^= 0x80;
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x05;
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, c, block, block);
-        lw_xor_block(c, tag, FORKAE_BLOCK_SIZE);
-        memcpy(c + FORKAE_BLOCK_SIZE, block, temp);
     }
+    out = aead_iovec_store_begin(&ccur, outbuf, FORKAE_BLOCK_SIZE);
+    FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, out, block, block);
+    lw_xor_block(out, tag, FORKAE_BLOCK_SIZE);
+    aead_iovec_store_end(&ccur, outbuf, out, FORKAE_BLOCK_SIZE);
+    aead_iovec_write(&ccur, block, (size_t)mlen);
     return 0;
 }
 
-int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
-    (unsigned char *m, unsigned long long *mlen,
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt_vec)
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char tweakey[FORKAE_TWEAKEY_SIZE];
     unsigned char tag[FORKAE_BLOCK_SIZE];
     unsigned char block[FORKAE_BLOCK_SIZE];
-    unsigned char *mtemp = m;
+    unsigned char received[FORKAE_BLOCK_SIZE];
+    unsigned char inbuf[FORKAE_BLOCK_SIZE];
+    unsigned char outbuf[FORKAE_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
@@ -157,6 +180,11 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
         return -1;
     clen -= FORKAE_BLOCK_SIZE;
     *mlen = clen;
+    if (aead_iovec_length(m, m_count) < clen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Format the initial tweakey with the key and nonce */
     memcpy(tweakey, k, 16);
@@ -171,22 +199,24 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
     /* Process the associated data */
     if (adlen > 0 || clen == 0) {
         while (adlen > FORKAE_BLOCK_SIZE) {
-            lw_xor_block(tag, ad, FORKAE_BLOCK_SIZE);
+            in = aead_iovec_load_block(&adcur, inbuf, FORKAE_BLOCK_SIZE);
+            lw_xor_block(tag, in, FORKAE_BLOCK_SIZE);
             FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, tag, tag);
             memset(tweakey + 16, 0, FORKAE_TWEAKEY_SIZE - 16);
-            ad += FORKAE_BLOCK_SIZE;
             adlen -= FORKAE_BLOCK_SIZE;
         }
         if (clen == 0)
             tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x04;
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x02;
         if (adlen == FORKAE_BLOCK_SIZE) {
-            lw_xor_block(tag, ad, FORKAE_BLOCK_SIZE);
+            in = aead_iovec_load_block(&adcur, inbuf, FORKAE_BLOCK_SIZE);
+            lw_xor_block(tag, in, FORKAE_BLOCK_SIZE);
             FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, tag, tag);
             memset(tweakey + 16, 0, FORKAE_TWEAKEY_SIZE - 16);
         } else if (adlen != 0 || clen == 0) {
             unsigned temp = (unsigned)adlen;
-            lw_xor_block(tag, ad, temp);
+            in = aead_iovec_load_block(&adcur, inbuf, temp);
+            lw_xor_block(tag, in, temp);
             tag[temp] ^= 0x80;
             tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x01;
             FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_encrypt)(tweakey, 0, tag, tag);
@@ -195,47 +225,88 @@ int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
     }
 
     /* If there is no message payload, then check the tag and we are done */
-    if (!clen)
-        return aead_check_tag(m, clen, tag, c, sizeof(tag));
+    if (!clen) {
+        aead_iovec_read(&ccur, received, sizeof(tag));
+        return aead_check_tag_vec(m, m_count, 0, tag, received, sizeof(tag));
+    }
 
     /* Decrypt all ciphertext blocks except the last */
     while (clen > FORKAE_BLOCK_SIZE) {
-        lw_xor_block_2_src(block, c, tag, FORKAE_BLOCK_SIZE);
+        in = aead_iovec_load_block(&ccur, inbuf, FORKAE_BLOCK_SIZE);
+        out = aead_iovec_store_begin(&mcur, outbuf, FORKAE_BLOCK_SIZE);
+        lw_xor_block_2_src(block, in, tag, FORKAE_BLOCK_SIZE);
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x01;
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, m, block, block);
-        lw_xor_block(m, tag, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, out, block, block);
+        lw_xor_block(out, tag, FORKAE_BLOCK_SIZE);
+        aead_iovec_store_end(&mcur, outbuf, out, FORKAE_BLOCK_SIZE);
         memcpy(tag, block, FORKAE_BLOCK_SIZE);
         memset(tweakey + 16, 0, FORKAE_TWEAKEY_SIZE - 16);
-        c += FORKAE_BLOCK_SIZE;
-        m += FORKAE_BLOCK_SIZE;
         clen -= FORKAE_BLOCK_SIZE;
     }
 
     /* Decrypt the last block and check the final authentication tag */
+    in = aead_iovec_load_block(&ccur, inbuf, FORKAE_BLOCK_SIZE);
     if (clen == FORKAE_BLOCK_SIZE) {
-        lw_xor_block_2_src(block, c, tag, FORKAE_BLOCK_SIZE);
+        out = aead_iovec_store_begin(&mcur, outbuf, FORKAE_BLOCK_SIZE);
+        lw_xor_block_2_src(block, in, tag, FORKAE_BLOCK_SIZE);
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x04;
-        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, m, block, block);
-        lw_xor_block(m, tag, FORKAE_BLOCK_SIZE);
-        return aead_check_tag
-            (mtemp, *mlen, block, c + FORKAE_BLOCK_SIZE, FORKAE_BLOCK_SIZE);
+        FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)(tweakey, out, block, block);
+        lw_xor_block(out, tag, FORKAE_BLOCK_SIZE);
+        aead_iovec_store_end(&mcur, outbuf, out, FORKAE_BLOCK_SIZE);
+        aead_iovec_read(&ccur, received, FORKAE_BLOCK_SIZE);
+        return aead_check_tag_vec
+            (m, m_count, *mlen, block, received, FORKAE_BLOCK_SIZE);
     } else {
         unsigned temp = (unsigned)clen;
         unsigned char mblock[FORKAE_BLOCK_SIZE];
         int check;
-        lw_xor_block_2_src(block, c, tag, FORKAE_BLOCK_SIZE);
+        lw_xor_block_2_src(block, in, tag, FORKAE_BLOCK_SIZE);
         tweakey[FORKAE_TWEAKEY_REDUCED_SIZE - 1] ^= 0x05;
         FORKAE_CONCAT(FORKAE_BLOCK_FUNC,_decrypt)
             (tweakey, mblock, block, block);
         lw_xor_block(mblock, tag, FORKAE_BLOCK_SIZE);
-        memcpy(m, mblock, temp);
+        aead_iovec_write(&mcur, mblock, temp);
         check = FORKAE_CONCAT(FORKAE_ALG_NAME,_is_padding)
             (mblock + temp, FORKAE_BLOCK_SIZE - temp);
-        return aead_check_tag_precheck
-            (mtemp, *mlen, block, c + FORKAE_BLOCK_SIZE, temp, check);
+        aead_iovec_read(&ccur, received, temp);
+        return aead_check_tag_precheck_vec
+            (m, m_count, *mlen, block, received, temp, check);
     }
 }
 
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt)
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + FORKAE_BLOCK_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_encrypt_vec)
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt)
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= FORKAE_BLOCK_SIZE ?
+                   clen - FORKAE_BLOCK_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return FORKAE_CONCAT(FORKAE_ALG_NAME,_aead_decrypt_vec)
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
 #endif /* FORKAE_ALG_NAME */
 
 /* Now undefine everything so that we can include this file again for
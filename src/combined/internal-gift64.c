@@ -504,6 +504,7 @@ static void gift64b_decrypt_core
 
 void gift64n_init(gift64n_key_schedule_t *ks, const unsigned char *key)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT64N_INIT);
     /* Use the little-endian byte order from the LOTUS-AEAD submission */
     ks->k[0] = le_load_word32(key + 12);
     ks->k[1] = le_load_word32(key + 8);
@@ -592,6 +593,7 @@ void gift64n_encrypt
      const unsigned char *input)
 {
     uint32_t state[4];
+    aead_count_call(AEAD_PRIMITIVE_GIFT64N_ENCRYPT);
     gift64n_to_words(state, input);
     gift64b_encrypt_core(ks, state, 0);
     gift64n_to_nibbles(output, state);
@@ -602,6 +604,7 @@ void gift64n_decrypt
      const unsigned char *input)
 {
     uint32_t state[4];
+    aead_count_call(AEAD_PRIMITIVE_GIFT64N_DECRYPT);
     gift64n_to_words(state, input);
     gift64b_decrypt_core(ks, state, 0);
     gift64n_to_nibbles(output, state);
@@ -619,6 +622,7 @@ void gift64t_encrypt
      const unsigned char *input, uint16_t tweak)
 {
     uint32_t state[4];
+    aead_count_call(AEAD_PRIMITIVE_GIFT64T_ENCRYPT);
     gift64n_to_words(state, input);
     gift64b_encrypt_core(ks, state, GIFT64_tweaks[tweak & 0x0F]);
     gift64n_to_nibbles(output, state);
@@ -629,6 +633,7 @@ void gift64t_decrypt
      const unsigned char *input, uint16_t tweak)
 {
     uint32_t state[4];
+    aead_count_call(AEAD_PRIMITIVE_GIFT64T_DECRYPT);
     gift64n_to_words(state, input);
     gift64b_decrypt_core(ks, state, GIFT64_tweaks[tweak & 0x0F]);
     gift64n_to_nibbles(output, state);
@@ -909,6 +914,7 @@ static void gift64b_decrypt
 
 void gift64n_init(gift64n_key_schedule_t *ks, const unsigned char *key)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT64N_INIT);
     /* Use the little-endian byte order from the LOTUS-AEAD submission */
     ks->k[0] = le_load_word32(key + 12);
     ks->k[1] = le_load_word32(key + 8);
@@ -1018,6 +1024,7 @@ void gift64n_encrypt
     (const gift64n_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT64N_ENCRYPT);
     gift64n_to_words(output, input);
     gift64b_encrypt(ks, output, output);
     gift64n_to_nibbles(output, output);
@@ -1027,6 +1034,7 @@ void gift64n_decrypt
     (const gift64n_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT64N_DECRYPT);
     gift64n_to_words(output, input);
     gift64b_decrypt(ks, output, output);
     gift64n_to_nibbles(output, output);
@@ -1041,6 +1049,8 @@ void gift64t_encrypt
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT64T_ENCRYPT);
+
     /* Copy the plaintext into the state buffer and convert from nibbles */
     gift64n_to_words(output, input);
     s0 = be_load_word16(output);
@@ -1109,6 +1119,8 @@ void gift64t_decrypt
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT64T_DECRYPT);
+
     /* Copy the ciphertext into the state buffer and convert from nibbles */
     gift64n_to_words(output, input);
     s0 = be_load_word16(output);
@@ -21,6 +21,7 @@
  */
 
 #include "internal-gimli24.h"
+#include "internal-cpu.h"
 
 #if !defined(__AVR__)
 
@@ -34,7 +35,8 @@
         s8 = x ^ (s8 << 1) ^ ((y & s8) << 2); \
     } while (0)
 
-void gimli24_permute(uint32_t state[12])
+/* Portable implementation of the GIMLI-24 permutation */
+static void gimli24_permute_c(uint32_t state[12])
 {
     uint32_t s0, s1, s2, s3, s4,  s5;
     uint32_t s6, s7, s8, s9, s10, s11;
@@ -139,4 +141,234 @@ void gimli24_permute(uint32_t state[12])
 #endif
 }
 
+#if defined(LW_CPU_HAVE_SSE2)
+
+#include <emmintrin.h>
+#if defined(LW_CPU_HAVE_SSSE3)
+#include <tmmintrin.h>
+#endif
+
+/* Rotate the words of a vector left by 24 bits with SSE2 or SSSE3 */
+#define gimli24_rol24_sse2(a) \
+    (_mm_or_si128(_mm_slli_epi32((a), 24), _mm_srli_epi32((a), 8)))
+#define gimli24_rol24_ssse3(a) \
+    (_mm_shuffle_epi8 \
+        ((a), _mm_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, \
+                           4, 7, 6, 5, 0, 3, 2, 1)))
+
+/* Rotate the words of a vector left by 9 bits */
+#define gimli24_rol9_x4(a) \
+    (_mm_or_si128(_mm_slli_epi32((a), 9), _mm_srli_epi32((a), 23)))
+
+/* Apply the SP-box to all four columns of the state at once */
+#define GIMLI24_SP_X4(s0, s4, s8, rol24) \
+    do { \
+        x = rol24(s0); \
+        y = gimli24_rol9_x4(s4); \
+        s4 = _mm_xor_si128 \
+            (_mm_xor_si128(y, x), \
+             _mm_slli_epi32(_mm_or_si128(x, s8), 1)); \
+        s0 = _mm_xor_si128 \
+            (_mm_xor_si128(s8, y), \
+             _mm_slli_epi32(_mm_and_si128(x, y), 3)); \
+        s8 = _mm_xor_si128 \
+            (_mm_xor_si128(x, _mm_slli_epi32(s8, 1)), \
+             _mm_slli_epi32(_mm_and_si128(y, s8), 2)); \
+    } while (0)
+
+/**
+ * \brief Permutes a GIMLI-24 state with each row in a 128-bit vector.
+ *
+ * \param state The GIMLI-24 state to be permuted.
+ * \param rol24 Operation that rotates the words of a vector by 24 bits.
+ *
+ * All platforms with SSE2 are little-endian so no byte order conversion
+ * is necessary.
+ */
+#define gimli24_permute_x4(state, rol24) \
+    do { \
+        __m128i s0, s4, s8, x, y; \
+        unsigned round; \
+        s0 = _mm_loadu_si128((const __m128i *)(state)); \
+        s4 = _mm_loadu_si128((const __m128i *)((state) + 4)); \
+        s8 = _mm_loadu_si128((const __m128i *)((state) + 8)); \
+        for (round = 24; round > 0; round -= 4) { \
+            /* Round 0: SP-box, small swap, add round constant */ \
+            GIMLI24_SP_X4(s0, s4, s8, rol24); \
+            s0 = _mm_shuffle_epi32(s0, _MM_SHUFFLE(2, 3, 0, 1)); \
+            s0 = _mm_xor_si128 \
+                (s0, _mm_cvtsi32_si128((int)(0x9e377900U ^ round))); \
+            /* Round 1: SP-box only */ \
+            GIMLI24_SP_X4(s0, s4, s8, rol24); \
+            /* Round 2: SP-box, big swap */ \
+            GIMLI24_SP_X4(s0, s4, s8, rol24); \
+            s0 = _mm_shuffle_epi32(s0, _MM_SHUFFLE(1, 0, 3, 2)); \
+            /* Round 3: SP-box only */ \
+            GIMLI24_SP_X4(s0, s4, s8, rol24); \
+        } \
+        _mm_storeu_si128((__m128i *)(state), s0); \
+        _mm_storeu_si128((__m128i *)((state) + 4), s4); \
+        _mm_storeu_si128((__m128i *)((state) + 8), s8); \
+    } while (0)
+
+/* GIMLI-24 with SSE2, which rotates by 24 bits with shifts */
+LW_CPU_TARGET("sse2") static void gimli24_permute_sse2(uint32_t state[12])
+{
+    gimli24_permute_x4(state, gimli24_rol24_sse2);
+}
+
+#endif /* LW_CPU_HAVE_SSE2 */
+
+#if defined(LW_CPU_HAVE_SSSE3)
+
+/* GIMLI-24 with SSSE3, which rotates by 24 bits with a byte shuffle */
+LW_CPU_TARGET("ssse3") static void gimli24_permute_ssse3(uint32_t state[12])
+{
+    gimli24_permute_x4(state, gimli24_rol24_ssse3);
+}
+
+#endif /* LW_CPU_HAVE_SSSE3 */
+
+/**
+ * \brief Variant of gimli24_permute() that is bound for this CPU.
+ */
+static void (*gimli24_permute_fn)(uint32_t state[12]) = 0;
+
+void gimli24_permute(uint32_t state[12])
+{
+    void (*fn)(uint32_t state[12]) = LW_CPU_LOAD(gimli24_permute_fn);
+    aead_count_call(AEAD_PRIMITIVE_GIMLI24_PERMUTE);
+    if (!fn) {
+        unsigned features = lw_cpu_features();
+        fn = gimli24_permute_c;
+#if defined(LW_CPU_HAVE_SSE2)
+        if (features & LW_CPU_SSE2)
+            fn = gimli24_permute_sse2;
+#endif
+#if defined(LW_CPU_HAVE_SSSE3)
+        if (features & LW_CPU_SSSE3)
+            fn = gimli24_permute_ssse3;
+#endif
+        (void)features;
+        LW_CPU_STORE(gimli24_permute_fn, fn);
+    }
+    (*fn)(state);
+}
+
 #endif /* !__AVR__ */
+
+#if defined(LW_CPU_HAVE_AVX2)
+
+#include <immintrin.h>
+
+/* Rotate the words of a vector left by 24 or 9 bits */
+#define gimli24_rol24_x8(a) \
+    (_mm256_shuffle_epi8 \
+        ((a), _mm256_set_epi8(12, 15, 14, 13, 8, 11, 10, 9, \
+                              4, 7, 6, 5, 0, 3, 2, 1, \
+                              12, 15, 14, 13, 8, 11, 10, 9, \
+                              4, 7, 6, 5, 0, 3, 2, 1)))
+#define gimli24_rol9_x8(a) \
+    (_mm256_or_si256(_mm256_slli_epi32((a), 9), _mm256_srli_epi32((a), 23)))
+
+/* Apply the SP-box to all four columns of both states at once */
+#define GIMLI24_SP_X8(s0, s4, s8) \
+    do { \
+        x = gimli24_rol24_x8(s0); \
+        y = gimli24_rol9_x8(s4); \
+        s4 = _mm256_xor_si256 \
+            (_mm256_xor_si256(y, x), \
+             _mm256_slli_epi32(_mm256_or_si256(x, s8), 1)); \
+        s0 = _mm256_xor_si256 \
+            (_mm256_xor_si256(s8, y), \
+             _mm256_slli_epi32(_mm256_and_si256(x, y), 3)); \
+        s8 = _mm256_xor_si256 \
+            (_mm256_xor_si256(x, _mm256_slli_epi32(s8, 1)), \
+             _mm256_slli_epi32(_mm256_and_si256(y, s8), 2)); \
+    } while (0)
+
+/* Load a row from two states into the halves of a vector */
+#define gimli24_load_x8(state0, state1) \
+    (_mm256_inserti128_si256 \
+        (_mm256_castsi128_si256 \
+            (_mm_loadu_si128((const __m128i *)(state0))), \
+         _mm_loadu_si128((const __m128i *)(state1)), 1))
+
+/* Store the halves of a vector into a row of two states */
+#define gimli24_store_x8(state0, state1, s) \
+    do { \
+        _mm_storeu_si128((__m128i *)(state0), _mm256_castsi256_si128(s)); \
+        _mm_storeu_si128 \
+            ((__m128i *)(state1), _mm256_extracti128_si256(s, 1)); \
+    } while (0)
+
+/* Two-state GIMLI-24 with one state in each half of the AVX2 vectors */
+LW_CPU_TARGET("avx2") static void gimli24_x2_permute_avx2
+    (uint32_t state0[12], uint32_t state1[12])
+{
+    __m256i s0, s4, s8, x, y;
+    unsigned round;
+
+    aead_count_calls(AEAD_PRIMITIVE_GIMLI24_PERMUTE, 2);
+
+    /* Each 128-bit half of a vector holds a row from one of the states */
+    s0 = gimli24_load_x8(state0, state1);
+    s4 = gimli24_load_x8(state0 + 4, state1 + 4);
+    s8 = gimli24_load_x8(state0 + 8, state1 + 8);
+
+    /* Unroll and perform the rounds 4 at a time.  The word shuffles
+     * operate on each 128-bit half independently */
+    for (round = 24; round > 0; round -= 4) {
+        /* Round 0: SP-box, small swap, add round constant */
+        GIMLI24_SP_X8(s0, s4, s8);
+        s0 = _mm256_shuffle_epi32(s0, _MM_SHUFFLE(2, 3, 0, 1));
+        s0 = _mm256_xor_si256
+            (s0, _mm256_set_epi32(0, 0, 0, (int)(0x9e377900U ^ round),
+                                  0, 0, 0, (int)(0x9e377900U ^ round)));
+
+        /* Round 1: SP-box only */
+        GIMLI24_SP_X8(s0, s4, s8);
+
+        /* Round 2: SP-box, big swap */
+        GIMLI24_SP_X8(s0, s4, s8);
+        s0 = _mm256_shuffle_epi32(s0, _MM_SHUFFLE(1, 0, 3, 2));
+
+        /* Round 3: SP-box only */
+        GIMLI24_SP_X8(s0, s4, s8);
+    }
+
+    /* Store the rows back into the states */
+    gimli24_store_x8(state0, state1, s0);
+    gimli24_store_x8(state0 + 4, state1 + 4, s4);
+    gimli24_store_x8(state0 + 8, state1 + 8, s8);
+}
+
+#endif /* LW_CPU_HAVE_AVX2 */
+
+/* Two-state GIMLI-24 that permutes the states one after the other */
+static void gimli24_x2_permute_c(uint32_t state0[12], uint32_t state1[12])
+{
+    gimli24_permute(state0);
+    gimli24_permute(state1);
+}
+
+/**
+ * \brief Variant of gimli24_x2_permute() that is bound for this CPU.
+ */
+static void (*gimli24_x2_permute_fn)
+    (uint32_t state0[12], uint32_t state1[12]) = 0;
+
+void gimli24_x2_permute(uint32_t state0[12], uint32_t state1[12])
+{
+    void (*fn)(uint32_t state0[12], uint32_t state1[12]) =
+        LW_CPU_LOAD(gimli24_x2_permute_fn);
+    if (!fn) {
+        fn = gimli24_x2_permute_c;
+#if defined(LW_CPU_HAVE_AVX2)
+        if (lw_cpu_features() & LW_CPU_AVX2)
+            fn = gimli24_x2_permute_avx2;
+#endif
+        LW_CPU_STORE(gimli24_x2_permute_fn, fn);
+    }
+    (*fn)(state0, state1);
+}
@@ -42,9 +42,26 @@ extern "C" {
  * \param state The GIMLI-24 state to be permuted.
  *
  * The input and output \a state will be in little-endian byte order.
+ *
+ * Uses SSE2 instructions if available, with each row of the state in
+ * a single 128-bit vector.  SSSE3 is used for byte rotations if available.
  */
 void gimli24_permute(uint32_t state[12]);
 
+/**
+ * \brief Permutes two GIMLI-24 states in parallel.
+ *
+ * \param state0 The first GIMLI-24 state to be permuted.
+ * \param state1 The second GIMLI-24 state to be permuted.
+ *
+ * The input and output states will be in little-endian byte order.
+ *
+ * Uses AVX2 instructions if available, with one state in each 128-bit
+ * half of the vectors.  Otherwise this is equivalent to calling
+ * gimli24_permute() on each state.
+ */
+void gimli24_x2_permute(uint32_t state0[12], uint32_t state1[12]);
+
 #ifdef __cplusplus
 }
 #endif
@@ -33,6 +33,8 @@ void grain128_core
 {
     uint32_t s0, s1, s2, s3;
 
+    aead_count_call(AEAD_PRIMITIVE_GRAIN128_CORE);
+
     /* From the Grain-128AEAD specification, the LFSR feedback algorithm is:
      *
      *      s'[i] = s[i + 1]
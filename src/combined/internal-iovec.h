@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef LW_INTERNAL_IOVEC_H
+#define LW_INTERNAL_IOVEC_H
+
+#include "internal-util.h"
+#include <string.h>
+
+/**
+ * \file internal-iovec.h
+ * \brief Cursors for walking scatter/gather segment arrays.
+ *
+ * The native vectored AEAD modes walk the plaintext, ciphertext, and
+ * associated data segments with these cursors, processing each chunk
+ * in place.  Data is only copied when a fixed-size value such as the
+ * authentication tag straddles a segment boundary.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief Position within an array of scatter/gather segments.
+ */
+typedef struct
+{
+    const aead_iovec_t *vec;    /**< Current segment */
+    size_t count;               /**< Number of segments left, including vec */
+    size_t posn;                /**< Position within the current segment */
+
+} aead_iovec_cursor_t;
+
+/**
+ * \brief Sets a scatter/gather segment to cover a contiguous buffer.
+ *
+ * \param vec The segment to set.
+ * \param data Points to the buffer, which may be NULL if \a len is zero.
+ * \param len Length of the buffer in bytes.
+ *
+ * This is used by the contiguous entry points of the native vectored
+ * modes to pass their buffers to the cursor-based implementation.
+ */
+STATIC_INLINE void aead_iovec_set
+    (aead_iovec_t *vec, const unsigned char *data, unsigned long long len)
+{
+    vec->data = (unsigned char *)data;
+    vec->len = (size_t)len;
+}
+
+/**
+ * \brief Skips over any empty or fully consumed segments.
+ *
+ * \param cursor The cursor to normalize.
+ */
+STATIC_INLINE void aead_iovec_skip_empty(aead_iovec_cursor_t *cursor)
+{
+    while (cursor->count > 0 && cursor->posn >= cursor->vec->len) {
+        ++(cursor->vec);
+        --(cursor->count);
+        cursor->posn = 0;
+    }
+}
+
+/**
+ * \brief Initializes a cursor to the start of an array of segments.
+ *
+ * \param cursor The cursor to initialize.
+ * \param vec Points to the array of segments, which may be NULL
+ * if \a count is zero.
+ * \param count Number of segments in the array.
+ */
+STATIC_INLINE void aead_iovec_start
+    (aead_iovec_cursor_t *cursor, const aead_iovec_t *vec, size_t count)
+{
+    cursor->vec = vec;
+    cursor->count = count;
+    cursor->posn = 0;
+    aead_iovec_skip_empty(cursor);
+}
+
+/**
+ * \brief Gets a pointer to the current position of a cursor.
+ *
+ * \param cursor The cursor.
+ *
+ * \return A pointer to the next byte of data in the segments.
+ */
+#define aead_iovec_ptr(cursor) ((cursor)->vec->data + (cursor)->posn)
+
+/**
+ * \brief Gets a contiguous chunk length from the current cursor position.
+ *
+ * \param cursor The cursor.
+ * \param max Maximum number of bytes that are wanted.
+ *
+ * \return The number of bytes that are available in the current segment,
+ * up to \a max.  Returns zero if the end of the segments has been reached.
+ */
+STATIC_INLINE size_t aead_iovec_chunk
+    (const aead_iovec_cursor_t *cursor, size_t max)
+{
+    size_t avail;
+    if (!cursor->count)
+        return 0;
+    avail = cursor->vec->len - cursor->posn;
+    return avail < max ? avail : max;
+}
+
+/**
+ * \brief Advances a cursor after processing a chunk of data.
+ *
+ * \param cursor The cursor to advance.
+ * \param len Number of bytes to advance, which must be no more than the
+ * value returned by the last call to aead_iovec_chunk().
+ */
+STATIC_INLINE void aead_iovec_advance(aead_iovec_cursor_t *cursor, size_t len)
+{
+    cursor->posn += len;
+    aead_iovec_skip_empty(cursor);
+}
+
+/**
+ * \brief Skips over bytes in the segments at a cursor.
+ *
+ * \param cursor The cursor to advance.
+ * \param len Number of bytes to skip, which must not be more than the
+ * number of bytes left in the segments.
+ */
+STATIC_INLINE void aead_iovec_skip
+    (aead_iovec_cursor_t *cursor, unsigned long long len)
+{
+    while (len > 0) {
+        size_t temp = aead_iovec_chunk(cursor, (size_t)(-1));
+        if (temp > len)
+            temp = (size_t)len;
+        aead_iovec_advance(cursor, temp);
+        len -= temp;
+    }
+}
+
+/**
+ * \brief Gets the number of full blocks that are contiguous at the
+ * current position of an input cursor and an optional output cursor.
+ *
+ * \param in The input cursor.
+ * \param out The output cursor, or NULL if there is no output.
+ * \param len Number of bytes that are left to process.
+ * \param block_size Size of a block in bytes.
+ * \param max_blocks Maximum number of blocks that are wanted.
+ *
+ * \return The number of blocks that can be processed directly in the
+ * segments, or zero if the next block straddles a segment boundary
+ * in either cursor and must be gathered with aead_iovec_load_block().
+ */
+STATIC_INLINE size_t aead_iovec_blocks
+    (const aead_iovec_cursor_t *in, const aead_iovec_cursor_t *out,
+     unsigned long long len, size_t block_size, size_t max_blocks)
+{
+    size_t avail = aead_iovec_chunk(in, block_size * max_blocks);
+    if (out)
+        avail = aead_iovec_chunk(out, avail);
+    if (avail > len)
+        avail = (size_t)len;
+    return avail / block_size;
+}
+
+/**
+ * \brief Gathers bytes from the segments at the cursor into a buffer.
+ *
+ * \param cursor The cursor to read from, which is advanced.
+ * \param out Points to the buffer to receive the data.
+ * \param len Number of bytes to read, which must not be more than the
+ * number of bytes left in the segments.
+ */
+STATIC_INLINE void aead_iovec_read
+    (aead_iovec_cursor_t *cursor, unsigned char *out, size_t len)
+{
+    while (len > 0) {
+        size_t temp = aead_iovec_chunk(cursor, len);
+        memcpy(out, aead_iovec_ptr(cursor), temp);
+        aead_iovec_advance(cursor, temp);
+        out += temp;
+        len -= temp;
+    }
+}
+
+/**
+ * \brief Scatters bytes from a buffer into the segments at the cursor.
+ *
+ * \param cursor The cursor to write to, which is advanced.
+ * \param in Points to the data to write.
+ * \param len Number of bytes to write, which must not be more than the
+ * number of bytes left in the segments.
+ */
+STATIC_INLINE void aead_iovec_write
+    (aead_iovec_cursor_t *cursor, const unsigned char *in, size_t len)
+{
+    while (len > 0) {
+        size_t temp = aead_iovec_chunk(cursor, len);
+        memcpy(aead_iovec_ptr(cursor), in, temp);
+        aead_iovec_advance(cursor, temp);
+        in += temp;
+        len -= temp;
+    }
+}
+
+/**
+ * \brief Gets a pointer to a fixed-size block of input at the cursor.
+ *
+ * \param cursor The cursor to read from, which is advanced.
+ * \param buf Temporary buffer of at least \a len bytes in size.
+ * \param len Number of bytes in the block, which must not be more than
+ * the number of bytes left in the segments.
+ *
+ * \return A pointer directly into the current segment if the block is
+ * contiguous, or \a buf after gathering the block otherwise.  If \a len
+ * is zero, then \a buf is returned.
+ */
+STATIC_INLINE const unsigned char *aead_iovec_load_block
+    (aead_iovec_cursor_t *cursor, unsigned char *buf, size_t len)
+{
+    const unsigned char *ptr;
+    if (len && aead_iovec_chunk(cursor, len) == len) {
+        ptr = aead_iovec_ptr(cursor);
+        aead_iovec_advance(cursor, len);
+        return ptr;
+    }
+    aead_iovec_read(cursor, buf, len);
+    return buf;
+}
+
+/**
+ * \brief Gets a pointer to write a fixed-size block of output to.
+ *
+ * \param cursor The cursor to write to, which is not advanced.
+ * \param buf Temporary buffer of at least \a len bytes in size.
+ * \param len Number of bytes in the block, which must not be more than
+ * the number of bytes left in the segments.
+ *
+ * \return A pointer directly into the current segment if the block is
+ * contiguous, or \a buf otherwise.  If \a len is zero, then \a buf
+ * is returned.
+ *
+ * \sa aead_iovec_store_end()
+ */
+STATIC_INLINE unsigned char *aead_iovec_store_begin
+    (aead_iovec_cursor_t *cursor, unsigned char *buf, size_t len)
+{
+    if (len && aead_iovec_chunk(cursor, len) == len)
+        return aead_iovec_ptr(cursor);
+    return buf;
+}
+
+/**
+ * \brief Finishes writing a block of output that was started with
+ * aead_iovec_store_begin().
+ *
+ * \param cursor The cursor to write to, which is advanced.
+ * \param buf Temporary buffer that was passed to aead_iovec_store_begin().
+ * \param out Pointer that was returned by aead_iovec_store_begin().
+ * \param len Number of bytes in the block.
+ */
+STATIC_INLINE void aead_iovec_store_end
+    (aead_iovec_cursor_t *cursor, const unsigned char *buf,
+     const unsigned char *out, size_t len)
+{
+    if (out == buf)
+        aead_iovec_write(cursor, buf, len);
+    else
+        aead_iovec_advance(cursor, len);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -134,11 +134,13 @@ static void knot256_permute
 
 void knot256_permute_6(knot256_state_t *state, uint8_t rounds)
 {
+    aead_count_call(AEAD_PRIMITIVE_KNOT256_PERMUTE);
     knot256_permute(state, rc6, rounds);
 }
 
 void knot256_permute_7(knot256_state_t *state, uint8_t rounds)
 {
+    aead_count_call(AEAD_PRIMITIVE_KNOT256_PERMUTE);
     knot256_permute(state, rc7, rounds);
 }
 
@@ -148,6 +150,8 @@ void knot384_permute_7(knot384_state_t *state, uint8_t rounds)
     uint64_t b2, b4, b6;
     uint32_t b3, b5, b7;
 
+    aead_count_call(AEAD_PRIMITIVE_KNOT384_PERMUTE);
+
     /* Load the input state into local variables; each row is 96 bits */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     uint64_t x0 = state->S[0];
@@ -290,11 +294,13 @@ static void knot512_permute
 
 void knot512_permute_7(knot512_state_t *state, uint8_t rounds)
 {
+    aead_count_call(AEAD_PRIMITIVE_KNOT512_PERMUTE);
     knot512_permute(state, rc7, rounds);
 }
 
 void knot512_permute_8(knot512_state_t *state, uint8_t rounds)
 {
+    aead_count_call(AEAD_PRIMITIVE_KNOT512_PERMUTE);
     knot512_permute(state, rc8, rounds);
 }
 
@@ -76,18 +76,34 @@ extern uint32_t esp_random(void);
 #warning "No random number source found!"
 /* Use Xorshift to provide a source of random numbers as a last ditch fallback.
  * This is not cryptographically secure so it is only suitable for testing.
- * https://en.wikipedia.org/wiki/Xorshift */
-static uint64_t seed = 0x6A09E667F3BCC908ULL; /* First init word from SHA-512 */
+ * https://en.wikipedia.org/wiki/Xorshift
+ *
+ * On hosted platforms the seed is kept per-thread so that threads which
+ * are generating masking material at the same time do not race on the
+ * seed or bounce its cache line between cores.  The address of the
+ * thread's copy of the seed is mixed in on first use so that each thread
+ * produces a different stream. */
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__unix__) || defined(__APPLE__))
+#define AEAD_MASKING_THREAD_LOCAL __thread
+#else
+#define AEAD_MASKING_THREAD_LOCAL
+#endif
+static AEAD_MASKING_THREAD_LOCAL uint64_t seed = 0;
+#define AEAD_MASKING_SEED \
+    (0x6A09E667F3BCC908ULL ^ /* First init word from SHA-512 */ \
+     (uint64_t)(uintptr_t)&seed)
 #define aead_system_random_init() do { ; } while (0)
 #define aead_system_random(var) \
     do { \
+        if (!seed) { \
+            /* Seed on first use, and prevent the RNG from getting \
+             * stuck at zero */ \
+            seed = AEAD_MASKING_SEED; \
+        } \
         seed ^= seed << 13; \
         seed ^= seed >> 7; \
         seed ^= seed << 17; \
-        if (!seed) { \
-            /* Prevent the RNG from getting stuck at zero */ \
-            seed = 0x6A09E667F3BCC908ULL; \
-        } \
         (var) = (uint32_t)seed; \
     } while (0)
 #endif
@@ -23,7 +23,7 @@
 #ifndef LW_INTERNAL_OCB_H
 #define LW_INTERNAL_OCB_H
 
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 /* We expect a number of macros to be defined before this file
@@ -38,6 +38,16 @@
  * OCB_ENCRYPT_BLOCK    Name of the block cipher ECB encrypt function.
  * OCB_DECRYPT_BLOCK    Name of the block cipher ECB decrypt function.
  * OCB_DOUBLE_L         Name of the function to double L (optional).
+ * OCB_ENCRYPT_BLOCKS   Name of a function that encrypts several blocks in
+ *                      ECB mode at once (optional).
+ * OCB_DECRYPT_BLOCKS   Name of a function that decrypts several blocks in
+ *                      ECB mode at once (optional).
+ * OCB_PARALLEL_BLOCKS  Maximum number of blocks to pass to the multi-block
+ *                      functions at once (optional).  The default is 8 if
+ *                      OCB_ENCRYPT_BLOCKS is defined or 1 otherwise.
+ * OCB_L_TABLE_SIZE     Number of L_i values to precompute (optional,
+ *                      default is 8).  Blocks i where ntz(i) is greater
+ *                      than this compute L_{ntz(i)} on the fly.
  */
 #if defined(OCB_ENCRYPT_BLOCK)
 
@@ -94,34 +104,92 @@ static void OCB_DOUBLE_L
 
 #endif
 
-/* State information for OCB functions */
+#if !defined(OCB_PARALLEL_BLOCKS)
+#if defined(OCB_ENCRYPT_BLOCKS)
+#define OCB_PARALLEL_BLOCKS 8
+#else
+#define OCB_PARALLEL_BLOCKS 1
+#endif
+#endif
+
+#if !defined(OCB_ENCRYPT_BLOCKS)
+
+#define OCB_ENCRYPT_BLOCKS OCB_CONCAT(OCB_ALG_NAME,_ocb_encrypt_blocks)
+
+/* Encrypt several blocks in ECB mode one at a time */
+static void OCB_ENCRYPT_BLOCKS
+    (const OCB_KEY_SCHEDULE *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    while (count > 0) {
+        OCB_ENCRYPT_BLOCK(ks, output, input);
+        output += OCB_BLOCK_SIZE;
+        input += OCB_BLOCK_SIZE;
+        --count;
+    }
+}
+
+#endif
+
+#if !defined(OCB_DECRYPT_BLOCKS)
+
+#define OCB_DECRYPT_BLOCKS OCB_CONCAT(OCB_ALG_NAME,_ocb_decrypt_blocks)
+
+/* Decrypt several blocks in ECB mode one at a time */
+static void OCB_DECRYPT_BLOCKS
+    (const OCB_KEY_SCHEDULE *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    while (count > 0) {
+        OCB_DECRYPT_BLOCK(ks, output, input);
+        output += OCB_BLOCK_SIZE;
+        input += OCB_BLOCK_SIZE;
+        --count;
+    }
+}
+
+#endif
+
+#if !defined(OCB_L_TABLE_SIZE)
+#define OCB_L_TABLE_SIZE 8
+#endif
+
+/* State information for OCB functions, which is also the key context */
 #define OCB_STATE OCB_CONCAT(OCB_ALG_NAME,_state_t)
 typedef struct
 {
     OCB_KEY_SCHEDULE ks;
     unsigned char Lstar[OCB_BLOCK_SIZE];
     unsigned char Ldollar[OCB_BLOCK_SIZE];
-    unsigned char L0[OCB_BLOCK_SIZE];
-    unsigned char L1[OCB_BLOCK_SIZE];
+    unsigned char L[OCB_L_TABLE_SIZE][OCB_BLOCK_SIZE];
 
 } OCB_STATE;
 
-/* Initializes the OCB state from the key and nonce */
-static void OCB_CONCAT(OCB_ALG_NAME,_init)
-    (OCB_STATE *state, const unsigned char *k, const unsigned char *nonce,
-     unsigned char offset[OCB_BLOCK_SIZE])
+/* Initializes the OCB key context with the key schedule and L values */
+static void OCB_CONCAT(OCB_ALG_NAME,_aead_setup_key)
+    (void *ctx, const unsigned char *k)
 {
-    unsigned bottom;
+    OCB_STATE *state = (OCB_STATE *)ctx;
+    unsigned index;
 
     /* Set up the key schedule */
     OCB_SETUP_KEY(&(state->ks), k);
 
-    /* Derive the values of L*, L$, L0, and L1 */
+    /* Derive the values of L*, L$, and the table of L_i values */
     memset(state->Lstar, 0, sizeof(state->Lstar));
     OCB_ENCRYPT_BLOCK(&(state->ks), state->Lstar, state->Lstar);
     OCB_DOUBLE_L(state->Ldollar, state->Lstar);
-    OCB_DOUBLE_L(state->L0, state->Ldollar);
-    OCB_DOUBLE_L(state->L1, state->L0);
+    OCB_DOUBLE_L(state->L[0], state->Ldollar);
+    for (index = 1; index < OCB_L_TABLE_SIZE; ++index)
+        OCB_DOUBLE_L(state->L[index], state->L[index - 1]);
+}
+
+/* Derives the initial offset from the nonce */
+static void OCB_CONCAT(OCB_ALG_NAME,_init)
+    (const OCB_STATE *state, const unsigned char *nonce,
+     unsigned char offset[OCB_BLOCK_SIZE])
+{
+    unsigned bottom;
 
     /* Derive the initial offset from the nonce */
     memset(offset, 0, OCB_BLOCK_SIZE);
@@ -165,189 +233,383 @@ static void OCB_CONCAT(OCB_ALG_NAME,_init)
     }
 }
 
-/* Calculate L_{ntz(i)} when the last two bits of i are zero */
-static void OCB_CONCAT(OCB_ALG_NAME,_calculate_L)
-    (OCB_STATE *state, unsigned char L[OCB_BLOCK_SIZE], unsigned long long i)
+/* XOR's L_{ntz(i)} into the offset for block i */
+static void OCB_CONCAT(OCB_ALG_NAME,_update_offset)
+    (const OCB_STATE *state, unsigned char offset[OCB_BLOCK_SIZE],
+     unsigned long long i)
 {
-    OCB_DOUBLE_L(L, state->L1);
-    i >>= 2;
+    unsigned char L[OCB_BLOCK_SIZE];
+    unsigned ntz = 0;
     while ((i & 1) == 0) {
-        OCB_DOUBLE_L(L, L);
+        ++ntz;
         i >>= 1;
     }
+    if (ntz < OCB_L_TABLE_SIZE) {
+        lw_xor_block(offset, state->L[ntz], OCB_BLOCK_SIZE);
+    } else {
+        /* Extend the table on the fly for very long inputs */
+        OCB_DOUBLE_L(L, state->L[OCB_L_TABLE_SIZE - 1]);
+        for (ntz -= OCB_L_TABLE_SIZE; ntz > 0; --ntz)
+            OCB_DOUBLE_L(L, L);
+        lw_xor_block(offset, L, OCB_BLOCK_SIZE);
+    }
+}
+
+/* Computes the offsets for a run of full blocks starting at block i */
+static void OCB_CONCAT(OCB_ALG_NAME,_offsets)
+    (const OCB_STATE *state, unsigned char offset[OCB_BLOCK_SIZE],
+     unsigned char *offsets, unsigned long long i, unsigned count)
+{
+    while (count > 0) {
+        OCB_CONCAT(OCB_ALG_NAME,_update_offset)(state, offset, i);
+        memcpy(offsets, offset, OCB_BLOCK_SIZE);
+        offsets += OCB_BLOCK_SIZE;
+        ++i;
+        --count;
+    }
 }
 
 /* Process associated data with OCB */
 static void OCB_CONCAT(OCB_ALG_NAME,_process_ad)
-    (OCB_STATE *state, unsigned char tag[OCB_BLOCK_SIZE],
-     const unsigned char *ad, unsigned long long adlen)
+    (const OCB_STATE *state, unsigned char tag[OCB_BLOCK_SIZE],
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
     unsigned char offset[OCB_BLOCK_SIZE];
-    unsigned char block[OCB_BLOCK_SIZE];
+    unsigned char offsets[OCB_PARALLEL_BLOCKS * OCB_BLOCK_SIZE];
+    unsigned char blocks[OCB_PARALLEL_BLOCKS * OCB_BLOCK_SIZE];
+    unsigned char partial[OCB_BLOCK_SIZE];
+    const unsigned char *in;
     unsigned long long block_number;
+    unsigned count, posn;
 
     /* Process all full blocks */
     memset(offset, 0, sizeof(offset));
     block_number = 1;
     while (adlen >= OCB_BLOCK_SIZE) {
-        if (block_number & 1) {
-            lw_xor_block(offset, state->L0, OCB_BLOCK_SIZE);
-        } else if ((block_number & 3) == 2) {
-            lw_xor_block(offset, state->L1, OCB_BLOCK_SIZE);
+        count = (unsigned)aead_iovec_blocks
+            (ad, 0, adlen, OCB_BLOCK_SIZE, OCB_PARALLEL_BLOCKS);
+        if (count > 0) {
+            in = aead_iovec_ptr(ad);
+            aead_iovec_advance(ad, count * OCB_BLOCK_SIZE);
         } else {
-            OCB_CONCAT(OCB_ALG_NAME,_calculate_L)(state, block, block_number);
-            lw_xor_block(offset, block, OCB_BLOCK_SIZE);
+            count = 1;
+            in = aead_iovec_load_block(ad, partial, OCB_BLOCK_SIZE);
         }
-        lw_xor_block_2_src(block, offset, ad, OCB_BLOCK_SIZE);
-        OCB_ENCRYPT_BLOCK(&(state->ks), block, block);
-        lw_xor_block(tag, block, OCB_BLOCK_SIZE);
-        ad += OCB_BLOCK_SIZE;
-        adlen -= OCB_BLOCK_SIZE;
-        ++block_number;
+        OCB_CONCAT(OCB_ALG_NAME,_offsets)
+            (state, offset, offsets, block_number, count);
+        lw_xor_block_2_src(blocks, offsets, in, count * OCB_BLOCK_SIZE);
+        OCB_ENCRYPT_BLOCKS(&(state->ks), blocks, blocks, count);
+        for (posn = 0; posn < count * OCB_BLOCK_SIZE; posn += OCB_BLOCK_SIZE)
+            lw_xor_block(tag, blocks + posn, OCB_BLOCK_SIZE);
+        adlen -= count * OCB_BLOCK_SIZE;
+        block_number += count;
     }
 
     /* Pad and process the last partial block */
     if (adlen > 0) {
         unsigned temp = (unsigned)adlen;
+        in = aead_iovec_load_block(ad, partial, temp);
         lw_xor_block(offset, state->Lstar, OCB_BLOCK_SIZE);
-        lw_xor_block(offset, ad, temp);
+        lw_xor_block(offset, in, temp);
         offset[temp] ^= 0x80;
-        OCB_ENCRYPT_BLOCK(&(state->ks), block, offset);
-        lw_xor_block(tag, block, OCB_BLOCK_SIZE);
+        OCB_ENCRYPT_BLOCK(&(state->ks), blocks, offset);
+        lw_xor_block(tag, blocks, OCB_BLOCK_SIZE);
     }
 }
 
-int OCB_CONCAT(OCB_ALG_NAME,_aead_encrypt)
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *nsec,
-     const unsigned char *npub,
-     const unsigned char *k)
+/* Encrypts the payload and computes the tag, reading the plaintext and
+ * associated data from cursors and writing the ciphertext to a cursor.
+ * The full block of the tag is written to "tag" */
+static void OCB_CONCAT(OCB_ALG_NAME,_encrypt_core)
+    (const OCB_STATE *state, aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen,
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     const unsigned char *npub, unsigned char tag[OCB_BLOCK_SIZE])
 {
-    OCB_STATE state;
     unsigned char offset[OCB_BLOCK_SIZE];
-    unsigned char sum[OCB_BLOCK_SIZE];
-    unsigned char block[OCB_BLOCK_SIZE];
+    unsigned char offsets[OCB_PARALLEL_BLOCKS * OCB_BLOCK_SIZE];
+    unsigned char blocks[OCB_PARALLEL_BLOCKS * OCB_BLOCK_SIZE];
+    unsigned char inbuf[OCB_BLOCK_SIZE];
+    unsigned char outbuf[OCB_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned long long block_number;
-    (void)nsec;
-
-    /* Set the length of the returned ciphertext */
-    *clen = mlen + OCB_TAG_SIZE;
+    unsigned count, posn;
 
     /* Initialize the OCB state */
-    OCB_CONCAT(OCB_ALG_NAME,_init)(&state, k, npub, offset);
+    OCB_CONCAT(OCB_ALG_NAME,_init)(state, npub, offset);
 
     /* Process all plaintext blocks except the last */
-    memset(sum, 0, sizeof(sum));
+    memset(tag, 0, OCB_BLOCK_SIZE);
     block_number = 1;
     while (mlen >= OCB_BLOCK_SIZE) {
-        if (block_number & 1) {
-            lw_xor_block(offset, state.L0, OCB_BLOCK_SIZE);
-        } else if ((block_number & 3) == 2) {
-            lw_xor_block(offset, state.L1, OCB_BLOCK_SIZE);
+        count = (unsigned)aead_iovec_blocks
+            (m, c, mlen, OCB_BLOCK_SIZE, OCB_PARALLEL_BLOCKS);
+        if (count > 0) {
+            in = aead_iovec_ptr(m);
+            out = aead_iovec_ptr(c);
+            aead_iovec_advance(m, count * OCB_BLOCK_SIZE);
         } else {
-            OCB_CONCAT(OCB_ALG_NAME,_calculate_L)(&state, block, block_number);
-            lw_xor_block(offset, block, OCB_BLOCK_SIZE);
+            count = 1;
+            in = aead_iovec_load_block(m, inbuf, OCB_BLOCK_SIZE);
+            out = aead_iovec_store_begin(c, outbuf, OCB_BLOCK_SIZE);
         }
-        lw_xor_block(sum, m, OCB_BLOCK_SIZE);
-        lw_xor_block_2_src(block, offset, m, OCB_BLOCK_SIZE);
-        OCB_ENCRYPT_BLOCK(&(state.ks), block, block);
-        lw_xor_block_2_src(c, block, offset, OCB_BLOCK_SIZE);
-        c += OCB_BLOCK_SIZE;
-        m += OCB_BLOCK_SIZE;
-        mlen -= OCB_BLOCK_SIZE;
-        ++block_number;
+        OCB_CONCAT(OCB_ALG_NAME,_offsets)
+            (state, offset, offsets, block_number, count);
+        for (posn = 0; posn < count * OCB_BLOCK_SIZE; posn += OCB_BLOCK_SIZE)
+            lw_xor_block(tag, in + posn, OCB_BLOCK_SIZE);
+        lw_xor_block_2_src(blocks, offsets, in, count * OCB_BLOCK_SIZE);
+        OCB_ENCRYPT_BLOCKS(&(state->ks), blocks, blocks, count);
+        lw_xor_block_2_src(out, blocks, offsets, count * OCB_BLOCK_SIZE);
+        aead_iovec_store_end(c, outbuf, out, count * OCB_BLOCK_SIZE);
+        mlen -= count * OCB_BLOCK_SIZE;
+        block_number += count;
     }
 
     /* Pad and process the last plaintext block */
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
-        lw_xor_block(sum, m, temp);
-        sum[temp] ^= 0x80;
-        lw_xor_block(offset, state.Lstar, OCB_BLOCK_SIZE);
-        OCB_ENCRYPT_BLOCK(&(state.ks), block, offset);
-        lw_xor_block_2_src(c, block, m, temp);
-        c += temp;
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
+        lw_xor_block(tag, in, temp);
+        tag[temp] ^= 0x80;
+        lw_xor_block(offset, state->Lstar, OCB_BLOCK_SIZE);
+        OCB_ENCRYPT_BLOCK(&(state->ks), blocks, offset);
+        lw_xor_block_2_src(out, blocks, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
     }
 
     /* Finalize the encryption phase */
-    lw_xor_block(sum, offset, OCB_BLOCK_SIZE);
-    lw_xor_block(sum, state.Ldollar, OCB_BLOCK_SIZE);
-    OCB_ENCRYPT_BLOCK(&(state.ks), sum, sum);
+    lw_xor_block(tag, offset, OCB_BLOCK_SIZE);
+    lw_xor_block(tag, state->Ldollar, OCB_BLOCK_SIZE);
+    OCB_ENCRYPT_BLOCK(&(state->ks), tag, tag);
 
     /* Process the associated data and compute the final authentication tag */
-    OCB_CONCAT(OCB_ALG_NAME,_process_ad)(&state, sum, ad, adlen);
-    memcpy(c, sum, OCB_TAG_SIZE);
-    return 0;
+    OCB_CONCAT(OCB_ALG_NAME,_process_ad)(state, tag, ad, adlen);
 }
 
-int OCB_CONCAT(OCB_ALG_NAME,_aead_decrypt)
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *npub,
-     const unsigned char *k)
+/* Decrypts the payload and computes the expected tag, reading the
+ * ciphertext and associated data from cursors and writing the plaintext
+ * to a cursor.  The full block of the expected tag is written to "tag" */
+static void OCB_CONCAT(OCB_ALG_NAME,_decrypt_core)
+    (const OCB_STATE *state, aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long clen,
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     const unsigned char *npub, unsigned char tag[OCB_BLOCK_SIZE])
 {
-    OCB_STATE state;
-    unsigned char *mtemp = m;
     unsigned char offset[OCB_BLOCK_SIZE];
-    unsigned char sum[OCB_BLOCK_SIZE];
-    unsigned char block[OCB_BLOCK_SIZE];
+    unsigned char offsets[OCB_PARALLEL_BLOCKS * OCB_BLOCK_SIZE];
+    unsigned char blocks[OCB_PARALLEL_BLOCKS * OCB_BLOCK_SIZE];
+    unsigned char inbuf[OCB_BLOCK_SIZE];
+    unsigned char outbuf[OCB_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned long long block_number;
-    (void)nsec;
-
-    /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < OCB_TAG_SIZE)
-        return -1;
-    *mlen = clen - OCB_TAG_SIZE;
+    unsigned count, posn;
 
     /* Initialize the OCB state */
-    OCB_CONCAT(OCB_ALG_NAME,_init)(&state, k, npub, offset);
+    OCB_CONCAT(OCB_ALG_NAME,_init)(state, npub, offset);
 
     /* Process all ciphertext blocks except the last */
-    memset(sum, 0, sizeof(sum));
+    memset(tag, 0, OCB_BLOCK_SIZE);
     block_number = 1;
-    clen -= OCB_TAG_SIZE;
     while (clen >= OCB_BLOCK_SIZE) {
-        if (block_number & 1) {
-            lw_xor_block(offset, state.L0, OCB_BLOCK_SIZE);
-        } else if ((block_number & 3) == 2) {
-            lw_xor_block(offset, state.L1, OCB_BLOCK_SIZE);
+        count = (unsigned)aead_iovec_blocks
+            (c, m, clen, OCB_BLOCK_SIZE, OCB_PARALLEL_BLOCKS);
+        if (count > 0) {
+            in = aead_iovec_ptr(c);
+            out = aead_iovec_ptr(m);
+            aead_iovec_advance(c, count * OCB_BLOCK_SIZE);
         } else {
-            OCB_CONCAT(OCB_ALG_NAME,_calculate_L)(&state, block, block_number);
-            lw_xor_block(offset, block, OCB_BLOCK_SIZE);
+            count = 1;
+            in = aead_iovec_load_block(c, inbuf, OCB_BLOCK_SIZE);
+            out = aead_iovec_store_begin(m, outbuf, OCB_BLOCK_SIZE);
         }
-        lw_xor_block_2_src(block, offset, c, OCB_BLOCK_SIZE);
-        OCB_DECRYPT_BLOCK(&(state.ks), block, block);
-        lw_xor_block_2_src(m, block, offset, OCB_BLOCK_SIZE);
-        lw_xor_block(sum, m, OCB_BLOCK_SIZE);
-        c += OCB_BLOCK_SIZE;
-        m += OCB_BLOCK_SIZE;
-        clen -= OCB_BLOCK_SIZE;
-        ++block_number;
+        OCB_CONCAT(OCB_ALG_NAME,_offsets)
+            (state, offset, offsets, block_number, count);
+        lw_xor_block_2_src(blocks, offsets, in, count * OCB_BLOCK_SIZE);
+        OCB_DECRYPT_BLOCKS(&(state->ks), blocks, blocks, count);
+        lw_xor_block_2_src(out, blocks, offsets, count * OCB_BLOCK_SIZE);
+        for (posn = 0; posn < count * OCB_BLOCK_SIZE; posn += OCB_BLOCK_SIZE)
+            lw_xor_block(tag, out + posn, OCB_BLOCK_SIZE);
+        aead_iovec_store_end(m, outbuf, out, count * OCB_BLOCK_SIZE);
+        clen -= count * OCB_BLOCK_SIZE;
+        block_number += count;
     }
 
     /* Pad and process the last ciphertext block */
     if (clen > 0) {
         unsigned temp = (unsigned)clen;
-        lw_xor_block(offset, state.Lstar, OCB_BLOCK_SIZE);
-        OCB_ENCRYPT_BLOCK(&(state.ks), block, offset);
-        lw_xor_block_2_src(m, block, c, temp);
-        lw_xor_block(sum, m, temp);
-        sum[temp] ^= 0x80;
-        c += temp;
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
+        lw_xor_block(offset, state->Lstar, OCB_BLOCK_SIZE);
+        OCB_ENCRYPT_BLOCK(&(state->ks), blocks, offset);
+        lw_xor_block_2_src(out, blocks, in, temp);
+        lw_xor_block(tag, out, temp);
+        tag[temp] ^= 0x80;
+        aead_iovec_store_end(m, outbuf, out, temp);
     }
 
     /* Finalize the decryption phase */
-    lw_xor_block(sum, offset, OCB_BLOCK_SIZE);
-    lw_xor_block(sum, state.Ldollar, OCB_BLOCK_SIZE);
-    OCB_ENCRYPT_BLOCK(&(state.ks), sum, sum);
+    lw_xor_block(tag, offset, OCB_BLOCK_SIZE);
+    lw_xor_block(tag, state->Ldollar, OCB_BLOCK_SIZE);
+    OCB_ENCRYPT_BLOCK(&(state->ks), tag, tag);
+
+    /* Process the associated data and compute the expected tag */
+    OCB_CONCAT(OCB_ALG_NAME,_process_ad)(state, tag, ad, adlen);
+}
 
-    /* Process the associated data and check the final authentication tag */
-    OCB_CONCAT(OCB_ALG_NAME,_process_ad)(&state, sum, ad, adlen);
-    return aead_check_tag(mtemp, *mlen, sum, c, OCB_TAG_SIZE);
+static int OCB_CONCAT(OCB_ALG_NAME,_aead_encrypt_ctx)
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned char tag[OCB_BLOCK_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned ciphertext */
+    *clen = mlen + OCB_TAG_SIZE;
+
+    /* Encrypt the contiguous buffers and append the tag */
+    aead_iovec_set(&cvec, c, mlen);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    aead_iovec_start(&ccur, &cvec, 1);
+    aead_iovec_start(&mcur, &mvec, 1);
+    aead_iovec_start(&adcur, &advec, 1);
+    OCB_CONCAT(OCB_ALG_NAME,_encrypt_core)
+        ((const OCB_STATE *)ctx, &ccur, &mcur, mlen, &adcur, adlen, npub, tag);
+    memcpy(c + mlen, tag, OCB_TAG_SIZE);
+    return 0;
+}
+
+static int OCB_CONCAT(OCB_ALG_NAME,_aead_decrypt_ctx)
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned char tag[OCB_BLOCK_SIZE];
+    (void)nsec;
+
+    /* Validate the ciphertext length and set the return "mlen" value */
+    if (clen < OCB_TAG_SIZE)
+        return -1;
+    *mlen = clen - OCB_TAG_SIZE;
+
+    /* Decrypt the contiguous buffers and check the tag */
+    aead_iovec_set(&cvec, c, *mlen);
+    aead_iovec_set(&mvec, m, *mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    aead_iovec_start(&ccur, &cvec, 1);
+    aead_iovec_start(&mcur, &mvec, 1);
+    aead_iovec_start(&adcur, &advec, 1);
+    OCB_CONCAT(OCB_ALG_NAME,_decrypt_core)
+        ((const OCB_STATE *)ctx, &mcur, &ccur, *mlen, &adcur, adlen,
+         npub, tag);
+    return aead_check_tag(m, *mlen, tag, c + *mlen, OCB_TAG_SIZE);
+}
+
+int OCB_CONCAT(OCB_ALG_NAME,_aead_encrypt)
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    OCB_STATE state;
+    OCB_CONCAT(OCB_ALG_NAME,_aead_setup_key)(&state, k);
+    return OCB_CONCAT(OCB_ALG_NAME,_aead_encrypt_ctx)
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &state);
+}
+
+int OCB_CONCAT(OCB_ALG_NAME,_aead_decrypt)
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    OCB_STATE state;
+    OCB_CONCAT(OCB_ALG_NAME,_aead_setup_key)(&state, k);
+    return OCB_CONCAT(OCB_ALG_NAME,_aead_decrypt_ctx)
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &state);
+}
+
+int OCB_CONCAT(OCB_ALG_NAME,_aead_encrypt_vec)
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    OCB_STATE state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned char tag[OCB_BLOCK_SIZE];
+    (void)nsec;
+
+    /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + OCB_TAG_SIZE))
+        return -2;
+    *clen = mlen + OCB_TAG_SIZE;
+
+    /* Encrypt the segments and write the tag after the ciphertext */
+    OCB_CONCAT(OCB_ALG_NAME,_aead_setup_key)(&state, k);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
+    OCB_CONCAT(OCB_ALG_NAME,_encrypt_core)
+        (&state, &ccur, &mcur, mlen, &adcur,
+         aead_iovec_length(ad, ad_count), npub, tag);
+    aead_iovec_write(&ccur, tag, OCB_TAG_SIZE);
+    return 0;
+}
+
+int OCB_CONCAT(OCB_ALG_NAME,_aead_decrypt_vec)
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    OCB_STATE state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned char tag[OCB_BLOCK_SIZE];
+    unsigned char received[OCB_TAG_SIZE];
+    (void)nsec;
+
+    /* Validate the ciphertext length and set the return "mlen" value */
+    if (clen < OCB_TAG_SIZE)
+        return -1;
+    *mlen = clen - OCB_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+
+    /* Decrypt the segments and check the tag that follows the ciphertext */
+    OCB_CONCAT(OCB_ALG_NAME,_aead_setup_key)(&state, k);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
+    OCB_CONCAT(OCB_ALG_NAME,_decrypt_core)
+        (&state, &mcur, &ccur, *mlen, &adcur,
+         aead_iovec_length(ad, ad_count), npub, tag);
+    aead_iovec_read(&ccur, received, OCB_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, tag, received, OCB_TAG_SIZE);
 }
 
 #endif /* OCB_ENCRYPT_BLOCK */
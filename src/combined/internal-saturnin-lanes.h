@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/* We expect a number of macros to be defined before this file
+ * is included to configure the kernel for a specific vector type.
+ *
+ * SATURNIN_LANES_NAME    Suffix for the kernel names; e.g. _avx2
+ * SATURNIN_LANES_TARGET  Target attribute for the kernels, may be empty.
+ * SATURNIN_LANES_TYPE    Type of a vector of 32-bit words; e.g. __m256i
+ * SATURNIN_LANES_WIDTH   Number of 32-bit words in a vector.
+ * SATURNIN_LANES_LOAD    Loads a vector from a pointer to 32-bit words.
+ * SATURNIN_LANES_STORE   Stores a vector to a pointer to 32-bit words.
+ * SATURNIN_LANES_XOR     XOR's two vectors.
+ * SATURNIN_LANES_AND     AND's two vectors.
+ * SATURNIN_LANES_OR      OR's two vectors.
+ * SATURNIN_LANES_SHL     Shifts the words of a vector left by a constant.
+ * SATURNIN_LANES_SHR     Shifts the words of a vector right by a constant.
+ * SATURNIN_LANES_SWAP    Swaps the 16-bit halves of the words of a vector.
+ * SATURNIN_LANES_SET1    Broadcasts a 32-bit value to all words.
+ *
+ * Each lane of a vector holds the same bit-sliced word of a different
+ * block, so the kernels run the Saturnin rounds on many blocks at once.
+ * The rounds are the same as in saturnin_encrypt_block(), with each
+ * operation on a 32-bit word replaced by the same operation on a vector.
+ */
+#if defined(SATURNIN_LANES_NAME)
+
+#define SATURNIN_LANES_CONCAT_INNER(name,suffix) name##suffix
+#define SATURNIN_LANES_CONCAT(name,suffix) \
+    SATURNIN_LANES_CONCAT_INNER(name,suffix)
+
+/* Vector versions of the operations on the bit-sliced state */
+#define SATURNIN_LANES_MASK(a, mask) \
+    (SATURNIN_LANES_AND((a), SATURNIN_LANES_SET1((mask))))
+#define SATURNIN_LANES_ROTATE_N(a, mask1, bits1, mask2, bits2, size) \
+    do { \
+        (a) = SATURNIN_LANES_OR \
+            (SATURNIN_LANES_OR \
+                (SATURNIN_LANES_SHL \
+                    (SATURNIN_LANES_MASK((a), (mask1)), (bits1)), \
+                 SATURNIN_LANES_SHR \
+                    (SATURNIN_LANES_MASK((a), (mask1) ^ 0xFFFFU), \
+                     (size) - (bits1))), \
+             SATURNIN_LANES_OR \
+                (SATURNIN_LANES_SHL \
+                    (SATURNIN_LANES_MASK((a), (mask2) << 16), (bits2)), \
+                 SATURNIN_LANES_SHR \
+                    (SATURNIN_LANES_MASK \
+                        ((a), ((mask2) << 16) ^ 0xFFFF0000U), \
+                     (size) - (bits2)))); \
+    } while (0)
+#define SATURNIN_LANES_ROTATE_HIGH(a, mask2, bits2, size) \
+    do { \
+        (a) = SATURNIN_LANES_OR \
+            (SATURNIN_LANES_MASK((a), 0x0000FFFFU), \
+             SATURNIN_LANES_OR \
+                (SATURNIN_LANES_SHL \
+                    (SATURNIN_LANES_MASK((a), (mask2) << 16), (bits2)), \
+                 SATURNIN_LANES_SHR \
+                    (SATURNIN_LANES_MASK \
+                        ((a), ((mask2) << 16) ^ 0xFFFF0000U), \
+                     (size) - (bits2)))); \
+    } while (0)
+#define SATURNIN_LANES_XOR_KEY(x0, x1, x2, x3, x4, x5, x6, x7, offset) \
+    do { \
+        x0 = SATURNIN_LANES_XOR(x0, SATURNIN_LANES_SET1(k[(offset)])); \
+        x1 = SATURNIN_LANES_XOR(x1, SATURNIN_LANES_SET1(k[(offset) + 1])); \
+        x2 = SATURNIN_LANES_XOR(x2, SATURNIN_LANES_SET1(k[(offset) + 2])); \
+        x3 = SATURNIN_LANES_XOR(x3, SATURNIN_LANES_SET1(k[(offset) + 3])); \
+        x4 = SATURNIN_LANES_XOR(x4, SATURNIN_LANES_SET1(k[(offset) + 4])); \
+        x5 = SATURNIN_LANES_XOR(x5, SATURNIN_LANES_SET1(k[(offset) + 5])); \
+        x6 = SATURNIN_LANES_XOR(x6, SATURNIN_LANES_SET1(k[(offset) + 6])); \
+        x7 = SATURNIN_LANES_XOR(x7, SATURNIN_LANES_SET1(k[(offset) + 7])); \
+    } while (0)
+#define SATURNIN_LANES_SBOX(a, b, c, d) \
+    do { \
+        (a) = SATURNIN_LANES_XOR((a), SATURNIN_LANES_AND((b), (c))); \
+        (b) = SATURNIN_LANES_XOR((b), SATURNIN_LANES_OR((a), (d))); \
+        (d) = SATURNIN_LANES_XOR((d), SATURNIN_LANES_OR((b), (c))); \
+        (c) = SATURNIN_LANES_XOR((c), SATURNIN_LANES_AND((b), (d))); \
+        (b) = SATURNIN_LANES_XOR((b), SATURNIN_LANES_OR((a), (c))); \
+        (a) = SATURNIN_LANES_XOR((a), SATURNIN_LANES_OR((b), (d))); \
+    } while (0)
+#define SATURNIN_LANES_MUL(x0, x1, x2, x3) \
+    do { \
+        temp = x0; x0 = x1; x1 = x2; x2 = x3; \
+        x3 = SATURNIN_LANES_XOR(temp, x0); \
+    } while (0)
+#define SATURNIN_LANES_MDS(x0, x1, x2, x3, x4, x5, x6, x7) \
+    do { \
+        x0 = SATURNIN_LANES_XOR(x0, x4); x1 = SATURNIN_LANES_XOR(x1, x5); \
+        x2 = SATURNIN_LANES_XOR(x2, x6); x3 = SATURNIN_LANES_XOR(x3, x7); \
+        SATURNIN_LANES_MUL(x4, x5, x6, x7); \
+        x4 = SATURNIN_LANES_XOR(x4, SATURNIN_LANES_SWAP(x0)); \
+        x5 = SATURNIN_LANES_XOR(x5, SATURNIN_LANES_SWAP(x1)); \
+        x6 = SATURNIN_LANES_XOR(x6, SATURNIN_LANES_SWAP(x2)); \
+        x7 = SATURNIN_LANES_XOR(x7, SATURNIN_LANES_SWAP(x3)); \
+        SATURNIN_LANES_MUL(x0, x1, x2, x3); \
+        SATURNIN_LANES_MUL(x0, x1, x2, x3); \
+        x0 = SATURNIN_LANES_XOR(x0, x4); x1 = SATURNIN_LANES_XOR(x1, x5); \
+        x2 = SATURNIN_LANES_XOR(x2, x6); x3 = SATURNIN_LANES_XOR(x3, x7); \
+        x4 = SATURNIN_LANES_XOR(x4, SATURNIN_LANES_SWAP(x0)); \
+        x5 = SATURNIN_LANES_XOR(x5, SATURNIN_LANES_SWAP(x1)); \
+        x6 = SATURNIN_LANES_XOR(x6, SATURNIN_LANES_SWAP(x2)); \
+        x7 = SATURNIN_LANES_XOR(x7, SATURNIN_LANES_SWAP(x3)); \
+    } while (0)
+#define SATURNIN_LANES_SLICE(x0, x1, x2, x3, x4, x5, x6, x7) \
+    do { \
+        SATURNIN_LANES_ROTATE_HIGH(x0, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_HIGH(x1, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_HIGH(x2, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_HIGH(x3, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_N(x4, 0x7777U, 1, 0x1111U, 3, 4); \
+        SATURNIN_LANES_ROTATE_N(x5, 0x7777U, 1, 0x1111U, 3, 4); \
+        SATURNIN_LANES_ROTATE_N(x6, 0x7777U, 1, 0x1111U, 3, 4); \
+        SATURNIN_LANES_ROTATE_N(x7, 0x7777U, 1, 0x1111U, 3, 4); \
+    } while (0)
+#define SATURNIN_LANES_SLICE_INVERSE(x0, x1, x2, x3, x4, x5, x6, x7) \
+    do { \
+        SATURNIN_LANES_ROTATE_HIGH(x0, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_HIGH(x1, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_HIGH(x2, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_HIGH(x3, 0x3333U, 2, 4); \
+        SATURNIN_LANES_ROTATE_N(x4, 0x1111U, 3, 0x7777U, 1, 4); \
+        SATURNIN_LANES_ROTATE_N(x5, 0x1111U, 3, 0x7777U, 1, 4); \
+        SATURNIN_LANES_ROTATE_N(x6, 0x1111U, 3, 0x7777U, 1, 4); \
+        SATURNIN_LANES_ROTATE_N(x7, 0x1111U, 3, 0x7777U, 1, 4); \
+    } while (0)
+#define SATURNIN_LANES_SHEET(x0, x1, x2, x3, x4, x5, x6, x7) \
+    do { \
+        SATURNIN_LANES_ROTATE_HIGH(x0, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_HIGH(x1, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_HIGH(x2, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_HIGH(x3, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_N(x4, 0x0FFFU, 4, 0x000FU, 12, 16); \
+        SATURNIN_LANES_ROTATE_N(x5, 0x0FFFU, 4, 0x000FU, 12, 16); \
+        SATURNIN_LANES_ROTATE_N(x6, 0x0FFFU, 4, 0x000FU, 12, 16); \
+        SATURNIN_LANES_ROTATE_N(x7, 0x0FFFU, 4, 0x000FU, 12, 16); \
+    } while (0)
+#define SATURNIN_LANES_SHEET_INVERSE(x0, x1, x2, x3, x4, x5, x6, x7) \
+    do { \
+        SATURNIN_LANES_ROTATE_HIGH(x0, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_HIGH(x1, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_HIGH(x2, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_HIGH(x3, 0x00FFU, 8, 16); \
+        SATURNIN_LANES_ROTATE_N(x4, 0x000FU, 12, 0x0FFFU, 4, 16); \
+        SATURNIN_LANES_ROTATE_N(x5, 0x000FU, 12, 0x0FFFU, 4, 16); \
+        SATURNIN_LANES_ROTATE_N(x6, 0x000FU, 12, 0x0FFFU, 4, 16); \
+        SATURNIN_LANES_ROTATE_N(x7, 0x000FU, 12, 0x0FFFU, 4, 16); \
+    } while (0)
+
+/**
+ * \brief Encrypts interleaved blocks with Saturnin.
+ *
+ * \param k Points to the words of the Saturnin key schedule.
+ * \param rc Points to the round constants for the domain.
+ * \param rounds Number of double rounds; 5 or 8.
+ * \param S Points to word 0 of lane 0 of the interleaved blocks.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive words of the same lane.  Must be a multiple of the width.
+ */
+SATURNIN_LANES_TARGET static void SATURNIN_LANES_CONCAT
+    (saturnin_encrypt_lanes, SATURNIN_LANES_NAME)
+    (const uint32_t *k, const uint32_t *rc, unsigned rounds,
+     uint32_t *S, unsigned lanes)
+{
+    SATURNIN_LANES_TYPE x0, x1, x2, x3, x4, x5, x6, x7, temp;
+    const uint32_t *rcp;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += SATURNIN_LANES_WIDTH) {
+        x0 = SATURNIN_LANES_LOAD(S + group);
+        x1 = SATURNIN_LANES_LOAD(S + lanes + group);
+        x2 = SATURNIN_LANES_LOAD(S + lanes * 2 + group);
+        x3 = SATURNIN_LANES_LOAD(S + lanes * 3 + group);
+        x4 = SATURNIN_LANES_LOAD(S + lanes * 4 + group);
+        x5 = SATURNIN_LANES_LOAD(S + lanes * 5 + group);
+        x6 = SATURNIN_LANES_LOAD(S + lanes * 6 + group);
+        x7 = SATURNIN_LANES_LOAD(S + lanes * 7 + group);
+
+        /* XOR the key into the state */
+        SATURNIN_LANES_XOR_KEY(x0, x1, x2, x3, x4, x5, x6, x7, 0);
+
+        /* Perform all encryption rounds, two at a time */
+        rcp = rc;
+        for (round = 0; round < rounds; ++round, rcp += 2) {
+            /* Even rounds */
+            SATURNIN_LANES_SBOX(x0, x1, x2, x3);
+            SATURNIN_LANES_SBOX(x4, x5, x6, x7);
+            SATURNIN_LANES_MDS(x1, x2, x3, x0, x7, x5, x4, x6);
+            SATURNIN_LANES_SBOX(x1, x2, x3, x0);
+            SATURNIN_LANES_SBOX(x7, x5, x4, x6);
+            SATURNIN_LANES_SLICE(x2, x3, x0, x1, x6, x5, x7, x4);
+            SATURNIN_LANES_MDS(x2, x3, x0, x1, x6, x5, x7, x4);
+            SATURNIN_LANES_SLICE_INVERSE(x2, x3, x0, x1, x6, x5, x7, x4);
+            x2 = SATURNIN_LANES_XOR(x2, SATURNIN_LANES_SET1(rcp[0]));
+            SATURNIN_LANES_XOR_KEY(x2, x3, x0, x1, x6, x5, x7, x4, 8);
+
+            /* Odd rounds */
+            SATURNIN_LANES_SBOX(x2, x3, x0, x1);
+            SATURNIN_LANES_SBOX(x6, x5, x7, x4);
+            SATURNIN_LANES_MDS(x3, x0, x1, x2, x4, x5, x6, x7);
+            SATURNIN_LANES_SBOX(x3, x0, x1, x2);
+            SATURNIN_LANES_SBOX(x4, x5, x6, x7);
+            SATURNIN_LANES_SHEET(x0, x1, x2, x3, x7, x5, x4, x6);
+            SATURNIN_LANES_MDS(x0, x1, x2, x3, x7, x5, x4, x6);
+            SATURNIN_LANES_SHEET_INVERSE(x0, x1, x2, x3, x7, x5, x4, x6);
+            x0 = SATURNIN_LANES_XOR(x0, SATURNIN_LANES_SET1(rcp[1]));
+            SATURNIN_LANES_XOR_KEY(x0, x1, x2, x3, x7, x5, x4, x6, 0);
+
+            /* Correct the rotation of the second half */
+            temp = x4;
+            x4 = x7;
+            x7 = x6;
+            x6 = temp;
+        }
+
+        SATURNIN_LANES_STORE(S + group, x0);
+        SATURNIN_LANES_STORE(S + lanes + group, x1);
+        SATURNIN_LANES_STORE(S + lanes * 2 + group, x2);
+        SATURNIN_LANES_STORE(S + lanes * 3 + group, x3);
+        SATURNIN_LANES_STORE(S + lanes * 4 + group, x4);
+        SATURNIN_LANES_STORE(S + lanes * 5 + group, x5);
+        SATURNIN_LANES_STORE(S + lanes * 6 + group, x6);
+        SATURNIN_LANES_STORE(S + lanes * 7 + group, x7);
+    }
+}
+
+#endif /* SATURNIN_LANES_NAME */
+
+/* Now undefine everything so that we can include this file again for
+ * another vector type */
+#undef SATURNIN_LANES_NAME
+#undef SATURNIN_LANES_TARGET
+#undef SATURNIN_LANES_TYPE
+#undef SATURNIN_LANES_WIDTH
+#undef SATURNIN_LANES_LOAD
+#undef SATURNIN_LANES_STORE
+#undef SATURNIN_LANES_XOR
+#undef SATURNIN_LANES_AND
+#undef SATURNIN_LANES_OR
+#undef SATURNIN_LANES_SHL
+#undef SATURNIN_LANES_SHR
+#undef SATURNIN_LANES_SWAP
+#undef SATURNIN_LANES_SET1
+#undef SATURNIN_LANES_CONCAT_INNER
+#undef SATURNIN_LANES_CONCAT
+#undef SATURNIN_LANES_MASK
+#undef SATURNIN_LANES_ROTATE_N
+#undef SATURNIN_LANES_ROTATE_HIGH
+#undef SATURNIN_LANES_XOR_KEY
+#undef SATURNIN_LANES_SBOX
+#undef SATURNIN_LANES_MUL
+#undef SATURNIN_LANES_MDS
+#undef SATURNIN_LANES_SLICE
+#undef SATURNIN_LANES_SLICE_INVERSE
+#undef SATURNIN_LANES_SHEET
+#undef SATURNIN_LANES_SHEET_INVERSE
@@ -47,6 +47,8 @@ void simp_256_permute(unsigned char state[SIMP_256_STATE_SIZE], unsigned steps)
     uint64_t x0, x1, x2, x3, t0, t1;
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SIMP_PERMUTE);
+
     /* Load the state into local variables */
     x0 = be_load_word64(state);
     x1 = be_load_word64(state + 8);
@@ -123,6 +125,8 @@ void simp_192_permute(unsigned char state[SIMP_192_STATE_SIZE], unsigned steps)
     uint64_t x0, x1, x2, x3, t0, t1;
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SIMP_PERMUTE);
+
     /* Load the state into local variables */
     x0 = be_load_word48(state);
     x1 = be_load_word48(state + 6);
@@ -31,6 +31,7 @@
  * https://sites.google.com/site/skinnycipher/
  */
 
+#include "internal-cpu.h"
 #include <stddef.h>
 #include <stdint.h>
 
@@ -41,12 +42,18 @@ extern "C" {
 /**
  * \def SKINNY_128_SMALL_SCHEDULE
  * \brief Defined to 1 to use the small key schedule version of SKINNY-128.
+ *
+ * This selects the default.  The other version is also built into the
+ * library so that key contexts can select it at runtime with
+ * skinny_128_get_variant().
  */
+#if !defined(SKINNY_128_SMALL_SCHEDULE)
 #if defined(__AVR__)
 #define SKINNY_128_SMALL_SCHEDULE 1
 #else
 #define SKINNY_128_SMALL_SCHEDULE 0
 #endif
+#endif
 
 /**
  * \brief Size of a block for SKINNY-128 block ciphers.
@@ -158,6 +165,62 @@ void skinny_128_384_encrypt_tk_full
     (const unsigned char key[48], unsigned char *output,
      const unsigned char *input);
 
+/**
+ * \brief Maximum number of blocks that skinny_128_384_encrypt_tk1_blocks()
+ * and skinny_128_384_decrypt_tk1_blocks() process in one pass.
+ *
+ * Callers can pass any number of blocks, but passing a multiple of this
+ * value keeps all vector lanes busy.  On AVR and on other targets without
+ * vector kernels this is 1 so that callers do not reserve stack space for
+ * blocks that would be encrypted one at a time anyway.
+ */
+#if defined(__AVR__) || !defined(LW_CPU_HAVE_SSE2)
+#define SKINNY_128_384_BLOCKS_MAX 1
+#else
+#define SKINNY_128_384_BLOCKS_MAX 16
+#endif
+
+/**
+ * \brief Encrypts several 128-bit blocks with SKINNY-128-384, each with
+ * its own TK1 value.
+ *
+ * \param ks Points to the SKINNY-128-384 key schedule.  The TK1 field
+ * of the key schedule is ignored.
+ * \param output Output buffer which must be at least 16 * count bytes.
+ * \param input Input buffer which must be at least 16 * count bytes.
+ * \param tk1 Points to 16 * count bytes of TK1 values, one per block.
+ * \param count Number of blocks to encrypt.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place encryption.
+ *
+ * The blocks are encrypted in parallel with the widest vector
+ * instructions that the CPU supports.  This is useful for modes like
+ * SKINNY-AEAD where every block has a different tweak but the rest of
+ * the tweakey is fixed.
+ */
+void skinny_128_384_encrypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count);
+
+/**
+ * \brief Decrypts several 128-bit blocks with SKINNY-128-384, each with
+ * its own TK1 value.
+ *
+ * \param ks Points to the SKINNY-128-384 key schedule.  The TK1 field
+ * of the key schedule is ignored.
+ * \param output Output buffer which must be at least 16 * count bytes.
+ * \param input Input buffer which must be at least 16 * count bytes.
+ * \param tk1 Points to 16 * count bytes of TK1 values, one per block.
+ * \param count Number of blocks to decrypt.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place decryption.
+ */
+void skinny_128_384_decrypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count);
+
 /**
  * \brief Number of rounds for SKINNY-128-256.
  */
@@ -237,6 +300,239 @@ void skinny_128_256_encrypt_tk_full
     (const unsigned char key[32], unsigned char *output,
      const unsigned char *input);
 
+/**
+ * \brief Selects the full key schedule for SKINNY-128, where all round
+ * keys are expanded ahead of time.
+ */
+#define SKINNY_128_SCHEDULE_FULL 0
+
+/**
+ * \brief Selects the small key schedule for SKINNY-128, where the round
+ * keys are expanded on the fly during encryption and decryption.
+ */
+#define SKINNY_128_SCHEDULE_SMALL 1
+
+/**
+ * \brief Entry points for a key schedule variant of SKINNY-128 that can
+ * be selected at runtime.
+ *
+ * The key schedule arguments point to the skinny_128_384_key_schedule_t
+ * or skinny_128_256_key_schedule_t structure for the variant.
+ */
+typedef struct
+{
+    /** SKINNY_128_SCHEDULE_FULL or SKINNY_128_SCHEDULE_SMALL */
+    int schedule;
+
+    /** Size of the SKINNY-128-384 key schedule for the variant in bytes */
+    unsigned schedule_size_384;
+
+    /** Size of the SKINNY-128-256 key schedule for the variant in bytes */
+    unsigned schedule_size_256;
+
+    /** Initializes the key schedule for SKINNY-128-384 */
+    void (*init_384)(void *ks, const unsigned char key[48]);
+
+    /** Encrypts a block with SKINNY-128-384 */
+    void (*encrypt_384)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+    /** Decrypts a block with SKINNY-128-384 */
+    void (*decrypt_384)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+    /** Encrypts a block with SKINNY-128-384 and an explicit TK2 value */
+    void (*encrypt_tk2_384)
+        (void *ks, unsigned char *output, const unsigned char *input,
+         const unsigned char *tk2);
+
+    /** Initializes the key schedule for SKINNY-128-256 */
+    void (*init_256)(void *ks, const unsigned char key[32]);
+
+    /** Encrypts a block with SKINNY-128-256 */
+    void (*encrypt_256)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+    /** Decrypts a block with SKINNY-128-256 */
+    void (*decrypt_256)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+} skinny_128_variant_t;
+
+/**
+ * \brief Key schedule for SKINNY-128-384 whose variant is chosen at runtime.
+ *
+ * Only the first skinny_128_384_variant_schedule_size() bytes of the
+ * structure are used, so key contexts for the small variant can be
+ * allocated with less memory than the full structure.
+ */
+typedef struct
+{
+    /** Variant that was used to set up the key schedule */
+    const skinny_128_variant_t *variant;
+
+    /** Key schedule for the variant, which always starts with TK1 */
+    union
+    {
+        uint8_t TK1[16];    /**< TK1 for the tweakable part of the schedule */
+        uint32_t k[4 + SKINNY_128_384_ROUNDS * 2]; /**< Full key schedule */
+    } s;
+
+} skinny_128_384_variant_key_schedule_t;
+
+/**
+ * \brief Key schedule for SKINNY-128-256 whose variant is chosen at runtime.
+ *
+ * Only the first skinny_128_256_variant_schedule_size() bytes of the
+ * structure are used, so key contexts for the small variant can be
+ * allocated with less memory than the full structure.
+ */
+typedef struct
+{
+    /** Variant that was used to set up the key schedule */
+    const skinny_128_variant_t *variant;
+
+    /** Key schedule for the variant, which always starts with TK1 */
+    union
+    {
+        uint8_t TK1[16];    /**< TK1 for the tweakable part of the schedule */
+        uint32_t k[4 + SKINNY_128_256_ROUNDS * 2]; /**< Full key schedule */
+    } s;
+
+} skinny_128_256_variant_key_schedule_t;
+
+/**
+ * \brief Maps an AEAD key schedule selector to a key schedule variant
+ * of SKINNY-128.
+ *
+ * \param schedule AEAD_SCHEDULE_DEFAULT, AEAD_SCHEDULE_FULL,
+ * AEAD_SCHEDULE_SMALL, or AEAD_SCHEDULE_TINY.
+ *
+ * \return SKINNY_128_SCHEDULE_FULL or SKINNY_128_SCHEDULE_SMALL.
+ * There is no tiny variant, so AEAD_SCHEDULE_TINY selects the small one.
+ */
+int skinny_128_variant_for_schedule(unsigned schedule);
+
+/**
+ * \brief Gets the entry points for a key schedule variant of SKINNY-128.
+ *
+ * \param schedule SKINNY_128_SCHEDULE_FULL or SKINNY_128_SCHEDULE_SMALL.
+ *
+ * \return The entry points for the variant.  If the variant is not
+ * available on this platform, then the default variant is returned.
+ *
+ * Platforms with an assembly code version of SKINNY-128 only have the
+ * default variant.
+ */
+const skinny_128_variant_t *skinny_128_get_variant(int schedule);
+
+/**
+ * \brief Gets the number of bytes of a skinny_128_384_variant_key_schedule_t
+ * structure that are used by a specific variant.
+ *
+ * \param schedule SKINNY_128_SCHEDULE_FULL or SKINNY_128_SCHEDULE_SMALL.
+ *
+ * \return The size of the key schedule for the variant.
+ */
+size_t skinny_128_384_variant_schedule_size(int schedule);
+
+/**
+ * \brief Initializes a runtime-selected key schedule for SKINNY-128-384.
+ *
+ * \param ks Points to the key schedule to initialize, which must be at
+ * least skinny_128_384_variant_schedule_size() bytes in size.
+ * \param key Points to the key data.
+ * \param schedule Variant of the key schedule to use.
+ */
+void skinny_128_384_variant_init
+    (skinny_128_384_variant_key_schedule_t *ks, const unsigned char key[48],
+     int schedule);
+
+/**
+ * \brief Encrypts a 128-bit block with a runtime-selected variant of
+ * SKINNY-128-384.
+ *
+ * \param ks Points to the key schedule from skinny_128_384_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void skinny_128_384_variant_encrypt
+    (const skinny_128_384_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+/**
+ * \brief Decrypts a 128-bit block with a runtime-selected variant of
+ * SKINNY-128-384.
+ *
+ * \param ks Points to the key schedule from skinny_128_384_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void skinny_128_384_variant_decrypt
+    (const skinny_128_384_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+/**
+ * \brief Encrypts a 128-bit block with a runtime-selected variant of
+ * SKINNY-128-384 and an explicitly provided TK2 value.
+ *
+ * \param ks Points to the key schedule from skinny_128_384_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ * \param tk2 TK2 value that should be updated on the fly.
+ *
+ * \sa skinny_128_384_encrypt_tk2()
+ */
+void skinny_128_384_variant_encrypt_tk2
+    (skinny_128_384_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk2);
+
+/**
+ * \brief Gets the number of bytes of a skinny_128_256_variant_key_schedule_t
+ * structure that are used by a specific variant.
+ *
+ * \param schedule SKINNY_128_SCHEDULE_FULL or SKINNY_128_SCHEDULE_SMALL.
+ *
+ * \return The size of the key schedule for the variant.
+ */
+size_t skinny_128_256_variant_schedule_size(int schedule);
+
+/**
+ * \brief Initializes a runtime-selected key schedule for SKINNY-128-256.
+ *
+ * \param ks Points to the key schedule to initialize, which must be at
+ * least skinny_128_256_variant_schedule_size() bytes in size.
+ * \param key Points to the key data.
+ * \param schedule Variant of the key schedule to use.
+ */
+void skinny_128_256_variant_init
+    (skinny_128_256_variant_key_schedule_t *ks, const unsigned char key[32],
+     int schedule);
+
+/**
+ * \brief Encrypts a 128-bit block with a runtime-selected variant of
+ * SKINNY-128-256.
+ *
+ * \param ks Points to the key schedule from skinny_128_256_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void skinny_128_256_variant_encrypt
+    (const skinny_128_256_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+/**
+ * \brief Decrypts a 128-bit block with a runtime-selected variant of
+ * SKINNY-128-256.
+ *
+ * \param ks Points to the key schedule from skinny_128_256_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void skinny_128_256_variant_decrypt
+    (const skinny_128_256_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
 #ifdef __cplusplus
 }
 #endif
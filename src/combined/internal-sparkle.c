@@ -71,6 +71,8 @@ void sparkle_256(uint32_t s[SPARKLE_256_STATE_SIZE], unsigned steps)
     uint32_t tx, ty;
     unsigned step;
 
+    aead_count_call(AEAD_PRIMITIVE_SPARKLE_PERMUTE);
+
     /* Load the SPARKLE-256 state up into local variables */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     x0 = s[0];
@@ -152,6 +154,8 @@ void sparkle_384(uint32_t s[SPARKLE_384_STATE_SIZE], unsigned steps)
     uint32_t tx, ty;
     unsigned step;
 
+    aead_count_call(AEAD_PRIMITIVE_SPARKLE_PERMUTE);
+
     /* Load the SPARKLE-384 state up into local variables */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     x0 = s[0];
@@ -257,6 +261,8 @@ void sparkle_512(uint32_t s[SPARKLE_512_STATE_SIZE], unsigned steps)
     uint32_t tx, ty;
     unsigned step;
 
+    aead_count_call(AEAD_PRIMITIVE_SPARKLE_PERMUTE);
+
     /* Load the SPARKLE-512 state up into local variables */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     x0 = s[0];
@@ -33,6 +33,8 @@ void speck64_128_encrypt
     uint32_t x, y;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_SPECK64_ENCRYPT);
+
     /* Unpack the key and the input block */
     s  = le_load_word32(key);
     l0 = le_load_word32(key + 4);
@@ -90,6 +90,8 @@ void spongent160_permute(spongent160_state_t *state)
     uint32_t t0, t1, t2, t3, t4;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_SPONGENT160_PERMUTE);
+
     /* Load the state into local variables and convert from little-endian */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     x0 = state->W[0];
@@ -232,6 +234,8 @@ void spongent176_permute(spongent176_state_t *state)
     uint32_t t0, t1, t2, t3, t4, t5;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_SPONGENT176_PERMUTE);
+
     /* Load the state into local variables and convert from little-endian */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     x0 = state->W[0];
@@ -36,6 +36,7 @@ void tiny_jambu_permutation
     uint32_t s1 = state[1];
     uint32_t s2 = state[2];
     uint32_t s3 = state[3];
+    aead_count_call(AEAD_PRIMITIVE_TINYJAMBU_PERMUTE);
 
     /* Perform all permutation rounds.  Each round consists of 128 steps,
      * which can be performed 32 at a time plus a rotation.  After four
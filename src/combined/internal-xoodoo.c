@@ -21,10 +21,12 @@
  */
 
 #include "internal-xoodoo.h"
+#include "internal-cpu.h"
 
 #if !defined(__AVR__)
 
-void xoodoo_permute(xoodoo_state_t *state)
+/* Portable body of the Xoodoo permutation, shared by all variants */
+static LW_CPU_INLINE void xoodoo_permute_c(xoodoo_state_t *state)
 {
     static uint16_t const rc[XOODOO_ROUNDS] = {
         0x0058, 0x0038, 0x03C0, 0x00D0, 0x0120, 0x0014,
@@ -36,6 +38,8 @@ void xoodoo_permute(xoodoo_state_t *state)
     uint32_t x20, x21, x22, x23;
     uint32_t t1, t2;
 
+    aead_count_call(AEAD_PRIMITIVE_XOODOO_PERMUTE);
+
     /* Load the state and convert from little-endian byte order */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     x00 = state->S[0][0];
@@ -163,4 +167,333 @@ void xoodoo_permute(xoodoo_state_t *state)
 #endif
 }
 
+#if defined(LW_CPU_DISPATCH)
+
+/* Xoodoo variant for CPUs with BMI1 and BMI2 */
+LW_CPU_TARGET("bmi,bmi2") static void xoodoo_permute_bmi2
+    (xoodoo_state_t *state)
+{
+    xoodoo_permute_c(state);
+}
+
+/* Xoodoo variant for the baseline instruction set */
+static void xoodoo_permute_default(xoodoo_state_t *state)
+{
+    xoodoo_permute_c(state);
+}
+
+/**
+ * \brief Variant of xoodoo_permute() that is bound for this CPU.
+ */
+static void (*xoodoo_permute_fn)(xoodoo_state_t *state) = 0;
+
+void xoodoo_permute(xoodoo_state_t *state)
+{
+    void (*fn)(xoodoo_state_t *state) = LW_CPU_LOAD(xoodoo_permute_fn);
+    if (!fn) {
+        if (lw_cpu_features() & LW_CPU_BMI2)
+            fn = xoodoo_permute_bmi2;
+        else
+            fn = xoodoo_permute_default;
+        LW_CPU_STORE(xoodoo_permute_fn, fn);
+    }
+    (*fn)(state);
+}
+
+#else /* !LW_CPU_DISPATCH */
+
+void xoodoo_permute(xoodoo_state_t *state)
+{
+    xoodoo_permute_c(state);
+}
+
+#endif /* !LW_CPU_DISPATCH */
+
 #endif /* !__AVR__ */
+
+/* Round constants for the multi-lane versions of the permutation */
+static uint16_t const xoodoo_lanes_rc[XOODOO_ROUNDS] = {
+    0x0058, 0x0038, 0x03C0, 0x00D0, 0x0120, 0x0014,
+    0x0060, 0x002C, 0x0380, 0x00F0, 0x01A0, 0x0012
+};
+
+/**
+ * \brief Performs a Xoodoo round on a state in 12 vector variables.
+ *
+ * \param vtype Type of the vector variables.
+ * \param x Array of 12 vectors, one per state word, row by row.
+ * \param rc Round constant.
+ * \param XOR Operation that XOR's two vectors.
+ * \param ANDNOT Operation that computes (~a & b) on two vectors.
+ * \param ROL Operation that rotates the words of a vector left.
+ * \param SET1 Operation that broadcasts a 32-bit constant to all words.
+ */
+#define xoodoo_lanes_round(vtype, x, rc, XOR, ANDNOT, ROL, SET1) \
+    do { \
+        vtype p0, p1, p2, p3, t1, t2; \
+        /* Step theta: Mix column parity */ \
+        p0 = XOR(XOR(x[0], x[4]), x[8]); \
+        p1 = XOR(XOR(x[1], x[5]), x[9]); \
+        p2 = XOR(XOR(x[2], x[6]), x[10]); \
+        p3 = XOR(XOR(x[3], x[7]), x[11]); \
+        p3 = XOR(ROL(p3, 5), ROL(p3, 14)); \
+        x[0] = XOR(x[0], p3); x[4] = XOR(x[4], p3); x[8] = XOR(x[8], p3); \
+        p0 = XOR(ROL(p0, 5), ROL(p0, 14)); \
+        x[1] = XOR(x[1], p0); x[5] = XOR(x[5], p0); x[9] = XOR(x[9], p0); \
+        p1 = XOR(ROL(p1, 5), ROL(p1, 14)); \
+        x[2] = XOR(x[2], p1); x[6] = XOR(x[6], p1); \
+        x[10] = XOR(x[10], p1); \
+        p2 = XOR(ROL(p2, 5), ROL(p2, 14)); \
+        x[3] = XOR(x[3], p2); x[7] = XOR(x[7], p2); \
+        x[11] = XOR(x[11], p2); \
+        /* Step rho-west: Plane shift */ \
+        t1 = x[7]; x[7] = x[6]; x[6] = x[5]; x[5] = x[4]; x[4] = t1; \
+        x[8] = ROL(x[8], 11); x[9] = ROL(x[9], 11); \
+        x[10] = ROL(x[10], 11); x[11] = ROL(x[11], 11); \
+        /* Step iota: Add the round constant to the state */ \
+        x[0] = XOR(x[0], SET1(rc)); \
+        /* Step chi: Non-linear layer */ \
+        x[0] = XOR(x[0], ANDNOT(x[4], x[8])); \
+        x[4] = XOR(x[4], ANDNOT(x[8], x[0])); \
+        x[8] = XOR(x[8], ANDNOT(x[0], x[4])); \
+        x[1] = XOR(x[1], ANDNOT(x[5], x[9])); \
+        x[5] = XOR(x[5], ANDNOT(x[9], x[1])); \
+        x[9] = XOR(x[9], ANDNOT(x[1], x[5])); \
+        x[2] = XOR(x[2], ANDNOT(x[6], x[10])); \
+        x[6] = XOR(x[6], ANDNOT(x[10], x[2])); \
+        x[10] = XOR(x[10], ANDNOT(x[2], x[6])); \
+        x[3] = XOR(x[3], ANDNOT(x[7], x[11])); \
+        x[7] = XOR(x[7], ANDNOT(x[11], x[3])); \
+        x[11] = XOR(x[11], ANDNOT(x[3], x[7])); \
+        /* Step rho-east: Plane shift */ \
+        x[4] = ROL(x[4], 1); x[5] = ROL(x[5], 1); \
+        x[6] = ROL(x[6], 1); x[7] = ROL(x[7], 1); \
+        t1 = ROL(x[10], 8); \
+        t2 = ROL(x[11], 8); \
+        x[10] = ROL(x[8], 8); \
+        x[11] = ROL(x[9], 8); \
+        x[8] = t1; \
+        x[9] = t2; \
+    } while (0)
+
+/* Scalar operations for the portable version */
+#define xoodoo_xor_c(a, b) ((a) ^ (b))
+#define xoodoo_andnot_c(a, b) ((~(a)) & (b))
+#define xoodoo_rol_c(a, bits) (leftRotate((a), (bits)))
+#define xoodoo_set1_c(value) ((uint32_t)(value))
+
+/**
+ * \brief Permutes interleaved Xoodoo states one lane at a time.
+ *
+ * \param S Points to word 0 of lane 0 of the interleaved states.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive words of the same lane.
+ */
+static void xoodoo_permute_lanes_c(uint32_t *S, unsigned lanes)
+{
+    uint32_t x[XOODOO_ROWS * XOODOO_COLS];
+    unsigned lane, index;
+    uint8_t round;
+    for (lane = 0; lane < lanes; ++lane) {
+        for (index = 0; index < 12; ++index)
+            x[index] = S[index * lanes + lane];
+        for (round = 0; round < XOODOO_ROUNDS; ++round) {
+            xoodoo_lanes_round
+                (uint32_t, x, xoodoo_lanes_rc[round], xoodoo_xor_c,
+                 xoodoo_andnot_c, xoodoo_rol_c, xoodoo_set1_c);
+        }
+        for (index = 0; index < 12; ++index)
+            S[index * lanes + lane] = x[index];
+    }
+}
+
+#if defined(LW_CPU_HAVE_SSE2)
+
+#include <emmintrin.h>
+
+#if defined(__AVX512VL__)
+#include <immintrin.h>
+#define xoodoo_rol_x4(a, bits) (_mm_rol_epi32((a), (bits)))
+#else
+#define xoodoo_rol_x4(a, bits) \
+    (_mm_or_si128(_mm_slli_epi32((a), (bits)), \
+                  _mm_srli_epi32((a), 32 - (bits))))
+#endif
+
+/**
+ * \brief Permutes interleaved Xoodoo states with SSE2, four lanes
+ * at a time.
+ *
+ * \param S Points to word 0 of lane 0 of the interleaved states.
+ * \param lanes Number of lanes, which must be a multiple of 4.
+ */
+LW_CPU_TARGET("sse2") static void xoodoo_permute_lanes_sse2
+    (uint32_t *S, unsigned lanes)
+{
+    __m128i x[XOODOO_ROWS * XOODOO_COLS];
+    unsigned group, index;
+    uint8_t round;
+    for (group = 0; group < lanes; group += 4) {
+        for (index = 0; index < 12; ++index) {
+            x[index] = _mm_loadu_si128
+                ((const __m128i *)(S + index * lanes + group));
+        }
+        for (round = 0; round < XOODOO_ROUNDS; ++round) {
+            xoodoo_lanes_round
+                (__m128i, x, xoodoo_lanes_rc[round], _mm_xor_si128,
+                 _mm_andnot_si128, xoodoo_rol_x4, _mm_set1_epi32);
+        }
+        for (index = 0; index < 12; ++index)
+            _mm_storeu_si128((__m128i *)(S + index * lanes + group), x[index]);
+    }
+}
+
+#endif /* LW_CPU_HAVE_SSE2 */
+
+#if defined(LW_CPU_HAVE_AVX2)
+
+#include <immintrin.h>
+
+#if defined(__AVX512VL__)
+#define xoodoo_rol_x8(a, bits) (_mm256_rol_epi32((a), (bits)))
+#else
+#define xoodoo_rol_x8(a, bits) \
+    (_mm256_or_si256(_mm256_slli_epi32((a), (bits)), \
+                     _mm256_srli_epi32((a), 32 - (bits))))
+#endif
+
+/**
+ * \brief Permutes interleaved Xoodoo states with AVX2, eight lanes
+ * at a time.
+ *
+ * \param S Points to word 0 of lane 0 of the interleaved states.
+ * \param lanes Number of lanes, which must be a multiple of 8.
+ */
+LW_CPU_TARGET("avx2") static void xoodoo_permute_lanes_avx2
+    (uint32_t *S, unsigned lanes)
+{
+    __m256i x[XOODOO_ROWS * XOODOO_COLS];
+    unsigned group, index;
+    uint8_t round;
+    for (group = 0; group < lanes; group += 8) {
+        for (index = 0; index < 12; ++index) {
+            x[index] = _mm256_loadu_si256
+                ((const __m256i *)(S + index * lanes + group));
+        }
+        for (round = 0; round < XOODOO_ROUNDS; ++round) {
+            xoodoo_lanes_round
+                (__m256i, x, xoodoo_lanes_rc[round], _mm256_xor_si256,
+                 _mm256_andnot_si256, xoodoo_rol_x8, _mm256_set1_epi32);
+        }
+        for (index = 0; index < 12; ++index) {
+            _mm256_storeu_si256
+                ((__m256i *)(S + index * lanes + group), x[index]);
+        }
+    }
+}
+
+#endif /* LW_CPU_HAVE_AVX2 */
+
+#if defined(LW_CPU_HAVE_AVX512F)
+
+/**
+ * \brief Permutes interleaved Xoodoo states with AVX-512, sixteen lanes
+ * at a time.
+ *
+ * \param S Points to word 0 of lane 0 of the interleaved states.
+ * \param lanes Number of lanes, which must be a multiple of 16.
+ */
+LW_CPU_TARGET("avx512f") static void xoodoo_permute_lanes_avx512
+    (uint32_t *S, unsigned lanes)
+{
+    __m512i x[XOODOO_ROWS * XOODOO_COLS];
+    unsigned group, index;
+    uint8_t round;
+    for (group = 0; group < lanes; group += 16) {
+        for (index = 0; index < 12; ++index)
+            x[index] = _mm512_loadu_si512(S + index * lanes + group);
+        for (round = 0; round < XOODOO_ROUNDS; ++round) {
+            xoodoo_lanes_round
+                (__m512i, x, xoodoo_lanes_rc[round], _mm512_xor_si512,
+                 _mm512_andnot_si512, _mm512_rol_epi32, _mm512_set1_epi32);
+        }
+        for (index = 0; index < 12; ++index)
+            _mm512_storeu_si512(S + index * lanes + group, x[index]);
+    }
+}
+
+#endif /* LW_CPU_HAVE_AVX512F */
+
+/**
+ * \brief Kernel for permuting interleaved Xoodoo states.
+ */
+typedef void (*xoodoo_lanes_kernel_t)(uint32_t *S, unsigned lanes);
+
+/**
+ * \brief Kernels that have been bound to the 4, 8, and 16 lane
+ * permutations for this CPU.
+ */
+static xoodoo_lanes_kernel_t xoodoo_x4_kernel = 0;
+static xoodoo_lanes_kernel_t xoodoo_x8_kernel = 0;
+static xoodoo_lanes_kernel_t xoodoo_x16_kernel = 0;
+
+/**
+ * \brief Selects the widest kernel for this CPU that fits a number
+ * of lanes.
+ *
+ * \param lanes Number of lanes; 4, 8, or 16.
+ *
+ * \return The kernel to use.
+ */
+static xoodoo_lanes_kernel_t xoodoo_lanes_select(unsigned lanes)
+{
+    unsigned features = lw_cpu_features();
+#if defined(LW_CPU_HAVE_AVX512F)
+    if (lanes >= 16 && (features & LW_CPU_AVX512F))
+        return xoodoo_permute_lanes_avx512;
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+    if (lanes >= 8 && (features & LW_CPU_AVX2))
+        return xoodoo_permute_lanes_avx2;
+#endif
+#if defined(LW_CPU_HAVE_SSE2)
+    if (features & LW_CPU_SSE2)
+        return xoodoo_permute_lanes_sse2;
+#endif
+    (void)lanes;
+    (void)features;
+    return xoodoo_permute_lanes_c;
+}
+
+void xoodoo_x4_permute(xoodoo_x4_state_t *state)
+{
+    xoodoo_lanes_kernel_t kernel = LW_CPU_LOAD(xoodoo_x4_kernel);
+    aead_count_calls(AEAD_PRIMITIVE_XOODOO_PERMUTE, 4);
+    if (!kernel) {
+        kernel = xoodoo_lanes_select(4);
+        LW_CPU_STORE(xoodoo_x4_kernel, kernel);
+    }
+    (*kernel)(state->S[0], 4);
+}
+
+void xoodoo_x8_permute(xoodoo_x8_state_t *state)
+{
+    xoodoo_lanes_kernel_t kernel = LW_CPU_LOAD(xoodoo_x8_kernel);
+    aead_count_calls(AEAD_PRIMITIVE_XOODOO_PERMUTE, 8);
+    if (!kernel) {
+        kernel = xoodoo_lanes_select(8);
+        LW_CPU_STORE(xoodoo_x8_kernel, kernel);
+    }
+    (*kernel)(state->S[0], 8);
+}
+
+void xoodoo_x16_permute(xoodoo_x16_state_t *state)
+{
+    xoodoo_lanes_kernel_t kernel = LW_CPU_LOAD(xoodoo_x16_kernel);
+    aead_count_calls(AEAD_PRIMITIVE_XOODOO_PERMUTE, 16);
+    if (!kernel) {
+        kernel = xoodoo_lanes_select(16);
+        LW_CPU_STORE(xoodoo_x16_kernel, kernel);
+    }
+    (*kernel)(state->S[0], 16);
+}
@@ -73,6 +73,67 @@ typedef union
  */
 void xoodoo_permute(xoodoo_state_t *state);
 
+/**
+ * \brief Four Xoodoo states that are interleaved for parallel permutation.
+ *
+ * Word i of lane j is stored in S[i][j] in host byte order, where word i
+ * is row i / 4 and column i % 4 of the equivalent xoodoo_state_t.
+ */
+typedef struct
+{
+    uint32_t S[XOODOO_ROWS * XOODOO_COLS][4]; /**< Words of the states */
+
+} xoodoo_x4_state_t;
+
+/**
+ * \brief Eight Xoodoo states that are interleaved for parallel permutation.
+ */
+typedef struct
+{
+    uint32_t S[XOODOO_ROWS * XOODOO_COLS][8]; /**< Words of the states */
+
+} xoodoo_x8_state_t;
+
+/**
+ * \brief Sixteen Xoodoo states that are interleaved for parallel
+ * permutation.
+ */
+typedef struct
+{
+    uint32_t S[XOODOO_ROWS * XOODOO_COLS][16]; /**< Words of the states */
+
+} xoodoo_x16_state_t;
+
+/**
+ * \brief Permutes four Xoodoo states in parallel.
+ *
+ * \param state The interleaved Xoodoo states.
+ *
+ * Uses SSE2 instructions if available, or a portable loop over the
+ * lanes otherwise.
+ */
+void xoodoo_x4_permute(xoodoo_x4_state_t *state);
+
+/**
+ * \brief Permutes eight Xoodoo states in parallel.
+ *
+ * \param state The interleaved Xoodoo states.
+ *
+ * Uses AVX2 instructions if available, or two groups of SSE2 lanes,
+ * or a portable loop over the lanes otherwise.
+ */
+void xoodoo_x8_permute(xoodoo_x8_state_t *state);
+
+/**
+ * \brief Permutes sixteen Xoodoo states in parallel.
+ *
+ * \param state The interleaved Xoodoo states.
+ *
+ * Uses AVX-512 instructions if available, or the widest smaller vectors
+ * that are available, or a portable loop over the lanes otherwise.
+ */
+void xoodoo_x16_permute(xoodoo_x16_state_t *state);
+
 #ifdef __cplusplus
 }
 #endif
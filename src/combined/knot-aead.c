@@ -22,6 +22,7 @@
 
 #include "knot.h"
 #include "internal-knot.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const knot_aead_128_256_cipher = {
@@ -31,7 +32,18 @@ aead_cipher_t const knot_aead_128_256_cipher = {
     KNOT_AEAD_128_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     knot_aead_128_256_encrypt,
-    knot_aead_128_256_decrypt
+    knot_aead_128_256_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    knot_aead_128_256_encrypt_vec,
+    knot_aead_128_256_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const knot_aead_128_384_cipher = {
@@ -41,7 +53,18 @@ aead_cipher_t const knot_aead_128_384_cipher = {
     KNOT_AEAD_128_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     knot_aead_128_384_encrypt,
-    knot_aead_128_384_decrypt
+    knot_aead_128_384_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    knot_aead_128_384_encrypt_vec,
+    knot_aead_128_384_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const knot_aead_192_384_cipher = {
@@ -51,7 +74,18 @@ aead_cipher_t const knot_aead_192_384_cipher = {
     KNOT_AEAD_192_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     knot_aead_192_384_encrypt,
-    knot_aead_192_384_decrypt
+    knot_aead_192_384_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    knot_aead_192_384_encrypt_vec,
+    knot_aead_192_384_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const knot_aead_256_512_cipher = {
@@ -61,7 +95,18 @@ aead_cipher_t const knot_aead_256_512_cipher = {
     KNOT_AEAD_256_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     knot_aead_256_512_encrypt,
-    knot_aead_256_512_decrypt
+    knot_aead_256_512_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    knot_aead_256_512_encrypt_vec,
+    knot_aead_256_512_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -84,6 +129,11 @@ aead_cipher_t const knot_aead_256_512_cipher = {
  */
 #define KNOT_AEAD_256_512_RATE 16
 
+/**
+ * \brief Maximum rate for all of the KNOT-AEAD variants.
+ */
+#define KNOT_AEAD_MAX_RATE KNOT_AEAD_128_384_RATE
+
 /**
  * \brief Absorbs the associated data into a KNOT permutation state.
  *
@@ -91,21 +141,24 @@ aead_cipher_t const knot_aead_256_512_cipher = {
  * \param permute Points to the function to perform the KNOT permutation.
  * \param rounds Number of rounds to perform.
  * \param rate Rate of absorption to use with the permutation.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data, must be at least 1.
  */
 static void knot_aead_absorb_ad
     (void *state, knot_permute_t permute, uint8_t rounds, unsigned rate,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[KNOT_AEAD_MAX_RATE];
+    const unsigned char *in;
     while (adlen >= rate) {
-        lw_xor_block((unsigned char *)state, ad, rate);
+        in = aead_iovec_load_block(ad, block, rate);
+        lw_xor_block((unsigned char *)state, in, rate);
         permute(state, rounds);
-        ad += rate;
         adlen -= rate;
     }
     rate = (unsigned)adlen;
-    lw_xor_block((unsigned char *)state, ad, rate);
+    in = aead_iovec_load_block(ad, block, rate);
+    lw_xor_block((unsigned char *)state, in, rate);
     ((unsigned char *)state)[rate] ^= 0x01;
     permute(state, rounds);
 }
@@ -117,23 +170,32 @@ static void knot_aead_absorb_ad
  * \param permute Points to the function to perform the KNOT permutation.
  * \param rounds Number of rounds to perform.
  * \param rate Rate of absorption to use with the permutation.
- * \param c Buffer to receive the ciphertext.
- * \param m Buffer containing the plaintext.
+ * \param c Cursor for the output ciphertext.
+ * \param m Cursor for the input plaintext.
  * \param len Length of the plaintext data, must be at least 1.
  */
 static void knot_aead_encrypt
     (void *state, knot_permute_t permute, uint8_t rounds, unsigned rate,
-     unsigned char *c, const unsigned char *m, unsigned long long len)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long len)
 {
+    unsigned char inbuf[KNOT_AEAD_MAX_RATE];
+    unsigned char outbuf[KNOT_AEAD_MAX_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     while (len >= rate) {
-        lw_xor_block_2_dest(c, (unsigned char *)state, m, rate);
+        in = aead_iovec_load_block(m, inbuf, rate);
+        out = aead_iovec_store_begin(c, outbuf, rate);
+        lw_xor_block_2_dest(out, (unsigned char *)state, in, rate);
+        aead_iovec_store_end(c, outbuf, out, rate);
         permute(state, rounds);
-        c += rate;
-        m += rate;
         len -= rate;
     }
     rate = (unsigned)len;
-    lw_xor_block_2_dest(c, (unsigned char *)state, m, rate);
+    in = aead_iovec_load_block(m, inbuf, rate);
+    out = aead_iovec_store_begin(c, outbuf, rate);
+    lw_xor_block_2_dest(out, (unsigned char *)state, in, rate);
+    aead_iovec_store_end(c, outbuf, out, rate);
     ((unsigned char *)state)[rate] ^= 0x01;
 }
 
@@ -144,39 +206,56 @@ static void knot_aead_encrypt
  * \param permute Points to the function to perform the KNOT permutation.
  * \param rounds Number of rounds to perform.
  * \param rate Rate of absorption to use with the permutation.
- * \param m Buffer to receive the plaintext.
- * \param c Buffer containing the ciphertext.
+ * \param m Cursor for the output plaintext.
+ * \param c Cursor for the input ciphertext.
  * \param len Length of the plaintext data, must be at least 1.
  */
 static void knot_aead_decrypt
     (void *state, knot_permute_t permute, uint8_t rounds, unsigned rate,
-     unsigned char *m, const unsigned char *c, unsigned long long len)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long len)
 {
+    unsigned char inbuf[KNOT_AEAD_MAX_RATE];
+    unsigned char outbuf[KNOT_AEAD_MAX_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     while (len >= rate) {
-        lw_xor_block_swap(m, (unsigned char *)state, c, rate);
+        in = aead_iovec_load_block(c, inbuf, rate);
+        out = aead_iovec_store_begin(m, outbuf, rate);
+        lw_xor_block_swap(out, (unsigned char *)state, in, rate);
+        aead_iovec_store_end(m, outbuf, out, rate);
         permute(state, rounds);
-        c += rate;
-        m += rate;
         len -= rate;
     }
     rate = (unsigned)len;
-    lw_xor_block_swap(m, (unsigned char *)state, c, rate);
+    in = aead_iovec_load_block(c, inbuf, rate);
+    out = aead_iovec_store_begin(m, outbuf, rate);
+    lw_xor_block_swap(out, (unsigned char *)state, in, rate);
+    aead_iovec_store_end(m, outbuf, out, rate);
     ((unsigned char *)state)[rate] ^= 0x01;
 }
 
-int knot_aead_128_256_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int knot_aead_128_256_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     knot256_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + KNOT_AEAD_128_TAG_SIZE))
+        return -2;
     *clen = mlen + KNOT_AEAD_128_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_128_NONCE_SIZE);
@@ -187,7 +266,7 @@ int knot_aead_128_256_encrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot256_permute_6,
-             28, KNOT_AEAD_128_256_RATE, ad, adlen);
+             28, KNOT_AEAD_128_256_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -195,30 +274,39 @@ int knot_aead_128_256_encrypt
     if (mlen > 0) {
         knot_aead_encrypt
             (&state, (knot_permute_t)knot256_permute_6,
-             28, KNOT_AEAD_128_256_RATE, c, m, mlen);
+             28, KNOT_AEAD_128_256_RATE, &ccur, &mcur, mlen);
     }
 
     /* Compute the authentication tag */
     knot256_permute_6(&state, 32);
-    memcpy(c + mlen, state.B, KNOT_AEAD_128_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, KNOT_AEAD_128_TAG_SIZE);
     return 0;
 }
 
-int knot_aead_128_256_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int knot_aead_128_256_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     knot256_state_t state;
+    unsigned char tag[KNOT_AEAD_128_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < KNOT_AEAD_128_TAG_SIZE)
         return -1;
     *mlen = clen - KNOT_AEAD_128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_128_NONCE_SIZE);
@@ -229,7 +317,7 @@ int knot_aead_128_256_decrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot256_permute_6,
-             28, KNOT_AEAD_128_256_RATE, ad, adlen);
+             28, KNOT_AEAD_128_256_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -238,28 +326,70 @@ int knot_aead_128_256_decrypt
     if (clen > 0) {
         knot_aead_decrypt
             (&state, (knot_permute_t)knot256_permute_6,
-             28, KNOT_AEAD_128_256_RATE, m, c, clen);
+             28, KNOT_AEAD_128_256_RATE, &mcur, &ccur, clen);
     }
 
     /* Check the authentication tag */
     knot256_permute_6(&state, 32);
-    return aead_check_tag
-        (m, clen, state.B, c + clen, KNOT_AEAD_128_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, KNOT_AEAD_128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, tag, KNOT_AEAD_128_TAG_SIZE);
 }
 
-int knot_aead_128_384_encrypt
+int knot_aead_128_256_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + KNOT_AEAD_128_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_128_256_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int knot_aead_128_256_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= KNOT_AEAD_128_TAG_SIZE ?
+                   clen - KNOT_AEAD_128_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_128_256_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int knot_aead_128_384_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     knot384_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + KNOT_AEAD_128_TAG_SIZE))
+        return -2;
     *clen = mlen + KNOT_AEAD_128_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_128_NONCE_SIZE);
@@ -273,7 +403,7 @@ int knot_aead_128_384_encrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot384_permute_7,
-             28, KNOT_AEAD_128_384_RATE, ad, adlen);
+             28, KNOT_AEAD_128_384_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -281,30 +411,39 @@ int knot_aead_128_384_encrypt
     if (mlen > 0) {
         knot_aead_encrypt
             (&state, (knot_permute_t)knot384_permute_7,
-             28, KNOT_AEAD_128_384_RATE, c, m, mlen);
+             28, KNOT_AEAD_128_384_RATE, &ccur, &mcur, mlen);
     }
 
     /* Compute the authentication tag */
     knot384_permute_7(&state, 32);
-    memcpy(c + mlen, state.B, KNOT_AEAD_128_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, KNOT_AEAD_128_TAG_SIZE);
     return 0;
 }
 
-int knot_aead_128_384_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int knot_aead_128_384_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     knot384_state_t state;
+    unsigned char tag[KNOT_AEAD_128_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < KNOT_AEAD_128_TAG_SIZE)
         return -1;
     *mlen = clen - KNOT_AEAD_128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_128_NONCE_SIZE);
@@ -318,7 +457,7 @@ int knot_aead_128_384_decrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot384_permute_7,
-             28, KNOT_AEAD_128_384_RATE, ad, adlen);
+             28, KNOT_AEAD_128_384_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -327,28 +466,70 @@ int knot_aead_128_384_decrypt
     if (clen > 0) {
         knot_aead_decrypt
             (&state, (knot_permute_t)knot384_permute_7,
-             28, KNOT_AEAD_128_384_RATE, m, c, clen);
+             28, KNOT_AEAD_128_384_RATE, &mcur, &ccur, clen);
     }
 
     /* Check the authentication tag */
     knot384_permute_7(&state, 32);
-    return aead_check_tag
-        (m, clen, state.B, c + clen, KNOT_AEAD_128_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, KNOT_AEAD_128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, tag, KNOT_AEAD_128_TAG_SIZE);
 }
 
-int knot_aead_192_384_encrypt
+int knot_aead_128_384_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + KNOT_AEAD_128_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_128_384_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int knot_aead_128_384_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= KNOT_AEAD_128_TAG_SIZE ?
+                   clen - KNOT_AEAD_128_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_128_384_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int knot_aead_192_384_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     knot384_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + KNOT_AEAD_192_TAG_SIZE))
+        return -2;
     *clen = mlen + KNOT_AEAD_192_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_192_NONCE_SIZE);
@@ -359,7 +540,7 @@ int knot_aead_192_384_encrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot384_permute_7,
-             40, KNOT_AEAD_192_384_RATE, ad, adlen);
+             40, KNOT_AEAD_192_384_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -367,30 +548,39 @@ int knot_aead_192_384_encrypt
     if (mlen > 0) {
         knot_aead_encrypt
             (&state, (knot_permute_t)knot384_permute_7,
-             40, KNOT_AEAD_192_384_RATE, c, m, mlen);
+             40, KNOT_AEAD_192_384_RATE, &ccur, &mcur, mlen);
     }
 
     /* Compute the authentication tag */
     knot384_permute_7(&state, 44);
-    memcpy(c + mlen, state.B, KNOT_AEAD_192_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, KNOT_AEAD_192_TAG_SIZE);
     return 0;
 }
 
-int knot_aead_192_384_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int knot_aead_192_384_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     knot384_state_t state;
+    unsigned char tag[KNOT_AEAD_192_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < KNOT_AEAD_192_TAG_SIZE)
         return -1;
     *mlen = clen - KNOT_AEAD_192_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_192_NONCE_SIZE);
@@ -401,7 +591,7 @@ int knot_aead_192_384_decrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot384_permute_7,
-             40, KNOT_AEAD_192_384_RATE, ad, adlen);
+             40, KNOT_AEAD_192_384_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -410,28 +600,70 @@ int knot_aead_192_384_decrypt
     if (clen > 0) {
         knot_aead_decrypt
             (&state, (knot_permute_t)knot384_permute_7,
-             40, KNOT_AEAD_192_384_RATE, m, c, clen);
+             40, KNOT_AEAD_192_384_RATE, &mcur, &ccur, clen);
     }
 
     /* Check the authentication tag */
     knot384_permute_7(&state, 44);
-    return aead_check_tag
-        (m, clen, state.B, c + clen, KNOT_AEAD_192_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, KNOT_AEAD_192_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, tag, KNOT_AEAD_192_TAG_SIZE);
 }
 
-int knot_aead_256_512_encrypt
+int knot_aead_192_384_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + KNOT_AEAD_192_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_192_384_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int knot_aead_192_384_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= KNOT_AEAD_192_TAG_SIZE ?
+                   clen - KNOT_AEAD_192_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_192_384_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int knot_aead_256_512_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     knot512_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + KNOT_AEAD_256_TAG_SIZE))
+        return -2;
     *clen = mlen + KNOT_AEAD_256_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_256_NONCE_SIZE);
@@ -442,7 +674,7 @@ int knot_aead_256_512_encrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot512_permute_7,
-             52, KNOT_AEAD_256_512_RATE, ad, adlen);
+             52, KNOT_AEAD_256_512_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -450,30 +682,39 @@ int knot_aead_256_512_encrypt
     if (mlen > 0) {
         knot_aead_encrypt
             (&state, (knot_permute_t)knot512_permute_7,
-             52, KNOT_AEAD_256_512_RATE, c, m, mlen);
+             52, KNOT_AEAD_256_512_RATE, &ccur, &mcur, mlen);
     }
 
     /* Compute the authentication tag */
     knot512_permute_7(&state, 56);
-    memcpy(c + mlen, state.B, KNOT_AEAD_256_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, KNOT_AEAD_256_TAG_SIZE);
     return 0;
 }
 
-int knot_aead_256_512_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int knot_aead_256_512_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     knot512_state_t state;
+    unsigned char tag[KNOT_AEAD_256_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < KNOT_AEAD_256_TAG_SIZE)
         return -1;
     *mlen = clen - KNOT_AEAD_256_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the permutation state to the nonce and the key */
     memcpy(state.B, npub, KNOT_AEAD_256_NONCE_SIZE);
@@ -484,7 +725,7 @@ int knot_aead_256_512_decrypt
     if (adlen > 0) {
         knot_aead_absorb_ad
             (&state, (knot_permute_t)knot512_permute_7,
-             52, KNOT_AEAD_256_512_RATE, ad, adlen);
+             52, KNOT_AEAD_256_512_RATE, &adcur, adlen);
     }
     state.B[sizeof(state.B) - 1] ^= 0x80; /* Domain separation */
 
@@ -493,11 +734,45 @@ int knot_aead_256_512_decrypt
     if (clen > 0) {
         knot_aead_decrypt
             (&state, (knot_permute_t)knot512_permute_7,
-             52, KNOT_AEAD_256_512_RATE, m, c, clen);
+             52, KNOT_AEAD_256_512_RATE, &mcur, &ccur, clen);
     }
 
     /* Check the authentication tag */
     knot512_permute_7(&state, 56);
-    return aead_check_tag
-        (m, clen, state.B, c + clen, KNOT_AEAD_256_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, KNOT_AEAD_256_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, tag, KNOT_AEAD_256_TAG_SIZE);
+}
+
+int knot_aead_256_512_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + KNOT_AEAD_256_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_256_512_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int knot_aead_256_512_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= KNOT_AEAD_256_TAG_SIZE ?
+                   clen - KNOT_AEAD_256_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return knot_aead_256_512_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
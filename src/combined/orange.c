@@ -22,7 +22,7 @@
 
 #include "orange.h"
 #include "internal-photon256.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const orange_zest_cipher = {
@@ -32,7 +32,18 @@ aead_cipher_t const orange_zest_cipher = {
     ORANGE_ZEST_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     orange_zest_aead_encrypt,
-    orange_zest_aead_decrypt
+    orange_zest_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    orange_zest_aead_encrypt_vec,
+    orange_zest_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const orangish_hash_algorithm = {
@@ -86,21 +97,23 @@ static void orange_block_rotate
  * \brief Hash input data with ORANGE.
  *
  * \param state PHOTON-256 permutation state.
- * \param data Points to the data to be hashed.
+ * \param data Cursor for the data to be hashed.
  * \param len Length of the data to be hashed, must not be zero.
  * \param domain0 Domain separation value for full last block.
  * \param domain1 Domain separation value for partial last block.
  */
 static void orange_process_hash
     (unsigned char state[PHOTON256_STATE_SIZE],
-     const unsigned char *data, unsigned long long len,
+     aead_iovec_cursor_t *data, unsigned long long len,
      unsigned char domain0, unsigned char domain1)
 {
+    unsigned char block[PHOTON256_STATE_SIZE];
+    const unsigned char *in;
     unsigned temp;
     while (len > PHOTON256_STATE_SIZE) {
         photon256_permute(state);
-        lw_xor_block(state, data, PHOTON256_STATE_SIZE);
-        data += PHOTON256_STATE_SIZE;
+        in = aead_iovec_load_block(data, block, PHOTON256_STATE_SIZE);
+        lw_xor_block(state, in, PHOTON256_STATE_SIZE);
         len -= PHOTON256_STATE_SIZE;
     }
     photon256_permute(state);
@@ -111,7 +124,8 @@ static void orange_process_hash
     } else {
         orange_block_double(state + 16, domain0);
     }
-    lw_xor_block(state, data, temp);
+    in = aead_iovec_load_block(data, block, temp);
+    lw_xor_block(state, in, temp);
 }
 
 /**
@@ -136,41 +150,50 @@ static void orange_rho
  *
  * \param state PHOTON-256 permutation state.
  * \param k Points to the key for the cipher.
- * \param c Points to the ciphertext output buffer.
- * \param m Points to the plaintext input buffer.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param len Length of the plaintext in bytes, must not be zero.
  */
 static void orange_encrypt
     (unsigned char state[PHOTON256_STATE_SIZE], const unsigned char *k,
-     unsigned char *c, const unsigned char *m, unsigned long long len)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long len)
 {
     unsigned char S[ORANGE_ZEST_KEY_SIZE];
     unsigned char KS[PHOTON256_STATE_SIZE];
+    unsigned char inbuf[PHOTON256_STATE_SIZE];
+    unsigned char outbuf[PHOTON256_STATE_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
     memcpy(S, k, ORANGE_ZEST_KEY_SIZE);
     while (len > PHOTON256_STATE_SIZE) {
         photon256_permute(state);
         orange_rho(KS, S, state);
-        lw_xor_block_2_src(c, m, KS, PHOTON256_STATE_SIZE);
-        lw_xor_block(state, c, PHOTON256_STATE_SIZE);
-        c += PHOTON256_STATE_SIZE;
-        m += PHOTON256_STATE_SIZE;
+        in = aead_iovec_load_block(m, inbuf, PHOTON256_STATE_SIZE);
+        out = aead_iovec_store_begin(c, outbuf, PHOTON256_STATE_SIZE);
+        lw_xor_block_2_src(out, in, KS, PHOTON256_STATE_SIZE);
+        lw_xor_block(state, out, PHOTON256_STATE_SIZE);
+        aead_iovec_store_end(c, outbuf, out, PHOTON256_STATE_SIZE);
         len -= PHOTON256_STATE_SIZE;
     }
     photon256_permute(state);
     temp = (unsigned)len;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
     if (temp < PHOTON256_STATE_SIZE) {
         orange_block_double(state + 16, 2);
         orange_rho(KS, S, state);
-        lw_xor_block_2_src(c, m, KS, temp);
-        lw_xor_block(state, c, temp);
+        lw_xor_block_2_src(out, in, KS, temp);
+        lw_xor_block(state, out, temp);
         state[temp] ^= 0x01; /* padding */
     } else {
         orange_block_double(state + 16, 1);
         orange_rho(KS, S, state);
-        lw_xor_block_2_src(c, m, KS, PHOTON256_STATE_SIZE);
-        lw_xor_block(state, c, PHOTON256_STATE_SIZE);
+        lw_xor_block_2_src(out, in, KS, PHOTON256_STATE_SIZE);
+        lw_xor_block(state, out, PHOTON256_STATE_SIZE);
     }
+    aead_iovec_store_end(c, outbuf, out, temp);
 }
 
 /**
@@ -178,41 +201,50 @@ static void orange_encrypt
  *
  * \param state PHOTON-256 permutation state.
  * \param k Points to the key for the cipher.
- * \param m Points to the plaintext output buffer.
- * \param c Points to the ciphertext input buffer.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param len Length of the plaintext in bytes, must not be zero.
  */
 static void orange_decrypt
     (unsigned char state[PHOTON256_STATE_SIZE], const unsigned char *k,
-     unsigned char *m, const unsigned char *c, unsigned long long len)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long len)
 {
     unsigned char S[ORANGE_ZEST_KEY_SIZE];
     unsigned char KS[PHOTON256_STATE_SIZE];
+    unsigned char inbuf[PHOTON256_STATE_SIZE];
+    unsigned char outbuf[PHOTON256_STATE_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
     memcpy(S, k, ORANGE_ZEST_KEY_SIZE);
     while (len > PHOTON256_STATE_SIZE) {
         photon256_permute(state);
         orange_rho(KS, S, state);
-        lw_xor_block(state, c, PHOTON256_STATE_SIZE);
-        lw_xor_block_2_src(m, c, KS, PHOTON256_STATE_SIZE);
-        c += PHOTON256_STATE_SIZE;
-        m += PHOTON256_STATE_SIZE;
+        in = aead_iovec_load_block(c, inbuf, PHOTON256_STATE_SIZE);
+        out = aead_iovec_store_begin(m, outbuf, PHOTON256_STATE_SIZE);
+        lw_xor_block(state, in, PHOTON256_STATE_SIZE);
+        lw_xor_block_2_src(out, in, KS, PHOTON256_STATE_SIZE);
+        aead_iovec_store_end(m, outbuf, out, PHOTON256_STATE_SIZE);
         len -= PHOTON256_STATE_SIZE;
     }
     photon256_permute(state);
     temp = (unsigned)len;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
     if (temp < PHOTON256_STATE_SIZE) {
         orange_block_double(state + 16, 2);
         orange_rho(KS, S, state);
-        lw_xor_block(state, c, temp);
-        lw_xor_block_2_src(m, c, KS, temp);
+        lw_xor_block(state, in, temp);
+        lw_xor_block_2_src(out, in, KS, temp);
         state[temp] ^= 0x01; /* padding */
     } else {
         orange_block_double(state + 16, 1);
         orange_rho(KS, S, state);
-        lw_xor_block(state, c, PHOTON256_STATE_SIZE);
-        lw_xor_block_2_src(m, c, KS, PHOTON256_STATE_SIZE);
+        lw_xor_block(state, in, PHOTON256_STATE_SIZE);
+        lw_xor_block_2_src(out, in, KS, PHOTON256_STATE_SIZE);
     }
+    aead_iovec_store_end(m, outbuf, out, temp);
 }
 
 /**
@@ -234,19 +266,27 @@ static void orange_generate_tag(unsigned char state[PHOTON256_STATE_SIZE])
     photon256_permute(state);
 }
 
-int orange_zest_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int orange_zest_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[PHOTON256_STATE_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ORANGE_ZEST_TAG_SIZE))
+        return -2;
     *clen = mlen + ORANGE_ZEST_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the PHOTON-256 state with the nonce and key */
     memcpy(state, npub, 16);
@@ -257,39 +297,48 @@ int orange_zest_aead_encrypt
         if (mlen == 0) {
             state[16] ^= 2; /* domain separation */
             photon256_permute(state);
-            memcpy(c + mlen, state, ORANGE_ZEST_TAG_SIZE);
+            aead_iovec_write(&ccur, state, ORANGE_ZEST_TAG_SIZE);
             return 0;
         } else {
             state[16] ^= 1; /* domain separation */
-            orange_encrypt(state, k, c, m, mlen);
+            orange_encrypt(state, k, &ccur, &mcur, mlen);
         }
     } else {
-        orange_process_hash(state, ad, adlen, 1, 2);
+        orange_process_hash(state, &adcur, adlen, 1, 2);
         if (mlen != 0)
-            orange_encrypt(state, k, c, m, mlen);
+            orange_encrypt(state, k, &ccur, &mcur, mlen);
     }
 
     /* Generate the authentication tag */
     orange_generate_tag(state);
-    memcpy(c + mlen, state, ORANGE_ZEST_TAG_SIZE);
+    aead_iovec_write(&ccur, state, ORANGE_ZEST_TAG_SIZE);
     return 0;
 }
 
-int orange_zest_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int orange_zest_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[PHOTON256_STATE_SIZE];
+    unsigned char tag[ORANGE_ZEST_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ORANGE_ZEST_TAG_SIZE)
         return -1;
     *mlen = clen - ORANGE_ZEST_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the PHOTON-256 state with the nonce and key */
     memcpy(state, npub, 16);
@@ -301,20 +350,57 @@ int orange_zest_aead_decrypt
         if (clen == 0) {
             state[16] ^= 2; /* domain separation */
             photon256_permute(state);
-            return aead_check_tag(m, 0, state, c, ORANGE_ZEST_TAG_SIZE);
+            aead_iovec_read(&ccur, tag, ORANGE_ZEST_TAG_SIZE);
+            return aead_check_tag_vec
+                (m, m_count, 0, state, tag, ORANGE_ZEST_TAG_SIZE);
         } else {
             state[16] ^= 1; /* domain separation */
-            orange_decrypt(state, k, m, c, clen);
+            orange_decrypt(state, k, &mcur, &ccur, clen);
         }
     } else {
-        orange_process_hash(state, ad, adlen, 1, 2);
+        orange_process_hash(state, &adcur, adlen, 1, 2);
         if (clen != 0)
-            orange_decrypt(state, k, m, c, clen);
+            orange_decrypt(state, k, &mcur, &ccur, clen);
     }
 
     /* Check the authentication tag */
     orange_generate_tag(state);
-    return aead_check_tag(m, clen, state, c + clen, ORANGE_ZEST_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, ORANGE_ZEST_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state, tag, ORANGE_ZEST_TAG_SIZE);
+}
+
+int orange_zest_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ORANGE_ZEST_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return orange_zest_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int orange_zest_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ORANGE_ZEST_TAG_SIZE ?
+                   clen - ORANGE_ZEST_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return orange_zest_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 /**
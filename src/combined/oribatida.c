@@ -22,6 +22,7 @@
 
 #include "oribatida.h"
 #include "internal-simp.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 /**
@@ -51,7 +52,18 @@ aead_cipher_t const oribatida_256_cipher = {
     ORIBATIDA_256_TAG_SIZE,
     AEAD_FLAG_NONE,
     oribatida_256_aead_encrypt,
-    oribatida_256_aead_decrypt
+    oribatida_256_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    oribatida_256_aead_encrypt_vec,
+    oribatida_256_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const oribatida_192_cipher = {
@@ -61,7 +73,18 @@ aead_cipher_t const oribatida_192_cipher = {
     ORIBATIDA_192_TAG_SIZE,
     AEAD_FLAG_NONE,
     oribatida_192_aead_encrypt,
-    oribatida_192_aead_decrypt
+    oribatida_192_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    oribatida_192_aead_encrypt_vec,
+    oribatida_192_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /* Definitions for domain separation values */
@@ -119,7 +142,7 @@ static void oribatida_get_domains
  * \param domains Precomputed domain separation values.
  * \param k Points to the key.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data.
  */
 static void oribatida_256_init
@@ -127,8 +150,10 @@ static void oribatida_256_init
      unsigned char mask[ORIBATIDA_256_MASK_SIZE],
      const unsigned char domains[ORIBATIDA_NUM_DOMAINS],
      const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[ORIBATIDA_256_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Initialize the state with the key and nonce */
@@ -157,18 +182,19 @@ static void oribatida_256_init
 
     /* Process all associated data blocks except the last */
     while (adlen > ORIBATIDA_256_RATE) {
-        lw_xor_block(state, ad, ORIBATIDA_256_RATE);
+        in = aead_iovec_load_block(ad, block, ORIBATIDA_256_RATE);
+        lw_xor_block(state, in, ORIBATIDA_256_RATE);
         simp_256_permute(state, 2);
-        ad += ORIBATIDA_256_RATE;
         adlen -= ORIBATIDA_256_RATE;
     }
 
     /* Process the final associated data block */
     temp = (unsigned)adlen;
+    in = aead_iovec_load_block(ad, block, temp);
     if (temp == ORIBATIDA_256_RATE) {
-        lw_xor_block(state, ad, ORIBATIDA_256_RATE);
+        lw_xor_block(state, in, ORIBATIDA_256_RATE);
     } else {
-        lw_xor_block(state, ad, temp);
+        lw_xor_block(state, in, temp);
         state[temp] ^= 0x80; /* padding */
     }
     state[SIMP_256_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_AD];
@@ -183,7 +209,7 @@ static void oribatida_256_init
  * \param domains Precomputed domain separation values.
  * \param k Points to the key.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data.
  */
 static void oribatida_192_init
@@ -191,8 +217,10 @@ static void oribatida_192_init
      unsigned char mask[ORIBATIDA_192_MASK_SIZE],
      const unsigned char domains[ORIBATIDA_NUM_DOMAINS],
      const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[ORIBATIDA_192_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Initialize the state with the key and nonce */
@@ -221,28 +249,29 @@ static void oribatida_192_init
 
     /* Process all associated data blocks except the last */
     while (adlen > ORIBATIDA_192_RATE) {
-        lw_xor_block(state, ad, ORIBATIDA_192_RATE);
+        in = aead_iovec_load_block(ad, block, ORIBATIDA_192_RATE);
+        lw_xor_block(state, in, ORIBATIDA_192_RATE);
         simp_192_permute(state, 2);
-        ad += ORIBATIDA_192_RATE;
         adlen -= ORIBATIDA_192_RATE;
     }
 
     /* Process the final associated data block */
     temp = (unsigned)adlen;
+    in = aead_iovec_load_block(ad, block, temp);
     if (temp == ORIBATIDA_192_RATE) {
-        lw_xor_block(state, ad, ORIBATIDA_192_RATE);
+        lw_xor_block(state, in, ORIBATIDA_192_RATE);
     } else {
-        lw_xor_block(state, ad, temp);
+        lw_xor_block(state, in, temp);
         state[temp] ^= 0x80; /* padding */
     }
     state[SIMP_192_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_AD];
     simp_192_permute(state, 4);
 }
 
-int oribatida_256_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int oribatida_256_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -250,56 +279,72 @@ int oribatida_256_aead_encrypt
     unsigned char state[SIMP_256_STATE_SIZE];
     unsigned char mask[ORIBATIDA_256_MASK_SIZE];
     unsigned char domains[ORIBATIDA_NUM_DOMAINS];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
+    unsigned char inbuf[ORIBATIDA_256_RATE];
+    unsigned char outbuf[ORIBATIDA_256_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ORIBATIDA_256_TAG_SIZE))
+        return -2;
     *clen = mlen + ORIBATIDA_256_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state and absorb the associated data */
     oribatida_get_domains(domains, adlen, mlen, ORIBATIDA_256_RATE);
-    oribatida_256_init(state, mask, domains, k, npub, ad, adlen);
+    oribatida_256_init(state, mask, domains, k, npub, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     while (mlen > ORIBATIDA_256_RATE) {
-        lw_xor_block_2_dest(c, state, m, ORIBATIDA_256_RATE);
-        lw_xor_block(c + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE,
+        in = aead_iovec_load_block(&mcur, inbuf, ORIBATIDA_256_RATE);
+        out = aead_iovec_store_begin(&ccur, outbuf, ORIBATIDA_256_RATE);
+        lw_xor_block_2_dest(out, state, in, ORIBATIDA_256_RATE);
+        lw_xor_block(out + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE,
                      mask, ORIBATIDA_256_MASK_SIZE);
         memcpy(mask, state + SIMP_256_STATE_SIZE - ORIBATIDA_256_MASK_SIZE,
                ORIBATIDA_256_MASK_SIZE);
+        aead_iovec_store_end(&ccur, outbuf, out, ORIBATIDA_256_RATE);
         simp_256_permute(state, 4);
-        c += ORIBATIDA_256_RATE;
-        m += ORIBATIDA_256_RATE;
         mlen -= ORIBATIDA_256_RATE;
     }
+    in = aead_iovec_load_block(&mcur, inbuf, (size_t)mlen);
+    out = aead_iovec_store_begin(&ccur, outbuf, (size_t)mlen);
     if (mlen == ORIBATIDA_256_RATE) {
-        lw_xor_block_2_dest(c, state, m, ORIBATIDA_256_RATE);
-        lw_xor_block(c + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE,
+        lw_xor_block_2_dest(out, state, in, ORIBATIDA_256_RATE);
+        lw_xor_block(out + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE,
                      mask, ORIBATIDA_256_MASK_SIZE);
         state[SIMP_256_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_256_permute(state, 4);
     } else if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
-        lw_xor_block_2_dest(c, state, m, temp);
+        lw_xor_block_2_dest(out, state, in, temp);
         if (temp > (ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE)) {
             lw_xor_block
-                (c + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE, mask,
+                (out + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE, mask,
                  temp - (ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE));
         }
         state[temp] ^= 0x80; /* padding */
         state[SIMP_256_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_256_permute(state, 4);
     }
+    aead_iovec_store_end(&ccur, outbuf, out, (size_t)mlen);
 
     /* Generate the authentication tag */
-    memcpy(c + mlen, state, ORIBATIDA_256_TAG_SIZE);
+    aead_iovec_write(&ccur, state, ORIBATIDA_256_TAG_SIZE);
     return 0;
 }
 
-int oribatida_256_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int oribatida_256_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
@@ -307,119 +352,177 @@ int oribatida_256_aead_decrypt
     unsigned char mask[ORIBATIDA_256_MASK_SIZE];
     unsigned char domains[ORIBATIDA_NUM_DOMAINS];
     unsigned char block[ORIBATIDA_256_RATE];
-    unsigned char *mtemp = m;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ORIBATIDA_256_TAG_SIZE)
         return -1;
     *mlen = clen - ORIBATIDA_256_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state and absorb the associated data */
     clen -= ORIBATIDA_256_TAG_SIZE;
     oribatida_get_domains(domains, adlen, clen, ORIBATIDA_256_RATE);
-    oribatida_256_init(state, mask, domains, k, npub, ad, adlen);
+    oribatida_256_init(state, mask, domains, k, npub, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     while (clen > ORIBATIDA_256_RATE) {
-        memcpy(block, c, ORIBATIDA_256_RATE);
+        aead_iovec_read(&ccur, block, ORIBATIDA_256_RATE);
         lw_xor_block(block + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE,
                      mask, ORIBATIDA_256_MASK_SIZE);
-        lw_xor_block_swap(m, state, block, ORIBATIDA_256_RATE);
+        lw_xor_block_swap(block, state, block, ORIBATIDA_256_RATE);
+        aead_iovec_write(&mcur, block, ORIBATIDA_256_RATE);
         memcpy(mask, state + SIMP_256_STATE_SIZE - ORIBATIDA_256_MASK_SIZE,
                ORIBATIDA_256_MASK_SIZE);
         simp_256_permute(state, 4);
-        c += ORIBATIDA_256_RATE;
-        m += ORIBATIDA_256_RATE;
         clen -= ORIBATIDA_256_RATE;
     }
     if (clen == ORIBATIDA_256_RATE) {
-        memcpy(block, c, ORIBATIDA_256_RATE);
+        aead_iovec_read(&ccur, block, ORIBATIDA_256_RATE);
         lw_xor_block(block + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE,
                      mask, ORIBATIDA_256_MASK_SIZE);
-        lw_xor_block_swap(m, state, block, ORIBATIDA_256_RATE);
+        lw_xor_block_swap(block, state, block, ORIBATIDA_256_RATE);
+        aead_iovec_write(&mcur, block, ORIBATIDA_256_RATE);
         state[SIMP_256_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_256_permute(state, 4);
     } else if (clen > 0) {
         unsigned temp = (unsigned)clen;
-        memcpy(block, c, temp);
+        aead_iovec_read(&ccur, block, temp);
         if (temp > (ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE)) {
             lw_xor_block
                 (block + ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE, mask,
                  temp - (ORIBATIDA_256_RATE - ORIBATIDA_256_MASK_SIZE));
         }
-        lw_xor_block_swap(m, state, block, temp);
+        lw_xor_block_swap(block, state, block, temp);
+        aead_iovec_write(&mcur, block, temp);
         state[temp] ^= 0x80; /* padding */
         state[SIMP_256_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_256_permute(state, 4);
     }
-    c += clen;
 
     /* Check the authentication tag */
-    return aead_check_tag(mtemp, *mlen, state, c, ORIBATIDA_256_TAG_SIZE);
+    aead_iovec_read(&ccur, block, ORIBATIDA_256_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state, block, ORIBATIDA_256_TAG_SIZE);
 }
 
-int oribatida_192_aead_encrypt
+int oribatida_256_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ORIBATIDA_256_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return oribatida_256_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int oribatida_256_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ORIBATIDA_256_TAG_SIZE ?
+                   clen - ORIBATIDA_256_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return oribatida_256_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int oribatida_192_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     unsigned char state[SIMP_192_STATE_SIZE];
     unsigned char mask[ORIBATIDA_192_MASK_SIZE];
     unsigned char domains[ORIBATIDA_NUM_DOMAINS];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
+    unsigned char inbuf[ORIBATIDA_192_RATE];
+    unsigned char outbuf[ORIBATIDA_192_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ORIBATIDA_192_TAG_SIZE))
+        return -2;
     *clen = mlen + ORIBATIDA_192_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state and absorb the associated data */
     oribatida_get_domains(domains, adlen, mlen, ORIBATIDA_192_RATE);
-    oribatida_192_init(state, mask, domains, k, npub, ad, adlen);
+    oribatida_192_init(state, mask, domains, k, npub, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     while (mlen > ORIBATIDA_192_RATE) {
-        lw_xor_block_2_dest(c, state, m, ORIBATIDA_192_RATE);
-        lw_xor_block(c + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE,
+        in = aead_iovec_load_block(&mcur, inbuf, ORIBATIDA_192_RATE);
+        out = aead_iovec_store_begin(&ccur, outbuf, ORIBATIDA_192_RATE);
+        lw_xor_block_2_dest(out, state, in, ORIBATIDA_192_RATE);
+        lw_xor_block(out + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE,
                      mask, ORIBATIDA_192_MASK_SIZE);
         memcpy(mask, state + SIMP_192_STATE_SIZE - ORIBATIDA_192_MASK_SIZE,
                ORIBATIDA_192_MASK_SIZE);
+        aead_iovec_store_end(&ccur, outbuf, out, ORIBATIDA_192_RATE);
         simp_192_permute(state, 4);
-        c += ORIBATIDA_192_RATE;
-        m += ORIBATIDA_192_RATE;
         mlen -= ORIBATIDA_192_RATE;
     }
+    in = aead_iovec_load_block(&mcur, inbuf, (size_t)mlen);
+    out = aead_iovec_store_begin(&ccur, outbuf, (size_t)mlen);
     if (mlen == ORIBATIDA_192_RATE) {
-        lw_xor_block_2_dest(c, state, m, ORIBATIDA_192_RATE);
-        lw_xor_block(c + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE,
+        lw_xor_block_2_dest(out, state, in, ORIBATIDA_192_RATE);
+        lw_xor_block(out + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE,
                      mask, ORIBATIDA_192_MASK_SIZE);
         state[SIMP_192_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_192_permute(state, 4);
     } else if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
-        lw_xor_block_2_dest(c, state, m, temp);
+        lw_xor_block_2_dest(out, state, in, temp);
         if (temp > (ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE)) {
             lw_xor_block
-                (c + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE, mask,
+                (out + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE, mask,
                  temp - (ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE));
         }
         state[temp] ^= 0x80; /* padding */
         state[SIMP_192_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_192_permute(state, 4);
     }
+    aead_iovec_store_end(&ccur, outbuf, out, (size_t)mlen);
 
     /* Generate the authentication tag */
-    memcpy(c + mlen, state, ORIBATIDA_192_TAG_SIZE);
+    aead_iovec_write(&ccur, state, ORIBATIDA_192_TAG_SIZE);
     return 0;
 }
 
-int oribatida_192_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int oribatida_192_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
@@ -427,54 +530,96 @@ int oribatida_192_aead_decrypt
     unsigned char mask[ORIBATIDA_192_MASK_SIZE];
     unsigned char domains[ORIBATIDA_NUM_DOMAINS];
     unsigned char block[ORIBATIDA_192_RATE];
-    unsigned char *mtemp = m;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ORIBATIDA_192_TAG_SIZE)
         return -1;
     *mlen = clen - ORIBATIDA_192_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state and absorb the associated data */
     clen -= ORIBATIDA_192_TAG_SIZE;
     oribatida_get_domains(domains, adlen, clen, ORIBATIDA_192_RATE);
-    oribatida_192_init(state, mask, domains, k, npub, ad, adlen);
+    oribatida_192_init(state, mask, domains, k, npub, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     while (clen > ORIBATIDA_192_RATE) {
-        memcpy(block, c, ORIBATIDA_192_RATE);
+        aead_iovec_read(&ccur, block, ORIBATIDA_192_RATE);
         lw_xor_block(block + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE,
                      mask, ORIBATIDA_192_MASK_SIZE);
-        lw_xor_block_swap(m, state, block, ORIBATIDA_192_RATE);
+        lw_xor_block_swap(block, state, block, ORIBATIDA_192_RATE);
+        aead_iovec_write(&mcur, block, ORIBATIDA_192_RATE);
         memcpy(mask, state + SIMP_192_STATE_SIZE - ORIBATIDA_192_MASK_SIZE,
                ORIBATIDA_192_MASK_SIZE);
         simp_192_permute(state, 4);
-        c += ORIBATIDA_192_RATE;
-        m += ORIBATIDA_192_RATE;
         clen -= ORIBATIDA_192_RATE;
     }
     if (clen == ORIBATIDA_192_RATE) {
-        memcpy(block, c, ORIBATIDA_192_RATE);
+        aead_iovec_read(&ccur, block, ORIBATIDA_192_RATE);
         lw_xor_block(block + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE,
                      mask, ORIBATIDA_192_MASK_SIZE);
-        lw_xor_block_swap(m, state, block, ORIBATIDA_192_RATE);
+        lw_xor_block_swap(block, state, block, ORIBATIDA_192_RATE);
+        aead_iovec_write(&mcur, block, ORIBATIDA_192_RATE);
         state[SIMP_192_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_192_permute(state, 4);
     } else if (clen > 0) {
         unsigned temp = (unsigned)clen;
-        memcpy(block, c, temp);
+        aead_iovec_read(&ccur, block, temp);
         if (temp > (ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE)) {
             lw_xor_block
                 (block + ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE, mask,
                  temp - (ORIBATIDA_192_RATE - ORIBATIDA_192_MASK_SIZE));
         }
-        lw_xor_block_swap(m, state, block, temp);
+        lw_xor_block_swap(block, state, block, temp);
+        aead_iovec_write(&mcur, block, temp);
         state[temp] ^= 0x80; /* padding */
         state[SIMP_192_STATE_SIZE - 1] ^= domains[ORIBATIDA_DOMAIN_MSG];
         simp_192_permute(state, 4);
     }
-    c += clen;
 
     /* Check the authentication tag */
-    return aead_check_tag(mtemp, *mlen, state, c, ORIBATIDA_192_TAG_SIZE);
+    aead_iovec_read(&ccur, block, ORIBATIDA_192_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state, block, ORIBATIDA_192_TAG_SIZE);
+}
+
+int oribatida_192_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ORIBATIDA_192_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return oribatida_192_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int oribatida_192_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ORIBATIDA_192_TAG_SIZE ?
+                   clen - ORIBATIDA_192_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return oribatida_192_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
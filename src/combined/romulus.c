@@ -22,69 +22,9 @@
 
 #include "romulus.h"
 #include "internal-skinny128.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
-aead_cipher_t const romulus_n1_cipher = {
-    "Romulus-N1",
-    ROMULUS_KEY_SIZE,
-    ROMULUS1_NONCE_SIZE,
-    ROMULUS_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    romulus_n1_aead_encrypt,
-    romulus_n1_aead_decrypt
-};
-
-aead_cipher_t const romulus_n2_cipher = {
-    "Romulus-N2",
-    ROMULUS_KEY_SIZE,
-    ROMULUS2_NONCE_SIZE,
-    ROMULUS_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    romulus_n2_aead_encrypt,
-    romulus_n2_aead_decrypt
-};
-
-aead_cipher_t const romulus_n3_cipher = {
-    "Romulus-N3",
-    ROMULUS_KEY_SIZE,
-    ROMULUS3_NONCE_SIZE,
-    ROMULUS_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    romulus_n3_aead_encrypt,
-    romulus_n3_aead_decrypt
-};
-
-aead_cipher_t const romulus_m1_cipher = {
-    "Romulus-M1",
-    ROMULUS_KEY_SIZE,
-    ROMULUS1_NONCE_SIZE,
-    ROMULUS_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    romulus_m1_aead_encrypt,
-    romulus_m1_aead_decrypt
-};
-
-aead_cipher_t const romulus_m2_cipher = {
-    "Romulus-M2",
-    ROMULUS_KEY_SIZE,
-    ROMULUS2_NONCE_SIZE,
-    ROMULUS_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    romulus_m2_aead_encrypt,
-    romulus_m2_aead_decrypt
-};
-
-aead_cipher_t const romulus_m3_cipher = {
-    "Romulus-M3",
-    ROMULUS_KEY_SIZE,
-    ROMULUS3_NONCE_SIZE,
-    ROMULUS_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    romulus_m3_aead_encrypt,
-    romulus_m3_aead_decrypt
-};
-
 /**
  * \brief Limit on the number of bytes of message or associated data (128Mb).
  *
@@ -177,6 +117,28 @@ static void romulus3_init
     skinny_128_256_init(ks, TK);
 }
 
+/**
+ * \brief Re-initializes the tweak for Romulus-N2, N3, M2, or M3.
+ *
+ * \param TK1 Points to the TK1 part of the key schedule.
+ * \param npub Points to the 12 bytes of the nonce.  May be NULL
+ * if the nonce will be updated on the fly.
+ *
+ * The key schedule must have been initialized with romulus2_init() or
+ * romulus3_init() previously.  TK2 and TK3 only depend upon the key,
+ * so the key schedule can be reused for other nonces by replacing TK1.
+ */
+static void romulus23_init_tk1(uint8_t TK1[16], const unsigned char *npub)
+{
+    TK1[0] = 0x01; /* Initialize the low 24 bits of the LFSR counter */
+    if (npub) {
+        TK1[1] = TK1[2] = TK1[3] = 0;
+        memcpy(TK1 + 4, npub, 12);
+    } else {
+        memset(TK1 + 1, 0, 15);
+    }
+}
+
 /**
  * \brief Sets the domain separation value for Romulus-N1 and M1.
  *
@@ -247,14 +209,16 @@ STATIC_INLINE void romulus2_update_counter(uint8_t TK1[16])
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void romulus_n1_process_ad
     (skinny_128_384_key_schedule_t *ks,
      unsigned char S[16], const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[32];
+    const unsigned char *in;
     unsigned char temp;
 
     /* Handle the special case of no associated data */
@@ -268,29 +232,30 @@ static void romulus_n1_process_ad
     /* Process all double blocks except the last */
     romulus1_set_domain(ks, 0x08);
     while (adlen > 32) {
+        in = aead_iovec_load_block(ad, buf, 32);
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        skinny_128_384_encrypt_tk2(ks, S, S, ad + 16);
+        lw_xor_block(S, in, 16);
+        skinny_128_384_encrypt_tk2(ks, S, S, in + 16);
         romulus1_update_counter(ks->TK1);
-        ad += 32;
         adlen -= 32;
     }
 
     /* Pad and process the left-over blocks */
     romulus1_update_counter(ks->TK1);
     temp = (unsigned)adlen;
+    in = aead_iovec_load_block(ad, buf, temp);
     if (temp == 32) {
         /* Left-over complete double block */
-        lw_xor_block(S, ad, 16);
-        skinny_128_384_encrypt_tk2(ks, S, S, ad + 16);
+        lw_xor_block(S, in, 16);
+        skinny_128_384_encrypt_tk2(ks, S, S, in + 16);
         romulus1_update_counter(ks->TK1);
         romulus1_set_domain(ks, 0x18);
     } else if (temp > 16) {
         /* Left-over partial double block */
         unsigned char pad[16];
         temp -= 16;
-        lw_xor_block(S, ad, 16);
-        memcpy(pad, ad + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(pad, in + 16, temp);
         memset(pad + temp, 0, 15 - temp);
         pad[15] = temp;
         skinny_128_384_encrypt_tk2(ks, S, S, pad);
@@ -298,11 +263,11 @@ static void romulus_n1_process_ad
         romulus1_set_domain(ks, 0x1A);
     } else if (temp == 16) {
         /* Left-over complete single block */
-        lw_xor_block(S, ad, temp);
+        lw_xor_block(S, in, temp);
         romulus1_set_domain(ks, 0x18);
     } else {
         /* Left-over partial single block */
-        lw_xor_block(S, ad, temp);
+        lw_xor_block(S, in, temp);
         S[15] ^= temp;
         romulus1_set_domain(ks, 0x1A);
     }
@@ -315,14 +280,16 @@ static void romulus_n1_process_ad
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void romulus_n2_process_ad
     (skinny_128_384_key_schedule_t *ks,
      unsigned char S[16], const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[28];
+    const unsigned char *in;
     unsigned char temp;
 
     /* Handle the special case of no associated data */
@@ -337,30 +304,31 @@ static void romulus_n2_process_ad
     /* Process all double blocks except the last */
     romulus2_set_domain(ks, 0x48);
     while (adlen > 28) {
+        in = aead_iovec_load_block(ad, buf, 28);
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_384_encrypt(ks, S, S);
         romulus2_update_counter(ks->TK1);
-        ad += 28;
         adlen -= 28;
     }
 
     /* Pad and process the left-over blocks */
     romulus2_update_counter(ks->TK1);
     temp = (unsigned)adlen;
+    in = aead_iovec_load_block(ad, buf, temp);
     if (temp == 28) {
         /* Left-over complete double block */
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_384_encrypt(ks, S, S);
         romulus2_update_counter(ks->TK1);
         romulus2_set_domain(ks, 0x58);
     } else if (temp > 16) {
         /* Left-over partial double block */
         temp -= 16;
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, temp);
         memset(ks->TK1 + 4 + temp, 0, 12 - temp);
         ks->TK1[15] = temp;
         skinny_128_384_encrypt(ks, S, S);
@@ -368,11 +336,11 @@ static void romulus_n2_process_ad
         romulus2_set_domain(ks, 0x5A);
     } else if (temp == 16) {
         /* Left-over complete single block */
-        lw_xor_block(S, ad, temp);
+        lw_xor_block(S, in, temp);
         romulus2_set_domain(ks, 0x58);
     } else {
         /* Left-over partial single block */
-        lw_xor_block(S, ad, temp);
+        lw_xor_block(S, in, temp);
         S[15] ^= temp;
         romulus2_set_domain(ks, 0x5A);
     }
@@ -386,14 +354,16 @@ static void romulus_n2_process_ad
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void romulus_n3_process_ad
     (skinny_128_256_key_schedule_t *ks,
      unsigned char S[16], const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[28];
+    const unsigned char *in;
     unsigned char temp;
 
     /* Handle the special case of no associated data */
@@ -408,30 +378,31 @@ static void romulus_n3_process_ad
     /* Process all double blocks except the last */
     romulus3_set_domain(ks, 0x88);
     while (adlen > 28) {
+        in = aead_iovec_load_block(ad, buf, 28);
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_256_encrypt(ks, S, S);
         romulus3_update_counter(ks->TK1);
-        ad += 28;
         adlen -= 28;
     }
 
     /* Pad and process the left-over blocks */
     romulus3_update_counter(ks->TK1);
     temp = (unsigned)adlen;
+    in = aead_iovec_load_block(ad, buf, temp);
     if (temp == 28) {
         /* Left-over complete double block */
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_256_encrypt(ks, S, S);
         romulus3_update_counter(ks->TK1);
         romulus3_set_domain(ks, 0x98);
     } else if (temp > 16) {
         /* Left-over partial double block */
         temp -= 16;
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, temp);
         memset(ks->TK1 + 4 + temp, 0, 12 - temp);
         ks->TK1[15] = temp;
         skinny_128_256_encrypt(ks, S, S);
@@ -439,11 +410,11 @@ static void romulus_n3_process_ad
         romulus3_set_domain(ks, 0x9A);
     } else if (temp == 16) {
         /* Left-over complete single block */
-        lw_xor_block(S, ad, temp);
+        lw_xor_block(S, in, temp);
         romulus3_set_domain(ks, 0x98);
     } else {
         /* Left-over partial single block */
-        lw_xor_block(S, ad, temp);
+        lw_xor_block(S, in, temp);
         S[15] ^= temp;
         romulus3_set_domain(ks, 0x9A);
     }
@@ -519,17 +490,19 @@ static uint8_t romulus_m_final_ad_domain
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
- * \param m Points to the message plaintext.
+ * \param m Cursor for the message plaintext.
  * \param mlen Length of the message plaintext.
  */
 static void romulus_m1_process_ad
     (skinny_128_384_key_schedule_t *ks,
      unsigned char S[16], const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char buf[32];
+    const unsigned char *in = buf;
     unsigned char pad[16];
     uint8_t final_domain = 0x30;
     unsigned temp;
@@ -540,28 +513,30 @@ static void romulus_m1_process_ad
     /* Process all associated data double blocks except the last */
     romulus1_set_domain(ks, 0x28);
     while (adlen > 32) {
+        in = aead_iovec_load_block(ad, buf, 32);
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        skinny_128_384_encrypt_tk2(ks, S, S, ad + 16);
+        lw_xor_block(S, in, 16);
+        skinny_128_384_encrypt_tk2(ks, S, S, in + 16);
         romulus1_update_counter(ks->TK1);
-        ad += 32;
         adlen -= 32;
     }
 
     /* Process the last associated data double block */
     temp = (unsigned)adlen;
+    if (temp > 0)
+        in = aead_iovec_load_block(ad, buf, temp);
     if (temp == 32) {
         /* Last associated data double block is full */
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        skinny_128_384_encrypt_tk2(ks, S, S, ad + 16);
+        lw_xor_block(S, in, 16);
+        skinny_128_384_encrypt_tk2(ks, S, S, in + 16);
         romulus1_update_counter(ks->TK1);
     } else if (temp > 16) {
         /* Last associated data double block is partial */
         temp -= 16;
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(pad, ad + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(pad, in + 16, temp);
         memset(pad + temp, 0, sizeof(pad) - temp - 1);
         pad[sizeof(pad) - 1] = (unsigned char)temp;
         skinny_128_384_encrypt_tk2(ks, S, S, pad);
@@ -572,23 +547,23 @@ static void romulus_m1_process_ad
         romulus1_set_domain(ks, 0x2C);
         romulus1_update_counter(ks->TK1);
         if (temp == 16) {
-            lw_xor_block(S, ad, 16);
+            lw_xor_block(S, in, 16);
         } else {
-            lw_xor_block(S, ad, temp);
+            lw_xor_block(S, in, temp);
             S[15] ^= (unsigned char)temp;
         }
         if (mlen > 16) {
-            skinny_128_384_encrypt_tk2(ks, S, S, m);
+            in = aead_iovec_load_block(m, buf, 16);
+            skinny_128_384_encrypt_tk2(ks, S, S, in);
             romulus1_update_counter(ks->TK1);
-            m += 16;
             mlen -= 16;
         } else if (mlen == 16) {
-            skinny_128_384_encrypt_tk2(ks, S, S, m);
-            m += 16;
+            in = aead_iovec_load_block(m, buf, 16);
+            skinny_128_384_encrypt_tk2(ks, S, S, in);
             mlen -= 16;
         } else {
             temp = (unsigned)mlen;
-            memcpy(pad, m, temp);
+            aead_iovec_read(m, pad, temp);
             memset(pad + temp, 0, sizeof(pad) - temp - 1);
             pad[sizeof(pad) - 1] = (unsigned char)temp;
             skinny_128_384_encrypt_tk2(ks, S, S, pad);
@@ -599,36 +574,38 @@ static void romulus_m1_process_ad
     /* Process all message double blocks except the last */
     romulus1_set_domain(ks, 0x2C);
     while (mlen > 32) {
+        in = aead_iovec_load_block(m, buf, 32);
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        skinny_128_384_encrypt_tk2(ks, S, S, m + 16);
+        lw_xor_block(S, in, 16);
+        skinny_128_384_encrypt_tk2(ks, S, S, in + 16);
         romulus1_update_counter(ks->TK1);
-        m += 32;
         mlen -= 32;
     }
 
     /* Process the last message double block */
     temp = (unsigned)mlen;
+    if (temp > 0)
+        in = aead_iovec_load_block(m, buf, temp);
     if (temp == 32) {
         /* Last message double block is full */
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        skinny_128_384_encrypt_tk2(ks, S, S, m + 16);
+        lw_xor_block(S, in, 16);
+        skinny_128_384_encrypt_tk2(ks, S, S, in + 16);
     } else if (temp > 16) {
         /* Last message double block is partial */
         temp -= 16;
         romulus1_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(pad, m + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(pad, in + 16, temp);
         memset(pad + temp, 0, sizeof(pad) - temp - 1);
         pad[sizeof(pad) - 1] = (unsigned char)temp;
         skinny_128_384_encrypt_tk2(ks, S, S, pad);
     } else if (temp == 16) {
         /* Last message single block is full */
-        lw_xor_block(S, m, 16);
+        lw_xor_block(S, in, 16);
     } else if (temp > 0) {
         /* Last message single block is partial */
-        lw_xor_block(S, m, temp);
+        lw_xor_block(S, in, temp);
         S[15] ^= (unsigned char)temp;
     }
 
@@ -644,17 +621,19 @@ static void romulus_m1_process_ad
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
- * \param m Points to the message plaintext.
+ * \param m Cursor for the message plaintext.
  * \param mlen Length of the message plaintext.
  */
 static void romulus_m2_process_ad
     (skinny_128_384_key_schedule_t *ks,
      unsigned char S[16], const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char buf[28];
+    const unsigned char *in = buf;
     uint8_t final_domain = 0x70;
     unsigned temp;
 
@@ -664,30 +643,32 @@ static void romulus_m2_process_ad
     /* Process all associated data double blocks except the last */
     romulus2_set_domain(ks, 0x68);
     while (adlen > 28) {
+        in = aead_iovec_load_block(ad, buf, 28);
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_384_encrypt(ks, S, S);
         romulus2_update_counter(ks->TK1);
-        ad += 28;
         adlen -= 28;
     }
 
     /* Process the last associated data double block */
     temp = (unsigned)adlen;
+    if (temp > 0)
+        in = aead_iovec_load_block(ad, buf, temp);
     if (temp == 28) {
         /* Last associated data double block is full */
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_384_encrypt(ks, S, S);
         romulus2_update_counter(ks->TK1);
     } else if (temp > 16) {
         /* Last associated data double block is partial */
         temp -= 16;
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, temp);
         memset(ks->TK1 + 4 + temp, 0, 12 - temp - 1);
         ks->TK1[15] = (unsigned char)temp;
         skinny_128_384_encrypt(ks, S, S);
@@ -698,25 +679,23 @@ static void romulus_m2_process_ad
         romulus2_set_domain(ks, 0x6C);
         romulus2_update_counter(ks->TK1);
         if (temp == 16) {
-            lw_xor_block(S, ad, 16);
+            lw_xor_block(S, in, 16);
         } else {
-            lw_xor_block(S, ad, temp);
+            lw_xor_block(S, in, temp);
             S[15] ^= (unsigned char)temp;
         }
         if (mlen > 12) {
-            memcpy(ks->TK1 + 4, m, 12);
+            aead_iovec_read(m, ks->TK1 + 4, 12);
             skinny_128_384_encrypt(ks, S, S);
             romulus2_update_counter(ks->TK1);
-            m += 12;
             mlen -= 12;
         } else if (mlen == 12) {
-            memcpy(ks->TK1 + 4, m, 12);
+            aead_iovec_read(m, ks->TK1 + 4, 12);
             skinny_128_384_encrypt(ks, S, S);
-            m += 12;
             mlen -= 12;
         } else {
             temp = (unsigned)mlen;
-            memcpy(ks->TK1 + 4, m, temp);
+            aead_iovec_read(m, ks->TK1 + 4, temp);
             memset(ks->TK1 + 4 + temp, 0, 12 - temp - 1);
             ks->TK1[15] = (unsigned char)temp;
             skinny_128_384_encrypt(ks, S, S);
@@ -727,38 +706,40 @@ static void romulus_m2_process_ad
     /* Process all message double blocks except the last */
     romulus2_set_domain(ks, 0x6C);
     while (mlen > 28) {
+        in = aead_iovec_load_block(m, buf, 28);
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(ks->TK1 + 4, m + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_384_encrypt(ks, S, S);
         romulus2_update_counter(ks->TK1);
-        m += 28;
         mlen -= 28;
     }
 
     /* Process the last message double block */
     temp = (unsigned)mlen;
+    if (temp > 0)
+        in = aead_iovec_load_block(m, buf, temp);
     if (temp == 28) {
         /* Last message double block is full */
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(ks->TK1 + 4, m + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_384_encrypt(ks, S, S);
     } else if (temp > 16) {
         /* Last message double block is partial */
         temp -= 16;
         romulus2_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(ks->TK1 + 4, m + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, temp);
         memset(ks->TK1 + 4 + temp, 0, 12 - temp - 1);
         ks->TK1[15] = (unsigned char)temp;
         skinny_128_384_encrypt(ks, S, S);
     } else if (temp == 16) {
         /* Last message single block is full */
-        lw_xor_block(S, m, 16);
+        lw_xor_block(S, in, 16);
     } else if (temp > 0) {
         /* Last message single block is partial */
-        lw_xor_block(S, m, temp);
+        lw_xor_block(S, in, temp);
         S[15] ^= (unsigned char)temp;
     }
 
@@ -775,17 +756,19 @@ static void romulus_m2_process_ad
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
- * \param m Points to the message plaintext.
+ * \param m Cursor for the message plaintext.
  * \param mlen Length of the message plaintext.
  */
 static void romulus_m3_process_ad
     (skinny_128_256_key_schedule_t *ks,
      unsigned char S[16], const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char buf[28];
+    const unsigned char *in = buf;
     uint8_t final_domain = 0xB0;
     unsigned temp;
 
@@ -795,30 +778,32 @@ static void romulus_m3_process_ad
     /* Process all associated data double blocks except the last */
     romulus3_set_domain(ks, 0xA8);
     while (adlen > 28) {
+        in = aead_iovec_load_block(ad, buf, 28);
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_256_encrypt(ks, S, S);
         romulus3_update_counter(ks->TK1);
-        ad += 28;
         adlen -= 28;
     }
 
     /* Process the last associated data double block */
     temp = (unsigned)adlen;
+    if (temp > 0)
+        in = aead_iovec_load_block(ad, buf, temp);
     if (temp == 28) {
         /* Last associated data double block is full */
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_256_encrypt(ks, S, S);
         romulus3_update_counter(ks->TK1);
     } else if (temp > 16) {
         /* Last associated data double block is partial */
         temp -= 16;
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, ad, 16);
-        memcpy(ks->TK1 + 4, ad + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, temp);
         memset(ks->TK1 + 4 + temp, 0, 12 - temp - 1);
         ks->TK1[15] = (unsigned char)temp;
         skinny_128_256_encrypt(ks, S, S);
@@ -829,25 +814,23 @@ static void romulus_m3_process_ad
         romulus3_set_domain(ks, 0xAC);
         romulus3_update_counter(ks->TK1);
         if (temp == 16) {
-            lw_xor_block(S, ad, 16);
+            lw_xor_block(S, in, 16);
         } else {
-            lw_xor_block(S, ad, temp);
+            lw_xor_block(S, in, temp);
             S[15] ^= (unsigned char)temp;
         }
         if (mlen > 12) {
-            memcpy(ks->TK1 + 4, m, 12);
+            aead_iovec_read(m, ks->TK1 + 4, 12);
             skinny_128_256_encrypt(ks, S, S);
             romulus3_update_counter(ks->TK1);
-            m += 12;
             mlen -= 12;
         } else if (mlen == 12) {
-            memcpy(ks->TK1 + 4, m, 12);
+            aead_iovec_read(m, ks->TK1 + 4, 12);
             skinny_128_256_encrypt(ks, S, S);
-            m += 12;
             mlen -= 12;
         } else {
             temp = (unsigned)mlen;
-            memcpy(ks->TK1 + 4, m, temp);
+            aead_iovec_read(m, ks->TK1 + 4, temp);
             memset(ks->TK1 + 4 + temp, 0, 12 - temp - 1);
             ks->TK1[15] = (unsigned char)temp;
             skinny_128_256_encrypt(ks, S, S);
@@ -858,38 +841,40 @@ static void romulus_m3_process_ad
     /* Process all message double blocks except the last */
     romulus3_set_domain(ks, 0xAC);
     while (mlen > 28) {
+        in = aead_iovec_load_block(m, buf, 28);
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(ks->TK1 + 4, m + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_256_encrypt(ks, S, S);
         romulus3_update_counter(ks->TK1);
-        m += 28;
         mlen -= 28;
     }
 
     /* Process the last message double block */
     temp = (unsigned)mlen;
+    if (temp > 0)
+        in = aead_iovec_load_block(m, buf, temp);
     if (temp == 28) {
         /* Last message double block is full */
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(ks->TK1 + 4, m + 16, 12);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, 12);
         skinny_128_256_encrypt(ks, S, S);
     } else if (temp > 16) {
         /* Last message double block is partial */
         temp -= 16;
         romulus3_update_counter(ks->TK1);
-        lw_xor_block(S, m, 16);
-        memcpy(ks->TK1 + 4, m + 16, temp);
+        lw_xor_block(S, in, 16);
+        memcpy(ks->TK1 + 4, in + 16, temp);
         memset(ks->TK1 + 4 + temp, 0, 12 - temp - 1);
         ks->TK1[15] = (unsigned char)temp;
         skinny_128_256_encrypt(ks, S, S);
     } else if (temp == 16) {
         /* Last message single block is full */
-        lw_xor_block(S, m, 16);
+        lw_xor_block(S, in, 16);
     } else if (temp > 0) {
         /* Last message single block is partial */
-        lw_xor_block(S, m, temp);
+        lw_xor_block(S, in, temp);
         S[15] ^= (unsigned char)temp;
     }
 
@@ -987,14 +972,19 @@ STATIC_INLINE void romulus_rho_inverse_short
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the buffer containing the plaintext.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_n1_encrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Handle the special case of no plaintext */
@@ -1008,24 +998,28 @@ static void romulus_n1_encrypt
     /* Process all blocks except the last */
     romulus1_set_domain(ks, 0x04);
     while (mlen > 16) {
-        romulus_rho(S, c, m);
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        romulus_rho(S, out, in);
+        aead_iovec_store_end(c, outbuf, out, 16);
         romulus1_update_counter(ks->TK1);
         skinny_128_384_encrypt(ks, S, S);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Pad and process the last block */
     temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
     romulus1_update_counter(ks->TK1);
     if (temp < 16) {
-        romulus_rho_short(S, c, m, temp);
+        romulus_rho_short(S, out, in, temp);
         romulus1_set_domain(ks, 0x15);
     } else {
-        romulus_rho(S, c, m);
+        romulus_rho(S, out, in);
         romulus1_set_domain(ks, 0x14);
     }
+    aead_iovec_store_end(c, outbuf, out, temp);
     skinny_128_384_encrypt(ks, S, S);
 }
 
@@ -1034,14 +1028,19 @@ static void romulus_n1_encrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the buffer containing the ciphertext.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_n1_decrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Handle the special case of no ciphertext */
@@ -1055,24 +1054,28 @@ static void romulus_n1_decrypt
     /* Process all blocks except the last */
     romulus1_set_domain(ks, 0x04);
     while (mlen > 16) {
-        romulus_rho_inverse(S, m, c);
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        romulus_rho_inverse(S, out, in);
+        aead_iovec_store_end(m, outbuf, out, 16);
         romulus1_update_counter(ks->TK1);
         skinny_128_384_encrypt(ks, S, S);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Pad and process the last block */
     temp = (unsigned)mlen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
     romulus1_update_counter(ks->TK1);
     if (temp < 16) {
-        romulus_rho_inverse_short(S, m, c, temp);
+        romulus_rho_inverse_short(S, out, in, temp);
         romulus1_set_domain(ks, 0x15);
     } else {
-        romulus_rho_inverse(S, m, c);
+        romulus_rho_inverse(S, out, in);
         romulus1_set_domain(ks, 0x14);
     }
+    aead_iovec_store_end(m, outbuf, out, temp);
     skinny_128_384_encrypt(ks, S, S);
 }
 
@@ -1081,14 +1084,19 @@ static void romulus_n1_decrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the buffer containing the plaintext.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_n2_encrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Handle the special case of no plaintext */
@@ -1102,24 +1110,28 @@ static void romulus_n2_encrypt
     /* Process all blocks except the last */
     romulus2_set_domain(ks, 0x44);
     while (mlen > 16) {
-        romulus_rho(S, c, m);
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        romulus_rho(S, out, in);
+        aead_iovec_store_end(c, outbuf, out, 16);
         romulus2_update_counter(ks->TK1);
         skinny_128_384_encrypt(ks, S, S);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Pad and process the last block */
     temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
     romulus2_update_counter(ks->TK1);
     if (temp < 16) {
-        romulus_rho_short(S, c, m, temp);
+        romulus_rho_short(S, out, in, temp);
         romulus2_set_domain(ks, 0x55);
     } else {
-        romulus_rho(S, c, m);
+        romulus_rho(S, out, in);
         romulus2_set_domain(ks, 0x54);
     }
+    aead_iovec_store_end(c, outbuf, out, temp);
     skinny_128_384_encrypt(ks, S, S);
 }
 
@@ -1128,14 +1140,19 @@ static void romulus_n2_encrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the buffer containing the ciphertext.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_n2_decrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Handle the special case of no ciphertext */
@@ -1149,24 +1166,28 @@ static void romulus_n2_decrypt
     /* Process all blocks except the last */
     romulus2_set_domain(ks, 0x44);
     while (mlen > 16) {
-        romulus_rho_inverse(S, m, c);
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        romulus_rho_inverse(S, out, in);
+        aead_iovec_store_end(m, outbuf, out, 16);
         romulus2_update_counter(ks->TK1);
         skinny_128_384_encrypt(ks, S, S);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Pad and process the last block */
     temp = (unsigned)mlen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
     romulus2_update_counter(ks->TK1);
     if (temp < 16) {
-        romulus_rho_inverse_short(S, m, c, temp);
+        romulus_rho_inverse_short(S, out, in, temp);
         romulus2_set_domain(ks, 0x55);
     } else {
-        romulus_rho_inverse(S, m, c);
+        romulus_rho_inverse(S, out, in);
         romulus2_set_domain(ks, 0x54);
     }
+    aead_iovec_store_end(m, outbuf, out, temp);
     skinny_128_384_encrypt(ks, S, S);
 }
 
@@ -1175,14 +1196,19 @@ static void romulus_n2_decrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the buffer containing the plaintext.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_n3_encrypt
     (skinny_128_256_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Handle the special case of no plaintext */
@@ -1196,24 +1222,28 @@ static void romulus_n3_encrypt
     /* Process all blocks except the last */
     romulus3_set_domain(ks, 0x84);
     while (mlen > 16) {
-        romulus_rho(S, c, m);
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        romulus_rho(S, out, in);
+        aead_iovec_store_end(c, outbuf, out, 16);
         romulus3_update_counter(ks->TK1);
         skinny_128_256_encrypt(ks, S, S);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Pad and process the last block */
     temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
     romulus3_update_counter(ks->TK1);
     if (temp < 16) {
-        romulus_rho_short(S, c, m, temp);
+        romulus_rho_short(S, out, in, temp);
         romulus3_set_domain(ks, 0x95);
     } else {
-        romulus_rho(S, c, m);
+        romulus_rho(S, out, in);
         romulus3_set_domain(ks, 0x94);
     }
+    aead_iovec_store_end(c, outbuf, out, temp);
     skinny_128_256_encrypt(ks, S, S);
 }
 
@@ -1222,14 +1252,19 @@ static void romulus_n3_encrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the buffer containing the ciphertext.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_n3_decrypt
     (skinny_128_256_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Handle the special case of no ciphertext */
@@ -1243,24 +1278,28 @@ static void romulus_n3_decrypt
     /* Process all blocks except the last */
     romulus3_set_domain(ks, 0x84);
     while (mlen > 16) {
-        romulus_rho_inverse(S, m, c);
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        romulus_rho_inverse(S, out, in);
+        aead_iovec_store_end(m, outbuf, out, 16);
         romulus3_update_counter(ks->TK1);
         skinny_128_256_encrypt(ks, S, S);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Pad and process the last block */
     temp = (unsigned)mlen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
     romulus3_update_counter(ks->TK1);
     if (temp < 16) {
-        romulus_rho_inverse_short(S, m, c, temp);
+        romulus_rho_inverse_short(S, out, in, temp);
         romulus3_set_domain(ks, 0x95);
     } else {
-        romulus_rho_inverse(S, m, c);
+        romulus_rho_inverse(S, out, in);
         romulus3_set_domain(ks, 0x94);
     }
+    aead_iovec_store_end(m, outbuf, out, temp);
     skinny_128_256_encrypt(ks, S, S);
 }
 
@@ -1269,14 +1308,21 @@ static void romulus_n3_decrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the buffer containing the plaintext.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_m1_encrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Nothing to do if the message is empty */
     if (!mlen)
         return;
@@ -1285,16 +1331,21 @@ static void romulus_m1_encrypt
     romulus1_set_domain(ks, 0x24);
     while (mlen > 16) {
         skinny_128_384_encrypt(ks, S, S);
-        romulus_rho(S, c, m);
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        romulus_rho(S, out, in);
+        aead_iovec_store_end(c, outbuf, out, 16);
         romulus1_update_counter(ks->TK1);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Handle the last block */
     skinny_128_384_encrypt(ks, S, S);
-    romulus_rho_short(S, c, m, (unsigned)mlen);
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
+    romulus_rho_short(S, out, in, temp);
+    aead_iovec_store_end(c, outbuf, out, temp);
 }
 
 /**
@@ -1302,14 +1353,21 @@ static void romulus_m1_encrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the buffer containing the ciphertext.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_m1_decrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Nothing to do if the message is empty */
     if (!mlen)
         return;
@@ -1318,16 +1376,21 @@ static void romulus_m1_decrypt
     romulus1_set_domain(ks, 0x24);
     while (mlen > 16) {
         skinny_128_384_encrypt(ks, S, S);
-        romulus_rho_inverse(S, m, c);
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        romulus_rho_inverse(S, out, in);
+        aead_iovec_store_end(m, outbuf, out, 16);
         romulus1_update_counter(ks->TK1);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Handle the last block */
     skinny_128_384_encrypt(ks, S, S);
-    romulus_rho_inverse_short(S, m, c, (unsigned)mlen);
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
+    romulus_rho_inverse_short(S, out, in, temp);
+    aead_iovec_store_end(m, outbuf, out, temp);
 }
 
 /**
@@ -1335,14 +1398,21 @@ static void romulus_m1_decrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the buffer containing the plaintext.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_m2_encrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Nothing to do if the message is empty */
     if (!mlen)
         return;
@@ -1351,16 +1421,21 @@ static void romulus_m2_encrypt
     romulus2_set_domain(ks, 0x64);
     while (mlen > 16) {
         skinny_128_384_encrypt(ks, S, S);
-        romulus_rho(S, c, m);
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        romulus_rho(S, out, in);
+        aead_iovec_store_end(c, outbuf, out, 16);
         romulus2_update_counter(ks->TK1);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Handle the last block */
     skinny_128_384_encrypt(ks, S, S);
-    romulus_rho_short(S, c, m, (unsigned)mlen);
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
+    romulus_rho_short(S, out, in, temp);
+    aead_iovec_store_end(c, outbuf, out, temp);
 }
 
 /**
@@ -1368,14 +1443,21 @@ static void romulus_m2_encrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the buffer containing the ciphertext.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_m2_decrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Nothing to do if the message is empty */
     if (!mlen)
         return;
@@ -1384,16 +1466,21 @@ static void romulus_m2_decrypt
     romulus2_set_domain(ks, 0x64);
     while (mlen > 16) {
         skinny_128_384_encrypt(ks, S, S);
-        romulus_rho_inverse(S, m, c);
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        romulus_rho_inverse(S, out, in);
+        aead_iovec_store_end(m, outbuf, out, 16);
         romulus2_update_counter(ks->TK1);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Handle the last block */
     skinny_128_384_encrypt(ks, S, S);
-    romulus_rho_inverse_short(S, m, c, (unsigned)mlen);
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
+    romulus_rho_inverse_short(S, out, in, temp);
+    aead_iovec_store_end(m, outbuf, out, temp);
 }
 
 /**
@@ -1401,14 +1488,21 @@ static void romulus_m2_decrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the buffer containing the plaintext.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_m3_encrypt
     (skinny_128_256_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Nothing to do if the message is empty */
     if (!mlen)
         return;
@@ -1417,16 +1511,21 @@ static void romulus_m3_encrypt
     romulus3_set_domain(ks, 0xA4);
     while (mlen > 16) {
         skinny_128_256_encrypt(ks, S, S);
-        romulus_rho(S, c, m);
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        romulus_rho(S, out, in);
+        aead_iovec_store_end(c, outbuf, out, 16);
         romulus3_update_counter(ks->TK1);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Handle the last block */
     skinny_128_256_encrypt(ks, S, S);
-    romulus_rho_short(S, c, m, (unsigned)mlen);
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
+    romulus_rho_short(S, out, in, temp);
+    aead_iovec_store_end(c, outbuf, out, temp);
 }
 
 /**
@@ -1434,14 +1533,21 @@ static void romulus_m3_encrypt
  *
  * \param ks Points to the key schedule.
  * \param S The rolling Romulus state.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the buffer containing the ciphertext.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext in bytes.
  */
 static void romulus_m3_decrypt
     (skinny_128_256_key_schedule_t *ks, unsigned char S[16],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen)
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen)
 {
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Nothing to do if the message is empty */
     if (!mlen)
         return;
@@ -1450,16 +1556,21 @@ static void romulus_m3_decrypt
     romulus3_set_domain(ks, 0xA4);
     while (mlen > 16) {
         skinny_128_256_encrypt(ks, S, S);
-        romulus_rho_inverse(S, m, c);
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        romulus_rho_inverse(S, out, in);
+        aead_iovec_store_end(m, outbuf, out, 16);
         romulus3_update_counter(ks->TK1);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
 
     /* Handle the last block */
     skinny_128_256_encrypt(ks, S, S);
-    romulus_rho_inverse_short(S, m, c, (unsigned)mlen);
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
+    romulus_rho_inverse_short(S, out, in, temp);
+    aead_iovec_store_end(m, outbuf, out, temp);
 }
 
 /**
@@ -1478,19 +1589,24 @@ STATIC_INLINE void romulus_generate_tag
     }
 }
 
-int romulus_n1_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int romulus_n1_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ROMULUS_TAG_SIZE))
+        return -2;
     *clen = mlen + ROMULUS_TAG_SIZE;
 
     /* Validate the length of the associated data and message */
@@ -1503,35 +1619,45 @@ int romulus_n1_aead_encrypt
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_n1_process_ad(&ks, S, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    romulus_n1_process_ad(&ks, S, npub, &adcur, adlen);
 
     /* Re-initialize the key schedule with the key and nonce */
     romulus1_init(&ks, k, npub);
 
     /* Encrypts the plaintext to produce the ciphertext */
-    romulus_n1_encrypt(&ks, S, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_n1_encrypt(&ks, S, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    romulus_generate_tag(c + mlen, S);
+    romulus_generate_tag(S, S);
+    aead_iovec_write(&ccur, S, ROMULUS_TAG_SIZE);
     return 0;
 }
 
-int romulus_n1_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int romulus_n1_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
+    unsigned char tag[ROMULUS_TAG_SIZE];
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ROMULUS_TAG_SIZE)
         return -1;
     *mlen = clen - ROMULUS_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT ||
@@ -1544,193 +1670,440 @@ int romulus_n1_aead_decrypt
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_n1_process_ad(&ks, S, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    romulus_n1_process_ad(&ks, S, npub, &adcur, adlen);
 
     /* Re-initialize the key schedule with the key and nonce */
     romulus1_init(&ks, k, npub);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= ROMULUS_TAG_SIZE;
-    romulus_n1_decrypt(&ks, S, m, c, clen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_n1_decrypt(&ks, S, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     romulus_generate_tag(S, S);
-    return aead_check_tag(m, clen, S, c + clen, ROMULUS_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, ROMULUS_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, clen, S, tag, ROMULUS_TAG_SIZE);
 }
 
-int romulus_n2_aead_encrypt
+int romulus_n1_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ROMULUS_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_n1_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int romulus_n1_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ROMULUS_TAG_SIZE ?
+                   clen - ROMULUS_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_n1_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with
+ * Romulus-N2 using a key context that was set up previously.
+ *
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the ciphertext and tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, or -2 if \a c is too small or the
+ * packet is too long.
+ */
+static int romulus_n2_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const void *ctx)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ROMULUS_TAG_SIZE))
+        return -2;
     *clen = mlen + ROMULUS_TAG_SIZE;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT || mlen > ROMULUS_DATA_LIMIT)
         return -2;
 
-    /* Initialize the key schedule with the key and no nonce.  Associated
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus2_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_n2_process_ad(&ks, S, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    romulus_n2_process_ad(&ks, S, npub, &adcur, adlen);
 
-    /* Re-initialize the key schedule with the key and nonce */
-    romulus2_init(&ks, k, npub);
+    /* Re-initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Encrypts the plaintext to produce the ciphertext */
-    romulus_n2_encrypt(&ks, S, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_n2_encrypt(&ks, S, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    romulus_generate_tag(c + mlen, S);
+    romulus_generate_tag(S, S);
+    aead_iovec_write(&ccur, S, ROMULUS_TAG_SIZE);
     return 0;
 }
 
-int romulus_n2_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with
+ * Romulus-N2 using a key context that was set up previously.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if \a m is too small or the packet is too long.
+ */
+static int romulus_n2_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
+    unsigned char tag[ROMULUS_TAG_SIZE];
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ROMULUS_TAG_SIZE)
         return -1;
     *mlen = clen - ROMULUS_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT ||
             clen > (ROMULUS_DATA_LIMIT + ROMULUS_TAG_SIZE))
         return -2;
 
-    /* Initialize the key schedule with the key and no nonce.  Associated
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus2_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_n2_process_ad(&ks, S, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    romulus_n2_process_ad(&ks, S, npub, &adcur, adlen);
 
-    /* Re-initialize the key schedule with the key and nonce */
-    romulus2_init(&ks, k, npub);
+    /* Re-initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= ROMULUS_TAG_SIZE;
-    romulus_n2_decrypt(&ks, S, m, c, clen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_n2_decrypt(&ks, S, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     romulus_generate_tag(S, S);
-    return aead_check_tag(m, clen, S, c + clen, ROMULUS_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, ROMULUS_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, clen, S, tag, ROMULUS_TAG_SIZE);
 }
 
-int romulus_n3_aead_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with Romulus-N2 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int romulus_n2_aead_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + ROMULUS_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_n2_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with Romulus-N2 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int romulus_n2_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ROMULUS_TAG_SIZE ?
+                   clen - ROMULUS_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_n2_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with
+ * Romulus-N3 using a key context that was set up previously.
+ *
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the ciphertext and tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, or -2 if \a c is too small or the
+ * packet is too long.
+ */
+static int romulus_n3_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const void *ctx)
 {
     skinny_128_256_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ROMULUS_TAG_SIZE))
+        return -2;
     *clen = mlen + ROMULUS_TAG_SIZE;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT || mlen > ROMULUS_DATA_LIMIT)
         return -2;
 
-    /* Initialize the key schedule with the key and no nonce.  Associated
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus3_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_n3_process_ad(&ks, S, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    romulus_n3_process_ad(&ks, S, npub, &adcur, adlen);
 
-    /* Re-initialize the key schedule with the key and nonce */
-    romulus3_init(&ks, k, npub);
+    /* Re-initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Encrypts the plaintext to produce the ciphertext */
-    romulus_n3_encrypt(&ks, S, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_n3_encrypt(&ks, S, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    romulus_generate_tag(c + mlen, S);
+    romulus_generate_tag(S, S);
+    aead_iovec_write(&ccur, S, ROMULUS_TAG_SIZE);
     return 0;
 }
 
-int romulus_n3_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with
+ * Romulus-N3 using a key context that was set up previously.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if \a m is too small or the packet is too long.
+ */
+static int romulus_n3_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
     skinny_128_256_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
+    unsigned char tag[ROMULUS_TAG_SIZE];
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ROMULUS_TAG_SIZE)
         return -1;
     *mlen = clen - ROMULUS_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT ||
             clen > (ROMULUS_DATA_LIMIT + ROMULUS_TAG_SIZE))
         return -2;
 
-    /* Initialize the key schedule with the key and no nonce.  Associated
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus3_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_n3_process_ad(&ks, S, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    romulus_n3_process_ad(&ks, S, npub, &adcur, adlen);
 
-    /* Re-initialize the key schedule with the key and nonce */
-    romulus3_init(&ks, k, npub);
+    /* Re-initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= ROMULUS_TAG_SIZE;
-    romulus_n3_decrypt(&ks, S, m, c, clen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_n3_decrypt(&ks, S, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     romulus_generate_tag(S, S);
-    return aead_check_tag(m, clen, S, c + clen, ROMULUS_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, ROMULUS_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, clen, S, tag, ROMULUS_TAG_SIZE);
 }
 
-int romulus_m1_aead_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with Romulus-N3 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int romulus_n3_aead_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + ROMULUS_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_n3_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with Romulus-N3 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int romulus_n3_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ROMULUS_TAG_SIZE ?
+                   clen - ROMULUS_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_n3_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+int romulus_m1_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
      const unsigned char *k)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
+    unsigned char tag[ROMULUS_TAG_SIZE];
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ROMULUS_TAG_SIZE))
+        return -2;
     *clen = mlen + ROMULUS_TAG_SIZE;
 
     /* Validate the length of the associated data and message */
@@ -1743,37 +2116,48 @@ int romulus_m1_aead_encrypt
 
     /* Process the associated data and the plaintext message */
     memset(S, 0, sizeof(S));
-    romulus_m1_process_ad(&ks, S, npub, ad, adlen, m, mlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m1_process_ad(&ks, S, npub, &adcur, adlen, &mcur, mlen);
 
     /* Generate the authentication tag, which is also the initialization
      * vector for the encryption portion of the packet processing */
     romulus_generate_tag(S, S);
-    memcpy(c + mlen, S, ROMULUS_TAG_SIZE);
+    memcpy(tag, S, ROMULUS_TAG_SIZE);
 
     /* Re-initialize the key schedule with the key and nonce */
     romulus1_init(&ks, k, npub);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    romulus_m1_encrypt(&ks, S, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m1_encrypt(&ks, S, &ccur, &mcur, mlen);
+    aead_iovec_write(&ccur, tag, ROMULUS_TAG_SIZE);
     return 0;
 }
 
-int romulus_m1_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int romulus_m1_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
+    unsigned char tag[ROMULUS_TAG_SIZE];
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ROMULUS_TAG_SIZE)
         return -1;
     *mlen = clen - ROMULUS_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT ||
@@ -1786,8 +2170,13 @@ int romulus_m1_aead_decrypt
     /* Decrypt the ciphertext to produce the plaintext, using the
      * authentication tag as the initialization vector for decryption */
     clen -= ROMULUS_TAG_SIZE;
-    memcpy(S, c + clen, ROMULUS_TAG_SIZE);
-    romulus_m1_decrypt(&ks, S, m, c, clen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_skip(&ccur, clen);
+    aead_iovec_read(&ccur, tag, ROMULUS_TAG_SIZE);
+    memcpy(S, tag, ROMULUS_TAG_SIZE);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m1_decrypt(&ks, S, &mcur, &ccur, clen);
 
     /* Re-initialize the key schedule with the key and no nonce.  Associated
      * data processing varies the nonce from block to block */
@@ -1795,180 +2184,806 @@ int romulus_m1_aead_decrypt
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_m1_process_ad(&ks, S, npub, ad, adlen, m, clen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m1_process_ad(&ks, S, npub, &adcur, adlen, &mcur, clen);
 
     /* Check the authentication tag */
     romulus_generate_tag(S, S);
-    return aead_check_tag(m, clen, S, c + clen, ROMULUS_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, clen, S, tag, ROMULUS_TAG_SIZE);
 }
 
-int romulus_m2_aead_encrypt
+int romulus_m1_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ROMULUS_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_m1_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int romulus_m1_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ROMULUS_TAG_SIZE ?
+                   clen - ROMULUS_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_m1_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with
+ * Romulus-M2 using a key context that was set up previously.
+ *
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the ciphertext and tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, or -2 if \a c is too small or the
+ * packet is too long.
+ */
+static int romulus_m2_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const void *ctx)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
+    unsigned char tag[ROMULUS_TAG_SIZE];
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ROMULUS_TAG_SIZE))
+        return -2;
     *clen = mlen + ROMULUS_TAG_SIZE;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT || mlen > ROMULUS_DATA_LIMIT)
         return -2;
 
-    /* Initialize the key schedule with the key and no nonce.  Associated
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus2_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data and the plaintext message */
     memset(S, 0, sizeof(S));
-    romulus_m2_process_ad(&ks, S, npub, ad, adlen, m, mlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m2_process_ad(&ks, S, npub, &adcur, adlen, &mcur, mlen);
 
     /* Generate the authentication tag, which is also the initialization
      * vector for the encryption portion of the packet processing */
     romulus_generate_tag(S, S);
-    memcpy(c + mlen, S, ROMULUS_TAG_SIZE);
+    memcpy(tag, S, ROMULUS_TAG_SIZE);
 
-    /* Re-initialize the key schedule with the key and nonce */
-    romulus2_init(&ks, k, npub);
+    /* Re-initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    romulus_m2_encrypt(&ks, S, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m2_encrypt(&ks, S, &ccur, &mcur, mlen);
+    aead_iovec_write(&ccur, tag, ROMULUS_TAG_SIZE);
     return 0;
 }
 
-int romulus_m2_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with
+ * Romulus-M2 using a key context that was set up previously.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if \a m is too small or the packet is too long.
+ */
+static int romulus_m2_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
+    unsigned char tag[ROMULUS_TAG_SIZE];
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ROMULUS_TAG_SIZE)
         return -1;
     *mlen = clen - ROMULUS_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT ||
             clen > (ROMULUS_DATA_LIMIT + ROMULUS_TAG_SIZE))
         return -2;
 
-    /* Initialize the key schedule with the key and nonce */
-    romulus2_init(&ks, k, npub);
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Decrypt the ciphertext to produce the plaintext, using the
      * authentication tag as the initialization vector for decryption */
     clen -= ROMULUS_TAG_SIZE;
-    memcpy(S, c + clen, ROMULUS_TAG_SIZE);
-    romulus_m2_decrypt(&ks, S, m, c, clen);
-
-    /* Re-initialize the key schedule with the key and no nonce.  Associated
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_skip(&ccur, clen);
+    aead_iovec_read(&ccur, tag, ROMULUS_TAG_SIZE);
+    memcpy(S, tag, ROMULUS_TAG_SIZE);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m2_decrypt(&ks, S, &mcur, &ccur, clen);
+
+    /* Re-initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus2_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_m2_process_ad(&ks, S, npub, ad, adlen, m, clen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m2_process_ad(&ks, S, npub, &adcur, adlen, &mcur, clen);
 
     /* Check the authentication tag */
     romulus_generate_tag(S, S);
-    return aead_check_tag(m, clen, S, c + clen, ROMULUS_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, clen, S, tag, ROMULUS_TAG_SIZE);
 }
 
-int romulus_m3_aead_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with Romulus-M2 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int romulus_m2_aead_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + ROMULUS_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_m2_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with Romulus-M2 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int romulus_m2_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ROMULUS_TAG_SIZE ?
+                   clen - ROMULUS_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_m2_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with
+ * Romulus-M3 using a key context that was set up previously.
+ *
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the ciphertext and tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, or -2 if \a c is too small or the
+ * packet is too long.
+ */
+static int romulus_m3_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const void *ctx)
 {
     skinny_128_256_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
+    unsigned char tag[ROMULUS_TAG_SIZE];
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ROMULUS_TAG_SIZE))
+        return -2;
     *clen = mlen + ROMULUS_TAG_SIZE;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT || mlen > ROMULUS_DATA_LIMIT)
         return -2;
 
-    /* Initialize the key schedule with the key and nonce */
-    romulus3_init(&ks, k, npub);
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
 
-    /* Initialize the key schedule with the key and no nonce.  Associated
+    /* Initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus3_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data and the plaintext message */
     memset(S, 0, sizeof(S));
-    romulus_m3_process_ad(&ks, S, npub, ad, adlen, m, mlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m3_process_ad(&ks, S, npub, &adcur, adlen, &mcur, mlen);
 
     /* Generate the authentication tag, which is also the initialization
      * vector for the encryption portion of the packet processing */
     romulus_generate_tag(S, S);
-    memcpy(c + mlen, S, ROMULUS_TAG_SIZE);
+    memcpy(tag, S, ROMULUS_TAG_SIZE);
 
-    /* Re-initialize the key schedule with the key and nonce */
-    romulus3_init(&ks, k, npub);
+    /* Re-initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    romulus_m3_encrypt(&ks, S, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m3_encrypt(&ks, S, &ccur, &mcur, mlen);
+    aead_iovec_write(&ccur, tag, ROMULUS_TAG_SIZE);
     return 0;
 }
 
-int romulus_m3_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with
+ * Romulus-M3 using a key context that was set up previously.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if \a m is too small or the packet is too long.
+ */
+static int romulus_m3_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
     skinny_128_256_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     unsigned char S[16];
-    (void)nsec;
+    unsigned char tag[ROMULUS_TAG_SIZE];
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ROMULUS_TAG_SIZE)
         return -1;
     *mlen = clen - ROMULUS_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Validate the length of the associated data and message */
     if (adlen > ROMULUS_DATA_LIMIT ||
             clen > (ROMULUS_DATA_LIMIT + ROMULUS_TAG_SIZE))
         return -2;
 
-    /* Initialize the key schedule with the key and nonce */
-    romulus3_init(&ks, k, npub);
+    /* Copy the key schedule from the key context */
+    memcpy(&ks, ctx, sizeof(ks));
+
+    /* Initialize the tweak with the nonce */
+    romulus23_init_tk1(ks.TK1, npub);
 
     /* Decrypt the ciphertext to produce the plaintext, using the
      * authentication tag as the initialization vector for decryption */
     clen -= ROMULUS_TAG_SIZE;
-    memcpy(S, c + clen, ROMULUS_TAG_SIZE);
-    romulus_m3_decrypt(&ks, S, m, c, clen);
-
-    /* Re-initialize the key schedule with the key and no nonce.  Associated
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_skip(&ccur, clen);
+    aead_iovec_read(&ccur, tag, ROMULUS_TAG_SIZE);
+    memcpy(S, tag, ROMULUS_TAG_SIZE);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m3_decrypt(&ks, S, &mcur, &ccur, clen);
+
+    /* Re-initialize the tweak with no nonce.  Associated
      * data processing varies the nonce from block to block */
-    romulus3_init(&ks, k, 0);
+    romulus23_init_tk1(ks.TK1, 0);
 
     /* Process the associated data */
     memset(S, 0, sizeof(S));
-    romulus_m3_process_ad(&ks, S, npub, ad, adlen, m, clen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    aead_iovec_start(&mcur, m, m_count);
+    romulus_m3_process_ad(&ks, S, npub, &adcur, adlen, &mcur, clen);
 
     /* Check the authentication tag */
     romulus_generate_tag(S, S);
-    return aead_check_tag(m, clen, S, c + clen, ROMULUS_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, clen, S, tag, ROMULUS_TAG_SIZE);
+}
+
+/**
+ * \brief Encrypts and authenticates a packet with Romulus-M3 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int romulus_m3_aead_encrypt_ctx
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + ROMULUS_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_m3_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with Romulus-M3 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int romulus_m3_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ROMULUS_TAG_SIZE ?
+                   clen - ROMULUS_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return romulus_m3_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Sets up the key schedule for Romulus-N2 or Romulus-M2.
+ *
+ * \param ctx Points to the SKINNY-128-384 key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ */
+static void romulus2_setup_key(void *ctx, const unsigned char *k)
+{
+    romulus2_init((skinny_128_384_key_schedule_t *)ctx, k, 0);
+}
+
+/**
+ * \brief Sets up the key schedule for Romulus-N3 or Romulus-M3.
+ *
+ * \param ctx Points to the SKINNY-128-256 key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ */
+static void romulus3_setup_key(void *ctx, const unsigned char *k)
+{
+    romulus3_init((skinny_128_256_key_schedule_t *)ctx, k, 0);
+}
+
+int romulus_n2_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    romulus2_init(&ks, k, 0);
+    return romulus_n2_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int romulus_n2_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    romulus2_init(&ks, k, 0);
+    return romulus_n2_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int romulus_n3_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    romulus3_init(&ks, k, 0);
+    return romulus_n3_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int romulus_n3_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    romulus3_init(&ks, k, 0);
+    return romulus_n3_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int romulus_m2_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    romulus2_init(&ks, k, 0);
+    return romulus_m2_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int romulus_m2_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    romulus2_init(&ks, k, 0);
+    return romulus_m2_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int romulus_m3_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    romulus3_init(&ks, k, 0);
+    return romulus_m3_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int romulus_m3_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    romulus3_init(&ks, k, 0);
+    return romulus_m3_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int romulus_n2_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    (void)nsec;
+    romulus2_init(&ks, k, 0);
+    return romulus_n2_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, npub, &ks);
 }
+
+int romulus_n2_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    (void)nsec;
+    romulus2_init(&ks, k, 0);
+    return romulus_n2_aead_decrypt_vec_ctx
+        (m, m_count, mlen, c, c_count, ad, ad_count, npub, &ks);
+}
+
+int romulus_n3_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    (void)nsec;
+    romulus3_init(&ks, k, 0);
+    return romulus_n3_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, npub, &ks);
+}
+
+int romulus_n3_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    (void)nsec;
+    romulus3_init(&ks, k, 0);
+    return romulus_n3_aead_decrypt_vec_ctx
+        (m, m_count, mlen, c, c_count, ad, ad_count, npub, &ks);
+}
+
+int romulus_m2_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    (void)nsec;
+    romulus2_init(&ks, k, 0);
+    return romulus_m2_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, npub, &ks);
+}
+
+int romulus_m2_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_384_key_schedule_t ks;
+    (void)nsec;
+    romulus2_init(&ks, k, 0);
+    return romulus_m2_aead_decrypt_vec_ctx
+        (m, m_count, mlen, c, c_count, ad, ad_count, npub, &ks);
+}
+
+int romulus_m3_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    (void)nsec;
+    romulus3_init(&ks, k, 0);
+    return romulus_m3_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, npub, &ks);
+}
+
+int romulus_m3_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_key_schedule_t ks;
+    (void)nsec;
+    romulus3_init(&ks, k, 0);
+    return romulus_m3_aead_decrypt_vec_ctx
+        (m, m_count, mlen, c, c_count, ad, ad_count, npub, &ks);
+}
+
+aead_cipher_t const romulus_n1_cipher = {
+    "Romulus-N1",
+    ROMULUS_KEY_SIZE,
+    ROMULUS1_NONCE_SIZE,
+    ROMULUS_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    romulus_n1_aead_encrypt,
+    romulus_n1_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    romulus_n1_aead_encrypt_vec,
+    romulus_n1_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const romulus_n2_cipher = {
+    "Romulus-N2",
+    ROMULUS_KEY_SIZE,
+    ROMULUS2_NONCE_SIZE,
+    ROMULUS_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    romulus_n2_aead_encrypt,
+    romulus_n2_aead_decrypt,
+    sizeof(skinny_128_384_key_schedule_t),
+    romulus2_setup_key,
+    romulus_n2_aead_encrypt_ctx,
+    romulus_n2_aead_decrypt_ctx,
+    romulus_n2_aead_encrypt_vec,
+    romulus_n2_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const romulus_n3_cipher = {
+    "Romulus-N3",
+    ROMULUS_KEY_SIZE,
+    ROMULUS3_NONCE_SIZE,
+    ROMULUS_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    romulus_n3_aead_encrypt,
+    romulus_n3_aead_decrypt,
+    sizeof(skinny_128_256_key_schedule_t),
+    romulus3_setup_key,
+    romulus_n3_aead_encrypt_ctx,
+    romulus_n3_aead_decrypt_ctx,
+    romulus_n3_aead_encrypt_vec,
+    romulus_n3_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const romulus_m1_cipher = {
+    "Romulus-M1",
+    ROMULUS_KEY_SIZE,
+    ROMULUS1_NONCE_SIZE,
+    ROMULUS_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    romulus_m1_aead_encrypt,
+    romulus_m1_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    romulus_m1_aead_encrypt_vec,
+    romulus_m1_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const romulus_m2_cipher = {
+    "Romulus-M2",
+    ROMULUS_KEY_SIZE,
+    ROMULUS2_NONCE_SIZE,
+    ROMULUS_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    romulus_m2_aead_encrypt,
+    romulus_m2_aead_decrypt,
+    sizeof(skinny_128_384_key_schedule_t),
+    romulus2_setup_key,
+    romulus_m2_aead_encrypt_ctx,
+    romulus_m2_aead_decrypt_ctx,
+    romulus_m2_aead_encrypt_vec,
+    romulus_m2_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const romulus_m3_cipher = {
+    "Romulus-M3",
+    ROMULUS_KEY_SIZE,
+    ROMULUS3_NONCE_SIZE,
+    ROMULUS_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    romulus_m3_aead_encrypt,
+    romulus_m3_aead_decrypt,
+    sizeof(skinny_128_256_key_schedule_t),
+    romulus3_setup_key,
+    romulus_m3_aead_encrypt_ctx,
+    romulus_m3_aead_decrypt_ctx,
+    romulus_m3_aead_encrypt_vec,
+    romulus_m3_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
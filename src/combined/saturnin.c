@@ -22,28 +22,9 @@
 
 #include "saturnin.h"
 #include "internal-saturnin.h"
+#include "internal-iovec.h"
 #include <string.h>
 
-aead_cipher_t const saturnin_cipher = {
-    "SATURNIN-CTR-Cascade",
-    SATURNIN_KEY_SIZE,
-    SATURNIN_NONCE_SIZE,
-    SATURNIN_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    saturnin_aead_encrypt,
-    saturnin_aead_decrypt
-};
-
-aead_cipher_t const saturnin_short_cipher = {
-    "SATURNIN-Short",
-    SATURNIN_KEY_SIZE,
-    SATURNIN_NONCE_SIZE,
-    SATURNIN_TAG_SIZE,
-    AEAD_FLAG_NONE,
-    saturnin_short_aead_encrypt,
-    saturnin_short_aead_decrypt
-};
-
 aead_hash_algorithm_t const saturnin_hash_algorithm = {
     "SATURNIN-Hash",
     sizeof(saturnin_hash_state_t),
@@ -57,6 +38,19 @@ aead_hash_algorithm_t const saturnin_hash_algorithm = {
     0  /* squeeze */
 };
 
+/**
+ * \brief Key context for SATURNIN-CTR-Cascade and SATURNIN-Short.
+ */
+typedef struct
+{
+    /** Key schedule for the key, as used by the CTR and Short modes */
+    saturnin_key_schedule_t ks;
+
+    /** Copy of the key, which is the initial state for the cascade */
+    unsigned char k[SATURNIN_KEY_SIZE];
+
+} saturnin_context_t;
+
 /**
  * \brief Encrypts a 256-bit block with the SATURNIN block cipher and
  * then XOR's itself to generate a new key.
@@ -78,33 +72,49 @@ static void saturnin_block_encrypt_xor
 /**
  * \brief Encrypts (or decrypts) a data packet in CTR mode.
  *
- * \param c Output ciphertext buffer.
- * \param m Input plaintext buffer.
+ * \param c Cursor for the output ciphertext.
+ * \param m Cursor for the input plaintext.
  * \param mlen Length of the plaintext in bytes.
  * \param ks Points to the key schedule.
  * \param block Points to the pre-formatted nonce block.
+ *
+ * The counter blocks are independent, so we generate the keystream for
+ * up to SATURNIN_BLOCKS_MAX blocks at a time with saturnin_encrypt_blocks().
  */
 static void saturnin_ctr_encrypt
-    (unsigned char *c, const unsigned char *m, unsigned long long mlen,
+    (aead_iovec_cursor_t *c, aead_iovec_cursor_t *m, unsigned long long mlen,
      const saturnin_key_schedule_t *ks, unsigned char *block)
 {
     /* Note: Specification requires a 95-bit counter but we only use 32-bit.
      * This limits the maximum packet size to 128Gb.  That should be OK */
     uint32_t counter = 1;
-    unsigned char out[SATURNIN_BLOCK_SIZE];
-    while (mlen >= 32) {
-        be_store_word32(block + 28, counter);
-        saturnin_encrypt_block(ks, out, block, SATURNIN_DOMAIN_10_1);
-        lw_xor_block_2_src(c, out, m, 32);
-        c += 32;
-        m += 32;
-        mlen -= 32;
-        ++counter;
-    }
-    if (mlen > 0) {
-        be_store_word32(block + 28, counter);
-        saturnin_encrypt_block(ks, out, block, SATURNIN_DOMAIN_10_1);
-        lw_xor_block_2_src(c, out, m, (unsigned)mlen);
+    unsigned char out[SATURNIN_BLOCK_SIZE * SATURNIN_BLOCKS_MAX];
+    unsigned count, index, len, posn;
+    size_t chunk;
+    while (mlen > 0) {
+        /* Format the counter blocks for the next group */
+        count = (unsigned)((mlen + 31) / 32);
+        if (count > SATURNIN_BLOCKS_MAX)
+            count = SATURNIN_BLOCKS_MAX;
+        for (index = 0; index < count; ++index, ++counter) {
+            be_store_word32(block + 28, counter);
+            memcpy(out + index * 32, block, 32);
+        }
+
+        /* Generate the keystream and XOR it with the input segments */
+        saturnin_encrypt_blocks(ks, out, out, count, SATURNIN_DOMAIN_10_1);
+        len = count * 32;
+        if (mlen < len)
+            len = (unsigned)mlen;
+        for (posn = 0; posn < len; posn += (unsigned)chunk) {
+            chunk = aead_iovec_chunk(m, len - posn);
+            chunk = aead_iovec_chunk(c, chunk);
+            lw_xor_block_2_src
+                (aead_iovec_ptr(c), out + posn, aead_iovec_ptr(m), chunk);
+            aead_iovec_advance(c, chunk);
+            aead_iovec_advance(m, chunk);
+        }
+        mlen -= len;
     }
 }
 
@@ -113,44 +123,57 @@ static void saturnin_ctr_encrypt
  *
  * \param tag Points to the authentication tag.
  * \param block Temporary block of 32 bytes from the caller.
- * \param m Points to the message to be authenticated.
+ * \param m Cursor for the message to be authenticated.
  * \param mlen Length of the message to be authenticated in bytes.
  * \param domain1 Round count and domain separator for full blocks.
  * \param domain2 Round count and domain separator for the last block.
  */
 static void saturnin_authenticate
     (unsigned char *tag, unsigned char *block,
-     const unsigned char *m, unsigned long long mlen,
+     aead_iovec_cursor_t *m, unsigned long long mlen,
      unsigned domain1, unsigned domain2)
 {
     unsigned temp;
     while (mlen >= 32) {
-        saturnin_block_encrypt_xor(m, tag, domain1);
-        m += 32;
+        saturnin_block_encrypt_xor
+            (aead_iovec_load_block(m, block, 32), tag, domain1);
         mlen -= 32;
     }
     temp = (unsigned)mlen;
-    memcpy(block, m, temp);
+    aead_iovec_read(m, block, temp);
     block[temp] = 0x80;
     memset(block + temp + 1, 0, 31 - temp);
     saturnin_block_encrypt_xor(block, tag, domain2);
 }
 
-int saturnin_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Encrypts and authenticates a packet with SATURNIN-CTR-Cascade using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int saturnin_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    saturnin_key_schedule_t ks;
+    const saturnin_context_t *context = (const saturnin_context_t *)ctx;
     unsigned char block[32];
-    unsigned char *tag;
+    unsigned char tag[32];
+    aead_iovec_cursor_t ccur, mcur, adcur, ctext;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SATURNIN_TAG_SIZE))
+        return -2;
     *clen = mlen + SATURNIN_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Format the input block from the padded nonce */
     memcpy(block, npub, 16);
@@ -158,40 +181,55 @@ int saturnin_aead_encrypt
     memset(block + 17, 0, 15);
 
     /* Encrypt the plaintext in counter mode to produce the ciphertext */
-    saturnin_setup_key(&ks, k);
-    saturnin_ctr_encrypt(c, m, mlen, &ks, block);
+    saturnin_ctr_encrypt(&ccur, &mcur, mlen, &(context->ks), block);
 
     /* Set the counter back to zero and then encrypt the nonce */
-    tag = c + mlen;
-    memcpy(tag, k, 32);
+    memcpy(tag, context->k, 32);
     memset(block + 17, 0, 15);
     saturnin_block_encrypt_xor(block, tag, SATURNIN_DOMAIN_10_2);
 
     /* Authenticate the associated data and the ciphertext */
     saturnin_authenticate
-        (tag, block, ad, adlen, SATURNIN_DOMAIN_10_2, SATURNIN_DOMAIN_10_3);
+        (tag, block, &adcur, adlen,
+         SATURNIN_DOMAIN_10_2, SATURNIN_DOMAIN_10_3);
+    aead_iovec_start(&ctext, c, c_count);
     saturnin_authenticate
-        (tag, block, c, mlen, SATURNIN_DOMAIN_10_4, SATURNIN_DOMAIN_10_5);
+        (tag, block, &ctext, mlen, SATURNIN_DOMAIN_10_4, SATURNIN_DOMAIN_10_5);
+    aead_iovec_write(&ccur, tag, SATURNIN_TAG_SIZE);
     return 0;
 }
 
-int saturnin_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+/**
+ * \brief Decrypts and authenticates a packet with SATURNIN-CTR-Cascade using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int saturnin_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    saturnin_key_schedule_t ks;
+    const saturnin_context_t *context = (const saturnin_context_t *)ctx;
     unsigned char block[32];
     unsigned char tag[32];
+    unsigned char received[SATURNIN_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SATURNIN_TAG_SIZE)
         return -1;
     *mlen = clen - SATURNIN_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Format the input block from the padded nonce */
     memcpy(block, npub, 16);
@@ -199,36 +237,90 @@ int saturnin_aead_decrypt
     memset(block + 17, 0, 15);
 
     /* Encrypt the nonce to initialize the authentication phase */
-    memcpy(tag, k, 32);
+    memcpy(tag, context->k, 32);
     saturnin_block_encrypt_xor(block, tag, SATURNIN_DOMAIN_10_2);
 
-    /* Authenticate the associated data and the ciphertext */
+    /* Authenticate the associated data and the ciphertext, which leaves
+     * the ciphertext cursor pointing at the received tag */
     saturnin_authenticate
-        (tag, block, ad, adlen, SATURNIN_DOMAIN_10_2, SATURNIN_DOMAIN_10_3);
+        (tag, block, &adcur, adlen,
+         SATURNIN_DOMAIN_10_2, SATURNIN_DOMAIN_10_3);
     saturnin_authenticate
-        (tag, block, c, *mlen, SATURNIN_DOMAIN_10_4, SATURNIN_DOMAIN_10_5);
+        (tag, block, &ccur, *mlen, SATURNIN_DOMAIN_10_4, SATURNIN_DOMAIN_10_5);
+    aead_iovec_read(&ccur, received, SATURNIN_TAG_SIZE);
 
     /* Decrypt the ciphertext in counter mode to produce the plaintext */
     memcpy(block, npub, 16);
     block[16] = 0x80;
     memset(block + 17, 0, 15);
-    saturnin_setup_key(&ks, k);
-    saturnin_ctr_encrypt(m, c, *mlen, &ks, block);
+    aead_iovec_start(&ccur, c, c_count);
+    saturnin_ctr_encrypt(&mcur, &ccur, *mlen, &(context->ks), block);
 
     /* Check the authentication tag at the end of the message */
-    return aead_check_tag
-        (m, *mlen, tag, c + *mlen, SATURNIN_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, SATURNIN_TAG_SIZE);
 }
 
-int saturnin_short_aead_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with SATURNIN-CTR-Cascade using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int saturnin_aead_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    saturnin_key_schedule_t ks;
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SATURNIN_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return saturnin_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with SATURNIN-CTR-Cascade using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int saturnin_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SATURNIN_TAG_SIZE ?
+                   clen - SATURNIN_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return saturnin_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Encrypts and authenticates a packet with SATURNIN-Short using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int saturnin_short_aead_encrypt_ctx
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    const saturnin_context_t *context = (const saturnin_context_t *)ctx;
     unsigned char block[32];
     unsigned temp;
     (void)nsec;
@@ -246,21 +338,26 @@ int saturnin_short_aead_encrypt
     memset(block + 17 + temp, 0, 15 - temp);
 
     /* Encrypt the input block to produce the output ciphertext */
-    saturnin_setup_key(&ks, k);
-    saturnin_encrypt_block(&ks, c, block, SATURNIN_DOMAIN_10_6);
+    saturnin_encrypt_block(&(context->ks), c, block, SATURNIN_DOMAIN_10_6);
     *clen = 32;
     return 0;
 }
 
-int saturnin_short_aead_decrypt
+/**
+ * \brief Decrypts and authenticates a packet with SATURNIN-Short using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int saturnin_short_aead_decrypt_ctx
     (unsigned char *m, unsigned long long *mlen,
      unsigned char *nsec,
      const unsigned char *c, unsigned long long clen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    saturnin_key_schedule_t ks;
+    const saturnin_context_t *context = (const saturnin_context_t *)ctx;
     unsigned char block[32];
     unsigned check1, check2, len;
     int index, result;
@@ -274,8 +371,7 @@ int saturnin_short_aead_decrypt
         return -1;
 
     /* Decrypt the ciphertext block */
-    saturnin_setup_key(&ks, k);
-    saturnin_decrypt_block(&ks, block, c, SATURNIN_DOMAIN_10_6);
+    saturnin_decrypt_block(&(context->ks), block, c, SATURNIN_DOMAIN_10_6);
 
     /* Verify that the output block starts with the nonce and that it is
      * padded correctly.  We need to do this very carefully to avoid leaking
@@ -310,14 +406,158 @@ int saturnin_short_aead_decrypt
     return ~result;
 }
 
+/**
+ * \brief Sets up the key context for SATURNIN-CTR-Cascade or SATURNIN-Short.
+ *
+ * \param ctx Points to the key context to initialize.
+ * \param k Points to the 32 bytes of the key.
+ */
+static void saturnin_aead_setup_key(void *ctx, const unsigned char *k)
+{
+    saturnin_context_t *context = (saturnin_context_t *)ctx;
+    saturnin_setup_key(&(context->ks), k);
+    memcpy(context->k, k, SATURNIN_KEY_SIZE);
+}
+
+int saturnin_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    saturnin_context_t context;
+    saturnin_aead_setup_key(&context, k);
+    return saturnin_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &context);
+}
+
+int saturnin_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    saturnin_context_t context;
+    saturnin_aead_setup_key(&context, k);
+    return saturnin_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &context);
+}
+
+int saturnin_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    saturnin_context_t context;
+    saturnin_aead_setup_key(&context, k);
+    return saturnin_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, nsec, npub, &context);
+}
+
+int saturnin_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    saturnin_context_t context;
+    saturnin_aead_setup_key(&context, k);
+    return saturnin_aead_decrypt_vec_ctx
+        (m, m_count, mlen, nsec, c, c_count, ad, ad_count, npub, &context);
+}
+
+int saturnin_short_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    saturnin_context_t context;
+    saturnin_aead_setup_key(&context, k);
+    return saturnin_short_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &context);
+}
+
+int saturnin_short_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    saturnin_context_t context;
+    saturnin_aead_setup_key(&context, k);
+    return saturnin_short_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &context);
+}
+
+aead_cipher_t const saturnin_cipher = {
+    "SATURNIN-CTR-Cascade",
+    SATURNIN_KEY_SIZE,
+    SATURNIN_NONCE_SIZE,
+    SATURNIN_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    saturnin_aead_encrypt,
+    saturnin_aead_decrypt,
+    sizeof(saturnin_context_t),
+    saturnin_aead_setup_key,
+    saturnin_aead_encrypt_ctx,
+    saturnin_aead_decrypt_ctx,
+    saturnin_aead_encrypt_vec,
+    saturnin_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const saturnin_short_cipher = {
+    "SATURNIN-Short",
+    SATURNIN_KEY_SIZE,
+    SATURNIN_NONCE_SIZE,
+    SATURNIN_TAG_SIZE,
+    AEAD_FLAG_NO_DETACHED_TAG,
+    saturnin_short_aead_encrypt,
+    saturnin_short_aead_decrypt,
+    sizeof(saturnin_context_t),
+    saturnin_aead_setup_key,
+    saturnin_short_aead_encrypt_ctx,
+    saturnin_short_aead_decrypt_ctx,
+    0, /* encrypt_vec */
+    0, /* decrypt_vec */
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
 int saturnin_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen)
 {
     unsigned char tag[32];
     unsigned char block[32];
+    aead_iovec_t invec;
+    aead_iovec_cursor_t incur;
     memset(tag, 0, sizeof(tag));
+    aead_iovec_set(&invec, in, inlen);
+    aead_iovec_start(&incur, &invec, 1);
     saturnin_authenticate
-        (tag, block, in, inlen, SATURNIN_DOMAIN_16_7, SATURNIN_DOMAIN_16_8);
+        (tag, block, &incur, inlen,
+         SATURNIN_DOMAIN_16_7, SATURNIN_DOMAIN_16_8);
     memcpy(out, tag, 32);
     return 0;
 }
@@ -24,6 +24,46 @@
 #include "internal-sparkle.h"
 #include <string.h>
 
+static aead_cipher_incremental_t const schwaemm_256_128_incremental = {
+    sizeof(schwaemm_aead_state_t),
+    (aead_incremental_init_t)schwaemm_256_128_aead_init,
+    (aead_incremental_ad_t)schwaemm_aead_update_ad,
+    (aead_incremental_crypt_t)schwaemm_aead_encrypt_update,
+    (aead_incremental_crypt_t)schwaemm_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)schwaemm_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)schwaemm_aead_decrypt_final
+};
+
+static aead_cipher_incremental_t const schwaemm_192_192_incremental = {
+    sizeof(schwaemm_aead_state_t),
+    (aead_incremental_init_t)schwaemm_192_192_aead_init,
+    (aead_incremental_ad_t)schwaemm_aead_update_ad,
+    (aead_incremental_crypt_t)schwaemm_aead_encrypt_update,
+    (aead_incremental_crypt_t)schwaemm_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)schwaemm_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)schwaemm_aead_decrypt_final
+};
+
+static aead_cipher_incremental_t const schwaemm_128_128_incremental = {
+    sizeof(schwaemm_aead_state_t),
+    (aead_incremental_init_t)schwaemm_128_128_aead_init,
+    (aead_incremental_ad_t)schwaemm_aead_update_ad,
+    (aead_incremental_crypt_t)schwaemm_aead_encrypt_update,
+    (aead_incremental_crypt_t)schwaemm_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)schwaemm_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)schwaemm_aead_decrypt_final
+};
+
+static aead_cipher_incremental_t const schwaemm_256_256_incremental = {
+    sizeof(schwaemm_aead_state_t),
+    (aead_incremental_init_t)schwaemm_256_256_aead_init,
+    (aead_incremental_ad_t)schwaemm_aead_update_ad,
+    (aead_incremental_crypt_t)schwaemm_aead_encrypt_update,
+    (aead_incremental_crypt_t)schwaemm_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)schwaemm_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)schwaemm_aead_decrypt_final
+};
+
 aead_cipher_t const schwaemm_256_128_cipher = {
     "Schwaemm256-128",
     SCHWAEMM_256_128_KEY_SIZE,
@@ -31,7 +71,18 @@ aead_cipher_t const schwaemm_256_128_cipher = {
     SCHWAEMM_256_128_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     schwaemm_256_128_aead_encrypt,
-    schwaemm_256_128_aead_decrypt
+    schwaemm_256_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    schwaemm_256_128_aead_encrypt_vec,
+    schwaemm_256_128_aead_decrypt_vec,
+    &schwaemm_256_128_incremental,
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const schwaemm_192_192_cipher = {
@@ -41,7 +92,18 @@ aead_cipher_t const schwaemm_192_192_cipher = {
     SCHWAEMM_192_192_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     schwaemm_192_192_aead_encrypt,
-    schwaemm_192_192_aead_decrypt
+    schwaemm_192_192_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    schwaemm_192_192_aead_encrypt_vec,
+    schwaemm_192_192_aead_decrypt_vec,
+    &schwaemm_192_192_incremental,
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const schwaemm_128_128_cipher = {
@@ -51,7 +113,18 @@ aead_cipher_t const schwaemm_128_128_cipher = {
     SCHWAEMM_128_128_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     schwaemm_128_128_aead_encrypt,
-    schwaemm_128_128_aead_decrypt
+    schwaemm_128_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    schwaemm_128_128_aead_encrypt_vec,
+    schwaemm_128_128_aead_decrypt_vec,
+    &schwaemm_128_128_incremental,
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const schwaemm_256_256_cipher = {
@@ -61,7 +134,18 @@ aead_cipher_t const schwaemm_256_256_cipher = {
     SCHWAEMM_256_256_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     schwaemm_256_256_aead_encrypt,
-    schwaemm_256_256_aead_decrypt
+    schwaemm_256_256_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    schwaemm_256_256_aead_encrypt_vec,
+    schwaemm_256_256_aead_decrypt_vec,
+    &schwaemm_256_256_incremental,
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const esch_256_hash_algorithm = {
@@ -874,6 +958,417 @@ int schwaemm_256_256_aead_decrypt
         (mtemp, *mlen, SCHWAEMM_256_256_RIGHT(s), c, SCHWAEMM_256_256_TAG_SIZE);
 }
 
+/**
+ * \brief Incremental mode while associated data is being absorbed.
+ */
+#define SCHWAEMM_AEAD_MODE_AD 0
+
+/**
+ * \brief Incremental mode while the payload is being encrypted or decrypted.
+ */
+#define SCHWAEMM_AEAD_MODE_PAYLOAD 1
+
+/**
+ * \brief Parameters for a Schwaemm variant in incremental mode.
+ */
+typedef struct
+{
+    unsigned char rate;         /**< Rate in bytes */
+    unsigned char words;        /**< Size of the SPARKLE state in words */
+    unsigned char slim_steps;   /**< Steps for the slim permutation */
+    unsigned char big_steps;    /**< Steps for the big permutation */
+    unsigned char ad_domain;    /**< Domain for the last associated data */
+    unsigned char msg_domain;   /**< Domain for the last payload block */
+    unsigned char key_size;     /**< Size of the key and tag in bytes */
+
+} schwaemm_variant_t;
+
+/**
+ * \brief Parameters for all Schwaemm variants, indexed by the
+ * "variant" field of the incremental AEAD state.
+ */
+static schwaemm_variant_t const schwaemm_variants[4] = {
+    {SCHWAEMM_256_128_RATE, SPARKLE_384_STATE_SIZE, 7, 11, 0x04, 0x06,
+     SCHWAEMM_256_128_KEY_SIZE},
+    {SCHWAEMM_192_192_RATE, SPARKLE_384_STATE_SIZE, 7, 11, 0x08, 0x0A,
+     SCHWAEMM_192_192_KEY_SIZE},
+    {SCHWAEMM_128_128_RATE, SPARKLE_256_STATE_SIZE, 7, 10, 0x04, 0x06,
+     SCHWAEMM_128_128_KEY_SIZE},
+    {SCHWAEMM_256_256_RATE, SPARKLE_512_STATE_SIZE, 8, 12, 0x10, 0x12,
+     SCHWAEMM_256_256_KEY_SIZE}
+};
+
+/**
+ * \brief Gets the SPARKLE state words from an incremental AEAD state.
+ */
+#define schwaemm_aead_words(state) ((uint32_t *)((state)->s.state))
+
+/**
+ * \brief Runs the SPARKLE permutation that matches a Schwaemm variant.
+ *
+ * \param s The SPARKLE state.
+ * \param v Parameters for the variant.
+ * \param steps Number of steps to perform.
+ */
+static void schwaemm_aead_permute
+    (uint32_t *s, const schwaemm_variant_t *v, unsigned steps)
+{
+    if (v->words == SPARKLE_256_STATE_SIZE)
+        sparkle_256(s, steps);
+    else if (v->words == SPARKLE_384_STATE_SIZE)
+        sparkle_384(s, steps);
+    else
+        sparkle_512(s, steps);
+}
+
+/**
+ * \brief Performs the rho1 and rate whitening steps for any
+ * Schwaemm variant.
+ *
+ * \param s The SPARKLE state.
+ * \param v Parameters for the variant.
+ *
+ * This is equivalent to the unrolled per-variant rho macros above.
+ */
+static void schwaemm_aead_rho(uint32_t *s, const schwaemm_variant_t *v)
+{
+    unsigned rate = v->rate / 4;
+    unsigned capacity = v->words - rate;
+    unsigned half = rate / 2;
+    unsigned index;
+    uint32_t t;
+    for (index = 0; index < half; ++index) {
+        t = s[index];
+        s[index] = s[index + half] ^ s[rate + (index % capacity)];
+        s[index + half] ^= t ^ s[rate + ((index + half) % capacity)];
+    }
+}
+
+/**
+ * \brief Absorbs a full block that is known not to be the last one.
+ *
+ * \param state The incremental AEAD state.
+ * \param v Parameters for the variant.
+ */
+static void schwaemm_aead_absorb_block
+    (schwaemm_aead_state_t *state, const schwaemm_variant_t *v)
+{
+    uint32_t *s = schwaemm_aead_words(state);
+    schwaemm_aead_rho(s, v);
+    lw_xor_block(state->s.state, state->s.block, v->rate);
+    schwaemm_aead_permute(s, v, v->slim_steps);
+    state->s.count = 0;
+}
+
+/**
+ * \brief Absorbs the last block of associated data or payload.
+ *
+ * \param state The incremental AEAD state.
+ * \param v Parameters for the variant.
+ * \param domain Domain separator for a partial last block; the domain
+ * for a full last block is one more than this.
+ */
+static void schwaemm_aead_absorb_last
+    (schwaemm_aead_state_t *state, const schwaemm_variant_t *v,
+     unsigned char domain)
+{
+    uint32_t *s = schwaemm_aead_words(state);
+    unsigned temp = state->s.count;
+    if (temp == v->rate)
+        ++domain;
+    s[v->words - 1] ^= DOMAIN(domain);
+    schwaemm_aead_rho(s, v);
+    lw_xor_block(state->s.state, state->s.block, temp);
+    if (temp < v->rate)
+        state->s.state[temp] ^= 0x80;
+    schwaemm_aead_permute(s, v, v->big_steps);
+    state->s.count = 0;
+}
+
+/**
+ * \brief Initializes the state for an incremental Schwaemm operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the public nonce, which is the size of the rate.
+ * \param k Points to the key.
+ * \param variant Index of the variant in schwaemm_variants.
+ */
+static void schwaemm_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k, unsigned char variant)
+{
+    const schwaemm_variant_t *v = &(schwaemm_variants[variant]);
+    memset(state->s.state, 0, sizeof(state->s.state));
+    memcpy(state->s.state, npub, v->rate);
+    memcpy(state->s.state + v->rate, k, v->key_size);
+    memcpy(state->s.key, k, v->key_size);
+    schwaemm_aead_permute(schwaemm_aead_words(state), v, v->big_steps);
+    state->s.count = 0;
+    state->s.mode = SCHWAEMM_AEAD_MODE_AD;
+    state->s.variant = variant;
+}
+
+void schwaemm_256_128_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_init(state, npub, k, 0);
+}
+
+void schwaemm_192_192_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_init(state, npub, k, 1);
+}
+
+void schwaemm_128_128_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_init(state, npub, k, 2);
+}
+
+void schwaemm_256_256_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_init(state, npub, k, 3);
+}
+
+void schwaemm_aead_update_ad
+    (schwaemm_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen)
+{
+    const schwaemm_variant_t *v = &(schwaemm_variants[state->s.variant]);
+    unsigned temp;
+    while (adlen > 0) {
+        /* Full blocks are held back until we know they are not the last */
+        if (state->s.count == v->rate)
+            schwaemm_aead_absorb_block(state, v);
+        temp = v->rate - state->s.count;
+        if (temp > adlen)
+            temp = (unsigned)adlen;
+        memcpy(state->s.block + state->s.count, ad, temp);
+        state->s.count += temp;
+        ad += temp;
+        adlen -= temp;
+    }
+}
+
+/**
+ * \brief Finishes the associated data and switches an incremental
+ * Schwaemm state into payload mode if it is not in payload mode already.
+ *
+ * \param state The incremental AEAD state.
+ * \param v Parameters for the variant.
+ */
+static void schwaemm_aead_start_payload
+    (schwaemm_aead_state_t *state, const schwaemm_variant_t *v)
+{
+    if (state->s.mode != SCHWAEMM_AEAD_MODE_PAYLOAD) {
+        if (state->s.count > 0)
+            schwaemm_aead_absorb_last(state, v, v->ad_domain);
+        state->s.mode = SCHWAEMM_AEAD_MODE_PAYLOAD;
+    }
+}
+
+void schwaemm_aead_encrypt_update
+    (schwaemm_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len)
+{
+    const schwaemm_variant_t *v = &(schwaemm_variants[state->s.variant]);
+    unsigned char *block;
+    unsigned temp;
+    schwaemm_aead_start_payload(state, v);
+    while (len > 0) {
+        if (state->s.count == v->rate)
+            schwaemm_aead_absorb_block(state, v);
+        temp = v->rate - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        block = state->s.block + state->s.count;
+        memcpy(block, m, temp);
+        lw_xor_block_2_src(c, state->s.state + state->s.count, block, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+    }
+}
+
+void schwaemm_aead_decrypt_update
+    (schwaemm_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len)
+{
+    const schwaemm_variant_t *v = &(schwaemm_variants[state->s.variant]);
+    unsigned char *block;
+    unsigned temp;
+    schwaemm_aead_start_payload(state, v);
+    while (len > 0) {
+        if (state->s.count == v->rate)
+            schwaemm_aead_absorb_block(state, v);
+        temp = v->rate - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        block = state->s.block + state->s.count;
+        lw_xor_block_2_src(block, state->s.state + state->s.count, c, temp);
+        memcpy(m, block, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+    }
+}
+
+void schwaemm_aead_encrypt_final
+    (schwaemm_aead_state_t *state, unsigned char *tag)
+{
+    const schwaemm_variant_t *v = &(schwaemm_variants[state->s.variant]);
+    schwaemm_aead_start_payload(state, v);
+    if (state->s.count > 0)
+        schwaemm_aead_absorb_last(state, v, v->msg_domain);
+    lw_xor_block_2_src
+        (tag, state->s.state + v->rate, state->s.key, v->key_size);
+}
+
+int schwaemm_aead_decrypt_final
+    (schwaemm_aead_state_t *state, const unsigned char *tag)
+{
+    unsigned char computed[SCHWAEMM_256_256_TAG_SIZE];
+    unsigned char key_size = schwaemm_variants[state->s.variant].key_size;
+    schwaemm_aead_encrypt_final(state, computed);
+    return aead_check_tag(0, 0, computed, tag, key_size);
+}
+
+int schwaemm_256_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&schwaemm_256_128_incremental, &state,
+         SCHWAEMM_256_128_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_256_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&schwaemm_256_128_incremental, &state,
+         SCHWAEMM_256_128_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_192_192_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&schwaemm_192_192_incremental, &state,
+         SCHWAEMM_192_192_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_192_192_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&schwaemm_192_192_incremental, &state,
+         SCHWAEMM_192_192_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_128_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&schwaemm_128_128_incremental, &state,
+         SCHWAEMM_128_128_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_128_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&schwaemm_128_128_incremental, &state,
+         SCHWAEMM_128_128_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_256_256_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&schwaemm_256_256_incremental, &state,
+         SCHWAEMM_256_256_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int schwaemm_256_256_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    schwaemm_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&schwaemm_256_256_incremental, &state,
+         SCHWAEMM_256_256_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
 /**
  * \brief Rate at which bytes are processed by Esch256.
  */
@@ -178,6 +178,25 @@ typedef union
 
 } esch_384_hash_state_t;
 
+/**
+ * \brief State information for the incremental Schwaemm AEAD modes.
+ *
+ * The same state structure is used for all Schwaemm variants.
+ */
+typedef union
+{
+    struct {
+        unsigned char state[64];    /**< Current permutation state */
+        unsigned char block[32];    /**< Partial input data block */
+        unsigned char key[32];      /**< Copy of the key for the tag */
+        unsigned char count;        /**< Number of bytes in the current block */
+        unsigned char mode;         /**< Current phase of the operation */
+        unsigned char variant;      /**< Schwaemm variant in use */
+    } s;                            /**< State */
+    unsigned long long align;       /**< For alignment of this structure */
+
+} schwaemm_aead_state_t;
+
 /**
  * \brief Encrypts and authenticates a packet with Schwaemm256-128.
  *
@@ -237,6 +256,67 @@ int schwaemm_256_128_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet
+ * with Schwaemm256-128.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 32 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa schwaemm_256_128_aead_decrypt_vec(), schwaemm_256_128_aead_encrypt()
+ */
+int schwaemm_256_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet
+ * with Schwaemm256-128.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 32 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa schwaemm_256_128_aead_encrypt_vec(), schwaemm_256_128_aead_decrypt()
+ */
+int schwaemm_256_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
 /**
  * \brief Encrypts and authenticates a packet with Schwaemm192-192.
  *
@@ -296,6 +376,67 @@ int schwaemm_192_192_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet
+ * with Schwaemm192-192.
+ *
+ * \param c Array of segments to receive the ciphertext and the 24 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 24 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 24 bytes in length.
+ * \param k Points to the 24 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa schwaemm_192_192_aead_decrypt_vec(), schwaemm_192_192_aead_encrypt()
+ */
+int schwaemm_192_192_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet
+ * with Schwaemm192-192.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 24 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 24 bytes in length.
+ * \param k Points to the 24 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa schwaemm_192_192_aead_encrypt_vec(), schwaemm_192_192_aead_decrypt()
+ */
+int schwaemm_192_192_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
 /**
  * \brief Encrypts and authenticates a packet with Schwaemm128-128.
  *
@@ -355,6 +496,67 @@ int schwaemm_128_128_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet
+ * with Schwaemm128-128.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa schwaemm_128_128_aead_decrypt_vec(), schwaemm_128_128_aead_encrypt()
+ */
+int schwaemm_128_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet
+ * with Schwaemm128-128.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa schwaemm_128_128_aead_encrypt_vec(), schwaemm_128_128_aead_decrypt()
+ */
+int schwaemm_128_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
 /**
  * \brief Encrypts and authenticates a packet with Schwaemm256-256.
  *
@@ -414,6 +616,190 @@ int schwaemm_256_256_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet
+ * with Schwaemm256-256.
+ *
+ * \param c Array of segments to receive the ciphertext and the 32 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 32 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 32 bytes in length.
+ * \param k Points to the 32 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa schwaemm_256_256_aead_decrypt_vec(), schwaemm_256_256_aead_encrypt()
+ */
+int schwaemm_256_256_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet
+ * with Schwaemm256-256.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 32 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 32 bytes in length.
+ * \param k Points to the 32 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa schwaemm_256_256_aead_encrypt_vec(), schwaemm_256_256_aead_decrypt()
+ */
+int schwaemm_256_256_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental Schwaemm256-128 operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 32 bytes of the public nonce.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \sa schwaemm_aead_update_ad(), schwaemm_aead_encrypt_update(),
+ * schwaemm_aead_decrypt_update()
+ */
+void schwaemm_256_128_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental Schwaemm192-192 operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 24 bytes of the public nonce.
+ * \param k Points to the 24 bytes of the key.
+ *
+ * \sa schwaemm_aead_update_ad(), schwaemm_aead_encrypt_update(),
+ * schwaemm_aead_decrypt_update()
+ */
+void schwaemm_192_192_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental Schwaemm128-128 operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 16 bytes of the public nonce.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \sa schwaemm_aead_update_ad(), schwaemm_aead_encrypt_update(),
+ * schwaemm_aead_decrypt_update()
+ */
+void schwaemm_128_128_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental Schwaemm256-256 operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 32 bytes of the public nonce.
+ * \param k Points to the 32 bytes of the key.
+ *
+ * \sa schwaemm_aead_update_ad(), schwaemm_aead_encrypt_update(),
+ * schwaemm_aead_decrypt_update()
+ */
+void schwaemm_256_256_aead_init
+    (schwaemm_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Absorbs more associated data into an incremental Schwaemm state.
+ *
+ * \param state The incremental AEAD state.
+ * \param ad Points to the associated data.
+ * \param adlen Length of the associated data in bytes.
+ *
+ * This function must not be called after encryption or decryption
+ * has started.
+ */
+void schwaemm_aead_update_ad
+    (schwaemm_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen);
+
+/**
+ * \brief Encrypts more plaintext with an incremental Schwaemm state.
+ *
+ * \param state The incremental AEAD state.
+ * \param c Buffer to receive the ciphertext, which may be the same
+ * as \a m.
+ * \param m Points to the plaintext to encrypt.
+ * \param len Number of bytes to encrypt.
+ *
+ * \sa schwaemm_aead_encrypt_final()
+ */
+void schwaemm_aead_encrypt_update
+    (schwaemm_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len);
+
+/**
+ * \brief Decrypts more ciphertext with an incremental Schwaemm state.
+ *
+ * \param state The incremental AEAD state.
+ * \param m Buffer to receive the plaintext, which may be the same
+ * as \a c.
+ * \param c Points to the ciphertext to decrypt.
+ * \param len Number of bytes to decrypt.
+ *
+ * The plaintext is not authenticated until schwaemm_aead_decrypt_final()
+ * succeeds and must be discarded if it fails.
+ */
+void schwaemm_aead_decrypt_update
+    (schwaemm_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len);
+
+/**
+ * \brief Finishes an incremental Schwaemm encryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Buffer to receive the authentication tag, which is the
+ * same size as the key for the variant.
+ */
+void schwaemm_aead_encrypt_final
+    (schwaemm_aead_state_t *state, unsigned char *tag);
+
+/**
+ * \brief Finishes an incremental Schwaemm decryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Points to the authentication tag, which is the
+ * same size as the key for the variant to check.
+ *
+ * \return 0 if the tag is correct or -1 if it is incorrect.
+ */
+int schwaemm_aead_decrypt_final
+    (schwaemm_aead_state_t *state, const unsigned char *tag);
+
 /**
  * \brief Hashes a block of input data with Esch256 to generate a hash value.
  *
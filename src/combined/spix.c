@@ -22,7 +22,7 @@
 
 #include "spix.h"
 #include "internal-sliscp-light.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 /**
@@ -43,7 +43,18 @@ aead_cipher_t const spix_cipher = {
     SPIX_TAG_SIZE,
     AEAD_FLAG_NONE,
     spix_aead_encrypt,
-    spix_aead_decrypt
+    spix_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spix_aead_encrypt_vec,
+    spix_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /* Indices of where a rate byte is located in the state.  We don't
@@ -62,14 +73,16 @@ static unsigned char const spix_rate_posn[8] = {
  * \param state sLiSCP-light-256 permutation state.
  * \param k Points to the 128-bit key.
  * \param npub Points to the 128-bit nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void spix_init
     (unsigned char state[SPIX_STATE_SIZE],
      const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[SPIX_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Initialize the state by interleaving the key and nonce */
@@ -91,14 +104,15 @@ static void spix_init
     /* Absorb the associated data into the state */
     if (adlen != 0) {
         while (adlen >= SPIX_RATE) {
-            lw_xor_block(state + 8, ad, SPIX_RATE);
+            in = aead_iovec_load_block(ad, block, SPIX_RATE);
+            lw_xor_block(state + 8, in, SPIX_RATE);
             state[SPIX_STATE_SIZE - 1] ^= 0x01; /* domain separation */
             sliscp_light256_permute_spix(state, 9);
-            ad += SPIX_RATE;
             adlen -= SPIX_RATE;
         }
         temp = (unsigned)adlen;
-        lw_xor_block(state + 8, ad, temp);
+        in = aead_iovec_load_block(ad, block, temp);
+        lw_xor_block(state + 8, in, temp);
         state[temp + 8] ^= 0x80; /* padding */
         state[SPIX_STATE_SIZE - 1] ^= 0x01; /* domain separation */
         sliscp_light256_permute_spix(state, 9);
@@ -128,84 +142,148 @@ static void spix_finalize
     memcpy(tag + 8, state + 24, 8);
 }
 
-int spix_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int spix_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[SPIX_STATE_SIZE];
     unsigned temp;
+    unsigned char inbuf[SPIX_RATE];
+    unsigned char outbuf[SPIX_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPIX_TAG_SIZE))
+        return -2;
     *clen = mlen + SPIX_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the SPIX state and absorb the associated data */
-    spix_init(state, k, npub, ad, adlen);
+    spix_init(state, k, npub, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     while (mlen >= SPIX_RATE) {
-        lw_xor_block_2_dest(c, state + 8, m, SPIX_RATE);
+        in = aead_iovec_load_block(&mcur, inbuf, SPIX_RATE);
+        out = aead_iovec_store_begin(&ccur, outbuf, SPIX_RATE);
+        lw_xor_block_2_dest(out, state + 8, in, SPIX_RATE);
+        aead_iovec_store_end(&ccur, outbuf, out, SPIX_RATE);
         state[SPIX_STATE_SIZE - 1] ^= 0x02; /* domain separation */
         sliscp_light256_permute_spix(state, 9);
-        c += SPIX_RATE;
-        m += SPIX_RATE;
         mlen -= SPIX_RATE;
     }
     temp = (unsigned)mlen;
-    lw_xor_block_2_dest(c, state + 8, m, temp);
+    in = aead_iovec_load_block(&mcur, inbuf, temp);
+    out = aead_iovec_store_begin(&ccur, outbuf, temp);
+    lw_xor_block_2_dest(out, state + 8, in, temp);
+    aead_iovec_store_end(&ccur, outbuf, out, temp);
     state[temp + 8] ^= 0x80; /* padding */
     state[SPIX_STATE_SIZE - 1] ^= 0x02; /* domain separation */
     sliscp_light256_permute_spix(state, 9);
-    c += mlen;
 
     /* Generate the authentication tag */
-    spix_finalize(state, k, c);
+    spix_finalize(state, k, state);
+    aead_iovec_write(&ccur, state, SPIX_TAG_SIZE);
     return 0;
 }
 
-int spix_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spix_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[SPIX_STATE_SIZE];
-    unsigned char *mtemp = m;
     unsigned temp;
+    unsigned char tag[SPIX_TAG_SIZE];
+    unsigned char inbuf[SPIX_RATE];
+    unsigned char outbuf[SPIX_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPIX_TAG_SIZE)
         return -1;
     *mlen = clen - SPIX_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the SPIX state and absorb the associated data */
-    spix_init(state, k, npub, ad, adlen);
+    spix_init(state, k, npub, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPIX_TAG_SIZE;
     while (clen >= SPIX_RATE) {
-        lw_xor_block_swap(m, state + 8, c, SPIX_RATE);
+        in = aead_iovec_load_block(&ccur, inbuf, SPIX_RATE);
+        out = aead_iovec_store_begin(&mcur, outbuf, SPIX_RATE);
+        lw_xor_block_swap(out, state + 8, in, SPIX_RATE);
+        aead_iovec_store_end(&mcur, outbuf, out, SPIX_RATE);
         state[SPIX_STATE_SIZE - 1] ^= 0x02; /* domain separation */
         sliscp_light256_permute_spix(state, 9);
-        c += SPIX_RATE;
-        m += SPIX_RATE;
         clen -= SPIX_RATE;
     }
     temp = (unsigned)clen;
-    lw_xor_block_swap(m, state + 8, c, temp);
+    in = aead_iovec_load_block(&ccur, inbuf, temp);
+    out = aead_iovec_store_begin(&mcur, outbuf, temp);
+    lw_xor_block_swap(out, state + 8, in, temp);
+    aead_iovec_store_end(&mcur, outbuf, out, temp);
     state[temp + 8] ^= 0x80; /* padding */
     state[SPIX_STATE_SIZE - 1] ^= 0x02; /* domain separation */
     sliscp_light256_permute_spix(state, 9);
-    c += clen;
 
     /* Finalize the SPIX state and compare against the authentication tag */
     spix_finalize(state, k, state);
-    return aead_check_tag(mtemp, *mlen, state, c, SPIX_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPIX_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, state, tag, SPIX_TAG_SIZE);
+}
+
+int spix_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPIX_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spix_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spix_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPIX_TAG_SIZE ? clen - SPIX_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spix_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
@@ -24,6 +24,16 @@
 #include "internal-subterranean.h"
 #include <string.h>
 
+static aead_cipher_incremental_t const subterranean_incremental = {
+    sizeof(subterranean_aead_state_t),
+    (aead_incremental_init_t)subterranean_aead_init,
+    (aead_incremental_ad_t)subterranean_aead_update_ad,
+    (aead_incremental_crypt_t)subterranean_aead_encrypt_update,
+    (aead_incremental_crypt_t)subterranean_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)subterranean_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)subterranean_aead_decrypt_final
+};
+
 aead_cipher_t const subterranean_cipher = {
     "Subterranean",
     SUBTERRANEAN_KEY_SIZE,
@@ -31,7 +41,18 @@ aead_cipher_t const subterranean_cipher = {
     SUBTERRANEAN_TAG_SIZE,
     AEAD_FLAG_NONE,
     subterranean_aead_encrypt,
-    subterranean_aead_decrypt
+    subterranean_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    subterranean_aead_encrypt_vec,
+    subterranean_aead_decrypt_vec,
+    &subterranean_incremental,
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const subterranean_hash_algorithm = {
@@ -181,6 +202,169 @@ int subterranean_aead_decrypt
     return aead_check_tag(mtemp, *mlen, tag, c + clen, SUBTERRANEAN_TAG_SIZE);
 }
 
+/**
+ * \brief Incremental mode while associated data is being absorbed.
+ */
+#define SUBTERRANEAN_AEAD_MODE_AD 0
+
+/**
+ * \brief Incremental mode while the payload is being encrypted or decrypted.
+ */
+#define SUBTERRANEAN_AEAD_MODE_PAYLOAD 1
+
+/**
+ * \brief Gets the Subterranean state from an incremental AEAD state.
+ */
+#define subterranean_aead_state(state) \
+    ((subterranean_state_t *)((state)->s.state))
+
+void subterranean_aead_init
+    (subterranean_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    subterranean_state_t *st = subterranean_aead_state(state);
+    memset(st, 0, sizeof(subterranean_state_t));
+    subterranean_absorb(st, k, SUBTERRANEAN_KEY_SIZE);
+    subterranean_absorb(st, npub, SUBTERRANEAN_NONCE_SIZE);
+    subterranean_blank(st);
+    state->s.count = 0;
+    state->s.mode = SUBTERRANEAN_AEAD_MODE_AD;
+}
+
+void subterranean_aead_update_ad
+    (subterranean_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen)
+{
+    subterranean_state_t *st = subterranean_aead_state(state);
+
+    /* Complete a left-over partial block from last time */
+    while (state->s.count > 0 && adlen > 0) {
+        state->s.block[state->s.count++] = *ad++;
+        --adlen;
+        if (state->s.count >= 4) {
+            subterranean_duplex_4(st, le_load_word32(state->s.block));
+            state->s.count = 0;
+        }
+    }
+
+    /* Absorb whole blocks directly and buffer what is left over */
+    while (adlen >= 4) {
+        subterranean_duplex_4(st, le_load_word32(ad));
+        ad += 4;
+        adlen -= 4;
+    }
+    memcpy(state->s.block + state->s.count, ad, (unsigned)adlen);
+    state->s.count += (unsigned char)adlen;
+}
+
+/**
+ * \brief Pads the associated data and switches an incremental Subterranean
+ * state into payload mode if it is not in payload mode already.
+ *
+ * \param state The incremental AEAD state.
+ */
+static void subterranean_aead_start_payload(subterranean_aead_state_t *state)
+{
+    if (state->s.mode != SUBTERRANEAN_AEAD_MODE_PAYLOAD) {
+        subterranean_duplex_n
+            (subterranean_aead_state(state), state->s.block, state->s.count);
+        state->s.count = 0;
+        state->s.mode = SUBTERRANEAN_AEAD_MODE_PAYLOAD;
+    }
+}
+
+void subterranean_aead_encrypt_update
+    (subterranean_aead_state_t *state, unsigned char *c,
+     const unsigned char *m, unsigned long long len)
+{
+    subterranean_state_t *st = subterranean_aead_state(state);
+    unsigned char x;
+    subterranean_aead_start_payload(state);
+    while (len > 0) {
+        if (state->s.count == 0)
+            le_store_word32(state->s.keystream, subterranean_extract(st));
+        x = *m++;
+        *c++ = x ^ state->s.keystream[state->s.count];
+        state->s.block[state->s.count++] = x;
+        --len;
+        if (state->s.count >= 4) {
+            subterranean_duplex_4(st, le_load_word32(state->s.block));
+            state->s.count = 0;
+        }
+    }
+}
+
+void subterranean_aead_decrypt_update
+    (subterranean_aead_state_t *state, unsigned char *m,
+     const unsigned char *c, unsigned long long len)
+{
+    subterranean_state_t *st = subterranean_aead_state(state);
+    unsigned char x;
+    subterranean_aead_start_payload(state);
+    while (len > 0) {
+        if (state->s.count == 0)
+            le_store_word32(state->s.keystream, subterranean_extract(st));
+        x = *c++ ^ state->s.keystream[state->s.count];
+        *m++ = x;
+        state->s.block[state->s.count++] = x;
+        --len;
+        if (state->s.count >= 4) {
+            subterranean_duplex_4(st, le_load_word32(state->s.block));
+            state->s.count = 0;
+        }
+    }
+}
+
+void subterranean_aead_encrypt_final
+    (subterranean_aead_state_t *state, unsigned char *tag)
+{
+    subterranean_state_t *st = subterranean_aead_state(state);
+    subterranean_aead_start_payload(state);
+    subterranean_duplex_n(st, state->s.block, state->s.count);
+    subterranean_blank(st);
+    subterranean_squeeze(st, tag, SUBTERRANEAN_TAG_SIZE);
+}
+
+int subterranean_aead_decrypt_final
+    (subterranean_aead_state_t *state, const unsigned char *tag)
+{
+    unsigned char computed[SUBTERRANEAN_TAG_SIZE];
+    subterranean_aead_encrypt_final(state, computed);
+    return aead_check_tag(0, 0, computed, tag, SUBTERRANEAN_TAG_SIZE);
+}
+
+int subterranean_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    subterranean_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&subterranean_incremental, &state,
+         SUBTERRANEAN_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int subterranean_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    subterranean_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&subterranean_incremental, &state,
+         SUBTERRANEAN_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
 int subterranean_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen)
 {
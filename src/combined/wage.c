@@ -22,6 +22,7 @@
 
 #include "wage.h"
 #include "internal-wage.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const wage_cipher = {
@@ -31,7 +32,18 @@ aead_cipher_t const wage_cipher = {
     WAGE_TAG_SIZE,
     AEAD_FLAG_NONE,
     wage_aead_encrypt,
-    wage_aead_decrypt
+    wage_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    wage_aead_encrypt_vec,
+    wage_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -44,27 +56,26 @@ aead_cipher_t const wage_cipher = {
  *
  * \param state Points to the WAGE state.
  * \param pad Points to an 8-byte temporary buffer for handling padding.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data segments.
  * \param adlen Length of the associated data.
  */
 static void wage_process_ad
     (unsigned char state[WAGE_STATE_SIZE], unsigned char pad[WAGE_RATE],
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
     unsigned temp;
 
     /* Process as many full blocks as possible */
     while (adlen >= WAGE_RATE) {
-        wage_absorb(state, ad);
+        wage_absorb(state, aead_iovec_load_block(ad, pad, WAGE_RATE));
         state[0] ^= 0x40;
         wage_permute(state);
-        ad += WAGE_RATE;
         adlen -= WAGE_RATE;
     }
 
     /* Pad and absorb the final block */
     temp = (unsigned)adlen;
-    memcpy(pad, ad, temp);
+    aead_iovec_read(ad, pad, temp);
     pad[temp] = 0x80;
     memset(pad + temp + 1, 0, WAGE_RATE - temp - 1);
     wage_absorb(state, pad);
@@ -72,10 +83,10 @@ static void wage_process_ad
     wage_permute(state);
 }
 
-int wage_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int wage_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -83,92 +94,148 @@ int wage_aead_encrypt
     unsigned char state[WAGE_STATE_SIZE];
     unsigned char block[WAGE_RATE];
     unsigned temp;
+    unsigned char inbuf[WAGE_RATE];
+    unsigned char tag[WAGE_TAG_SIZE];
+    const unsigned char *in;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + WAGE_TAG_SIZE))
+        return -2;
     *clen = mlen + WAGE_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state and absorb the associated data */
     wage_init(state, k, npub);
     if (adlen != 0)
-        wage_process_ad(state, block, ad, adlen);
+        wage_process_ad(state, block, &adcur, adlen);
 
     /* Encrypts the plaintext to produce the ciphertext */
     while (mlen >= WAGE_RATE) {
         wage_get_rate(state, block);
-        lw_xor_block(block, m, WAGE_RATE);
+        in = aead_iovec_load_block(&mcur, inbuf, WAGE_RATE);
+        lw_xor_block(block, in, WAGE_RATE);
         wage_set_rate(state, block);
         state[0] ^= 0x20;
         wage_permute(state);
-        memcpy(c, block, WAGE_RATE);
-        c += WAGE_RATE;
-        m += WAGE_RATE;
+        aead_iovec_write(&ccur, block, WAGE_RATE);
         mlen -= WAGE_RATE;
     }
     temp = (unsigned)mlen;
     wage_get_rate(state, block);
-    lw_xor_block(block, m, temp);
+    in = aead_iovec_load_block(&mcur, inbuf, temp);
+    lw_xor_block(block, in, temp);
     block[temp] ^= 0x80;
     wage_set_rate(state, block);
     state[0] ^= 0x20;
     wage_permute(state);
-    memcpy(c, block, temp);
+    aead_iovec_write(&ccur, block, temp);
 
     /* Generate and extract the authentication tag */
     wage_absorb_key(state, k);
-    wage_extract_tag(state, c + temp);
+    wage_extract_tag(state, tag);
+    aead_iovec_write(&ccur, tag, WAGE_TAG_SIZE);
     return 0;
 }
 
-int wage_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int wage_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[WAGE_STATE_SIZE];
     unsigned char block[WAGE_TAG_SIZE];
-    unsigned char *mtemp = m;
     unsigned temp;
+    unsigned char inbuf[WAGE_RATE];
+    unsigned char received[WAGE_TAG_SIZE];
+    const unsigned char *in;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < WAGE_TAG_SIZE)
         return -1;
     *mlen = clen - WAGE_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state and absorb the associated data */
     wage_init(state, k, npub);
     if (adlen != 0)
-        wage_process_ad(state, block, ad, adlen);
+        wage_process_ad(state, block, &adcur, adlen);
 
     /* Decrypts the ciphertext to produce the plaintext */
     clen -= WAGE_TAG_SIZE;
     while (clen >= WAGE_RATE) {
+        in = aead_iovec_load_block(&ccur, inbuf, WAGE_RATE);
         wage_get_rate(state, block);
-        lw_xor_block(block, c, WAGE_RATE);
-        wage_set_rate(state, c);
+        lw_xor_block(block, in, WAGE_RATE);
+        wage_set_rate(state, in);
         state[0] ^= 0x20;
         wage_permute(state);
-        memcpy(m, block, WAGE_RATE);
-        c += WAGE_RATE;
-        m += WAGE_RATE;
+        aead_iovec_write(&mcur, block, WAGE_RATE);
         clen -= WAGE_RATE;
     }
     temp = (unsigned)clen;
+    in = aead_iovec_load_block(&ccur, inbuf, temp);
     wage_get_rate(state, block);
-    lw_xor_block_2_src(block + 8, block, c, temp);
-    memcpy(block, c, temp);
+    lw_xor_block_2_src(block + 8, block, in, temp);
+    memcpy(block, in, temp);
     block[temp] ^= 0x80;
     wage_set_rate(state, block);
     state[0] ^= 0x20;
     wage_permute(state);
-    memcpy(m, block + 8, temp);
+    aead_iovec_write(&mcur, block + 8, temp);
 
     /* Generate and check the authentication tag */
     wage_absorb_key(state, k);
     wage_extract_tag(state, block);
-    return aead_check_tag(mtemp, *mlen, block, c + temp, WAGE_TAG_SIZE);
+    aead_iovec_read(&ccur, received, WAGE_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, block, received, WAGE_TAG_SIZE);
+}
+
+int wage_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + WAGE_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return wage_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int wage_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= WAGE_TAG_SIZE ? clen - WAGE_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return wage_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
@@ -87,6 +87,21 @@ typedef union
 
 } xoodyak_hash_state_t;
 
+/**
+ * \brief State information for the incremental Xoodyak AEAD mode.
+ */
+typedef union
+{
+    struct {
+        unsigned char state[48]; /**< Current permutation state */
+        unsigned char count;     /**< Number of bytes in the current block */
+        unsigned char mode;      /**< Current phase of the operation */
+        unsigned char domain;    /**< Domain separator for the next block */
+    } s;                         /**< State */
+    unsigned long long align;    /**< For alignment of this structure */
+
+} xoodyak_aead_state_t;
+
 /**
  * \brief Meta-information block for the Xoodyak cipher.
  */
@@ -156,6 +171,178 @@ int xoodyak_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet
+ * with Xoodyak.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa xoodyak_aead_decrypt_vec(), xoodyak_aead_encrypt()
+ */
+int xoodyak_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet
+ * with Xoodyak.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa xoodyak_aead_encrypt_vec(), xoodyak_aead_decrypt()
+ */
+int xoodyak_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a batch of packets with Xoodyak.
+ *
+ * \param packets Points to the array of packet descriptors.  Each
+ * packet has a 16 byte key or key context and a 16 byte nonce.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was encrypted, or the result of the first
+ * packet that failed.
+ *
+ * Groups of 4, 8, or 16 packets are processed in lock-step with a
+ * multi-lane Xoodoo permutation, depending upon the vector instructions
+ * that are available.  Throughput is best when the packets in a batch
+ * have similar lengths.
+ *
+ * \sa xoodyak_aead_decrypt_batch(), aead_cipher_encrypt_batch()
+ */
+int xoodyak_aead_encrypt_batch(aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Decrypts and authenticates a batch of packets with Xoodyak.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was decrypted, or the result of the first
+ * packet that failed.
+ *
+ * \sa xoodyak_aead_encrypt_batch(), aead_cipher_decrypt_batch()
+ */
+int xoodyak_aead_decrypt_batch(aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Initializes the state for an incremental Xoodyak operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 16 bytes of the public nonce.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \sa xoodyak_aead_update_ad(), xoodyak_aead_encrypt_update(),
+ * xoodyak_aead_decrypt_update()
+ */
+void xoodyak_aead_init
+    (xoodyak_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Absorbs more associated data into an incremental Xoodyak state.
+ *
+ * \param state The incremental AEAD state.
+ * \param ad Points to the associated data.
+ * \param adlen Length of the associated data in bytes.
+ *
+ * This function must not be called after encryption or decryption
+ * has started.
+ */
+void xoodyak_aead_update_ad
+    (xoodyak_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen);
+
+/**
+ * \brief Encrypts more plaintext with an incremental Xoodyak state.
+ *
+ * \param state The incremental AEAD state.
+ * \param c Buffer to receive the ciphertext, which may be the same
+ * as \a m.
+ * \param m Points to the plaintext to encrypt.
+ * \param len Number of bytes to encrypt.
+ *
+ * \sa xoodyak_aead_encrypt_final()
+ */
+void xoodyak_aead_encrypt_update
+    (xoodyak_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len);
+
+/**
+ * \brief Decrypts more ciphertext with an incremental Xoodyak state.
+ *
+ * \param state The incremental AEAD state.
+ * \param m Buffer to receive the plaintext, which may be the same
+ * as \a c.
+ * \param c Points to the ciphertext to decrypt.
+ * \param len Number of bytes to decrypt.
+ *
+ * The plaintext is not authenticated until xoodyak_aead_decrypt_final()
+ * succeeds and must be discarded if it fails.
+ */
+void xoodyak_aead_decrypt_update
+    (xoodyak_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len);
+
+/**
+ * \brief Finishes an incremental Xoodyak encryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Buffer to receive the 16 byte authentication tag.
+ */
+void xoodyak_aead_encrypt_final
+    (xoodyak_aead_state_t *state, unsigned char *tag);
+
+/**
+ * \brief Finishes an incremental Xoodyak decryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Points to the 16 byte authentication tag to check.
+ *
+ * \return 0 if the tag is correct or -1 if it is incorrect.
+ */
+int xoodyak_aead_decrypt_final
+    (xoodyak_aead_state_t *state, const unsigned char *tag);
+
 /**
  * \brief Hashes a block of input data with Xoodyak to generate a hash value.
  *
@@ -170,6 +357,26 @@ int xoodyak_aead_decrypt
 int xoodyak_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen);
 
+/**
+ * \brief Hashes a batch of independent messages with Xoodyak.
+ *
+ * \param out Points to an array of \a count output buffers, each of
+ * which must be at least XOODYAK_HASH_SIZE bytes in length.
+ * \param in Points to an array of \a count messages to be hashed.
+ * \param inlen Points to an array of \a count message lengths.
+ * \param count Number of messages in the batch.
+ *
+ * \return Returns zero on success or -1 if there was an error in the
+ * parameters.
+ *
+ * The output is the same as calling xoodyak_hash() on each message,
+ * but groups of messages are hashed in lock-step with a multi-lane
+ * Xoodoo permutation.
+ */
+int xoodyak_hash_batch
+    (unsigned char *const *out, const unsigned char *const *in,
+     const unsigned long long *inlen, size_t count);
+
 /**
  * \brief Initializes the state for a Xoodyak hashing operation.
  *
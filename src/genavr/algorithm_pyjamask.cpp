@@ -520,7 +520,7 @@ bool test_pyjamask_96_encrypt(Code &code)
     unsigned char output[12];
     code.exec_encrypt_block(pyjamask_96_ks, sizeof(pyjamask_96_ks),
                             output, 12, pyjamask_96_1.plaintext, 12);
-    return !memcmp(output, pyjamask_96_1.ciphertext, 16);
+    return !memcmp(output, pyjamask_96_1.ciphertext, 12);
 }
 
 bool test_pyjamask_96_decrypt(Code &code)
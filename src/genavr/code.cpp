@@ -255,6 +255,7 @@ void Code::clear()
     m_immCount = 0;
     m_prologueType = Permutation;
     m_localsSize = 0;
+    m_cycles = 0;
     m_name = std::string();
     resetRegs();
 }
@@ -638,6 +638,43 @@ public:
         (void *state, unsigned state_len, const void *key,
          unsigned key_len, unsigned rounds);
 
+    /**
+     * \brief Gets the number of AVR cycles that were consumed by the
+     * last call to one of the exec_*() functions.
+     *
+     * \return The cycle count, including the function prologue and epilogue.
+     *
+     * Cycle counts are for a classic AVR core with a 16-bit program
+     * counter and the "lpm Rd,Z" instruction; e.g. the ATmega328P.
+     */
+    unsigned long cycles() const { return m_cycles; }
+
+    /**
+     * \brief Gets the number of cycles for the function prologue and
+     * epilogue that are written by write().
+     *
+     * \return The number of cycles for the stack frame code.
+     */
+    unsigned long frameCycles() const;
+
+    /**
+     * \brief Gets the size of the function that is written by write().
+     *
+     * \return The size of the code in bytes, excluding S-box tables.
+     */
+    unsigned codeSize() const;
+
+    /**
+     * \brief Determine if a branch needs to be written as a long jump.
+     *
+     * \param offset Offset of the branch instruction.
+     * \param ref Reference to the label that is the target of the branch.
+     *
+     * \return Returns true if the branch target is too far away for a
+     * conditional branch instruction to reach it directly.
+     */
+    bool isLongJump(int offset, unsigned char ref) const;
+
     // Speciality instructions for cryptography.
     void double_gf(const Reg &reg, unsigned feedback);
 
@@ -694,6 +731,7 @@ private:
     unsigned m_immCount;
     PrologueType m_prologueType;
     unsigned m_localsSize;
+    unsigned long m_cycles;
     std::string m_name;
     std::map<unsigned char, Sbox> m_sboxes;
 
@@ -22,6 +22,7 @@
 
 #include "code.h"
 #include <stdexcept>
+#include <sstream>
 
 static void Insn_write_reg(std::ostream &ostream, unsigned char reg)
 {
@@ -155,16 +156,8 @@ static void Insn_write_br
     // Determine if we need to do a long or short jump as it
     // will modify the instruction sequence that we need to use.
     int target = code.getLabel(insn.label());
-    bool forward = true;
-    bool long_jump = false;
-    if (target > offset) {
-        if ((target - (offset + 1)) > 50)
-            long_jump = true;
-    } else {
-        if (((offset + 1) - target) > 50)
-            long_jump = true;
-        forward = false;
-    }
+    bool forward = (target > offset);
+    bool long_jump = code.isLongJump(offset, insn.label());
     if (long_jump && insn.type() != Insn::JMP && insn.type() != Insn::CALL) {
         // We need to jump a long way, so output the reverse branch as a
         // skip and then perform an "rjmp" instruction to jump to where
@@ -608,3 +601,99 @@ void Code::write_alias(std::ostream &ostream, const std::string &name) const
     ostream << ".global " << name << std::endl;
     ostream << "\t.set " << name << "," << m_name << std::endl;
 }
+
+bool Code::isLongJump(int offset, unsigned char ref) const
+{
+    int target = getLabel(ref);
+    if (target > offset)
+        return (target - (offset + 1)) > 50;
+    else
+        return ((offset + 1) - target) > 50;
+}
+
+// Accumulate the size and straight-line cycle count of assembly code.
+// Where the code has alternatives for different AVR chips, we select the
+// "__AVR_HAVE_LPMX__" variant without RAMPZ, which matches the ATmega328P.
+static void asm_cost(const std::string &text, unsigned &words,
+                     unsigned long &cycles)
+{
+    std::istringstream lines(text);
+    std::string line;
+    bool active = true;
+    bool taken = false;
+    while (std::getline(lines, line)) {
+        if (line.compare(0, 4, "#if ") == 0) {
+            active = (line.find("__AVR_HAVE_LPMX__") != std::string::npos);
+            taken = active;
+            continue;
+        } else if (line.compare(0, 6, "#elif ") == 0) {
+            active = !taken &&
+                (line.find("__AVR_HAVE_LPMX__") != std::string::npos);
+            taken = taken || active;
+            continue;
+        } else if (line.compare(0, 5, "#else") == 0) {
+            active = !taken;
+            continue;
+        } else if (line.compare(0, 6, "#endif") == 0) {
+            active = true;
+            taken = false;
+            continue;
+        }
+        if (!active || line.size() < 2 || line[0] != '\t' || line[1] == '.')
+            continue;
+        std::string name = line.substr(1, line.find(' ') - 1);
+        if (name == "call" || name == "jmp") {
+            words += 2;
+            cycles += (name == "call") ? 4 : 3;
+        } else if (name == "lds" || name == "sts") {
+            words += 2;
+            cycles += 2;
+        } else if (name == "ret") {
+            words += 1;
+            cycles += 4;
+        } else if (name == "rcall") {
+            words += 1;
+            cycles += 3;
+        } else if (name == "lpm" || name == "elpm") {
+            words += 1;
+            cycles += 3;
+        } else if (name == "rjmp" || name == "push" || name == "pop" ||
+                   name == "adiw" || name == "sbiw" ||
+                   name == "ld" || name == "ldd" ||
+                   name == "st" || name == "std") {
+            words += 1;
+            cycles += 2;
+        } else {
+            words += 1;
+            cycles += 1;
+        }
+    }
+}
+
+unsigned long Code::frameCycles() const
+{
+    // Cost the entire function and then subtract off the instructions
+    // in the body.  What remains is the straight-line prologue and epilogue.
+    std::ostringstream function;
+    std::ostringstream body;
+    write(function);
+    for (unsigned index = 0; index < m_insns.size(); ++index)
+        m_insns[index].write(body, *this, index);
+    unsigned function_words = 0;
+    unsigned body_words = 0;
+    unsigned long function_cycles = 0;
+    unsigned long body_cycles = 0;
+    asm_cost(function.str(), function_words, function_cycles);
+    asm_cost(body.str(), body_words, body_cycles);
+    return function_cycles - body_cycles;
+}
+
+unsigned Code::codeSize() const
+{
+    std::ostringstream function;
+    unsigned words = 0;
+    unsigned long cycles = 0;
+    write(function);
+    asm_cost(function.str(), words, cycles);
+    return words * 2;
+}
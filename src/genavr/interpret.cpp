@@ -40,6 +40,7 @@ struct AVRState
     unsigned char memory[MEM_SIZE];
     unsigned used;
     int pc;
+    unsigned long cycles;
     Sbox sbox;
     int sbox_offset;
 
@@ -53,6 +54,7 @@ struct AVRState
         memset(memory, 0xAA, sizeof(memory));
         used = 0x01F2; // First address to allocate via alloc_buffer().
         pc = 0;
+        cycles = 0;
         setPair(32, MEM_SIZE); // Initial stack pointer.
         sbox_offset = 0;
     }
@@ -120,11 +122,68 @@ unsigned AVRState::alloc_buffer(const void *data, unsigned len)
     return result;
 }
 
+// Gets the number of cycles for an instruction on a classic AVR core
+// with a 16-bit program counter and "lpm Rd,Z"; e.g. the ATmega328P.
+// Conditional branches and skips are costed when they are executed.
+static unsigned insn_cycles(const Insn &insn)
+{
+    switch (insn.type()) {
+    case Insn::ADIW:
+    case Insn::JMP:
+    case Insn::LD_X:
+    case Insn::LD_Y:
+    case Insn::LD_Z:
+    case Insn::POP:
+    case Insn::PUSH:
+    case Insn::SBIW:
+    case Insn::ST_X:
+    case Insn::ST_Y:
+    case Insn::ST_Z:
+    case Insn::LPM_SETUP:
+    case Insn::LPM_SWITCH:
+        return 2;
+    case Insn::CALL:
+        return 3;
+    case Insn::RET:
+        return 4;
+    case Insn::LPM_SBOX:
+        // "mov r30,reg2" followed by "lpm reg1,Z".
+        return (insn.reg2() != 30) ? 4 : 3;
+    case Insn::BRCC:
+    case Insn::BRCS:
+    case Insn::BREQ:
+    case Insn::BRNE:
+    case Insn::LABEL:
+    case Insn::LPM_CLEAN:
+    case Insn::PRINT:
+    case Insn::PRINTCH:
+    case Insn::PRINTLN:
+        return 0;
+    default: break;
+    }
+    return 1;
+}
+
+// Executes a conditional branch.
+static void exec_branch
+    (AVRState &s, const Code &code, const Insn &insn, bool taken)
+{
+    if (code.isLongJump(s.pc - 1, insn.label())) {
+        // Reverse branch to skip over an "rjmp" to the real destination.
+        s.cycles += (taken ? 3 : 2);
+    } else {
+        s.cycles += (taken ? 2 : 1);
+    }
+    if (taken)
+        s.pc = code.getLabel(insn.label());
+}
+
 // Executes a single instruction.
 static void exec_insn(AVRState &s, const Code &code, const Insn &insn)
 {
     static char const hex[] = "0123456789abcdef";
     unsigned temp;
+    s.cycles += insn_cycles(insn);
     switch (insn.type()) {
     case Insn::ADC:
         // Add with carry in.
@@ -182,23 +241,19 @@ static void exec_insn(AVRState &s, const Code &code, const Insn &insn)
         break; }
     case Insn::BRCC:
         // Branch if carry clear.
-        if (!s.c)
-            s.pc = code.getLabel(insn.label());
+        exec_branch(s, code, insn, !s.c);
         break;
     case Insn::BRCS:
         // Branch if carry set.
-        if (s.c)
-            s.pc = code.getLabel(insn.label());
+        exec_branch(s, code, insn, s.c);
         break;
     case Insn::BREQ:
         // Branch if equal / zero.
-        if (s.z)
-            s.pc = code.getLabel(insn.label());
+        exec_branch(s, code, insn, s.z);
         break;
     case Insn::BRNE:
         // Branch if not equal.
-        if (!s.z)
-            s.pc = code.getLabel(insn.label());
+        exec_branch(s, code, insn, !s.z);
         break;
     case Insn::CALL:
         // Call a local subroutine.
@@ -230,8 +285,10 @@ static void exec_insn(AVRState &s, const Code &code, const Insn &insn)
         break; }
     case Insn::CPSE:
         // Compare and skip if equal.
-        if (s.r[insn.reg1()] == s.r[insn.reg2()])
+        if (s.r[insn.reg1()] == s.r[insn.reg2()]) {
             ++(s.pc);
+            ++(s.cycles);
+        }
         break;
     case Insn::DEC:
         // Decrement a register.
@@ -475,6 +532,7 @@ void Code::exec_setup_key(void *schedule, unsigned schedule_len,
         Insn insn = m_insns[(s.pc)++];
         exec_insn(s, *this, insn);
     }
+    m_cycles = s.cycles + frameCycles();
     if (s.r[1] != 0x00 && !hasFlag(TempR1))
         throw std::invalid_argument("r1 is non-zero at the end of the code");
     if (s.pair(32) != fp)
@@ -516,6 +574,7 @@ void Code::exec_encrypt_block(const void *key, unsigned key_len,
         Insn insn = m_insns[(s.pc)++];
         exec_insn(s, *this, insn);
     }
+    m_cycles = s.cycles + frameCycles();
     if (s.r[1] != 0x00 && !hasFlag(TempR1))
         throw std::invalid_argument("r1 is non-zero at the end of the code");
     if (s.pair(32) != fp)
@@ -560,6 +619,7 @@ void Code::exec_encrypt_block_with_tweak_ptr
         Insn insn = m_insns[(s.pc)++];
         exec_insn(s, *this, insn);
     }
+    m_cycles = s.cycles + frameCycles();
     if (s.r[1] != 0x00 && !hasFlag(TempR1))
         throw std::invalid_argument("r1 is non-zero at the end of the code");
     if (s.pair(32) != fp)
@@ -598,6 +658,7 @@ void Code::exec_permutation
         Insn insn = m_insns[(s.pc)++];
         exec_insn(s, *this, insn);
     }
+    m_cycles = s.cycles + frameCycles();
     if (s.r[1] != 0x00 && !hasFlag(TempR1))
         throw std::invalid_argument("r1 is non-zero at the end of the code");
     if (s.pair(32) != fp)
@@ -635,6 +696,7 @@ void Code::exec_tinyjambu
         Insn insn = m_insns[(s.pc)++];
         exec_insn(s, *this, insn);
     }
+    m_cycles = s.cycles + frameCycles();
     if (s.r[1] != 0x00 && !hasFlag(TempR1))
         throw std::invalid_argument("r1 is non-zero at the end of the code");
     if (s.pair(32) != fp)
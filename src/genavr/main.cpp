@@ -22,12 +22,14 @@
 
 #include "gen.h"
 #include <iostream>
+#include <iomanip>
 #include <cstring>
 
 enum Mode
 {
     Generate,
-    Test
+    Test,
+    Cycles
 };
 
 static void header(std::ostream &ostream)
@@ -43,6 +45,42 @@ static void footer(std::ostream &ostream)
     ostream << "#endif" << std::endl;
 }
 
+// Reports that the tests for a primitive succeeded.  In cycle-counting mode
+// we report the cycles for the last call and the size of the code instead.
+static void succeeded(enum Mode mode, const Code &code, const std::string &name)
+{
+    if (mode == Cycles) {
+        std::cout << std::left << std::setw(44) << name << std::right;
+        std::cout << std::setw(10) << code.cycles();
+        std::cout << std::setw(8) << code.codeSize() << std::endl;
+    } else {
+        std::cout << name << " tests succeeded" << std::endl;
+    }
+}
+
+// Reports that the tests for a primitive failed.  In cycle-counting mode
+// the row is still printed, with a marker after the code size.
+static void failed(enum Mode mode, const Code &code, const std::string &name)
+{
+    if (mode == Cycles) {
+        std::cout << std::left << std::setw(44) << name << std::right;
+        std::cout << std::setw(10) << code.cycles();
+        std::cout << std::setw(8) << code.codeSize() << "  FAILED" << std::endl;
+    } else {
+        std::cout << name << " tests FAILED" << std::endl;
+    }
+}
+
+// Reports the code size for a primitive that has no tests of its own.
+static void untested(enum Mode mode, const Code &code, const std::string &name)
+{
+    if (mode == Cycles) {
+        std::cout << std::left << std::setw(44) << name << std::right;
+        std::cout << std::setw(10) << "-";
+        std::cout << std::setw(8) << code.codeSize() << std::endl;
+    }
+}
+
 static bool ascon(enum Mode mode)
 {
     Code code;
@@ -51,10 +89,10 @@ static bool ascon(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_ascon_permutation(code)) {
-            std::cout << "ASCON tests FAILED" << std::endl;
+            failed(mode, code, "ASCON");
             return false;
         } else {
-            std::cout << "ASCON tests succeeded" << std::endl;
+            succeeded(mode, code, "ASCON");
         }
     }
     return true;
@@ -68,10 +106,10 @@ static bool cham128(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_cham128_encrypt(code)) {
-            std::cout << "CHAM128-128 tests FAILED" << std::endl;
+            failed(mode, code, "CHAM128-128");
             return false;
         } else {
-            std::cout << "CHAM128-128 tests succeeded" << std::endl;
+            succeeded(mode, code, "CHAM128-128");
         }
     }
     return true;
@@ -85,10 +123,10 @@ static bool cham64(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_cham64_encrypt(code)) {
-            std::cout << "CHAM64-128 tests FAILED" << std::endl;
+            failed(mode, code, "CHAM64-128");
             return false;
         } else {
-            std::cout << "CHAM64-128 tests succeeded" << std::endl;
+            succeeded(mode, code, "CHAM64-128");
         }
     }
     return true;
@@ -102,10 +140,10 @@ static bool gascon128_core(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gascon128_core_round(code)) {
-            std::cout << "GASCON-128 tests FAILED" << std::endl;
+            failed(mode, code, "GASCON-128");
             return false;
         } else {
-            std::cout << "GASCON-128 tests succeeded" << std::endl;
+            succeeded(mode, code, "GASCON-128");
         }
     }
     return true;
@@ -119,10 +157,10 @@ static bool gascon128_g(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_drysponge128_g(code)) {
-            std::cout << "GASCON-128-G tests FAILED" << std::endl;
+            failed(mode, code, "GASCON-128-G");
             return false;
         } else {
-            std::cout << "GASCON-128-G tests succeeded" << std::endl;
+            succeeded(mode, code, "GASCON-128-G");
         }
     }
     return true;
@@ -146,10 +184,10 @@ static bool gascon256_core(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gascon256_core_round(code)) {
-            std::cout << "GASCON-256 tests FAILED" << std::endl;
+            failed(mode, code, "GASCON-256");
             return false;
         } else {
-            std::cout << "GASCON-256 tests succeeded" << std::endl;
+            succeeded(mode, code, "GASCON-256");
         }
     }
     return true;
@@ -163,10 +201,10 @@ static bool gascon256_g(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_drysponge256_g(code)) {
-            std::cout << "GASCON-256-G tests FAILED" << std::endl;
+            failed(mode, code, "GASCON-256-G");
             return false;
         } else {
-            std::cout << "GASCON-256-G tests succeeded" << std::endl;
+            succeeded(mode, code, "GASCON-256-G");
         }
     }
     return true;
@@ -191,10 +229,10 @@ static bool gift128b_setup_key(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_setup_key(code)) {
-            std::cout << "GIFT-128b key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b key setup");
             return false;
         } else {
-            std::cout << "GIFT-128b key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b key setup");
         }
     }
     return true;
@@ -208,10 +246,10 @@ static bool gift128b_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_encrypt(code)) {
-            std::cout << "GIFT-128b encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b encrypt");
         }
     }
     return true;
@@ -225,10 +263,10 @@ static bool gift128b_encrypt_block_preloaded(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_encrypt_preloaded(code)) {
-            std::cout << "GIFT-128b preloaded encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b preloaded encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b preloaded encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b preloaded encrypt");
         }
     }
     return true;
@@ -242,10 +280,10 @@ static bool gift128b_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_decrypt(code)) {
-            std::cout << "GIFT-128b decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b decrypt");
         }
     }
     return true;
@@ -274,10 +312,10 @@ static bool gift128b_setup_key_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_setup_key(code)) {
-            std::cout << "GIFT-128b-alt key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-alt key setup");
             return false;
         } else {
-            std::cout << "GIFT-128b-alt key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-alt key setup");
         }
     }
     return true;
@@ -291,10 +329,10 @@ static bool gift128b_encrypt_block_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_encrypt(code)) {
-            std::cout << "GIFT-128b-alt encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-alt encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-alt encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-alt encrypt");
         }
     }
     return true;
@@ -308,10 +346,10 @@ static bool gift128b_decrypt_block_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128b_decrypt(code)) {
-            std::cout << "GIFT-128b-alt decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-alt decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-alt decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-alt decrypt");
         }
     }
     return true;
@@ -325,10 +363,10 @@ static bool gift128n_encrypt_block_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128n_encrypt_alt(code)) {
-            std::cout << "GIFT-128n-alt encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-alt encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n-alt encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-alt encrypt");
         }
     }
     return true;
@@ -342,10 +380,10 @@ static bool gift128n_decrypt_block_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128n_decrypt_alt(code)) {
-            std::cout << "GIFT-128n-alt decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-alt decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n-alt decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-alt decrypt");
         }
     }
     return true;
@@ -376,10 +414,10 @@ static bool gift128n_setup_key(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128n_setup_key(code)) {
-            std::cout << "GIFT-128n key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n key setup");
             return false;
         } else {
-            std::cout << "GIFT-128n key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n key setup");
         }
     }
     return true;
@@ -393,10 +431,10 @@ static bool gift128n_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128n_encrypt(code)) {
-            std::cout << "GIFT-128n encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n encrypt");
         }
     }
     return true;
@@ -410,10 +448,10 @@ static bool gift128n_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128n_decrypt(code)) {
-            std::cout << "GIFT-128n decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n decrypt");
         }
     }
     return true;
@@ -427,10 +465,10 @@ static bool gift128t_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128t_encrypt(code)) {
-            std::cout << "TweGIFT-128 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "TweGIFT-128 encrypt");
             return false;
         } else {
-            std::cout << "TweGIFT-128 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "TweGIFT-128 encrypt");
         }
     }
     return true;
@@ -444,10 +482,10 @@ static bool gift128t_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift128t_decrypt(code)) {
-            std::cout << "TweGIFT-128 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "TweGIFT-128 decrypt");
             return false;
         } else {
-            std::cout << "TweGIFT-128 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "TweGIFT-128 decrypt");
         }
     }
     return true;
@@ -478,10 +516,12 @@ static bool gift128b_fs_setup_key(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_setup_key(code, num_keys)) {
-            std::cout << "GIFT-128b-fs-" << num_keys << " key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                   " key setup");
             return false;
         } else {
-            std::cout << "GIFT-128b-fs-" << num_keys << " key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                      " key setup");
         }
     }
     return true;
@@ -495,10 +535,12 @@ static bool gift128b_fs_encrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_encrypt(code, num_keys)) {
-            std::cout << "GIFT-128b-fs-" << num_keys << " encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                   " encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-fs-" << num_keys << " encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                      " encrypt");
         }
     }
     return true;
@@ -512,10 +554,12 @@ static bool gift128b_fs_encrypt_block_preloaded(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_encrypt_preloaded(code, num_keys)) {
-            std::cout << "GIFT-128b-fs-" << num_keys << " preloaded encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                   " preloaded encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-fs-" << num_keys << " preloaded encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                      " preloaded encrypt");
         }
     }
     return true;
@@ -531,10 +575,12 @@ static bool gift128b_fs_decrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_decrypt(code, num_keys)) {
-            std::cout << "GIFT-128b-fs-" << num_keys << " decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                   " decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-fs-" << num_keys << " decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-fs-" + std::to_string(num_keys) +
+                      " decrypt");
         }
     }
     return true;
@@ -594,10 +640,12 @@ static bool gift128n_fs_setup_key(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128n_fs_setup_key(code, num_keys)) {
-            std::cout << "GIFT-128n-fs-" << num_keys << " key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-fs-" + std::to_string(num_keys) +
+                   " key setup");
             return false;
         } else {
-            std::cout << "GIFT-128n-fs-" << num_keys << " key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-fs-" + std::to_string(num_keys) +
+                      " key setup");
         }
     }
     return true;
@@ -611,10 +659,12 @@ static bool gift128n_fs_encrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128n_fs_encrypt(code, num_keys)) {
-            std::cout << "GIFT-128n-fs-" << num_keys << " encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-fs-" + std::to_string(num_keys) +
+                   " encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n-fs-" << num_keys << " encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-fs-" + std::to_string(num_keys) +
+                      " encrypt");
         }
     }
     return true;
@@ -630,10 +680,12 @@ static bool gift128n_fs_decrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128n_fs_decrypt(code, num_keys)) {
-            std::cout << "GIFT-128n-fs-" << num_keys << " decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-fs-" + std::to_string(num_keys) +
+                   " decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n-fs-" << num_keys << " decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-fs-" + std::to_string(num_keys) +
+                      " decrypt");
         }
     }
     return true;
@@ -647,10 +699,12 @@ static bool gift128t_fs_encrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128t_fs_encrypt(code, num_keys)) {
-            std::cout << "GIFT-128t-fs-" << num_keys << " encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128t-fs-" + std::to_string(num_keys) +
+                   " encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128t-fs-" << num_keys << " encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128t-fs-" + std::to_string(num_keys) +
+                      " encrypt");
         }
     }
     return true;
@@ -664,10 +718,12 @@ static bool gift128t_fs_decrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128t_fs_decrypt(code, num_keys)) {
-            std::cout << "GIFT-128t-fs-" << num_keys << " decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128t-fs-" + std::to_string(num_keys) +
+                   " decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128t-fs-" << num_keys << " decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128t-fs-" + std::to_string(num_keys) +
+                      " decrypt");
         }
     }
     return true;
@@ -729,10 +785,12 @@ static bool gift128b_alt_fs_setup_key(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_setup_key(code, num_keys)) {
-            std::cout << "GIFT-128b-alt-fs-" << num_keys << " key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-alt-fs-" + std::to_string(num_keys) +
+                   " key setup");
             return false;
         } else {
-            std::cout << "GIFT-128b-alt-fs-" << num_keys << " key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-alt-fs-" + std::to_string(num_keys) +
+                      " key setup");
         }
     }
     return true;
@@ -746,10 +804,12 @@ static bool gift128b_alt_fs_encrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_encrypt(code, num_keys)) {
-            std::cout << "GIFT-128b-alt-fs-" << num_keys << " encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-alt-fs-" + std::to_string(num_keys) +
+                   " encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-alt-fs-" << num_keys << " encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-alt-fs-" + std::to_string(num_keys) +
+                      " encrypt");
         }
     }
     return true;
@@ -765,10 +825,12 @@ static bool gift128b_alt_fs_decrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128b_fs_decrypt(code, num_keys)) {
-            std::cout << "GIFT-128b-alt-fs-" << num_keys << " decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128b-alt-fs-" + std::to_string(num_keys) +
+                   " decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128b-alt-fs-" << num_keys << " decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128b-alt-fs-" + std::to_string(num_keys) +
+                      " decrypt");
         }
     }
     return true;
@@ -782,10 +844,12 @@ static bool gift128n_alt_fs_encrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128n_fs_encrypt_alt(code, num_keys)) {
-            std::cout << "GIFT-128n-alt-fs-" << num_keys << " encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-alt-fs-" + std::to_string(num_keys) +
+                   " encrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n-alt-fs-" << num_keys << " encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-alt-fs-" + std::to_string(num_keys) +
+                      " encrypt");
         }
     }
     return true;
@@ -799,10 +863,12 @@ static bool gift128n_alt_fs_decrypt_block(enum Mode mode, int num_keys)
         code.write(std::cout);
     } else {
         if (!test_gift128n_fs_decrypt_alt(code, num_keys)) {
-            std::cout << "GIFT-128n-alt-fs-" << num_keys << " decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-128n-alt-fs-" + std::to_string(num_keys) +
+                   " decrypt");
             return false;
         } else {
-            std::cout << "GIFT-128n-alt-fs-" << num_keys << " decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-128n-alt-fs-" + std::to_string(num_keys) +
+                      " decrypt");
         }
     }
     return true;
@@ -847,10 +913,10 @@ static bool gift64_setup_key(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64n_setup_key(code)) {
-            std::cout << "GIFT-64 key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-64 key setup");
             return false;
         } else {
-            std::cout << "GIFT-64 key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-64 key setup");
         }
     }
     return true;
@@ -864,10 +930,10 @@ static bool gift64_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64n_encrypt(code)) {
-            std::cout << "GIFT-64 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-64 encrypt");
             return false;
         } else {
-            std::cout << "GIFT-64 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-64 encrypt");
         }
     }
     return true;
@@ -881,10 +947,10 @@ static bool gift64_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64n_decrypt(code)) {
-            std::cout << "GIFT-64 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-64 decrypt");
             return false;
         } else {
-            std::cout << "GIFT-64 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-64 decrypt");
         }
     }
     return true;
@@ -898,10 +964,10 @@ static bool gift64t_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64t_encrypt(code)) {
-            std::cout << "TweGIFT-64 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "TweGIFT-64 encrypt");
             return false;
         } else {
-            std::cout << "TweGIFT-64 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "TweGIFT-64 encrypt");
         }
     }
     return true;
@@ -915,10 +981,10 @@ static bool gift64t_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64t_decrypt(code)) {
-            std::cout << "TweGIFT-64 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "TweGIFT-64 decrypt");
             return false;
         } else {
-            std::cout << "TweGIFT-64 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "TweGIFT-64 decrypt");
         }
     }
     return true;
@@ -948,10 +1014,10 @@ static bool gift64_setup_key_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64_setup_key_alt(code)) {
-            std::cout << "GIFT-64-alt key setup tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-64-alt key setup");
             return false;
         } else {
-            std::cout << "GIFT-64-alt key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-64-alt key setup");
         }
     }
     return true;
@@ -965,10 +1031,10 @@ static bool gift64_encrypt_block_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64_encrypt_alt(code)) {
-            std::cout << "GIFT-64-alt encrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-64-alt encrypt");
             return false;
         } else {
-            std::cout << "GIFT-64-alt encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-64-alt encrypt");
         }
     }
     return true;
@@ -982,10 +1048,10 @@ static bool gift64_decrypt_block_alt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gift64_decrypt_alt(code)) {
-            std::cout << "GIFT-64-alt decrypt tests FAILED" << std::endl;
+            failed(mode, code, "GIFT-64-alt decrypt");
             return false;
         } else {
-            std::cout << "GIFT-64-alt decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "GIFT-64-alt decrypt");
         }
     }
     return true;
@@ -1011,10 +1077,10 @@ static bool gimli24(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_gimli24_permutation(code)) {
-            std::cout << "GIMLI-24 tests FAILED" << std::endl;
+            failed(mode, code, "GIMLI-24");
             return false;
         } else {
-            std::cout << "GIMLI-24 tests succeeded" << std::endl;
+            succeeded(mode, code, "GIMLI-24");
         }
     }
     return true;
@@ -1028,10 +1094,10 @@ static bool grain128_core(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_grain128_core(code)) {
-            std::cout << "Grain-128 core tests FAILED" << std::endl;
+            failed(mode, code, "Grain-128 core");
             return false;
         } else {
-                std::cout << "Grain-128 core tests succeeded" << std::endl;
+            succeeded(mode, code, "Grain-128 core");
         }
     }
     return true;
@@ -1045,10 +1111,10 @@ static bool grain128_preoutput(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_grain128_preoutput(code)) {
-            std::cout << "Grain-128 preoutput tests FAILED" << std::endl;
+            failed(mode, code, "Grain-128 preoutput");
             return false;
         } else {
-                std::cout << "Grain-128 preoutput tests succeeded" << std::endl;
+            succeeded(mode, code, "Grain-128 preoutput");
         }
     }
     return true;
@@ -1060,6 +1126,8 @@ static bool grain128_swap_word32(enum Mode mode)
     gen_grain128_swap_word32(code);
     if (mode == Generate)
         code.write(std::cout);
+    else
+        untested(mode, code, "Grain-128 swap_word32");
     return true;
 }
 
@@ -1069,6 +1137,8 @@ static bool grain128_compute_tag(enum Mode mode)
     gen_grain128_compute_tag(code);
     if (mode == Generate)
         code.write(std::cout);
+    else
+        untested(mode, code, "Grain-128 compute_tag");
     return true;
 }
 
@@ -1078,6 +1148,8 @@ static bool grain128_interleave(enum Mode mode)
     gen_grain128_interleave(code);
     if (mode == Generate)
         code.write(std::cout);
+    else
+        untested(mode, code, "Grain-128 interleave");
     return true;
 }
 
@@ -1105,10 +1177,10 @@ static bool keccakp_200(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_keccakp_200_permutation(code)) {
-            std::cout << "Keccak-p[200] tests FAILED" << std::endl;
+            failed(mode, code, "Keccak-p[200]");
             return false;
         } else {
-            std::cout << "Keccak-p[200] tests succeeded" << std::endl;
+            succeeded(mode, code, "Keccak-p[200]");
         }
     }
     return true;
@@ -1122,10 +1194,10 @@ static bool keccakp_400(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_keccakp_400_permutation(code)) {
-            std::cout << "Keccak-p[400] tests FAILED" << std::endl;
+            failed(mode, code, "Keccak-p[400]");
             return false;
         } else {
-            std::cout << "Keccak-p[400] tests succeeded" << std::endl;
+            succeeded(mode, code, "Keccak-p[400]");
         }
     }
     return true;
@@ -1140,10 +1212,10 @@ static bool knot256_6(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_knot256_permutation(code, 6)) {
-            std::cout << "KNOT-256-6 tests FAILED" << std::endl;
+            failed(mode, code, "KNOT-256-6");
             return false;
         } else {
-            std::cout << "KNOT-256-6 tests succeeded" << std::endl;
+            succeeded(mode, code, "KNOT-256-6");
         }
     }
     return true;
@@ -1158,10 +1230,10 @@ static bool knot256_7(enum Mode mode)
         code.write(std::cout);
     } else {/* not used
         if (!test_knot256_permutation(code, 7)) {
-            std::cout << "KNOT-256-7 tests FAILED" << std::endl;
+            failed(mode, code, "KNOT-256-7");
             return false;
         } else {
-            std::cout << "KNOT-256-7 tests succeeded" << std::endl;
+            succeeded(mode, code, "KNOT-256-7");
         }*/
     }
     return true;
@@ -1183,10 +1255,10 @@ static bool knot384(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_knot384_permutation(code, 7)) {
-            std::cout << "KNOT-384-7 tests FAILED" << std::endl;
+            failed(mode, code, "KNOT-384-7");
             return false;
         } else {
-            std::cout << "KNOT-384-7 tests succeeded" << std::endl;
+            succeeded(mode, code, "KNOT-384-7");
         }
     }
     return true;
@@ -1201,10 +1273,10 @@ static bool knot512_7(enum Mode mode)
         code.write(std::cout);
     } else { /* not used
         if (!test_knot512_permutation(code, 7)) {
-            std::cout << "KNOT-512-7 tests FAILED" << std::endl;
+            failed(mode, code, "KNOT-512-7");
             return false;
         } else {
-            std::cout << "KNOT-512-7 tests succeeded" << std::endl;
+            succeeded(mode, code, "KNOT-512-7");
         } */
     }
     return true;
@@ -1219,10 +1291,10 @@ static bool knot512_8(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_knot512_permutation(code, 8)) {
-            std::cout << "KNOT-512-8 tests FAILED" << std::endl;
+            failed(mode, code, "KNOT-512-8");
             return false;
         } else {
-            std::cout << "KNOT-512-8 tests succeeded" << std::endl;
+            succeeded(mode, code, "KNOT-512-8");
         }
     }
     return true;
@@ -1243,10 +1315,10 @@ static bool photon256(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_photon256_permutation(code)) {
-            std::cout << "PHOTON-256 tests FAILED" << std::endl;
+            failed(mode, code, "PHOTON-256");
             return false;
         } else {
-            std::cout << "PHOTON-256 tests succeeded" << std::endl;
+            succeeded(mode, code, "PHOTON-256");
         }
     }
     return true;
@@ -1260,10 +1332,10 @@ static bool pyjamask_96_setup_key(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_pyjamask_96_setup_key(code)) {
-            std::cout << "Pyjamask-96 key setup tests FAILED" << std::endl;
+            failed(mode, code, "Pyjamask-96 key setup");
             return false;
         } else {
-            std::cout << "Pyjamask-96 key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "Pyjamask-96 key setup");
         }
     }
     return true;
@@ -1277,10 +1349,10 @@ static bool pyjamask_96_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_pyjamask_96_encrypt(code)) {
-            std::cout << "Pyjamask-96 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "Pyjamask-96 encrypt");
             return false;
         } else {
-            std::cout << "Pyjamask-96 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Pyjamask-96 encrypt");
         }
     }
     return true;
@@ -1294,10 +1366,10 @@ static bool pyjamask_96_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_pyjamask_96_decrypt(code)) {
-            std::cout << "Pyjamask-96 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "Pyjamask-96 decrypt");
             return false;
         } else {
-            std::cout << "Pyjamask-96 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Pyjamask-96 decrypt");
         }
     }
     return true;
@@ -1311,10 +1383,10 @@ static bool pyjamask_128_setup_key(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_pyjamask_128_setup_key(code)) {
-            std::cout << "Pyjamask-128 key setup tests FAILED" << std::endl;
+            failed(mode, code, "Pyjamask-128 key setup");
             return false;
         } else {
-            std::cout << "Pyjamask-128 key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "Pyjamask-128 key setup");
         }
     }
     return true;
@@ -1328,10 +1400,10 @@ static bool pyjamask_128_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_pyjamask_128_encrypt(code)) {
-            std::cout << "Pyjamask-128 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "Pyjamask-128 encrypt");
             return false;
         } else {
-            std::cout << "Pyjamask-128 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Pyjamask-128 encrypt");
         }
     }
     return true;
@@ -1345,10 +1417,10 @@ static bool pyjamask_128_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_pyjamask_128_decrypt(code)) {
-            std::cout << "Pyjamask-128 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "Pyjamask-128 decrypt");
             return false;
         } else {
-            std::cout << "Pyjamask-128 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Pyjamask-128 decrypt");
         }
     }
     return true;
@@ -1381,10 +1453,10 @@ static bool saturnin_setup_key(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_saturnin_setup_key(code)) {
-            std::cout << "Saturnin key setup tests FAILED" << std::endl;
+            failed(mode, code, "Saturnin key setup");
             return false;
         } else {
-            std::cout << "Saturnin key setup tests succeeded" << std::endl;
+            succeeded(mode, code, "Saturnin key setup");
         }
     }
     return true;
@@ -1398,10 +1470,10 @@ static bool saturnin_encrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_saturnin_encrypt(code)) {
-            std::cout << "Saturnin encrypt tests FAILED" << std::endl;
+            failed(mode, code, "Saturnin encrypt");
             return false;
         } else {
-            std::cout << "Saturnin encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Saturnin encrypt");
         }
     }
     return true;
@@ -1415,10 +1487,10 @@ static bool saturnin_decrypt_block(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_saturnin_decrypt(code)) {
-            std::cout << "Saturnin decrypt tests FAILED" << std::endl;
+            failed(mode, code, "Saturnin decrypt");
             return false;
         } else {
-            std::cout << "Saturnin decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Saturnin decrypt");
         }
     }
     return true;
@@ -1444,10 +1516,10 @@ static bool simp256(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_simp_256_permutation(code)) {
-            std::cout << "SimP-256 tests FAILED" << std::endl;
+            failed(mode, code, "SimP-256");
             return false;
         } else {
-            std::cout << "SimP-256 tests succeeded" << std::endl;
+            succeeded(mode, code, "SimP-256");
         }
     }
     return true;
@@ -1461,10 +1533,10 @@ static bool simp192(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_simp_192_permutation(code)) {
-            std::cout << "SimP-192 tests FAILED" << std::endl;
+            failed(mode, code, "SimP-192");
             return false;
         } else {
-            std::cout << "SimP-192 tests succeeded" << std::endl;
+            succeeded(mode, code, "SimP-192");
         }
     }
     return true;
@@ -1485,6 +1557,8 @@ static bool skinny128_384_setup_key(enum Mode mode)
     gen_skinny128_384_setup_key(code);
     if (mode == Generate)
         code.write(std::cout);
+    else
+        untested(mode, code, "SKINNY-128-384 key setup");
     return true;
 }
 
@@ -1497,10 +1571,10 @@ static bool skinny128_384_encrypt(enum Mode mode)
         code.write_alias(std::cout, "skinny_128_384_encrypt_tk_full");
     } else {
         if (!test_skinny128_384_encrypt(code)) {
-            std::cout << "SKINNY-128-384 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "SKINNY-128-384 encrypt");
             return false;
         } else {
-            std::cout << "SKINNY-128-384 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "SKINNY-128-384 encrypt");
         }
     }
     return true;
@@ -1514,10 +1588,10 @@ static bool skinny128_384_decrypt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_skinny128_384_decrypt(code)) {
-            std::cout << "SKINNY-128-384 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "SKINNY-128-384 decrypt");
             return false;
         } else {
-            std::cout << "SKINNY-128-384 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "SKINNY-128-384 decrypt");
         }
     }
     return true;
@@ -1529,6 +1603,8 @@ static bool skinny128_256_setup_key(enum Mode mode)
     gen_skinny128_256_setup_key(code);
     if (mode == Generate)
         code.write(std::cout);
+    else
+        untested(mode, code, "SKINNY-128-256 key setup");
     return true;
 }
 
@@ -1541,10 +1617,10 @@ static bool skinny128_256_encrypt(enum Mode mode)
         code.write_alias(std::cout, "skinny_128_256_encrypt_tk_full");
     } else {
         if (!test_skinny128_256_encrypt(code)) {
-            std::cout << "SKINNY-128-256 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "SKINNY-128-256 encrypt");
             return false;
         } else {
-            std::cout << "SKINNY-128-256 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "SKINNY-128-256 encrypt");
         }
     }
     return true;
@@ -1558,10 +1634,10 @@ static bool skinny128_256_decrypt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_skinny128_256_decrypt(code)) {
-            std::cout << "SKINNY-128-256 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "SKINNY-128-256 decrypt");
             return false;
         } else {
-            std::cout << "SKINNY-128-256 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "SKINNY-128-256 decrypt");
         }
     }
     return true;
@@ -1598,10 +1674,10 @@ static bool sliscp256_spix(enum Mode mode)
         code2.write(std::cout);
     } else {
         if (!test_sliscp_light256_spix_permutation(code)) {
-            std::cout << "sLiSCP-light-256-SPIX tests FAILED" << std::endl;
+            failed(mode, code, "sLiSCP-light-256-SPIX");
             return false;
         } else {
-            std::cout << "sLiSCP-light-256-SPIX tests succeeded" << std::endl;
+            succeeded(mode, code, "sLiSCP-light-256-SPIX");
         }
     }
     return true;
@@ -1619,10 +1695,10 @@ static bool sliscp256_spoc(enum Mode mode)
         code2.write(std::cout);
     } else {
         if (!test_sliscp_light256_spoc_permutation(code)) {
-            std::cout << "sLiSCP-light-256-SpoC tests FAILED" << std::endl;
+            failed(mode, code, "sLiSCP-light-256-SpoC");
             return false;
         } else {
-            std::cout << "sLiSCP-light-256-SpoC tests succeeded" << std::endl;
+            succeeded(mode, code, "sLiSCP-light-256-SpoC");
         }
     }
     return true;
@@ -1637,10 +1713,10 @@ static bool sliscp192(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_sliscp_light192_permutation(code)) {
-            std::cout << "sLiSCP-light-192 tests FAILED" << std::endl;
+            failed(mode, code, "sLiSCP-light-192");
             return false;
         } else {
-            std::cout << "sLiSCP-light-192 tests succeeded" << std::endl;
+            succeeded(mode, code, "sLiSCP-light-192");
         }
     }
     return true;
@@ -1658,10 +1734,10 @@ static bool sliscp320(enum Mode mode)
         code2.write(std::cout);
     } else {
         if (!test_sliscp_light320_permutation(code)) {
-            std::cout << "sLiSCP-light-320 tests FAILED" << std::endl;
+            failed(mode, code, "sLiSCP-light-320");
             return false;
         } else {
-            std::cout << "sLiSCP-light-320 tests succeeded" << std::endl;
+            succeeded(mode, code, "sLiSCP-light-320");
         }
     }
     return true;
@@ -1675,10 +1751,10 @@ static bool speck64(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_speck64_encrypt(code)) {
-            std::cout << "SPECK-64 tests FAILED" << std::endl;
+            failed(mode, code, "SPECK-64");
             return false;
         } else {
-            std::cout << "SPECK-64 tests succeeded" << std::endl;
+            succeeded(mode, code, "SPECK-64");
         }
     }
     return true;
@@ -1692,10 +1768,10 @@ static bool sparkle256(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_sparkle256_permutation(code)) {
-            std::cout << "SPARKLE-256 tests FAILED" << std::endl;
+            failed(mode, code, "SPARKLE-256");
             return false;
         } else {
-            std::cout << "SPARKLE-256 tests succeeded" << std::endl;
+            succeeded(mode, code, "SPARKLE-256");
         }
     }
     return true;
@@ -1709,10 +1785,10 @@ static bool sparkle384(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_sparkle384_permutation(code)) {
-            std::cout << "SPARKLE-384 tests FAILED" << std::endl;
+            failed(mode, code, "SPARKLE-384");
             return false;
         } else {
-            std::cout << "SPARKLE-384 tests succeeded" << std::endl;
+            succeeded(mode, code, "SPARKLE-384");
         }
     }
     return true;
@@ -1726,10 +1802,10 @@ static bool sparkle512(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_sparkle512_permutation(code)) {
-            std::cout << "SPARKLE-512 tests FAILED" << std::endl;
+            failed(mode, code, "SPARKLE-512");
             return false;
         } else {
-            std::cout << "SPARKLE-512 tests succeeded" << std::endl;
+            succeeded(mode, code, "SPARKLE-512");
         }
     }
     return true;
@@ -1744,10 +1820,10 @@ static bool spongent160(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_spongent160_permutation(code)) {
-            std::cout << "Spongent-pi[160] tests FAILED" << std::endl;
+            failed(mode, code, "Spongent-pi[160]");
             return false;
         } else {
-            std::cout << "Spongent-pi[160] tests succeeded" << std::endl;
+            succeeded(mode, code, "Spongent-pi[160]");
         }
     }
     return true;
@@ -1761,10 +1837,10 @@ static bool spongent176(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_spongent176_permutation(code)) {
-            std::cout << "Spongent-pi[176] tests FAILED" << std::endl;
+            failed(mode, code, "Spongent-pi[176]");
             return false;
         } else {
-            std::cout << "Spongent-pi[176] tests succeeded" << std::endl;
+            succeeded(mode, code, "Spongent-pi[176]");
         }
     }
     return true;
@@ -1778,10 +1854,10 @@ static bool spook_clyde128_encrypt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_clyde128_encrypt(code)) {
-            std::cout << "Spook/Clyde-128 encrypt tests FAILED" << std::endl;
+            failed(mode, code, "Spook/Clyde-128 encrypt");
             return false;
         } else {
-            std::cout << "Spook/Clyde-128 encrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Spook/Clyde-128 encrypt");
         }
     }
     return true;
@@ -1795,10 +1871,10 @@ static bool spook_clyde128_decrypt(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_clyde128_decrypt(code)) {
-            std::cout << "Spook/Clyde-128 decrypt tests FAILED" << std::endl;
+            failed(mode, code, "Spook/Clyde-128 decrypt");
             return false;
         } else {
-            std::cout << "Spook/Clyde-128 decrypt tests succeeded" << std::endl;
+            succeeded(mode, code, "Spook/Clyde-128 decrypt");
         }
     }
     return true;
@@ -1812,10 +1888,10 @@ static bool spook_shadow512(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_shadow512_permutation(code)) {
-            std::cout << "Spook/Shadow-512 tests FAILED" << std::endl;
+            failed(mode, code, "Spook/Shadow-512");
             return false;
         } else {
-            std::cout << "Spook/Shadow-512 tests succeeded" << std::endl;
+            succeeded(mode, code, "Spook/Shadow-512");
         }
     }
     return true;
@@ -1829,10 +1905,10 @@ static bool spook_shadow384(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_shadow384_permutation(code)) {
-            std::cout << "Spook/Shadow-384 tests FAILED" << std::endl;
+            failed(mode, code, "Spook/Shadow-384");
             return false;
         } else {
-            std::cout << "Spook/Shadow-384 tests succeeded" << std::endl;
+            succeeded(mode, code, "Spook/Shadow-384");
         }
     }
     return true;
@@ -1872,10 +1948,10 @@ static bool subterranean(enum Mode mode)
         code4.write(std::cout);
     } else {
         if (!test_subterranean_permutation(code)) {
-            std::cout << "Subterranean tests FAILED" << std::endl;
+            failed(mode, code, "Subterranean");
             return false;
         } else {
-            std::cout << "Subterranean tests succeeded" << std::endl;
+            succeeded(mode, code, "Subterranean");
         }
     }
     return true;
@@ -1889,10 +1965,10 @@ static bool tinyjambu(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_tinyjambu_permutation(code)) {
-            std::cout << "TinyJAMBU tests FAILED" << std::endl;
+            failed(mode, code, "TinyJAMBU");
             return false;
         } else {
-            std::cout << "TinyJAMBU tests succeeded" << std::endl;
+            succeeded(mode, code, "TinyJAMBU");
         }
     }
     return true;
@@ -1908,10 +1984,10 @@ static bool wage(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_wage_permutation(code)) {
-            std::cout << "WAGE tests FAILED" << std::endl;
+            failed(mode, code, "WAGE");
             return false;
         } else {
-            std::cout << "WAGE tests succeeded" << std::endl;
+            succeeded(mode, code, "WAGE");
         }
     }
     return true;
@@ -1943,10 +2019,10 @@ static bool xoodoo(enum Mode mode)
         code.write(std::cout);
     } else {
         if (!test_xoodoo_permutation(code)) {
-            std::cout << "Xoodoo tests FAILED" << std::endl;
+            failed(mode, code, "Xoodoo");
             return false;
         } else {
-            std::cout << "Xoodoo tests succeeded" << std::endl;
+            succeeded(mode, code, "Xoodoo");
         }
     }
     return true;
@@ -1956,14 +2032,16 @@ typedef bool (*gen_code)(enum Mode mode);
 
 int main(int argc, char *argv[])
 {
-    bool generate = true;
+    enum Mode mode = Generate;
     int exit_val = 0;
     gen_code gen1 = 0;
     gen_code gen2 = 0;
     gen_code gen3 = 0;
 
     if (argc > 1 && !strcmp(argv[1], "--test")) {
-        generate = false;
+        mode = Test;
+    } else if (argc > 1 && !strcmp(argv[1], "--cycles")) {
+        mode = Cycles;
     } else {
         if (argc <= 1) {
             fprintf(stderr, "Usage: %s algorithm-name\n", argv[0]);
@@ -2060,7 +2138,7 @@ int main(int argc, char *argv[])
         }
     }
 
-    if (generate) {
+    if (mode == Generate) {
         header(std::cout);
         if (gen1)
             gen1(Generate);
@@ -2070,99 +2148,104 @@ int main(int argc, char *argv[])
             gen3(Generate);
         footer(std::cout);
     } else {
-        if (!ascon(Test))
+        if (mode == Cycles) {
+            std::cout << std::left << std::setw(44) << "Primitive";
+            std::cout << std::right << std::setw(10) << "Cycles";
+            std::cout << std::setw(8) << "Bytes" << std::endl;
+        }
+        if (!ascon(mode))
             exit_val = 1;
-        if (!cham128(Test))
+        if (!cham128(mode))
             exit_val = 1;
-        if (!cham64(Test))
+        if (!cham64(mode))
             exit_val = 1;
-        if (!gascon128(Test))
+        if (!gascon128(mode))
             exit_val = 1;
-        if (!gascon256(Test))
+        if (!gascon256(mode))
             exit_val = 1;
-        if (!gift128b(Test))
+        if (!gift128b(mode))
             exit_val = 1;
-        if (!gift128_alt(Test))
+        if (!gift128_alt(mode))
             exit_val = 1;
-        if (!gift128n(Test))
+        if (!gift128n(mode))
             exit_val = 1;
-        if (!gift128b_fs_4(Test))
+        if (!gift128b_fs_4(mode))
             exit_val = 1;
-        if (!gift128b_fs_20(Test))
+        if (!gift128b_fs_20(mode))
             exit_val = 1;
-        if (!gift128b_fs_80(Test))
+        if (!gift128b_fs_80(mode))
             exit_val = 1;
-        if (!gift128n_fs_4(Test))
+        if (!gift128n_fs_4(mode))
             exit_val = 1;
-        if (!gift128n_fs_20(Test))
+        if (!gift128n_fs_20(mode))
             exit_val = 1;
-        if (!gift128n_fs_80(Test))
+        if (!gift128n_fs_80(mode))
             exit_val = 1;
-        if (!gift128_alt_fs_4(Test))
+        if (!gift128_alt_fs_4(mode))
             exit_val = 1;
-        if (!gift128_alt_fs_20(Test))
+        if (!gift128_alt_fs_20(mode))
             exit_val = 1;
-        if (!gift128_alt_fs_80(Test))
+        if (!gift128_alt_fs_80(mode))
             exit_val = 1;
-        if (!gift64(Test))
+        if (!gift64(mode))
             exit_val = 1;
-        if (!gift64_alt(Test))
+        if (!gift64_alt(mode))
             exit_val = 1;
-        if (!gimli24(Test))
+        if (!gimli24(mode))
             exit_val = 1;
-        if (!grain128(Test))
+        if (!grain128(mode))
             exit_val = 1;
-        if (!keccakp_200(Test))
+        if (!keccakp_200(mode))
             exit_val = 1;
-        if (!keccakp_400(Test))
+        if (!keccakp_400(mode))
             exit_val = 1;
-        if (!knot256(Test))
+        if (!knot256(mode))
             exit_val = 1;
-        if (!knot384(Test))
+        if (!knot384(mode))
             exit_val = 1;
-        if (!knot512(Test))
+        if (!knot512(mode))
             exit_val = 1;
-        if (!photon256(Test))
+        if (!photon256(mode))
             exit_val = 1;
-        if (!pyjamask(Test))
+        if (!pyjamask(mode))
             exit_val = 1;
-        if (!saturnin(Test))
+        if (!saturnin(mode))
             exit_val = 1;
-        if (!simp256(Test))
+        if (!simp256(mode))
             exit_val = 1;
-        if (!simp192(Test))
+        if (!simp192(mode))
             exit_val = 1;
-        if (!skinny128(Test))
+        if (!skinny128(mode))
             exit_val = 1;
-        if (!sliscp256_spix(Test))
+        if (!sliscp256_spix(mode))
             exit_val = 1;
-        if (!sliscp256_spoc(Test))
+        if (!sliscp256_spoc(mode))
             exit_val = 1;
-        if (!sliscp192(Test))
+        if (!sliscp192(mode))
             exit_val = 1;
-        if (!sliscp320(Test))
+        if (!sliscp320(mode))
             exit_val = 1;
-        if (!speck64(Test))
+        if (!speck64(mode))
             exit_val = 1;
-        if (!sparkle256(Test))
+        if (!sparkle256(mode))
             exit_val = 1;
-        if (!sparkle384(Test))
+        if (!sparkle384(mode))
             exit_val = 1;
-        if (!sparkle512(Test))
+        if (!sparkle512(mode))
             exit_val = 1;
-        if (!spongent160(Test))
+        if (!spongent160(mode))
             exit_val = 1;
-        if (!spongent176(Test))
+        if (!spongent176(mode))
             exit_val = 1;
-        if (!spook(Test))
+        if (!spook(mode))
             exit_val = 1;
-        if (!subterranean(Test))
+        if (!subterranean(mode))
             exit_val = 1;
-        if (!tinyjambu(Test))
+        if (!tinyjambu(mode))
             exit_val = 1;
-        if (!wage(Test))
+        if (!wage(mode))
             exit_val = 1;
-        if (!xoodoo(Test))
+        if (!xoodoo(mode))
             exit_val = 1;
     }
 
@@ -22,7 +22,7 @@
 
 #include "ace.h"
 #include "internal-sliscp-light.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 /**
@@ -43,7 +43,18 @@ aead_cipher_t const ace_cipher = {
     ACE_TAG_SIZE,
     AEAD_FLAG_NONE,
     ace_aead_encrypt,
-    ace_aead_decrypt
+    ace_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    ace_aead_encrypt_vec,
+    ace_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const ace_hash_algorithm = {
@@ -75,14 +86,16 @@ static unsigned char const ace_rate_posn[8] = {
  * \param state ACE permutation state.
  * \param k Points to the 128-bit key.
  * \param npub Points to the 128-bit nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void ace_init
     (unsigned char state[ACE_STATE_SIZE],
      const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[ACE_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Initialize the state by interleaving the key and nonce */
@@ -107,20 +120,93 @@ static void ace_init
     /* Absorb the associated data into the state */
     if (adlen != 0) {
         while (adlen >= ACE_RATE) {
-            lw_xor_block(state, ad, ACE_RATE);
+            in = aead_iovec_load_block(ad, buf, ACE_RATE);
+            lw_xor_block(state, in, ACE_RATE);
             state[ACE_STATE_SIZE - 1] ^= 0x01; /* domain separation */
             sliscp_light320_permute(state);
-            ad += ACE_RATE;
             adlen -= ACE_RATE;
         }
         temp = (unsigned)adlen;
-        lw_xor_block(state, ad, temp);
+        in = aead_iovec_load_block(ad, buf, temp);
+        lw_xor_block(state, in, temp);
         state[temp] ^= 0x80; /* padding */
         state[ACE_STATE_SIZE - 1] ^= 0x01; /* domain separation */
         sliscp_light320_permute(state);
     }
 }
 
+/**
+ * \brief Encrypts the plaintext with ACE.
+ *
+ * \param state ACE permutation state.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
+ * \param mlen Length of the plaintext in bytes.
+ */
+static void ace_encrypt
+    (unsigned char state[ACE_STATE_SIZE], aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
+{
+    unsigned char inbuf[ACE_RATE];
+    unsigned char outbuf[ACE_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+    while (mlen >= ACE_RATE) {
+        in = aead_iovec_load_block(m, inbuf, ACE_RATE);
+        out = aead_iovec_store_begin(c, outbuf, ACE_RATE);
+        lw_xor_block_2_dest(out, state, in, ACE_RATE);
+        aead_iovec_store_end(c, outbuf, out, ACE_RATE);
+        state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
+        sliscp_light320_permute(state);
+        mlen -= ACE_RATE;
+    }
+    temp = (unsigned)mlen;
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
+    lw_xor_block_2_dest(out, state, in, temp);
+    aead_iovec_store_end(c, outbuf, out, temp);
+    state[temp] ^= 0x80; /* padding */
+    state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
+    sliscp_light320_permute(state);
+}
+
+/**
+ * \brief Decrypts the ciphertext with ACE.
+ *
+ * \param state ACE permutation state.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
+ * \param clen Length of the ciphertext in bytes, excluding the tag.
+ */
+static void ace_decrypt
+    (unsigned char state[ACE_STATE_SIZE], aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long clen)
+{
+    unsigned char inbuf[ACE_RATE];
+    unsigned char outbuf[ACE_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+    while (clen >= ACE_RATE) {
+        in = aead_iovec_load_block(c, inbuf, ACE_RATE);
+        out = aead_iovec_store_begin(m, outbuf, ACE_RATE);
+        lw_xor_block_swap(out, state, in, ACE_RATE);
+        aead_iovec_store_end(m, outbuf, out, ACE_RATE);
+        state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
+        sliscp_light320_permute(state);
+        clen -= ACE_RATE;
+    }
+    temp = (unsigned)clen;
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
+    lw_xor_block_swap(out, state, in, temp);
+    aead_iovec_store_end(m, outbuf, out, temp);
+    state[temp] ^= 0x80; /* padding */
+    state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
+    sliscp_light320_permute(state);
+}
+
 /**
  * \brief Finalizes the ACE encryption or decryption operation.
  *
@@ -146,86 +232,105 @@ static void ace_finalize
     memcpy(tag + 8, state + 16, 8);
 }
 
-int ace_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int ace_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[ACE_STATE_SIZE];
-    unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ACE_TAG_SIZE))
+        return -2;
     *clen = mlen + ACE_TAG_SIZE;
 
     /* Initialize the ACE state and absorb the associated data */
-    ace_init(state, k, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    ace_init(state, k, npub, &adcur, aead_iovec_length(ad, ad_count));
 
     /* Encrypt the plaintext to produce the ciphertext */
-    while (mlen >= ACE_RATE) {
-        lw_xor_block_2_dest(c, state, m, ACE_RATE);
-        state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
-        sliscp_light320_permute(state);
-        c += ACE_RATE;
-        m += ACE_RATE;
-        mlen -= ACE_RATE;
-    }
-    temp = (unsigned)mlen;
-    lw_xor_block_2_dest(c, state, m, temp);
-    state[temp] ^= 0x80; /* padding */
-    state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
-    sliscp_light320_permute(state);
-    c += mlen;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ace_encrypt(state, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    ace_finalize(state, k, c);
+    ace_finalize(state, k, state);
+    aead_iovec_write(&ccur, state, ACE_TAG_SIZE);
     return 0;
 }
 
-int ace_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int ace_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[ACE_STATE_SIZE];
-    unsigned char *mtemp = m;
-    unsigned temp;
+    unsigned char tag[ACE_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ACE_TAG_SIZE)
         return -1;
     *mlen = clen - ACE_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Initialize the ACE state and absorb the associated data */
-    ace_init(state, k, npub, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    ace_init(state, k, npub, &adcur, aead_iovec_length(ad, ad_count));
 
     /* Decrypt the ciphertext to produce the plaintext */
-    clen -= ACE_TAG_SIZE;
-    while (clen >= ACE_RATE) {
-        lw_xor_block_swap(m, state, c, ACE_RATE);
-        state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
-        sliscp_light320_permute(state);
-        c += ACE_RATE;
-        m += ACE_RATE;
-        clen -= ACE_RATE;
-    }
-    temp = (unsigned)clen;
-    lw_xor_block_swap(m, state, c, temp);
-    state[temp] ^= 0x80; /* padding */
-    state[ACE_STATE_SIZE - 1] ^= 0x02; /* domain separation */
-    sliscp_light320_permute(state);
-    c += clen;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    ace_decrypt(state, &mcur, &ccur, *mlen);
 
     /* Finalize the ACE state and compare against the authentication tag */
     ace_finalize(state, k, state);
-    return aead_check_tag(mtemp, *mlen, state, c, ACE_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, ACE_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, state, tag, ACE_TAG_SIZE);
+}
+
+int ace_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ACE_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return ace_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int ace_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ACE_TAG_SIZE ? clen - ACE_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return ace_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 /* Pre-hashed version of the ACE-HASH initialization vector */
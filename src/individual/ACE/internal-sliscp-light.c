@@ -120,6 +120,8 @@ void sliscp_light256_permute_spix(unsigned char block[32], unsigned rounds)
     uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
     uint32_t t0, t1;
 
+    aead_count_call(AEAD_PRIMITIVE_SLISCP_LIGHT_PERMUTE);
+
     /* Load the block into local state variables */
     x0 = be_load_word32(block);
     x1 = be_load_word32(block + 4);
@@ -182,6 +184,8 @@ void sliscp_light256_permute_spoc(unsigned char block[32])
     uint32_t t0, t1;
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SLISCP_LIGHT_PERMUTE);
+
     /* Load the block into local state variables */
     x0 = be_load_word32(block);
     x1 = be_load_word32(block + 4);
@@ -271,6 +275,8 @@ void sliscp_light192_permute(unsigned char block[24])
     uint32_t t0, t1;
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SLISCP_LIGHT_PERMUTE);
+
     /* Load the block into local state variables.  Each 24-bit block is
      * placed into a separate 32-bit word which improves efficiency below */
     x0 = be_load_word24(block);
@@ -340,6 +346,8 @@ void sliscp_light320_permute(unsigned char block[40])
     uint32_t t0, t1;
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SLISCP_LIGHT_PERMUTE);
+
     /* Load the block into local state variables */
     x0 = be_load_word32(block);
     x1 = be_load_word32(block + 16); /* Assumes the block is pre-swapped */
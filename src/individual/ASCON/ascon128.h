@@ -97,6 +97,24 @@ typedef union
 
 } ascon_hash_state_t;
 
+/**
+ * \brief State information for the incremental ASCON AEAD modes.
+ */
+typedef union
+{
+    struct {
+        unsigned char state[40]; /**< Current permutation state */
+        unsigned char key[20];   /**< Key for the finalization step */
+        unsigned char key_len;   /**< Length of the key in bytes */
+        unsigned char rate;      /**< Rate of the sponge in bytes */
+        unsigned char first_round; /**< First round for each block */
+        unsigned char count;     /**< Number of bytes in the current block */
+        unsigned char mode;      /**< Current phase of the operation */
+    } s;                         /**< State */
+    unsigned long long align;    /**< For alignment of this structure */
+
+} ascon_aead_state_t;
+
 /**
  * \brief Meta-information block for the ASCON-128 cipher.
  */
@@ -181,6 +199,96 @@ int ascon128_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with ASCON-128.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa ascon128_aead_decrypt_vec(), ascon128_aead_encrypt()
+ */
+int ascon128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with ASCON-128.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa ascon128_aead_encrypt_vec(), ascon128_aead_decrypt()
+ */
+int ascon128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a batch of packets with ASCON-128.
+ *
+ * \param packets Points to the array of packet descriptors.  Each
+ * packet has a 16 byte key or key context and a 16 byte nonce.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was encrypted, or the result of the first
+ * packet that failed.
+ *
+ * Groups of packets are processed in lock-step with a multi-lane ASCON
+ * permutation.  Throughput is best when the packets in a batch have
+ * similar lengths.
+ *
+ * \sa ascon128_aead_decrypt_batch(), aead_cipher_encrypt_batch()
+ */
+int ascon128_aead_encrypt_batch(aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Decrypts and authenticates a batch of packets with ASCON-128.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was decrypted, or the result of the first
+ * packet that failed.
+ *
+ * \sa ascon128_aead_encrypt_batch(), aead_cipher_decrypt_batch()
+ */
+int ascon128_aead_decrypt_batch(aead_packet_t *packets, size_t count);
+
 /**
  * \brief Encrypts and authenticates a packet with ASCON-128a.
  *
@@ -240,6 +348,96 @@ int ascon128a_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with ASCON-128a.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa ascon128a_aead_decrypt_vec(), ascon128a_aead_encrypt()
+ */
+int ascon128a_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with ASCON-128a.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 16 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa ascon128a_aead_encrypt_vec(), ascon128a_aead_decrypt()
+ */
+int ascon128a_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a batch of packets with ASCON-128a.
+ *
+ * \param packets Points to the array of packet descriptors.  Each
+ * packet has a 16 byte key or key context and a 16 byte nonce.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was encrypted, or the result of the first
+ * packet that failed.
+ *
+ * Groups of packets are processed in lock-step with a multi-lane ASCON
+ * permutation.  Throughput is best when the packets in a batch have
+ * similar lengths.
+ *
+ * \sa ascon128a_aead_decrypt_batch(), aead_cipher_encrypt_batch()
+ */
+int ascon128a_aead_encrypt_batch(aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Decrypts and authenticates a batch of packets with ASCON-128a.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was decrypted, or the result of the first
+ * packet that failed.
+ *
+ * \sa ascon128a_aead_encrypt_batch(), aead_cipher_decrypt_batch()
+ */
+int ascon128a_aead_decrypt_batch(aead_packet_t *packets, size_t count);
+
 /**
  * \brief Encrypts and authenticates a packet with ASCON-80pq.
  *
@@ -299,6 +497,171 @@ int ascon80pq_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with ASCON-80pq.
+ *
+ * \param c Array of segments to receive the ciphertext and the 16 byte
+ * authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the 16 byte authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 20 bytes of the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * \sa ascon80pq_aead_decrypt_vec(), ascon80pq_aead_encrypt()
+ */
+int ascon80pq_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with ASCON-80pq.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - not used by this algorithm.
+ * \param c Array of segments that contain the ciphertext and the
+ * 16 byte authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet which must
+ * be 16 bytes in length.
+ * \param k Points to the 20 bytes of the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * \sa ascon80pq_aead_encrypt_vec(), ascon80pq_aead_decrypt()
+ */
+int ascon80pq_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental ASCON-128 operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 16 bytes of the public nonce.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \sa ascon_aead_update_ad(), ascon_aead_encrypt_update(),
+ * ascon_aead_decrypt_update()
+ */
+void ascon128_aead_init
+    (ascon_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental ASCON-128a operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 16 bytes of the public nonce.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \sa ascon_aead_update_ad(), ascon_aead_encrypt_update(),
+ * ascon_aead_decrypt_update()
+ */
+void ascon128a_aead_init
+    (ascon_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Initializes the state for an incremental ASCON-80pq operation.
+ *
+ * \param state The incremental AEAD state to initialize.
+ * \param npub Points to the 16 bytes of the public nonce.
+ * \param k Points to the 20 bytes of the key.
+ *
+ * \sa ascon_aead_update_ad(), ascon_aead_encrypt_update(),
+ * ascon_aead_decrypt_update()
+ */
+void ascon80pq_aead_init
+    (ascon_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Absorbs more associated data into an incremental ASCON state.
+ *
+ * \param state The incremental AEAD state.
+ * \param ad Points to the associated data.
+ * \param adlen Length of the associated data in bytes.
+ *
+ * This function must not be called after encryption or decryption
+ * has started.
+ */
+void ascon_aead_update_ad
+    (ascon_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen);
+
+/**
+ * \brief Encrypts more plaintext with an incremental ASCON state.
+ *
+ * \param state The incremental AEAD state.
+ * \param c Buffer to receive the ciphertext, which may be the same
+ * as \a m.
+ * \param m Points to the plaintext to encrypt.
+ * \param len Number of bytes to encrypt.
+ *
+ * \sa ascon_aead_encrypt_final()
+ */
+void ascon_aead_encrypt_update
+    (ascon_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len);
+
+/**
+ * \brief Decrypts more ciphertext with an incremental ASCON state.
+ *
+ * \param state The incremental AEAD state.
+ * \param m Buffer to receive the plaintext, which may be the same
+ * as \a c.
+ * \param c Points to the ciphertext to decrypt.
+ * \param len Number of bytes to decrypt.
+ *
+ * The plaintext is not authenticated until ascon_aead_decrypt_final()
+ * succeeds and must be discarded if it fails.
+ */
+void ascon_aead_decrypt_update
+    (ascon_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len);
+
+/**
+ * \brief Finishes an incremental ASCON encryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Buffer to receive the 16 byte authentication tag.
+ */
+void ascon_aead_encrypt_final(ascon_aead_state_t *state, unsigned char *tag);
+
+/**
+ * \brief Finishes an incremental ASCON decryption operation.
+ *
+ * \param state The incremental AEAD state.
+ * \param tag Points to the 16 byte authentication tag to check.
+ *
+ * \return 0 if the tag is correct or -1 if it is incorrect.
+ */
+int ascon_aead_decrypt_final
+    (ascon_aead_state_t *state, const unsigned char *tag);
+
 /**
  * \brief Hashes a block of input data with ASCON-HASH.
  *
@@ -23,7 +23,7 @@
 #include "comet.h"
 #include "internal-cham.h"
 #include "internal-speck64.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const comet_128_cham_cipher = {
@@ -33,7 +33,18 @@ aead_cipher_t const comet_128_cham_cipher = {
     COMET_128_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     comet_128_cham_aead_encrypt,
-    comet_128_cham_aead_decrypt
+    comet_128_cham_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    comet_128_cham_aead_encrypt_vec,
+    comet_128_cham_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const comet_64_cham_cipher = {
@@ -43,7 +54,18 @@ aead_cipher_t const comet_64_cham_cipher = {
     COMET_64_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     comet_64_cham_aead_encrypt,
-    comet_64_cham_aead_decrypt
+    comet_64_cham_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    comet_64_cham_aead_encrypt_vec,
+    comet_64_cham_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const comet_64_speck_cipher = {
@@ -53,7 +75,18 @@ aead_cipher_t const comet_64_speck_cipher = {
     COMET_64_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     comet_64_speck_aead_encrypt,
-    comet_64_speck_aead_decrypt
+    comet_64_speck_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    comet_64_speck_aead_encrypt_vec,
+    comet_64_speck_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -83,23 +116,26 @@ typedef void (*comet_encrypt_block_t)
  * \param Z Internal COMET key state of 16 bytes in size.
  * \param block_size Size of the block for the underlying cipher.
  * \param encrypt Encryption function for the underlying cipher.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Number of bytes of associated data; must be >= 1.
  */
 static void comet_process_ad
     (unsigned char *Y, unsigned char Z[16], unsigned block_size,
-     comet_encrypt_block_t encrypt, const unsigned char *ad,
+     comet_encrypt_block_t encrypt, aead_iovec_cursor_t *ad,
      unsigned long long adlen)
 {
+    unsigned char buf[16];
+    const unsigned char *in;
+
     /* Domain separator for associated data */
     Z[15] ^= 0x08;
 
     /* Process all associated data blocks except the last partial block */
     while (adlen >= block_size) {
         comet_adjust_block_key(Z);
+        in = aead_iovec_load_block(ad, buf, block_size);
         encrypt(Z, Y, Y);
-        lw_xor_block(Y, ad, block_size);
-        ad += block_size;
+        lw_xor_block(Y, in, block_size);
         adlen -= block_size;
     }
 
@@ -108,8 +144,9 @@ static void comet_process_ad
         unsigned temp = (unsigned)adlen;
         Z[15] ^= 0x10;
         comet_adjust_block_key(Z);
+        in = aead_iovec_load_block(ad, buf, temp);
         encrypt(Z, Y, Y);
-        lw_xor_block(Y, ad, temp);
+        lw_xor_block(Y, in, temp);
         Y[temp] ^= 0x01;
     }
 }
@@ -159,16 +196,20 @@ STATIC_INLINE void comet_shuffle_block_64
  * \param Y Internal COMET block state of 16 bytes in size.
  * \param Z Internal COMET key state of 16 bytes in size.
  * \param encrypt Encryption function for the underlying cipher.
- * \param c Ciphertext on output.
- * \param m Plaintext message on input.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext message and the ciphertext.
  */
 static void comet_encrypt_128
     (unsigned char Y[16], unsigned char Z[16],
-     comet_encrypt_block_t encrypt, unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+     comet_encrypt_block_t encrypt, aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
     unsigned char Ys[16];
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
 
     /* Domain separator for payload data */
     Z[15] ^= 0x20;
@@ -178,10 +219,11 @@ static void comet_encrypt_128
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_128(Ys, Y);
-        lw_xor_block(Y, m, 16);
-        lw_xor_block_2_src(c, m, Ys, 16);
-        c += 16;
-        m += 16;
+        in = aead_iovec_load_block(m, inbuf, 16);
+        out = aead_iovec_store_begin(c, outbuf, 16);
+        lw_xor_block(Y, in, 16);
+        lw_xor_block_2_src(out, in, Ys, 16);
+        aead_iovec_store_end(c, outbuf, out, 16);
         mlen -= 16;
     }
 
@@ -192,8 +234,11 @@ static void comet_encrypt_128
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_128(Ys, Y);
-        lw_xor_block(Y, m, temp);
-        lw_xor_block_2_src(c, m, Ys, temp);
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
+        lw_xor_block(Y, in, temp);
+        lw_xor_block_2_src(out, in, Ys, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
         Y[temp] ^= 0x01;
     }
 }
@@ -204,16 +249,20 @@ static void comet_encrypt_128
  * \param Y Internal COMET block state of 8 bytes in size.
  * \param Z Internal COMET key state of 16 bytes in size.
  * \param encrypt Encryption function for the underlying cipher.
- * \param c Ciphertext on output.
- * \param m Plaintext message on input.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the plaintext message and the ciphertext.
  */
 static void comet_encrypt_64
     (unsigned char Y[8], unsigned char Z[16],
-     comet_encrypt_block_t encrypt, unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+     comet_encrypt_block_t encrypt, aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
     unsigned char Ys[8];
+    unsigned char inbuf[8];
+    unsigned char outbuf[8];
+    const unsigned char *in;
+    unsigned char *out;
 
     /* Domain separator for payload data */
     Z[15] ^= 0x20;
@@ -223,10 +272,11 @@ static void comet_encrypt_64
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_64(Ys, Y);
-        lw_xor_block(Y, m, 8);
-        lw_xor_block_2_src(c, m, Ys, 8);
-        c += 8;
-        m += 8;
+        in = aead_iovec_load_block(m, inbuf, 8);
+        out = aead_iovec_store_begin(c, outbuf, 8);
+        lw_xor_block(Y, in, 8);
+        lw_xor_block_2_src(out, in, Ys, 8);
+        aead_iovec_store_end(c, outbuf, out, 8);
         mlen -= 8;
     }
 
@@ -237,8 +287,11 @@ static void comet_encrypt_64
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_64(Ys, Y);
-        lw_xor_block(Y, m, temp);
-        lw_xor_block_2_src(c, m, Ys, temp);
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
+        lw_xor_block(Y, in, temp);
+        lw_xor_block_2_src(out, in, Ys, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
         Y[temp] ^= 0x01;
     }
 }
@@ -249,16 +302,20 @@ static void comet_encrypt_64
  * \param Y Internal COMET block state of 16 bytes in size.
  * \param Z Internal COMET key state of 16 bytes in size.
  * \param encrypt Encryption function for the underlying cipher.
- * \param m Plaintext message on output.
- * \param c Ciphertext on input.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext message and the ciphertext.
  */
 static void comet_decrypt_128
     (unsigned char Y[16], unsigned char Z[16],
-     comet_encrypt_block_t encrypt, unsigned char *m,
-     const unsigned char *c, unsigned long long mlen)
+     comet_encrypt_block_t encrypt, aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long mlen)
 {
     unsigned char Ys[16];
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
 
     /* Domain separator for payload data */
     Z[15] ^= 0x20;
@@ -268,10 +325,11 @@ static void comet_decrypt_128
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_128(Ys, Y);
-        lw_xor_block_2_src(m, c, Ys, 16);
-        lw_xor_block(Y, m, 16);
-        c += 16;
-        m += 16;
+        in = aead_iovec_load_block(c, inbuf, 16);
+        out = aead_iovec_store_begin(m, outbuf, 16);
+        lw_xor_block_2_src(out, in, Ys, 16);
+        lw_xor_block(Y, out, 16);
+        aead_iovec_store_end(m, outbuf, out, 16);
         mlen -= 16;
     }
 
@@ -282,8 +340,11 @@ static void comet_decrypt_128
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_128(Ys, Y);
-        lw_xor_block_2_src(m, c, Ys, temp);
-        lw_xor_block(Y, m, temp);
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
+        lw_xor_block_2_src(out, in, Ys, temp);
+        lw_xor_block(Y, out, temp);
+        aead_iovec_store_end(m, outbuf, out, temp);
         Y[temp] ^= 0x01;
     }
 }
@@ -294,16 +355,20 @@ static void comet_decrypt_128
  * \param Y Internal COMET block state of 8 bytes in size.
  * \param Z Internal COMET key state of 16 bytes in size.
  * \param encrypt Encryption function for the underlying cipher.
- * \param m Plaintext message on output.
- * \param c Ciphertext on input.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the plaintext message and the ciphertext.
  */
 static void comet_decrypt_64
     (unsigned char Y[8], unsigned char Z[16],
-     comet_encrypt_block_t encrypt, unsigned char *m,
-     const unsigned char *c, unsigned long long mlen)
+     comet_encrypt_block_t encrypt, aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long mlen)
 {
     unsigned char Ys[8];
+    unsigned char inbuf[8];
+    unsigned char outbuf[8];
+    const unsigned char *in;
+    unsigned char *out;
 
     /* Domain separator for payload data */
     Z[15] ^= 0x20;
@@ -313,10 +378,11 @@ static void comet_decrypt_64
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_64(Ys, Y);
-        lw_xor_block_2_src(m, c, Ys, 8);
-        lw_xor_block(Y, m, 8);
-        c += 8;
-        m += 8;
+        in = aead_iovec_load_block(c, inbuf, 8);
+        out = aead_iovec_store_begin(m, outbuf, 8);
+        lw_xor_block_2_src(out, in, Ys, 8);
+        lw_xor_block(Y, out, 8);
+        aead_iovec_store_end(m, outbuf, out, 8);
         mlen -= 8;
     }
 
@@ -327,26 +393,37 @@ static void comet_decrypt_64
         comet_adjust_block_key(Z);
         encrypt(Z, Y, Y);
         comet_shuffle_block_64(Ys, Y);
-        lw_xor_block_2_src(m, c, Ys, temp);
-        lw_xor_block(Y, m, temp);
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
+        lw_xor_block_2_src(out, in, Ys, temp);
+        lw_xor_block(Y, out, temp);
+        aead_iovec_store_end(m, outbuf, out, temp);
         Y[temp] ^= 0x01;
     }
 }
 
-int comet_128_cham_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int comet_128_cham_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char Y[16];
     unsigned char Z[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + COMET_128_TAG_SIZE))
+        return -2;
     *clen = mlen + COMET_128_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the initial state of Y and Z */
     memcpy(Y, k, 16);
@@ -354,35 +431,44 @@ int comet_128_cham_aead_encrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        comet_process_ad(Y, Z, 16, cham128_128_encrypt, ad, adlen);
+        comet_process_ad(Y, Z, 16, cham128_128_encrypt, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        comet_encrypt_128(Y, Z, cham128_128_encrypt, c, m, mlen);
+        comet_encrypt_128(Y, Z, cham128_128_encrypt, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
     Z[15] ^= 0x80;
     comet_adjust_block_key(Z);
-    cham128_128_encrypt(Z, c + mlen, Y);
+    cham128_128_encrypt(Z, Y, Y);
+    aead_iovec_write(&ccur, Y, COMET_128_TAG_SIZE);
     return 0;
 }
 
-int comet_128_cham_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int comet_128_cham_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char Y[16];
     unsigned char Z[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < COMET_128_TAG_SIZE)
         return -1;
     *mlen = clen - COMET_128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the initial state of Y and Z */
     memcpy(Y, k, 16);
@@ -390,33 +476,75 @@ int comet_128_cham_aead_decrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        comet_process_ad(Y, Z, 16, cham128_128_encrypt, ad, adlen);
+        comet_process_ad(Y, Z, 16, cham128_128_encrypt, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > COMET_128_TAG_SIZE)
-        comet_decrypt_128(Y, Z, cham128_128_encrypt, m, c, *mlen);
+        comet_decrypt_128(Y, Z, cham128_128_encrypt, &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
     Z[15] ^= 0x80;
     comet_adjust_block_key(Z);
     cham128_128_encrypt(Z, Y, Y);
-    return aead_check_tag(m, *mlen, Y, c + *mlen, COMET_128_TAG_SIZE);
+    aead_iovec_read(&ccur, Z, COMET_128_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, Y, Z, COMET_128_TAG_SIZE);
 }
 
-int comet_64_cham_aead_encrypt
+int comet_128_cham_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + COMET_128_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return comet_128_cham_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int comet_128_cham_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= COMET_128_TAG_SIZE ?
+                   clen - COMET_128_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return comet_128_cham_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int comet_64_cham_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     unsigned char Y[8];
     unsigned char Z[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + COMET_64_TAG_SIZE))
+        return -2;
     *clen = mlen + COMET_64_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the initial state of Y and Z */
     memset(Y, 0, 8);
@@ -427,35 +555,44 @@ int comet_64_cham_aead_encrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        comet_process_ad(Y, Z, 8, cham64_128_encrypt, ad, adlen);
+        comet_process_ad(Y, Z, 8, cham64_128_encrypt, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        comet_encrypt_64(Y, Z, cham64_128_encrypt, c, m, mlen);
+        comet_encrypt_64(Y, Z, cham64_128_encrypt, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
     Z[15] ^= 0x80;
     comet_adjust_block_key(Z);
-    cham64_128_encrypt(Z, c + mlen, Y);
+    cham64_128_encrypt(Z, Y, Y);
+    aead_iovec_write(&ccur, Y, COMET_64_TAG_SIZE);
     return 0;
 }
 
-int comet_64_cham_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int comet_64_cham_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char Y[8];
     unsigned char Z[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < COMET_64_TAG_SIZE)
         return -1;
     *mlen = clen - COMET_64_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the initial state of Y and Z */
     memset(Y, 0, 8);
@@ -466,33 +603,75 @@ int comet_64_cham_aead_decrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        comet_process_ad(Y, Z, 8, cham64_128_encrypt, ad, adlen);
+        comet_process_ad(Y, Z, 8, cham64_128_encrypt, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > COMET_64_TAG_SIZE)
-        comet_decrypt_64(Y, Z, cham64_128_encrypt, m, c, *mlen);
+        comet_decrypt_64(Y, Z, cham64_128_encrypt, &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
     Z[15] ^= 0x80;
     comet_adjust_block_key(Z);
     cham64_128_encrypt(Z, Y, Y);
-    return aead_check_tag(m, *mlen, Y, c + *mlen, COMET_64_TAG_SIZE);
+    aead_iovec_read(&ccur, Z, COMET_64_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, Y, Z, COMET_64_TAG_SIZE);
 }
 
-int comet_64_speck_aead_encrypt
+int comet_64_cham_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + COMET_64_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return comet_64_cham_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int comet_64_cham_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= COMET_64_TAG_SIZE ?
+                   clen - COMET_64_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return comet_64_cham_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int comet_64_speck_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     unsigned char Y[8];
     unsigned char Z[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + COMET_64_TAG_SIZE))
+        return -2;
     *clen = mlen + COMET_64_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the initial state of Y and Z */
     memset(Y, 0, 8);
@@ -503,35 +682,44 @@ int comet_64_speck_aead_encrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        comet_process_ad(Y, Z, 8, speck64_128_encrypt, ad, adlen);
+        comet_process_ad(Y, Z, 8, speck64_128_encrypt, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        comet_encrypt_64(Y, Z, speck64_128_encrypt, c, m, mlen);
+        comet_encrypt_64(Y, Z, speck64_128_encrypt, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
     Z[15] ^= 0x80;
     comet_adjust_block_key(Z);
-    speck64_128_encrypt(Z, c + mlen, Y);
+    speck64_128_encrypt(Z, Y, Y);
+    aead_iovec_write(&ccur, Y, COMET_64_TAG_SIZE);
     return 0;
 }
 
-int comet_64_speck_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int comet_64_speck_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char Y[8];
     unsigned char Z[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < COMET_64_TAG_SIZE)
         return -1;
     *mlen = clen - COMET_64_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the initial state of Y and Z */
     memset(Y, 0, 8);
@@ -542,15 +730,49 @@ int comet_64_speck_aead_decrypt
 
     /* Process the associated data */
     if (adlen > 0)
-        comet_process_ad(Y, Z, 8, speck64_128_encrypt, ad, adlen);
+        comet_process_ad(Y, Z, 8, speck64_128_encrypt, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > COMET_64_TAG_SIZE)
-        comet_decrypt_64(Y, Z, speck64_128_encrypt, m, c, *mlen);
+        comet_decrypt_64(Y, Z, speck64_128_encrypt, &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
     Z[15] ^= 0x80;
     comet_adjust_block_key(Z);
     speck64_128_encrypt(Z, Y, Y);
-    return aead_check_tag(m, *mlen, Y, c + *mlen, COMET_64_TAG_SIZE);
+    aead_iovec_read(&ccur, Z, COMET_64_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, Y, Z, COMET_64_TAG_SIZE);
+}
+
+int comet_64_speck_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + COMET_64_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return comet_64_speck_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int comet_64_speck_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= COMET_64_TAG_SIZE ?
+                   clen - COMET_64_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return comet_64_speck_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
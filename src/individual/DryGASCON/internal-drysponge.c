@@ -240,6 +240,8 @@ void drysponge128_g(drysponge128_state_t *state)
 {
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_DRYSPONGE128_G);
+
     /* Perform the first round.  For each round we XOR the 16 bytes of
      * the output data with the first 16 bytes of the state.  And then
      * XOR with the next 16 bytes of the state, rotated by 4 bytes */
@@ -263,6 +265,8 @@ void drysponge256_g(drysponge256_state_t *state)
 {
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_DRYSPONGE256_G);
+
     /* Perform the first round.  For each round we XOR the 16 bytes of
      * the output data with the first 16 bytes of the state.  And then
      * XOR with the next 16 bytes of the state, rotated by 4 bytes.
@@ -22,7 +22,7 @@
 
 #include "estate.h"
 #include "internal-gift128.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const estate_twegift_cipher = {
@@ -32,7 +32,18 @@ aead_cipher_t const estate_twegift_cipher = {
     ESTATE_TWEGIFT_TAG_SIZE,
     AEAD_FLAG_NONE,
     estate_twegift_aead_encrypt,
-    estate_twegift_aead_decrypt
+    estate_twegift_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    estate_twegift_aead_encrypt_vec,
+    estate_twegift_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -40,28 +51,32 @@ aead_cipher_t const estate_twegift_cipher = {
  *
  * \param ks The key schedule for TweGIFT-128.
  * \param tag Rolling state of the authentication tag.
- * \param m Message to be authenticated.
+ * \param m Cursor for the message to be authenticated.
  * \param mlen Length of the message to be authenticated; must be >= 1.
  * \param tweak1 Tweak value to use when the last block is full.
  * \param tweak2 Tweak value to use when the last block is partial.
  */
 static void estate_twegift_fcbc
     (const gift128n_key_schedule_t *ks, unsigned char tag[16],
-     const unsigned char *m, unsigned long long mlen,
+     aead_iovec_cursor_t *m, unsigned long long mlen,
      uint32_t tweak1, uint32_t tweak2)
 {
+    unsigned char buf[16];
+    const unsigned char *in;
     while (mlen > 16) {
-        lw_xor_block(tag, m, 16);
+        in = aead_iovec_load_block(m, buf, 16);
+        lw_xor_block(tag, in, 16);
         gift128n_encrypt(ks, tag, tag);
-        m += 16;
         mlen -= 16;
     }
     if (mlen == 16) {
-        lw_xor_block(tag, m, 16);
+        in = aead_iovec_load_block(m, buf, 16);
+        lw_xor_block(tag, in, 16);
         gift128t_encrypt(ks, tag, tag, tweak1);
     } else {
         unsigned temp = (unsigned)mlen;
-        lw_xor_block(tag, m, temp);
+        in = aead_iovec_load_block(m, buf, temp);
+        lw_xor_block(tag, in, temp);
         tag[temp] ^= 0x01;
         gift128t_encrypt(ks, tag, tag, tweak2);
     }
@@ -72,15 +87,15 @@ static void estate_twegift_fcbc
  *
  * \param ks The key schedule for TweGIFT-128.
  * \param tag Rolling state of the authentication tag.
- * \param m Message to be authenticated.
+ * \param m Cursor for the message to be authenticated.
  * \param mlen Length of the message to be authenticated.
- * \param ad Associated data to be authenticated.
+ * \param ad Cursor for the associated data to be authenticated.
  * \param adlen Length of the associated data to be authenticated.
  */
 static void estate_twegift_authenticate
     (const gift128n_key_schedule_t *ks, unsigned char tag[16],
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *m, unsigned long long mlen,
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
     /* Handle the case where both the message and associated data are empty */
     if (mlen == 0 && adlen == 0) {
@@ -114,86 +129,146 @@ static void estate_twegift_authenticate
  *
  * \param ks The key schedule for TweGIFT-128.
  * \param tag Pre-computed authentication tag for the packet.
- * \param c Ciphertext after encryption.
- * \param m Plaintext to be encrypted.
+ * \param c Cursor for the ciphertext after encryption.
+ * \param m Cursor for the plaintext to be encrypted.
  * \param mlen Length of the plaintext to be encrypted.
  */
 static void estate_twegift_encrypt
     (const gift128n_key_schedule_t *ks, const unsigned char tag[16],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen)
 {
     unsigned char block[16];
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
     memcpy(block, tag, 16);
-    while (mlen >= 16) {
-        gift128n_encrypt(ks, block, block);
-        lw_xor_block_2_src(c, block, m, 16);
-        c += 16;
-        m += 16;
-        mlen -= 16;
-    }
-    if (mlen > 0) {
+    while (mlen > 0) {
+        temp = mlen >= 16 ? 16 : (unsigned)mlen;
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
         gift128n_encrypt(ks, block, block);
-        lw_xor_block_2_src(c, block, m, (unsigned)mlen);
+        lw_xor_block_2_src(out, block, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
+        mlen -= temp;
     }
 }
 
-int estate_twegift_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int estate_twegift_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     gift128n_key_schedule_t ks;
     unsigned char tag[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ESTATE_TWEGIFT_TAG_SIZE))
+        return -2;
     *clen = mlen + ESTATE_TWEGIFT_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the key schedule and copy the nonce into the tag */
     gift128n_init(&ks, k);
     memcpy(tag, npub, 16);
 
     /* Authenticate the associated data and plaintext */
-    estate_twegift_authenticate(&ks, tag, m, mlen, ad, adlen);
+    estate_twegift_authenticate(&ks, tag, &mcur, mlen, &adcur, adlen);
 
     /* Encrypt the plaintext to generate the ciphertext */
-    estate_twegift_encrypt(&ks, tag, c, m, mlen);
+    aead_iovec_start(&mcur, m, m_count);
+    estate_twegift_encrypt(&ks, tag, &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    memcpy(c + mlen, tag, 16);
+    aead_iovec_write(&ccur, tag, 16);
     return 0;
 }
 
-int estate_twegift_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int estate_twegift_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     gift128n_key_schedule_t ks;
     unsigned char tag[16];
+    unsigned char received[16];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ESTATE_TWEGIFT_TAG_SIZE)
         return -1;
     *mlen = clen - ESTATE_TWEGIFT_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set up the key schedule and copy the nonce into the tag */
     gift128n_init(&ks, k);
     memcpy(tag, npub, 16);
 
-    /* Decrypt the ciphertext to generate the plaintext */
-    estate_twegift_encrypt(&ks, c + *mlen, m, c, *mlen);
+    /* Decrypt the ciphertext to generate the plaintext, using the
+     * received tag as the starting block */
+    aead_iovec_skip(&ccur, *mlen);
+    aead_iovec_read(&ccur, received, 16);
+    aead_iovec_start(&ccur, c, c_count);
+    estate_twegift_encrypt(&ks, received, &mcur, &ccur, *mlen);
 
     /* Authenticate the associated data and plaintext */
-    estate_twegift_authenticate(&ks, tag, m, *mlen, ad, adlen);
+    aead_iovec_start(&mcur, m, m_count);
+    estate_twegift_authenticate(&ks, tag, &mcur, *mlen, &adcur, adlen);
 
     /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, tag, c + *mlen, 16);
+    return aead_check_tag_vec(m, m_count, *mlen, tag, received, 16);
+}
+
+int estate_twegift_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ESTATE_TWEGIFT_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return estate_twegift_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int estate_twegift_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ESTATE_TWEGIFT_TAG_SIZE ?
+                   clen - ESTATE_TWEGIFT_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return estate_twegift_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
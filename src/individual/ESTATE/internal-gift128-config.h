@@ -61,6 +61,9 @@
 /**
  * \def GIFT128_VARIANT
  * \brief Selects the default variant of GIFT-128 to use on this platform.
+ *
+ * The other variants are also built into the library so that key
+ * contexts can select one at runtime with gift128_get_variant().
  */
 /**
  * \def GIFT128_VARIANT_ASM
@@ -23,6 +23,7 @@
 #include "elephant.h"
 #include "internal-keccak.h"
 #include "internal-spongent.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const dumbo_cipher = {
@@ -32,7 +33,18 @@ aead_cipher_t const dumbo_cipher = {
     DUMBO_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     dumbo_aead_encrypt,
-    dumbo_aead_decrypt
+    dumbo_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    dumbo_aead_encrypt_vec,
+    dumbo_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const jumbo_cipher = {
@@ -42,7 +54,18 @@ aead_cipher_t const jumbo_cipher = {
     JUMBO_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     jumbo_aead_encrypt,
-    jumbo_aead_decrypt
+    jumbo_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    jumbo_aead_encrypt_vec,
+    jumbo_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const delirium_cipher = {
@@ -52,7 +75,18 @@ aead_cipher_t const delirium_cipher = {
     DELIRIUM_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     delirium_aead_encrypt,
-    delirium_aead_decrypt
+    delirium_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    delirium_aead_encrypt_vec,
+    delirium_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -81,7 +115,7 @@ static void dumbo_lfsr
  * \param next Points to the next mask value.
  * \param tag Points to the ongoing tag that is being computed.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data.
  */
 static void dumbo_process_ad
@@ -90,8 +124,10 @@ static void dumbo_process_ad
      unsigned char next[SPONGENT160_STATE_SIZE],
      unsigned char tag[DUMBO_TAG_SIZE],
      const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[SPONGENT160_STATE_SIZE];
+    const unsigned char *in;
     unsigned posn, size;
 
     /* We need the "previous" and "next" masks in each step.
@@ -109,7 +145,8 @@ static void dumbo_process_ad
         size = SPONGENT160_STATE_SIZE - posn;
         if (size <= adlen) {
             /* Process a complete block */
-            lw_xor_block(state->B + posn, ad, size);
+            in = aead_iovec_load_block(ad, buf, size);
+            lw_xor_block(state->B + posn, in, size);
             spongent160_permute(state);
             lw_xor_block(state->B, mask, DUMBO_TAG_SIZE);
             lw_xor_block(state->B, next, DUMBO_TAG_SIZE);
@@ -121,10 +158,10 @@ static void dumbo_process_ad
         } else {
             /* Process the partial block at the end of the associated data */
             size = (unsigned)adlen;
-            lw_xor_block(state->B + posn, ad, size);
+            in = aead_iovec_load_block(ad, buf, size);
+            lw_xor_block(state->B + posn, in, size);
             posn += size;
         }
-        ad += size;
         adlen -= size;
     }
 
@@ -136,10 +173,10 @@ static void dumbo_process_ad
     lw_xor_block(tag, state->B, DUMBO_TAG_SIZE);
 }
 
-int dumbo_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int dumbo_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -149,10 +186,20 @@ int dumbo_aead_encrypt
     unsigned char mask[SPONGENT160_STATE_SIZE];
     unsigned char next[SPONGENT160_STATE_SIZE];
     unsigned char tag[DUMBO_TAG_SIZE];
+    unsigned char buf[SPONGENT160_STATE_SIZE];
+    const unsigned char *in;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + DUMBO_TAG_SIZE))
+        return -2;
     *clen = mlen + DUMBO_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Hash the key and generate the initial mask */
     memcpy(state.B, k, DUMBO_KEY_SIZE);
@@ -166,7 +213,7 @@ int dumbo_aead_encrypt
     memset(tag, 0, sizeof(tag));
 
     /* Authenticate the nonce and the associated data */
-    dumbo_process_ad(&state, mask, next, tag, npub, ad, adlen);
+    dumbo_process_ad(&state, mask, next, tag, npub, &adcur, adlen);
 
     /* Reset back to the starting mask for the encryption phase */
     memcpy(mask, start, sizeof(mask));
@@ -177,9 +224,10 @@ int dumbo_aead_encrypt
         memcpy(state.B, mask, SPONGENT160_STATE_SIZE);
         lw_xor_block(state.B, npub, DUMBO_NONCE_SIZE);
         spongent160_permute(&state);
-        lw_xor_block(state.B, m, SPONGENT160_STATE_SIZE);
+        in = aead_iovec_load_block(&mcur, buf, SPONGENT160_STATE_SIZE);
+        lw_xor_block(state.B, in, SPONGENT160_STATE_SIZE);
         lw_xor_block(state.B, mask, SPONGENT160_STATE_SIZE);
-        memcpy(c, state.B, SPONGENT160_STATE_SIZE);
+        aead_iovec_write(&ccur, state.B, SPONGENT160_STATE_SIZE);
 
         /* Authenticate using the next mask */
         dumbo_lfsr(next, mask);
@@ -192,8 +240,6 @@ int dumbo_aead_encrypt
 
         /* Advance to the next block */
         memcpy(mask, next, SPONGENT160_STATE_SIZE);
-        c += SPONGENT160_STATE_SIZE;
-        m += SPONGENT160_STATE_SIZE;
         mlen -= SPONGENT160_STATE_SIZE;
     }
     if (mlen > 0) {
@@ -202,9 +248,10 @@ int dumbo_aead_encrypt
         memcpy(state.B, mask, SPONGENT160_STATE_SIZE);
         lw_xor_block(state.B, npub, DUMBO_NONCE_SIZE);
         spongent160_permute(&state);
-        lw_xor_block(state.B, m, temp);
+        in = aead_iovec_load_block(&mcur, buf, temp);
+        lw_xor_block(state.B, in, temp);
         lw_xor_block(state.B, mask, SPONGENT160_STATE_SIZE);
-        memcpy(c, state.B, temp);
+        aead_iovec_write(&ccur, state.B, temp);
 
         /* Authenticate the last block using the next mask */
         dumbo_lfsr(next, mask);
@@ -216,7 +263,6 @@ int dumbo_aead_encrypt
         lw_xor_block(state.B, mask, DUMBO_TAG_SIZE);
         lw_xor_block(state.B, next, DUMBO_TAG_SIZE);
         lw_xor_block(tag, state.B, DUMBO_TAG_SIZE);
-        c += temp;
     } else if (*clen != DUMBO_TAG_SIZE) {
         /* Pad and authenticate when the last block is aligned */
         dumbo_lfsr(next, mask);
@@ -229,30 +275,42 @@ int dumbo_aead_encrypt
     }
 
     /* Generate the authentication tag */
-    memcpy(c, tag, DUMBO_TAG_SIZE);
+    aead_iovec_write(&ccur, tag, DUMBO_TAG_SIZE);
     return 0;
 }
 
-int dumbo_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int dumbo_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     spongent160_state_t state;
-    unsigned char *mtemp = m;
     unsigned char start[SPONGENT160_STATE_SIZE];
     unsigned char mask[SPONGENT160_STATE_SIZE];
     unsigned char next[SPONGENT160_STATE_SIZE];
     unsigned char tag[DUMBO_TAG_SIZE];
+    unsigned char received[DUMBO_TAG_SIZE];
+    unsigned char inbuf[SPONGENT160_STATE_SIZE];
+    unsigned char outbuf[SPONGENT160_STATE_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < DUMBO_TAG_SIZE)
         return -1;
     *mlen = clen - DUMBO_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Hash the key and generate the initial mask */
     memcpy(state.B, k, DUMBO_KEY_SIZE);
@@ -266,7 +324,7 @@ int dumbo_aead_decrypt
     memset(tag, 0, sizeof(tag));
 
     /* Authenticate the nonce and the associated data */
-    dumbo_process_ad(&state, mask, next, tag, npub, ad, adlen);
+    dumbo_process_ad(&state, mask, next, tag, npub, &adcur, adlen);
 
     /* Reset back to the starting mask for the encryption phase */
     memcpy(mask, start, sizeof(mask));
@@ -275,9 +333,10 @@ int dumbo_aead_decrypt
     clen -= DUMBO_TAG_SIZE;
     while (clen >= SPONGENT160_STATE_SIZE) {
         /* Authenticate using the next mask */
+        in = aead_iovec_load_block(&ccur, inbuf, SPONGENT160_STATE_SIZE);
         dumbo_lfsr(next, mask);
         lw_xor_block_2_src(state.B, mask, next, SPONGENT160_STATE_SIZE);
-        lw_xor_block(state.B, c, SPONGENT160_STATE_SIZE);
+        lw_xor_block(state.B, in, SPONGENT160_STATE_SIZE);
         spongent160_permute(&state);
         lw_xor_block(state.B, mask, DUMBO_TAG_SIZE);
         lw_xor_block(state.B, next, DUMBO_TAG_SIZE);
@@ -288,20 +347,21 @@ int dumbo_aead_decrypt
         lw_xor_block(state.B, npub, DUMBO_NONCE_SIZE);
         spongent160_permute(&state);
         lw_xor_block(state.B, mask, SPONGENT160_STATE_SIZE);
-        lw_xor_block_2_src(m, state.B, c, SPONGENT160_STATE_SIZE);
+        out = aead_iovec_store_begin(&mcur, outbuf, SPONGENT160_STATE_SIZE);
+        lw_xor_block_2_src(out, state.B, in, SPONGENT160_STATE_SIZE);
+        aead_iovec_store_end(&mcur, outbuf, out, SPONGENT160_STATE_SIZE);
 
         /* Advance to the next block */
         memcpy(mask, next, SPONGENT160_STATE_SIZE);
-        c += SPONGENT160_STATE_SIZE;
-        m += SPONGENT160_STATE_SIZE;
         clen -= SPONGENT160_STATE_SIZE;
     }
     if (clen > 0) {
         /* Authenticate the last block using the next mask */
         unsigned temp = (unsigned)clen;
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
         dumbo_lfsr(next, mask);
         lw_xor_block_2_src(state.B, mask, next, SPONGENT160_STATE_SIZE);
-        lw_xor_block(state.B, c, temp);
+        lw_xor_block(state.B, in, temp);
         state.B[temp] ^= 0x01;
         spongent160_permute(&state);
         lw_xor_block(state.B, mask, DUMBO_TAG_SIZE);
@@ -313,8 +373,9 @@ int dumbo_aead_decrypt
         lw_xor_block(state.B, npub, DUMBO_NONCE_SIZE);
         spongent160_permute(&state);
         lw_xor_block(state.B, mask, temp);
-        lw_xor_block_2_src(m, state.B, c, temp);
-        c += temp;
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
+        lw_xor_block_2_src(out, state.B, in, temp);
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
     } else if (*mlen != 0) {
         /* Pad and authenticate when the last block is aligned */
         dumbo_lfsr(next, mask);
@@ -327,7 +388,42 @@ int dumbo_aead_decrypt
     }
 
     /* Check the authentication tag */
-    return aead_check_tag(mtemp, *mlen, tag, c, DUMBO_TAG_SIZE);
+    aead_iovec_read(&ccur, received, DUMBO_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, DUMBO_TAG_SIZE);
+}
+
+int dumbo_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + DUMBO_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return dumbo_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int dumbo_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= DUMBO_TAG_SIZE ?
+                   clen - DUMBO_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return dumbo_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 /**
@@ -356,7 +452,7 @@ static void jumbo_lfsr
  * \param next Points to the next mask value.
  * \param tag Points to the ongoing tag that is being computed.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data.
  */
 static void jumbo_process_ad
@@ -365,8 +461,10 @@ static void jumbo_process_ad
      unsigned char next[SPONGENT176_STATE_SIZE],
      unsigned char tag[JUMBO_TAG_SIZE],
      const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[SPONGENT176_STATE_SIZE];
+    const unsigned char *in;
     unsigned posn, size;
 
     /* We need the "previous" and "next" masks in each step.
@@ -384,7 +482,8 @@ static void jumbo_process_ad
         size = SPONGENT176_STATE_SIZE - posn;
         if (size <= adlen) {
             /* Process a complete block */
-            lw_xor_block(state->B + posn, ad, size);
+            in = aead_iovec_load_block(ad, buf, size);
+            lw_xor_block(state->B + posn, in, size);
             spongent176_permute(state);
             lw_xor_block(state->B, mask, JUMBO_TAG_SIZE);
             lw_xor_block(state->B, next, JUMBO_TAG_SIZE);
@@ -396,10 +495,10 @@ static void jumbo_process_ad
         } else {
             /* Process the partial block at the end of the associated data */
             size = (unsigned)adlen;
-            lw_xor_block(state->B + posn, ad, size);
+            in = aead_iovec_load_block(ad, buf, size);
+            lw_xor_block(state->B + posn, in, size);
             posn += size;
         }
-        ad += size;
         adlen -= size;
     }
 
@@ -411,10 +510,10 @@ static void jumbo_process_ad
     lw_xor_block(tag, state->B, JUMBO_TAG_SIZE);
 }
 
-int jumbo_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int jumbo_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -424,10 +523,20 @@ int jumbo_aead_encrypt
     unsigned char mask[SPONGENT176_STATE_SIZE];
     unsigned char next[SPONGENT176_STATE_SIZE];
     unsigned char tag[JUMBO_TAG_SIZE];
+    unsigned char buf[SPONGENT176_STATE_SIZE];
+    const unsigned char *in;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + JUMBO_TAG_SIZE))
+        return -2;
     *clen = mlen + JUMBO_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Hash the key and generate the initial mask */
     memcpy(state.B, k, JUMBO_KEY_SIZE);
@@ -441,7 +550,7 @@ int jumbo_aead_encrypt
     memset(tag, 0, sizeof(tag));
 
     /* Authenticate the nonce and the associated data */
-    jumbo_process_ad(&state, mask, next, tag, npub, ad, adlen);
+    jumbo_process_ad(&state, mask, next, tag, npub, &adcur, adlen);
 
     /* Reset back to the starting mask for the encryption phase */
     memcpy(mask, start, sizeof(mask));
@@ -452,9 +561,10 @@ int jumbo_aead_encrypt
         memcpy(state.B, mask, SPONGENT176_STATE_SIZE);
         lw_xor_block(state.B, npub, JUMBO_NONCE_SIZE);
         spongent176_permute(&state);
-        lw_xor_block(state.B, m, SPONGENT176_STATE_SIZE);
+        in = aead_iovec_load_block(&mcur, buf, SPONGENT176_STATE_SIZE);
+        lw_xor_block(state.B, in, SPONGENT176_STATE_SIZE);
         lw_xor_block(state.B, mask, SPONGENT176_STATE_SIZE);
-        memcpy(c, state.B, SPONGENT176_STATE_SIZE);
+        aead_iovec_write(&ccur, state.B, SPONGENT176_STATE_SIZE);
 
         /* Authenticate using the next mask */
         jumbo_lfsr(next, mask);
@@ -467,8 +577,6 @@ int jumbo_aead_encrypt
 
         /* Advance to the next block */
         memcpy(mask, next, SPONGENT176_STATE_SIZE);
-        c += SPONGENT176_STATE_SIZE;
-        m += SPONGENT176_STATE_SIZE;
         mlen -= SPONGENT176_STATE_SIZE;
     }
     if (mlen > 0) {
@@ -477,9 +585,10 @@ int jumbo_aead_encrypt
         memcpy(state.B, mask, SPONGENT176_STATE_SIZE);
         lw_xor_block(state.B, npub, JUMBO_NONCE_SIZE);
         spongent176_permute(&state);
-        lw_xor_block(state.B, m, temp);
+        in = aead_iovec_load_block(&mcur, buf, temp);
+        lw_xor_block(state.B, in, temp);
         lw_xor_block(state.B, mask, SPONGENT176_STATE_SIZE);
-        memcpy(c, state.B, temp);
+        aead_iovec_write(&ccur, state.B, temp);
 
         /* Authenticate the last block using the next mask */
         jumbo_lfsr(next, mask);
@@ -491,7 +600,6 @@ int jumbo_aead_encrypt
         lw_xor_block(state.B, mask, JUMBO_TAG_SIZE);
         lw_xor_block(state.B, next, JUMBO_TAG_SIZE);
         lw_xor_block(tag, state.B, JUMBO_TAG_SIZE);
-        c += temp;
     } else if (*clen != JUMBO_TAG_SIZE) {
         /* Pad and authenticate when the last block is aligned */
         jumbo_lfsr(next, mask);
@@ -504,30 +612,42 @@ int jumbo_aead_encrypt
     }
 
     /* Generate the authentication tag */
-    memcpy(c, tag, JUMBO_TAG_SIZE);
+    aead_iovec_write(&ccur, tag, JUMBO_TAG_SIZE);
     return 0;
 }
 
-int jumbo_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int jumbo_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     spongent176_state_t state;
-    unsigned char *mtemp = m;
     unsigned char start[SPONGENT176_STATE_SIZE];
     unsigned char mask[SPONGENT176_STATE_SIZE];
     unsigned char next[SPONGENT176_STATE_SIZE];
     unsigned char tag[JUMBO_TAG_SIZE];
+    unsigned char received[JUMBO_TAG_SIZE];
+    unsigned char inbuf[SPONGENT176_STATE_SIZE];
+    unsigned char outbuf[SPONGENT176_STATE_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < JUMBO_TAG_SIZE)
         return -1;
     *mlen = clen - JUMBO_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Hash the key and generate the initial mask */
     memcpy(state.B, k, JUMBO_KEY_SIZE);
@@ -541,7 +661,7 @@ int jumbo_aead_decrypt
     memset(tag, 0, sizeof(tag));
 
     /* Authenticate the nonce and the associated data */
-    jumbo_process_ad(&state, mask, next, tag, npub, ad, adlen);
+    jumbo_process_ad(&state, mask, next, tag, npub, &adcur, adlen);
 
     /* Reset back to the starting mask for the encryption phase */
     memcpy(mask, start, sizeof(mask));
@@ -550,9 +670,10 @@ int jumbo_aead_decrypt
     clen -= JUMBO_TAG_SIZE;
     while (clen >= SPONGENT176_STATE_SIZE) {
         /* Authenticate using the next mask */
+        in = aead_iovec_load_block(&ccur, inbuf, SPONGENT176_STATE_SIZE);
         jumbo_lfsr(next, mask);
         lw_xor_block_2_src(state.B, mask, next, SPONGENT176_STATE_SIZE);
-        lw_xor_block(state.B, c, SPONGENT176_STATE_SIZE);
+        lw_xor_block(state.B, in, SPONGENT176_STATE_SIZE);
         spongent176_permute(&state);
         lw_xor_block(state.B, mask, JUMBO_TAG_SIZE);
         lw_xor_block(state.B, next, JUMBO_TAG_SIZE);
@@ -563,20 +684,21 @@ int jumbo_aead_decrypt
         lw_xor_block(state.B, npub, JUMBO_NONCE_SIZE);
         spongent176_permute(&state);
         lw_xor_block(state.B, mask, SPONGENT176_STATE_SIZE);
-        lw_xor_block_2_src(m, state.B, c, SPONGENT176_STATE_SIZE);
+        out = aead_iovec_store_begin(&mcur, outbuf, SPONGENT176_STATE_SIZE);
+        lw_xor_block_2_src(out, state.B, in, SPONGENT176_STATE_SIZE);
+        aead_iovec_store_end(&mcur, outbuf, out, SPONGENT176_STATE_SIZE);
 
         /* Advance to the next block */
         memcpy(mask, next, SPONGENT176_STATE_SIZE);
-        c += SPONGENT176_STATE_SIZE;
-        m += SPONGENT176_STATE_SIZE;
         clen -= SPONGENT176_STATE_SIZE;
     }
     if (clen > 0) {
         /* Authenticate the last block using the next mask */
         unsigned temp = (unsigned)clen;
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
         jumbo_lfsr(next, mask);
         lw_xor_block_2_src(state.B, mask, next, SPONGENT176_STATE_SIZE);
-        lw_xor_block(state.B, c, temp);
+        lw_xor_block(state.B, in, temp);
         state.B[temp] ^= 0x01;
         spongent176_permute(&state);
         lw_xor_block(state.B, mask, JUMBO_TAG_SIZE);
@@ -588,8 +710,9 @@ int jumbo_aead_decrypt
         lw_xor_block(state.B, npub, JUMBO_NONCE_SIZE);
         spongent176_permute(&state);
         lw_xor_block(state.B, mask, temp);
-        lw_xor_block_2_src(m, state.B, c, temp);
-        c += temp;
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
+        lw_xor_block_2_src(out, state.B, in, temp);
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
     } else if (*mlen != 0) {
         /* Pad and authenticate when the last block is aligned */
         jumbo_lfsr(next, mask);
@@ -602,7 +725,42 @@ int jumbo_aead_decrypt
     }
 
     /* Check the authentication tag */
-    return aead_check_tag(mtemp, *mlen, tag, c, JUMBO_TAG_SIZE);
+    aead_iovec_read(&ccur, received, JUMBO_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, JUMBO_TAG_SIZE);
+}
+
+int jumbo_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + JUMBO_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return jumbo_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int jumbo_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= JUMBO_TAG_SIZE ?
+                   clen - JUMBO_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return jumbo_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 /**
@@ -631,7 +789,7 @@ static void delirium_lfsr
  * \param next Points to the next mask value.
  * \param tag Points to the ongoing tag that is being computed.
  * \param npub Points to the nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data.
  */
 static void delirium_process_ad
@@ -640,8 +798,10 @@ static void delirium_process_ad
      unsigned char next[KECCAKP_200_STATE_SIZE],
      unsigned char tag[DELIRIUM_TAG_SIZE],
      const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char buf[KECCAKP_200_STATE_SIZE];
+    const unsigned char *in;
     unsigned posn, size;
 
     /* We need the "previous" and "next" masks in each step.
@@ -659,7 +819,8 @@ static void delirium_process_ad
         size = KECCAKP_200_STATE_SIZE - posn;
         if (size <= adlen) {
             /* Process a complete block */
-            lw_xor_block(state->B + posn, ad, size);
+            in = aead_iovec_load_block(ad, buf, size);
+            lw_xor_block(state->B + posn, in, size);
             keccakp_200_permute(state);
             lw_xor_block(state->B, mask, DELIRIUM_TAG_SIZE);
             lw_xor_block(state->B, next, DELIRIUM_TAG_SIZE);
@@ -671,10 +832,10 @@ static void delirium_process_ad
         } else {
             /* Process the partial block at the end of the associated data */
             size = (unsigned)adlen;
-            lw_xor_block(state->B + posn, ad, size);
+            in = aead_iovec_load_block(ad, buf, size);
+            lw_xor_block(state->B + posn, in, size);
             posn += size;
         }
-        ad += size;
         adlen -= size;
     }
 
@@ -686,10 +847,10 @@ static void delirium_process_ad
     lw_xor_block(tag, state->B, DELIRIUM_TAG_SIZE);
 }
 
-int delirium_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int delirium_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -699,10 +860,20 @@ int delirium_aead_encrypt
     unsigned char mask[KECCAKP_200_STATE_SIZE];
     unsigned char next[KECCAKP_200_STATE_SIZE];
     unsigned char tag[DELIRIUM_TAG_SIZE];
+    unsigned char buf[KECCAKP_200_STATE_SIZE];
+    const unsigned char *in;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + DELIRIUM_TAG_SIZE))
+        return -2;
     *clen = mlen + DELIRIUM_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Hash the key and generate the initial mask */
     memcpy(state.B, k, DELIRIUM_KEY_SIZE);
@@ -716,7 +887,7 @@ int delirium_aead_encrypt
     memset(tag, 0, sizeof(tag));
 
     /* Authenticate the nonce and the associated data */
-    delirium_process_ad(&state, mask, next, tag, npub, ad, adlen);
+    delirium_process_ad(&state, mask, next, tag, npub, &adcur, adlen);
 
     /* Reset back to the starting mask for the encryption phase */
     memcpy(mask, start, sizeof(mask));
@@ -727,9 +898,10 @@ int delirium_aead_encrypt
         memcpy(state.B, mask, KECCAKP_200_STATE_SIZE);
         lw_xor_block(state.B, npub, DELIRIUM_NONCE_SIZE);
         keccakp_200_permute(&state);
-        lw_xor_block(state.B, m, KECCAKP_200_STATE_SIZE);
+        in = aead_iovec_load_block(&mcur, buf, KECCAKP_200_STATE_SIZE);
+        lw_xor_block(state.B, in, KECCAKP_200_STATE_SIZE);
         lw_xor_block(state.B, mask, KECCAKP_200_STATE_SIZE);
-        memcpy(c, state.B, KECCAKP_200_STATE_SIZE);
+        aead_iovec_write(&ccur, state.B, KECCAKP_200_STATE_SIZE);
 
         /* Authenticate using the next mask */
         delirium_lfsr(next, mask);
@@ -742,8 +914,6 @@ int delirium_aead_encrypt
 
         /* Advance to the next block */
         memcpy(mask, next, KECCAKP_200_STATE_SIZE);
-        c += KECCAKP_200_STATE_SIZE;
-        m += KECCAKP_200_STATE_SIZE;
         mlen -= KECCAKP_200_STATE_SIZE;
     }
     if (mlen > 0) {
@@ -752,9 +922,10 @@ int delirium_aead_encrypt
         memcpy(state.B, mask, KECCAKP_200_STATE_SIZE);
         lw_xor_block(state.B, npub, DELIRIUM_NONCE_SIZE);
         keccakp_200_permute(&state);
-        lw_xor_block(state.B, m, temp);
+        in = aead_iovec_load_block(&mcur, buf, temp);
+        lw_xor_block(state.B, in, temp);
         lw_xor_block(state.B, mask, KECCAKP_200_STATE_SIZE);
-        memcpy(c, state.B, temp);
+        aead_iovec_write(&ccur, state.B, temp);
 
         /* Authenticate the last block using the next mask */
         delirium_lfsr(next, mask);
@@ -766,7 +937,6 @@ int delirium_aead_encrypt
         lw_xor_block(state.B, mask, DELIRIUM_TAG_SIZE);
         lw_xor_block(state.B, next, DELIRIUM_TAG_SIZE);
         lw_xor_block(tag, state.B, DELIRIUM_TAG_SIZE);
-        c += temp;
     } else if (*clen != DELIRIUM_TAG_SIZE) {
         /* Pad and authenticate when the last block is aligned */
         delirium_lfsr(next, mask);
@@ -779,30 +949,42 @@ int delirium_aead_encrypt
     }
 
     /* Generate the authentication tag */
-    memcpy(c, tag, DELIRIUM_TAG_SIZE);
+    aead_iovec_write(&ccur, tag, DELIRIUM_TAG_SIZE);
     return 0;
 }
 
-int delirium_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int delirium_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     keccakp_200_state_t state;
-    unsigned char *mtemp = m;
     unsigned char start[KECCAKP_200_STATE_SIZE];
     unsigned char mask[KECCAKP_200_STATE_SIZE];
     unsigned char next[KECCAKP_200_STATE_SIZE];
     unsigned char tag[DELIRIUM_TAG_SIZE];
+    unsigned char received[DELIRIUM_TAG_SIZE];
+    unsigned char inbuf[KECCAKP_200_STATE_SIZE];
+    unsigned char outbuf[KECCAKP_200_STATE_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < DELIRIUM_TAG_SIZE)
         return -1;
     *mlen = clen - DELIRIUM_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Hash the key and generate the initial mask */
     memcpy(state.B, k, DELIRIUM_KEY_SIZE);
@@ -816,7 +998,7 @@ int delirium_aead_decrypt
     memset(tag, 0, sizeof(tag));
 
     /* Authenticate the nonce and the associated data */
-    delirium_process_ad(&state, mask, next, tag, npub, ad, adlen);
+    delirium_process_ad(&state, mask, next, tag, npub, &adcur, adlen);
 
     /* Reset back to the starting mask for the encryption phase */
     memcpy(mask, start, sizeof(mask));
@@ -825,9 +1007,10 @@ int delirium_aead_decrypt
     clen -= DELIRIUM_TAG_SIZE;
     while (clen >= KECCAKP_200_STATE_SIZE) {
         /* Authenticate using the next mask */
+        in = aead_iovec_load_block(&ccur, inbuf, KECCAKP_200_STATE_SIZE);
         delirium_lfsr(next, mask);
         lw_xor_block_2_src(state.B, mask, next, KECCAKP_200_STATE_SIZE);
-        lw_xor_block(state.B, c, KECCAKP_200_STATE_SIZE);
+        lw_xor_block(state.B, in, KECCAKP_200_STATE_SIZE);
         keccakp_200_permute(&state);
         lw_xor_block(state.B, mask, DELIRIUM_TAG_SIZE);
         lw_xor_block(state.B, next, DELIRIUM_TAG_SIZE);
@@ -838,20 +1021,21 @@ int delirium_aead_decrypt
         lw_xor_block(state.B, npub, DELIRIUM_NONCE_SIZE);
         keccakp_200_permute(&state);
         lw_xor_block(state.B, mask, KECCAKP_200_STATE_SIZE);
-        lw_xor_block_2_src(m, state.B, c, KECCAKP_200_STATE_SIZE);
+        out = aead_iovec_store_begin(&mcur, outbuf, KECCAKP_200_STATE_SIZE);
+        lw_xor_block_2_src(out, state.B, in, KECCAKP_200_STATE_SIZE);
+        aead_iovec_store_end(&mcur, outbuf, out, KECCAKP_200_STATE_SIZE);
 
         /* Advance to the next block */
         memcpy(mask, next, KECCAKP_200_STATE_SIZE);
-        c += KECCAKP_200_STATE_SIZE;
-        m += KECCAKP_200_STATE_SIZE;
         clen -= KECCAKP_200_STATE_SIZE;
     }
     if (clen > 0) {
         /* Authenticate the last block using the next mask */
         unsigned temp = (unsigned)clen;
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
         delirium_lfsr(next, mask);
         lw_xor_block_2_src(state.B, mask, next, KECCAKP_200_STATE_SIZE);
-        lw_xor_block(state.B, c, temp);
+        lw_xor_block(state.B, in, temp);
         state.B[temp] ^= 0x01;
         keccakp_200_permute(&state);
         lw_xor_block(state.B, mask, DELIRIUM_TAG_SIZE);
@@ -863,8 +1047,9 @@ int delirium_aead_decrypt
         lw_xor_block(state.B, npub, DELIRIUM_NONCE_SIZE);
         keccakp_200_permute(&state);
         lw_xor_block(state.B, mask, temp);
-        lw_xor_block_2_src(m, state.B, c, temp);
-        c += temp;
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
+        lw_xor_block_2_src(out, state.B, in, temp);
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
     } else if (*mlen != 0) {
         /* Pad and authenticate when the last block is aligned */
         delirium_lfsr(next, mask);
@@ -877,5 +1062,40 @@ int delirium_aead_decrypt
     }
 
     /* Check the authentication tag */
-    return aead_check_tag(mtemp, *mlen, tag, c, DELIRIUM_TAG_SIZE);
+    aead_iovec_read(&ccur, received, DELIRIUM_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, DELIRIUM_TAG_SIZE);
+}
+
+int delirium_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + DELIRIUM_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return delirium_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int delirium_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= DELIRIUM_TAG_SIZE ?
+                   clen - DELIRIUM_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return delirium_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
@@ -0,0 +1,371 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/* We expect a number of macros to be defined before this file
+ * is included to configure the kernel for a specific vector type.
+ * The macros are the same as for internal-skinny128-lanes.h:
+ *
+ * SKINNY_LANES_NAME      Suffix for the kernel names; e.g. _avx2
+ * SKINNY_LANES_TARGET    Target attribute for the kernels, may be empty.
+ * SKINNY_LANES_TYPE      Type of a vector of 32-bit words; e.g. __m256i
+ * SKINNY_LANES_WIDTH     Number of 32-bit words in a vector.
+ * SKINNY_LANES_LOAD      Loads a vector from a pointer to 32-bit words.
+ * SKINNY_LANES_STORE     Stores a vector to a pointer to 32-bit words.
+ * SKINNY_LANES_XOR       XOR's two vectors.
+ * SKINNY_LANES_AND       AND's two vectors.
+ * SKINNY_LANES_OR        OR's two vectors.
+ * SKINNY_LANES_SHL       Shifts the words of a vector left by a constant.
+ * SKINNY_LANES_SHR       Shifts the words of a vector right by a constant.
+ * SKINNY_LANES_ROL       Rotates the words of a vector left by 8, 16, or 24.
+ * SKINNY_LANES_SET1      Broadcasts a 32-bit value to all words.
+ *
+ * Each lane of a vector holds the same word of a different block and
+ * every block has its own tweakey, so the kernels run the rounds of
+ * ForkSkinny-128-256 or ForkSkinny-128-384 on many blocks at once.
+ */
+#if defined(SKINNY_LANES_NAME)
+
+#define SKINNY_LANES_CONCAT_INNER(name,suffix) name##suffix
+#define SKINNY_LANES_CONCAT(name,suffix) SKINNY_LANES_CONCAT_INNER(name,suffix)
+
+#include "internal-skinnyutil-lanes.h"
+
+/* Loads and stores rows of the multi-block state for a group of lanes */
+#define FORKSKINNY_LANES_LOAD4(x0, x1, x2, x3, rows) \
+    do { \
+        x0 = SKINNY_LANES_LOAD((rows)[0] + group); \
+        x1 = SKINNY_LANES_LOAD((rows)[1] + group); \
+        x2 = SKINNY_LANES_LOAD((rows)[2] + group); \
+        x3 = SKINNY_LANES_LOAD((rows)[3] + group); \
+    } while (0)
+#define FORKSKINNY_LANES_STORE4(x0, x1, x2, x3, rows) \
+    do { \
+        SKINNY_LANES_STORE((rows)[0] + group, x0); \
+        SKINNY_LANES_STORE((rows)[1] + group, x1); \
+        SKINNY_LANES_STORE((rows)[2] + group, x2); \
+        SKINNY_LANES_STORE((rows)[3] + group, x3); \
+    } while (0)
+
+/**
+ * \brief Applies several rounds of ForkSkinny-128 to interleaved blocks.
+ *
+ * \param state Multi-block state to apply the rounds to.
+ * \param lanes Number of lanes to process, which must be a multiple
+ * of the vector width.
+ * \param first First round to apply.
+ * \param last Last round to apply plus 1.
+ * \param tk3 Non-zero for ForkSkinny-128-384, zero for ForkSkinny-128-256.
+ */
+SKINNY_LANES_TARGET static void SKINNY_LANES_CONCAT
+    (forkskinny_128_rounds_lanes, SKINNY_LANES_NAME)
+    (forkskinny_128_blocks_state_t *state, unsigned lanes,
+     unsigned first, unsigned last, int tk3)
+{
+    SKINNY_LANES_TYPE s0, s1, s2, s3, temp;
+    SKINNY_LANES_TYPE t0, t1, t2, t3;
+    SKINNY_LANES_TYPE u0, u1, u2, u3;
+    SKINNY_LANES_TYPE v0, v1, v2, v3;
+    unsigned group, round;
+    uint8_t rc;
+    for (group = 0; group < lanes; group += SKINNY_LANES_WIDTH) {
+        FORKSKINNY_LANES_LOAD4(s0, s1, s2, s3, state->S);
+        FORKSKINNY_LANES_LOAD4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_LOAD4(u0, u1, u2, u3, state->TK2);
+        if (tk3) {
+            FORKSKINNY_LANES_LOAD4(v0, v1, v2, v3, state->TK3);
+        } else {
+            v0 = v1 = v2 = v3 = SKINNY_LANES_SET1(0);
+        }
+        for (round = first; round < last; ++round) {
+            /* Apply the S-box to all cells in the state */
+            SKINNY_LANES_SBOX(s0);
+            SKINNY_LANES_SBOX(s1);
+            SKINNY_LANES_SBOX(s2);
+            SKINNY_LANES_SBOX(s3);
+
+            /* XOR the round constant and the subkey for this round */
+            rc = RC[round];
+            s0 = SKINNY_LANES_XOR3(s0, SKINNY_LANES_XOR(t0, u0),
+                     SKINNY_LANES_SET1((rc & 0x0F) ^ 0x00020000U));
+            s1 = SKINNY_LANES_XOR3(s1, SKINNY_LANES_XOR(t1, u1),
+                     SKINNY_LANES_SET1(rc >> 4));
+            if (tk3) {
+                s0 = SKINNY_LANES_XOR(s0, v0);
+                s1 = SKINNY_LANES_XOR(s1, v1);
+            }
+            s2 = SKINNY_LANES_XOR(s2, SKINNY_LANES_SET1(0x02));
+
+            /* Shift the cells in the rows right */
+            s1 = SKINNY_LANES_ROL(s1, 8);
+            s2 = SKINNY_LANES_ROL(s2, 16);
+            s3 = SKINNY_LANES_ROL(s3, 24);
+
+            /* Mix the columns */
+            s1 = SKINNY_LANES_XOR(s1, s2);
+            s2 = SKINNY_LANES_XOR(s2, s0);
+            temp = SKINNY_LANES_XOR(s3, s2);
+            s3 = s2;
+            s2 = s1;
+            s1 = s0;
+            s0 = temp;
+
+            /* Permute the tweakey for the next round */
+            SKINNY_LANES_PERMUTE_TK(t0, t1, t2, t3);
+            SKINNY_LANES_PERMUTE_TK(u0, u1, u2, u3);
+            u0 = SKINNY_LANES_LFSR2(u0);
+            u1 = SKINNY_LANES_LFSR2(u1);
+            if (tk3) {
+                SKINNY_LANES_PERMUTE_TK(v0, v1, v2, v3);
+                v0 = SKINNY_LANES_LFSR3(v0);
+                v1 = SKINNY_LANES_LFSR3(v1);
+            }
+        }
+        FORKSKINNY_LANES_STORE4(s0, s1, s2, s3, state->S);
+        FORKSKINNY_LANES_STORE4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_STORE4(u0, u1, u2, u3, state->TK2);
+        if (tk3)
+            FORKSKINNY_LANES_STORE4(v0, v1, v2, v3, state->TK3);
+    }
+}
+
+/**
+ * \brief Applies several rounds of ForkSkinny-128 in reverse to
+ * interleaved blocks.
+ *
+ * \param state Multi-block state to apply the rounds to.
+ * \param lanes Number of lanes to process, which must be a multiple
+ * of the vector width.
+ * \param first First round to apply plus 1.
+ * \param last Last round to apply.
+ * \param tk3 Non-zero for ForkSkinny-128-384, zero for ForkSkinny-128-256.
+ */
+SKINNY_LANES_TARGET static void SKINNY_LANES_CONCAT
+    (forkskinny_128_inv_rounds_lanes, SKINNY_LANES_NAME)
+    (forkskinny_128_blocks_state_t *state, unsigned lanes,
+     unsigned first, unsigned last, int tk3)
+{
+    SKINNY_LANES_TYPE s0, s1, s2, s3, temp;
+    SKINNY_LANES_TYPE t0, t1, t2, t3;
+    SKINNY_LANES_TYPE u0, u1, u2, u3;
+    SKINNY_LANES_TYPE v0, v1, v2, v3;
+    unsigned group, round;
+    uint8_t rc;
+    for (group = 0; group < lanes; group += SKINNY_LANES_WIDTH) {
+        FORKSKINNY_LANES_LOAD4(s0, s1, s2, s3, state->S);
+        FORKSKINNY_LANES_LOAD4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_LOAD4(u0, u1, u2, u3, state->TK2);
+        if (tk3) {
+            FORKSKINNY_LANES_LOAD4(v0, v1, v2, v3, state->TK3);
+        } else {
+            v0 = v1 = v2 = v3 = SKINNY_LANES_SET1(0);
+        }
+        for (round = first; round > last; --round) {
+            /* Permute the tweakey for the next round */
+            u0 = SKINNY_LANES_LFSR3(u0);
+            u1 = SKINNY_LANES_LFSR3(u1);
+            SKINNY_LANES_INV_PERMUTE_TK(t0, t1, t2, t3);
+            SKINNY_LANES_INV_PERMUTE_TK(u0, u1, u2, u3);
+            if (tk3) {
+                v0 = SKINNY_LANES_LFSR2(v0);
+                v1 = SKINNY_LANES_LFSR2(v1);
+                SKINNY_LANES_INV_PERMUTE_TK(v0, v1, v2, v3);
+            }
+
+            /* Inverse mix of the columns */
+            temp = s0;
+            s0 = s1;
+            s1 = s2;
+            s2 = s3;
+            s3 = SKINNY_LANES_XOR(temp, s2);
+            s2 = SKINNY_LANES_XOR(s2, s0);
+            s1 = SKINNY_LANES_XOR(s1, s2);
+
+            /* Shift the cells in the rows left */
+            s1 = SKINNY_LANES_ROL(s1, 24);
+            s2 = SKINNY_LANES_ROL(s2, 16);
+            s3 = SKINNY_LANES_ROL(s3, 8);
+
+            /* XOR the round constant and the subkey for this round */
+            rc = RC[round - 1];
+            s0 = SKINNY_LANES_XOR3(s0, SKINNY_LANES_XOR(t0, u0),
+                     SKINNY_LANES_SET1((rc & 0x0F) ^ 0x00020000U));
+            s1 = SKINNY_LANES_XOR3(s1, SKINNY_LANES_XOR(t1, u1),
+                     SKINNY_LANES_SET1(rc >> 4));
+            if (tk3) {
+                s0 = SKINNY_LANES_XOR(s0, v0);
+                s1 = SKINNY_LANES_XOR(s1, v1);
+            }
+            s2 = SKINNY_LANES_XOR(s2, SKINNY_LANES_SET1(0x02));
+
+            /* Apply the inverse of the S-box to all cells in the state */
+            SKINNY_LANES_INV_SBOX(s0);
+            SKINNY_LANES_INV_SBOX(s1);
+            SKINNY_LANES_INV_SBOX(s2);
+            SKINNY_LANES_INV_SBOX(s3);
+        }
+        FORKSKINNY_LANES_STORE4(s0, s1, s2, s3, state->S);
+        FORKSKINNY_LANES_STORE4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_STORE4(u0, u1, u2, u3, state->TK2);
+        if (tk3)
+            FORKSKINNY_LANES_STORE4(v0, v1, v2, v3, state->TK3);
+    }
+}
+
+/**
+ * \brief Forwards the tweakeys of interleaved ForkSkinny-128 blocks.
+ *
+ * \param state Multi-block state containing the tweakeys.
+ * \param lanes Number of lanes to process, which must be a multiple
+ * of the vector width.
+ * \param rounds Number of rounds to forward by.
+ * \param tk3 Non-zero for ForkSkinny-128-384, zero for ForkSkinny-128-256.
+ */
+SKINNY_LANES_TARGET static void SKINNY_LANES_CONCAT
+    (forkskinny_128_forward_tk_lanes, SKINNY_LANES_NAME)
+    (forkskinny_128_blocks_state_t *state, unsigned lanes,
+     unsigned rounds, int tk3)
+{
+    SKINNY_LANES_TYPE t0, t1, t2, t3;
+    SKINNY_LANES_TYPE u0, u1, u2, u3;
+    SKINNY_LANES_TYPE v0, v1, v2, v3;
+    unsigned group, round, temp;
+    for (group = 0; group < lanes; group += SKINNY_LANES_WIDTH) {
+        FORKSKINNY_LANES_LOAD4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_LOAD4(u0, u1, u2, u3, state->TK2);
+        if (tk3) {
+            FORKSKINNY_LANES_LOAD4(v0, v1, v2, v3, state->TK3);
+        } else {
+            v0 = v1 = v2 = v3 = SKINNY_LANES_SET1(0);
+        }
+
+        /* The tweak permutation repeats every 16 rounds, during which
+         * the LFSR will be applied 8 times to every word */
+        for (round = rounds; round >= 16; round -= 16) {
+            for (temp = 0; temp < 8; ++temp) {
+                u0 = SKINNY_LANES_LFSR2(u0);
+                u1 = SKINNY_LANES_LFSR2(u1);
+                u2 = SKINNY_LANES_LFSR2(u2);
+                u3 = SKINNY_LANES_LFSR2(u3);
+                v0 = SKINNY_LANES_LFSR3(v0);
+                v1 = SKINNY_LANES_LFSR3(v1);
+                v2 = SKINNY_LANES_LFSR3(v2);
+                v3 = SKINNY_LANES_LFSR3(v3);
+            }
+        }
+
+        /* Handle the left-over rounds */
+        for (; round > 0; --round) {
+            SKINNY_LANES_PERMUTE_TK(t0, t1, t2, t3);
+            SKINNY_LANES_PERMUTE_TK(u0, u1, u2, u3);
+            SKINNY_LANES_PERMUTE_TK(v0, v1, v2, v3);
+            u0 = SKINNY_LANES_LFSR2(u0);
+            u1 = SKINNY_LANES_LFSR2(u1);
+            v0 = SKINNY_LANES_LFSR3(v0);
+            v1 = SKINNY_LANES_LFSR3(v1);
+        }
+        FORKSKINNY_LANES_STORE4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_STORE4(u0, u1, u2, u3, state->TK2);
+        if (tk3)
+            FORKSKINNY_LANES_STORE4(v0, v1, v2, v3, state->TK3);
+    }
+}
+
+/**
+ * \brief Reverses the tweakeys of interleaved ForkSkinny-128 blocks.
+ *
+ * \param state Multi-block state containing the tweakeys.
+ * \param lanes Number of lanes to process, which must be a multiple
+ * of the vector width.
+ * \param rounds Number of rounds to reverse by.
+ * \param tk3 Non-zero for ForkSkinny-128-384, zero for ForkSkinny-128-256.
+ */
+SKINNY_LANES_TARGET static void SKINNY_LANES_CONCAT
+    (forkskinny_128_reverse_tk_lanes, SKINNY_LANES_NAME)
+    (forkskinny_128_blocks_state_t *state, unsigned lanes,
+     unsigned rounds, int tk3)
+{
+    SKINNY_LANES_TYPE t0, t1, t2, t3;
+    SKINNY_LANES_TYPE u0, u1, u2, u3;
+    SKINNY_LANES_TYPE v0, v1, v2, v3;
+    unsigned group, round, temp;
+    for (group = 0; group < lanes; group += SKINNY_LANES_WIDTH) {
+        FORKSKINNY_LANES_LOAD4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_LOAD4(u0, u1, u2, u3, state->TK2);
+        if (tk3) {
+            FORKSKINNY_LANES_LOAD4(v0, v1, v2, v3, state->TK3);
+        } else {
+            v0 = v1 = v2 = v3 = SKINNY_LANES_SET1(0);
+        }
+
+        /* The tweak permutation repeats every 16 rounds, during which
+         * the LFSR will be applied 8 times to every word */
+        for (round = rounds; round >= 16; round -= 16) {
+            for (temp = 0; temp < 8; ++temp) {
+                u0 = SKINNY_LANES_LFSR3(u0);
+                u1 = SKINNY_LANES_LFSR3(u1);
+                u2 = SKINNY_LANES_LFSR3(u2);
+                u3 = SKINNY_LANES_LFSR3(u3);
+                v0 = SKINNY_LANES_LFSR2(v0);
+                v1 = SKINNY_LANES_LFSR2(v1);
+                v2 = SKINNY_LANES_LFSR2(v2);
+                v3 = SKINNY_LANES_LFSR2(v3);
+            }
+        }
+
+        /* Handle the left-over rounds */
+        for (; round > 0; --round) {
+            u0 = SKINNY_LANES_LFSR3(u0);
+            u1 = SKINNY_LANES_LFSR3(u1);
+            v0 = SKINNY_LANES_LFSR2(v0);
+            v1 = SKINNY_LANES_LFSR2(v1);
+            SKINNY_LANES_INV_PERMUTE_TK(t0, t1, t2, t3);
+            SKINNY_LANES_INV_PERMUTE_TK(u0, u1, u2, u3);
+            SKINNY_LANES_INV_PERMUTE_TK(v0, v1, v2, v3);
+        }
+        FORKSKINNY_LANES_STORE4(t0, t1, t2, t3, state->TK1);
+        FORKSKINNY_LANES_STORE4(u0, u1, u2, u3, state->TK2);
+        if (tk3)
+            FORKSKINNY_LANES_STORE4(v0, v1, v2, v3, state->TK3);
+    }
+}
+
+#endif /* SKINNY_LANES_NAME */
+
+/* Now undefine everything so that we can include this file again for
+ * another vector type */
+#undef SKINNY_LANES_NAME
+#undef SKINNY_LANES_TARGET
+#undef SKINNY_LANES_TYPE
+#undef SKINNY_LANES_WIDTH
+#undef SKINNY_LANES_LOAD
+#undef SKINNY_LANES_STORE
+#undef SKINNY_LANES_XOR
+#undef SKINNY_LANES_AND
+#undef SKINNY_LANES_OR
+#undef SKINNY_LANES_SHL
+#undef SKINNY_LANES_SHR
+#undef SKINNY_LANES_ROL
+#undef SKINNY_LANES_SET1
+#undef SKINNY_LANES_CONCAT_INNER
+#undef SKINNY_LANES_CONCAT
+#undef FORKSKINNY_LANES_LOAD4
+#undef FORKSKINNY_LANES_STORE4
@@ -21,6 +21,7 @@
  */
 
 #include "internal-forkskinny.h"
+#include "internal-cpu.h"
 #include "internal-skinnyutil.h"
 
 /**
@@ -398,6 +399,258 @@ void forkskinny_128_384_reverse_tk
     }
 }
 
+/* Multi-lane kernels, instantiated from internal-forkskinny-lanes.h for
+ * each vector type.  The portable version has one lane per "vector" */
+#define SKINNY_LANES_NAME _c
+#define SKINNY_LANES_TARGET
+#define SKINNY_LANES_TYPE uint32_t
+#define SKINNY_LANES_WIDTH 1
+#define SKINNY_LANES_LOAD(ptr) (*(ptr))
+#define SKINNY_LANES_STORE(ptr, x) (*(ptr) = (x))
+#define SKINNY_LANES_XOR(a, b) ((a) ^ (b))
+#define SKINNY_LANES_AND(a, b) ((a) & (b))
+#define SKINNY_LANES_OR(a, b) ((a) | (b))
+#define SKINNY_LANES_SHL(a, bits) ((a) << (bits))
+#define SKINNY_LANES_SHR(a, bits) ((a) >> (bits))
+#define SKINNY_LANES_ROL(a, bits) (leftRotate((a), (bits)))
+#define SKINNY_LANES_SET1(value) ((uint32_t)(value))
+#include "internal-forkskinny-lanes.h"
+
+#if defined(LW_CPU_HAVE_SSE2)
+#include <emmintrin.h>
+#define SKINNY_LANES_NAME _sse2
+#define SKINNY_LANES_TARGET LW_CPU_TARGET("sse2")
+#define SKINNY_LANES_TYPE __m128i
+#define SKINNY_LANES_WIDTH 4
+#define SKINNY_LANES_LOAD(ptr) (_mm_loadu_si128((const __m128i *)(ptr)))
+#define SKINNY_LANES_STORE(ptr, x) (_mm_storeu_si128((__m128i *)(ptr), (x)))
+#define SKINNY_LANES_XOR _mm_xor_si128
+#define SKINNY_LANES_AND _mm_and_si128
+#define SKINNY_LANES_OR _mm_or_si128
+#define SKINNY_LANES_SHL _mm_slli_epi32
+#define SKINNY_LANES_SHR _mm_srli_epi32
+#define SKINNY_LANES_ROL(a, bits) \
+    (_mm_or_si128(_mm_slli_epi32((a), (bits)), \
+                  _mm_srli_epi32((a), 32 - (bits))))
+#define SKINNY_LANES_SET1(value) (_mm_set1_epi32((int)(value)))
+#include "internal-forkskinny-lanes.h"
+#endif /* LW_CPU_HAVE_SSE2 */
+
+#if defined(LW_CPU_HAVE_AVX2)
+#include <immintrin.h>
+#define SKINNY_LANES_NAME _avx2
+#define SKINNY_LANES_TARGET LW_CPU_TARGET("avx2")
+#define SKINNY_LANES_TYPE __m256i
+#define SKINNY_LANES_WIDTH 8
+#define SKINNY_LANES_LOAD(ptr) (_mm256_loadu_si256((const __m256i *)(ptr)))
+#define SKINNY_LANES_STORE(ptr, x) \
+    (_mm256_storeu_si256((__m256i *)(ptr), (x)))
+#define SKINNY_LANES_XOR _mm256_xor_si256
+#define SKINNY_LANES_AND _mm256_and_si256
+#define SKINNY_LANES_OR _mm256_or_si256
+#define SKINNY_LANES_SHL _mm256_slli_epi32
+#define SKINNY_LANES_SHR _mm256_srli_epi32
+#define SKINNY_LANES_ROL(a, bits) \
+    (_mm256_shuffle_epi8((a), SKINNY_LANES_ROT##bits##_X8))
+#define SKINNY_LANES_SET1(value) (_mm256_set1_epi32((int)(value)))
+#include "internal-forkskinny-lanes.h"
+#endif /* LW_CPU_HAVE_AVX2 */
+
+#if defined(LW_CPU_HAVE_AVX512F)
+#define SKINNY_LANES_NAME _avx512
+#define SKINNY_LANES_TARGET LW_CPU_TARGET("avx512f")
+#define SKINNY_LANES_TYPE __m512i
+#define SKINNY_LANES_WIDTH 16
+#define SKINNY_LANES_LOAD(ptr) (_mm512_loadu_si512((ptr)))
+#define SKINNY_LANES_STORE(ptr, x) (_mm512_storeu_si512((ptr), (x)))
+#define SKINNY_LANES_XOR _mm512_xor_si512
+#define SKINNY_LANES_AND _mm512_and_si512
+#define SKINNY_LANES_OR _mm512_or_si512
+#define SKINNY_LANES_SHL _mm512_slli_epi32
+#define SKINNY_LANES_SHR _mm512_srli_epi32
+#define SKINNY_LANES_ROL _mm512_rol_epi32
+#define SKINNY_LANES_SET1(value) (_mm512_set1_epi32((int)(value)))
+#include "internal-forkskinny-lanes.h"
+#endif /* LW_CPU_HAVE_AVX512F */
+
+/**
+ * \brief Kernel for applying rounds to interleaved ForkSkinny-128 blocks.
+ */
+typedef void (*forkskinny_128_rounds_kernel_t)
+    (forkskinny_128_blocks_state_t *state, unsigned lanes,
+     unsigned first, unsigned last, int tk3);
+
+/**
+ * \brief Kernel for forwarding or reversing the tweakeys of interleaved
+ * ForkSkinny-128 blocks.
+ */
+typedef void (*forkskinny_128_tk_kernel_t)
+    (forkskinny_128_blocks_state_t *state, unsigned lanes,
+     unsigned rounds, int tk3);
+
+/**
+ * \brief Multi-lane kernels for a specific vector width.
+ */
+typedef struct
+{
+    unsigned width;                         /**< Number of lanes */
+    forkskinny_128_rounds_kernel_t rounds;  /**< Forward rounds */
+    forkskinny_128_rounds_kernel_t inv_rounds; /**< Inverse rounds */
+    forkskinny_128_tk_kernel_t forward_tk;  /**< Forward the tweakeys */
+    forkskinny_128_tk_kernel_t reverse_tk;  /**< Reverse the tweakeys */
+
+} forkskinny_128_lanes_t;
+
+static forkskinny_128_lanes_t const forkskinny_128_lanes_c = {
+    1, forkskinny_128_rounds_lanes_c, forkskinny_128_inv_rounds_lanes_c,
+    forkskinny_128_forward_tk_lanes_c, forkskinny_128_reverse_tk_lanes_c
+};
+#if defined(LW_CPU_HAVE_SSE2)
+static forkskinny_128_lanes_t const forkskinny_128_lanes_sse2 = {
+    4, forkskinny_128_rounds_lanes_sse2, forkskinny_128_inv_rounds_lanes_sse2,
+    forkskinny_128_forward_tk_lanes_sse2, forkskinny_128_reverse_tk_lanes_sse2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+static forkskinny_128_lanes_t const forkskinny_128_lanes_avx2 = {
+    8, forkskinny_128_rounds_lanes_avx2, forkskinny_128_inv_rounds_lanes_avx2,
+    forkskinny_128_forward_tk_lanes_avx2, forkskinny_128_reverse_tk_lanes_avx2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX512F)
+static forkskinny_128_lanes_t const forkskinny_128_lanes_avx512 = {
+    16, forkskinny_128_rounds_lanes_avx512,
+    forkskinny_128_inv_rounds_lanes_avx512,
+    forkskinny_128_forward_tk_lanes_avx512,
+    forkskinny_128_reverse_tk_lanes_avx512
+};
+#endif
+
+/**
+ * \brief Multi-lane kernels that have been bound for this CPU.
+ */
+static const forkskinny_128_lanes_t *forkskinny_128_lanes = 0;
+
+/**
+ * \brief Selects the widest multi-lane kernels for this CPU.
+ *
+ * \return The kernels to use.
+ */
+static const forkskinny_128_lanes_t *forkskinny_128_lanes_select(void)
+{
+    unsigned features = lw_cpu_features();
+#if defined(LW_CPU_HAVE_AVX512F)
+    if (features & LW_CPU_AVX512F)
+        return &forkskinny_128_lanes_avx512;
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+    if (features & LW_CPU_AVX2)
+        return &forkskinny_128_lanes_avx2;
+#endif
+#if defined(LW_CPU_HAVE_SSE2)
+    if (features & LW_CPU_SSE2)
+        return &forkskinny_128_lanes_sse2;
+#endif
+    (void)features;
+    return &forkskinny_128_lanes_c;
+}
+
+/**
+ * \brief Gets the multi-lane kernels for this CPU, binding them on
+ * first use.
+ *
+ * \return The kernels to use.
+ */
+static const forkskinny_128_lanes_t *forkskinny_128_lanes_get(void)
+{
+    const forkskinny_128_lanes_t *lanes = LW_CPU_LOAD(forkskinny_128_lanes);
+    if (!lanes) {
+        lanes = forkskinny_128_lanes_select();
+        LW_CPU_STORE(forkskinny_128_lanes, lanes);
+    }
+    return lanes;
+}
+
+/**
+ * \brief Rounds the number of blocks in a multi-block state up to a
+ * whole number of vectors.
+ *
+ * \param state Points to the multi-block state.
+ * \param width Number of lanes in a vector.
+ *
+ * \return The number of lanes to process.
+ */
+#define forkskinny_128_lanes_count(state, width) \
+    (((state)->count + (width) - 1) / (width) * (width))
+
+void forkskinny_128_256_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->rounds))
+        (state, forkskinny_128_lanes_count(state, impl->width),
+         first, last, 0);
+}
+
+void forkskinny_128_256_inv_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->inv_rounds))
+        (state, forkskinny_128_lanes_count(state, impl->width),
+         first, last, 0);
+}
+
+void forkskinny_128_256_forward_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->forward_tk))
+        (state, forkskinny_128_lanes_count(state, impl->width), rounds, 0);
+}
+
+void forkskinny_128_256_reverse_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->reverse_tk))
+        (state, forkskinny_128_lanes_count(state, impl->width), rounds, 0);
+}
+
+void forkskinny_128_384_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->rounds))
+        (state, forkskinny_128_lanes_count(state, impl->width),
+         first, last, 1);
+}
+
+void forkskinny_128_384_inv_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->inv_rounds))
+        (state, forkskinny_128_lanes_count(state, impl->width),
+         first, last, 1);
+}
+
+void forkskinny_128_384_forward_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->forward_tk))
+        (state, forkskinny_128_lanes_count(state, impl->width), rounds, 1);
+}
+
+void forkskinny_128_384_reverse_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds)
+{
+    const forkskinny_128_lanes_t *impl = forkskinny_128_lanes_get();
+    (*(impl->reverse_tk))
+        (state, forkskinny_128_lanes_count(state, impl->width), rounds, 1);
+}
+
 void forkskinny_64_192_rounds
     (forkskinny_64_192_state_t *state, unsigned first, unsigned last)
 {
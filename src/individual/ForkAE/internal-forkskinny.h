@@ -23,6 +23,7 @@
 #ifndef LW_INTERNAL_FORKSKINNY_H
 #define LW_INTERNAL_FORKSKINNY_H
 
+#include "internal-cpu.h"
 #include "internal-util.h"
 
 /**
@@ -75,6 +76,41 @@ typedef struct
 
 } forkskinny_64_192_state_t;
 
+/**
+ * \brief Maximum number of blocks that can be held in a multi-block
+ * ForkSkinny-128 state.
+ *
+ * This is 1 on AVR and on other targets without vector kernels, where
+ * the PAEF modes encrypt one block at a time instead.
+ */
+#if defined(__AVR__) || !defined(LW_CPU_HAVE_SSE2)
+#define FORKSKINNY_128_BLOCKS_MAX 1
+#else
+#define FORKSKINNY_128_BLOCKS_MAX 16
+#endif
+
+/**
+ * \brief State information for several ForkSkinny-128-256 or
+ * ForkSkinny-128-384 blocks that are processed in parallel.
+ *
+ * Word "i" of block "n" is stored in element [i][n] of each array so that
+ * the same word of every block is contiguous in memory.  TK3 is not used
+ * by ForkSkinny-128-256.
+ *
+ * The blocks are processed a vector at a time, so the unused entries
+ * after \a count should be initialized even though their results are
+ * discarded.
+ */
+typedef struct
+{
+    uint32_t TK1[4][FORKSKINNY_128_BLOCKS_MAX]; /**< TK1 of each block */
+    uint32_t TK2[4][FORKSKINNY_128_BLOCKS_MAX]; /**< TK2 of each block */
+    uint32_t TK3[4][FORKSKINNY_128_BLOCKS_MAX]; /**< TK3 of each block */
+    uint32_t S[4][FORKSKINNY_128_BLOCKS_MAX];   /**< State of each block */
+    unsigned count;                             /**< Number of blocks */
+
+} forkskinny_128_blocks_state_t;
+
 /**
  * \brief Applies several rounds of ForkSkinny-128-256.
  *
@@ -151,6 +187,84 @@ void forkskinny_128_384_forward_tk
 void forkskinny_128_384_reverse_tk
     (forkskinny_128_384_state_t *state, unsigned rounds);
 
+/**
+ * \brief Applies several rounds of ForkSkinny-128-256 to multiple blocks.
+ *
+ * \param state Multi-block state to apply the rounds to.
+ * \param first First round to apply.
+ * \param last Last round to apply plus 1.
+ */
+void forkskinny_128_256_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last);
+
+/**
+ * \brief Applies several rounds of ForkSkinny-128-256 in reverse to
+ * multiple blocks.
+ *
+ * \param state Multi-block state to apply the rounds to.
+ * \param first First round to apply plus 1.
+ * \param last Last round to apply.
+ */
+void forkskinny_128_256_inv_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last);
+
+/**
+ * \brief Forwards the tweakeys for multiple ForkSkinny-128-256 blocks.
+ *
+ * \param state Points to the multi-block state.
+ * \param rounds Number of rounds to forward by.
+ */
+void forkskinny_128_256_forward_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds);
+
+/**
+ * \brief Reverses the tweakeys for multiple ForkSkinny-128-256 blocks.
+ *
+ * \param state Points to the multi-block state.
+ * \param rounds Number of rounds to reverse by.
+ */
+void forkskinny_128_256_reverse_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds);
+
+/**
+ * \brief Applies several rounds of ForkSkinny-128-384 to multiple blocks.
+ *
+ * \param state Multi-block state to apply the rounds to.
+ * \param first First round to apply.
+ * \param last Last round to apply plus 1.
+ */
+void forkskinny_128_384_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last);
+
+/**
+ * \brief Applies several rounds of ForkSkinny-128-384 in reverse to
+ * multiple blocks.
+ *
+ * \param state Multi-block state to apply the rounds to.
+ * \param first First round to apply plus 1.
+ * \param last Last round to apply.
+ */
+void forkskinny_128_384_inv_rounds_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned first, unsigned last);
+
+/**
+ * \brief Forwards the tweakeys for multiple ForkSkinny-128-384 blocks.
+ *
+ * \param state Points to the multi-block state.
+ * \param rounds Number of rounds to forward by.
+ */
+void forkskinny_128_384_forward_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds);
+
+/**
+ * \brief Reverses the tweakeys for multiple ForkSkinny-128-384 blocks.
+ *
+ * \param state Points to the multi-block state.
+ * \param rounds Number of rounds to reverse by.
+ */
+void forkskinny_128_384_reverse_tk_blocks
+    (forkskinny_128_blocks_state_t *state, unsigned rounds);
+
 /**
  * \brief Applies several rounds of ForkSkinny-64-192.
  *
@@ -252,6 +366,74 @@ void forkskinny_128_384_decrypt
     (const unsigned char key[48], unsigned char *output_left,
      unsigned char *output_right, const unsigned char *input);
 
+/**
+ * \brief Encrypts multiple blocks of plaintext with ForkSkinny-128-256.
+ *
+ * \param key Points to \a count 256-bit tweakeys, one for each block.
+ * \param output_left Left output blocks for the ciphertext, or NULL if
+ * the left outputs are not required.
+ * \param output_right Right output blocks for the authentication tags.
+ * \param input Points to \a count 128-bit input plaintext blocks.
+ * \param count Number of blocks to encrypt.
+ *
+ * The result is the same as calling forkskinny_128_256_encrypt() on each
+ * block in turn.  Unlike the single-block version, the right output is
+ * not optional.  The input blocks may be in the same buffer as either
+ * set of output blocks.
+ */
+void forkskinny_128_256_encrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count);
+
+/**
+ * \brief Decrypts multiple blocks of ciphertext with ForkSkinny-128-256.
+ *
+ * \param key Points to \a count 256-bit tweakeys, one for each block.
+ * \param output_left Left output blocks, which are the plaintext.
+ * \param output_right Right output blocks for the authentication tags.
+ * \param input Points to \a count 128-bit input ciphertext blocks.
+ * \param count Number of blocks to decrypt.
+ *
+ * Both sets of output blocks will be populated; neither is optional.
+ */
+void forkskinny_128_256_decrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count);
+
+/**
+ * \brief Encrypts multiple blocks of plaintext with ForkSkinny-128-384.
+ *
+ * \param key Points to \a count 384-bit tweakeys, one for each block.
+ * \param output_left Left output blocks for the ciphertext, or NULL if
+ * the left outputs are not required.
+ * \param output_right Right output blocks for the authentication tags.
+ * \param input Points to \a count 128-bit input plaintext blocks.
+ * \param count Number of blocks to encrypt.
+ *
+ * The result is the same as calling forkskinny_128_384_encrypt() on each
+ * block in turn.  Unlike the single-block version, the right output is
+ * not optional.  The input blocks may be in the same buffer as either
+ * set of output blocks.
+ */
+void forkskinny_128_384_encrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count);
+
+/**
+ * \brief Decrypts multiple blocks of ciphertext with ForkSkinny-128-384.
+ *
+ * \param key Points to \a count 384-bit tweakeys, one for each block.
+ * \param output_left Left output blocks, which are the plaintext.
+ * \param output_right Right output blocks for the authentication tags.
+ * \param input Points to \a count 128-bit input ciphertext blocks.
+ * \param count Number of blocks to decrypt.
+ *
+ * Both sets of output blocks will be populated; neither is optional.
+ */
+void forkskinny_128_384_decrypt_blocks
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count);
+
 /**
  * \brief Encrypts a block of input with ForkSkinny-64-192.
  *
@@ -22,19 +22,10 @@
 
 #include "gift-cofb.h"
 #include "internal-gift128.h"
+#include "internal-iovec.h"
 #include "internal-util.h"
 #include <string.h>
 
-aead_cipher_t const gift_cofb_cipher = {
-    "GIFT-COFB",
-    GIFT_COFB_KEY_SIZE,
-    GIFT_COFB_NONCE_SIZE,
-    GIFT_COFB_TAG_SIZE,
-    AEAD_FLAG_NONE,
-    gift_cofb_aead_encrypt,
-    gift_cofb_aead_decrypt
-};
-
 /**
  * \brief Structure of an L value.
  *
@@ -119,7 +110,8 @@ typedef union
  * \param mlen Length of the plaintext in bytes.
  */
 static void gift_cofb_assoc_data
-    (gift128b_key_schedule_t *ks, gift_cofb_block_t *Y, gift_cofb_l_t *L,
+    (const gift128_variant_key_schedule_t *ks,
+     gift_cofb_block_t *Y, gift_cofb_l_t *L,
      const unsigned char *ad, unsigned long long adlen, unsigned long long mlen)
 {
     /* Deal with all associated data blocks except the last */
@@ -130,7 +122,7 @@ static void gift_cofb_assoc_data
         Y->x[1] ^= L->y ^ be_load_word32(ad + 4);
         Y->x[2] ^= be_load_word32(ad + 8);
         Y->x[3] ^= be_load_word32(ad + 12);
-        gift128b_encrypt_preloaded(ks, Y->x, Y->x);
+        gift128b_variant_encrypt_preloaded(ks, Y->x, Y->x);
         ad += 16;
         adlen -= 16;
     }
@@ -162,7 +154,73 @@ static void gift_cofb_assoc_data
     }
     Y->x[0] ^= L->x;
     Y->x[1] ^= L->y;
-    gift128b_encrypt_preloaded(ks, Y->x, Y->x);
+    gift128b_variant_encrypt_preloaded(ks, Y->x, Y->x);
+}
+
+/**
+ * \brief Process scatter/gather associated data for GIFT-COFB encryption
+ * or decryption.
+ *
+ * \param ks The GIFT-128 key schedule to use.
+ * \param Y GIFT-COFB internal state.
+ * \param L GIFT-COFB internal state.
+ * \param ad Points to the array of associated data segments.
+ * \param ad_count Number of segments in \a ad.
+ * \param adlen Total length of the associated data in bytes.
+ * \param mlen Length of the plaintext in bytes.
+ */
+static void gift_cofb_assoc_data_vec
+    (const gift128_variant_key_schedule_t *ks,
+     gift_cofb_block_t *Y, gift_cofb_l_t *L,
+     const aead_iovec_t *ad, size_t ad_count,
+     unsigned long long adlen, unsigned long long mlen)
+{
+    aead_iovec_cursor_t cursor;
+    unsigned char padded[16];
+    const unsigned char *block;
+    aead_iovec_start(&cursor, ad, ad_count);
+
+    /* Deal with all associated data blocks except the last */
+    while (adlen > 16) {
+        block = aead_iovec_load_block(&cursor, padded, 16);
+        gift_cofb_double_L(L);
+        gift_cofb_feedback(Y);
+        Y->x[0] ^= L->x ^ be_load_word32(block);
+        Y->x[1] ^= L->y ^ be_load_word32(block + 4);
+        Y->x[2] ^= be_load_word32(block + 8);
+        Y->x[3] ^= be_load_word32(block + 12);
+        gift128b_variant_encrypt_preloaded(ks, Y->x, Y->x);
+        adlen -= 16;
+    }
+
+    /* Pad and deal with the last block */
+    gift_cofb_feedback(Y);
+    if (adlen == 16) {
+        block = aead_iovec_load_block(&cursor, padded, 16);
+        Y->x[0] ^= be_load_word32(block);
+        Y->x[1] ^= be_load_word32(block + 4);
+        Y->x[2] ^= be_load_word32(block + 8);
+        Y->x[3] ^= be_load_word32(block + 12);
+        gift_cofb_triple_L(L);
+    } else {
+        unsigned temp = (unsigned)adlen;
+        aead_iovec_read(&cursor, padded, temp);
+        padded[temp] = 0x80;
+        memset(padded + temp + 1, 0, 16 - temp - 1);
+        Y->x[0] ^= be_load_word32(padded);
+        Y->x[1] ^= be_load_word32(padded + 4);
+        Y->x[2] ^= be_load_word32(padded + 8);
+        Y->x[3] ^= be_load_word32(padded + 12);
+        gift_cofb_triple_L(L);
+        gift_cofb_triple_L(L);
+    }
+    if (mlen == 0) {
+        gift_cofb_triple_L(L);
+        gift_cofb_triple_L(L);
+    }
+    Y->x[0] ^= L->x;
+    Y->x[1] ^= L->y;
+    gift128b_variant_encrypt_preloaded(ks, Y->x, Y->x);
 }
 
 /** @cond cofb_byte_swap */
@@ -188,15 +246,22 @@ static void gift_cofb_assoc_data
 
 /** @endcond */
 
-int gift_cofb_aead_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with GIFT-COFB using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int gift_cofb_aead_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    gift128b_key_schedule_t ks;
+    const gift128_variant_key_schedule_t *ks =
+        (const gift128_variant_key_schedule_t *)ctx;
     gift_cofb_block_t Y;
     gift_cofb_l_t L;
     gift_cofb_block_t P;
@@ -205,18 +270,17 @@ int gift_cofb_aead_encrypt
     /* Set the length of the returned ciphertext */
     *clen = mlen + GIFT_COFB_TAG_SIZE;
 
-    /* Set up the key schedule and use it to encrypt the nonce */
-    gift128b_init(&ks, k);
+    /* Encrypt the nonce to initialize the state */
     Y.x[0] = be_load_word32(npub);
     Y.x[1] = be_load_word32(npub + 4);
     Y.x[2] = be_load_word32(npub + 8);
     Y.x[3] = be_load_word32(npub + 12);
-    gift128b_encrypt_preloaded(&ks, Y.x, Y.x);
+    gift128b_variant_encrypt_preloaded(ks, Y.x, Y.x);
     L.x = Y.x[0];
     L.y = Y.x[1];
 
     /* Authenticate the associated data */
-    gift_cofb_assoc_data(&ks, &Y, &L, ad, adlen, mlen);
+    gift_cofb_assoc_data(ks, &Y, &L, ad, adlen, mlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
@@ -236,7 +300,7 @@ int gift_cofb_aead_encrypt
             Y.x[1] ^= L.y ^ P.x[1];
             Y.x[2] ^= P.x[2];
             Y.x[3] ^= P.x[3];
-            gift128b_encrypt_preloaded(&ks, Y.x, Y.x);
+            gift128b_variant_encrypt_preloaded(ks, Y.x, Y.x);
             c += 16;
             m += 16;
             mlen -= 16;
@@ -287,7 +351,7 @@ int gift_cofb_aead_encrypt
         }
         Y.x[0] ^= L.x;
         Y.x[1] ^= L.y;
-        gift128b_encrypt_preloaded(&ks, Y.x, Y.x);
+        gift128b_variant_encrypt_preloaded(ks, Y.x, Y.x);
     }
 
     /* Generate the final authentication tag */
@@ -298,15 +362,22 @@ int gift_cofb_aead_encrypt
     return 0;
 }
 
-int gift_cofb_aead_decrypt
+/**
+ * \brief Decrypts and authenticates a packet with GIFT-COFB using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int gift_cofb_aead_decrypt_ctx
     (unsigned char *m, unsigned long long *mlen,
      unsigned char *nsec,
      const unsigned char *c, unsigned long long clen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    gift128b_key_schedule_t ks;
+    const gift128_variant_key_schedule_t *ks =
+        (const gift128_variant_key_schedule_t *)ctx;
     gift_cofb_block_t Y;
     gift_cofb_l_t L;
     gift_cofb_block_t P;
@@ -318,18 +389,17 @@ int gift_cofb_aead_decrypt
         return -1;
     *mlen = clen - GIFT_COFB_TAG_SIZE;
 
-    /* Set up the key schedule and use it to encrypt the nonce */
-    gift128b_init(&ks, k);
+    /* Encrypt the nonce to initialize the state */
     Y.x[0] = be_load_word32(npub);
     Y.x[1] = be_load_word32(npub + 4);
     Y.x[2] = be_load_word32(npub + 8);
     Y.x[3] = be_load_word32(npub + 12);
-    gift128b_encrypt_preloaded(&ks, Y.x, Y.x);
+    gift128b_variant_encrypt_preloaded(ks, Y.x, Y.x);
     L.x = Y.x[0];
     L.y = Y.x[1];
 
     /* Authenticate the associated data */
-    gift_cofb_assoc_data(&ks, &Y, &L, ad, adlen, *mlen);
+    gift_cofb_assoc_data(ks, &Y, &L, ad, adlen, *mlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     mtemp = m;
@@ -351,7 +421,7 @@ int gift_cofb_aead_decrypt
             Y.x[1] ^= L.y ^ P.x[1];
             Y.x[2] ^= P.x[2];
             Y.x[3] ^= P.x[3];
-            gift128b_encrypt_preloaded(&ks, Y.x, Y.x);
+            gift128b_variant_encrypt_preloaded(ks, Y.x, Y.x);
             c += 16;
             m += 16;
             clen -= 16;
@@ -396,10 +466,316 @@ int gift_cofb_aead_decrypt
         }
         Y.x[0] ^= L.x;
         Y.x[1] ^= L.y;
-        gift128b_encrypt_preloaded(&ks, Y.x, Y.x);
+        gift128b_variant_encrypt_preloaded(ks, Y.x, Y.x);
     }
 
     /* Check the authentication tag at the end of the packet */
     gift_cofb_byte_swap(Y.x);
     return aead_check_tag(mtemp, *mlen, Y.y, c, GIFT_COFB_TAG_SIZE);
 }
+
+/**
+ * \brief Sets up the key schedule for GIFT-COFB.
+ *
+ * \param ctx Points to the GIFT-128 key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ */
+static void gift_cofb_setup_key(void *ctx, const unsigned char *k)
+{
+    gift128b_variant_init
+        ((gift128_variant_key_schedule_t *)ctx, k, GIFT128_VARIANT);
+}
+
+/**
+ * \brief Gets the size of the GIFT-COFB key context for a key schedule
+ * variant.
+ *
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * \return The size of the key context in bytes.
+ */
+static size_t gift_cofb_schedule_size(unsigned schedule)
+{
+    return gift128_variant_schedule_size
+        (gift128_variant_for_schedule(schedule));
+}
+
+/**
+ * \brief Sets up the key schedule for GIFT-COFB with a specific variant.
+ *
+ * \param ctx Points to the GIFT-128 key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ */
+static void gift_cofb_setup_key_schedule
+    (void *ctx, const unsigned char *k, unsigned schedule)
+{
+    gift128b_variant_init
+        ((gift128_variant_key_schedule_t *)ctx, k,
+         gift128_variant_for_schedule(schedule));
+}
+
+int gift_cofb_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128b_variant_init(&ks, k, GIFT128_VARIANT);
+    return gift_cofb_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int gift_cofb_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128b_variant_init(&ks, k, GIFT128_VARIANT);
+    return gift_cofb_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+/**
+ * \brief Absorbs a plaintext block P into the GIFT-COFB state.
+ *
+ * \param ks The GIFT-128 key schedule to use.
+ * \param Y GIFT-COFB internal state.
+ * \param L GIFT-COFB internal state.
+ * \param P The padded plaintext block.
+ * \param len Length of the block before padding.
+ * \param last Non-zero if this is the last block of plaintext.
+ */
+static void gift_cofb_absorb_block
+    (const gift128_variant_key_schedule_t *ks,
+     gift_cofb_block_t *Y, gift_cofb_l_t *L,
+     const gift_cofb_block_t *P, unsigned len, int last)
+{
+    if (!last) {
+        gift_cofb_double_L(L);
+        gift_cofb_feedback(Y);
+        Y->x[0] ^= L->x ^ P->x[0];
+        Y->x[1] ^= L->y ^ P->x[1];
+        Y->x[2] ^= P->x[2];
+        Y->x[3] ^= P->x[3];
+    } else {
+        gift_cofb_feedback(Y);
+        Y->x[0] ^= P->x[0];
+        Y->x[1] ^= P->x[1];
+        Y->x[2] ^= P->x[2];
+        Y->x[3] ^= P->x[3];
+        gift_cofb_triple_L(L);
+        if (len < 16)
+            gift_cofb_triple_L(L);
+        Y->x[0] ^= L->x;
+        Y->x[1] ^= L->y;
+    }
+    gift128b_variant_encrypt_preloaded(ks, Y->x, Y->x);
+}
+
+int gift_cofb_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift_cofb_block_t Y;
+    gift_cofb_l_t L;
+    gift_cofb_block_t P;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+    (void)nsec;
+
+    /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + GIFT_COFB_TAG_SIZE))
+        return -2;
+    *clen = mlen + GIFT_COFB_TAG_SIZE;
+
+    /* Encrypt the nonce to initialize the state */
+    gift128b_variant_init(&ks, k, GIFT128_VARIANT);
+    Y.x[0] = be_load_word32(npub);
+    Y.x[1] = be_load_word32(npub + 4);
+    Y.x[2] = be_load_word32(npub + 8);
+    Y.x[3] = be_load_word32(npub + 12);
+    gift128b_variant_encrypt_preloaded(&ks, Y.x, Y.x);
+    L.x = Y.x[0];
+    L.y = Y.x[1];
+
+    /* Authenticate the associated data */
+    gift_cofb_assoc_data_vec
+        (&ks, &Y, &L, ad, ad_count, aead_iovec_length(ad, ad_count), mlen);
+
+    /* Encrypt the plaintext to produce the ciphertext, one block at a
+     * time.  Blocks that straddle segment boundaries are gathered into
+     * or scattered from a temporary buffer */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    while (mlen > 0) {
+        temp = mlen > 16 ? 16 : (unsigned)mlen;
+        in = aead_iovec_load_block(&mcur, inbuf, temp);
+        if (temp == 16) {
+            P.x[0] = be_load_word32(in);
+            P.x[1] = be_load_word32(in + 4);
+            P.x[2] = be_load_word32(in + 8);
+            P.x[3] = be_load_word32(in + 12);
+        } else {
+            unsigned char padded[16];
+            memcpy(padded, in, temp);
+            padded[temp] = 0x80;
+            memset(padded + temp + 1, 0, 16 - temp - 1);
+            P.x[0] = be_load_word32(padded);
+            P.x[1] = be_load_word32(padded + 4);
+            P.x[2] = be_load_word32(padded + 8);
+            P.x[3] = be_load_word32(padded + 12);
+        }
+        out = aead_iovec_store_begin(&ccur, outbuf, temp);
+        if (temp == 16) {
+            be_store_word32(out,      Y.x[0] ^ P.x[0]);
+            be_store_word32(out + 4,  Y.x[1] ^ P.x[1]);
+            be_store_word32(out + 8,  Y.x[2] ^ P.x[2]);
+            be_store_word32(out + 12, Y.x[3] ^ P.x[3]);
+        } else {
+            unsigned char padded[16];
+            be_store_word32(padded,      Y.x[0] ^ P.x[0]);
+            be_store_word32(padded + 4,  Y.x[1] ^ P.x[1]);
+            be_store_word32(padded + 8,  Y.x[2] ^ P.x[2]);
+            be_store_word32(padded + 12, Y.x[3] ^ P.x[3]);
+            memcpy(out, padded, temp);
+        }
+        aead_iovec_store_end(&ccur, outbuf, out, temp);
+        mlen -= temp;
+        gift_cofb_absorb_block(&ks, &Y, &L, &P, temp, mlen == 0);
+    }
+
+    /* Generate the final authentication tag */
+    be_store_word32(outbuf,      Y.x[0]);
+    be_store_word32(outbuf + 4,  Y.x[1]);
+    be_store_word32(outbuf + 8,  Y.x[2]);
+    be_store_word32(outbuf + 12, Y.x[3]);
+    aead_iovec_write(&ccur, outbuf, GIFT_COFB_TAG_SIZE);
+    return 0;
+}
+
+int gift_cofb_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift_cofb_block_t Y;
+    gift_cofb_l_t L;
+    gift_cofb_block_t P;
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+    (void)nsec;
+
+    /* Validate the ciphertext length and set the return "mlen" value */
+    if (clen < GIFT_COFB_TAG_SIZE)
+        return -1;
+    *mlen = clen - GIFT_COFB_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+
+    /* Encrypt the nonce to initialize the state */
+    gift128b_variant_init(&ks, k, GIFT128_VARIANT);
+    Y.x[0] = be_load_word32(npub);
+    Y.x[1] = be_load_word32(npub + 4);
+    Y.x[2] = be_load_word32(npub + 8);
+    Y.x[3] = be_load_word32(npub + 12);
+    gift128b_variant_encrypt_preloaded(&ks, Y.x, Y.x);
+    L.x = Y.x[0];
+    L.y = Y.x[1];
+
+    /* Authenticate the associated data */
+    gift_cofb_assoc_data_vec
+        (&ks, &Y, &L, ad, ad_count, aead_iovec_length(ad, ad_count), *mlen);
+
+    /* Decrypt the ciphertext to produce the plaintext */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    clen -= GIFT_COFB_TAG_SIZE;
+    while (clen > 0) {
+        temp = clen > 16 ? 16 : (unsigned)clen;
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
+        if (temp == 16) {
+            P.x[0] = Y.x[0] ^ be_load_word32(in);
+            P.x[1] = Y.x[1] ^ be_load_word32(in + 4);
+            P.x[2] = Y.x[2] ^ be_load_word32(in + 8);
+            P.x[3] = Y.x[3] ^ be_load_word32(in + 12);
+            be_store_word32(out,      P.x[0]);
+            be_store_word32(out + 4,  P.x[1]);
+            be_store_word32(out + 8,  P.x[2]);
+            be_store_word32(out + 12, P.x[3]);
+        } else {
+            unsigned char padded[16];
+            be_store_word32(padded,      Y.x[0]);
+            be_store_word32(padded + 4,  Y.x[1]);
+            be_store_word32(padded + 8,  Y.x[2]);
+            be_store_word32(padded + 12, Y.x[3]);
+            lw_xor_block_2_dest(out, padded, in, temp);
+            padded[temp] = 0x80;
+            memset(padded + temp + 1, 0, 16 - temp - 1);
+            P.x[0] = be_load_word32(padded);
+            P.x[1] = be_load_word32(padded + 4);
+            P.x[2] = be_load_word32(padded + 8);
+            P.x[3] = be_load_word32(padded + 12);
+        }
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
+        clen -= temp;
+        gift_cofb_absorb_block(&ks, &Y, &L, &P, temp, clen == 0);
+    }
+
+    /* Check the authentication tag at the end of the packet */
+    aead_iovec_read(&ccur, inbuf, GIFT_COFB_TAG_SIZE);
+    be_store_word32(outbuf,      Y.x[0]);
+    be_store_word32(outbuf + 4,  Y.x[1]);
+    be_store_word32(outbuf + 8,  Y.x[2]);
+    be_store_word32(outbuf + 12, Y.x[3]);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, outbuf, inbuf, GIFT_COFB_TAG_SIZE);
+}
+
+aead_cipher_t const gift_cofb_cipher = {
+    "GIFT-COFB",
+    GIFT_COFB_KEY_SIZE,
+    GIFT_COFB_NONCE_SIZE,
+    GIFT_COFB_TAG_SIZE,
+    AEAD_FLAG_NONE,
+    gift_cofb_aead_encrypt,
+    gift_cofb_aead_decrypt,
+    sizeof(gift128_variant_key_schedule_t),
+    gift_cofb_setup_key,
+    gift_cofb_aead_encrypt_ctx,
+    gift_cofb_aead_decrypt_ctx,
+    gift_cofb_aead_encrypt_vec,
+    gift_cofb_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    gift_cofb_schedule_size,
+    gift_cofb_setup_key_schedule
+};
@@ -20,9 +20,57 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+/* The other variants of GIFT-128 are built by including this file from
+ * "internal-gift128-full.c" and friends with GIFT128_VARIANT_SUFFIX set.
+ * Rename the entry points so that they do not clash with the default. */
+#if defined(GIFT128_VARIANT_SUFFIX)
+#define GIFT128_CONCAT_INNER(name,suffix) name##suffix
+#define GIFT128_CONCAT(name,suffix) GIFT128_CONCAT_INNER(name,suffix)
+#define GIFT128_RENAME(name) GIFT128_CONCAT(name,GIFT128_VARIANT_SUFFIX)
+#define gift128b_init GIFT128_RENAME(gift128b_init)
+#define gift128b_encrypt GIFT128_RENAME(gift128b_encrypt)
+#define gift128b_encrypt_preloaded GIFT128_RENAME(gift128b_encrypt_preloaded)
+#define gift128b_decrypt GIFT128_RENAME(gift128b_decrypt)
+#define gift128n_init GIFT128_RENAME(gift128n_init)
+#define gift128n_encrypt GIFT128_RENAME(gift128n_encrypt)
+#define gift128n_decrypt GIFT128_RENAME(gift128n_decrypt)
+#define gift128t_encrypt GIFT128_RENAME(gift128t_encrypt)
+#define gift128t_decrypt GIFT128_RENAME(gift128t_decrypt)
+#define gift128_variant_table GIFT128_RENAME(gift128_variant)
+#endif
+
 #include "internal-gift128.h"
 #include "internal-util.h"
 
+/* Name of the table of entry points for the default variant */
+#if !defined(GIFT128_VARIANT_SUFFIX)
+#if GIFT128_VARIANT == GIFT128_VARIANT_FULL
+#define gift128_variant_table gift128_variant_full
+#elif GIFT128_VARIANT == GIFT128_VARIANT_SMALL
+#define gift128_variant_table gift128_variant_small
+#else
+#define gift128_variant_table gift128_variant_tiny
+#endif
+#endif
+
+#if !defined(GIFT128_VARIANT_SUFFIX)
+
+int gift128_variant_for_schedule(unsigned schedule)
+{
+    switch (schedule) {
+    case AEAD_SCHEDULE_FULL:
+        return GIFT128_VARIANT_FULL;
+    case AEAD_SCHEDULE_SMALL:
+        return GIFT128_VARIANT_SMALL;
+    case AEAD_SCHEDULE_TINY:
+        return GIFT128_VARIANT_TINY;
+    default:
+        return GIFT128_VARIANT;
+    }
+}
+
+#endif
+
 #if !GIFT128_VARIANT_ASM
 
 #if GIFT128_VARIANT != GIFT128_VARIANT_TINY
@@ -258,12 +306,22 @@ static void gift128n_to_nibbles
     le_store_word32(output,      s3);
 }
 
+/* Uncounted block operations for the bit-sliced representation so that
+ * the nibble-based entry points below only count each block once */
+static void gift128b_encrypt_block
+    (const gift128b_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+static void gift128b_decrypt_block
+    (const gift128b_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
 void gift128n_encrypt
     (const gift128n_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT128N_ENCRYPT);
     gift128n_to_words(output, input);
-    gift128b_encrypt(ks, output, output);
+    gift128b_encrypt_block(ks, output, output);
     gift128n_to_nibbles(output, output);
 }
 
@@ -271,8 +329,9 @@ void gift128n_decrypt
     (const gift128n_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT128N_DECRYPT);
     gift128n_to_words(output, input);
-    gift128b_decrypt(ks, output, output);
+    gift128b_decrypt_block(ks, output, output);
     gift128n_to_nibbles(output, output);
 }
 
@@ -456,6 +515,7 @@ static void gift128b_compute_round_keys
 
 void gift128b_init(gift128b_key_schedule_t *ks, const unsigned char *key)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_INIT);
     gift128b_compute_round_keys
         (ks, be_load_word32(key), be_load_word32(key + 4),
              be_load_word32(key + 8), be_load_word32(key + 12));
@@ -463,6 +523,7 @@ void gift128b_init(gift128b_key_schedule_t *ks, const unsigned char *key)
 
 void gift128n_init(gift128n_key_schedule_t *ks, const unsigned char *key)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT128N_INIT);
     /* Use the little-endian key byte order from the HYENA submission */
     gift128b_compute_round_keys
         (ks, le_load_word32(key + 12), le_load_word32(key + 8),
@@ -775,6 +836,7 @@ void gift128n_init(gift128n_key_schedule_t *ks, const unsigned char *key)
 
 void gift128b_init(gift128b_key_schedule_t *ks, const unsigned char *key)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_INIT);
     /* Mirror the fixslicing word order of 3, 1, 2, 0 */
     ks->k[0] = be_load_word32(key + 12);
     ks->k[1] = be_load_word32(key + 4);
@@ -784,6 +846,7 @@ void gift128b_init(gift128b_key_schedule_t *ks, const unsigned char *key)
 
 void gift128n_init(gift128n_key_schedule_t *ks, const unsigned char *key)
 {
+    aead_count_call(AEAD_PRIMITIVE_GIFT128N_INIT);
     /* Use the little-endian key byte order from the HYENA submission
      * and mirror the fixslicing word order of 3, 1, 2, 0 */
     ks->k[0] = le_load_word32(key);
@@ -796,7 +859,7 @@ void gift128n_init(gift128n_key_schedule_t *ks, const unsigned char *key)
 
 #if GIFT128_VARIANT == GIFT128_VARIANT_SMALL
 
-void gift128b_encrypt
+static void gift128b_encrypt_block
     (const gift128b_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
@@ -839,6 +902,8 @@ void gift128b_encrypt_preloaded
     uint32_t s0, s1, s2, s3;
     uint32_t k[20];
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_ENCRYPT_PRELOADED);
+
     /* Copy the plaintext into local variables */
     s0 = input[0];
     s1 = input[1];
@@ -875,6 +940,8 @@ void gift128t_encrypt
     uint32_t s0, s1, s2, s3;
     uint32_t k[20];
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128T_ENCRYPT);
+
     /* Copy the plaintext into the state buffer and convert from nibbles */
     gift128n_to_words(output, input);
     s0 = be_load_word32(output);
@@ -916,7 +983,7 @@ void gift128t_encrypt
 
 #elif GIFT128_VARIANT == GIFT128_VARIANT_FULL
 
-void gift128b_encrypt
+static void gift128b_encrypt_block
     (const gift128b_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
@@ -951,6 +1018,8 @@ void gift128b_encrypt_preloaded
 {
     uint32_t s0, s1, s2, s3;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_ENCRYPT_PRELOADED);
+
     /* Copy the plaintext into local variables */
     s0 = input[0];
     s1 = input[1];
@@ -980,6 +1049,8 @@ void gift128t_encrypt
 {
     uint32_t s0, s1, s2, s3;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128T_ENCRYPT);
+
     /* Copy the plaintext into the state buffer and convert from nibbles */
     gift128n_to_words(output, input);
     s0 = be_load_word32(output);
@@ -1015,7 +1086,7 @@ void gift128t_encrypt
 
 #else /* GIFT128_VARIANT_TINY */
 
-void gift128b_encrypt
+static void gift128b_encrypt_block
     (const gift128b_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
@@ -1086,6 +1157,8 @@ void gift128b_encrypt_preloaded
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_ENCRYPT_PRELOADED);
+
     /* Copy the plaintext into the state buffer */
     s0 = input[0];
     s1 = input[1];
@@ -1148,6 +1221,8 @@ void gift128t_encrypt
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128T_ENCRYPT);
+
     /* Copy the plaintext into the state buffer and convert from nibbles */
     gift128n_to_words(output, input);
     s0 = be_load_word32(output);
@@ -1211,7 +1286,7 @@ void gift128t_encrypt
 
 #if GIFT128_VARIANT == GIFT128_VARIANT_FULL
 
-void gift128b_decrypt
+static void gift128b_decrypt_block
     (const gift128b_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
@@ -1246,6 +1321,8 @@ void gift128t_decrypt
 {
     uint32_t s0, s1, s2, s3;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128T_DECRYPT);
+
     /* Copy the ciphertext into the state buffer and convert from nibbles */
     gift128n_to_words(output, input);
     s0 = be_load_word32(output);
@@ -1369,7 +1446,7 @@ void gift128t_decrypt
     } while (0)
 #endif
 
-void gift128b_decrypt
+static void gift128b_decrypt_block
     (const gift128b_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
@@ -1437,6 +1514,8 @@ void gift128t_decrypt
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_GIFT128T_DECRYPT);
+
     /* Copy the plaintext into the state buffer and convert from nibbles */
     gift128n_to_words(output, input);
     s0 = be_load_word32(output);
@@ -1495,4 +1574,154 @@ void gift128t_decrypt
 
 #endif /* GIFT128_VARIANT_SMALL || GIFT128_VARIANT_TINY */
 
+void gift128b_encrypt
+    (const gift128b_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_ENCRYPT);
+    gift128b_encrypt_block(ks, output, input);
+}
+
+void gift128b_decrypt
+    (const gift128b_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    aead_count_call(AEAD_PRIMITIVE_GIFT128B_DECRYPT);
+    gift128b_decrypt_block(ks, output, input);
+}
+
+/* Wrappers that give the entry points for this variant the generic
+ * signatures from gift128_variant_t */
+
+static void gift128_variant_init_b(void *ks, const unsigned char *key)
+{
+    gift128b_init((gift128b_key_schedule_t *)ks, key);
+}
+
+static void gift128_variant_init_n(void *ks, const unsigned char *key)
+{
+    gift128n_init((gift128n_key_schedule_t *)ks, key);
+}
+
+static void gift128_variant_encrypt_b
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    gift128b_encrypt((const gift128b_key_schedule_t *)ks, output, input);
+}
+
+static void gift128_variant_encrypt_preloaded
+    (const void *ks, uint32_t output[4], const uint32_t input[4])
+{
+    gift128b_encrypt_preloaded
+        ((const gift128b_key_schedule_t *)ks, output, input);
+}
+
+static void gift128_variant_decrypt_b
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    gift128b_decrypt((const gift128b_key_schedule_t *)ks, output, input);
+}
+
+static void gift128_variant_encrypt_n
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    gift128n_encrypt((const gift128n_key_schedule_t *)ks, output, input);
+}
+
+static void gift128_variant_decrypt_n
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    gift128n_decrypt((const gift128n_key_schedule_t *)ks, output, input);
+}
+
+const gift128_variant_t gift128_variant_table = {
+    GIFT128_VARIANT,
+    sizeof(gift128b_key_schedule_t),
+    gift128_variant_init_b,
+    gift128_variant_init_n,
+    gift128_variant_encrypt_b,
+    gift128_variant_encrypt_preloaded,
+    gift128_variant_decrypt_b,
+    gift128_variant_encrypt_n,
+    gift128_variant_decrypt_n
+};
+
+#if !defined(GIFT128_VARIANT_SUFFIX)
+
+/* Tables for the variants that are built by the other source files */
+extern const gift128_variant_t gift128_variant_full;
+extern const gift128_variant_t gift128_variant_small;
+extern const gift128_variant_t gift128_variant_tiny;
+
+const gift128_variant_t *gift128_get_variant(int variant)
+{
+    if (variant == GIFT128_VARIANT_FULL)
+        return &gift128_variant_full;
+    else if (variant == GIFT128_VARIANT_SMALL)
+        return &gift128_variant_small;
+    else if (variant == GIFT128_VARIANT_TINY)
+        return &gift128_variant_tiny;
+    else
+        return &gift128_variant_table;
+}
+
+size_t gift128_variant_schedule_size(int variant)
+{
+    const gift128_variant_t *v = gift128_get_variant(variant);
+    return offsetof(gift128_variant_key_schedule_t, k) + v->schedule_size;
+}
+
+void gift128b_variant_init
+    (gift128_variant_key_schedule_t *ks, const unsigned char *key,
+     int variant)
+{
+    ks->variant = gift128_get_variant(variant);
+    ks->variant->init_b(ks->k, key);
+}
+
+void gift128b_variant_encrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->encrypt_b(ks->k, output, input);
+}
+
+void gift128b_variant_encrypt_preloaded
+    (const gift128_variant_key_schedule_t *ks, uint32_t output[4],
+     const uint32_t input[4])
+{
+    ks->variant->encrypt_preloaded(ks->k, output, input);
+}
+
+void gift128b_variant_decrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->decrypt_b(ks->k, output, input);
+}
+
+void gift128n_variant_init
+    (gift128_variant_key_schedule_t *ks, const unsigned char *key,
+     int variant)
+{
+    ks->variant = gift128_get_variant(variant);
+    ks->variant->init_n(ks->k, key);
+}
+
+void gift128n_variant_encrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->encrypt_n(ks->k, output, input);
+}
+
+void gift128n_variant_decrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->decrypt_n(ks->k, output, input);
+}
+
+#endif /* !GIFT128_VARIANT_SUFFIX */
+
 #endif /* !GIFT128_VARIANT_ASM */
@@ -21,6 +21,14 @@
  */
 
 #include "aead-common.h"
+#include "internal-iovec.h"
+#include <string.h>
+
+/**
+ * \brief Maximum tag length for aead_incremental_encrypt_vec() and
+ * aead_incremental_decrypt_vec().
+ */
+#define AEAD_INCREMENTAL_MAX_TAG_LEN 32
 
 int aead_check_tag
     (unsigned char *plaintext, unsigned long long plaintext_len,
@@ -67,3 +75,808 @@ int aead_check_tag_precheck
     /* If "accum" is 0, return -1, otherwise return 0 */
     return ~accum;
 }
+
+int aead_check_tag_vec
+    (const aead_iovec_t *plaintext, size_t count,
+     unsigned long long plaintext_len,
+     const unsigned char *tag1, const unsigned char *tag2,
+     unsigned size)
+{
+    return aead_check_tag_precheck_vec
+        (plaintext, count, plaintext_len, tag1, tag2, size, -1);
+}
+
+int aead_check_tag_precheck_vec
+    (const aead_iovec_t *plaintext, size_t count,
+     unsigned long long plaintext_len,
+     const unsigned char *tag1, const unsigned char *tag2,
+     unsigned size, int precheck)
+{
+    /* Set "accum" to -1 if the tags match, or 0 if they don't match */
+    int accum = 0;
+    while (size > 0) {
+        accum |= (*tag1++ ^ *tag2++);
+        --size;
+    }
+    accum = ((accum - 1) >> 8) & precheck;
+
+    /* Destroy the plaintext segments if the tag match failed */
+    while (plaintext_len > 0 && count > 0) {
+        unsigned char *data = plaintext->data;
+        size_t len = plaintext->len;
+        if (len > plaintext_len)
+            len = (size_t)plaintext_len;
+        plaintext_len -= len;
+        while (len > 0) {
+            *data++ &= accum;
+            --len;
+        }
+        ++plaintext;
+        --count;
+    }
+
+    /* If "accum" is 0, return -1, otherwise return 0 */
+    return ~accum;
+}
+
+unsigned long long aead_iovec_length(const aead_iovec_t *vec, size_t count)
+{
+    unsigned long long len = 0;
+    while (count > 0) {
+        len += vec->len;
+        ++vec;
+        --count;
+    }
+    return len;
+}
+
+/**
+ * \brief Gets a contiguous view of the data in scatter/gather segments.
+ *
+ * \param vec Points to the array of segments.
+ * \param count Number of segments in \a vec.
+ * \param len Number of bytes that are needed.
+ * \param buf Points to the fixed-size gather buffer.
+ * \param used Number of bytes of \a buf that are already in use,
+ * which is updated if space is taken from \a buf.
+ * \param gather Non-zero to copy the segment data into \a buf if it is
+ * used, or zero if the space is for output that will be scattered later.
+ *
+ * \return A pointer directly into the first segment if it can hold all
+ * \a len bytes, a pointer into \a buf otherwise, or NULL if there is not
+ * enough space left in \a buf.
+ */
+static unsigned char *aead_iovec_flatten
+    (const aead_iovec_t *vec, size_t count, unsigned long long len,
+     unsigned char *buf, size_t *used, int gather)
+{
+    aead_iovec_cursor_t cursor;
+    unsigned char *out;
+    if (len == 0)
+        return buf;
+    aead_iovec_start(&cursor, vec, count);
+    if (cursor.count > 0 && cursor.vec->len >= len)
+        return cursor.vec->data;
+    if (len > (AEAD_VEC_BUFFER_SIZE - *used))
+        return 0;
+    out = buf + *used;
+    if (gather)
+        aead_iovec_read(&cursor, out, (size_t)len);
+    *used += (size_t)len;
+    return out;
+}
+
+/**
+ * \brief Destroys the leading bytes of scatter/gather segments.
+ *
+ * \param vec Points to the array of segments.
+ * \param count Number of segments in \a vec.
+ * \param len Number of bytes to destroy.
+ */
+static void aead_iovec_clear
+    (const aead_iovec_t *vec, size_t count, unsigned long long len)
+{
+    while (len > 0 && count > 0) {
+        size_t temp = vec->len;
+        if (temp > len)
+            temp = (size_t)len;
+        memset(vec->data, 0, temp);
+        len -= temp;
+        ++vec;
+        --count;
+    }
+}
+
+int aead_cipher_encrypt_vec
+    (const aead_cipher_t *cipher,
+     const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    unsigned char buf[AEAD_VEC_BUFFER_SIZE];
+    unsigned long long mlen, adlen, ctotal;
+    unsigned char *mptr, *adptr, *cptr;
+    aead_iovec_cursor_t cursor;
+    size_t used = 0;
+    size_t cposn;
+    int result;
+
+    /* Use the native scatter/gather implementation if there is one */
+    if (cipher->encrypt_vec) {
+        return (*(cipher->encrypt_vec))
+            (c, c_count, clen, m, m_count, ad, ad_count, nsec, npub, k);
+    }
+
+    /* Pass contiguous segments directly to the cipher and gather the
+     * fragmented ones into a fixed-size buffer on the stack */
+    mlen = aead_iovec_length(m, m_count);
+    adlen = aead_iovec_length(ad, ad_count);
+    ctotal = aead_iovec_length(c, c_count);
+    mptr = aead_iovec_flatten(m, m_count, mlen, buf, &used, 1);
+    adptr = aead_iovec_flatten(ad, ad_count, adlen, buf, &used, 1);
+    cposn = used;
+    cptr = aead_iovec_flatten
+        (c, c_count, mlen + cipher->tag_len, buf, &used, 0);
+    if (mptr && adptr && cptr) {
+        result = (*(cipher->encrypt))
+            (cptr, clen, mptr, mlen, adptr, adlen, nsec, npub, k);
+        if (result == 0 && *clen > ctotal) {
+            result = -2;
+        } else if (result == 0 && used != cposn) {
+            aead_iovec_start(&cursor, c, c_count);
+            aead_iovec_write(&cursor, cptr, (size_t)(*clen));
+        }
+    } else {
+        result = -2;
+    }
+    memset(buf, 0, used);
+    return result;
+}
+
+int aead_cipher_decrypt_vec
+    (const aead_cipher_t *cipher,
+     const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    unsigned char buf[AEAD_VEC_BUFFER_SIZE];
+    unsigned long long clen, adlen, mtotal;
+    unsigned char *mptr, *adptr, *cptr;
+    aead_iovec_cursor_t cursor;
+    size_t used = 0;
+    size_t mposn;
+    int result;
+
+    /* Use the native scatter/gather implementation if there is one */
+    if (cipher->decrypt_vec) {
+        return (*(cipher->decrypt_vec))
+            (m, m_count, mlen, nsec, c, c_count, ad, ad_count, npub, k);
+    }
+
+    /* Pass contiguous segments directly to the cipher and gather the
+     * fragmented ones into a fixed-size buffer on the stack.  The space
+     * for the plaintext is as long as the ciphertext because some schemes
+     * write padding beyond the end of the plaintext */
+    clen = aead_iovec_length(c, c_count);
+    adlen = aead_iovec_length(ad, ad_count);
+    mtotal = aead_iovec_length(m, m_count);
+    if (clen >= cipher->tag_len && mtotal < (clen - cipher->tag_len))
+        return -2;
+    cptr = aead_iovec_flatten(c, c_count, clen, buf, &used, 1);
+    adptr = aead_iovec_flatten(ad, ad_count, adlen, buf, &used, 1);
+    mposn = used;
+    mptr = aead_iovec_flatten(m, m_count, clen, buf, &used, 0);
+    if (mptr && adptr && cptr) {
+        result = (*(cipher->decrypt))
+            (mptr, mlen, nsec, cptr, clen, adptr, adlen, npub, k);
+        if (result == 0 && *mlen > mtotal) {
+            result = -2;
+        } else if (result == 0 && used != mposn) {
+            aead_iovec_start(&cursor, m, m_count);
+            aead_iovec_write(&cursor, mptr, (size_t)(*mlen));
+        } else if (result != 0) {
+            aead_iovec_clear(m, m_count, mtotal);
+        }
+    } else {
+        result = -2;
+    }
+    memset(buf, 0, used);
+    return result;
+}
+
+int aead_incremental_encrypt_vec
+    (const aead_cipher_incremental_t *inc, void *state, unsigned tag_len,
+     const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned char tag[AEAD_INCREMENTAL_MAX_TAG_LEN];
+    size_t len;
+
+    /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + tag_len))
+        return -2;
+    *clen = mlen + tag_len;
+
+    /* Initialize the state and absorb the associated data segments */
+    (*(inc->init))(state, npub, k);
+    while (ad_count > 0) {
+        if (ad->len > 0)
+            (*(inc->update_ad))(state, ad->data, ad->len);
+        ++ad;
+        --ad_count;
+    }
+
+    /* Encrypt the largest chunks that are contiguous on both sides */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    while (mlen > 0) {
+        len = aead_iovec_chunk(&ccur, aead_iovec_chunk(&mcur, SIZE_MAX));
+        (*(inc->encrypt_update))
+            (state, aead_iovec_ptr(&ccur), aead_iovec_ptr(&mcur), len);
+        aead_iovec_advance(&ccur, len);
+        aead_iovec_advance(&mcur, len);
+        mlen -= len;
+    }
+
+    /* Generate the authentication tag */
+    (*(inc->encrypt_final))(state, tag);
+    aead_iovec_write(&ccur, tag, tag_len);
+    return 0;
+}
+
+int aead_incremental_decrypt_vec
+    (const aead_cipher_incremental_t *inc, void *state, unsigned tag_len,
+     const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_cursor_t ccur, mcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long remaining;
+    unsigned char tag[AEAD_INCREMENTAL_MAX_TAG_LEN];
+    size_t len;
+    int result;
+
+    /* Set the length of the returned plaintext */
+    if (clen < tag_len)
+        return -1;
+    *mlen = clen - tag_len;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+
+    /* Initialize the state and absorb the associated data segments */
+    (*(inc->init))(state, npub, k);
+    while (ad_count > 0) {
+        if (ad->len > 0)
+            (*(inc->update_ad))(state, ad->data, ad->len);
+        ++ad;
+        --ad_count;
+    }
+
+    /* Decrypt the largest chunks that are contiguous on both sides */
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    remaining = *mlen;
+    while (remaining > 0) {
+        len = aead_iovec_chunk(&mcur, aead_iovec_chunk(&ccur, SIZE_MAX));
+        if (len > remaining)
+            len = (size_t)remaining;
+        (*(inc->decrypt_update))
+            (state, aead_iovec_ptr(&mcur), aead_iovec_ptr(&ccur), len);
+        aead_iovec_advance(&ccur, len);
+        aead_iovec_advance(&mcur, len);
+        remaining -= len;
+    }
+
+    /* Check the authentication tag and destroy the plaintext if it failed */
+    aead_iovec_read(&ccur, tag, tag_len);
+    result = (*(inc->decrypt_final))(state, tag);
+    if (result != 0)
+        aead_iovec_clear(m, m_count, *mlen);
+    return result;
+}
+
+int aead_cipher_encrypt_detached
+    (const aead_cipher_t *cipher, unsigned char *c, unsigned char *tag,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec[2];
+    aead_iovec_t mvec;
+    aead_iovec_t advec;
+    unsigned long long clen;
+    if (cipher->flags & AEAD_FLAG_NO_DETACHED_TAG)
+        return -2;
+
+    /* Ciphers with native scatter/gather support write the ciphertext
+     * and the tag straight into the caller's buffers */
+    if (cipher->encrypt_vec) {
+        aead_iovec_set(&cvec[0], c, mlen);
+        aead_iovec_set(&cvec[1], tag, cipher->tag_len);
+        aead_iovec_set(&mvec, m, mlen);
+        aead_iovec_set(&advec, ad, adlen);
+        return (*(cipher->encrypt_vec))
+            (cvec, 2, &clen, &mvec, 1, &advec, 1, nsec, npub, k);
+    }
+
+    /* One-shot ciphers can only write the tag where it follows the
+     * ciphertext; there is nowhere else to put it */
+    if (tag != c + mlen)
+        return -2;
+    return (*(cipher->encrypt))(c, &clen, m, mlen, ad, adlen, nsec, npub, k);
+}
+
+int aead_cipher_decrypt_detached
+    (const aead_cipher_t *cipher, unsigned char *m, unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *tag,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec[2];
+    aead_iovec_t mvec;
+    aead_iovec_t advec;
+    unsigned long long mlen;
+    if (cipher->flags & AEAD_FLAG_NO_DETACHED_TAG)
+        return -2;
+
+    /* Ciphers with native scatter/gather support read the ciphertext
+     * and the tag straight from the caller's buffers */
+    if (cipher->decrypt_vec) {
+        aead_iovec_set(&cvec[0], c, clen);
+        aead_iovec_set(&cvec[1], tag, cipher->tag_len);
+        aead_iovec_set(&mvec, m, clen);
+        aead_iovec_set(&advec, ad, adlen);
+        return (*(cipher->decrypt_vec))
+            (&mvec, 1, &mlen, nsec, cvec, 2, &advec, 1, npub, k);
+    }
+
+    /* One-shot ciphers can only decrypt in-place with the tag following
+     * the ciphertext.  Some schemes write padding beyond the end of the
+     * plaintext, so a separate plaintext buffer is not safe to use */
+    if (m != c || tag != c + clen)
+        return -2;
+    return (*(cipher->decrypt))
+        (m, &mlen, nsec, c, clen + cipher->tag_len, ad, adlen, npub, k);
+}
+
+size_t aead_cipher_context_size(const aead_cipher_t *cipher)
+{
+    if (cipher->setup_key)
+        return cipher->context_size;
+    else
+        return cipher->key_len;
+}
+
+void aead_cipher_setup_key
+    (const aead_cipher_t *cipher, void *ctx, const unsigned char *k)
+{
+    /* Without a native key schedule, the context is a copy of the key */
+    if (cipher->setup_key)
+        (*(cipher->setup_key))(ctx, k);
+    else
+        memcpy(ctx, k, cipher->key_len);
+}
+
+size_t aead_cipher_context_size_schedule
+    (const aead_cipher_t *cipher, unsigned schedule)
+{
+    if (cipher->schedule_size)
+        return (*(cipher->schedule_size))(schedule);
+    else
+        return aead_cipher_context_size(cipher);
+}
+
+void aead_cipher_setup_key_schedule
+    (const aead_cipher_t *cipher, void *ctx, const unsigned char *k,
+     unsigned schedule)
+{
+    if (cipher->setup_key_schedule)
+        (*(cipher->setup_key_schedule))(ctx, k, schedule);
+    else
+        aead_cipher_setup_key(cipher, ctx, k);
+}
+
+int aead_cipher_encrypt_with_context
+    (const aead_cipher_t *cipher,
+     unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    if (cipher->encrypt_ctx) {
+        return (*(cipher->encrypt_ctx))
+            (c, clen, m, mlen, ad, adlen, nsec, npub, ctx);
+    } else {
+        return (*(cipher->encrypt))
+            (c, clen, m, mlen, ad, adlen, nsec, npub,
+             (const unsigned char *)ctx);
+    }
+}
+
+int aead_cipher_decrypt_with_context
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    if (cipher->decrypt_ctx) {
+        return (*(cipher->decrypt_ctx))
+            (m, mlen, nsec, c, clen, ad, adlen, npub, ctx);
+    } else {
+        return (*(cipher->decrypt))
+            (m, mlen, nsec, c, clen, ad, adlen, npub,
+             (const unsigned char *)ctx);
+    }
+}
+
+int aead_cipher_encrypt_batch
+    (const aead_cipher_t *cipher, aead_packet_t *packets, size_t count)
+{
+    int result = 0;
+    if (cipher->encrypt_batch)
+        return (*(cipher->encrypt_batch))(packets, count);
+    for (; count > 0; --count, ++packets) {
+        if (packets->ctx) {
+            packets->result = aead_cipher_encrypt_with_context
+                (cipher, packets->out, &(packets->outlen),
+                 packets->in, packets->inlen, packets->ad, packets->adlen,
+                 0, packets->npub, packets->ctx);
+        } else {
+            packets->result = (*(cipher->encrypt))
+                (packets->out, &(packets->outlen),
+                 packets->in, packets->inlen, packets->ad, packets->adlen,
+                 0, packets->npub, packets->key);
+        }
+        if (packets->result != 0 && result == 0)
+            result = packets->result;
+    }
+    return result;
+}
+
+int aead_cipher_decrypt_batch
+    (const aead_cipher_t *cipher, aead_packet_t *packets, size_t count)
+{
+    int result = 0;
+    if (cipher->decrypt_batch)
+        return (*(cipher->decrypt_batch))(packets, count);
+    for (; count > 0; --count, ++packets) {
+        if (packets->ctx) {
+            packets->result = aead_cipher_decrypt_with_context
+                (cipher, packets->out, &(packets->outlen), 0,
+                 packets->in, packets->inlen, packets->ad, packets->adlen,
+                 packets->npub, packets->ctx);
+        } else {
+            packets->result = (*(cipher->decrypt))
+                (packets->out, &(packets->outlen), 0,
+                 packets->in, packets->inlen, packets->ad, packets->adlen,
+                 packets->npub, packets->key);
+        }
+        if (packets->result != 0 && result == 0)
+            result = packets->result;
+    }
+    return result;
+}
+
+/**
+ * \brief Determine if a cipher can be used with the STREAM layer.
+ *
+ * \param cipher Points to the cipher.
+ *
+ * \return Non-zero if the cipher can be used, or zero if not.
+ */
+static int aead_stream_supported(const aead_cipher_t *cipher)
+{
+    if (cipher->nonce_len < AEAD_STREAM_NONCE_OVERHEAD ||
+            cipher->nonce_len > AEAD_STREAM_MAX_NONCE_LEN)
+        return 0;
+    return (cipher->flags & AEAD_FLAG_NO_DETACHED_TAG) == 0;
+}
+
+int aead_stream_segment_nonce
+    (const aead_cipher_t *cipher, unsigned char *nonce,
+     const unsigned char *prefix, unsigned long long index, int last)
+{
+    unsigned prefix_len;
+    if (!aead_stream_supported(cipher) || index > 0xFFFFFFFFULL)
+        return -2;
+    prefix_len = cipher->nonce_len - AEAD_STREAM_NONCE_OVERHEAD;
+    memcpy(nonce, prefix, prefix_len);
+    nonce[prefix_len]     = (unsigned char)(index >> 24);
+    nonce[prefix_len + 1] = (unsigned char)(index >> 16);
+    nonce[prefix_len + 2] = (unsigned char)(index >> 8);
+    nonce[prefix_len + 3] = (unsigned char)index;
+    nonce[prefix_len + 4] = last ? 0x01 : 0x00;
+    return 0;
+}
+
+unsigned long long aead_stream_ciphertext_length
+    (const aead_cipher_t *cipher, size_t segment_size,
+     unsigned long long mlen)
+{
+    unsigned long long count;
+    if (segment_size == 0)
+        return 0;
+    count = mlen / segment_size;
+    if ((mlen % segment_size) != 0 || mlen == 0)
+        ++count;
+    return mlen + count * cipher->tag_len;
+}
+
+unsigned long long aead_stream_segment_count
+    (const aead_cipher_t *cipher, size_t segment_size,
+     unsigned long long clen)
+{
+    unsigned long long full = segment_size + cipher->tag_len;
+    unsigned long long count;
+    unsigned long long rem;
+    if (segment_size == 0 || clen < cipher->tag_len)
+        return 0;
+    count = clen / full;
+    rem = clen % full;
+    if (rem != 0) {
+        /* The last segment must at least contain a tag */
+        if (rem < cipher->tag_len)
+            return 0;
+        ++count;
+    }
+    return count;
+}
+
+int aead_stream_encrypt_segment
+    (const aead_cipher_t *cipher,
+     unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, unsigned long long index, int last,
+     const void *ctx)
+{
+    unsigned char nonce[AEAD_STREAM_MAX_NONCE_LEN];
+    int result = aead_stream_segment_nonce(cipher, nonce, prefix, index, last);
+    if (result < 0)
+        return result;
+    return aead_cipher_encrypt_with_context
+        (cipher, c, clen, m, mlen, ad, adlen, 0, nonce, ctx);
+}
+
+int aead_stream_decrypt_segment
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, unsigned long long index, int last,
+     const void *ctx)
+{
+    unsigned char nonce[AEAD_STREAM_MAX_NONCE_LEN];
+    int result = aead_stream_segment_nonce(cipher, nonce, prefix, index, last);
+    if (result < 0)
+        return result;
+    return aead_cipher_decrypt_with_context
+        (cipher, m, mlen, 0, c, clen, ad, adlen, nonce, ctx);
+}
+
+int aead_stream_encrypt
+    (const aead_cipher_t *cipher,
+     unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, size_t segment_size,
+     const void *ctx)
+{
+    unsigned long long index = 0;
+    unsigned long long seglen;
+    unsigned long long len;
+    int result;
+    *clen = 0;
+    if (segment_size == 0)
+        return -2;
+    do {
+        /* An empty object is encrypted as a single empty last segment */
+        seglen = mlen;
+        if (seglen > segment_size)
+            seglen = segment_size;
+        result = aead_stream_encrypt_segment
+            (cipher, c, &len, m, seglen, ad, adlen, prefix, index,
+             seglen == mlen, ctx);
+        if (result < 0)
+            return result;
+        c += len;
+        *clen += len;
+        m += seglen;
+        mlen -= seglen;
+        ++index;
+    } while (mlen > 0);
+    return 0;
+}
+
+int aead_stream_decrypt
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, size_t segment_size,
+     const void *ctx)
+{
+    unsigned long long full = segment_size + cipher->tag_len;
+    unsigned long long count;
+    unsigned long long index;
+    unsigned long long seglen;
+    unsigned long long len;
+    unsigned char *mtemp = m;
+    int result;
+    *mlen = 0;
+    if (segment_size == 0)
+        return -2;
+    count = aead_stream_segment_count(cipher, segment_size, clen);
+    if (count == 0)
+        return -1;
+    for (index = 0; index < count; ++index) {
+        seglen = clen;
+        if (seglen > full)
+            seglen = full;
+        result = aead_stream_decrypt_segment
+            (cipher, m, &len, c, seglen, ad, adlen, prefix, index,
+             index == (count - 1), ctx);
+        if (result != 0) {
+            /* Destroy the plaintext of the segments that did verify */
+            memset(mtemp, 0, (size_t)(*mlen));
+            *mlen = 0;
+            return result;
+        }
+        c += seglen;
+        clen -= seglen;
+        m += len;
+        *mlen += len;
+    }
+    return 0;
+}
+
+int aead_stream_decrypt_at
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, size_t segment_size,
+     unsigned long long index, const void *ctx)
+{
+    unsigned long long full = segment_size + cipher->tag_len;
+    unsigned long long count;
+    unsigned long long offset;
+    unsigned long long seglen;
+    *mlen = 0;
+    if (segment_size == 0)
+        return -2;
+    count = aead_stream_segment_count(cipher, segment_size, clen);
+    if (count == 0)
+        return -1;
+    if (index >= count)
+        return -2;
+    offset = index * full;
+    seglen = clen - offset;
+    if (seglen > full)
+        seglen = full;
+    return aead_stream_decrypt_segment
+        (cipher, m, mlen, c + offset, seglen, ad, adlen, prefix, index,
+         index == (count - 1), ctx);
+}
+
+#if AEAD_INSTRUMENT
+
+unsigned long aead_primitive_counts[AEAD_PRIMITIVE_COUNT];
+
+#endif
+
+/* Names of the primitives, in the same order as aead_primitive_t */
+static const char * const aead_primitive_names[AEAD_PRIMITIVE_COUNT] = {
+    "ascon_permute",
+    "ascon_permute rounds",
+    "cham128_128_encrypt",
+    "cham64_128_encrypt",
+    "clyde128_encrypt",
+    "clyde128_decrypt",
+    "drysponge128_g",
+    "drysponge256_g",
+    "forkskinny_128_256",
+    "forkskinny_128_384",
+    "forkskinny_64_192",
+    "gift128b_init",
+    "gift128b_encrypt",
+    "gift128b_encrypt_preloaded",
+    "gift128b_decrypt",
+    "gift128n_init",
+    "gift128n_encrypt",
+    "gift128n_decrypt",
+    "gift128t_encrypt",
+    "gift128t_decrypt",
+    "gift64n_init",
+    "gift64n_encrypt",
+    "gift64n_decrypt",
+    "gift64t_encrypt",
+    "gift64t_decrypt",
+    "gimli24_permute",
+    "grain128_core",
+    "keccakp_200_permute",
+    "keccakp_400_permute",
+    "knot256_permute",
+    "knot384_permute",
+    "knot512_permute",
+    "photon256_permute",
+    "pyjamask_setup_key",
+    "pyjamask_encrypt",
+    "pyjamask_decrypt",
+    "saturnin_setup_key",
+    "saturnin_encrypt_block",
+    "saturnin_decrypt_block",
+    "shadow384",
+    "shadow512",
+    "simp_permute",
+    "skinny_128_256_init",
+    "skinny_128_256_encrypt",
+    "skinny_128_256_decrypt",
+    "skinny_128_384_init",
+    "skinny_128_384_encrypt",
+    "skinny_128_384_decrypt",
+    "sliscp_light_permute",
+    "sparkle",
+    "speck64_128_encrypt",
+    "spongent160_permute",
+    "spongent176_permute",
+    "subterranean_round",
+    "tiny_jambu_permutation",
+    "wage_permute",
+    "xoodoo_permute"
+};
+
+void aead_instrument_reset(void)
+{
+#if AEAD_INSTRUMENT
+    int index;
+    for (index = 0; index < AEAD_PRIMITIVE_COUNT; ++index)
+        aead_primitive_counts[index] = 0;
+#endif
+}
+
+unsigned long aead_instrument_get(aead_primitive_t prim)
+{
+#if AEAD_INSTRUMENT
+    if ((unsigned)prim < AEAD_PRIMITIVE_COUNT)
+        return aead_primitive_counts[prim];
+#else
+    (void)prim;
+#endif
+    return 0;
+}
+
+const char *aead_instrument_name(aead_primitive_t prim)
+{
+    if ((unsigned)prim < AEAD_PRIMITIVE_COUNT)
+        return aead_primitive_names[prim];
+    return 0;
+}
+
+int aead_instrument_enabled(void)
+{
+    return AEAD_INSTRUMENT;
+}
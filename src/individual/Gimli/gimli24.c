@@ -24,6 +24,16 @@
 #include "internal-gimli24.h"
 #include <string.h>
 
+static aead_cipher_incremental_t const gimli24_incremental = {
+    sizeof(gimli24_aead_state_t),
+    (aead_incremental_init_t)gimli24_aead_init,
+    (aead_incremental_ad_t)gimli24_aead_update_ad,
+    (aead_incremental_crypt_t)gimli24_aead_encrypt_update,
+    (aead_incremental_crypt_t)gimli24_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)gimli24_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)gimli24_aead_decrypt_final
+};
+
 aead_cipher_t const gimli24_cipher = {
     "GIMLI-24",
     GIMLI24_KEY_SIZE,
@@ -31,7 +41,18 @@ aead_cipher_t const gimli24_cipher = {
     GIMLI24_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     gimli24_aead_encrypt,
-    gimli24_aead_decrypt
+    gimli24_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    gimli24_aead_encrypt_vec,
+    gimli24_aead_decrypt_vec,
+    &gimli24_incremental,
+    gimli24_aead_encrypt_batch,
+    gimli24_aead_decrypt_batch,
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const gimli24_hash_algorithm = {
@@ -207,6 +228,368 @@ int gimli24_aead_decrypt
         (m, *mlen, state.bytes, c + *mlen, GIMLI24_TAG_SIZE);
 }
 
+/**
+ * \brief Information about one lane of a batched GIMLI-24 operation.
+ */
+typedef struct
+{
+    aead_packet_t *packet;      /**< Packet in this lane, or NULL if idle */
+    unsigned long long mlen;    /**< Length of the plaintext */
+    unsigned long long ad_blocks; /**< Number of associated data blocks */
+    unsigned long long blocks;  /**< Total number of blocks to process */
+    gimli24_state_t state;      /**< GIMLI-24 state for the lane */
+
+} gimli24_batch_lane_t;
+
+/**
+ * \brief Processes one block of associated data or payload for a lane
+ * of a batched GIMLI-24 operation, before the block is permuted.
+ *
+ * \param lane The lane to process.
+ * \param posn Position of the block, counting the associated data
+ * blocks first and then the payload blocks.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ */
+static void gimli24_batch_block
+    (gimli24_batch_lane_t *lane, unsigned long long posn, int encrypt)
+{
+    aead_packet_t *packet = lane->packet;
+    gimli24_state_t *st = &(lane->state);
+    unsigned long long offset;
+    unsigned len;
+    if (posn < lane->ad_blocks) {
+        offset = posn * GIMLI24_BLOCK_SIZE;
+        if ((packet->adlen - offset) >= GIMLI24_BLOCK_SIZE) {
+            lw_xor_block(st->bytes, packet->ad + offset, GIMLI24_BLOCK_SIZE);
+            return;
+        }
+        len = (unsigned)(packet->adlen - offset);
+        lw_xor_block(st->bytes, packet->ad + offset, len);
+    } else {
+        offset = (posn - lane->ad_blocks) * GIMLI24_BLOCK_SIZE;
+        len = GIMLI24_BLOCK_SIZE;
+        if ((lane->mlen - offset) < len)
+            len = (unsigned)(lane->mlen - offset);
+        if (encrypt) {
+            lw_xor_block_2_dest
+                (packet->out + offset, st->bytes, packet->in + offset, len);
+        } else {
+            lw_xor_block_swap
+                (packet->out + offset, st->bytes, packet->in + offset, len);
+        }
+        if (len >= GIMLI24_BLOCK_SIZE)
+            return;
+    }
+    st->bytes[len] ^= 0x01; /* Padding */
+    st->bytes[47] ^= 0x01;
+}
+
+/**
+ * \brief Permutes the active lanes of a batched GIMLI-24 operation.
+ *
+ * \param lanes Points to the two lanes.
+ * \param active0 Non-zero if the first lane is active.
+ * \param active1 Non-zero if the second lane is active.
+ */
+static void gimli24_batch_permute
+    (gimli24_batch_lane_t *lanes, int active0, int active1)
+{
+    if (active0 && active1)
+        gimli24_x2_permute(lanes[0].state.words, lanes[1].state.words);
+    else if (active0)
+        gimli24_permute(lanes[0].state.words);
+    else if (active1)
+        gimli24_permute(lanes[1].state.words);
+}
+
+/**
+ * \brief Encrypts or decrypts up to two packets with GIMLI-24 in lock-step.
+ *
+ * \param packets Points to the packets.
+ * \param count Number of packets, which must be 1 or 2.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ *
+ * \return 0 if every packet succeeded, or the result of the first
+ * packet that failed.
+ */
+static int gimli24_batch_pair
+    (aead_packet_t *packets, unsigned count, int encrypt)
+{
+    gimli24_batch_lane_t lanes[2];
+    gimli24_batch_lane_t *lane;
+    aead_packet_t *packet;
+    const unsigned char *k;
+    unsigned long long posn;
+    unsigned long long max_blocks = 0;
+    unsigned index;
+    int result = 0;
+
+    /* Format the initial states from the nonces and keys.  Ciphertexts
+     * that are too short for a tag leave their lane idle */
+    memset(lanes, 0, sizeof(lanes));
+    for (index = 0; index < count; ++index) {
+        packet = &(packets[index]);
+        lane = &(lanes[index]);
+        if (!encrypt && packet->inlen < GIMLI24_TAG_SIZE) {
+            packet->outlen = 0;
+            packet->result = -1;
+            result = -1;
+            continue;
+        }
+        lane->packet = packet;
+        lane->mlen = encrypt ? packet->inlen
+                             : packet->inlen - GIMLI24_TAG_SIZE;
+        lane->ad_blocks = packet->adlen / GIMLI24_BLOCK_SIZE + 1;
+        lane->blocks = lane->ad_blocks + lane->mlen / GIMLI24_BLOCK_SIZE + 1;
+        if (lane->blocks > max_blocks)
+            max_blocks = lane->blocks;
+        k = packet->ctx ? (const unsigned char *)(packet->ctx) : packet->key;
+        memcpy(lane->state.words, packet->npub, GIMLI24_NONCE_SIZE);
+        memcpy(lane->state.words + 4, k, GIMLI24_KEY_SIZE);
+    }
+    gimli24_batch_permute(lanes, lanes[0].blocks > 0, lanes[1].blocks > 0);
+
+    /* Absorb the associated data and then encrypt or decrypt the payload */
+    for (posn = 0; posn < max_blocks; ++posn) {
+        for (index = 0; index < 2; ++index) {
+            if (posn < lanes[index].blocks)
+                gimli24_batch_block(&(lanes[index]), posn, encrypt);
+        }
+        gimli24_batch_permute
+            (lanes, posn < lanes[0].blocks, posn < lanes[1].blocks);
+    }
+
+    /* Generate or check the authentication tags */
+    for (index = 0; index < count; ++index) {
+        lane = &(lanes[index]);
+        packet = lane->packet;
+        if (!packet)
+            continue;
+        if (encrypt) {
+            memcpy(packet->out + lane->mlen, lane->state.bytes,
+                   GIMLI24_TAG_SIZE);
+            packet->outlen = lane->mlen + GIMLI24_TAG_SIZE;
+            packet->result = 0;
+        } else {
+            packet->outlen = lane->mlen;
+            packet->result = aead_check_tag
+                (packet->out, lane->mlen, lane->state.bytes,
+                 packet->in + lane->mlen, GIMLI24_TAG_SIZE);
+            if (packet->result != 0 && result == 0)
+                result = packet->result;
+        }
+    }
+    return result;
+}
+
+/**
+ * \brief Encrypts or decrypts a batch of packets with GIMLI-24,
+ * two packets at a time.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ *
+ * \return 0 if every packet succeeded, or the result of the first
+ * packet that failed.
+ */
+static int gimli24_batch(aead_packet_t *packets, size_t count, int encrypt)
+{
+    unsigned pair;
+    int result = 0;
+    int pair_result;
+    while (count > 0) {
+        pair = (count > 2) ? 2 : (unsigned)count;
+        pair_result = gimli24_batch_pair(packets, pair, encrypt);
+        if (pair_result != 0 && result == 0)
+            result = pair_result;
+        packets += pair;
+        count -= pair;
+    }
+    return result;
+}
+
+int gimli24_aead_encrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return gimli24_batch(packets, count, 1);
+}
+
+int gimli24_aead_decrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return gimli24_batch(packets, count, 0);
+}
+
+/**
+ * \brief Incremental mode while associated data is being absorbed.
+ */
+#define GIMLI24_AEAD_MODE_AD 0
+
+/**
+ * \brief Incremental mode while the payload is being encrypted or decrypted.
+ */
+#define GIMLI24_AEAD_MODE_PAYLOAD 1
+
+/**
+ * \brief Gets the GIMLI-24 permutation state from an incremental AEAD state.
+ */
+#define gimli24_aead_state(state) ((gimli24_state_t *)((state)->s.state))
+
+/**
+ * \brief Pads the last block of associated data or payload in an
+ * incremental GIMLI-24 state.
+ *
+ * \param state The incremental AEAD state.
+ */
+static void gimli24_aead_pad(gimli24_aead_state_t *state)
+{
+    gimli24_state_t *st = gimli24_aead_state(state);
+    st->bytes[state->s.count] ^= 0x01; /* Padding */
+    st->bytes[47] ^= 0x01;
+    gimli24_permute(st->words);
+    state->s.count = 0;
+}
+
+void gimli24_aead_init
+    (gimli24_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    gimli24_state_t *st = gimli24_aead_state(state);
+    memcpy(st->words, npub, GIMLI24_NONCE_SIZE);
+    memcpy(st->words + 4, k, GIMLI24_KEY_SIZE);
+    gimli24_permute(st->words);
+    state->s.count = 0;
+    state->s.mode = GIMLI24_AEAD_MODE_AD;
+}
+
+void gimli24_aead_update_ad
+    (gimli24_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen)
+{
+    gimli24_state_t *st = gimli24_aead_state(state);
+    unsigned temp;
+    while (adlen > 0) {
+        temp = GIMLI24_BLOCK_SIZE - state->s.count;
+        if (temp > adlen)
+            temp = (unsigned)adlen;
+        lw_xor_block(st->bytes + state->s.count, ad, temp);
+        state->s.count += temp;
+        ad += temp;
+        adlen -= temp;
+        if (state->s.count >= GIMLI24_BLOCK_SIZE) {
+            gimli24_permute(st->words);
+            state->s.count = 0;
+        }
+    }
+}
+
+/**
+ * \brief Pads the associated data and switches an incremental GIMLI-24
+ * state into payload mode if it is not in payload mode already.
+ *
+ * \param state The incremental AEAD state.
+ */
+static void gimli24_aead_start_payload(gimli24_aead_state_t *state)
+{
+    if (state->s.mode != GIMLI24_AEAD_MODE_PAYLOAD) {
+        gimli24_aead_pad(state);
+        state->s.mode = GIMLI24_AEAD_MODE_PAYLOAD;
+    }
+}
+
+void gimli24_aead_encrypt_update
+    (gimli24_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len)
+{
+    gimli24_state_t *st = gimli24_aead_state(state);
+    unsigned temp;
+    gimli24_aead_start_payload(state);
+    while (len > 0) {
+        temp = GIMLI24_BLOCK_SIZE - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        lw_xor_block_2_dest(c, st->bytes + state->s.count, m, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+        if (state->s.count >= GIMLI24_BLOCK_SIZE) {
+            gimli24_permute(st->words);
+            state->s.count = 0;
+        }
+    }
+}
+
+void gimli24_aead_decrypt_update
+    (gimli24_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len)
+{
+    gimli24_state_t *st = gimli24_aead_state(state);
+    unsigned temp;
+    gimli24_aead_start_payload(state);
+    while (len > 0) {
+        temp = GIMLI24_BLOCK_SIZE - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        lw_xor_block_swap(m, st->bytes + state->s.count, c, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+        if (state->s.count >= GIMLI24_BLOCK_SIZE) {
+            gimli24_permute(st->words);
+            state->s.count = 0;
+        }
+    }
+}
+
+void gimli24_aead_encrypt_final
+    (gimli24_aead_state_t *state, unsigned char *tag)
+{
+    gimli24_aead_start_payload(state);
+    gimli24_aead_pad(state);
+    memcpy(tag, state->s.state, GIMLI24_TAG_SIZE);
+}
+
+int gimli24_aead_decrypt_final
+    (gimli24_aead_state_t *state, const unsigned char *tag)
+{
+    unsigned char computed[GIMLI24_TAG_SIZE];
+    gimli24_aead_encrypt_final(state, computed);
+    return aead_check_tag(0, 0, computed, tag, GIMLI24_TAG_SIZE);
+}
+
+int gimli24_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gimli24_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&gimli24_incremental, &state,
+         GIMLI24_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int gimli24_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gimli24_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&gimli24_incremental, &state,
+         GIMLI24_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
 int gimli24_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen)
 {
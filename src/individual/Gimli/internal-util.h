@@ -23,6 +23,7 @@
 #ifndef LW_INTERNAL_UTIL_H
 #define LW_INTERNAL_UTIL_H
 
+#include "aead-common.h"
 #include <stdint.h>
 
 /* Figure out how to inline functions using this C compiler */
@@ -34,6 +35,15 @@
 #define STATIC_INLINE static
 #endif
 
+/* Count calls to internal primitives if instrumentation is enabled */
+#if AEAD_INSTRUMENT
+extern unsigned long aead_primitive_counts[AEAD_PRIMITIVE_COUNT];
+#define aead_count_calls(prim, n) (aead_primitive_counts[(prim)] += (n))
+#else
+#define aead_count_calls(prim, n) do { ; } while (0)
+#endif
+#define aead_count_call(prim) aead_count_calls((prim), 1)
+
 /* Try to figure out whether the CPU is little-endian or big-endian.
  * May need to modify this to include new compiler-specific defines.
  * Alternatively, define __LITTLE_ENDIAN__ or __BIG_ENDIAN__ in your
@@ -22,6 +22,7 @@
 
 #include "grain128.h"
 #include "internal-grain128.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const grain128_aead_cipher = {
@@ -31,7 +32,18 @@ aead_cipher_t const grain128_aead_cipher = {
     GRAIN128_TAG_SIZE,
     AEAD_FLAG_NONE,
     grain128_aead_encrypt,
-    grain128_aead_decrypt
+    grain128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    grain128_aead_encrypt_vec,
+    grain128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -74,10 +86,63 @@ static unsigned grain128_encode_adlen
     }
 }
 
-int grain128_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Authenticates the data at a cursor with Grain-128.
+ *
+ * \param state Grain-128 state.
+ * \param in Cursor for the data to be authenticated.
+ * \param len Length of the data to be authenticated.
+ */
+static void grain128_authenticate_vec
+    (grain128_state_t *state, aead_iovec_cursor_t *in, unsigned long long len)
+{
+    size_t chunk;
+    while (len > 0) {
+        chunk = aead_iovec_chunk(in, (size_t)(-1));
+        if (chunk > len)
+            chunk = (size_t)len;
+        grain128_authenticate(state, aead_iovec_ptr(in), chunk);
+        aead_iovec_advance(in, chunk);
+        len -= chunk;
+    }
+}
+
+/**
+ * \brief Encrypts or decrypts the data at a cursor with Grain-128.
+ *
+ * \param state Grain-128 state.
+ * \param out Cursor for the output.
+ * \param in Cursor for the input.
+ * \param len Length of the data to be encrypted or decrypted.
+ * \param decrypt Non-zero to decrypt, zero to encrypt.
+ */
+static void grain128_crypt_vec
+    (grain128_state_t *state, aead_iovec_cursor_t *out,
+     aead_iovec_cursor_t *in, unsigned long long len, int decrypt)
+{
+    size_t chunk;
+    while (len > 0) {
+        chunk = aead_iovec_chunk(in, (size_t)(-1));
+        if (chunk > len)
+            chunk = (size_t)len;
+        chunk = aead_iovec_chunk(out, chunk);
+        if (decrypt) {
+            grain128_decrypt
+                (state, aead_iovec_ptr(out), aead_iovec_ptr(in), chunk);
+        } else {
+            grain128_encrypt
+                (state, aead_iovec_ptr(out), aead_iovec_ptr(in), chunk);
+        }
+        aead_iovec_advance(out, chunk);
+        aead_iovec_advance(in, chunk);
+        len -= chunk;
+    }
+}
+
+int grain128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
@@ -85,10 +150,18 @@ int grain128_aead_encrypt
     grain128_state_t state;
     unsigned char der[5];
     unsigned derlen;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + GRAIN128_TAG_SIZE))
+        return -2;
     *clen = mlen + GRAIN128_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Limit the amount of associated data to make DER encoding easier */
     if (adlen >= 0x100000000ULL)
@@ -100,34 +173,43 @@ int grain128_aead_encrypt
     /* Authenticate the associated data, prefixed with the DER-encoded length */
     derlen = grain128_encode_adlen(der, adlen);
     grain128_authenticate(&state, der, derlen);
-    grain128_authenticate(&state, ad, adlen);
+    grain128_authenticate_vec(&state, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    grain128_encrypt(&state, c, m, mlen);
+    grain128_crypt_vec(&state, &ccur, &mcur, mlen, 0);
 
     /* Generate the authentication tag */
     grain128_compute_tag(&state);
-    memcpy(c + mlen, state.ks, GRAIN128_TAG_SIZE);
+    aead_iovec_write(&ccur, state.ks, GRAIN128_TAG_SIZE);
     return 0;
 }
 
-int grain128_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int grain128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     grain128_state_t state;
     unsigned char der[5];
     unsigned derlen;
+    unsigned char tag[GRAIN128_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < GRAIN128_TAG_SIZE)
         return -1;
     *mlen = clen - GRAIN128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Limit the amount of associated data to make DER encoding easier */
     if (adlen >= 0x100000000ULL)
@@ -139,13 +221,47 @@ int grain128_aead_decrypt
     /* Authenticate the associated data, prefixed with the DER-encoded length */
     derlen = grain128_encode_adlen(der, adlen);
     grain128_authenticate(&state, der, derlen);
-    grain128_authenticate(&state, ad, adlen);
+    grain128_authenticate_vec(&state, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
-    clen -= GRAIN128_TAG_SIZE;
-    grain128_decrypt(&state, m, c, clen);
+    grain128_crypt_vec(&state, &mcur, &ccur, *mlen, 1);
 
     /* Check the authentication tag */
     grain128_compute_tag(&state);
-    return aead_check_tag(m, clen, state.ks, c + clen, GRAIN128_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, GRAIN128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state.ks, tag, GRAIN128_TAG_SIZE);
+}
+
+int grain128_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + GRAIN128_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return grain128_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int grain128_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= GRAIN128_TAG_SIZE ?
+                   clen - GRAIN128_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return grain128_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
@@ -22,29 +22,9 @@
 
 #include "hyena.h"
 #include "internal-gift128.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
-aead_cipher_t const hyena_v1_cipher = {
-    "HYENA-v1",
-    HYENA_KEY_SIZE,
-    HYENA_NONCE_SIZE,
-    HYENA_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    hyena_v1_aead_encrypt,
-    hyena_v1_aead_decrypt
-};
-
-aead_cipher_t const hyena_v2_cipher = {
-    "HYENA-v2",
-    HYENA_KEY_SIZE,
-    HYENA_NONCE_SIZE,
-    HYENA_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    hyena_v2_aead_encrypt,
-    hyena_v2_aead_decrypt
-};
-
 /**
  * \brief Doubles a delta value in the F(2^64) field.
  *
@@ -84,29 +64,28 @@ static void hyena_triple_delta(unsigned char D[8])
  * \param ks Key schedule for the GIFT-128 cipher.
  * \param Y Internal hash state of HYENA.
  * \param D Internal hash state of HYENA.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void hyena_v1_process_ad
-    (const gift128n_key_schedule_t *ks, unsigned char Y[16],
-     unsigned char D[8], const unsigned char *ad,
+    (const gift128_variant_key_schedule_t *ks, unsigned char Y[16],
+     unsigned char D[8], aead_iovec_cursor_t *ad,
      unsigned long long adlen)
 {
     unsigned char feedback[16];
     hyena_double_delta(D);
     while (adlen > 16) {
-        memcpy(feedback, ad, 16);
+        aead_iovec_read(ad, feedback, 16);
         lw_xor_block(feedback + 8, Y + 8, 8);
         lw_xor_block(feedback + 8, D, 8);
         lw_xor_block(Y, feedback, 16);
-        gift128n_encrypt(ks, Y, Y);
+        gift128n_variant_encrypt(ks, Y, Y);
         hyena_double_delta(D);
-        ad += 16;
         adlen -= 16;
     }
     if (adlen == 16) {
         hyena_double_delta(D);
-        memcpy(feedback, ad, 16);
+        aead_iovec_read(ad, feedback, 16);
         lw_xor_block(feedback + 8, Y + 8, 8);
         lw_xor_block(feedback + 8, D, 8);
         lw_xor_block(Y, feedback, 16);
@@ -114,7 +93,7 @@ static void hyena_v1_process_ad
         unsigned temp = (unsigned)adlen;
         hyena_double_delta(D);
         hyena_double_delta(D);
-        memcpy(feedback, ad, temp);
+        aead_iovec_read(ad, feedback, temp);
         feedback[temp] = 0x01;
         memset(feedback + temp + 1, 0, 15 - temp);
         if (temp > 8)
@@ -124,26 +103,43 @@ static void hyena_v1_process_ad
     }
 }
 
-int hyena_v1_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Encrypts and authenticates a packet with HYENA-v1 using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int hyena_v1_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    gift128n_key_schedule_t ks;
+    const gift128_variant_key_schedule_t *ks =
+        (const gift128_variant_key_schedule_t *)ctx;
     unsigned char Y[16];
     unsigned char D[8];
     unsigned char feedback[16];
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned index;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + HYENA_TAG_SIZE))
+        return -2;
     *clen = mlen + HYENA_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
-    /* Set up the key schedule and use it to encrypt the nonce */
-    gift128n_init(&ks, k);
+    /* Encrypt the nonce to initialize the state */
     Y[0] = 0;
     if (adlen == 0)
         Y[0] |= 0x01;
@@ -153,50 +149,55 @@ int hyena_v1_aead_encrypt
     Y[2] = 0;
     Y[3] = 0;
     memcpy(Y + 4, npub, HYENA_NONCE_SIZE);
-    gift128n_encrypt(&ks, Y, Y);
+    gift128n_variant_encrypt(ks, Y, Y);
     memcpy(D, Y + 8, 8);
 
     /* Process the associated data */
-    hyena_v1_process_ad(&ks, Y, D, ad, adlen);
+    hyena_v1_process_ad(ks, Y, D, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         while (mlen > 16) {
-            gift128n_encrypt(&ks, Y, Y);
+            gift128n_variant_encrypt(ks, Y, Y);
             hyena_double_delta(D);
-            memcpy(feedback, m, 16);
+            in = aead_iovec_load_block(&mcur, inbuf, 16);
+            out = aead_iovec_store_begin(&ccur, outbuf, 16);
+            memcpy(feedback, in, 16);
             lw_xor_block(feedback + 8, Y + 8, 8);
             lw_xor_block(feedback + 8, D, 8);
-            lw_xor_block_2_src(c, m, Y, 16);
+            lw_xor_block_2_src(out, in, Y, 16);
+            aead_iovec_store_end(&ccur, outbuf, out, 16);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
-            m += 16;
             mlen -= 16;
         }
-        gift128n_encrypt(&ks, Y, Y);
+        gift128n_variant_encrypt(ks, Y, Y);
         if (mlen == 16) {
             hyena_double_delta(D);
             hyena_double_delta(D);
-            memcpy(feedback, m, 16);
+            in = aead_iovec_load_block(&mcur, inbuf, 16);
+            out = aead_iovec_store_begin(&ccur, outbuf, 16);
+            memcpy(feedback, in, 16);
             lw_xor_block(feedback + 8, Y + 8, 8);
             lw_xor_block(feedback + 8, D, 8);
-            lw_xor_block_2_src(c, m, Y, 16);
+            lw_xor_block_2_src(out, in, Y, 16);
+            aead_iovec_store_end(&ccur, outbuf, out, 16);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
         } else {
             unsigned temp = (unsigned)mlen;
             hyena_double_delta(D);
             hyena_double_delta(D);
             hyena_double_delta(D);
-            memcpy(feedback, m, temp);
+            in = aead_iovec_load_block(&mcur, inbuf, temp);
+            out = aead_iovec_store_begin(&ccur, outbuf, temp);
+            memcpy(feedback, in, temp);
             feedback[temp] = 0x01;
             memset(feedback + temp + 1, 0, 15 - temp);
             if (temp > 8)
                 lw_xor_block(feedback + 8, Y + 8, temp - 8);
             lw_xor_block(feedback + 8, D, 8);
-            lw_xor_block_2_src(c, m, Y, temp);
+            lw_xor_block_2_src(out, in, Y, temp);
+            aead_iovec_store_end(&ccur, outbuf, out, temp);
             lw_xor_block(Y, feedback, 16);
-            c += temp;
         }
     }
 
@@ -207,33 +208,50 @@ int hyena_v1_aead_encrypt
         Y[index] = temp2;
         Y[index + 8] = temp1;
     }
-    gift128n_encrypt(&ks, c, Y);
+    gift128n_variant_encrypt(ks, Y, Y);
+    aead_iovec_write(&ccur, Y, HYENA_TAG_SIZE);
     return 0;
 }
 
-int hyena_v1_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+/**
+ * \brief Decrypts and authenticates a packet with HYENA-v1 using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int hyena_v1_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    gift128n_key_schedule_t ks;
+    const gift128_variant_key_schedule_t *ks =
+        (const gift128_variant_key_schedule_t *)ctx;
     unsigned char Y[16];
     unsigned char D[8];
     unsigned char feedback[16];
-    unsigned char *mtemp;
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned index;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < HYENA_TAG_SIZE)
         return -1;
     *mlen = clen - HYENA_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
-    /* Set up the key schedule and use it to encrypt the nonce */
-    gift128n_init(&ks, k);
+    /* Encrypt the nonce to initialize the state */
     Y[0] = 0;
     if (adlen == 0)
         Y[0] |= 0x01;
@@ -243,56 +261,60 @@ int hyena_v1_aead_decrypt
     Y[2] = 0;
     Y[3] = 0;
     memcpy(Y + 4, npub, HYENA_NONCE_SIZE);
-    gift128n_encrypt(&ks, Y, Y);
+    gift128n_variant_encrypt(ks, Y, Y);
     memcpy(D, Y + 8, 8);
 
     /* Process the associated data */
-    hyena_v1_process_ad(&ks, Y, D, ad, adlen);
+    hyena_v1_process_ad(ks, Y, D, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= HYENA_TAG_SIZE;
-    mtemp = m;
     if (clen > 0) {
         while (clen > 16) {
-            gift128n_encrypt(&ks, Y, Y);
+            gift128n_variant_encrypt(ks, Y, Y);
             hyena_double_delta(D);
-            memcpy(feedback + 8, c + 8, 8);
-            lw_xor_block_2_src(m, c, Y, 16);
-            memcpy(feedback, m, 8);
+            in = aead_iovec_load_block(&ccur, inbuf, 16);
+            out = aead_iovec_store_begin(&mcur, outbuf, 16);
+            memcpy(feedback + 8, in + 8, 8);
+            lw_xor_block_2_src(out, in, Y, 16);
+            memcpy(feedback, out, 8);
+            aead_iovec_store_end(&mcur, outbuf, out, 16);
             lw_xor_block(feedback + 8, D, 8);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
-            m += 16;
             clen -= 16;
         }
-        gift128n_encrypt(&ks, Y, Y);
+        gift128n_variant_encrypt(ks, Y, Y);
         if (clen == 16) {
             hyena_double_delta(D);
             hyena_double_delta(D);
-            memcpy(feedback + 8, c + 8, 8);
-            lw_xor_block_2_src(m, c, Y, 16);
-            memcpy(feedback, m, 8);
+            in = aead_iovec_load_block(&ccur, inbuf, 16);
+            out = aead_iovec_store_begin(&mcur, outbuf, 16);
+            memcpy(feedback + 8, in + 8, 8);
+            lw_xor_block_2_src(out, in, Y, 16);
+            memcpy(feedback, out, 8);
+            aead_iovec_store_end(&mcur, outbuf, out, 16);
             lw_xor_block(feedback + 8, D, 8);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
         } else {
             unsigned temp = (unsigned)clen;
             hyena_double_delta(D);
             hyena_double_delta(D);
             hyena_double_delta(D);
+            in = aead_iovec_load_block(&ccur, inbuf, temp);
+            out = aead_iovec_store_begin(&mcur, outbuf, temp);
             if (temp > 8) {
-                memcpy(feedback + 8, c + 8, temp - 8);
-                lw_xor_block_2_src(m, c, Y, temp);
-                memcpy(feedback, m, 8);
+                memcpy(feedback + 8, in + 8, temp - 8);
+                lw_xor_block_2_src(out, in, Y, temp);
+                memcpy(feedback, out, 8);
             } else {
-                lw_xor_block_2_src(m, c, Y, temp);
-                memcpy(feedback, m, temp);
+                lw_xor_block_2_src(out, in, Y, temp);
+                memcpy(feedback, out, temp);
             }
+            aead_iovec_store_end(&mcur, outbuf, out, temp);
             feedback[temp] = 0x01;
             memset(feedback + temp + 1, 0, 15 - temp);
             lw_xor_block(feedback + 8, D, 8);
             lw_xor_block(Y, feedback, 16);
-            c += temp;
         }
     }
 
@@ -303,8 +325,55 @@ int hyena_v1_aead_decrypt
         Y[index] = temp2;
         Y[index + 8] = temp1;
     }
-    gift128n_encrypt(&ks, Y, Y);
-    return aead_check_tag(mtemp, *mlen, Y, c, HYENA_TAG_SIZE);
+    gift128n_variant_encrypt(ks, Y, Y);
+    aead_iovec_read(&ccur, feedback, HYENA_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, Y, feedback, HYENA_TAG_SIZE);
+}
+
+/**
+ * \brief Encrypts and authenticates a packet with HYENA-v1 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int hyena_v1_aead_encrypt_ctx
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + HYENA_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return hyena_v1_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with HYENA-v1 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int hyena_v1_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= HYENA_TAG_SIZE ?
+                   clen - HYENA_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return hyena_v1_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, ctx);
 }
 
 /**
@@ -313,28 +382,27 @@ int hyena_v1_aead_decrypt
  * \param ks Key schedule for the GIFT-128 cipher.
  * \param Y Internal hash state of HYENA.
  * \param D Internal hash state of HYENA.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void hyena_v2_process_ad
-    (const gift128n_key_schedule_t *ks, unsigned char Y[16],
-     unsigned char D[8], const unsigned char *ad,
+    (const gift128_variant_key_schedule_t *ks, unsigned char Y[16],
+     unsigned char D[8], aead_iovec_cursor_t *ad,
      unsigned long long adlen)
 {
     unsigned char feedback[16];
     while (adlen > 16) {
         hyena_double_delta(D);
-        memcpy(feedback, ad, 16);
+        aead_iovec_read(ad, feedback, 16);
         lw_xor_block(feedback + 8, Y + 8, 8);
         lw_xor_block(feedback + 8, D, 8);
         lw_xor_block(Y, feedback, 16);
-        gift128n_encrypt(ks, Y, Y);
-        ad += 16;
+        gift128n_variant_encrypt(ks, Y, Y);
         adlen -= 16;
     }
     if (adlen == 16) {
         hyena_triple_delta(D);
-        memcpy(feedback, ad, 16);
+        aead_iovec_read(ad, feedback, 16);
         lw_xor_block(feedback + 8, Y + 8, 8);
         lw_xor_block(feedback + 8, D, 8);
         lw_xor_block(Y, feedback, 16);
@@ -342,7 +410,7 @@ static void hyena_v2_process_ad
         unsigned temp = (unsigned)adlen;
         hyena_triple_delta(D);
         hyena_triple_delta(D);
-        memcpy(feedback, ad, temp);
+        aead_iovec_read(ad, feedback, temp);
         feedback[temp] = 0x01;
         memset(feedback + temp + 1, 0, 15 - temp);
         if (temp > 8)
@@ -352,26 +420,43 @@ static void hyena_v2_process_ad
     }
 }
 
-int hyena_v2_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Encrypts and authenticates a packet with HYENA-v2 using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int hyena_v2_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    gift128n_key_schedule_t ks;
+    const gift128_variant_key_schedule_t *ks =
+        (const gift128_variant_key_schedule_t *)ctx;
     unsigned char Y[16];
     unsigned char D[8];
     unsigned char feedback[16];
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned index;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + HYENA_TAG_SIZE))
+        return -2;
     *clen = mlen + HYENA_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
-    /* Set up the key schedule and use it to encrypt the nonce */
-    gift128n_init(&ks, k);
+    /* Encrypt the nonce to initialize the state */
     Y[0] = 0;
     if (adlen == 0)
         Y[0] |= 0x01;
@@ -381,48 +466,53 @@ int hyena_v2_aead_encrypt
     Y[2] = 0;
     Y[3] = 0;
     memcpy(Y + 4, npub, HYENA_NONCE_SIZE);
-    gift128n_encrypt(&ks, Y, Y);
+    gift128n_variant_encrypt(ks, Y, Y);
     memcpy(D, Y + 8, 8);
 
     /* Process the associated data */
-    hyena_v2_process_ad(&ks, Y, D, ad, adlen);
+    hyena_v2_process_ad(ks, Y, D, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         while (mlen > 16) {
-            gift128n_encrypt(&ks, Y, Y);
+            gift128n_variant_encrypt(ks, Y, Y);
             hyena_double_delta(D);
-            memcpy(feedback, m, 16);
+            in = aead_iovec_load_block(&mcur, inbuf, 16);
+            out = aead_iovec_store_begin(&ccur, outbuf, 16);
+            memcpy(feedback, in, 16);
             lw_xor_block(feedback + 8, Y + 8, 8);
             lw_xor_block(feedback + 8, D, 8);
-            lw_xor_block_2_src(c, m, Y, 16);
+            lw_xor_block_2_src(out, in, Y, 16);
+            aead_iovec_store_end(&ccur, outbuf, out, 16);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
-            m += 16;
             mlen -= 16;
         }
-        gift128n_encrypt(&ks, Y, Y);
+        gift128n_variant_encrypt(ks, Y, Y);
         if (mlen == 16) {
             hyena_triple_delta(D);
-            memcpy(feedback, m, 16);
+            in = aead_iovec_load_block(&mcur, inbuf, 16);
+            out = aead_iovec_store_begin(&ccur, outbuf, 16);
+            memcpy(feedback, in, 16);
             lw_xor_block(feedback + 8, Y + 8, 8);
             lw_xor_block(feedback + 8, D, 8);
-            lw_xor_block_2_src(c, m, Y, 16);
+            lw_xor_block_2_src(out, in, Y, 16);
+            aead_iovec_store_end(&ccur, outbuf, out, 16);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
         } else {
             unsigned temp = (unsigned)mlen;
             hyena_triple_delta(D);
             hyena_triple_delta(D);
-            memcpy(feedback, m, temp);
+            in = aead_iovec_load_block(&mcur, inbuf, temp);
+            out = aead_iovec_store_begin(&ccur, outbuf, temp);
+            memcpy(feedback, in, temp);
             feedback[temp] = 0x01;
             memset(feedback + temp + 1, 0, 15 - temp);
             if (temp > 8)
                 lw_xor_block(feedback + 8, Y + 8, temp - 8);
             lw_xor_block(feedback + 8, D, 8);
-            lw_xor_block_2_src(c, m, Y, temp);
+            lw_xor_block_2_src(out, in, Y, temp);
+            aead_iovec_store_end(&ccur, outbuf, out, temp);
             lw_xor_block(Y, feedback, 16);
-            c += temp;
         }
     }
 
@@ -433,33 +523,50 @@ int hyena_v2_aead_encrypt
         Y[index] = temp2;
         Y[index + 8] = temp1;
     }
-    gift128n_encrypt(&ks, c, Y);
+    gift128n_variant_encrypt(ks, Y, Y);
+    aead_iovec_write(&ccur, Y, HYENA_TAG_SIZE);
     return 0;
 }
 
-int hyena_v2_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+/**
+ * \brief Decrypts and authenticates a packet with HYENA-v2 using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int hyena_v2_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    gift128n_key_schedule_t ks;
+    const gift128_variant_key_schedule_t *ks =
+        (const gift128_variant_key_schedule_t *)ctx;
     unsigned char Y[16];
     unsigned char D[8];
     unsigned char feedback[16];
-    unsigned char *mtemp;
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned index;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < HYENA_TAG_SIZE)
         return -1;
     *mlen = clen - HYENA_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
-    /* Set up the key schedule and use it to encrypt the nonce */
-    gift128n_init(&ks, k);
+    /* Encrypt the nonce to initialize the state */
     Y[0] = 0;
     if (adlen == 0)
         Y[0] |= 0x01;
@@ -469,54 +576,58 @@ int hyena_v2_aead_decrypt
     Y[2] = 0;
     Y[3] = 0;
     memcpy(Y + 4, npub, HYENA_NONCE_SIZE);
-    gift128n_encrypt(&ks, Y, Y);
+    gift128n_variant_encrypt(ks, Y, Y);
     memcpy(D, Y + 8, 8);
 
     /* Process the associated data */
-    hyena_v2_process_ad(&ks, Y, D, ad, adlen);
+    hyena_v2_process_ad(ks, Y, D, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= HYENA_TAG_SIZE;
-    mtemp = m;
     if (clen > 0) {
         while (clen > 16) {
-            gift128n_encrypt(&ks, Y, Y);
+            gift128n_variant_encrypt(ks, Y, Y);
             hyena_double_delta(D);
-            memcpy(feedback + 8, c + 8, 8);
-            lw_xor_block_2_src(m, c, Y, 16);
-            memcpy(feedback, m, 8);
+            in = aead_iovec_load_block(&ccur, inbuf, 16);
+            out = aead_iovec_store_begin(&mcur, outbuf, 16);
+            memcpy(feedback + 8, in + 8, 8);
+            lw_xor_block_2_src(out, in, Y, 16);
+            memcpy(feedback, out, 8);
+            aead_iovec_store_end(&mcur, outbuf, out, 16);
             lw_xor_block(feedback + 8, D, 8);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
-            m += 16;
             clen -= 16;
         }
-        gift128n_encrypt(&ks, Y, Y);
+        gift128n_variant_encrypt(ks, Y, Y);
         if (clen == 16) {
             hyena_triple_delta(D);
-            memcpy(feedback + 8, c + 8, 8);
-            lw_xor_block_2_src(m, c, Y, 16);
-            memcpy(feedback, m, 8);
+            in = aead_iovec_load_block(&ccur, inbuf, 16);
+            out = aead_iovec_store_begin(&mcur, outbuf, 16);
+            memcpy(feedback + 8, in + 8, 8);
+            lw_xor_block_2_src(out, in, Y, 16);
+            memcpy(feedback, out, 8);
+            aead_iovec_store_end(&mcur, outbuf, out, 16);
             lw_xor_block(feedback + 8, D, 8);
             lw_xor_block(Y, feedback, 16);
-            c += 16;
         } else {
             unsigned temp = (unsigned)clen;
             hyena_triple_delta(D);
             hyena_triple_delta(D);
+            in = aead_iovec_load_block(&ccur, inbuf, temp);
+            out = aead_iovec_store_begin(&mcur, outbuf, temp);
             if (temp > 8) {
-                memcpy(feedback + 8, c + 8, temp - 8);
-                lw_xor_block_2_src(m, c, Y, temp);
-                memcpy(feedback, m, 8);
+                memcpy(feedback + 8, in + 8, temp - 8);
+                lw_xor_block_2_src(out, in, Y, temp);
+                memcpy(feedback, out, 8);
             } else {
-                lw_xor_block_2_src(m, c, Y, temp);
-                memcpy(feedback, m, temp);
+                lw_xor_block_2_src(out, in, Y, temp);
+                memcpy(feedback, out, temp);
             }
+            aead_iovec_store_end(&mcur, outbuf, out, temp);
             feedback[temp] = 0x01;
             memset(feedback + temp + 1, 0, 15 - temp);
             lw_xor_block(feedback + 8, D, 8);
             lw_xor_block(Y, feedback, 16);
-            c += temp;
         }
     }
 
@@ -527,6 +638,251 @@ int hyena_v2_aead_decrypt
         Y[index] = temp2;
         Y[index + 8] = temp1;
     }
-    gift128n_encrypt(&ks, Y, Y);
-    return aead_check_tag(mtemp, *mlen, Y, c, HYENA_TAG_SIZE);
+    gift128n_variant_encrypt(ks, Y, Y);
+    aead_iovec_read(&ccur, feedback, HYENA_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, Y, feedback, HYENA_TAG_SIZE);
+}
+
+/**
+ * \brief Encrypts and authenticates a packet with HYENA-v2 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int hyena_v2_aead_encrypt_ctx
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + HYENA_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return hyena_v2_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with HYENA-v2 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int hyena_v2_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= HYENA_TAG_SIZE ?
+                   clen - HYENA_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return hyena_v2_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Sets up the key schedule for HYENA.
+ *
+ * \param ctx Points to the GIFT-128 key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ */
+static void hyena_setup_key(void *ctx, const unsigned char *k)
+{
+    gift128n_variant_init
+        ((gift128_variant_key_schedule_t *)ctx, k, GIFT128_VARIANT);
 }
+
+/**
+ * \brief Gets the size of the HYENA key context for a key schedule variant.
+ *
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * \return The size of the key context in bytes.
+ */
+static size_t hyena_schedule_size(unsigned schedule)
+{
+    return gift128_variant_schedule_size
+        (gift128_variant_for_schedule(schedule));
+}
+
+/**
+ * \brief Sets up the key schedule for HYENA with a specific variant.
+ *
+ * \param ctx Points to the GIFT-128 key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * HYENA only uses the encryption direction of GIFT-128 so the small
+ * variant runs at the same speed as the full variant with a quarter
+ * of the memory.
+ */
+static void hyena_setup_key_schedule
+    (void *ctx, const unsigned char *k, unsigned schedule)
+{
+    gift128n_variant_init
+        ((gift128_variant_key_schedule_t *)ctx, k,
+         gift128_variant_for_schedule(schedule));
+}
+
+int hyena_v1_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v1_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int hyena_v1_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v1_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int hyena_v1_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v1_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, nsec, npub, &ks);
+}
+
+int hyena_v1_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v1_aead_decrypt_vec_ctx
+        (m, m_count, mlen, nsec, c, c_count, ad, ad_count, npub, &ks);
+}
+
+int hyena_v2_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v2_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
+
+int hyena_v2_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v2_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int hyena_v2_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v2_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, nsec, npub, &ks);
+}
+
+int hyena_v2_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    gift128_variant_key_schedule_t ks;
+    gift128n_variant_init(&ks, k, GIFT128_VARIANT);
+    return hyena_v2_aead_decrypt_vec_ctx
+        (m, m_count, mlen, nsec, c, c_count, ad, ad_count, npub, &ks);
+}
+
+aead_cipher_t const hyena_v1_cipher = {
+    "HYENA-v1",
+    HYENA_KEY_SIZE,
+    HYENA_NONCE_SIZE,
+    HYENA_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    hyena_v1_aead_encrypt,
+    hyena_v1_aead_decrypt,
+    sizeof(gift128_variant_key_schedule_t),
+    hyena_setup_key,
+    hyena_v1_aead_encrypt_ctx,
+    hyena_v1_aead_decrypt_ctx,
+    hyena_v1_aead_encrypt_vec,
+    hyena_v1_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    hyena_schedule_size,
+    hyena_setup_key_schedule
+};
+
+aead_cipher_t const hyena_v2_cipher = {
+    "HYENA-v2",
+    HYENA_KEY_SIZE,
+    HYENA_NONCE_SIZE,
+    HYENA_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    hyena_v2_aead_encrypt,
+    hyena_v2_aead_decrypt,
+    sizeof(gift128_variant_key_schedule_t),
+    hyena_setup_key,
+    hyena_v2_aead_encrypt_ctx,
+    hyena_v2_aead_decrypt_ctx,
+    hyena_v2_aead_encrypt_vec,
+    hyena_v2_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    hyena_schedule_size,
+    hyena_setup_key_schedule
+};
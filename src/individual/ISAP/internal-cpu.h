@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef LW_INTERNAL_CPU_H
+#define LW_INTERNAL_CPU_H
+
+/**
+ * \file internal-cpu.h
+ * \brief Runtime detection of CPU features for selecting primitive kernels.
+ *
+ * Primitives with vectorized or otherwise CPU-specific kernels bind a
+ * function pointer to the best kernel on first use, based on the features
+ * that lw_cpu_features() reports.  The portable C kernel is always
+ * available as the fallback, so a single binary can run on any CPU of
+ * the family while still using wider vector units where they exist.
+ *
+ * On x86 with GCC or clang, the CPU-specific kernels are compiled with
+ * per-function target attributes and the features are detected with
+ * CPUID at runtime.  Elsewhere, or if the library is compiled with
+ * LW_NO_CPU_DISPATCH defined, only the kernels that are enabled by the
+ * compiler flags are built and lw_cpu_features() reports those flags.
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief SSE2 instructions are available.
+ */
+#define LW_CPU_SSE2 0x0001
+
+/**
+ * \brief SSSE3 instructions are available.
+ */
+#define LW_CPU_SSSE3 0x0002
+
+/**
+ * \brief AVX2 instructions are available, and the operating system
+ * saves the 256-bit vector registers.
+ */
+#define LW_CPU_AVX2 0x0004
+
+/**
+ * \brief AVX-512 foundation instructions are available, and the operating
+ * system saves the 512-bit vector registers.
+ */
+#define LW_CPU_AVX512F 0x0008
+
+/**
+ * \brief AVX-512 instructions on 128-bit and 256-bit vectors are available.
+ */
+#define LW_CPU_AVX512VL 0x0010
+
+/**
+ * \brief Both the BMI1 and BMI2 bit manipulation instruction sets
+ * are available.
+ */
+#define LW_CPU_BMI2 0x0020
+
+/**
+ * \brief Carry-less multiplication instructions are available.
+ */
+#define LW_CPU_PCLMUL 0x0040
+
+/**
+ * \def LW_CPU_DISPATCH
+ * \brief Defined if CPU-specific kernels are compiled with target
+ * attributes and selected at runtime.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && \
+        (defined(__GNUC__) || defined(__clang__)) && \
+        !defined(LW_NO_CPU_DISPATCH)
+#define LW_CPU_DISPATCH 1
+#endif
+
+/**
+ * \def LW_CPU_TARGET(features)
+ * \brief Compiles a function for specific CPU features, which may not be
+ * enabled for the rest of the library.
+ *
+ * \param features Comma-separated list of features; e.g. "bmi,bmi2".
+ *
+ * A function with this attribute must only be called after checking
+ * lw_cpu_features() for the corresponding features.
+ */
+#if defined(LW_CPU_DISPATCH)
+#define LW_CPU_TARGET(features) __attribute__((target(features)))
+#else
+#define LW_CPU_TARGET(features)
+#endif
+
+/**
+ * \def LW_CPU_INLINE
+ * \brief Marks the portable body of a primitive that is inlined into
+ * each of its CPU-specific variants.
+ *
+ * Inlining is forced when dispatching so that each variant's copy of
+ * the body is compiled with that variant's target features.
+ */
+#if defined(LW_CPU_DISPATCH)
+#define LW_CPU_INLINE inline __attribute__((always_inline))
+#else
+#define LW_CPU_INLINE inline
+#endif
+
+/**
+ * \def LW_CPU_LOAD(var)
+ * \brief Loads a lazily bound kernel pointer or cached value that other
+ * threads may be storing at the same time.
+ *
+ * \param var The variable to load.
+ *
+ * Every thread that binds a kernel computes the same value, so relaxed
+ * ordering is enough.  What matters is that the load and the store
+ * are single atomic accesses rather than a data race.
+ */
+/**
+ * \def LW_CPU_STORE(var, value)
+ * \brief Stores a lazily bound kernel pointer or cached value that other
+ * threads may be loading at the same time.
+ *
+ * \param var The variable to store to.
+ * \param value The value to store.
+ */
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__AVR__)
+#define LW_CPU_LOAD(var) __atomic_load_n(&(var), __ATOMIC_RELAXED)
+#define LW_CPU_STORE(var, value) \
+    __atomic_store_n(&(var), (value), __ATOMIC_RELAXED)
+#else
+#define LW_CPU_LOAD(var) (var)
+#define LW_CPU_STORE(var, value) ((var) = (value))
+#endif
+
+/* Determine which CPU-specific kernels can be compiled */
+#if defined(__SSE2__) || defined(LW_CPU_DISPATCH)
+#define LW_CPU_HAVE_SSE2 1
+#endif
+#if defined(__SSSE3__) || defined(LW_CPU_DISPATCH)
+#define LW_CPU_HAVE_SSSE3 1
+#endif
+#if defined(__AVX2__) || defined(LW_CPU_DISPATCH)
+#define LW_CPU_HAVE_AVX2 1
+#endif
+#if defined(__AVX512F__) || defined(LW_CPU_DISPATCH)
+#define LW_CPU_HAVE_AVX512F 1
+#endif
+#if (defined(__BMI__) && defined(__BMI2__)) || defined(LW_CPU_DISPATCH)
+#define LW_CPU_HAVE_BMI2 1
+#endif
+
+/**
+ * \brief Gets the features of the CPU that the library is running on.
+ *
+ * \return A bitmask of LW_CPU_SSE2, LW_CPU_AVX2, and so on.
+ *
+ * The features are detected on the first call and then cached.
+ * Concurrent first calls are harmless because every caller detects
+ * and stores the same value, and the cache is only accessed with
+ * LW_CPU_LOAD() and LW_CPU_STORE().
+ */
+unsigned lw_cpu_features(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -96,14 +96,20 @@ static void ISAP_CONCAT(ISAP_ALG_NAME,_rekey)
  * \param state ISAP permutation state.
  * \param k Points to the 128-bit key for the ISAP cipher.
  * \param npub Points to the 128-bit nonce for the ISAP cipher.
- * \param c Buffer to receive the output ciphertext.
- * \param m Buffer to receive the input plaintext.
+ * \param c Cursor for the output ciphertext.
+ * \param m Cursor for the input plaintext.
  * \param mlen Length of the input plaintext.
  */
 static void ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)
     (ISAP_STATE *state, const unsigned char *k, const unsigned char *npub,
-     unsigned char *c, const unsigned char *m, unsigned long long mlen)
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char inbuf[ISAP_RATE];
+    unsigned char outbuf[ISAP_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned temp;
+
     /* Set up the re-keyed encryption key and nonce in the state */
     ISAP_CONCAT(ISAP_ALG_NAME,_rekey)
         (state, k, ISAP_CONCAT(ISAP_ALG_NAME,_IV_KE), npub, ISAP_NONCE_SIZE);
@@ -111,16 +117,14 @@ static void ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)
            npub, ISAP_NONCE_SIZE);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    while (mlen >= ISAP_RATE) {
+    while (mlen > 0) {
+        temp = mlen >= ISAP_RATE ? ISAP_RATE : (unsigned)mlen;
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
         ISAP_PERMUTE(state, ISAP_sE);
-        lw_xor_block_2_src(c, state->B, m, ISAP_RATE);
-        c += ISAP_RATE;
-        m += ISAP_RATE;
-        mlen -= ISAP_RATE;
-    }
-    if (mlen > 0) {
-        ISAP_PERMUTE(state, ISAP_sE);
-        lw_xor_block_2_src(c, state->B, m, (unsigned)mlen);
+        lw_xor_block_2_src(out, state->B, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
+        mlen -= temp;
     }
 }
 
@@ -130,18 +134,21 @@ static void ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)
  * \param state ISAP permutation state.
  * \param k Points to the 128-bit key for the ISAP cipher.
  * \param npub Points to the 128-bit nonce for the ISAP cipher.
- * \param ad Buffer containing the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data.
- * \param c Buffer containing the ciphertext.
+ * \param c Cursor for the ciphertext.
  * \param clen Length of the ciphertext.
+ * \param tag Buffer to receive the authentication tag.
  */
 static void ISAP_CONCAT(ISAP_ALG_NAME,_mac)
     (ISAP_STATE *state, const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *c, unsigned long long clen,
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
+     aead_iovec_cursor_t *c, unsigned long long clen,
      unsigned char *tag)
 {
     unsigned char preserve[sizeof(ISAP_STATE) - ISAP_TAG_SIZE];
+    unsigned char buf[ISAP_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Absorb the associated data */
@@ -150,26 +157,28 @@ static void ISAP_CONCAT(ISAP_ALG_NAME,_mac)
            sizeof(state->B) - ISAP_NONCE_SIZE);
     ISAP_PERMUTE(state, ISAP_sH);
     while (adlen >= ISAP_RATE) {
-        lw_xor_block(state->B, ad, ISAP_RATE);
+        in = aead_iovec_load_block(ad, buf, ISAP_RATE);
+        lw_xor_block(state->B, in, ISAP_RATE);
         ISAP_PERMUTE(state, ISAP_sH);
-        ad += ISAP_RATE;
         adlen -= ISAP_RATE;
     }
     temp = (unsigned)adlen;
-    lw_xor_block(state->B, ad, temp);
+    in = aead_iovec_load_block(ad, buf, temp);
+    lw_xor_block(state->B, in, temp);
     state->B[temp] ^= 0x80; /* padding */
     ISAP_PERMUTE(state, ISAP_sH);
     state->B[sizeof(state->B) - 1] ^= 0x01; /* domain separation */
 
     /* Absorb the ciphertext */
     while (clen >= ISAP_RATE) {
-        lw_xor_block(state->B, c, ISAP_RATE);
+        in = aead_iovec_load_block(c, buf, ISAP_RATE);
+        lw_xor_block(state->B, in, ISAP_RATE);
         ISAP_PERMUTE(state, ISAP_sH);
-        c += ISAP_RATE;
         clen -= ISAP_RATE;
     }
     temp = (unsigned)clen;
-    lw_xor_block(state->B, c, temp);
+    in = aead_iovec_load_block(c, buf, temp);
+    lw_xor_block(state->B, in, temp);
     state->B[temp] ^= 0x80; /* padding */
     ISAP_PERMUTE(state, ISAP_sH);
 
@@ -183,54 +192,110 @@ static void ISAP_CONCAT(ISAP_ALG_NAME,_mac)
     memcpy(tag, state->B, ISAP_TAG_SIZE);
 }
 
-int ISAP_CONCAT(ISAP_ALG_NAME,_aead_encrypt)
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int ISAP_CONCAT(ISAP_ALG_NAME,_aead_encrypt_vec)
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     ISAP_STATE state;
+    aead_iovec_cursor_t ctext;
+    unsigned char tag[ISAP_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + ISAP_TAG_SIZE))
+        return -2;
     *clen = mlen + ISAP_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)(&state, k, npub, c, m, mlen);
+    ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)(&state, k, npub, &ccur, &mcur, mlen);
 
     /* Authenticate the associated data and ciphertext to generate the tag */
+    aead_iovec_start(&ctext, c, c_count);
     ISAP_CONCAT(ISAP_ALG_NAME,_mac)
-        (&state, k, npub, ad, adlen, c, mlen, c + mlen);
+        (&state, k, npub, &adcur, adlen, &ctext, mlen, tag);
+    aead_iovec_write(&ccur, tag, ISAP_TAG_SIZE);
     return 0;
 }
 
-int ISAP_CONCAT(ISAP_ALG_NAME,_aead_decrypt)
-    (unsigned char *m, unsigned long long *mlen,
+int ISAP_CONCAT(ISAP_ALG_NAME,_aead_decrypt_vec)
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     ISAP_STATE state;
     unsigned char tag[ISAP_TAG_SIZE];
+    unsigned char received[ISAP_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < ISAP_TAG_SIZE)
         return -1;
     *mlen = clen - ISAP_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Authenticate the associated data and ciphertext to generate the tag */
-    ISAP_CONCAT(ISAP_ALG_NAME,_mac)(&state, k, npub, ad, adlen, c, *mlen, tag);
+    ISAP_CONCAT(ISAP_ALG_NAME,_mac)
+        (&state, k, npub, &adcur, adlen, &ccur, *mlen, tag);
+    aead_iovec_read(&ccur, received, ISAP_TAG_SIZE);
 
     /* Decrypt the ciphertext to produce the plaintext */
-    ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)(&state, k, npub, m, c, *mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    ISAP_CONCAT(ISAP_ALG_NAME,_encrypt)(&state, k, npub, &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, tag, c + *mlen, ISAP_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, tag, received, ISAP_TAG_SIZE);
+}
+
+int ISAP_CONCAT(ISAP_ALG_NAME,_aead_encrypt)
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + ISAP_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return ISAP_CONCAT(ISAP_ALG_NAME,_aead_encrypt_vec)
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int ISAP_CONCAT(ISAP_ALG_NAME,_aead_decrypt)
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= ISAP_TAG_SIZE ? clen - ISAP_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return ISAP_CONCAT(ISAP_ALG_NAME,_aead_decrypt_vec)
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 #endif /* ISAP_ALG_NAME */
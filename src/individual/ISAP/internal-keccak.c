@@ -21,6 +21,7 @@
  */
 
 #include "internal-keccak.h"
+#include "internal-cpu.h"
 
 #if !defined(__AVR__)
 
@@ -41,6 +42,7 @@ void keccakp_200_permute(keccakp_200_state_t *state)
     uint8_t D;
     unsigned round;
     unsigned index, index2;
+    aead_count_call(AEAD_PRIMITIVE_KECCAKP_200_PERMUTE);
     for (round = 0; round < 18; ++round) {
         /* Step mapping theta.  The specification mentions two temporary
          * arrays of size 5 called C and D.  Compute D on the fly */
@@ -103,12 +105,9 @@ void keccakp_200_permute(keccakp_200_state_t *state)
     }
 }
 
-#if defined(LW_UTIL_LITTLE_ENDIAN)
-#define keccakp_400_permute_host keccakp_400_permute
-#endif
-
 /* Keccak-p[400] that assumes that the input is already in host byte order */
-void keccakp_400_permute_host(keccakp_400_state_t *state, unsigned rounds)
+static LW_CPU_INLINE void keccakp_400_permute_host
+    (keccakp_400_state_t *state, unsigned rounds)
 {
     static uint16_t const RC[20] = {
         0x0001, 0x8082, 0x808A, 0x8000, 0x808B, 0x0001, 0x8081, 0x8009,
@@ -119,6 +118,7 @@ void keccakp_400_permute_host(keccakp_400_state_t *state, unsigned rounds)
     uint16_t D;
     unsigned round;
     unsigned index, index2;
+    aead_count_call(AEAD_PRIMITIVE_KECCAKP_400_PERMUTE);
     for (round = 20 - rounds; round < 20; ++round) {
         /* Step mapping theta.  The specification mentions two temporary
          * arrays of size 5 called C and D.  Compute D on the fly */
@@ -181,7 +181,51 @@ void keccakp_400_permute_host(keccakp_400_state_t *state, unsigned rounds)
     }
 }
 
-#if !defined(LW_UTIL_LITTLE_ENDIAN)
+#if defined(LW_CPU_DISPATCH)
+
+/* Keccak-p[400] variant for CPUs with BMI1 and BMI2 */
+LW_CPU_TARGET("bmi,bmi2") static void keccakp_400_permute_bmi2
+    (keccakp_400_state_t *state, unsigned rounds)
+{
+    keccakp_400_permute_host(state, rounds);
+}
+
+/* Keccak-p[400] variant for the baseline instruction set */
+static void keccakp_400_permute_default
+    (keccakp_400_state_t *state, unsigned rounds)
+{
+    keccakp_400_permute_host(state, rounds);
+}
+
+/**
+ * \brief Variant of keccakp_400_permute() that is bound for this CPU.
+ */
+static void (*keccakp_400_permute_fn)
+    (keccakp_400_state_t *state, unsigned rounds) = 0;
+
+/* All CPUs with dispatch are little-endian, so no byte reversal is needed */
+void keccakp_400_permute(keccakp_400_state_t *state, unsigned rounds)
+{
+    void (*fn)(keccakp_400_state_t *state, unsigned rounds) =
+        LW_CPU_LOAD(keccakp_400_permute_fn);
+    if (!fn) {
+        if (lw_cpu_features() & LW_CPU_BMI2)
+            fn = keccakp_400_permute_bmi2;
+        else
+            fn = keccakp_400_permute_default;
+        LW_CPU_STORE(keccakp_400_permute_fn, fn);
+    }
+    (*fn)(state, rounds);
+}
+
+#elif defined(LW_UTIL_LITTLE_ENDIAN)
+
+void keccakp_400_permute(keccakp_400_state_t *state, unsigned rounds)
+{
+    keccakp_400_permute_host(state, rounds);
+}
+
+#else /* !LW_UTIL_LITTLE_ENDIAN */
 
 /**
  * \brief Reverses the bytes in a Keccak-p[400] state.
@@ -209,6 +253,6 @@ void keccakp_400_permute(keccakp_400_state_t *state, unsigned rounds)
     keccakp_400_reverse_bytes(state);
 }
 
-#endif
+#endif /* !LW_UTIL_LITTLE_ENDIAN */
 
 #endif /* !__AVR__ */
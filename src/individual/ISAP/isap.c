@@ -23,6 +23,7 @@
 #include "isap.h"
 #include "internal-keccak.h"
 #include "internal-ascon.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const isap_keccak_128a_cipher = {
@@ -32,7 +33,18 @@ aead_cipher_t const isap_keccak_128a_cipher = {
     ISAP_TAG_SIZE,
     AEAD_FLAG_NONE,
     isap_keccak_128a_aead_encrypt,
-    isap_keccak_128a_aead_decrypt
+    isap_keccak_128a_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    isap_keccak_128a_aead_encrypt_vec,
+    isap_keccak_128a_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const isap_ascon_128a_cipher = {
@@ -42,7 +54,18 @@ aead_cipher_t const isap_ascon_128a_cipher = {
     ISAP_TAG_SIZE,
     AEAD_FLAG_NONE,
     isap_ascon_128a_aead_encrypt,
-    isap_ascon_128a_aead_decrypt
+    isap_ascon_128a_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    isap_ascon_128a_aead_encrypt_vec,
+    isap_ascon_128a_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const isap_keccak_128_cipher = {
@@ -52,7 +75,18 @@ aead_cipher_t const isap_keccak_128_cipher = {
     ISAP_TAG_SIZE,
     AEAD_FLAG_NONE,
     isap_keccak_128_aead_encrypt,
-    isap_keccak_128_aead_decrypt
+    isap_keccak_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    isap_keccak_128_aead_encrypt_vec,
+    isap_keccak_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const isap_ascon_128_cipher = {
@@ -62,7 +96,18 @@ aead_cipher_t const isap_ascon_128_cipher = {
     ISAP_TAG_SIZE,
     AEAD_FLAG_NONE,
     isap_ascon_128_aead_encrypt,
-    isap_ascon_128_aead_decrypt
+    isap_ascon_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    isap_ascon_128_aead_encrypt_vec,
+    isap_ascon_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /* ISAP-K-128A */
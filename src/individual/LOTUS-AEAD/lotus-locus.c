@@ -22,28 +22,22 @@
 
 #include "lotus-locus.h"
 #include "internal-gift64.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
-aead_cipher_t const lotus_aead_cipher = {
-    "LOTUS-AEAD",
-    LOTUS_AEAD_KEY_SIZE,
-    LOTUS_AEAD_NONCE_SIZE,
-    LOTUS_AEAD_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    lotus_aead_encrypt,
-    lotus_aead_decrypt
-};
+/**
+ * \brief Key context for LOTUS-AEAD and LOCUS-AEAD.
+ */
+typedef struct
+{
+    /** Copy of the key, which is combined with the nonce for each packet */
+    unsigned char k[LOTUS_AEAD_KEY_SIZE];
 
-aead_cipher_t const locus_aead_cipher = {
-    "LOCUS-AEAD",
-    LOCUS_AEAD_KEY_SIZE,
-    LOCUS_AEAD_NONCE_SIZE,
-    LOCUS_AEAD_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    locus_aead_encrypt,
-    locus_aead_decrypt
-};
+    /** Encryption of the zero block under the key, which is the
+     *  starting point for deriving the Delta-N value for each packet */
+    unsigned char delta0[GIFT64_BLOCK_SIZE];
+
+} lotus_or_locus_context_t;
 
 /**
  * \brief Multiplies a key by 2 in the GF(128) field.
@@ -60,12 +54,28 @@ STATIC_INLINE void lotus_or_locus_mul_2(gift64n_key_schedule_t *ks)
     gift64n_update_round_keys(ks);
 }
 
+/**
+ * \brief Sets up the key context for LOTUS-AEAD or LOCUS-AEAD.
+ *
+ * \param ctx Points to the key context to initialize.
+ * \param k Points to the 16-byte key for the cipher instance.
+ */
+static void lotus_or_locus_setup_key(void *ctx, const unsigned char *k)
+{
+    lotus_or_locus_context_t *context = (lotus_or_locus_context_t *)ctx;
+    gift64n_key_schedule_t ks;
+    gift64n_init(&ks, k);
+    memset(context->delta0, 0, GIFT64_BLOCK_SIZE);
+    gift64t_encrypt(&ks, context->delta0, context->delta0, GIFT64T_TWEAK_0);
+    memcpy(context->k, k, LOTUS_AEAD_KEY_SIZE);
+}
+
 /**
  * \brief Initializes a LOTUS-AEAD or LOCUS-AEAD cipher instance.
  *
  * \param ks Key schedule to initialize.
  * \param deltaN Delta-N value for the cipher state.
- * \param key Points to the 16-byte key for the cipher instance.
+ * \param context Points to the key context for the cipher instance.
  * \param nonce Points to the 16-byte key for the cipher instance.
  * \param T Points to a temporary buffer of LOTUS_AEAD_KEY_SIZE bytes
  * that will be destroyed during this function.
@@ -73,14 +83,12 @@ STATIC_INLINE void lotus_or_locus_mul_2(gift64n_key_schedule_t *ks)
 static void lotus_or_locus_init
     (gift64n_key_schedule_t *ks,
      unsigned char deltaN[GIFT64_BLOCK_SIZE],
-     const unsigned char *key,
+     const lotus_or_locus_context_t *context,
      const unsigned char *nonce,
      unsigned char *T)
 {
-    gift64n_init(ks, key);
-    memset(deltaN, 0, GIFT64_BLOCK_SIZE);
-    gift64t_encrypt(ks, deltaN, deltaN, GIFT64T_TWEAK_0);
-    lw_xor_block_2_src(T, key, nonce, LOTUS_AEAD_KEY_SIZE);
+    memcpy(deltaN, context->delta0, GIFT64_BLOCK_SIZE);
+    lw_xor_block_2_src(T, context->k, nonce, LOTUS_AEAD_KEY_SIZE);
     gift64n_init(ks, T);
     gift64t_encrypt(ks, deltaN, deltaN, GIFT64T_TWEAK_1);
 }
@@ -91,34 +99,37 @@ static void lotus_or_locus_init
  * \param ks Points to the key schedule.
  * \param deltaN Points to the Delta-N value from the state.
  * \param V Points to the V value from the state.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes, must be non-zero.
  */
 static void lotus_or_locus_process_ad
     (gift64n_key_schedule_t *ks,
      const unsigned char deltaN[GIFT64_BLOCK_SIZE],
      unsigned char V[GIFT64_BLOCK_SIZE],
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
     unsigned char X[GIFT64_BLOCK_SIZE];
+    unsigned char block[GIFT64_BLOCK_SIZE];
+    const unsigned char *in;
     unsigned char temp;
     while (adlen > GIFT64_BLOCK_SIZE) {
         lotus_or_locus_mul_2(ks);
-        lw_xor_block_2_src(X, ad, deltaN, GIFT64_BLOCK_SIZE);
+        in = aead_iovec_load_block(ad, block, GIFT64_BLOCK_SIZE);
+        lw_xor_block_2_src(X, in, deltaN, GIFT64_BLOCK_SIZE);
         gift64t_encrypt(ks, X, X, GIFT64T_TWEAK_2);
         lw_xor_block(V, X, GIFT64_BLOCK_SIZE);
-        ad += GIFT64_BLOCK_SIZE;
         adlen -= GIFT64_BLOCK_SIZE;
     }
     lotus_or_locus_mul_2(ks);
     temp = (unsigned)adlen;
+    in = aead_iovec_load_block(ad, block, temp);
     if (temp < GIFT64_BLOCK_SIZE) {
         memcpy(X, deltaN, GIFT64_BLOCK_SIZE);
-        lw_xor_block(X, ad, temp);
+        lw_xor_block(X, in, temp);
         X[temp] ^= 0x01;
         gift64t_encrypt(ks, X, X, GIFT64T_TWEAK_3);
     } else {
-        lw_xor_block_2_src(X, ad, deltaN, GIFT64_BLOCK_SIZE);
+        lw_xor_block_2_src(X, in, deltaN, GIFT64_BLOCK_SIZE);
         gift64t_encrypt(ks, X, X, GIFT64T_TWEAK_2);
     }
     lw_xor_block(V, X, GIFT64_BLOCK_SIZE);
@@ -146,56 +157,78 @@ static void lotus_or_locus_gen_tag
     lw_xor_block_2_src(tag, W, deltaN, GIFT64_BLOCK_SIZE);
 }
 
-int lotus_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Encrypts and authenticates a packet with LOTUS-AEAD using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int lotus_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
+    const lotus_or_locus_context_t *context =
+        (const lotus_or_locus_context_t *)ctx;
     gift64n_key_schedule_t ks;
     unsigned char WV[GIFT64_BLOCK_SIZE * 2];
     unsigned char deltaN[GIFT64_BLOCK_SIZE];
     unsigned char X1[GIFT64_BLOCK_SIZE];
     unsigned char X2[GIFT64_BLOCK_SIZE];
+    unsigned char inbuf[GIFT64_BLOCK_SIZE * 2];
+    unsigned char outbuf[GIFT64_BLOCK_SIZE * 2];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + LOTUS_AEAD_TAG_SIZE))
+        return -2;
     *clen = mlen + LOTUS_AEAD_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state with the key and the nonce */
-    lotus_or_locus_init(&ks, deltaN, k, npub, WV);
+    lotus_or_locus_init(&ks, deltaN, context, npub, WV);
     memset(WV, 0, sizeof(WV));
 
     /* Process the associated data */
     if (adlen > 0) {
         lotus_or_locus_process_ad
-            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, ad, adlen);
+            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, &adcur, adlen);
     }
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         while (mlen > (GIFT64_BLOCK_SIZE * 2)) {
+            in = aead_iovec_load_block(&mcur, inbuf, GIFT64_BLOCK_SIZE * 2);
+            out = aead_iovec_store_begin(&ccur, outbuf, GIFT64_BLOCK_SIZE * 2);
             lotus_or_locus_mul_2(&ks);
-            lw_xor_block_2_src(X1, m, deltaN, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(X1, in, deltaN, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X1, GIFT64T_TWEAK_4);
             lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_4);
             lw_xor_block_2_src
-                (X2, m + GIFT64_BLOCK_SIZE, X2, GIFT64_BLOCK_SIZE);
-            lw_xor_block_2_src(c, X2, deltaN, GIFT64_BLOCK_SIZE);
+                (X2, in + GIFT64_BLOCK_SIZE, X2, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(out, X2, deltaN, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_5);
             lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_5);
             lw_xor_block_2_src
-                (c + GIFT64_BLOCK_SIZE, X1, X2, GIFT64_BLOCK_SIZE);
-            c += GIFT64_BLOCK_SIZE * 2;
-            m += GIFT64_BLOCK_SIZE * 2;
+                (out + GIFT64_BLOCK_SIZE, X1, X2, GIFT64_BLOCK_SIZE);
+            aead_iovec_store_end(&ccur, outbuf, out, GIFT64_BLOCK_SIZE * 2);
             mlen -= GIFT64_BLOCK_SIZE * 2;
         }
         temp = (unsigned)mlen;
+        in = aead_iovec_load_block(&mcur, inbuf, temp);
+        out = aead_iovec_store_begin(&ccur, outbuf, temp);
         lotus_or_locus_mul_2(&ks);
         memcpy(X1, deltaN, GIFT64_BLOCK_SIZE);
         X1[0] ^= (unsigned char)temp;
@@ -203,83 +236,104 @@ int lotus_aead_encrypt
         lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
         gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_12);
         if (temp <= GIFT64_BLOCK_SIZE) {
-            lw_xor_block(WV, m, temp);
-            lw_xor_block(X2, m, temp);
-            lw_xor_block_2_src(c, X2, deltaN, temp);
+            lw_xor_block(WV, in, temp);
+            lw_xor_block_2_src(out, X2, in, temp);
+            lw_xor_block(out, deltaN, temp);
         } else {
-            lw_xor_block(X2, m, GIFT64_BLOCK_SIZE);
-            lw_xor_block_2_src(c, X2, deltaN, GIFT64_BLOCK_SIZE);
-            c += GIFT64_BLOCK_SIZE;
-            m += GIFT64_BLOCK_SIZE;
+            lw_xor_block(X2, in, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(out, X2, deltaN, GIFT64_BLOCK_SIZE);
             temp -= GIFT64_BLOCK_SIZE;
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_13);
             lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_13);
-            lw_xor_block(WV, m, temp);
+            lw_xor_block(WV, in + GIFT64_BLOCK_SIZE, temp);
             lw_xor_block(X1, X2, temp);
-            lw_xor_block_2_src(c, X1, m, temp);
+            lw_xor_block_2_src
+                (out + GIFT64_BLOCK_SIZE, X1, in + GIFT64_BLOCK_SIZE, temp);
         }
-        c += temp;
+        aead_iovec_store_end(&ccur, outbuf, out, (size_t)mlen);
     }
 
     /* Generate the authentication tag */
-    lotus_or_locus_gen_tag(&ks, c, deltaN, WV, WV + GIFT64_BLOCK_SIZE);
+    lotus_or_locus_gen_tag(&ks, WV, deltaN, WV, WV + GIFT64_BLOCK_SIZE);
+    aead_iovec_write(&ccur, WV, LOTUS_AEAD_TAG_SIZE);
     return 0;
 }
 
-int lotus_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+/**
+ * \brief Decrypts and authenticates a packet with LOTUS-AEAD using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int lotus_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
+    const lotus_or_locus_context_t *context =
+        (const lotus_or_locus_context_t *)ctx;
     gift64n_key_schedule_t ks;
     unsigned char WV[GIFT64_BLOCK_SIZE * 2];
     unsigned char deltaN[GIFT64_BLOCK_SIZE];
     unsigned char X1[GIFT64_BLOCK_SIZE];
     unsigned char X2[GIFT64_BLOCK_SIZE];
-    unsigned char *mtemp = m;
+    unsigned char inbuf[GIFT64_BLOCK_SIZE * 2];
+    unsigned char outbuf[GIFT64_BLOCK_SIZE * 2];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < LOTUS_AEAD_TAG_SIZE)
         return -1;
     *mlen = clen - LOTUS_AEAD_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state with the key and the nonce */
-    lotus_or_locus_init(&ks, deltaN, k, npub, WV);
+    lotus_or_locus_init(&ks, deltaN, context, npub, WV);
     memset(WV, 0, sizeof(WV));
 
     /* Process the associated data */
     if (adlen > 0) {
         lotus_or_locus_process_ad
-            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, ad, adlen);
+            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, &adcur, adlen);
     }
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= LOTUS_AEAD_TAG_SIZE;
     if (clen > 0) {
         while (clen > (GIFT64_BLOCK_SIZE * 2)) {
+            in = aead_iovec_load_block(&ccur, inbuf, GIFT64_BLOCK_SIZE * 2);
+            out = aead_iovec_store_begin(&mcur, outbuf, GIFT64_BLOCK_SIZE * 2);
             lotus_or_locus_mul_2(&ks);
-            lw_xor_block_2_src(X1, c, deltaN, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(X1, in, deltaN, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X1, GIFT64T_TWEAK_5);
             lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_5);
-            lw_xor_block(X2, c + GIFT64_BLOCK_SIZE, GIFT64_BLOCK_SIZE);
-            lw_xor_block_2_src(m, X2, deltaN, GIFT64_BLOCK_SIZE);
+            lw_xor_block(X2, in + GIFT64_BLOCK_SIZE, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(out, X2, deltaN, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_4);
             lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_4);
             lw_xor_block_2_src
-                (m + GIFT64_BLOCK_SIZE, X1, X2, GIFT64_BLOCK_SIZE);
-            c += GIFT64_BLOCK_SIZE * 2;
-            m += GIFT64_BLOCK_SIZE * 2;
+                (out + GIFT64_BLOCK_SIZE, X1, X2, GIFT64_BLOCK_SIZE);
+            aead_iovec_store_end(&mcur, outbuf, out, GIFT64_BLOCK_SIZE * 2);
             clen -= GIFT64_BLOCK_SIZE * 2;
         }
         temp = (unsigned)clen;
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
         lotus_or_locus_mul_2(&ks);
         memcpy(X1, deltaN, GIFT64_BLOCK_SIZE);
         X1[0] ^= (unsigned char)temp;
@@ -287,137 +341,226 @@ int lotus_aead_decrypt
         lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
         gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_12);
         if (temp <= GIFT64_BLOCK_SIZE) {
-            lw_xor_block_2_src(m, X2, c, temp);
-            lw_xor_block(m, deltaN, temp);
-            lw_xor_block(X2, m, temp);
-            lw_xor_block(WV, m, temp);
+            lw_xor_block_2_src(out, X2, in, temp);
+            lw_xor_block(out, deltaN, temp);
+            lw_xor_block(WV, out, temp);
         } else {
-            lw_xor_block_2_src(m, X2, c, GIFT64_BLOCK_SIZE);
-            lw_xor_block(m, deltaN, GIFT64_BLOCK_SIZE);
-            lw_xor_block(X2, m, GIFT64_BLOCK_SIZE);
-            c += GIFT64_BLOCK_SIZE;
-            m += GIFT64_BLOCK_SIZE;
+            lw_xor_block_2_src(out, X2, in, GIFT64_BLOCK_SIZE);
+            lw_xor_block(out, deltaN, GIFT64_BLOCK_SIZE);
+            lw_xor_block(X2, out, GIFT64_BLOCK_SIZE);
             temp -= GIFT64_BLOCK_SIZE;
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_13);
             lw_xor_block(WV, X2, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X2, X2, GIFT64T_TWEAK_13);
             lw_xor_block(X1, X2, temp);
-            lw_xor_block_2_src(m, X1, c, temp);
-            lw_xor_block(WV, m, temp);
+            lw_xor_block_2_src
+                (out + GIFT64_BLOCK_SIZE, X1, in + GIFT64_BLOCK_SIZE, temp);
+            lw_xor_block(WV, out + GIFT64_BLOCK_SIZE, temp);
         }
-        c += temp;
+        aead_iovec_store_end(&mcur, outbuf, out, (size_t)clen);
     }
 
     /* Check the authentication tag */
     lotus_or_locus_gen_tag(&ks, WV, deltaN, WV, WV + GIFT64_BLOCK_SIZE);
-    return aead_check_tag(mtemp, *mlen, WV, c, LOTUS_AEAD_TAG_SIZE);
+    aead_iovec_read(&ccur, inbuf, LOTUS_AEAD_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, WV, inbuf, LOTUS_AEAD_TAG_SIZE);
 }
 
-int locus_aead_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with LOTUS-AEAD using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int lotus_aead_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + LOTUS_AEAD_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return lotus_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, ctx);
+}
+
+/**
+ * \brief Decrypts and authenticates a packet with LOTUS-AEAD using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int lotus_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= LOTUS_AEAD_TAG_SIZE ?
+                   clen - LOTUS_AEAD_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return lotus_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+/**
+ * \brief Encrypts and authenticates a packet with LOCUS-AEAD using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int locus_aead_encrypt_vec_ctx
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    const lotus_or_locus_context_t *context =
+        (const lotus_or_locus_context_t *)ctx;
     gift64n_key_schedule_t ks;
     unsigned char WV[GIFT64_BLOCK_SIZE * 2];
     unsigned char deltaN[GIFT64_BLOCK_SIZE];
     unsigned char X[GIFT64_BLOCK_SIZE];
+    unsigned char inbuf[GIFT64_BLOCK_SIZE];
+    unsigned char outbuf[GIFT64_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + LOCUS_AEAD_TAG_SIZE))
+        return -2;
     *clen = mlen + LOCUS_AEAD_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state with the key and the nonce */
-    lotus_or_locus_init(&ks, deltaN, k, npub, WV);
+    lotus_or_locus_init(&ks, deltaN, context, npub, WV);
     memset(WV, 0, sizeof(WV));
 
     /* Process the associated data */
     if (adlen > 0) {
         lotus_or_locus_process_ad
-            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, ad, adlen);
+            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, &adcur, adlen);
     }
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         while (mlen > GIFT64_BLOCK_SIZE) {
+            in = aead_iovec_load_block(&mcur, inbuf, GIFT64_BLOCK_SIZE);
+            out = aead_iovec_store_begin(&ccur, outbuf, GIFT64_BLOCK_SIZE);
             lotus_or_locus_mul_2(&ks);
-            lw_xor_block_2_src(X, m, deltaN, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(X, in, deltaN, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X, X, GIFT64T_TWEAK_4);
             lw_xor_block(WV, X, GIFT64_BLOCK_SIZE);
             gift64t_encrypt(&ks, X, X, GIFT64T_TWEAK_4);
-            lw_xor_block_2_src(c, X, deltaN, GIFT64_BLOCK_SIZE);
-            c += GIFT64_BLOCK_SIZE;
-            m += GIFT64_BLOCK_SIZE;
+            lw_xor_block_2_src(out, X, deltaN, GIFT64_BLOCK_SIZE);
+            aead_iovec_store_end(&ccur, outbuf, out, GIFT64_BLOCK_SIZE);
             mlen -= GIFT64_BLOCK_SIZE;
         }
         temp = (unsigned)mlen;
+        in = aead_iovec_load_block(&mcur, inbuf, temp);
+        out = aead_iovec_store_begin(&ccur, outbuf, temp);
         lotus_or_locus_mul_2(&ks);
         memcpy(X, deltaN, GIFT64_BLOCK_SIZE);
         X[0] ^= (unsigned char)temp;
         gift64t_encrypt(&ks, X, X, GIFT64T_TWEAK_5);
         lw_xor_block(WV, X, GIFT64_BLOCK_SIZE);
-        lw_xor_block(WV, m, temp);
+        lw_xor_block(WV, in, temp);
         gift64t_encrypt(&ks, X, X, GIFT64T_TWEAK_5);
         lw_xor_block(X, deltaN, temp);
-        lw_xor_block_2_src(c, m, X, temp);
-        c += temp;
+        lw_xor_block_2_src(out, in, X, temp);
+        aead_iovec_store_end(&ccur, outbuf, out, temp);
     }
 
     /* Generate the authentication tag */
-    lotus_or_locus_gen_tag(&ks, c, deltaN, WV, WV + GIFT64_BLOCK_SIZE);
+    lotus_or_locus_gen_tag(&ks, WV, deltaN, WV, WV + GIFT64_BLOCK_SIZE);
+    aead_iovec_write(&ccur, WV, LOCUS_AEAD_TAG_SIZE);
     return 0;
 }
 
-int locus_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+/**
+ * \brief Decrypts and authenticates a packet with LOCUS-AEAD using a
+ * key context that was set up previously, with the packet split into
+ * scatter/gather segments.
+ */
+static int locus_aead_decrypt_vec_ctx
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
+    const lotus_or_locus_context_t *context =
+        (const lotus_or_locus_context_t *)ctx;
     gift64n_key_schedule_t ks;
     unsigned char WV[GIFT64_BLOCK_SIZE * 2];
     unsigned char deltaN[GIFT64_BLOCK_SIZE];
     unsigned char X[GIFT64_BLOCK_SIZE];
-    unsigned char *mtemp = m;
+    unsigned char inbuf[GIFT64_BLOCK_SIZE];
+    unsigned char outbuf[GIFT64_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < LOCUS_AEAD_TAG_SIZE)
         return -1;
     *mlen = clen - LOCUS_AEAD_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state with the key and the nonce */
-    lotus_or_locus_init(&ks, deltaN, k, npub, WV);
+    lotus_or_locus_init(&ks, deltaN, context, npub, WV);
     memset(WV, 0, sizeof(WV));
 
     /* Process the associated data */
     if (adlen > 0) {
         lotus_or_locus_process_ad
-            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, ad, adlen);
+            (&ks, deltaN, WV + GIFT64_BLOCK_SIZE, &adcur, adlen);
     }
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= LOCUS_AEAD_TAG_SIZE;
     if (clen > 0) {
         while (clen > GIFT64_BLOCK_SIZE) {
+            in = aead_iovec_load_block(&ccur, inbuf, GIFT64_BLOCK_SIZE);
+            out = aead_iovec_store_begin(&mcur, outbuf, GIFT64_BLOCK_SIZE);
             lotus_or_locus_mul_2(&ks);
-            lw_xor_block_2_src(X, c, deltaN, GIFT64_BLOCK_SIZE);
+            lw_xor_block_2_src(X, in, deltaN, GIFT64_BLOCK_SIZE);
             gift64t_decrypt(&ks, X, X, GIFT64T_TWEAK_4);
             lw_xor_block(WV, X, GIFT64_BLOCK_SIZE);
             gift64t_decrypt(&ks, X, X, GIFT64T_TWEAK_4);
-            lw_xor_block_2_src(m, X, deltaN, GIFT64_BLOCK_SIZE);
-            c += GIFT64_BLOCK_SIZE;
-            m += GIFT64_BLOCK_SIZE;
+            lw_xor_block_2_src(out, X, deltaN, GIFT64_BLOCK_SIZE);
+            aead_iovec_store_end(&mcur, outbuf, out, GIFT64_BLOCK_SIZE);
             clen -= GIFT64_BLOCK_SIZE;
         }
         temp = (unsigned)clen;
+        in = aead_iovec_load_block(&ccur, inbuf, temp);
+        out = aead_iovec_store_begin(&mcur, outbuf, temp);
         lotus_or_locus_mul_2(&ks);
         memcpy(X, deltaN, GIFT64_BLOCK_SIZE);
         X[0] ^= (unsigned char)temp;
@@ -425,12 +568,213 @@ int locus_aead_decrypt
         lw_xor_block(WV, X, GIFT64_BLOCK_SIZE);
         gift64t_encrypt(&ks, X, X, GIFT64T_TWEAK_5);
         lw_xor_block(X, deltaN, temp);
-        lw_xor_block_2_src(m, c, X, temp);
-        lw_xor_block(WV, m, temp);
-        c += temp;
+        lw_xor_block_2_src(out, in, X, temp);
+        lw_xor_block(WV, out, temp);
+        aead_iovec_store_end(&mcur, outbuf, out, temp);
     }
 
     /* Check the authentication tag */
     lotus_or_locus_gen_tag(&ks, WV, deltaN, WV, WV + GIFT64_BLOCK_SIZE);
-    return aead_check_tag(mtemp, *mlen, WV, c, LOCUS_AEAD_TAG_SIZE);
+    aead_iovec_read(&ccur, inbuf, LOCUS_AEAD_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, WV, inbuf, LOCUS_AEAD_TAG_SIZE);
+}
+
+/**
+ * \brief Encrypts and authenticates a packet with LOCUS-AEAD using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int locus_aead_encrypt_ctx
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + LOCUS_AEAD_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return locus_aead_encrypt_vec_ctx
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, ctx);
 }
+
+/**
+ * \brief Decrypts and authenticates a packet with LOCUS-AEAD using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int locus_aead_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= LOCUS_AEAD_TAG_SIZE ?
+                   clen - LOCUS_AEAD_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return locus_aead_decrypt_vec_ctx
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, ctx);
+}
+
+int lotus_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return lotus_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &context);
+}
+
+int lotus_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return lotus_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &context);
+}
+
+int lotus_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return lotus_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, nsec, npub, &context);
+}
+
+int lotus_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return lotus_aead_decrypt_vec_ctx
+        (m, m_count, mlen, nsec, c, c_count, ad, ad_count, npub, &context);
+}
+
+int locus_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return locus_aead_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &context);
+}
+
+int locus_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return locus_aead_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &context);
+}
+
+int locus_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return locus_aead_encrypt_vec_ctx
+        (c, c_count, clen, m, m_count, ad, ad_count, nsec, npub, &context);
+}
+
+int locus_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    lotus_or_locus_context_t context;
+    lotus_or_locus_setup_key(&context, k);
+    return locus_aead_decrypt_vec_ctx
+        (m, m_count, mlen, nsec, c, c_count, ad, ad_count, npub, &context);
+}
+
+aead_cipher_t const lotus_aead_cipher = {
+    "LOTUS-AEAD",
+    LOTUS_AEAD_KEY_SIZE,
+    LOTUS_AEAD_NONCE_SIZE,
+    LOTUS_AEAD_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    lotus_aead_encrypt,
+    lotus_aead_decrypt,
+    sizeof(lotus_or_locus_context_t),
+    lotus_or_locus_setup_key,
+    lotus_aead_encrypt_ctx,
+    lotus_aead_decrypt_ctx,
+    lotus_aead_encrypt_vec,
+    lotus_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const locus_aead_cipher = {
+    "LOCUS-AEAD",
+    LOCUS_AEAD_KEY_SIZE,
+    LOCUS_AEAD_NONCE_SIZE,
+    LOCUS_AEAD_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    locus_aead_encrypt,
+    locus_aead_decrypt,
+    sizeof(lotus_or_locus_context_t),
+    lotus_or_locus_setup_key,
+    locus_aead_encrypt_ctx,
+    locus_aead_decrypt_ctx,
+    locus_aead_encrypt_vec,
+    locus_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
@@ -377,6 +377,8 @@ void photon256_permute(unsigned char state[PHOTON256_STATE_SIZE])
     uint32_t t0, t1, t2, t3, t4, t5, t6, t7, t8;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PHOTON256_PERMUTE);
+
     /* Convert the state into bit-sliced form */
     photon256_to_sliced(S.words, state);
 
@@ -38,6 +38,40 @@
 extern "C" {
 #endif
 
+/**
+ * \brief Segment of a scatter/gather buffer for the vectored AEAD functions.
+ *
+ * Input segments are never modified even though \a data is not const.
+ */
+typedef struct
+{
+    unsigned char *data;    /**< Points to the data in the segment */
+    size_t len;             /**< Length of the segment in bytes */
+
+} aead_iovec_t;
+
+/**
+ * \brief Descriptor for one packet in a batch of AEAD operations.
+ *
+ * Each packet uses either a raw key in \a key or a key context from
+ * aead_cipher_setup_key() in \a ctx.  If \a ctx is not NULL, then it
+ * takes precedence over \a key.
+ */
+typedef struct
+{
+    const unsigned char *key;   /**< Raw key for the packet, or NULL */
+    const void *ctx;            /**< Key context for the packet, or NULL */
+    const unsigned char *npub;  /**< Public nonce for the packet */
+    const unsigned char *ad;    /**< Associated data for the packet */
+    unsigned long long adlen;   /**< Length of the associated data */
+    const unsigned char *in;    /**< Plaintext or ciphertext input */
+    unsigned long long inlen;   /**< Length of the input in bytes */
+    unsigned char *out;         /**< Buffer for the output */
+    unsigned long long outlen;  /**< Length of the output on exit */
+    int result;                 /**< Result of the operation on exit */
+
+} aead_packet_t;
+
 /**
  * \brief Encrypts and authenticates a packet with an AEAD scheme.
  *
@@ -55,6 +89,10 @@ extern "C" {
  *
  * \return 0 on success, or a negative value if there was an error in
  * the parameters.
+ *
+ * Encryption can be performed in-place by setting \a c to the same
+ * buffer as \a m.  The buffer must have room for the ciphertext and
+ * the tag.  Partially overlapping buffers are not supported.
  */
 typedef int (*aead_cipher_encrypt_t)
     (unsigned char *c, unsigned long long *clen,
@@ -82,6 +120,9 @@ typedef int (*aead_cipher_encrypt_t)
  *
  * \return 0 on success, -1 if the authentication tag was incorrect,
  * or some other negative number if there was an error in the parameters.
+ *
+ * Decryption can be performed in-place by setting \a m to the same
+ * buffer as \a c.  Partially overlapping buffers are not supported.
  */
 typedef int (*aead_cipher_decrypt_t)
     (unsigned char *m, unsigned long long *mlen,
@@ -91,6 +132,209 @@ typedef int (*aead_cipher_decrypt_t)
      const unsigned char *npub,
      const unsigned char *k);
 
+/**
+ * \brief Expands a key into a context that can be reused for many packets.
+ *
+ * \param ctx Points to the context to initialize, which must be at least
+ * aead_cipher_context_size() bytes in length and aligned for any type.
+ * \param k Points to the key to expand.
+ *
+ * The context holds the expanded key schedule and any other values that
+ * depend only upon the key.  It contains secret key material and should
+ * be cleared by the application when it is no longer required.
+ */
+typedef void (*aead_cipher_setup_key_t)(void *ctx, const unsigned char *k);
+
+/**
+ * \brief Selects the default key schedule for the platform.
+ */
+#define AEAD_SCHEDULE_DEFAULT 0
+
+/**
+ * \brief Selects a fully expanded key schedule, which is the fastest
+ * but uses the most memory in each key context.
+ */
+#define AEAD_SCHEDULE_FULL 1
+
+/**
+ * \brief Selects a partially expanded key schedule, which trades some
+ * speed for a smaller key context.
+ */
+#define AEAD_SCHEDULE_SMALL 2
+
+/**
+ * \brief Selects a key schedule that is expanded on the fly, which is
+ * the slowest but has the smallest key context.
+ *
+ * Ciphers without a tiny key schedule use their small key schedule.
+ */
+#define AEAD_SCHEDULE_TINY 3
+
+/**
+ * \brief Gets the size of the key context for a key schedule variant.
+ *
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * \return The number of bytes that the key context needs for the variant.
+ */
+typedef size_t (*aead_cipher_schedule_size_t)(unsigned schedule);
+
+/**
+ * \brief Expands a key into a context with a specific key schedule variant.
+ *
+ * \param ctx Points to the context to initialize, which must be at least
+ * as large as the size for \a schedule and aligned for any type.
+ * \param k Points to the key to expand.
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * The context records the variant, so the regular encrypt and decrypt
+ * functions for key contexts work with any variant.
+ */
+typedef void (*aead_cipher_setup_key_schedule_t)
+    (void *ctx, const unsigned char *k, unsigned schedule);
+
+/**
+ * \brief Encrypts and authenticates a packet using a pre-expanded key.
+ *
+ * \param c Buffer to receive the output.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the authentication tag.
+ * \param m Buffer that contains the plaintext message to encrypt.
+ * \param mlen Length of the plaintext message in bytes.
+ * \param ad Buffer that contains associated data to authenticate
+ * along with the packet but which does not need to be encrypted.
+ * \param adlen Length of the associated data in bytes.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx Points to the key context that was initialized by a
+ * previous call to the key setup function.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ */
+typedef int (*aead_cipher_encrypt_ctx_t)
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx);
+
+/**
+ * \brief Decrypts and authenticates a packet using a pre-expanded key.
+ *
+ * \param m Buffer to receive the plaintext message on output.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param c Buffer that contains the ciphertext and authentication
+ * tag to decrypt.
+ * \param clen Length of the input data in bytes, which includes the
+ * ciphertext and the authentication tag.
+ * \param ad Buffer that contains associated data to authenticate
+ * along with the packet but which does not need to be encrypted.
+ * \param adlen Length of the associated data in bytes.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx Points to the key context that was initialized by a
+ * previous call to the key setup function.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ */
+typedef int (*aead_cipher_decrypt_ctx_t)
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx);
+
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet.
+ *
+ * \param c Array of segments to receive the output, which is the
+ * ciphertext followed by the authentication tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.  It is an error if the segments in \a c are not large
+ * enough to hold the ciphertext and the authentication tag.
+ *
+ * The output segments may alias the plaintext segments as long as each
+ * output byte is at the same position as the corresponding input byte.
+ */
+typedef int (*aead_cipher_encrypt_vec_t)
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet.
+ *
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param c Array of segments that contain the ciphertext and the
+ * authentication tag, which may straddle a segment boundary.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ */
+typedef int (*aead_cipher_decrypt_vec_t)
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a batch of independent packets.
+ *
+ * \param packets Points to the array of packet descriptors.  On exit,
+ * the "outlen" and "result" fields of every packet are filled in.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was encrypted, or the result of the first
+ * packet that failed.
+ *
+ * Ciphers provide this to process several packets at once, for example
+ * with interleaved or SIMD implementations of their permutation.
+ */
+typedef int (*aead_cipher_encrypt_batch_t)
+    (aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Decrypts and authenticates a batch of independent packets.
+ *
+ * \param packets Points to the array of packet descriptors.  On exit,
+ * the "outlen" and "result" fields of every packet are filled in.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was decrypted, or the result of the first
+ * packet that failed.  The result is -1 if the failure was an incorrect
+ * authentication tag.
+ */
+typedef int (*aead_cipher_decrypt_batch_t)
+    (aead_packet_t *packets, size_t count);
+
 /**
  * \brief Hashes a block of input data.
  *
@@ -151,6 +395,91 @@ typedef void (*aead_xof_absorb_t)
 typedef void (*aead_xof_squeeze_t)
     (void *state, unsigned char *out, unsigned long long outlen);
 
+/**
+ * \brief Initializes the state for an incremental AEAD operation.
+ *
+ * \param state Points to the incremental AEAD state to initialize.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to encrypt or decrypt the packet.
+ */
+typedef void (*aead_incremental_init_t)
+    (void *state, const unsigned char *npub, const unsigned char *k);
+
+/**
+ * \brief Absorbs more associated data into an incremental AEAD state.
+ *
+ * \param state Points to the incremental AEAD state.
+ * \param ad Points to the associated data.
+ * \param adlen Length of the associated data in bytes.
+ *
+ * This function may be called any number of times after the state is
+ * initialized, but must not be called once encryption or decryption
+ * has started.
+ */
+typedef void (*aead_incremental_ad_t)
+    (void *state, const unsigned char *ad, unsigned long long adlen);
+
+/**
+ * \brief Encrypts or decrypts more payload data with an incremental
+ * AEAD state.
+ *
+ * \param state Points to the incremental AEAD state.
+ * \param out Points to the output buffer, which may be the same as \a in.
+ * \param in Points to the input buffer.
+ * \param len Number of bytes to encrypt or decrypt.
+ *
+ * The data can be supplied in chunks of any size, including chunks that
+ * do not line up with the block size of the underlying cipher.
+ */
+typedef void (*aead_incremental_crypt_t)
+    (void *state, unsigned char *out, const unsigned char *in,
+     unsigned long long len);
+
+/**
+ * \brief Finishes an incremental AEAD encryption operation.
+ *
+ * \param state Points to the incremental AEAD state.
+ * \param tag Points to the buffer to receive the authentication tag.
+ */
+typedef void (*aead_incremental_encrypt_final_t)
+    (void *state, unsigned char *tag);
+
+/**
+ * \brief Finishes an incremental AEAD decryption operation.
+ *
+ * \param state Points to the incremental AEAD state.
+ * \param tag Points to the authentication tag to check.
+ *
+ * \return 0 if the tag is correct or -1 if it is incorrect.
+ *
+ * The plaintext has already been released to the caller by the time the
+ * tag is checked.  It must be discarded if this function returns -1.
+ */
+typedef int (*aead_incremental_decrypt_final_t)
+    (void *state, const unsigned char *tag);
+
+/**
+ * \brief Meta-information about the incremental mode of an AEAD cipher.
+ *
+ * Sponge-based ciphers can encrypt and decrypt a packet in pieces without
+ * holding the whole packet in memory.  The caller initializes a state of
+ * "state_size" bytes, passes the associated data to "update_ad" in zero
+ * or more calls, passes the payload to "encrypt_update" or "decrypt_update"
+ * in zero or more calls, and then calls "encrypt_final" or "decrypt_final".
+ * The result is the same as for the one-shot functions on the whole packet.
+ */
+typedef struct
+{
+    size_t state_size;                  /**< Size of the incremental state */
+    aead_incremental_init_t init;       /**< Initialize the state */
+    aead_incremental_ad_t update_ad;    /**< Absorb associated data */
+    aead_incremental_crypt_t encrypt_update; /**< Encrypt payload data */
+    aead_incremental_crypt_t decrypt_update; /**< Decrypt payload data */
+    aead_incremental_encrypt_final_t encrypt_final; /**< Generate the tag */
+    aead_incremental_decrypt_final_t decrypt_final; /**< Check the tag */
+
+} aead_cipher_incremental_t;
+
 /**
  * \brief No special AEAD features.
  */
@@ -168,8 +497,48 @@ typedef void (*aead_xof_squeeze_t)
  */
 #define AEAD_FLAG_LITTLE_ENDIAN 0x0001
 
+/**
+ * \brief The output of the AEAD cipher is not the ciphertext followed
+ * by the authentication tag.
+ *
+ * Ciphers with this flag cannot be used with aead_cipher_encrypt_detached()
+ * and aead_cipher_decrypt_detached().  SATURNIN-Short is an example: it
+ * always produces a single 32 byte block regardless of the plaintext length.
+ */
+#define AEAD_FLAG_NO_DETACHED_TAG 0x0002
+
 /**
  * \brief Meta-information about an AEAD cipher.
+ *
+ * Ciphers with an expensive key schedule can provide the "setup_key",
+ * "encrypt_ctx", and "decrypt_ctx" functions so that the key schedule
+ * can be computed once and then reused for many packets.  Ciphers without
+ * a key schedule leave these fields set to NULL and the generic functions
+ * aead_cipher_setup_key(), aead_cipher_encrypt_with_context(), and
+ * aead_cipher_decrypt_with_context() fall back to the regular functions.
+ *
+ * Ciphers that can walk scatter/gather segments directly provide the
+ * "encrypt_vec" and "decrypt_vec" functions.  All ciphers in this library
+ * do so except SATURNIN-Short, whose single-block output has no use for
+ * segmenting.  For ciphers without these functions, including those
+ * defined outside the library, aead_cipher_encrypt_vec() and
+ * aead_cipher_decrypt_vec() pass contiguous segments straight through
+ * and gather fragmented ones into a buffer of AEAD_VEC_BUFFER_SIZE bytes
+ * on the stack, which limits the size of fragmented packets.
+ *
+ * Sponge-based ciphers that support piecewise processing of very large
+ * packets set "incremental" to their incremental mode; others set it to
+ * NULL.
+ *
+ * Ciphers that can process several packets at the same time provide the
+ * "encrypt_batch" and "decrypt_batch" functions.  For other ciphers,
+ * aead_cipher_encrypt_batch() and aead_cipher_decrypt_batch() process
+ * the packets one at a time.
+ *
+ * Ciphers that have more than one way to lay out their key schedule
+ * provide the "schedule_size" and "setup_key_schedule" functions so that
+ * each key context can trade memory for speed.  For other ciphers, all
+ * variants are the same as the regular key context.
  */
 typedef struct
 {
@@ -180,6 +549,17 @@ typedef struct
     unsigned flags;                 /**< Flags for extra features */
     aead_cipher_encrypt_t encrypt;  /**< AEAD encryption function */
     aead_cipher_decrypt_t decrypt;  /**< AEAD decryption function */
+    size_t context_size;            /**< Size of the key context, or 0 */
+    aead_cipher_setup_key_t setup_key; /**< Key context setup function */
+    aead_cipher_encrypt_ctx_t encrypt_ctx; /**< Encrypt with key context */
+    aead_cipher_decrypt_ctx_t decrypt_ctx; /**< Decrypt with key context */
+    aead_cipher_encrypt_vec_t encrypt_vec; /**< Scatter/gather encrypt */
+    aead_cipher_decrypt_vec_t decrypt_vec; /**< Scatter/gather decrypt */
+    const aead_cipher_incremental_t *incremental; /**< Incremental mode */
+    aead_cipher_encrypt_batch_t encrypt_batch; /**< Batch encrypt */
+    aead_cipher_decrypt_batch_t decrypt_batch; /**< Batch decrypt */
+    aead_cipher_schedule_size_t schedule_size; /**< Context size per variant */
+    aead_cipher_setup_key_schedule_t setup_key_schedule; /**< Variant setup */
 
 } aead_cipher_t;
 
@@ -249,6 +629,786 @@ int aead_check_tag_precheck
      const unsigned char *tag1, const unsigned char *tag2,
      unsigned tag_len, int precheck);
 
+/**
+ * \brief Gets the size of the key context for an AEAD cipher.
+ *
+ * \param cipher Points to the cipher.
+ *
+ * \return The number of bytes to allocate for the context that is passed
+ * to aead_cipher_setup_key().
+ *
+ * If the cipher does not have its own key setup function, then the
+ * context is a copy of the key and this will return the key length.
+ */
+size_t aead_cipher_context_size(const aead_cipher_t *cipher);
+
+/**
+ * \brief Expands a key into a context for an AEAD cipher.
+ *
+ * \param cipher Points to the cipher.
+ * \param ctx Points to the context to initialize, which must be at least
+ * aead_cipher_context_size() bytes in length and aligned for any type.
+ * \param k Points to the key to expand.
+ *
+ * \sa aead_cipher_encrypt_with_context(), aead_cipher_decrypt_with_context()
+ */
+void aead_cipher_setup_key
+    (const aead_cipher_t *cipher, void *ctx, const unsigned char *k);
+
+/**
+ * \brief Gets the size of the key context for an AEAD cipher with a
+ * specific key schedule variant.
+ *
+ * \param cipher Points to the cipher.
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * \return The number of bytes to allocate for the context that is passed
+ * to aead_cipher_setup_key_schedule().
+ *
+ * This is the same as aead_cipher_context_size() if the cipher has only
+ * one key schedule variant.
+ */
+size_t aead_cipher_context_size_schedule
+    (const aead_cipher_t *cipher, unsigned schedule);
+
+/**
+ * \brief Expands a key into a context for an AEAD cipher with a specific
+ * key schedule variant.
+ *
+ * \param cipher Points to the cipher.
+ * \param ctx Points to the context to initialize, which must be at least
+ * aead_cipher_context_size_schedule() bytes in length and aligned for
+ * any type.
+ * \param k Points to the key to expand.
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * The context can be used with aead_cipher_encrypt_with_context() and
+ * aead_cipher_decrypt_with_context() like any other.  A server can use
+ * the full key schedule for busy sessions and a smaller one for the
+ * many sessions that are mostly idle.
+ */
+void aead_cipher_setup_key_schedule
+    (const aead_cipher_t *cipher, void *ctx, const unsigned char *k,
+     unsigned schedule);
+
+/**
+ * \brief Encrypts and authenticates a packet using a key context.
+ *
+ * \param cipher Points to the cipher.
+ * \param c Buffer to receive the output.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the authentication tag.
+ * \param m Buffer that contains the plaintext message to encrypt.
+ * \param mlen Length of the plaintext message in bytes.
+ * \param ad Buffer that contains associated data to authenticate
+ * along with the packet but which does not need to be encrypted.
+ * \param adlen Length of the associated data in bytes.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ */
+int aead_cipher_encrypt_with_context
+    (const aead_cipher_t *cipher,
+     unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx);
+
+/**
+ * \brief Decrypts and authenticates a packet using a key context.
+ *
+ * \param cipher Points to the cipher.
+ * \param m Buffer to receive the plaintext message on output.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param c Buffer that contains the ciphertext and authentication
+ * tag to decrypt.
+ * \param clen Length of the input data in bytes, which includes the
+ * ciphertext and the authentication tag.
+ * \param ad Buffer that contains associated data to authenticate
+ * along with the packet but which does not need to be encrypted.
+ * \param adlen Length of the associated data in bytes.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ */
+int aead_cipher_decrypt_with_context
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx);
+
+/**
+ * \brief Check an authentication tag in constant time for a packet
+ * whose plaintext is split into scatter/gather segments.
+ *
+ * \param plaintext Points to the array of plaintext segments.
+ * \param count Number of segments in \a plaintext.
+ * \param plaintext_len Length of the plaintext in bytes.
+ * \param tag1 First tag to compare.
+ * \param tag2 Second tag to compare.
+ * \param tag_len Length of the tags in bytes.
+ *
+ * \return Returns -1 if the tag check failed or 0 if the check succeeded.
+ *
+ * If the tag check fails, then the first \a plaintext_len bytes of
+ * the segments will also be zeroed.
+ */
+int aead_check_tag_vec
+    (const aead_iovec_t *plaintext, size_t count,
+     unsigned long long plaintext_len,
+     const unsigned char *tag1, const unsigned char *tag2,
+     unsigned tag_len);
+
+/**
+ * \brief Check an authentication tag in constant time with a previous
+ * check for a packet whose plaintext is split into scatter/gather segments.
+ *
+ * \param plaintext Points to the array of plaintext segments.
+ * \param count Number of segments in \a plaintext.
+ * \param plaintext_len Length of the plaintext in bytes.
+ * \param tag1 First tag to compare.
+ * \param tag2 Second tag to compare.
+ * \param tag_len Length of the tags in bytes.
+ * \param precheck Set to -1 if previous check succeeded or 0 if it failed.
+ *
+ * \return Returns -1 if the tag check failed or 0 if the check succeeded.
+ *
+ * If the tag check fails, then the first \a plaintext_len bytes of
+ * the segments will also be zeroed.
+ */
+int aead_check_tag_precheck_vec
+    (const aead_iovec_t *plaintext, size_t count,
+     unsigned long long plaintext_len,
+     const unsigned char *tag1, const unsigned char *tag2,
+     unsigned tag_len, int precheck);
+
+/**
+ * \brief Gets the total length of an array of scatter/gather segments.
+ *
+ * \param vec Points to the array of segments.
+ * \param count Number of segments in \a vec.
+ *
+ * \return The sum of the segment lengths.
+ */
+unsigned long long aead_iovec_length(const aead_iovec_t *vec, size_t count);
+
+/**
+ * \brief Encrypts a scatter/gather packet with the incremental mode of
+ * a cipher.
+ *
+ * \param inc Points to the incremental mode of the cipher.
+ * \param state Points to a caller-supplied state of inc->state_size bytes.
+ * \param tag_len Length of the authentication tag, at most 32 bytes.
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or -2 if the segments in \a c are not large
+ * enough to hold the ciphertext and the authentication tag.
+ *
+ * This is the native scatter/gather implementation for sponge-based
+ * ciphers with an incremental mode.  The payload is processed in the
+ * largest chunks that are contiguous in both \a m and \a c.
+ */
+int aead_incremental_encrypt_vec
+    (const aead_cipher_incremental_t *inc, void *state, unsigned tag_len,
+     const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts a scatter/gather packet with the incremental mode of
+ * a cipher.
+ *
+ * \param inc Points to the incremental mode of the cipher.
+ * \param state Points to a caller-supplied state of inc->state_size bytes.
+ * \param tag_len Length of the authentication tag, at most 32 bytes.
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if the segments in \a m are too small for the plaintext.
+ *
+ * If the tag check fails, then the plaintext in \a m is destroyed.
+ */
+int aead_incremental_decrypt_vec
+    (const aead_cipher_incremental_t *inc, void *state, unsigned tag_len,
+     const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \def AEAD_VEC_BUFFER_SIZE
+ * \brief Size of the stack buffer that the scatter/gather functions use
+ * for ciphers without a native scatter/gather implementation.
+ *
+ * Segment arrays whose data is contiguous are passed directly to the
+ * cipher.  Fragmented plaintext, ciphertext, and associated data are
+ * gathered into this buffer, and the call fails with -2 if they do not
+ * fit.  Ciphers with native "encrypt_vec" and "decrypt_vec" functions
+ * never use the buffer and have no limit on the packet size.
+ * The default is 1024 bytes, or 128 bytes on AVR.
+ */
+#if !defined(AEAD_VEC_BUFFER_SIZE)
+#if defined(__AVR__)
+#define AEAD_VEC_BUFFER_SIZE 128
+#else
+#define AEAD_VEC_BUFFER_SIZE 1024
+#endif
+#endif
+
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet.
+ *
+ * \param cipher Points to the cipher.
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the output which includes
+ * the ciphertext and the authentication tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters or the fragmented segments did not fit in the
+ * AEAD_VEC_BUFFER_SIZE buffer of a cipher without native support.
+ *
+ * \sa aead_cipher_encrypt_vec_t
+ */
+int aead_cipher_encrypt_vec
+    (const aead_cipher_t *cipher,
+     const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet.
+ *
+ * \param cipher Points to the cipher.
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters
+ * or the fragmented segments did not fit in the AEAD_VEC_BUFFER_SIZE
+ * buffer of a cipher without native support.
+ *
+ * \sa aead_cipher_decrypt_vec_t
+ */
+int aead_cipher_decrypt_vec
+    (const aead_cipher_t *cipher,
+     const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a packet with the authentication tag
+ * written to a separate buffer.
+ *
+ * \param cipher Points to the cipher.
+ * \param c Buffer to receive the ciphertext, which will be \a mlen
+ * bytes in length.  May be the same as \a m for in-place encryption.
+ * \param tag Buffer to receive the authentication tag, which must be
+ * at least cipher->tag_len bytes in length.
+ * \param m Buffer that contains the plaintext message to encrypt.
+ * \param mlen Length of the plaintext message in bytes.
+ * \param ad Buffer that contains associated data to authenticate
+ * along with the packet but which does not need to be encrypted.
+ * \param adlen Length of the associated data in bytes.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to encrypt the packet.
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters or the cipher cannot write the tag to \a tag.
+ *
+ * Ciphers with a native scatter/gather implementation write the
+ * ciphertext and the tag directly into \a c and \a tag, with no limit
+ * on the packet size.  Other ciphers can only be used if \a tag is
+ * equal to \a c + \a mlen, and -2 is returned otherwise.  Ciphers with
+ * the AEAD_FLAG_NO_DETACHED_TAG flag always return -2.
+ *
+ * \sa aead_cipher_decrypt_detached()
+ */
+int aead_cipher_encrypt_detached
+    (const aead_cipher_t *cipher, unsigned char *c, unsigned char *tag,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Decrypts and authenticates a packet whose authentication tag
+ * is in a separate buffer.
+ *
+ * \param cipher Points to the cipher.
+ * \param m Buffer to receive the plaintext message, which will be
+ * \a clen bytes in length.  May be the same as \a c for in-place
+ * decryption.
+ * \param nsec Secret nonce - normally not used by AEAD schemes.
+ * \param c Buffer that contains the ciphertext to decrypt.
+ * \param clen Length of the ciphertext in bytes, excluding the tag.
+ * \param tag Buffer that contains the cipher->tag_len bytes of the
+ * authentication tag.
+ * \param ad Buffer that contains associated data to authenticate
+ * along with the packet but which does not need to be encrypted.
+ * \param adlen Length of the associated data in bytes.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the key to use to decrypt the packet.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters
+ * or the cipher cannot read the tag from \a tag.
+ *
+ * Ciphers with a native scatter/gather implementation read the
+ * ciphertext and the tag directly from \a c and \a tag, with no limit
+ * on the packet size.  Other ciphers can only be used for in-place
+ * decryption where \a m is equal to \a c and \a tag is equal to
+ * \a c + \a clen, and -2 is returned otherwise.  Ciphers with the
+ * AEAD_FLAG_NO_DETACHED_TAG flag always return -2.
+ *
+ * \sa aead_cipher_encrypt_detached()
+ */
+int aead_cipher_decrypt_detached
+    (const aead_cipher_t *cipher, unsigned char *m, unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *tag,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k);
+
+/**
+ * \brief Encrypts and authenticates a batch of independent packets.
+ *
+ * \param cipher Points to the cipher.
+ * \param packets Points to the array of packet descriptors.  The output
+ * buffer for each packet must have room for the input plus the tag.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was encrypted, or the result of the first
+ * packet that failed.
+ *
+ * All packets are processed even if one of them fails.  Packets may
+ * use different keys.
+ *
+ * \sa aead_cipher_decrypt_batch()
+ */
+int aead_cipher_encrypt_batch
+    (const aead_cipher_t *cipher, aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Decrypts and authenticates a batch of independent packets.
+ *
+ * \param cipher Points to the cipher.
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ *
+ * \return 0 if every packet was decrypted, or the result of the first
+ * packet that failed.
+ *
+ * All packets are processed even if one of them fails.  The plaintext
+ * of each packet whose "result" field is non-zero is destroyed.
+ *
+ * \sa aead_cipher_encrypt_batch()
+ */
+int aead_cipher_decrypt_batch
+    (const aead_cipher_t *cipher, aead_packet_t *packets, size_t count);
+
+/**
+ * \brief Number of bytes at the end of a cipher's nonce that are replaced
+ * with the segment counter and last-segment flag by the STREAM layer.
+ *
+ * The caller supplies the remaining cipher->nonce_len -
+ * AEAD_STREAM_NONCE_OVERHEAD bytes as a nonce prefix, which must be
+ * unique for every object that is encrypted under the same key.
+ */
+#define AEAD_STREAM_NONCE_OVERHEAD 5
+
+/**
+ * \brief Maximum nonce length for a cipher that is used with the
+ * STREAM layer.
+ */
+#define AEAD_STREAM_MAX_NONCE_LEN 32
+
+/**
+ * \brief Derives the nonce for a segment of a STREAM-encrypted object.
+ *
+ * \param cipher Points to the cipher.
+ * \param nonce Buffer to receive the cipher->nonce_len bytes of the nonce.
+ * \param prefix Points to the nonce prefix for the object, which is
+ * cipher->nonce_len - AEAD_STREAM_NONCE_OVERHEAD bytes in length.
+ * \param index Index of the segment within the object, starting at zero.
+ * \param last Non-zero if this is the last segment of the object.
+ *
+ * \return 0 on success, or -2 if the cipher cannot be used with the
+ * STREAM layer or \a index does not fit in 32 bits.
+ *
+ * The nonce is the prefix, followed by the segment index as a 32-bit
+ * big-endian value, followed by a byte that is 0x01 for the last
+ * segment and 0x00 otherwise.
+ */
+int aead_stream_segment_nonce
+    (const aead_cipher_t *cipher, unsigned char *nonce,
+     const unsigned char *prefix, unsigned long long index, int last);
+
+/**
+ * \brief Gets the length of the STREAM ciphertext for an object.
+ *
+ * \param cipher Points to the cipher.
+ * \param segment_size Number of plaintext bytes in each segment.
+ * \param mlen Length of the plaintext object in bytes.
+ *
+ * \return The length of the ciphertext, which is \a mlen plus one
+ * authentication tag per segment, or zero if \a segment_size is zero.
+ *
+ * An empty object is encrypted as a single empty segment.
+ */
+unsigned long long aead_stream_ciphertext_length
+    (const aead_cipher_t *cipher, size_t segment_size,
+     unsigned long long mlen);
+
+/**
+ * \brief Gets the number of segments in a STREAM ciphertext.
+ *
+ * \param cipher Points to the cipher.
+ * \param segment_size Number of plaintext bytes in each segment.
+ * \param clen Length of the ciphertext object in bytes.
+ *
+ * \return The number of segments, or zero if \a clen is not a valid
+ * ciphertext length for \a segment_size.
+ */
+unsigned long long aead_stream_segment_count
+    (const aead_cipher_t *cipher, size_t segment_size,
+     unsigned long long clen);
+
+/**
+ * \brief Encrypts a single segment of a STREAM object.
+ *
+ * \param cipher Points to the cipher.
+ * \param c Buffer to receive the ciphertext and tag for the segment.
+ * \param clen On exit, set to the length of the segment's ciphertext
+ * which includes the authentication tag.
+ * \param m Buffer that contains the plaintext of the segment.
+ * \param mlen Length of the segment's plaintext in bytes.
+ * \param ad Buffer that contains associated data for the object, which
+ * is authenticated with every segment.
+ * \param adlen Length of the associated data in bytes.
+ * \param prefix Points to the nonce prefix for the object.
+ * \param index Index of the segment within the object.
+ * \param last Non-zero if this is the last segment of the object.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters.
+ *
+ * Segments are independent of each other so they can be encrypted in
+ * any order or in parallel.  This allows an object of any size to be
+ * encrypted in constant memory, as long as the caller knows which
+ * segment is the last one before encrypting it.
+ *
+ * \sa aead_stream_segment_nonce()
+ */
+int aead_stream_encrypt_segment
+    (const aead_cipher_t *cipher,
+     unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, unsigned long long index, int last,
+     const void *ctx);
+
+/**
+ * \brief Decrypts a single segment of a STREAM object.
+ *
+ * \param cipher Points to the cipher.
+ * \param m Buffer to receive the plaintext of the segment.
+ * \param mlen Receives the length of the segment's plaintext.
+ * \param c Buffer that contains the ciphertext and tag for the segment.
+ * \param clen Length of the segment's ciphertext in bytes, which
+ * includes the authentication tag.
+ * \param ad Buffer that contains associated data for the object.
+ * \param adlen Length of the associated data in bytes.
+ * \param prefix Points to the nonce prefix for the object.
+ * \param index Index of the segment within the object.
+ * \param last Non-zero if this is the last segment of the object.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * Decryption fails if the segment is presented with the wrong index or
+ * the wrong last-segment flag, so segments cannot be reordered and the
+ * object cannot be truncated or extended without detection.
+ */
+int aead_stream_decrypt_segment
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, unsigned long long index, int last,
+     const void *ctx);
+
+/**
+ * \brief Encrypts an entire object with the STREAM layer.
+ *
+ * \param cipher Points to the cipher.
+ * \param c Buffer to receive the ciphertext, which must be at least
+ * aead_stream_ciphertext_length() bytes in length.  It must not
+ * overlap with \a m.
+ * \param clen On exit, set to the length of the ciphertext.
+ * \param m Buffer that contains the plaintext object.
+ * \param mlen Length of the plaintext object in bytes.
+ * \param ad Buffer that contains associated data for the object.
+ * \param adlen Length of the associated data in bytes.
+ * \param prefix Points to the nonce prefix for the object.
+ * \param segment_size Number of plaintext bytes in each segment.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, or a negative value if there was an error in
+ * the parameters or the object has more than 2^32 segments.
+ *
+ * The ciphertext is the concatenation of the encrypted segments.  Every
+ * segment except the last has \a segment_size bytes of plaintext.
+ *
+ * Ciphers with the AEAD_FLAG_NO_DETACHED_TAG flag, and ciphers whose
+ * nonce is shorter than AEAD_STREAM_NONCE_OVERHEAD bytes, cannot be used
+ * with the STREAM layer.  Two-pass ciphers can be used because each
+ * segment is encrypted as a separate packet.
+ */
+int aead_stream_encrypt
+    (const aead_cipher_t *cipher,
+     unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, size_t segment_size,
+     const void *ctx);
+
+/**
+ * \brief Decrypts an entire object with the STREAM layer.
+ *
+ * \param cipher Points to the cipher.
+ * \param m Buffer to receive the plaintext object.
+ * \param mlen Receives the length of the plaintext object.
+ * \param c Buffer that contains the ciphertext object.
+ * \param clen Length of the ciphertext object in bytes.
+ * \param ad Buffer that contains associated data for the object.
+ * \param adlen Length of the associated data in bytes.
+ * \param prefix Points to the nonce prefix for the object.
+ * \param segment_size Number of plaintext bytes in each segment.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, -1 if any authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters.
+ *
+ * If decryption fails, then all of the plaintext that was written to
+ * \a m is destroyed.
+ */
+int aead_stream_decrypt
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, size_t segment_size,
+     const void *ctx);
+
+/**
+ * \brief Decrypts one segment of a STREAM object given the whole
+ * ciphertext, for random access.
+ *
+ * \param cipher Points to the cipher.
+ * \param m Buffer to receive the plaintext of the segment, which must
+ * be at least \a segment_size bytes in length.
+ * \param mlen Receives the length of the segment's plaintext.
+ * \param c Buffer that contains the ciphertext object, which may be
+ * memory-mapped from a file.  Only the requested segment is read.
+ * \param clen Length of the ciphertext object in bytes.
+ * \param ad Buffer that contains associated data for the object.
+ * \param adlen Length of the associated data in bytes.
+ * \param prefix Points to the nonce prefix for the object.
+ * \param segment_size Number of plaintext bytes in each segment.
+ * \param index Index of the segment to decrypt.
+ * \param ctx Points to the context from aead_cipher_setup_key().
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or some other negative number if there was an error in the parameters
+ * or \a index is out of range.
+ *
+ * The plaintext of segment \a index starts at offset
+ * \a index * \a segment_size within the original object.
+ */
+int aead_stream_decrypt_at
+    (const aead_cipher_t *cipher,
+     unsigned char *m, unsigned long long *mlen,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *prefix, size_t segment_size,
+     unsigned long long index, const void *ctx);
+
+/**
+ * \def AEAD_INSTRUMENT
+ * \brief Set to 1 to count the calls to each internal primitive.
+ *
+ * Instrumentation is off by default.  When the library is compiled with
+ * "-DAEAD_INSTRUMENT=1", every call to a block cipher, permutation, or
+ * key setup function increments a global counter that can be queried with
+ * aead_instrument_get().  The counters are not thread-safe and are not
+ * updated by the assembly code versions of the primitives.
+ */
+#if !defined(AEAD_INSTRUMENT)
+#define AEAD_INSTRUMENT 0
+#endif
+
+/**
+ * \brief Identifiers for the internal primitives that can be counted.
+ */
+typedef enum
+{
+    AEAD_PRIMITIVE_ASCON_PERMUTE,           /**< ascon_permute() */
+    AEAD_PRIMITIVE_ASCON_ROUNDS,            /**< ASCON permutation rounds */
+    AEAD_PRIMITIVE_CHAM128_ENCRYPT,         /**< cham128_128_encrypt() */
+    AEAD_PRIMITIVE_CHAM64_ENCRYPT,          /**< cham64_128_encrypt() */
+    AEAD_PRIMITIVE_CLYDE128_ENCRYPT,        /**< clyde128_encrypt() */
+    AEAD_PRIMITIVE_CLYDE128_DECRYPT,        /**< clyde128_decrypt() */
+    AEAD_PRIMITIVE_DRYSPONGE128_G,          /**< drysponge128_g() */
+    AEAD_PRIMITIVE_DRYSPONGE256_G,          /**< drysponge256_g() */
+    AEAD_PRIMITIVE_FORKSKINNY_128_256,      /**< ForkSkinny-128-256 block */
+    AEAD_PRIMITIVE_FORKSKINNY_128_384,      /**< ForkSkinny-128-384 block */
+    AEAD_PRIMITIVE_FORKSKINNY_64_192,       /**< ForkSkinny-64-192 block */
+    AEAD_PRIMITIVE_GIFT128B_INIT,           /**< gift128b_init() */
+    AEAD_PRIMITIVE_GIFT128B_ENCRYPT,        /**< gift128b_encrypt() */
+    AEAD_PRIMITIVE_GIFT128B_ENCRYPT_PRELOADED, /**< GIFT-128b preloaded */
+    AEAD_PRIMITIVE_GIFT128B_DECRYPT,        /**< gift128b_decrypt() */
+    AEAD_PRIMITIVE_GIFT128N_INIT,           /**< gift128n_init() */
+    AEAD_PRIMITIVE_GIFT128N_ENCRYPT,        /**< gift128n_encrypt() */
+    AEAD_PRIMITIVE_GIFT128N_DECRYPT,        /**< gift128n_decrypt() */
+    AEAD_PRIMITIVE_GIFT128T_ENCRYPT,        /**< gift128t_encrypt() */
+    AEAD_PRIMITIVE_GIFT128T_DECRYPT,        /**< gift128t_decrypt() */
+    AEAD_PRIMITIVE_GIFT64N_INIT,            /**< gift64n_init() */
+    AEAD_PRIMITIVE_GIFT64N_ENCRYPT,         /**< gift64n_encrypt() */
+    AEAD_PRIMITIVE_GIFT64N_DECRYPT,         /**< gift64n_decrypt() */
+    AEAD_PRIMITIVE_GIFT64T_ENCRYPT,         /**< gift64t_encrypt() */
+    AEAD_PRIMITIVE_GIFT64T_DECRYPT,         /**< gift64t_decrypt() */
+    AEAD_PRIMITIVE_GIMLI24_PERMUTE,         /**< gimli24_permute() */
+    AEAD_PRIMITIVE_GRAIN128_CORE,           /**< grain128_core() */
+    AEAD_PRIMITIVE_KECCAKP_200_PERMUTE,     /**< keccakp_200_permute() */
+    AEAD_PRIMITIVE_KECCAKP_400_PERMUTE,     /**< keccakp_400_permute() */
+    AEAD_PRIMITIVE_KNOT256_PERMUTE,         /**< KNOT-256 permutation */
+    AEAD_PRIMITIVE_KNOT384_PERMUTE,         /**< KNOT-384 permutation */
+    AEAD_PRIMITIVE_KNOT512_PERMUTE,         /**< KNOT-512 permutation */
+    AEAD_PRIMITIVE_PHOTON256_PERMUTE,       /**< photon256_permute() */
+    AEAD_PRIMITIVE_PYJAMASK_SETUP_KEY,      /**< Pyjamask key setup */
+    AEAD_PRIMITIVE_PYJAMASK_ENCRYPT,        /**< Pyjamask encryption */
+    AEAD_PRIMITIVE_PYJAMASK_DECRYPT,        /**< Pyjamask decryption */
+    AEAD_PRIMITIVE_SATURNIN_SETUP_KEY,      /**< saturnin_setup_key() */
+    AEAD_PRIMITIVE_SATURNIN_ENCRYPT,        /**< saturnin_encrypt_block() */
+    AEAD_PRIMITIVE_SATURNIN_DECRYPT,        /**< saturnin_decrypt_block() */
+    AEAD_PRIMITIVE_SHADOW384,               /**< shadow384() */
+    AEAD_PRIMITIVE_SHADOW512,               /**< shadow512() */
+    AEAD_PRIMITIVE_SIMP_PERMUTE,            /**< SimP permutation */
+    AEAD_PRIMITIVE_SKINNY_128_256_INIT,     /**< skinny_128_256_init() */
+    AEAD_PRIMITIVE_SKINNY_128_256_ENCRYPT,  /**< SKINNY-128-256 encryption */
+    AEAD_PRIMITIVE_SKINNY_128_256_DECRYPT,  /**< SKINNY-128-256 decryption */
+    AEAD_PRIMITIVE_SKINNY_128_384_INIT,     /**< skinny_128_384_init() */
+    AEAD_PRIMITIVE_SKINNY_128_384_ENCRYPT,  /**< SKINNY-128-384 encryption */
+    AEAD_PRIMITIVE_SKINNY_128_384_DECRYPT,  /**< SKINNY-128-384 decryption */
+    AEAD_PRIMITIVE_SLISCP_LIGHT_PERMUTE,    /**< sLiSCP-light permutation */
+    AEAD_PRIMITIVE_SPARKLE_PERMUTE,         /**< SPARKLE permutation */
+    AEAD_PRIMITIVE_SPECK64_ENCRYPT,         /**< speck64_128_encrypt() */
+    AEAD_PRIMITIVE_SPONGENT160_PERMUTE,     /**< spongent160_permute() */
+    AEAD_PRIMITIVE_SPONGENT176_PERMUTE,     /**< spongent176_permute() */
+    AEAD_PRIMITIVE_SUBTERRANEAN_ROUND,      /**< subterranean_round() */
+    AEAD_PRIMITIVE_TINYJAMBU_PERMUTE,       /**< tiny_jambu_permutation() */
+    AEAD_PRIMITIVE_WAGE_PERMUTE,            /**< wage_permute() */
+    AEAD_PRIMITIVE_XOODOO_PERMUTE,          /**< xoodoo_permute() */
+    AEAD_PRIMITIVE_COUNT                    /**< Number of primitives */
+
+} aead_primitive_t;
+
+/**
+ * \brief Resets all primitive call counters to zero.
+ *
+ * This is typically called before an AEAD or hash operation, followed
+ * by aead_instrument_get() after the operation to determine how many
+ * times each primitive was called.
+ */
+void aead_instrument_reset(void);
+
+/**
+ * \brief Gets the number of times that a primitive has been called
+ * since the last call to aead_instrument_reset().
+ *
+ * \param prim Identifier for the primitive.
+ *
+ * \return The number of calls, or zero if instrumentation is disabled.
+ *
+ * For AEAD_PRIMITIVE_ASCON_ROUNDS, the number of ASCON rounds is returned
+ * rather than the number of calls.
+ */
+unsigned long aead_instrument_get(aead_primitive_t prim);
+
+/**
+ * \brief Gets the name of a primitive for reporting purposes.
+ *
+ * \param prim Identifier for the primitive.
+ *
+ * \return The name of the primitive, or NULL if \a prim is out of range.
+ */
+const char *aead_instrument_name(aead_primitive_t prim);
+
+/**
+ * \brief Determine if primitive call instrumentation was compiled in.
+ *
+ * \return Non-zero if instrumentation is enabled, zero if not.
+ */
+int aead_instrument_enabled(void);
+
 #ifdef __cplusplus
 }
 #endif
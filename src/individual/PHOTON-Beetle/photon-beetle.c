@@ -22,7 +22,7 @@
 
 #include "photon-beetle.h"
 #include "internal-photon256.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const photon_beetle_128_cipher = {
@@ -32,7 +32,18 @@ aead_cipher_t const photon_beetle_128_cipher = {
     PHOTON_BEETLE_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     photon_beetle_128_aead_encrypt,
-    photon_beetle_128_aead_decrypt
+    photon_beetle_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    photon_beetle_128_aead_encrypt_vec,
+    photon_beetle_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const photon_beetle_32_cipher = {
@@ -42,7 +53,18 @@ aead_cipher_t const photon_beetle_32_cipher = {
     PHOTON_BEETLE_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     photon_beetle_32_aead_encrypt,
-    photon_beetle_32_aead_decrypt
+    photon_beetle_32_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    photon_beetle_32_aead_encrypt_vec,
+    photon_beetle_32_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const photon_beetle_hash_algorithm = {
@@ -75,30 +97,33 @@ aead_hash_algorithm_t const photon_beetle_hash_algorithm = {
  * \brief Processes the associated data for PHOTON-Beetle.
  *
  * \param state PHOTON-256 permutation state.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data, must be non-zero.
  * \param rate Rate of absorption for the data.
  * \param mempty Non-zero if the message is empty.
  */
 static void photon_beetle_process_ad
     (unsigned char state[PHOTON256_STATE_SIZE],
-     const unsigned char *ad, unsigned long long adlen,
+     aead_iovec_cursor_t *ad, unsigned long long adlen,
      unsigned rate, int mempty)
 {
+    unsigned char block[PHOTON_BEETLE_128_RATE]; /* Block of max rate size */
+    const unsigned char *in;
     unsigned temp;
 
     /* Absorb as many full rate blocks as possible */
     while (adlen > rate) {
         photon256_permute(state);
-        lw_xor_block(state, ad, rate);
-        ad += rate;
+        in = aead_iovec_load_block(ad, block, rate);
+        lw_xor_block(state, in, rate);
         adlen -= rate;
     }
 
     /* Pad and absorb the last block */
     temp = (unsigned)adlen;
     photon256_permute(state);
-    lw_xor_block(state, ad, temp);
+    in = aead_iovec_load_block(ad, block, temp);
+    lw_xor_block(state, in, temp);
     if (temp < rate)
         state[temp] ^= 0x01; /* padding */
 
@@ -133,18 +158,23 @@ static void photon_beetle_rotate1
  * \brief Encrypts a plaintext block with PHOTON-Beetle.
  *
  * \param state PHOTON-256 permutation state.
- * \param c Points to the ciphertext output buffer.
- * \param m Points to the plaintext input buffer.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Length of the message, must be non-zero.
  * \param rate Rate of absorption for the data.
  * \param adempty Non-zero if the associated data is empty.
  */
 static void photon_beetle_encrypt
     (unsigned char state[PHOTON256_STATE_SIZE],
-     unsigned char *c, const unsigned char *m, unsigned long long mlen,
+     aead_iovec_cursor_t *c, aead_iovec_cursor_t *m,
+     unsigned long long mlen,
      unsigned rate, int adempty)
 {
     unsigned char shuffle[PHOTON_BEETLE_128_RATE]; /* Block of max rate size */
+    unsigned char inbuf[PHOTON_BEETLE_128_RATE];
+    unsigned char outbuf[PHOTON_BEETLE_128_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Process all plaintext blocks except the last */
@@ -152,10 +182,11 @@ static void photon_beetle_encrypt
         photon256_permute(state);
         memcpy(shuffle, state + rate / 2, rate / 2);
         photon_beetle_rotate1(shuffle + rate / 2, state, rate / 2);
-        lw_xor_block(state, m, rate);
-        lw_xor_block_2_src(c, m, shuffle, rate);
-        c += rate;
-        m += rate;
+        in = aead_iovec_load_block(m, inbuf, rate);
+        out = aead_iovec_store_begin(c, outbuf, rate);
+        lw_xor_block(state, in, rate);
+        lw_xor_block_2_src(out, in, shuffle, rate);
+        aead_iovec_store_end(c, outbuf, out, rate);
         mlen -= rate;
     }
 
@@ -164,14 +195,17 @@ static void photon_beetle_encrypt
     photon256_permute(state);
     memcpy(shuffle, state + rate / 2, rate / 2);
     photon_beetle_rotate1(shuffle + rate / 2, state, rate / 2);
+    in = aead_iovec_load_block(m, inbuf, temp);
+    out = aead_iovec_store_begin(c, outbuf, temp);
     if (temp == rate) {
-        lw_xor_block(state, m, rate);
-        lw_xor_block_2_src(c, m, shuffle, rate);
+        lw_xor_block(state, in, rate);
+        lw_xor_block_2_src(out, in, shuffle, rate);
     } else {
-        lw_xor_block(state, m, temp);
+        lw_xor_block(state, in, temp);
         state[temp] ^= 0x01; /* padding */
-        lw_xor_block_2_src(c, m, shuffle, temp);
+        lw_xor_block_2_src(out, in, shuffle, temp);
     }
+    aead_iovec_store_end(c, outbuf, out, temp);
 
     /* Add the domain constant to finalize message processing */
     if (adempty && temp == rate)
@@ -188,18 +222,23 @@ static void photon_beetle_encrypt
  * \brief Decrypts a ciphertext block with PHOTON-Beetle.
  *
  * \param state PHOTON-256 permutation state.
- * \param m Points to the plaintext output buffer.
- * \param c Points to the ciphertext input buffer.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Length of the message, must be non-zero.
  * \param rate Rate of absorption for the data.
  * \param adempty Non-zero if the associated data is empty.
  */
 static void photon_beetle_decrypt
     (unsigned char state[PHOTON256_STATE_SIZE],
-     unsigned char *m, const unsigned char *c, unsigned long long mlen,
+     aead_iovec_cursor_t *m, aead_iovec_cursor_t *c,
+     unsigned long long mlen,
      unsigned rate, int adempty)
 {
     unsigned char shuffle[PHOTON_BEETLE_128_RATE]; /* Block of max rate size */
+    unsigned char inbuf[PHOTON_BEETLE_128_RATE];
+    unsigned char outbuf[PHOTON_BEETLE_128_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     unsigned temp;
 
     /* Process all plaintext blocks except the last */
@@ -207,10 +246,11 @@ static void photon_beetle_decrypt
         photon256_permute(state);
         memcpy(shuffle, state + rate / 2, rate / 2);
         photon_beetle_rotate1(shuffle + rate / 2, state, rate / 2);
-        lw_xor_block_2_src(m, c, shuffle, rate);
-        lw_xor_block(state, m, rate);
-        c += rate;
-        m += rate;
+        in = aead_iovec_load_block(c, inbuf, rate);
+        out = aead_iovec_store_begin(m, outbuf, rate);
+        lw_xor_block_2_src(out, in, shuffle, rate);
+        lw_xor_block(state, out, rate);
+        aead_iovec_store_end(m, outbuf, out, rate);
         mlen -= rate;
     }
 
@@ -219,14 +259,17 @@ static void photon_beetle_decrypt
     photon256_permute(state);
     memcpy(shuffle, state + rate / 2, rate / 2);
     photon_beetle_rotate1(shuffle + rate / 2, state, rate / 2);
+    in = aead_iovec_load_block(c, inbuf, temp);
+    out = aead_iovec_store_begin(m, outbuf, temp);
     if (temp == rate) {
-        lw_xor_block_2_src(m, c, shuffle, rate);
-        lw_xor_block(state, m, rate);
+        lw_xor_block_2_src(out, in, shuffle, rate);
+        lw_xor_block(state, out, rate);
     } else {
-        lw_xor_block_2_src(m, c, shuffle, temp);
-        lw_xor_block(state, m, temp);
+        lw_xor_block_2_src(out, in, shuffle, temp);
+        lw_xor_block(state, out, temp);
         state[temp] ^= 0x01; /* padding */
     }
+    aead_iovec_store_end(m, outbuf, out, temp);
 
     /* Add the domain constant to finalize message processing */
     if (adempty && temp == rate)
@@ -239,19 +282,27 @@ static void photon_beetle_decrypt
         state[PHOTON256_STATE_SIZE - 1] ^= DOMAIN(2);
 }
 
-int photon_beetle_128_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int photon_beetle_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[PHOTON256_STATE_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + PHOTON_BEETLE_TAG_SIZE))
+        return -2;
     *clen = mlen + PHOTON_BEETLE_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state by concatenating the nonce and the key */
     memcpy(state, npub, 16);
@@ -260,7 +311,7 @@ int photon_beetle_128_aead_encrypt
     /* Process the associated data */
     if (adlen > 0) {
         photon_beetle_process_ad
-            (state, ad, adlen, PHOTON_BEETLE_128_RATE, mlen == 0);
+            (state, &adcur, adlen, PHOTON_BEETLE_128_RATE, mlen == 0);
     } else if (mlen == 0) {
         state[PHOTON256_STATE_SIZE - 1] ^= DOMAIN(1);
     }
@@ -268,30 +319,39 @@ int photon_beetle_128_aead_encrypt
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         photon_beetle_encrypt
-            (state, c, m, mlen, PHOTON_BEETLE_128_RATE, adlen == 0);
+            (state, &ccur, &mcur, mlen, PHOTON_BEETLE_128_RATE, adlen == 0);
     }
 
     /* Generate the authentication tag */
     photon256_permute(state);
-    memcpy(c + mlen, state, PHOTON_BEETLE_TAG_SIZE);
+    aead_iovec_write(&ccur, state, PHOTON_BEETLE_TAG_SIZE);
     return 0;
 }
 
-int photon_beetle_128_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int photon_beetle_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[PHOTON256_STATE_SIZE];
+    unsigned char tag[PHOTON_BEETLE_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < PHOTON_BEETLE_TAG_SIZE)
         return -1;
     *mlen = clen - PHOTON_BEETLE_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state by concatenating the nonce and the key */
     memcpy(state, npub, 16);
@@ -301,7 +361,7 @@ int photon_beetle_128_aead_decrypt
     clen -= PHOTON_BEETLE_TAG_SIZE;
     if (adlen > 0) {
         photon_beetle_process_ad
-            (state, ad, adlen, PHOTON_BEETLE_128_RATE, clen == 0);
+            (state, &adcur, adlen, PHOTON_BEETLE_128_RATE, clen == 0);
     } else if (clen == 0) {
         state[PHOTON256_STATE_SIZE - 1] ^= DOMAIN(1);
     }
@@ -309,27 +369,70 @@ int photon_beetle_128_aead_decrypt
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > 0) {
         photon_beetle_decrypt
-            (state, m, c, clen, PHOTON_BEETLE_128_RATE, adlen == 0);
+            (state, &mcur, &ccur, clen, PHOTON_BEETLE_128_RATE, adlen == 0);
     }
 
     /* Check the authentication tag */
     photon256_permute(state);
-    return aead_check_tag(m, clen, state, c + clen, PHOTON_BEETLE_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, PHOTON_BEETLE_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state, tag, PHOTON_BEETLE_TAG_SIZE);
 }
 
-int photon_beetle_32_aead_encrypt
+int photon_beetle_128_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + PHOTON_BEETLE_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return photon_beetle_128_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int photon_beetle_128_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= PHOTON_BEETLE_TAG_SIZE ?
+                   clen - PHOTON_BEETLE_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return photon_beetle_128_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int photon_beetle_32_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     unsigned char state[PHOTON256_STATE_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + PHOTON_BEETLE_TAG_SIZE))
+        return -2;
     *clen = mlen + PHOTON_BEETLE_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state by concatenating the nonce and the key */
     memcpy(state, npub, 16);
@@ -338,7 +441,7 @@ int photon_beetle_32_aead_encrypt
     /* Process the associated data */
     if (adlen > 0) {
         photon_beetle_process_ad
-            (state, ad, adlen, PHOTON_BEETLE_32_RATE, mlen == 0);
+            (state, &adcur, adlen, PHOTON_BEETLE_32_RATE, mlen == 0);
     } else if (mlen == 0) {
         state[PHOTON256_STATE_SIZE - 1] ^= DOMAIN(1);
     }
@@ -346,30 +449,39 @@ int photon_beetle_32_aead_encrypt
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0) {
         photon_beetle_encrypt
-            (state, c, m, mlen, PHOTON_BEETLE_32_RATE, adlen == 0);
+            (state, &ccur, &mcur, mlen, PHOTON_BEETLE_32_RATE, adlen == 0);
     }
 
     /* Generate the authentication tag */
     photon256_permute(state);
-    memcpy(c + mlen, state, PHOTON_BEETLE_TAG_SIZE);
+    aead_iovec_write(&ccur, state, PHOTON_BEETLE_TAG_SIZE);
     return 0;
 }
 
-int photon_beetle_32_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int photon_beetle_32_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[PHOTON256_STATE_SIZE];
+    unsigned char tag[PHOTON_BEETLE_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < PHOTON_BEETLE_TAG_SIZE)
         return -1;
     *mlen = clen - PHOTON_BEETLE_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the state by concatenating the nonce and the key */
     memcpy(state, npub, 16);
@@ -379,7 +491,7 @@ int photon_beetle_32_aead_decrypt
     clen -= PHOTON_BEETLE_TAG_SIZE;
     if (adlen > 0) {
         photon_beetle_process_ad
-            (state, ad, adlen, PHOTON_BEETLE_32_RATE, clen == 0);
+            (state, &adcur, adlen, PHOTON_BEETLE_32_RATE, clen == 0);
     } else if (clen == 0) {
         state[PHOTON256_STATE_SIZE - 1] ^= DOMAIN(1);
     }
@@ -387,12 +499,47 @@ int photon_beetle_32_aead_decrypt
     /* Decrypt the ciphertext to produce the plaintext */
     if (clen > 0) {
         photon_beetle_decrypt
-            (state, m, c, clen, PHOTON_BEETLE_32_RATE, adlen == 0);
+            (state, &mcur, &ccur, clen, PHOTON_BEETLE_32_RATE, adlen == 0);
     }
 
     /* Check the authentication tag */
     photon256_permute(state);
-    return aead_check_tag(m, clen, state, c + clen, PHOTON_BEETLE_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, PHOTON_BEETLE_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, clen, state, tag, PHOTON_BEETLE_TAG_SIZE);
+}
+
+int photon_beetle_32_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + PHOTON_BEETLE_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return photon_beetle_32_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int photon_beetle_32_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= PHOTON_BEETLE_TAG_SIZE ?
+                   clen - PHOTON_BEETLE_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return photon_beetle_32_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
 
 int photon_beetle_hash
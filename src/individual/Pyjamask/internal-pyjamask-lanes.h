@@ -0,0 +1,463 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/* We expect a number of macros to be defined before this file
+ * is included to configure the kernel for a specific vector type.
+ *
+ * PYJAMASK_LANES_NAME    Suffix for the kernel names; e.g. _avx2
+ * PYJAMASK_LANES_TARGET  Target attribute for the kernels, may be empty.
+ * PYJAMASK_LANES_TYPE    Type of a vector of 32-bit words; e.g. __m256i
+ * PYJAMASK_LANES_WIDTH   Number of 32-bit words in a vector.
+ * PYJAMASK_LANES_LOAD    Loads a vector from a pointer to 32-bit words.
+ * PYJAMASK_LANES_STORE   Stores a vector to a pointer to 32-bit words.
+ * PYJAMASK_LANES_XOR     XOR's two vectors.
+ * PYJAMASK_LANES_AND     AND's two vectors.
+ * PYJAMASK_LANES_ROR     Rotates the words of a vector right by a constant.
+ * PYJAMASK_LANES_SET1    Broadcasts a 32-bit value to all words.
+ *
+ * Each lane of a vector holds the same row of a different block, so the
+ * kernels run the row-oriented Pyjamask round on many blocks at once.
+ *
+ * The circulant matrix multiplication in the reference code loops over
+ * all 32 bits of the row.  Here we instead use the fact that multiplying
+ * by a circulant matrix is the same as XOR'ing together rotated copies of
+ * the row, one for each bit that is set in the matrix.  This needs 11 to
+ * 15 rotations per row, which map directly onto vector shift instructions.
+ */
+#if defined(PYJAMASK_LANES_NAME)
+
+#define PYJAMASK_LANES_CONCAT_INNER(name,suffix) name##suffix
+#define PYJAMASK_LANES_CONCAT(name,suffix) \
+    PYJAMASK_LANES_CONCAT_INNER(name,suffix)
+
+/* Multiplies by the circulant matrix 0xa3861085 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_mix_row0, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = y;
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 2));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 6));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 7));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 8));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 14));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 19));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 24));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 29));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 31));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x63417021 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_mix_row1, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = PYJAMASK_LANES_ROR(y, 1);
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 2));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 6));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 7));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 9));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 15));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 17));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 18));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 19));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 26));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 31));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x692cf280 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_mix_row2, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = PYJAMASK_LANES_ROR(y, 1);
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 2));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 4));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 7));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 10));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 12));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 16));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 17));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 18));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 19));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 22));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 24));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x48a54813 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_mix_row3, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = PYJAMASK_LANES_ROR(y, 1);
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 4));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 8));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 10));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 15));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 17));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 20));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 27));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 30));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 31));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x2037a121 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_inv_mix_row0, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = PYJAMASK_LANES_ROR(y, 2);
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 10));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 11));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 14));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 15));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 16));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 18));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 23));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 26));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 31));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x108ff2a0 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_inv_mix_row1, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = PYJAMASK_LANES_ROR(y, 3);
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 8));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 12));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 14));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 15));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 16));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 17));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 18));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 19));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 22));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 24));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 26));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x9054d8c0 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_inv_mix_row2, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = y;
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 3));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 9));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 11));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 16));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 17));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 19));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 20));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 24));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 25));
+    return r;
+}
+
+/* Multiplies by the circulant matrix 0x3354b117 */
+PYJAMASK_LANES_TARGET STATIC_INLINE PYJAMASK_LANES_TYPE PYJAMASK_LANES_CONCAT
+    (pyjamask_lanes_inv_mix_row3, PYJAMASK_LANES_NAME)(PYJAMASK_LANES_TYPE y)
+{
+    PYJAMASK_LANES_TYPE r = PYJAMASK_LANES_ROR(y, 2);
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 3));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 6));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 7));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 9));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 11));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 13));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 16));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 18));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 19));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 23));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 27));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 29));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 30));
+    r = PYJAMASK_LANES_XOR(r, PYJAMASK_LANES_ROR(y, 31));
+    return r;
+}
+
+/* Adds a word of the round key to all lanes of a row */
+#define PYJAMASK_LANES_ADD_KEY(s, rk) \
+    (PYJAMASK_LANES_XOR((s), PYJAMASK_LANES_SET1((rk))))
+
+/**
+ * \brief Encrypts interleaved blocks with Pyjamask-128.
+ *
+ * \param k Points to the words of the Pyjamask-128 key schedule.
+ * \param S Points to row 0 of lane 0 of the interleaved blocks.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive rows of the same lane.  Must be a multiple of the width.
+ */
+PYJAMASK_LANES_TARGET static void PYJAMASK_LANES_CONCAT
+    (pyjamask_128_encrypt_lanes, PYJAMASK_LANES_NAME)
+    (const uint32_t *k, uint32_t *S, unsigned lanes)
+{
+    PYJAMASK_LANES_TYPE s0, s1, s2, s3, temp;
+    PYJAMASK_LANES_TYPE ones = PYJAMASK_LANES_SET1(0xFFFFFFFFU);
+    const uint32_t *rk;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += PYJAMASK_LANES_WIDTH) {
+        s0 = PYJAMASK_LANES_LOAD(S + group);
+        s1 = PYJAMASK_LANES_LOAD(S + lanes + group);
+        s2 = PYJAMASK_LANES_LOAD(S + lanes * 2 + group);
+        s3 = PYJAMASK_LANES_LOAD(S + lanes * 3 + group);
+        rk = k;
+        for (round = 0; round < PYJAMASK_ROUNDS; ++round, rk += 4) {
+            /* Add the round key to the state */
+            s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+            s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+            s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+            s3 = PYJAMASK_LANES_ADD_KEY(s3, rk[3]);
+
+            /* Apply the 128-bit Pyjamask sbox, swapping s2 and s3
+             * by renaming instead of with XOR's */
+            s0 = PYJAMASK_LANES_XOR(s0, s3);
+            s3 = PYJAMASK_LANES_XOR(s3, PYJAMASK_LANES_AND(s0, s1));
+            s0 = PYJAMASK_LANES_XOR(s0, PYJAMASK_LANES_AND(s1, s2));
+            s1 = PYJAMASK_LANES_XOR(s1, PYJAMASK_LANES_AND(s2, s3));
+            s2 = PYJAMASK_LANES_XOR(s2, PYJAMASK_LANES_AND(s0, s3));
+            s2 = PYJAMASK_LANES_XOR(s2, s1);
+            s1 = PYJAMASK_LANES_XOR(s1, s0);
+            temp = PYJAMASK_LANES_XOR(s3, ones);
+            s3 = s2;
+            s2 = temp;
+
+            /* Mix the rows of the state */
+            s0 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row0, PYJAMASK_LANES_NAME)(s0);
+            s1 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row1, PYJAMASK_LANES_NAME)(s1);
+            s2 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row2, PYJAMASK_LANES_NAME)(s2);
+            s3 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row3, PYJAMASK_LANES_NAME)(s3);
+        }
+        s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+        s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+        s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+        s3 = PYJAMASK_LANES_ADD_KEY(s3, rk[3]);
+        PYJAMASK_LANES_STORE(S + group, s0);
+        PYJAMASK_LANES_STORE(S + lanes + group, s1);
+        PYJAMASK_LANES_STORE(S + lanes * 2 + group, s2);
+        PYJAMASK_LANES_STORE(S + lanes * 3 + group, s3);
+    }
+}
+
+/**
+ * \brief Decrypts interleaved blocks with Pyjamask-128.
+ *
+ * \param k Points to the words of the Pyjamask-128 key schedule.
+ * \param S Points to row 0 of lane 0 of the interleaved blocks.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive rows of the same lane.  Must be a multiple of the width.
+ */
+PYJAMASK_LANES_TARGET static void PYJAMASK_LANES_CONCAT
+    (pyjamask_128_decrypt_lanes, PYJAMASK_LANES_NAME)
+    (const uint32_t *k, uint32_t *S, unsigned lanes)
+{
+    PYJAMASK_LANES_TYPE s0, s1, s2, s3, temp;
+    PYJAMASK_LANES_TYPE ones = PYJAMASK_LANES_SET1(0xFFFFFFFFU);
+    const uint32_t *rk;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += PYJAMASK_LANES_WIDTH) {
+        s0 = PYJAMASK_LANES_LOAD(S + group);
+        s1 = PYJAMASK_LANES_LOAD(S + lanes + group);
+        s2 = PYJAMASK_LANES_LOAD(S + lanes * 2 + group);
+        s3 = PYJAMASK_LANES_LOAD(S + lanes * 3 + group);
+        rk = k + 4 * PYJAMASK_ROUNDS;
+        s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+        s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+        s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+        s3 = PYJAMASK_LANES_ADD_KEY(s3, rk[3]);
+        for (round = 0; round < PYJAMASK_ROUNDS; ++round) {
+            rk -= 4;
+
+            /* Inverse mix of the rows in the state */
+            s0 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row0, PYJAMASK_LANES_NAME)(s0);
+            s1 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row1, PYJAMASK_LANES_NAME)(s1);
+            s2 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row2, PYJAMASK_LANES_NAME)(s2);
+            s3 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row3, PYJAMASK_LANES_NAME)(s3);
+
+            /* Apply the inverse of the 128-bit Pyjamask sbox */
+            temp = PYJAMASK_LANES_XOR(s2, ones);
+            s2 = s3;
+            s3 = temp;
+            s1 = PYJAMASK_LANES_XOR(s1, s0);
+            s2 = PYJAMASK_LANES_XOR(s2, s1);
+            s2 = PYJAMASK_LANES_XOR(s2, PYJAMASK_LANES_AND(s0, s3));
+            s1 = PYJAMASK_LANES_XOR(s1, PYJAMASK_LANES_AND(s2, s3));
+            s0 = PYJAMASK_LANES_XOR(s0, PYJAMASK_LANES_AND(s1, s2));
+            s3 = PYJAMASK_LANES_XOR(s3, PYJAMASK_LANES_AND(s0, s1));
+            s0 = PYJAMASK_LANES_XOR(s0, s3);
+
+            /* Add the round key to the state */
+            s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+            s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+            s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+            s3 = PYJAMASK_LANES_ADD_KEY(s3, rk[3]);
+        }
+        PYJAMASK_LANES_STORE(S + group, s0);
+        PYJAMASK_LANES_STORE(S + lanes + group, s1);
+        PYJAMASK_LANES_STORE(S + lanes * 2 + group, s2);
+        PYJAMASK_LANES_STORE(S + lanes * 3 + group, s3);
+    }
+}
+
+/**
+ * \brief Encrypts interleaved blocks with Pyjamask-96.
+ *
+ * \param k Points to the words of the Pyjamask-96 key schedule.
+ * \param S Points to row 0 of lane 0 of the interleaved blocks.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive rows of the same lane.  Must be a multiple of the width.
+ */
+PYJAMASK_LANES_TARGET static void PYJAMASK_LANES_CONCAT
+    (pyjamask_96_encrypt_lanes, PYJAMASK_LANES_NAME)
+    (const uint32_t *k, uint32_t *S, unsigned lanes)
+{
+    PYJAMASK_LANES_TYPE s0, s1, s2;
+    PYJAMASK_LANES_TYPE ones = PYJAMASK_LANES_SET1(0xFFFFFFFFU);
+    const uint32_t *rk;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += PYJAMASK_LANES_WIDTH) {
+        s0 = PYJAMASK_LANES_LOAD(S + group);
+        s1 = PYJAMASK_LANES_LOAD(S + lanes + group);
+        s2 = PYJAMASK_LANES_LOAD(S + lanes * 2 + group);
+        rk = k;
+        for (round = 0; round < PYJAMASK_ROUNDS; ++round, rk += 3) {
+            /* Add the round key to the state */
+            s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+            s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+            s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+
+            /* Apply the 96-bit Pyjamask sbox */
+            s0 = PYJAMASK_LANES_XOR(s0, s1);
+            s1 = PYJAMASK_LANES_XOR(s1, s2);
+            s2 = PYJAMASK_LANES_XOR(s2, PYJAMASK_LANES_AND(s0, s1));
+            s0 = PYJAMASK_LANES_XOR(s0, PYJAMASK_LANES_AND(s1, s2));
+            s1 = PYJAMASK_LANES_XOR(s1, PYJAMASK_LANES_AND(s0, s2));
+            s2 = PYJAMASK_LANES_XOR(s2, s0);
+            s2 = PYJAMASK_LANES_XOR(s2, ones);
+            s1 = PYJAMASK_LANES_XOR(s1, s0);
+            s0 = PYJAMASK_LANES_XOR(s0, s1);
+
+            /* Mix the rows of the state */
+            s0 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row0, PYJAMASK_LANES_NAME)(s0);
+            s1 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row1, PYJAMASK_LANES_NAME)(s1);
+            s2 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_mix_row2, PYJAMASK_LANES_NAME)(s2);
+        }
+        s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+        s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+        s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+        PYJAMASK_LANES_STORE(S + group, s0);
+        PYJAMASK_LANES_STORE(S + lanes + group, s1);
+        PYJAMASK_LANES_STORE(S + lanes * 2 + group, s2);
+    }
+}
+
+/**
+ * \brief Decrypts interleaved blocks with Pyjamask-96.
+ *
+ * \param k Points to the words of the Pyjamask-96 key schedule.
+ * \param S Points to row 0 of lane 0 of the interleaved blocks.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive rows of the same lane.  Must be a multiple of the width.
+ */
+PYJAMASK_LANES_TARGET static void PYJAMASK_LANES_CONCAT
+    (pyjamask_96_decrypt_lanes, PYJAMASK_LANES_NAME)
+    (const uint32_t *k, uint32_t *S, unsigned lanes)
+{
+    PYJAMASK_LANES_TYPE s0, s1, s2;
+    PYJAMASK_LANES_TYPE ones = PYJAMASK_LANES_SET1(0xFFFFFFFFU);
+    const uint32_t *rk;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += PYJAMASK_LANES_WIDTH) {
+        s0 = PYJAMASK_LANES_LOAD(S + group);
+        s1 = PYJAMASK_LANES_LOAD(S + lanes + group);
+        s2 = PYJAMASK_LANES_LOAD(S + lanes * 2 + group);
+        rk = k + 3 * PYJAMASK_ROUNDS;
+        s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+        s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+        s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+        for (round = 0; round < PYJAMASK_ROUNDS; ++round) {
+            rk -= 3;
+
+            /* Inverse mix of the rows in the state */
+            s0 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row0, PYJAMASK_LANES_NAME)(s0);
+            s1 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row1, PYJAMASK_LANES_NAME)(s1);
+            s2 = PYJAMASK_LANES_CONCAT
+                (pyjamask_lanes_inv_mix_row2, PYJAMASK_LANES_NAME)(s2);
+
+            /* Apply the inverse of the 96-bit Pyjamask sbox */
+            s0 = PYJAMASK_LANES_XOR(s0, s1);
+            s1 = PYJAMASK_LANES_XOR(s1, s0);
+            s2 = PYJAMASK_LANES_XOR(s2, ones);
+            s2 = PYJAMASK_LANES_XOR(s2, s0);
+            s1 = PYJAMASK_LANES_XOR(s1, PYJAMASK_LANES_AND(s0, s2));
+            s0 = PYJAMASK_LANES_XOR(s0, PYJAMASK_LANES_AND(s1, s2));
+            s2 = PYJAMASK_LANES_XOR(s2, PYJAMASK_LANES_AND(s0, s1));
+            s1 = PYJAMASK_LANES_XOR(s1, s2);
+            s0 = PYJAMASK_LANES_XOR(s0, s1);
+
+            /* Add the round key to the state */
+            s0 = PYJAMASK_LANES_ADD_KEY(s0, rk[0]);
+            s1 = PYJAMASK_LANES_ADD_KEY(s1, rk[1]);
+            s2 = PYJAMASK_LANES_ADD_KEY(s2, rk[2]);
+        }
+        PYJAMASK_LANES_STORE(S + group, s0);
+        PYJAMASK_LANES_STORE(S + lanes + group, s1);
+        PYJAMASK_LANES_STORE(S + lanes * 2 + group, s2);
+    }
+}
+
+#endif /* PYJAMASK_LANES_NAME */
+
+/* Now undefine everything so that we can include this file again for
+ * another vector type */
+#undef PYJAMASK_LANES_NAME
+#undef PYJAMASK_LANES_TARGET
+#undef PYJAMASK_LANES_TYPE
+#undef PYJAMASK_LANES_WIDTH
+#undef PYJAMASK_LANES_LOAD
+#undef PYJAMASK_LANES_STORE
+#undef PYJAMASK_LANES_XOR
+#undef PYJAMASK_LANES_AND
+#undef PYJAMASK_LANES_ROR
+#undef PYJAMASK_LANES_SET1
+#undef PYJAMASK_LANES_CONCAT_INNER
+#undef PYJAMASK_LANES_CONCAT
+#undef PYJAMASK_LANES_ADD_KEY
@@ -103,6 +103,8 @@ void pyjamask_masked_128_setup_key
     uint32_t k0, k1, k2, k3;
     uint8_t order;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_SETUP_KEY);
+
     /* Make sure that the system random number generator is initialized */
     aead_masking_init();
 
@@ -184,6 +186,8 @@ void pyjamask_masked_96_setup_key
     uint32_t k0, k1, k2, k3;
     uint8_t order;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_SETUP_KEY);
+
     /* Make sure that the system random number generator is initialized */
     aead_masking_init();
 
@@ -267,6 +271,8 @@ void pyjamask_masked_128_encrypt
     uint32_t m[PYJAMASK_MASKING_ORDER - 1][4];
     uint8_t order, round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_ENCRYPT);
+
     /* Generate random masking plaintexts */
     aead_masking_generate(m, sizeof(m));
 
@@ -364,6 +370,8 @@ void pyjamask_masked_128_decrypt
     uint8_t round;
     int order;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_DECRYPT);
+
     /* Generate random masking plaintexts */
     aead_masking_generate(m, sizeof(m));
 
@@ -461,6 +469,8 @@ void pyjamask_masked_96_encrypt
     uint32_t m[PYJAMASK_MASKING_ORDER - 1][3];
     uint8_t order, round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_ENCRYPT);
+
     /* Generate random masking plaintexts */
     aead_masking_generate(m, sizeof(m));
 
@@ -546,6 +556,8 @@ void pyjamask_masked_96_decrypt
     uint8_t round;
     int order;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_DECRYPT);
+
     /* Generate random masking plaintexts */
     aead_masking_generate(m, sizeof(m));
 
@@ -21,6 +21,7 @@
  */
 
 #include "internal-pyjamask.h"
+#include "internal-cpu.h"
 #include "internal-util.h"
 
 #if !defined(__AVR__)
@@ -59,6 +60,8 @@ void pyjamask_128_setup_key
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_SETUP_KEY);
+
     /* Load the words of the key */
     k0 = be_load_word32(key);
     k1 = be_load_word32(key + 4);
@@ -107,6 +110,8 @@ void pyjamask_96_setup_key
     uint32_t temp;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_SETUP_KEY);
+
     /* Load the words of the key */
     k0 = be_load_word32(key);
     k1 = be_load_word32(key + 4);
@@ -153,6 +158,8 @@ void pyjamask_128_encrypt
     uint32_t s0, s1, s2, s3;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_ENCRYPT);
+
     /* Load the plaintext from the input buffer */
     s0 = be_load_word32(input);
     s1 = be_load_word32(input + 4);
@@ -208,6 +215,8 @@ void pyjamask_128_decrypt
     uint32_t s0, s1, s2, s3;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_DECRYPT);
+
     /* Load the ciphertext from the input buffer */
     s0 = be_load_word32(input);
     s1 = be_load_word32(input + 4);
@@ -264,6 +273,8 @@ void pyjamask_96_encrypt
     uint32_t s0, s1, s2;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_ENCRYPT);
+
     /* Load the plaintext from the input buffer */
     s0 = be_load_word32(input);
     s1 = be_load_word32(input + 4);
@@ -312,6 +323,8 @@ void pyjamask_96_decrypt
     uint32_t s0, s1, s2;
     uint8_t round;
 
+    aead_count_call(AEAD_PRIMITIVE_PYJAMASK_DECRYPT);
+
     /* Load the plaintext from the input buffer */
     s0 = be_load_word32(input);
     s1 = be_load_word32(input + 4);
@@ -353,4 +366,281 @@ void pyjamask_96_decrypt
     be_store_word32(output + 8,  s2);
 }
 
-#endif /* !__AVR__ */
+/* Multi-lane kernels, instantiated from internal-pyjamask-lanes.h for
+ * plain C and for each vector instruction set that we can target */
+#define PYJAMASK_LANES_NAME _c
+#define PYJAMASK_LANES_TARGET
+#define PYJAMASK_LANES_TYPE uint32_t
+#define PYJAMASK_LANES_WIDTH 1
+#define PYJAMASK_LANES_LOAD(ptr) (*(ptr))
+#define PYJAMASK_LANES_STORE(ptr, x) (*(ptr) = (x))
+#define PYJAMASK_LANES_XOR(a, b) ((a) ^ (b))
+#define PYJAMASK_LANES_AND(a, b) ((a) & (b))
+#define PYJAMASK_LANES_ROR(a, bits) (rightRotate((a), (bits)))
+#define PYJAMASK_LANES_SET1(value) ((uint32_t)(value))
+#include "internal-pyjamask-lanes.h"
+
+#if defined(LW_CPU_HAVE_SSE2)
+#include <emmintrin.h>
+#define PYJAMASK_LANES_NAME _sse2
+#define PYJAMASK_LANES_TARGET LW_CPU_TARGET("sse2")
+#define PYJAMASK_LANES_TYPE __m128i
+#define PYJAMASK_LANES_WIDTH 4
+#define PYJAMASK_LANES_LOAD(ptr) (_mm_loadu_si128((const __m128i *)(ptr)))
+#define PYJAMASK_LANES_STORE(ptr, x) \
+    (_mm_storeu_si128((__m128i *)(ptr), (x)))
+#define PYJAMASK_LANES_XOR _mm_xor_si128
+#define PYJAMASK_LANES_AND _mm_and_si128
+#define PYJAMASK_LANES_ROR(a, bits) \
+    (_mm_or_si128(_mm_srli_epi32((a), (bits)), \
+                  _mm_slli_epi32((a), 32 - (bits))))
+#define PYJAMASK_LANES_SET1(value) (_mm_set1_epi32((int)(value)))
+#include "internal-pyjamask-lanes.h"
+#endif /* LW_CPU_HAVE_SSE2 */
+
+#if defined(LW_CPU_HAVE_AVX2)
+#include <immintrin.h>
+#define PYJAMASK_LANES_NAME _avx2
+#define PYJAMASK_LANES_TARGET LW_CPU_TARGET("avx2")
+#define PYJAMASK_LANES_TYPE __m256i
+#define PYJAMASK_LANES_WIDTH 8
+#define PYJAMASK_LANES_LOAD(ptr) \
+    (_mm256_loadu_si256((const __m256i *)(ptr)))
+#define PYJAMASK_LANES_STORE(ptr, x) \
+    (_mm256_storeu_si256((__m256i *)(ptr), (x)))
+#define PYJAMASK_LANES_XOR _mm256_xor_si256
+#define PYJAMASK_LANES_AND _mm256_and_si256
+#define PYJAMASK_LANES_ROR(a, bits) \
+    (_mm256_or_si256(_mm256_srli_epi32((a), (bits)), \
+                     _mm256_slli_epi32((a), 32 - (bits))))
+#define PYJAMASK_LANES_SET1(value) (_mm256_set1_epi32((int)(value)))
+#include "internal-pyjamask-lanes.h"
+#endif /* LW_CPU_HAVE_AVX2 */
+
+#if defined(LW_CPU_HAVE_AVX512F)
+#define PYJAMASK_LANES_NAME _avx512
+#define PYJAMASK_LANES_TARGET LW_CPU_TARGET("avx512f")
+#define PYJAMASK_LANES_TYPE __m512i
+#define PYJAMASK_LANES_WIDTH 16
+#define PYJAMASK_LANES_LOAD(ptr) (_mm512_loadu_si512((ptr)))
+#define PYJAMASK_LANES_STORE(ptr, x) (_mm512_storeu_si512((ptr), (x)))
+#define PYJAMASK_LANES_XOR _mm512_xor_si512
+#define PYJAMASK_LANES_AND _mm512_and_si512
+#define PYJAMASK_LANES_ROR _mm512_ror_epi32
+#define PYJAMASK_LANES_SET1(value) (_mm512_set1_epi32((int)(value)))
+#include "internal-pyjamask-lanes.h"
+#endif /* LW_CPU_HAVE_AVX512F */
+
+/**
+ * \brief Kernel for encrypting or decrypting interleaved Pyjamask blocks.
+ */
+typedef void (*pyjamask_lanes_kernel_t)
+    (const uint32_t *k, uint32_t *S, unsigned lanes);
+
+/**
+ * \brief Multi-lane kernels for a specific vector width.
+ */
+typedef struct
+{
+    unsigned width;                     /**< Number of lanes */
+    pyjamask_lanes_kernel_t encrypt128; /**< Pyjamask-128 encryption */
+    pyjamask_lanes_kernel_t decrypt128; /**< Pyjamask-128 decryption */
+    pyjamask_lanes_kernel_t encrypt96;  /**< Pyjamask-96 encryption */
+    pyjamask_lanes_kernel_t decrypt96;  /**< Pyjamask-96 decryption */
+
+} pyjamask_lanes_t;
+
+static pyjamask_lanes_t const pyjamask_lanes_c = {
+    1, pyjamask_128_encrypt_lanes_c, pyjamask_128_decrypt_lanes_c,
+    pyjamask_96_encrypt_lanes_c, pyjamask_96_decrypt_lanes_c
+};
+#if defined(LW_CPU_HAVE_SSE2)
+static pyjamask_lanes_t const pyjamask_lanes_sse2 = {
+    4, pyjamask_128_encrypt_lanes_sse2, pyjamask_128_decrypt_lanes_sse2,
+    pyjamask_96_encrypt_lanes_sse2, pyjamask_96_decrypt_lanes_sse2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+static pyjamask_lanes_t const pyjamask_lanes_avx2 = {
+    8, pyjamask_128_encrypt_lanes_avx2, pyjamask_128_decrypt_lanes_avx2,
+    pyjamask_96_encrypt_lanes_avx2, pyjamask_96_decrypt_lanes_avx2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX512F)
+static pyjamask_lanes_t const pyjamask_lanes_avx512 = {
+    16, pyjamask_128_encrypt_lanes_avx512, pyjamask_128_decrypt_lanes_avx512,
+    pyjamask_96_encrypt_lanes_avx512, pyjamask_96_decrypt_lanes_avx512
+};
+#endif
+
+/**
+ * \brief Multi-lane kernels that have been bound for this CPU.
+ */
+static const pyjamask_lanes_t *pyjamask_lanes = 0;
+
+/**
+ * \brief Selects the widest multi-lane kernels for this CPU.
+ *
+ * \return The kernels to use.
+ */
+static const pyjamask_lanes_t *pyjamask_lanes_select(void)
+{
+    unsigned features = lw_cpu_features();
+#if defined(LW_CPU_HAVE_AVX512F)
+    if (features & LW_CPU_AVX512F)
+        return &pyjamask_lanes_avx512;
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+    if (features & LW_CPU_AVX2)
+        return &pyjamask_lanes_avx2;
+#endif
+#if defined(LW_CPU_HAVE_SSE2)
+    if (features & LW_CPU_SSE2)
+        return &pyjamask_lanes_sse2;
+#endif
+    (void)features;
+    return &pyjamask_lanes_c;
+}
+
+/**
+ * \brief Gets the multi-lane kernels for this CPU, binding them on
+ * first use.
+ *
+ * \return The kernels to use.
+ */
+static const pyjamask_lanes_t *pyjamask_lanes_get(void)
+{
+    const pyjamask_lanes_t *lanes = LW_CPU_LOAD(pyjamask_lanes);
+    if (!lanes) {
+        lanes = pyjamask_lanes_select();
+        LW_CPU_STORE(pyjamask_lanes, lanes);
+    }
+    return lanes;
+}
+
+/**
+ * \brief Encrypts or decrypts several blocks with Pyjamask.
+ *
+ * \param k Points to the words of the key schedule.
+ * \param output Output buffer for the blocks.
+ * \param input Input buffer for the blocks.
+ * \param count Number of blocks.
+ * \param rows Number of 32-bit rows in a block; 4 or 3.
+ * \param kernel Kernel to apply to the interleaved blocks.
+ * \param width Number of lanes in a vector for the kernel.
+ */
+static void pyjamask_crypt_blocks
+    (const uint32_t *k, unsigned char *output, const unsigned char *input,
+     size_t count, unsigned rows, pyjamask_lanes_kernel_t kernel,
+     unsigned width)
+{
+    uint32_t S[4 * PYJAMASK_BLOCKS_MAX];
+    unsigned n, lanes, lane, row;
+
+    /* Process the blocks in groups, padding the last group out to
+     * a whole number of vectors */
+    while (count > 0) {
+        n = count < PYJAMASK_BLOCKS_MAX
+                ? (unsigned)count : PYJAMASK_BLOCKS_MAX;
+        lanes = (n + width - 1) / width * width;
+        for (lane = 0; lane < n; ++lane) {
+            for (row = 0; row < rows; ++row) {
+                S[row * lanes + lane] =
+                    be_load_word32(input + (lane * rows + row) * 4);
+            }
+        }
+        for (; lane < lanes; ++lane) {
+            for (row = 0; row < rows; ++row)
+                S[row * lanes + lane] = 0;
+        }
+        (*kernel)(k, S, lanes);
+        for (lane = 0; lane < n; ++lane) {
+            for (row = 0; row < rows; ++row) {
+                be_store_word32
+                    (output + (lane * rows + row) * 4, S[row * lanes + lane]);
+            }
+        }
+        input += n * rows * 4;
+        output += n * rows * 4;
+        count -= n;
+    }
+}
+
+void pyjamask_128_encrypt_blocks
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    const pyjamask_lanes_t *impl = pyjamask_lanes_get();
+    aead_count_calls(AEAD_PRIMITIVE_PYJAMASK_ENCRYPT, count);
+    pyjamask_crypt_blocks
+        (ks->k, output, input, count, 4, impl->encrypt128, impl->width);
+}
+
+void pyjamask_128_decrypt_blocks
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    const pyjamask_lanes_t *impl = pyjamask_lanes_get();
+    aead_count_calls(AEAD_PRIMITIVE_PYJAMASK_DECRYPT, count);
+    pyjamask_crypt_blocks
+        (ks->k, output, input, count, 4, impl->decrypt128, impl->width);
+}
+
+void pyjamask_96_encrypt_blocks
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    const pyjamask_lanes_t *impl = pyjamask_lanes_get();
+    aead_count_calls(AEAD_PRIMITIVE_PYJAMASK_ENCRYPT, count);
+    pyjamask_crypt_blocks
+        (ks->k, output, input, count, 3, impl->encrypt96, impl->width);
+}
+
+void pyjamask_96_decrypt_blocks
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    const pyjamask_lanes_t *impl = pyjamask_lanes_get();
+    aead_count_calls(AEAD_PRIMITIVE_PYJAMASK_DECRYPT, count);
+    pyjamask_crypt_blocks
+        (ks->k, output, input, count, 3, impl->decrypt96, impl->width);
+}
+
+#else /* __AVR__ */
+
+/* The AVR version of the block cipher is in assembly code, so process
+ * multiple blocks one at a time on top of that */
+
+void pyjamask_128_encrypt_blocks
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    for (; count > 0; --count, output += 16, input += 16)
+        pyjamask_128_encrypt(ks, output, input);
+}
+
+void pyjamask_128_decrypt_blocks
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    for (; count > 0; --count, output += 16, input += 16)
+        pyjamask_128_decrypt(ks, output, input);
+}
+
+void pyjamask_96_encrypt_blocks
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    for (; count > 0; --count, output += 12, input += 12)
+        pyjamask_96_encrypt(ks, output, input);
+}
+
+void pyjamask_96_decrypt_blocks
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count)
+{
+    for (; count > 0; --count, output += 12, input += 12)
+        pyjamask_96_decrypt(ks, output, input);
+}
+
+#endif /* __AVR__ */
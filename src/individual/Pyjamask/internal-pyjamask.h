@@ -164,6 +164,83 @@ void pyjamask_96_decrypt
     (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input);
 
+/**
+ * \brief Maximum number of blocks that the Pyjamask multi-block functions
+ * process in one pass.
+ *
+ * Callers can pass any number of blocks, but passing a multiple of this
+ * value keeps all vector lanes busy.
+ */
+#if defined(__AVR__)
+#define PYJAMASK_BLOCKS_MAX 1
+#else
+#define PYJAMASK_BLOCKS_MAX 16
+#endif
+
+/**
+ * \brief Encrypts several 128-bit blocks with Pyjamask-128 in ECB mode.
+ *
+ * \param ks Points to the key schedule.
+ * \param output Output buffer which must be at least 16 * count bytes.
+ * \param input Input buffer which must be at least 16 * count bytes.
+ * \param count Number of blocks to encrypt.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place encryption.
+ *
+ * The blocks are encrypted in parallel with the widest vector
+ * instructions that the CPU supports.  This is useful for modes like
+ * OCB where the blocks of a message are independent.
+ */
+void pyjamask_128_encrypt_blocks
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count);
+
+/**
+ * \brief Decrypts several 128-bit blocks with Pyjamask-128 in ECB mode.
+ *
+ * \param ks Points to the key schedule.
+ * \param output Output buffer which must be at least 16 * count bytes.
+ * \param input Input buffer which must be at least 16 * count bytes.
+ * \param count Number of blocks to decrypt.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place decryption.
+ */
+void pyjamask_128_decrypt_blocks
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count);
+
+/**
+ * \brief Encrypts several 96-bit blocks with Pyjamask-96 in ECB mode.
+ *
+ * \param ks Points to the key schedule.
+ * \param output Output buffer which must be at least 12 * count bytes.
+ * \param input Input buffer which must be at least 12 * count bytes.
+ * \param count Number of blocks to encrypt.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place encryption.
+ */
+void pyjamask_96_encrypt_blocks
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count);
+
+/**
+ * \brief Decrypts several 96-bit blocks with Pyjamask-96 in ECB mode.
+ *
+ * \param ks Points to the key schedule.
+ * \param output Output buffer which must be at least 12 * count bytes.
+ * \param input Input buffer which must be at least 12 * count bytes.
+ * \param count Number of blocks to decrypt.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place decryption.
+ */
+void pyjamask_96_decrypt_blocks
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count);
+
 /**
  * \brief Sets up the key schedule for the masked Pyjamask-128 block cipher.
  *
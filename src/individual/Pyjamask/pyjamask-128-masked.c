@@ -23,16 +23,6 @@
 #include "pyjamask.h"
 #include "internal-pyjamask.h"
 
-aead_cipher_t const pyjamask_masked_128_cipher = {
-    "Pyjamask-128-AEAD-Masked",
-    PYJAMASK_128_KEY_SIZE,
-    PYJAMASK_128_NONCE_SIZE,
-    PYJAMASK_128_TAG_SIZE,
-    AEAD_FLAG_NONE,
-    pyjamask_masked_128_aead_encrypt,
-    pyjamask_masked_128_aead_decrypt
-};
-
 #define OCB_ALG_NAME pyjamask_masked_128
 #define OCB_BLOCK_SIZE 16
 #define OCB_NONCE_SIZE PYJAMASK_128_NONCE_SIZE
@@ -42,3 +32,24 @@ aead_cipher_t const pyjamask_masked_128_cipher = {
 #define OCB_ENCRYPT_BLOCK pyjamask_masked_128_encrypt
 #define OCB_DECRYPT_BLOCK pyjamask_masked_128_decrypt
 #include "internal-ocb.h"
+
+aead_cipher_t const pyjamask_masked_128_cipher = {
+    "Pyjamask-128-AEAD-Masked",
+    PYJAMASK_128_KEY_SIZE,
+    PYJAMASK_128_NONCE_SIZE,
+    PYJAMASK_128_TAG_SIZE,
+    AEAD_FLAG_NONE,
+    pyjamask_masked_128_aead_encrypt,
+    pyjamask_masked_128_aead_decrypt,
+    sizeof(pyjamask_masked_128_state_t),
+    pyjamask_masked_128_aead_setup_key,
+    pyjamask_masked_128_aead_encrypt_ctx,
+    pyjamask_masked_128_aead_decrypt_ctx,
+    pyjamask_masked_128_aead_encrypt_vec,
+    pyjamask_masked_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
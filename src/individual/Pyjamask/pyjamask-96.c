@@ -23,16 +23,6 @@
 #include "pyjamask.h"
 #include "internal-pyjamask.h"
 
-aead_cipher_t const pyjamask_96_cipher = {
-    "Pyjamask-96-AEAD",
-    PYJAMASK_96_KEY_SIZE,
-    PYJAMASK_96_NONCE_SIZE,
-    PYJAMASK_96_TAG_SIZE,
-    AEAD_FLAG_NONE,
-    pyjamask_96_aead_encrypt,
-    pyjamask_96_aead_decrypt
-};
-
 #define OCB_ALG_NAME pyjamask_96
 #define OCB_BLOCK_SIZE 12
 #define OCB_NONCE_SIZE PYJAMASK_96_NONCE_SIZE
@@ -41,4 +31,28 @@ aead_cipher_t const pyjamask_96_cipher = {
 #define OCB_SETUP_KEY pyjamask_96_setup_key
 #define OCB_ENCRYPT_BLOCK pyjamask_96_encrypt
 #define OCB_DECRYPT_BLOCK pyjamask_96_decrypt
+#define OCB_ENCRYPT_BLOCKS pyjamask_96_encrypt_blocks
+#define OCB_DECRYPT_BLOCKS pyjamask_96_decrypt_blocks
+#define OCB_PARALLEL_BLOCKS PYJAMASK_BLOCKS_MAX
 #include "internal-ocb.h"
+
+aead_cipher_t const pyjamask_96_cipher = {
+    "Pyjamask-96-AEAD",
+    PYJAMASK_96_KEY_SIZE,
+    PYJAMASK_96_NONCE_SIZE,
+    PYJAMASK_96_TAG_SIZE,
+    AEAD_FLAG_NONE,
+    pyjamask_96_aead_encrypt,
+    pyjamask_96_aead_decrypt,
+    sizeof(pyjamask_96_state_t),
+    pyjamask_96_aead_setup_key,
+    pyjamask_96_aead_encrypt_ctx,
+    pyjamask_96_aead_decrypt_ctx,
+    pyjamask_96_aead_encrypt_vec,
+    pyjamask_96_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
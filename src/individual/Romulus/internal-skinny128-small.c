@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/* Builds the small key schedule variant of SKINNY-128 so that key contexts
+ * can select it at runtime, unless it is already the default variant */
+#if !defined(SKINNY_128_SMALL_SCHEDULE)
+#define SKINNY_128_SMALL_SCHEDULE 0
+#endif
+#if !defined(__AVR__) && !SKINNY_128_SMALL_SCHEDULE
+
+#undef SKINNY_128_SMALL_SCHEDULE
+#define SKINNY_128_SMALL_SCHEDULE 1
+#define SKINNY_128_VARIANT_SUFFIX _small
+#include "internal-skinny128.c"
+
+#endif
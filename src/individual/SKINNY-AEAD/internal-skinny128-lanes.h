@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/* We expect a number of macros to be defined before this file
+ * is included to configure the kernel for a specific vector type.
+ *
+ * SKINNY_LANES_NAME      Suffix for the kernel names; e.g. _avx2
+ * SKINNY_LANES_TARGET    Target attribute for the kernels, may be empty.
+ * SKINNY_LANES_TYPE      Type of a vector of 32-bit words; e.g. __m256i
+ * SKINNY_LANES_WIDTH     Number of 32-bit words in a vector.
+ * SKINNY_LANES_LOAD      Loads a vector from a pointer to 32-bit words.
+ * SKINNY_LANES_STORE     Stores a vector to a pointer to 32-bit words.
+ * SKINNY_LANES_XOR       XOR's two vectors.
+ * SKINNY_LANES_AND       AND's two vectors.
+ * SKINNY_LANES_OR        OR's two vectors.
+ * SKINNY_LANES_SHL       Shifts the words of a vector left by a constant.
+ * SKINNY_LANES_SHR       Shifts the words of a vector right by a constant.
+ * SKINNY_LANES_ROL       Rotates the words of a vector left by 8, 16, or 24.
+ * SKINNY_LANES_SET1      Broadcasts a 32-bit value to all words.
+ *
+ * Each lane of a vector holds the same word of a different block, so the
+ * kernels run the word-oriented SKINNY-128 round on many blocks at once.
+ * The blocks share the TK2/TK3 part of the key schedule but each block
+ * has its own value for TK1.
+ */
+#if defined(SKINNY_LANES_NAME)
+
+#define SKINNY_LANES_CONCAT_INNER(name,suffix) name##suffix
+#define SKINNY_LANES_CONCAT(name,suffix) SKINNY_LANES_CONCAT_INNER(name,suffix)
+
+#include "internal-skinnyutil-lanes.h"
+
+/* Vector version of skinny_128_384_round().  "k0" and "k1" are the
+ * half of TK1 to use for this round and "p0" and "p1" are the other
+ * half, which is permuted for the next round */
+#define SKINNY_LANES_ROUND(s0, s1, s2, s3, k0, k1, p0, p1, offset) \
+    do { \
+        SKINNY_LANES_SBOX(s0); \
+        SKINNY_LANES_SBOX(s1); \
+        SKINNY_LANES_SBOX(s2); \
+        SKINNY_LANES_SBOX(s3); \
+        s0 = SKINNY_LANES_XOR3 \
+            (s0, SKINNY_LANES_SET1(schedule[(offset) * 2]), k0); \
+        s1 = SKINNY_LANES_XOR3 \
+            (s1, SKINNY_LANES_SET1(schedule[(offset) * 2 + 1]), k1); \
+        s2 = SKINNY_LANES_XOR(s2, SKINNY_LANES_SET1(0x02)); \
+        s1 = SKINNY_LANES_ROL(s1, 8); \
+        s2 = SKINNY_LANES_ROL(s2, 16); \
+        s3 = SKINNY_LANES_ROL(s3, 24); \
+        s1 = SKINNY_LANES_XOR(s1, s2); \
+        s2 = SKINNY_LANES_XOR(s2, s0); \
+        s3 = SKINNY_LANES_XOR(s3, s2); \
+        SKINNY_LANES_PERMUTE_TK_HALF(p0, p1); \
+    } while (0)
+
+/* Vector version of skinny_128_384_inv_round().  "p0" and "p1" are the
+ * half of TK1 that is inverse permuted for this round and "k0" and "k1"
+ * are the half to use for this round */
+#define SKINNY_LANES_INV_ROUND(s0, s1, s2, s3, k0, k1, p0, p1, offset) \
+    do { \
+        SKINNY_LANES_INV_PERMUTE_TK_HALF(p0, p1); \
+        s0 = SKINNY_LANES_XOR(s0, s3); \
+        s3 = SKINNY_LANES_XOR(s3, s1); \
+        s2 = SKINNY_LANES_XOR(s2, s3); \
+        s2 = SKINNY_LANES_ROL(s2, 24); \
+        s3 = SKINNY_LANES_ROL(s3, 16); \
+        s0 = SKINNY_LANES_ROL(s0, 8); \
+        s1 = SKINNY_LANES_XOR3 \
+            (s1, SKINNY_LANES_SET1(schedule[(offset) * 2]), k0); \
+        s2 = SKINNY_LANES_XOR3 \
+            (s2, SKINNY_LANES_SET1(schedule[(offset) * 2 + 1]), k1); \
+        s3 = SKINNY_LANES_XOR(s3, SKINNY_LANES_SET1(0x02)); \
+        SKINNY_LANES_INV_SBOX(s0); \
+        SKINNY_LANES_INV_SBOX(s1); \
+        SKINNY_LANES_INV_SBOX(s2); \
+        SKINNY_LANES_INV_SBOX(s3); \
+    } while (0)
+
+/**
+ * \brief Encrypts interleaved blocks with SKINNY-128-384.
+ *
+ * \param k Points to the TK2/TK3 part of the key schedule, with the
+ * round constants for the first two rows already applied.
+ * \param S Points to word 0 of lane 0 of the interleaved blocks.
+ * \param T Points to word 0 of lane 0 of the interleaved TK1 values.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive words of the same lane.  Must be a multiple of the width.
+ *
+ * The contents of \a T are destroyed.
+ */
+SKINNY_LANES_TARGET static void SKINNY_LANES_CONCAT
+    (skinny_128_384_encrypt_lanes, SKINNY_LANES_NAME)
+    (const uint32_t *k, uint32_t *S, uint32_t *T, unsigned lanes)
+{
+    SKINNY_LANES_TYPE s0, s1, s2, s3;
+    SKINNY_LANES_TYPE t0, t1, t2, t3;
+    const uint32_t *schedule;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += SKINNY_LANES_WIDTH) {
+        s0 = SKINNY_LANES_LOAD(S + group);
+        s1 = SKINNY_LANES_LOAD(S + lanes + group);
+        s2 = SKINNY_LANES_LOAD(S + lanes * 2 + group);
+        s3 = SKINNY_LANES_LOAD(S + lanes * 3 + group);
+        t0 = SKINNY_LANES_LOAD(T + group);
+        t1 = SKINNY_LANES_LOAD(T + lanes + group);
+        t2 = SKINNY_LANES_LOAD(T + lanes * 2 + group);
+        t3 = SKINNY_LANES_LOAD(T + lanes * 3 + group);
+        schedule = k;
+        for (round = 0; round < SKINNY_128_384_ROUNDS; round += 4) {
+            SKINNY_LANES_ROUND(s0, s1, s2, s3, t0, t1, t2, t3, 0);
+            SKINNY_LANES_ROUND(s3, s0, s1, s2, t2, t3, t0, t1, 1);
+            SKINNY_LANES_ROUND(s2, s3, s0, s1, t0, t1, t2, t3, 2);
+            SKINNY_LANES_ROUND(s1, s2, s3, s0, t2, t3, t0, t1, 3);
+            schedule += 8;
+        }
+        SKINNY_LANES_STORE(S + group, s0);
+        SKINNY_LANES_STORE(S + lanes + group, s1);
+        SKINNY_LANES_STORE(S + lanes * 2 + group, s2);
+        SKINNY_LANES_STORE(S + lanes * 3 + group, s3);
+    }
+}
+
+/**
+ * \brief Decrypts interleaved blocks with SKINNY-128-384.
+ *
+ * \param k Points to the TK2/TK3 part of the key schedule, with the
+ * round constants for the first two rows already applied.
+ * \param S Points to word 0 of lane 0 of the interleaved blocks.
+ * \param T Points to word 0 of lane 0 of the interleaved TK1 values,
+ * which must have been fast-forwarded to the end of the key schedule.
+ * \param lanes Number of lanes, which is also the distance between
+ * consecutive words of the same lane.  Must be a multiple of the width.
+ *
+ * The contents of \a T are destroyed.
+ */
+SKINNY_LANES_TARGET static void SKINNY_LANES_CONCAT
+    (skinny_128_384_decrypt_lanes, SKINNY_LANES_NAME)
+    (const uint32_t *k, uint32_t *S, uint32_t *T, unsigned lanes)
+{
+    SKINNY_LANES_TYPE s0, s1, s2, s3;
+    SKINNY_LANES_TYPE t0, t1, t2, t3;
+    const uint32_t *schedule;
+    unsigned group, round;
+    for (group = 0; group < lanes; group += SKINNY_LANES_WIDTH) {
+        s0 = SKINNY_LANES_LOAD(S + group);
+        s1 = SKINNY_LANES_LOAD(S + lanes + group);
+        s2 = SKINNY_LANES_LOAD(S + lanes * 2 + group);
+        s3 = SKINNY_LANES_LOAD(S + lanes * 3 + group);
+        t0 = SKINNY_LANES_LOAD(T + group);
+        t1 = SKINNY_LANES_LOAD(T + lanes + group);
+        t2 = SKINNY_LANES_LOAD(T + lanes * 2 + group);
+        t3 = SKINNY_LANES_LOAD(T + lanes * 3 + group);
+        schedule = k + SKINNY_128_384_ROUNDS * 2 - 8;
+        for (round = 0; round < SKINNY_128_384_ROUNDS; round += 4) {
+            SKINNY_LANES_INV_ROUND(s0, s1, s2, s3, t2, t3, t0, t1, 3);
+            SKINNY_LANES_INV_ROUND(s1, s2, s3, s0, t0, t1, t2, t3, 2);
+            SKINNY_LANES_INV_ROUND(s2, s3, s0, s1, t2, t3, t0, t1, 1);
+            SKINNY_LANES_INV_ROUND(s3, s0, s1, s2, t0, t1, t2, t3, 0);
+            schedule -= 8;
+        }
+        SKINNY_LANES_STORE(S + group, s0);
+        SKINNY_LANES_STORE(S + lanes + group, s1);
+        SKINNY_LANES_STORE(S + lanes * 2 + group, s2);
+        SKINNY_LANES_STORE(S + lanes * 3 + group, s3);
+    }
+}
+
+#endif /* SKINNY_LANES_NAME */
+
+/* Now undefine everything so that we can include this file again for
+ * another vector type */
+#undef SKINNY_LANES_NAME
+#undef SKINNY_LANES_TARGET
+#undef SKINNY_LANES_TYPE
+#undef SKINNY_LANES_WIDTH
+#undef SKINNY_LANES_LOAD
+#undef SKINNY_LANES_STORE
+#undef SKINNY_LANES_XOR
+#undef SKINNY_LANES_AND
+#undef SKINNY_LANES_OR
+#undef SKINNY_LANES_SHL
+#undef SKINNY_LANES_SHR
+#undef SKINNY_LANES_ROL
+#undef SKINNY_LANES_SET1
+#undef SKINNY_LANES_CONCAT_INNER
+#undef SKINNY_LANES_CONCAT
+#undef SKINNY_LANES_ROUND
+#undef SKINNY_LANES_INV_ROUND
@@ -20,7 +20,28 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+/* The other key schedule variant of SKINNY-128 is built by including this
+ * file from "internal-skinny128-small.c" or "internal-skinny128-full.c"
+ * with SKINNY_128_VARIANT_SUFFIX set.  Rename the entry points so that
+ * they do not clash with the default. */
+#if defined(SKINNY_128_VARIANT_SUFFIX)
+#define SKINNY_128_CONCAT_INNER(name,suffix) name##suffix
+#define SKINNY_128_CONCAT(name,suffix) SKINNY_128_CONCAT_INNER(name,suffix)
+#define SKINNY_128_RENAME(name) \
+    SKINNY_128_CONCAT(name,SKINNY_128_VARIANT_SUFFIX)
+#define skinny_128_384_init SKINNY_128_RENAME(skinny_128_384_init)
+#define skinny_128_384_encrypt SKINNY_128_RENAME(skinny_128_384_encrypt)
+#define skinny_128_384_decrypt SKINNY_128_RENAME(skinny_128_384_decrypt)
+#define skinny_128_384_encrypt_tk2 \
+    SKINNY_128_RENAME(skinny_128_384_encrypt_tk2)
+#define skinny_128_256_init SKINNY_128_RENAME(skinny_128_256_init)
+#define skinny_128_256_encrypt SKINNY_128_RENAME(skinny_128_256_encrypt)
+#define skinny_128_256_decrypt SKINNY_128_RENAME(skinny_128_256_decrypt)
+#define skinny_128_variant_table SKINNY_128_RENAME(skinny_128_variant)
+#endif
+
 #include "internal-skinny128.h"
+#include "internal-cpu.h"
 #include "internal-skinnyutil.h"
 #include "internal-util.h"
 #include <string.h>
@@ -57,38 +78,36 @@ STATIC_INLINE void skinny128_fast_forward_tk(uint32_t *tk)
             ((row3 << 24) & 0xFF000000U);
 }
 
-void skinny_128_384_init
-    (skinny_128_384_key_schedule_t *ks, const unsigned char key[48])
+/**
+ * \brief Expands the TK2 and TK3 parts of a SKINNY-128-384 key schedule.
+ *
+ * \param schedule Points to SKINNY_128_384_ROUNDS * 2 words to receive
+ * the expanded key schedule.
+ * \param tk2 Points to the 16 bytes of TK2.
+ * \param tk3 Points to the 16 bytes of TK3.
+ *
+ * TK1 is not added to the key schedule because we will derive that part
+ * of the schedule during encryption operations.
+ */
+STATIC_INLINE void skinny_128_384_expand_schedule
+    (uint32_t *schedule, const unsigned char *tk2, const unsigned char *tk3)
 {
-#if !SKINNY_128_SMALL_SCHEDULE
     uint32_t TK2[4];
     uint32_t TK3[4];
-    uint32_t *schedule;
     unsigned round;
     uint8_t rc;
-#endif
 
-#if SKINNY_128_SMALL_SCHEDULE
-    /* Copy the input key as-is when using the small key schedule version */
-    memcpy(ks->TK1, key, sizeof(ks->TK1));
-    memcpy(ks->TK2, key + 16, sizeof(ks->TK2));
-    memcpy(ks->TK3, key + 32, sizeof(ks->TK3));
-#else
-    /* Set the initial states of TK1, TK2, and TK3 */
-    memcpy(ks->TK1, key, 16);
-    TK2[0] = le_load_word32(key + 16);
-    TK2[1] = le_load_word32(key + 20);
-    TK2[2] = le_load_word32(key + 24);
-    TK2[3] = le_load_word32(key + 28);
-    TK3[0] = le_load_word32(key + 32);
-    TK3[1] = le_load_word32(key + 36);
-    TK3[2] = le_load_word32(key + 40);
-    TK3[3] = le_load_word32(key + 44);
+    /* Set the initial states of TK2 and TK3 */
+    TK2[0] = le_load_word32(tk2);
+    TK2[1] = le_load_word32(tk2 + 4);
+    TK2[2] = le_load_word32(tk2 + 8);
+    TK2[3] = le_load_word32(tk2 + 12);
+    TK3[0] = le_load_word32(tk3);
+    TK3[1] = le_load_word32(tk3 + 4);
+    TK3[2] = le_load_word32(tk3 + 8);
+    TK3[3] = le_load_word32(tk3 + 12);
 
-    /* Set up the key schedule using TK2 and TK3.  TK1 is not added
-     * to the key schedule because we will derive that part of the
-     * schedule during encryption operations */
-    schedule = ks->k;
+    /* Set up the key schedule using TK2 and TK3 */
     rc = 0;
     for (round = 0; round < SKINNY_128_384_ROUNDS; round += 2, schedule += 4) {
         /* XOR the round constants with the current schedule words.
@@ -123,6 +142,22 @@ void skinny_128_384_init
         skinny128_LFSR3(TK3[0]);
         skinny128_LFSR3(TK3[1]);
     }
+}
+
+void skinny_128_384_init
+    (skinny_128_384_key_schedule_t *ks, const unsigned char key[48])
+{
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_384_INIT);
+
+#if SKINNY_128_SMALL_SCHEDULE
+    /* Copy the input key as-is when using the small key schedule version */
+    memcpy(ks->TK1, key, sizeof(ks->TK1));
+    memcpy(ks->TK2, key + 16, sizeof(ks->TK2));
+    memcpy(ks->TK3, key + 32, sizeof(ks->TK3));
+#else
+    /* Set the initial state of TK1 and expand TK2 and TK3 */
+    memcpy(ks->TK1, key, 16);
+    skinny_128_384_expand_schedule(ks->k, key + 16, key + 32);
 #endif
 }
 
@@ -218,7 +253,8 @@ void skinny_128_384_init
         skinny128_LFSR3(TK3[(1 - half) * 2 + 1]); \
     } while (0)
 
-void skinny_128_384_encrypt
+/* Portable body of SKINNY-128-384 encryption, shared by all variants */
+static LW_CPU_INLINE void skinny_128_384_encrypt_c
     (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input)
 {
@@ -233,6 +269,8 @@ void skinny_128_384_encrypt
 #endif
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_384_ENCRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -278,6 +316,59 @@ void skinny_128_384_encrypt
     le_store_word32(output + 12, s3);
 }
 
+#if defined(LW_CPU_DISPATCH)
+
+/* SKINNY-128-384 variant for CPUs with BMI1 and BMI2 */
+LW_CPU_TARGET("bmi,bmi2") static void skinny_128_384_encrypt_bmi2
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    skinny_128_384_encrypt_c(ks, output, input);
+}
+
+/* SKINNY-128-384 variant for the baseline instruction set */
+static void skinny_128_384_encrypt_default
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    skinny_128_384_encrypt_c(ks, output, input);
+}
+
+/**
+ * \brief Variant of skinny_128_384_encrypt() that is bound for this CPU.
+ */
+static void (*skinny_128_384_encrypt_fn)
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input) = 0;
+
+void skinny_128_384_encrypt
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    void (*fn)(const skinny_128_384_key_schedule_t *ks,
+               unsigned char *output, const unsigned char *input) =
+        LW_CPU_LOAD(skinny_128_384_encrypt_fn);
+    if (!fn) {
+        if (lw_cpu_features() & LW_CPU_BMI2)
+            fn = skinny_128_384_encrypt_bmi2;
+        else
+            fn = skinny_128_384_encrypt_default;
+        LW_CPU_STORE(skinny_128_384_encrypt_fn, fn);
+    }
+    (*fn)(ks, output, input);
+}
+
+#else /* !LW_CPU_DISPATCH */
+
+void skinny_128_384_encrypt
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    skinny_128_384_encrypt_c(ks, output, input);
+}
+
+#endif /* !LW_CPU_DISPATCH */
+
 /**
  * \brief Performs an unrolled inverse round for Skinny-128-384 when
  * only TK1 is computed on the fly.
@@ -380,6 +471,8 @@ void skinny_128_384_decrypt
 #endif
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_384_DECRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -509,6 +602,8 @@ void skinny_128_384_encrypt_tk2
 #endif
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_384_ENCRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -549,6 +644,9 @@ void skinny_128_384_encrypt_tk2
     le_store_word32(output + 12, s3);
 }
 
+/* The tk_full functions do not depend upon the key schedule variant */
+#if !defined(SKINNY_128_VARIANT_SUFFIX)
+
 void skinny_128_384_encrypt_tk_full
     (const unsigned char key[48], unsigned char *output,
      const unsigned char *input)
@@ -560,6 +658,8 @@ void skinny_128_384_encrypt_tk_full
     unsigned round;
     uint8_t rc = 0;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_384_ENCRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -595,6 +695,250 @@ void skinny_128_384_encrypt_tk_full
     le_store_word32(output + 12, s3);
 }
 
+/* Multi-lane kernels, instantiated from internal-skinny128-lanes.h for
+ * each vector type.  The portable version has one lane per "vector" */
+#define SKINNY_LANES_NAME _c
+#define SKINNY_LANES_TARGET
+#define SKINNY_LANES_TYPE uint32_t
+#define SKINNY_LANES_WIDTH 1
+#define SKINNY_LANES_LOAD(ptr) (*(ptr))
+#define SKINNY_LANES_STORE(ptr, x) (*(ptr) = (x))
+#define SKINNY_LANES_XOR(a, b) ((a) ^ (b))
+#define SKINNY_LANES_AND(a, b) ((a) & (b))
+#define SKINNY_LANES_OR(a, b) ((a) | (b))
+#define SKINNY_LANES_SHL(a, bits) ((a) << (bits))
+#define SKINNY_LANES_SHR(a, bits) ((a) >> (bits))
+#define SKINNY_LANES_ROL(a, bits) (leftRotate((a), (bits)))
+#define SKINNY_LANES_SET1(value) ((uint32_t)(value))
+#include "internal-skinny128-lanes.h"
+
+#if defined(LW_CPU_HAVE_SSE2)
+#include <emmintrin.h>
+#define SKINNY_LANES_NAME _sse2
+#define SKINNY_LANES_TARGET LW_CPU_TARGET("sse2")
+#define SKINNY_LANES_TYPE __m128i
+#define SKINNY_LANES_WIDTH 4
+#define SKINNY_LANES_LOAD(ptr) (_mm_loadu_si128((const __m128i *)(ptr)))
+#define SKINNY_LANES_STORE(ptr, x) (_mm_storeu_si128((__m128i *)(ptr), (x)))
+#define SKINNY_LANES_XOR _mm_xor_si128
+#define SKINNY_LANES_AND _mm_and_si128
+#define SKINNY_LANES_OR _mm_or_si128
+#define SKINNY_LANES_SHL _mm_slli_epi32
+#define SKINNY_LANES_SHR _mm_srli_epi32
+#define SKINNY_LANES_ROL(a, bits) \
+    (_mm_or_si128(_mm_slli_epi32((a), (bits)), \
+                  _mm_srli_epi32((a), 32 - (bits))))
+#define SKINNY_LANES_SET1(value) (_mm_set1_epi32((int)(value)))
+#include "internal-skinny128-lanes.h"
+#endif /* LW_CPU_HAVE_SSE2 */
+
+#if defined(LW_CPU_HAVE_AVX2)
+#include <immintrin.h>
+#define SKINNY_LANES_NAME _avx2
+#define SKINNY_LANES_TARGET LW_CPU_TARGET("avx2")
+#define SKINNY_LANES_TYPE __m256i
+#define SKINNY_LANES_WIDTH 8
+#define SKINNY_LANES_LOAD(ptr) (_mm256_loadu_si256((const __m256i *)(ptr)))
+#define SKINNY_LANES_STORE(ptr, x) \
+    (_mm256_storeu_si256((__m256i *)(ptr), (x)))
+#define SKINNY_LANES_XOR _mm256_xor_si256
+#define SKINNY_LANES_AND _mm256_and_si256
+#define SKINNY_LANES_OR _mm256_or_si256
+#define SKINNY_LANES_SHL _mm256_slli_epi32
+#define SKINNY_LANES_SHR _mm256_srli_epi32
+#define SKINNY_LANES_ROL(a, bits) \
+    (_mm256_shuffle_epi8((a), SKINNY_LANES_ROT##bits##_X8))
+#define SKINNY_LANES_SET1(value) (_mm256_set1_epi32((int)(value)))
+#include "internal-skinny128-lanes.h"
+#endif /* LW_CPU_HAVE_AVX2 */
+
+#if defined(LW_CPU_HAVE_AVX512F)
+#define SKINNY_LANES_NAME _avx512
+#define SKINNY_LANES_TARGET LW_CPU_TARGET("avx512f")
+#define SKINNY_LANES_TYPE __m512i
+#define SKINNY_LANES_WIDTH 16
+#define SKINNY_LANES_LOAD(ptr) (_mm512_loadu_si512((ptr)))
+#define SKINNY_LANES_STORE(ptr, x) (_mm512_storeu_si512((ptr), (x)))
+#define SKINNY_LANES_XOR _mm512_xor_si512
+#define SKINNY_LANES_AND _mm512_and_si512
+#define SKINNY_LANES_OR _mm512_or_si512
+#define SKINNY_LANES_SHL _mm512_slli_epi32
+#define SKINNY_LANES_SHR _mm512_srli_epi32
+#define SKINNY_LANES_ROL _mm512_rol_epi32
+#define SKINNY_LANES_SET1(value) (_mm512_set1_epi32((int)(value)))
+#include "internal-skinny128-lanes.h"
+#endif /* LW_CPU_HAVE_AVX512F */
+
+/**
+ * \brief Kernel for encrypting or decrypting interleaved SKINNY-128-384
+ * blocks.
+ */
+typedef void (*skinny_128_384_lanes_kernel_t)
+    (const uint32_t *k, uint32_t *S, uint32_t *T, unsigned lanes);
+
+/**
+ * \brief Multi-lane kernels for a specific vector width.
+ */
+typedef struct
+{
+    unsigned width;                         /**< Number of lanes */
+    skinny_128_384_lanes_kernel_t encrypt;  /**< Encryption kernel */
+    skinny_128_384_lanes_kernel_t decrypt;  /**< Decryption kernel */
+
+} skinny_128_384_lanes_t;
+
+static skinny_128_384_lanes_t const skinny_128_384_lanes_c = {
+    1, skinny_128_384_encrypt_lanes_c, skinny_128_384_decrypt_lanes_c
+};
+#if defined(LW_CPU_HAVE_SSE2)
+static skinny_128_384_lanes_t const skinny_128_384_lanes_sse2 = {
+    4, skinny_128_384_encrypt_lanes_sse2, skinny_128_384_decrypt_lanes_sse2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+static skinny_128_384_lanes_t const skinny_128_384_lanes_avx2 = {
+    8, skinny_128_384_encrypt_lanes_avx2, skinny_128_384_decrypt_lanes_avx2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX512F)
+static skinny_128_384_lanes_t const skinny_128_384_lanes_avx512 = {
+    16, skinny_128_384_encrypt_lanes_avx512,
+    skinny_128_384_decrypt_lanes_avx512
+};
+#endif
+
+/**
+ * \brief Multi-lane kernels that have been bound for this CPU.
+ */
+static const skinny_128_384_lanes_t *skinny_128_384_lanes = 0;
+
+/**
+ * \brief Selects the widest multi-lane kernels for this CPU.
+ *
+ * \return The kernels to use.
+ */
+static const skinny_128_384_lanes_t *skinny_128_384_lanes_select(void)
+{
+    unsigned features = lw_cpu_features();
+#if defined(LW_CPU_HAVE_AVX512F)
+    if (features & LW_CPU_AVX512F)
+        return &skinny_128_384_lanes_avx512;
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+    if (features & LW_CPU_AVX2)
+        return &skinny_128_384_lanes_avx2;
+#endif
+#if defined(LW_CPU_HAVE_SSE2)
+    if (features & LW_CPU_SSE2)
+        return &skinny_128_384_lanes_sse2;
+#endif
+    (void)features;
+    return &skinny_128_384_lanes_c;
+}
+
+/**
+ * \brief Encrypts or decrypts several blocks with SKINNY-128-384, each
+ * with its own TK1 value.
+ *
+ * \param ks Points to the SKINNY-128-384 key schedule.
+ * \param output Output buffer for the blocks.
+ * \param input Input buffer for the blocks.
+ * \param tk1 Points to the TK1 values, one per block.
+ * \param count Number of blocks.
+ * \param decrypt Non-zero to decrypt, zero to encrypt.
+ */
+static void skinny_128_384_crypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count,
+     int decrypt)
+{
+    uint32_t S[4 * SKINNY_128_384_BLOCKS_MAX];
+    uint32_t T[4 * SKINNY_128_384_BLOCKS_MAX];
+    uint32_t TK[4];
+#if SKINNY_128_SMALL_SCHEDULE
+    uint32_t k[SKINNY_128_384_ROUNDS * 2];
+#endif
+    const uint32_t *schedule;
+    const skinny_128_384_lanes_t *impl;
+    skinny_128_384_lanes_kernel_t kernel;
+    unsigned n, lanes, lane, word;
+
+    if (!count)
+        return;
+
+    /* Bind the kernels for this CPU on first use */
+    impl = LW_CPU_LOAD(skinny_128_384_lanes);
+    if (!impl) {
+        impl = skinny_128_384_lanes_select();
+        LW_CPU_STORE(skinny_128_384_lanes, impl);
+    }
+    kernel = decrypt ? impl->decrypt : impl->encrypt;
+
+    /* The kernels need the expanded TK2/TK3 part of the key schedule */
+#if SKINNY_128_SMALL_SCHEDULE
+    skinny_128_384_expand_schedule(k, ks->TK2, ks->TK3);
+    schedule = k;
+#else
+    schedule = ks->k;
+#endif
+
+    /* Process the blocks in groups, padding the last group out to
+     * a whole number of vectors */
+    while (count > 0) {
+        n = count < SKINNY_128_384_BLOCKS_MAX
+                ? (unsigned)count : SKINNY_128_384_BLOCKS_MAX;
+        lanes = (n + impl->width - 1) / impl->width * impl->width;
+        for (lane = 0; lane < n; ++lane) {
+            TK[0] = le_load_word32(tk1 + lane * 16);
+            TK[1] = le_load_word32(tk1 + lane * 16 + 4);
+            TK[2] = le_load_word32(tk1 + lane * 16 + 8);
+            TK[3] = le_load_word32(tk1 + lane * 16 + 12);
+            if (decrypt)
+                skinny128_fast_forward_tk(TK);
+            for (word = 0; word < 4; ++word) {
+                S[word * lanes + lane] =
+                    le_load_word32(input + lane * 16 + word * 4);
+                T[word * lanes + lane] = TK[word];
+            }
+        }
+        for (; lane < lanes; ++lane) {
+            for (word = 0; word < 4; ++word) {
+                S[word * lanes + lane] = 0;
+                T[word * lanes + lane] = 0;
+            }
+        }
+        (*kernel)(schedule, S, T, lanes);
+        for (lane = 0; lane < n; ++lane) {
+            for (word = 0; word < 4; ++word) {
+                le_store_word32
+                    (output + lane * 16 + word * 4, S[word * lanes + lane]);
+            }
+        }
+        input += n * 16;
+        output += n * 16;
+        tk1 += n * 16;
+        count -= n;
+    }
+}
+
+void skinny_128_384_encrypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count)
+{
+    aead_count_calls(AEAD_PRIMITIVE_SKINNY_128_384_ENCRYPT, count);
+    skinny_128_384_crypt_tk1_blocks(ks, output, input, tk1, count, 0);
+}
+
+void skinny_128_384_decrypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count)
+{
+    aead_count_calls(AEAD_PRIMITIVE_SKINNY_128_384_DECRYPT, count);
+    skinny_128_384_crypt_tk1_blocks(ks, output, input, tk1, count, 1);
+}
+
+#endif /* !SKINNY_128_VARIANT_SUFFIX */
+
 void skinny_128_256_init
     (skinny_128_256_key_schedule_t *ks, const unsigned char key[32])
 {
@@ -605,6 +949,8 @@ void skinny_128_256_init
     uint8_t rc;
 #endif
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_256_INIT);
+
 #if SKINNY_128_SMALL_SCHEDULE
     /* Copy the input key as-is when using the small key schedule version */
     memcpy(ks->TK1, key, sizeof(ks->TK1));
@@ -726,6 +1072,8 @@ void skinny_128_256_encrypt
 #endif
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_256_ENCRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -838,6 +1186,8 @@ void skinny_128_256_decrypt
 #endif
     unsigned round;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_256_DECRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -888,6 +1238,8 @@ void skinny_128_256_decrypt
     le_store_word32(output + 12, s3);
 }
 
+#if !defined(SKINNY_128_VARIANT_SUFFIX)
+
 void skinny_128_256_encrypt_tk_full
     (const unsigned char key[32], unsigned char *output,
      const unsigned char *input)
@@ -898,6 +1250,8 @@ void skinny_128_256_encrypt_tk_full
     unsigned round;
     uint8_t rc = 0;
 
+    aead_count_call(AEAD_PRIMITIVE_SKINNY_128_256_ENCRYPT);
+
     /* Unpack the input block into the state array */
     s0 = le_load_word32(input);
     s1 = le_load_word32(input + 4);
@@ -929,6 +1283,8 @@ void skinny_128_256_encrypt_tk_full
     le_store_word32(output + 12, s3);
 }
 
+#endif /* !SKINNY_128_VARIANT_SUFFIX */
+
 #else /* __AVR__ */
 
 void skinny_128_384_encrypt_tk2
@@ -939,4 +1295,220 @@ void skinny_128_384_encrypt_tk2
     skinny_128_384_encrypt(ks, output, input);
 }
 
+/* The multi-block functions are not used by SKINNY-AEAD on AVR because
+ * SKINNY_128_384_BLOCKS_MAX is 1.  They are kept for other callers and
+ * copy the key schedule, which is only TK1, TK2, and TK3 here, once per
+ * call so that the TK1 field can be replaced for each block. */
+
+void skinny_128_384_encrypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count)
+{
+    skinny_128_384_key_schedule_t ks2 = *ks;
+    while (count > 0) {
+        memcpy(ks2.TK1, tk1, 16);
+        skinny_128_384_encrypt(&ks2, output, input);
+        output += 16;
+        input += 16;
+        tk1 += 16;
+        --count;
+    }
+}
+
+void skinny_128_384_decrypt_tk1_blocks
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1, size_t count)
+{
+    skinny_128_384_key_schedule_t ks2 = *ks;
+    while (count > 0) {
+        memcpy(ks2.TK1, tk1, 16);
+        skinny_128_384_decrypt(&ks2, output, input);
+        output += 16;
+        input += 16;
+        tk1 += 16;
+        --count;
+    }
+}
+
 #endif /* __AVR__ */
+
+/* Name of the table of entry points for the default variant */
+#if !defined(SKINNY_128_VARIANT_SUFFIX)
+#if SKINNY_128_SMALL_SCHEDULE
+#define skinny_128_variant_table skinny_128_variant_small
+#else
+#define skinny_128_variant_table skinny_128_variant_full
+#endif
+#endif
+
+/* Wrappers that give the entry points for this variant the generic
+ * signatures from skinny_128_variant_t */
+
+static void skinny_128_variant_init_384
+    (void *ks, const unsigned char key[48])
+{
+    skinny_128_384_init((skinny_128_384_key_schedule_t *)ks, key);
+}
+
+static void skinny_128_variant_encrypt_384
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    skinny_128_384_encrypt
+        ((const skinny_128_384_key_schedule_t *)ks, output, input);
+}
+
+static void skinny_128_variant_decrypt_384
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    skinny_128_384_decrypt
+        ((const skinny_128_384_key_schedule_t *)ks, output, input);
+}
+
+static void skinny_128_variant_encrypt_tk2_384
+    (void *ks, unsigned char *output, const unsigned char *input,
+     const unsigned char *tk2)
+{
+    skinny_128_384_encrypt_tk2
+        ((skinny_128_384_key_schedule_t *)ks, output, input, tk2);
+}
+
+static void skinny_128_variant_init_256
+    (void *ks, const unsigned char key[32])
+{
+    skinny_128_256_init((skinny_128_256_key_schedule_t *)ks, key);
+}
+
+static void skinny_128_variant_encrypt_256
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    skinny_128_256_encrypt
+        ((const skinny_128_256_key_schedule_t *)ks, output, input);
+}
+
+static void skinny_128_variant_decrypt_256
+    (const void *ks, unsigned char *output, const unsigned char *input)
+{
+    skinny_128_256_decrypt
+        ((const skinny_128_256_key_schedule_t *)ks, output, input);
+}
+
+const skinny_128_variant_t skinny_128_variant_table = {
+    SKINNY_128_SMALL_SCHEDULE ? SKINNY_128_SCHEDULE_SMALL
+                              : SKINNY_128_SCHEDULE_FULL,
+    sizeof(skinny_128_384_key_schedule_t),
+    sizeof(skinny_128_256_key_schedule_t),
+    skinny_128_variant_init_384,
+    skinny_128_variant_encrypt_384,
+    skinny_128_variant_decrypt_384,
+    skinny_128_variant_encrypt_tk2_384,
+    skinny_128_variant_init_256,
+    skinny_128_variant_encrypt_256,
+    skinny_128_variant_decrypt_256
+};
+
+#if !defined(SKINNY_128_VARIANT_SUFFIX)
+
+/* Table for the variant that is built by the other source file.
+ * Only the default variant is available with the assembly code version. */
+#if !defined(__AVR__)
+#if SKINNY_128_SMALL_SCHEDULE
+extern const skinny_128_variant_t skinny_128_variant_full;
+#else
+extern const skinny_128_variant_t skinny_128_variant_small;
+#endif
+#endif
+
+int skinny_128_variant_for_schedule(unsigned schedule)
+{
+    switch (schedule) {
+    case AEAD_SCHEDULE_FULL:
+        return SKINNY_128_SCHEDULE_FULL;
+    case AEAD_SCHEDULE_SMALL:
+        return SKINNY_128_SCHEDULE_SMALL;
+    case AEAD_SCHEDULE_TINY:
+        return SKINNY_128_SCHEDULE_SMALL;
+    default:
+        return SKINNY_128_SMALL_SCHEDULE ? SKINNY_128_SCHEDULE_SMALL
+                                         : SKINNY_128_SCHEDULE_FULL;
+    }
+}
+
+const skinny_128_variant_t *skinny_128_get_variant(int schedule)
+{
+#if !defined(__AVR__)
+    if (schedule == SKINNY_128_SCHEDULE_FULL)
+        return &skinny_128_variant_full;
+    else if (schedule == SKINNY_128_SCHEDULE_SMALL)
+        return &skinny_128_variant_small;
+#else
+    (void)schedule;
+#endif
+    return &skinny_128_variant_table;
+}
+
+size_t skinny_128_384_variant_schedule_size(int schedule)
+{
+    const skinny_128_variant_t *v = skinny_128_get_variant(schedule);
+    return offsetof(skinny_128_384_variant_key_schedule_t, s) +
+           v->schedule_size_384;
+}
+
+void skinny_128_384_variant_init
+    (skinny_128_384_variant_key_schedule_t *ks, const unsigned char key[48],
+     int schedule)
+{
+    ks->variant = skinny_128_get_variant(schedule);
+    ks->variant->init_384(&(ks->s), key);
+}
+
+void skinny_128_384_variant_encrypt
+    (const skinny_128_384_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->encrypt_384(&(ks->s), output, input);
+}
+
+void skinny_128_384_variant_decrypt
+    (const skinny_128_384_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->decrypt_384(&(ks->s), output, input);
+}
+
+void skinny_128_384_variant_encrypt_tk2
+    (skinny_128_384_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk2)
+{
+    ks->variant->encrypt_tk2_384(&(ks->s), output, input, tk2);
+}
+
+size_t skinny_128_256_variant_schedule_size(int schedule)
+{
+    const skinny_128_variant_t *v = skinny_128_get_variant(schedule);
+    return offsetof(skinny_128_256_variant_key_schedule_t, s) +
+           v->schedule_size_256;
+}
+
+void skinny_128_256_variant_init
+    (skinny_128_256_variant_key_schedule_t *ks, const unsigned char key[32],
+     int schedule)
+{
+    ks->variant = skinny_128_get_variant(schedule);
+    ks->variant->init_256(&(ks->s), key);
+}
+
+void skinny_128_256_variant_encrypt
+    (const skinny_128_256_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->encrypt_256(&(ks->s), output, input);
+}
+
+void skinny_128_256_variant_decrypt
+    (const skinny_128_256_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input)
+{
+    ks->variant->decrypt_256(&(ks->s), output, input);
+}
+
+#endif /* !SKINNY_128_VARIANT_SUFFIX */
@@ -0,0 +1,209 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef LW_INTERNAL_SKINNYUTIL_LANES_H
+#define LW_INTERNAL_SKINNYUTIL_LANES_H
+
+/**
+ * \file internal-skinnyutil-lanes.h
+ * \brief Vector utilities for the multi-lane SKINNY-128 kernels.
+ *
+ * Each lane of a vector holds the same 32-bit word of a different block.
+ * The macros in this file are the lane-wise equivalents of the macros in
+ * internal-skinnyutil.h and are written in terms of the SKINNY_LANES_XOR,
+ * SKINNY_LANES_AND, SKINNY_LANES_OR, SKINNY_LANES_SHL, SKINNY_LANES_SHR,
+ * SKINNY_LANES_ROL, SKINNY_LANES_SET1, and SKINNY_LANES_TYPE macros that
+ * each kernel template is configured with.  The names are not expanded
+ * until the macros are used, so one set of definitions serves every
+ * vector type.
+ */
+
+/** @cond skinnyutil */
+
+#define SKINNY_LANES_XOR3(a, b, c) \
+    (SKINNY_LANES_XOR(SKINNY_LANES_XOR((a), (b)), (c)))
+#define SKINNY_LANES_NOT(a) \
+    (SKINNY_LANES_XOR((a), SKINNY_LANES_SET1(0xFFFFFFFFU)))
+#define SKINNY_LANES_MASK(a, mask) \
+    (SKINNY_LANES_AND((a), SKINNY_LANES_SET1(mask)))
+
+/* Vector version of skinny128_sbox() */
+#define SKINNY_LANES_SBOX(x) \
+    do { \
+        SKINNY_LANES_TYPE y; \
+        x = SKINNY_LANES_NOT(x); \
+        x = SKINNY_LANES_XOR(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 2), SKINNY_LANES_SHR(x, 3)), 0x11111111U)); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHL(x, 5), SKINNY_LANES_SHL(x, 1)), 0x20202020U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHL(x, 5), SKINNY_LANES_SHL(x, 4)), 0x40404040U), \
+            y); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHL(x, 2), SKINNY_LANES_SHL(x, 1)), 0x80808080U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 2), SKINNY_LANES_SHL(x, 1)), 0x02020202U), \
+            y); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 5), SKINNY_LANES_SHL(x, 1)), 0x04040404U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 1), SKINNY_LANES_SHR(x, 2)), 0x08080808U), \
+            y); \
+        x = SKINNY_LANES_NOT(x); \
+        x = SKINNY_LANES_OR(SKINNY_LANES_OR(SKINNY_LANES_OR \
+                (SKINNY_LANES_SHL(SKINNY_LANES_MASK(x, 0x08080808U), 1), \
+                 SKINNY_LANES_SHL(SKINNY_LANES_MASK(x, 0x32323232U), 2)), \
+             SKINNY_LANES_OR \
+                (SKINNY_LANES_SHL(SKINNY_LANES_MASK(x, 0x01010101U), 5), \
+                 SKINNY_LANES_SHR(SKINNY_LANES_MASK(x, 0x80808080U), 6))), \
+             SKINNY_LANES_OR \
+                (SKINNY_LANES_SHR(SKINNY_LANES_MASK(x, 0x40404040U), 4), \
+                 SKINNY_LANES_SHR(SKINNY_LANES_MASK(x, 0x04040404U), 2))); \
+    } while (0)
+
+/* Vector version of skinny128_inv_sbox() */
+#define SKINNY_LANES_INV_SBOX(x) \
+    do { \
+        SKINNY_LANES_TYPE y; \
+        x = SKINNY_LANES_NOT(x); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 1), SKINNY_LANES_SHR(x, 3)), 0x01010101U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 2), SKINNY_LANES_SHR(x, 3)), 0x10101010U), \
+            y); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 6), SKINNY_LANES_SHR(x, 1)), 0x02020202U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 1), SKINNY_LANES_SHR(x, 2)), 0x08080808U), \
+            y); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHL(x, 2), SKINNY_LANES_SHL(x, 1)), 0x80808080U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHR(x, 1), SKINNY_LANES_SHL(x, 2)), 0x04040404U), \
+            y); \
+        y = SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHL(x, 5), SKINNY_LANES_SHL(x, 1)), 0x20202020U); \
+        x = SKINNY_LANES_XOR3(x, SKINNY_LANES_MASK(SKINNY_LANES_AND \
+            (SKINNY_LANES_SHL(x, 4), SKINNY_LANES_SHL(x, 5)), 0x40404040U), \
+            y); \
+        x = SKINNY_LANES_NOT(x); \
+        x = SKINNY_LANES_OR(SKINNY_LANES_OR(SKINNY_LANES_OR \
+                (SKINNY_LANES_SHL(SKINNY_LANES_MASK(x, 0x01010101U), 2), \
+                 SKINNY_LANES_SHL(SKINNY_LANES_MASK(x, 0x04040404U), 4)), \
+             SKINNY_LANES_OR \
+                (SKINNY_LANES_SHL(SKINNY_LANES_MASK(x, 0x02020202U), 6), \
+                 SKINNY_LANES_SHR(SKINNY_LANES_MASK(x, 0x20202020U), 5))), \
+             SKINNY_LANES_OR \
+                (SKINNY_LANES_SHR(SKINNY_LANES_MASK(x, 0xC8C8C8C8U), 2), \
+                 SKINNY_LANES_SHR(SKINNY_LANES_MASK(x, 0x10101010U), 1))); \
+    } while (0)
+
+/* Vector version of skinny128_permute_tk_half() */
+#define SKINNY_LANES_PERMUTE_TK_HALF(tk2, tk3) \
+    do { \
+        SKINNY_LANES_TYPE row2 = tk2; \
+        SKINNY_LANES_TYPE row3 = SKINNY_LANES_ROL(tk3, 16); \
+        tk2 = SKINNY_LANES_OR(SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHR(row2, 8), 0x000000FFU), \
+             SKINNY_LANES_MASK(SKINNY_LANES_SHL(row2, 16), 0x00FF0000U)), \
+             SKINNY_LANES_MASK(row3, 0xFF00FF00U)); \
+        tk3 = SKINNY_LANES_OR(SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHR(row2, 16), 0x000000FFU), \
+             SKINNY_LANES_MASK(row2, 0xFF000000U)), SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHL(row3, 8), 0x0000FF00U), \
+             SKINNY_LANES_MASK(row3, 0x00FF0000U))); \
+    } while (0)
+
+/* Vector version of skinny128_inv_permute_tk_half() */
+#define SKINNY_LANES_INV_PERMUTE_TK_HALF(tk0, tk1) \
+    do { \
+        SKINNY_LANES_TYPE row0 = tk0; \
+        SKINNY_LANES_TYPE row1 = tk1; \
+        tk0 = SKINNY_LANES_OR(SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHR(row0, 16), 0x000000FFU), \
+             SKINNY_LANES_MASK(SKINNY_LANES_SHL(row0, 8), 0x0000FF00U)), \
+             SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHL(row1, 16), 0x00FF0000U), \
+             SKINNY_LANES_MASK(row1, 0xFF000000U))); \
+        tk1 = SKINNY_LANES_OR(SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHR(row0, 16), 0x0000FF00U), \
+             SKINNY_LANES_MASK(SKINNY_LANES_SHL(row0, 16), 0xFF000000U)), \
+             SKINNY_LANES_OR \
+            (SKINNY_LANES_MASK(SKINNY_LANES_SHR(row1, 16), 0x000000FFU), \
+             SKINNY_LANES_MASK(SKINNY_LANES_SHL(row1, 8), 0x00FF0000U))); \
+    } while (0)
+
+/* Vector version of skinny128_permute_tk() on the rows of a tweakey */
+#define SKINNY_LANES_PERMUTE_TK(tk0, tk1, tk2, tk3) \
+    do { \
+        SKINNY_LANES_TYPE row0 = tk0; \
+        SKINNY_LANES_TYPE row1 = tk1; \
+        SKINNY_LANES_PERMUTE_TK_HALF(tk2, tk3); \
+        tk0 = tk2; \
+        tk1 = tk3; \
+        tk2 = row0; \
+        tk3 = row1; \
+    } while (0)
+
+/* Vector version of skinny128_inv_permute_tk() on the rows of a tweakey */
+#define SKINNY_LANES_INV_PERMUTE_TK(tk0, tk1, tk2, tk3) \
+    do { \
+        SKINNY_LANES_TYPE row2 = tk2; \
+        SKINNY_LANES_TYPE row3 = tk3; \
+        SKINNY_LANES_INV_PERMUTE_TK_HALF(tk0, tk1); \
+        tk2 = tk0; \
+        tk3 = tk1; \
+        tk0 = row2; \
+        tk1 = row3; \
+    } while (0)
+
+/* Vector version of skinny128_LFSR2() */
+#define SKINNY_LANES_LFSR2(x) \
+    (SKINNY_LANES_XOR(SKINNY_LANES_MASK(SKINNY_LANES_SHL((x), 1), \
+                                        0xFEFEFEFEU), \
+     SKINNY_LANES_MASK(SKINNY_LANES_XOR(SKINNY_LANES_SHR((x), 7), \
+                                        SKINNY_LANES_SHR((x), 5)), \
+                       0x01010101U)))
+
+/* Vector version of skinny128_LFSR3() */
+#define SKINNY_LANES_LFSR3(x) \
+    (SKINNY_LANES_XOR(SKINNY_LANES_MASK(SKINNY_LANES_SHR((x), 1), \
+                                        0x7F7F7F7FU), \
+     SKINNY_LANES_MASK(SKINNY_LANES_XOR(SKINNY_LANES_SHL((x), 7), \
+                                        SKINNY_LANES_SHL((x), 1)), \
+                       0x80808080U)))
+
+/* Byte shuffles for AVX2 that rotate each 32-bit word left by 8, 16,
+ * or 24 bits */
+#define SKINNY_LANES_ROT8_X8 \
+    _mm256_setr_epi32(0x02010003, 0x06050407, 0x0A09080B, 0x0E0D0C0F, \
+                      0x02010003, 0x06050407, 0x0A09080B, 0x0E0D0C0F)
+#define SKINNY_LANES_ROT16_X8 \
+    _mm256_setr_epi32(0x01000302, 0x05040706, 0x09080B0A, 0x0D0C0F0E, \
+                      0x01000302, 0x05040706, 0x09080B0A, 0x0D0C0F0E)
+#define SKINNY_LANES_ROT24_X8 \
+    _mm256_setr_epi32(0x00030201, 0x04070605, 0x080B0A09, 0x0C0F0E0D, \
+                      0x00030201, 0x04070605, 0x080B0A09, 0x0C0F0E0D)
+
+/** @endcond */
+
+#endif
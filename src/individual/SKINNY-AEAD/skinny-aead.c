@@ -22,69 +22,9 @@
 
 #include "skinny-aead.h"
 #include "internal-skinny128.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
-aead_cipher_t const skinny_aead_m1_cipher = {
-    "SKINNY-AEAD-M1",
-    SKINNY_AEAD_KEY_SIZE,
-    SKINNY_AEAD_M1_NONCE_SIZE,
-    SKINNY_AEAD_M1_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    skinny_aead_m1_encrypt,
-    skinny_aead_m1_decrypt
-};
-
-aead_cipher_t const skinny_aead_m2_cipher = {
-    "SKINNY-AEAD-M2",
-    SKINNY_AEAD_KEY_SIZE,
-    SKINNY_AEAD_M2_NONCE_SIZE,
-    SKINNY_AEAD_M2_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    skinny_aead_m2_encrypt,
-    skinny_aead_m2_decrypt
-};
-
-aead_cipher_t const skinny_aead_m3_cipher = {
-    "SKINNY-AEAD-M3",
-    SKINNY_AEAD_KEY_SIZE,
-    SKINNY_AEAD_M3_NONCE_SIZE,
-    SKINNY_AEAD_M3_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    skinny_aead_m3_encrypt,
-    skinny_aead_m3_decrypt
-};
-
-aead_cipher_t const skinny_aead_m4_cipher = {
-    "SKINNY-AEAD-M4",
-    SKINNY_AEAD_KEY_SIZE,
-    SKINNY_AEAD_M4_NONCE_SIZE,
-    SKINNY_AEAD_M4_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    skinny_aead_m4_encrypt,
-    skinny_aead_m4_decrypt
-};
-
-aead_cipher_t const skinny_aead_m5_cipher = {
-    "SKINNY-AEAD-M5",
-    SKINNY_AEAD_KEY_SIZE,
-    SKINNY_AEAD_M5_NONCE_SIZE,
-    SKINNY_AEAD_M5_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    skinny_aead_m5_encrypt,
-    skinny_aead_m5_decrypt
-};
-
-aead_cipher_t const skinny_aead_m6_cipher = {
-    "SKINNY-AEAD-M6",
-    SKINNY_AEAD_KEY_SIZE,
-    SKINNY_AEAD_M6_NONCE_SIZE,
-    SKINNY_AEAD_M6_TAG_SIZE,
-    AEAD_FLAG_LITTLE_ENDIAN,
-    skinny_aead_m6_encrypt,
-    skinny_aead_m6_decrypt
-};
-
 /* Domain separator prefixes for all of the SKINNY-AEAD family members */
 #define DOMAIN_SEP_M1 0x00
 #define DOMAIN_SEP_M2 0x10
@@ -140,36 +80,131 @@ static void skinny_aead_128_384_init
         (lfsr) = ((lfsr) << 1) ^ feedback; \
     } while (0)
 
+/**
+ * \brief Number of blocks that the SKINNY-128-384 based AEAD schemes
+ * encrypt in parallel.
+ */
+#define SKINNY_AEAD_BLOCKS SKINNY_128_384_BLOCKS_MAX
+
+#if SKINNY_AEAD_BLOCKS > 1
+
+/**
+ * \brief Fills in the TK1 values for a run of blocks with consecutive
+ * LFSR values for SKINNY-128-384.
+ *
+ * \param tk1 Points to the buffer to fill with 16 * count bytes.
+ * \param lfsr Points to the LFSR value for the first block, which is
+ * updated to the value for the block after the run on exit.
+ * \param domain Domain separation value for the blocks.
+ * \param count Number of blocks in the run.
+ */
+static void skinny_aead_128_384_fill_tk1
+    (unsigned char *tk1, uint64_t *lfsr, unsigned char domain,
+     unsigned count)
+{
+    uint64_t value = *lfsr;
+    memset(tk1, 0, count * SKINNY_128_BLOCK_SIZE);
+    while (count > 0) {
+        le_store_word64(tk1, value);
+        tk1[15] = domain;
+        skinny_aead_128_384_update_lfsr(value);
+        tk1 += SKINNY_128_BLOCK_SIZE;
+        --count;
+    }
+    *lfsr = value;
+}
+
+#endif
+
+/**
+ * \brief Encrypts or decrypts a run of full blocks for SKINNY-128-384
+ * with consecutive LFSR values in the tweak.
+ *
+ * \param ks The key schedule to use.
+ * \param output Output buffer for 16 * count bytes.
+ * \param input Input buffer of 16 * count bytes.
+ * \param lfsr Points to the LFSR value for the first block, which is
+ * updated to the value for the block after the run on exit.
+ * \param domain Domain separation value for the blocks.
+ * \param count Number of blocks in the run.
+ * \param decrypt Non-zero to decrypt, zero to encrypt.
+ *
+ * When only one block is processed at a time, the tweak is written
+ * straight into the key schedule rather than into a separate TK1 buffer.
+ */
+static void skinny_aead_128_384_crypt_blocks
+    (skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, uint64_t *lfsr, unsigned char domain,
+     unsigned count, int decrypt)
+{
+#if SKINNY_AEAD_BLOCKS > 1
+    unsigned char tk1[SKINNY_128_BLOCK_SIZE * SKINNY_AEAD_BLOCKS];
+    skinny_aead_128_384_fill_tk1(tk1, lfsr, domain, count);
+    if (decrypt)
+        skinny_128_384_decrypt_tk1_blocks(ks, output, input, tk1, count);
+    else
+        skinny_128_384_encrypt_tk1_blocks(ks, output, input, tk1, count);
+#else
+    while (count > 0) {
+        skinny_aead_128_384_set_lfsr(ks, *lfsr);
+        skinny_aead_128_384_set_domain(ks, domain);
+        if (decrypt)
+            skinny_128_384_decrypt(ks, output, input);
+        else
+            skinny_128_384_encrypt(ks, output, input);
+        skinny_aead_128_384_update_lfsr(*lfsr);
+        output += SKINNY_128_BLOCK_SIZE;
+        input += SKINNY_128_BLOCK_SIZE;
+        --count;
+    }
+#endif
+}
+
 /**
  * \brief Authenticates the associated data for a SKINNY-128-384 based AEAD.
  *
  * \param ks The key schedule to use.
  * \param prefix Domain separation prefix for the family member.
  * \param tag Final tag to XOR the authentication checksum into.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void skinny_aead_128_384_authenticate
     (skinny_128_384_key_schedule_t *ks, unsigned char prefix,
      unsigned char tag[SKINNY_128_BLOCK_SIZE],
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
-    unsigned char block[SKINNY_128_BLOCK_SIZE];
+    unsigned char block[SKINNY_128_BLOCK_SIZE * SKINNY_AEAD_BLOCKS];
+    unsigned char inbuf[SKINNY_128_BLOCK_SIZE];
+    const unsigned char *in;
     uint64_t lfsr = 1;
+    unsigned count, index;
     skinny_aead_128_384_set_domain(ks, prefix | 2);
     while (adlen >= SKINNY_128_BLOCK_SIZE) {
-        skinny_aead_128_384_set_lfsr(ks, lfsr);
-        skinny_128_384_encrypt(ks, block, ad);
-        lw_xor_block(tag, block, SKINNY_128_BLOCK_SIZE);
-        ad += SKINNY_128_BLOCK_SIZE;
-        adlen -= SKINNY_128_BLOCK_SIZE;
-        skinny_aead_128_384_update_lfsr(lfsr);
+        /* The full blocks are independent, so encrypt them in parallel
+         * if they are contiguous in the associated data segments */
+        count = (unsigned)aead_iovec_blocks
+            (ad, 0, adlen, SKINNY_128_BLOCK_SIZE, SKINNY_AEAD_BLOCKS);
+        if (count > 0) {
+            in = aead_iovec_ptr(ad);
+            aead_iovec_advance(ad, count * SKINNY_128_BLOCK_SIZE);
+        } else {
+            count = 1;
+            in = aead_iovec_load_block(ad, inbuf, SKINNY_128_BLOCK_SIZE);
+        }
+        skinny_aead_128_384_crypt_blocks
+            (ks, block, in, &lfsr, prefix | 2, count, 0);
+        for (index = 0; index < count; ++index) {
+            lw_xor_block(tag, block + index * SKINNY_128_BLOCK_SIZE,
+                         SKINNY_128_BLOCK_SIZE);
+        }
+        adlen -= count * SKINNY_128_BLOCK_SIZE;
     }
     if (adlen > 0) {
         unsigned temp = (unsigned)adlen;
         skinny_aead_128_384_set_lfsr(ks, lfsr);
         skinny_aead_128_384_set_domain(ks, prefix | 3);
-        memcpy(block, ad, temp);
+        aead_iovec_read(ad, block, temp);
         block[temp] = 0x80;
         memset(block + temp + 1, 0, SKINNY_128_BLOCK_SIZE - temp - 1);
         skinny_128_384_encrypt(ks, block, block);
@@ -183,37 +218,60 @@ static void skinny_aead_128_384_authenticate
  * \param ks The key schedule to use.
  * \param prefix Domain separation prefix for the family member.
  * \param sum Authenticated checksum over the plaintext.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the plaintext buffer.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Number of bytes of plaintext to be encrypted.
  */
 static void skinny_aead_128_384_encrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char prefix,
-     unsigned char sum[SKINNY_128_BLOCK_SIZE], unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+     unsigned char sum[SKINNY_128_BLOCK_SIZE], aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
     unsigned char block[SKINNY_128_BLOCK_SIZE];
+    unsigned char inbuf[SKINNY_128_BLOCK_SIZE];
+    unsigned char outbuf[SKINNY_128_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     uint64_t lfsr = 1;
+    unsigned count, index;
     memset(sum, 0, SKINNY_128_BLOCK_SIZE);
     skinny_aead_128_384_set_domain(ks, prefix | 0);
     while (mlen >= SKINNY_128_BLOCK_SIZE) {
-        skinny_aead_128_384_set_lfsr(ks, lfsr);
-        lw_xor_block(sum, m, SKINNY_128_BLOCK_SIZE);
-        skinny_128_384_encrypt(ks, c, m);
-        c += SKINNY_128_BLOCK_SIZE;
-        m += SKINNY_128_BLOCK_SIZE;
-        mlen -= SKINNY_128_BLOCK_SIZE;
-        skinny_aead_128_384_update_lfsr(lfsr);
+        /* The full blocks are independent, so encrypt them in parallel
+         * if they are contiguous on both sides.  Update the checksum
+         * first in case the input and output are the same */
+        count = (unsigned)aead_iovec_blocks
+            (m, c, mlen, SKINNY_128_BLOCK_SIZE, SKINNY_AEAD_BLOCKS);
+        if (count > 0) {
+            in = aead_iovec_ptr(m);
+            out = aead_iovec_ptr(c);
+            aead_iovec_advance(m, count * SKINNY_128_BLOCK_SIZE);
+        } else {
+            count = 1;
+            in = aead_iovec_load_block(m, inbuf, SKINNY_128_BLOCK_SIZE);
+            out = aead_iovec_store_begin(c, outbuf, SKINNY_128_BLOCK_SIZE);
+        }
+        for (index = 0; index < count; ++index) {
+            lw_xor_block(sum, in + index * SKINNY_128_BLOCK_SIZE,
+                         SKINNY_128_BLOCK_SIZE);
+        }
+        skinny_aead_128_384_crypt_blocks
+            (ks, out, in, &lfsr, prefix | 0, count, 0);
+        aead_iovec_store_end(c, outbuf, out, count * SKINNY_128_BLOCK_SIZE);
+        mlen -= count * SKINNY_128_BLOCK_SIZE;
     }
     skinny_aead_128_384_set_lfsr(ks, lfsr);
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
         skinny_aead_128_384_set_domain(ks, prefix | 1);
-        lw_xor_block(sum, m, temp);
+        lw_xor_block(sum, in, temp);
         sum[temp] ^= 0x80;
         memset(block, 0, SKINNY_128_BLOCK_SIZE);
         skinny_128_384_encrypt(ks, block, block);
-        lw_xor_block_2_src(c, block, m, temp);
+        lw_xor_block_2_src(out, block, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
         skinny_aead_128_384_update_lfsr(lfsr);
         skinny_aead_128_384_set_lfsr(ks, lfsr);
         skinny_aead_128_384_set_domain(ks, prefix | 5);
@@ -229,37 +287,59 @@ static void skinny_aead_128_384_encrypt
  * \param ks The key schedule to use.
  * \param prefix Domain separation prefix for the family member.
  * \param sum Authenticated checksum over the plaintext.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the ciphertext buffer.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Number of bytes of ciphertext to be decrypted.
  */
 static void skinny_aead_128_384_decrypt
     (skinny_128_384_key_schedule_t *ks, unsigned char prefix,
-     unsigned char sum[SKINNY_128_BLOCK_SIZE], unsigned char *m,
-     const unsigned char *c, unsigned long long mlen)
+     unsigned char sum[SKINNY_128_BLOCK_SIZE], aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long mlen)
 {
     unsigned char block[SKINNY_128_BLOCK_SIZE];
+    unsigned char inbuf[SKINNY_128_BLOCK_SIZE];
+    unsigned char outbuf[SKINNY_128_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     uint64_t lfsr = 1;
+    unsigned count, index;
     memset(sum, 0, SKINNY_128_BLOCK_SIZE);
     skinny_aead_128_384_set_domain(ks, prefix | 0);
     while (mlen >= SKINNY_128_BLOCK_SIZE) {
-        skinny_aead_128_384_set_lfsr(ks, lfsr);
-        skinny_128_384_decrypt(ks, m, c);
-        lw_xor_block(sum, m, SKINNY_128_BLOCK_SIZE);
-        c += SKINNY_128_BLOCK_SIZE;
-        m += SKINNY_128_BLOCK_SIZE;
-        mlen -= SKINNY_128_BLOCK_SIZE;
-        skinny_aead_128_384_update_lfsr(lfsr);
+        /* The full blocks are independent, so decrypt them in parallel
+         * if they are contiguous on both sides */
+        count = (unsigned)aead_iovec_blocks
+            (c, m, mlen, SKINNY_128_BLOCK_SIZE, SKINNY_AEAD_BLOCKS);
+        if (count > 0) {
+            in = aead_iovec_ptr(c);
+            out = aead_iovec_ptr(m);
+            aead_iovec_advance(c, count * SKINNY_128_BLOCK_SIZE);
+        } else {
+            count = 1;
+            in = aead_iovec_load_block(c, inbuf, SKINNY_128_BLOCK_SIZE);
+            out = aead_iovec_store_begin(m, outbuf, SKINNY_128_BLOCK_SIZE);
+        }
+        skinny_aead_128_384_crypt_blocks
+            (ks, out, in, &lfsr, prefix | 0, count, 1);
+        for (index = 0; index < count; ++index) {
+            lw_xor_block(sum, out + index * SKINNY_128_BLOCK_SIZE,
+                         SKINNY_128_BLOCK_SIZE);
+        }
+        aead_iovec_store_end(m, outbuf, out, count * SKINNY_128_BLOCK_SIZE);
+        mlen -= count * SKINNY_128_BLOCK_SIZE;
     }
     skinny_aead_128_384_set_lfsr(ks, lfsr);
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
         skinny_aead_128_384_set_domain(ks, prefix | 1);
         memset(block, 0, SKINNY_128_BLOCK_SIZE);
         skinny_128_384_encrypt(ks, block, block);
-        lw_xor_block_2_src(m, block, c, temp);
-        lw_xor_block(sum, m, temp);
+        lw_xor_block_2_src(out, block, in, temp);
+        lw_xor_block(sum, out, temp);
         sum[temp] ^= 0x80;
+        aead_iovec_store_end(m, outbuf, out, temp);
         skinny_aead_128_384_update_lfsr(lfsr);
         skinny_aead_128_384_set_lfsr(ks, lfsr);
         skinny_aead_128_384_set_domain(ks, prefix | 5);
@@ -269,66 +349,121 @@ static void skinny_aead_128_384_decrypt
     skinny_128_384_encrypt(ks, sum, sum);
 }
 
-int skinny_aead_m1_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *nsec,
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with a
+ * SKINNY-128-384 based AEAD.
+ *
+ * \param prefix Domain separation prefix for the family member.
+ * \param nonce_len Length of the nonce for the family member.
+ * \param tag_len Length of the tag for the family member.
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the ciphertext and tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \return 0 on success, or -2 if \a c is too small.
+ */
+static int skinny_aead_128_384_encrypt_vec
+    (unsigned char prefix, unsigned nonce_len, unsigned tag_len,
+     const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
     unsigned char sum[SKINNY_128_BLOCK_SIZE];
-    (void)nsec;
 
     /* Set the length of the returned ciphertext */
-    *clen = mlen + SKINNY_AEAD_M1_TAG_SIZE;
+    if (aead_iovec_length(c, c_count) < (mlen + tag_len))
+        return -2;
+    *clen = mlen + tag_len;
 
     /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M1_NONCE_SIZE);
+    skinny_aead_128_384_init(&ks, k, npub, nonce_len);
 
     /* Encrypt to plaintext to produce the ciphertext */
-    skinny_aead_128_384_encrypt(&ks, DOMAIN_SEP_M1, sum, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    skinny_aead_128_384_encrypt(&ks, prefix, sum, &ccur, &mcur, mlen);
 
     /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M1, sum, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    skinny_aead_128_384_authenticate
+        (&ks, prefix, sum, &adcur, aead_iovec_length(ad, ad_count));
 
     /* Generate the authentication tag */
-    memcpy(c + mlen, sum, SKINNY_AEAD_M1_TAG_SIZE);
+    aead_iovec_write(&ccur, sum, tag_len);
     return 0;
 }
 
-int skinny_aead_m1_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with a
+ * SKINNY-128-384 based AEAD.
+ *
+ * \param prefix Domain separation prefix for the family member.
+ * \param nonce_len Length of the nonce for the family member.
+ * \param tag_len Length of the tag for the family member.
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param k Points to the 16 bytes of the key.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if \a m is too small.
+ */
+static int skinny_aead_128_384_decrypt_vec
+    (unsigned char prefix, unsigned nonce_len, unsigned tag_len,
+     const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     skinny_128_384_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
     unsigned char sum[SKINNY_128_BLOCK_SIZE];
-    (void)nsec;
+    unsigned char tag[SKINNY_128_BLOCK_SIZE];
 
     /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < SKINNY_AEAD_M1_TAG_SIZE)
+    if (clen < tag_len)
         return -1;
-    *mlen = clen - SKINNY_AEAD_M1_TAG_SIZE;
+    *mlen = clen - tag_len;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
     /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M1_NONCE_SIZE);
+    skinny_aead_128_384_init(&ks, k, npub, nonce_len);
 
     /* Decrypt to ciphertext to produce the plaintext */
-    skinny_aead_128_384_decrypt(&ks, DOMAIN_SEP_M1, sum, m, c, *mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    skinny_aead_128_384_decrypt(&ks, prefix, sum, &mcur, &ccur, *mlen);
 
     /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M1, sum, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    skinny_aead_128_384_authenticate
+        (&ks, prefix, sum, &adcur, aead_iovec_length(ad, ad_count));
 
     /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, sum, c + *mlen, SKINNY_AEAD_M1_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, tag_len);
+    return aead_check_tag_vec(m, m_count, *mlen, sum, tag, tag_len);
 }
 
-int skinny_aead_m2_encrypt
+int skinny_aead_m1_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
@@ -336,25 +471,79 @@ int skinny_aead_m2_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_384_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + SKINNY_AEAD_M1_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M1, SKINNY_AEAD_M1_NONCE_SIZE, SKINNY_AEAD_M1_TAG_SIZE,
+         &cvec, 1, clen, &mvec, 1, &advec, 1, npub, k);
+}
 
-    /* Set the length of the returned ciphertext */
-    *clen = mlen + SKINNY_AEAD_M2_TAG_SIZE;
-
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M2_NONCE_SIZE);
+int skinny_aead_m1_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SKINNY_AEAD_M1_TAG_SIZE ?
+                   clen - SKINNY_AEAD_M1_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M1, SKINNY_AEAD_M1_NONCE_SIZE, SKINNY_AEAD_M1_TAG_SIZE,
+         &mvec, 1, mlen, &cvec, 1, &advec, 1, npub, k);
+}
 
-    /* Encrypt to plaintext to produce the ciphertext */
-    skinny_aead_128_384_encrypt(&ks, DOMAIN_SEP_M2, sum, c, m, mlen);
+int skinny_aead_m1_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M1, SKINNY_AEAD_M1_NONCE_SIZE, SKINNY_AEAD_M1_TAG_SIZE,
+         c, c_count, clen, m, m_count, ad, ad_count, npub, k);
+}
 
-    /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M2, sum, ad, adlen);
+int skinny_aead_m1_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M1, SKINNY_AEAD_M1_NONCE_SIZE, SKINNY_AEAD_M1_TAG_SIZE,
+         m, m_count, mlen, c, c_count, ad, ad_count, npub, k);
+}
 
-    /* Generate the authentication tag */
-    memcpy(c + mlen, sum, SKINNY_AEAD_M2_TAG_SIZE);
-    return 0;
+int skinny_aead_m2_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + SKINNY_AEAD_M2_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M2, SKINNY_AEAD_M2_NONCE_SIZE, SKINNY_AEAD_M2_TAG_SIZE,
+         &cvec, 1, clen, &mvec, 1, &advec, 1, npub, k);
 }
 
 int skinny_aead_m2_decrypt
@@ -365,26 +554,43 @@ int skinny_aead_m2_decrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_384_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SKINNY_AEAD_M2_TAG_SIZE ?
+                   clen - SKINNY_AEAD_M2_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M2, SKINNY_AEAD_M2_NONCE_SIZE, SKINNY_AEAD_M2_TAG_SIZE,
+         &mvec, 1, mlen, &cvec, 1, &advec, 1, npub, k);
+}
 
-    /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < SKINNY_AEAD_M2_TAG_SIZE)
-        return -1;
-    *mlen = clen - SKINNY_AEAD_M2_TAG_SIZE;
-
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M2_NONCE_SIZE);
-
-    /* Decrypt to ciphertext to produce the plaintext */
-    skinny_aead_128_384_decrypt(&ks, DOMAIN_SEP_M2, sum, m, c, *mlen);
-
-    /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M2, sum, ad, adlen);
+int skinny_aead_m2_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M2, SKINNY_AEAD_M2_NONCE_SIZE, SKINNY_AEAD_M2_TAG_SIZE,
+         c, c_count, clen, m, m_count, ad, ad_count, npub, k);
+}
 
-    /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, sum, c + *mlen, SKINNY_AEAD_M2_TAG_SIZE);
+int skinny_aead_m2_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M2, SKINNY_AEAD_M2_NONCE_SIZE, SKINNY_AEAD_M2_TAG_SIZE,
+         m, m_count, mlen, c, c_count, ad, ad_count, npub, k);
 }
 
 int skinny_aead_m3_encrypt
@@ -395,25 +601,14 @@ int skinny_aead_m3_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_384_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
-
-    /* Set the length of the returned ciphertext */
-    *clen = mlen + SKINNY_AEAD_M3_TAG_SIZE;
-
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M3_NONCE_SIZE);
-
-    /* Encrypt to plaintext to produce the ciphertext */
-    skinny_aead_128_384_encrypt(&ks, DOMAIN_SEP_M3, sum, c, m, mlen);
-
-    /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M3, sum, ad, adlen);
-
-    /* Generate the authentication tag */
-    memcpy(c + mlen, sum, SKINNY_AEAD_M3_TAG_SIZE);
-    return 0;
+    aead_iovec_set(&cvec, c, mlen + SKINNY_AEAD_M3_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M3, SKINNY_AEAD_M3_NONCE_SIZE, SKINNY_AEAD_M3_TAG_SIZE,
+         &cvec, 1, clen, &mvec, 1, &advec, 1, npub, k);
 }
 
 int skinny_aead_m3_decrypt
@@ -424,26 +619,43 @@ int skinny_aead_m3_decrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_384_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SKINNY_AEAD_M3_TAG_SIZE ?
+                   clen - SKINNY_AEAD_M3_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M3, SKINNY_AEAD_M3_NONCE_SIZE, SKINNY_AEAD_M3_TAG_SIZE,
+         &mvec, 1, mlen, &cvec, 1, &advec, 1, npub, k);
+}
 
-    /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < SKINNY_AEAD_M3_TAG_SIZE)
-        return -1;
-    *mlen = clen - SKINNY_AEAD_M3_TAG_SIZE;
-
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M3_NONCE_SIZE);
-
-    /* Decrypt to ciphertext to produce the plaintext */
-    skinny_aead_128_384_decrypt(&ks, DOMAIN_SEP_M3, sum, m, c, *mlen);
-
-    /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M3, sum, ad, adlen);
+int skinny_aead_m3_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M3, SKINNY_AEAD_M3_NONCE_SIZE, SKINNY_AEAD_M3_TAG_SIZE,
+         c, c_count, clen, m, m_count, ad, ad_count, npub, k);
+}
 
-    /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, sum, c + *mlen, SKINNY_AEAD_M3_TAG_SIZE);
+int skinny_aead_m3_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M3, SKINNY_AEAD_M3_NONCE_SIZE, SKINNY_AEAD_M3_TAG_SIZE,
+         m, m_count, mlen, c, c_count, ad, ad_count, npub, k);
 }
 
 int skinny_aead_m4_encrypt
@@ -454,25 +666,14 @@ int skinny_aead_m4_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_384_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
-
-    /* Set the length of the returned ciphertext */
-    *clen = mlen + SKINNY_AEAD_M4_TAG_SIZE;
-
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M4_NONCE_SIZE);
-
-    /* Encrypt to plaintext to produce the ciphertext */
-    skinny_aead_128_384_encrypt(&ks, DOMAIN_SEP_M4, sum, c, m, mlen);
-
-    /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M4, sum, ad, adlen);
-
-    /* Generate the authentication tag */
-    memcpy(c + mlen, sum, SKINNY_AEAD_M4_TAG_SIZE);
-    return 0;
+    aead_iovec_set(&cvec, c, mlen + SKINNY_AEAD_M4_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M4, SKINNY_AEAD_M4_NONCE_SIZE, SKINNY_AEAD_M4_TAG_SIZE,
+         &cvec, 1, clen, &mvec, 1, &advec, 1, npub, k);
 }
 
 int skinny_aead_m4_decrypt
@@ -483,45 +684,123 @@ int skinny_aead_m4_decrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_384_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SKINNY_AEAD_M4_TAG_SIZE ?
+                   clen - SKINNY_AEAD_M4_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M4, SKINNY_AEAD_M4_NONCE_SIZE, SKINNY_AEAD_M4_TAG_SIZE,
+         &mvec, 1, mlen, &cvec, 1, &advec, 1, npub, k);
+}
 
-    /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < SKINNY_AEAD_M4_TAG_SIZE)
-        return -1;
-    *mlen = clen - SKINNY_AEAD_M4_TAG_SIZE;
+int skinny_aead_m4_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_encrypt_vec
+        (DOMAIN_SEP_M4, SKINNY_AEAD_M4_NONCE_SIZE, SKINNY_AEAD_M4_TAG_SIZE,
+         c, c_count, clen, m, m_count, ad, ad_count, npub, k);
+}
 
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_384_init(&ks, k, npub, SKINNY_AEAD_M4_NONCE_SIZE);
+int skinny_aead_m4_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return skinny_aead_128_384_decrypt_vec
+        (DOMAIN_SEP_M4, SKINNY_AEAD_M4_NONCE_SIZE, SKINNY_AEAD_M4_TAG_SIZE,
+         m, m_count, mlen, c, c_count, ad, ad_count, npub, k);
+}
 
-    /* Decrypt to ciphertext to produce the plaintext */
-    skinny_aead_128_384_decrypt(&ks, DOMAIN_SEP_M4, sum, m, c, *mlen);
+/**
+ * \brief Sets up the key schedule for SKINNY-128-256 based AEAD schemes.
+ *
+ * \param ctx The key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * The nonce is in TK1 and the key is in TK2, so the key schedule can be
+ * set up once and then reused with skinny_aead_128_256_set_nonce().
+ */
+static void skinny_aead_128_256_setup_key_schedule
+    (void *ctx, const unsigned char *k, unsigned schedule)
+{
+    unsigned char TK[32];
+    memset(TK, 0, 16);
+    memcpy(TK + 16, k, 16);
+    skinny_128_256_variant_init
+        ((skinny_128_256_variant_key_schedule_t *)ctx, TK,
+         skinny_128_variant_for_schedule(schedule));
+}
 
-    /* Process the associated data */
-    skinny_aead_128_384_authenticate(&ks, DOMAIN_SEP_M4, sum, ad, adlen);
+/**
+ * \brief Sets up the default key schedule for SKINNY-128-256 based
+ * AEAD schemes.
+ *
+ * \param ctx The key schedule to initialize.
+ * \param k Points to the 16 bytes of the key.
+ */
+static void skinny_aead_128_256_setup_key(void *ctx, const unsigned char *k)
+{
+    skinny_aead_128_256_setup_key_schedule(ctx, k, AEAD_SCHEDULE_DEFAULT);
+}
 
-    /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, sum, c + *mlen, SKINNY_AEAD_M4_TAG_SIZE);
+/**
+ * \brief Gets the size of the key context for SKINNY-128-256 based AEAD
+ * schemes with a specific key schedule variant.
+ *
+ * \param schedule The key schedule variant; e.g. AEAD_SCHEDULE_SMALL.
+ *
+ * \return The size of the key context in bytes.
+ */
+static size_t skinny_aead_128_256_schedule_size(unsigned schedule)
+{
+    return skinny_128_256_variant_schedule_size
+        (skinny_128_variant_for_schedule(schedule));
 }
 
 /**
- * \brief Initialize the key and nonce for SKINNY-128-256 based AEAD schemes.
+ * \brief Copies a SKINNY-128-256 key context into a local key schedule.
  *
- * \param ks The key schedule to initialize.
- * \param key Points to the 16 bytes of the key.
+ * \param ks The local key schedule to copy into.
+ * \param ctx The key context that was set up previously.
+ *
+ * Only the part of the key context that is used by its variant is copied.
+ */
+static void skinny_aead_128_256_copy_key
+    (skinny_128_256_variant_key_schedule_t *ks, const void *ctx)
+{
+    const skinny_128_256_variant_key_schedule_t *src =
+        (const skinny_128_256_variant_key_schedule_t *)ctx;
+    memcpy(ks, src,
+           skinny_128_256_variant_schedule_size(src->variant->schedule));
+}
+
+/**
+ * \brief Sets the nonce in a SKINNY-128-256 key schedule that was
+ * previously set up with skinny_aead_128_256_setup_key().
+ *
+ * \param ks The key schedule to modify.
  * \param nonce Points to the nonce.
  * \param nonce_len Length of the nonce in bytes.
  */
-static void skinny_aead_128_256_init
-    (skinny_128_256_key_schedule_t *ks, const unsigned char *key,
-     const unsigned char *nonce, unsigned nonce_len)
+static void skinny_aead_128_256_set_nonce
+    (skinny_128_256_variant_key_schedule_t *ks, const unsigned char *nonce,
+     unsigned nonce_len)
 {
-    unsigned char k[32];
-    memset(k, 0, 16 - nonce_len);
-    memcpy(k + 16 - nonce_len, nonce, nonce_len);
-    memcpy(k + 16, key, 16);
-    skinny_128_256_init(ks, k);
+    memset(ks->s.TK1, 0, 16 - nonce_len);
+    memcpy(ks->s.TK1 + 16 - nonce_len, nonce, nonce_len);
 }
 
 /**
@@ -530,7 +809,7 @@ static void skinny_aead_128_256_init
  * \param ks Key schedule for the block cipher.
  * \param d Domain separation value to write into the tweak.
  */
-#define skinny_aead_128_256_set_domain(ks,d) ((ks)->TK1[3] = (d))
+#define skinny_aead_128_256_set_domain(ks,d) ((ks)->s.TK1[3] = (d))
 
 /**
  * \brief Sets the LFSR field in the tweak for SKINNY-128-256.
@@ -540,9 +819,9 @@ static void skinny_aead_128_256_init
  */
 #define skinny_aead_128_256_set_lfsr(ks,lfsr) \
     do { \
-        (ks)->TK1[0] = (uint8_t)(lfsr); \
-        (ks)->TK1[1] = (uint8_t)((lfsr) >> 8); \
-        (ks)->TK1[2] = (uint8_t)((lfsr) >> 16); \
+        (ks)->s.TK1[0] = (uint8_t)(lfsr); \
+        (ks)->s.TK1[1] = (uint8_t)((lfsr) >> 8); \
+        (ks)->s.TK1[2] = (uint8_t)((lfsr) >> 16); \
     } while (0)
 
 /**
@@ -562,22 +841,23 @@ static void skinny_aead_128_256_init
  * \param ks The key schedule to use.
  * \param prefix Domain separation prefix for the family member.
  * \param tag Final tag to XOR the authentication checksum into.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void skinny_aead_128_256_authenticate
-    (skinny_128_256_key_schedule_t *ks, unsigned char prefix,
+    (skinny_128_256_variant_key_schedule_t *ks, unsigned char prefix,
      unsigned char tag[SKINNY_128_BLOCK_SIZE],
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
     unsigned char block[SKINNY_128_BLOCK_SIZE];
+    const unsigned char *in;
     uint32_t lfsr = 1;
     skinny_aead_128_256_set_domain(ks, prefix | 2);
     while (adlen >= SKINNY_128_BLOCK_SIZE) {
+        in = aead_iovec_load_block(ad, block, SKINNY_128_BLOCK_SIZE);
         skinny_aead_128_256_set_lfsr(ks, lfsr);
-        skinny_128_256_encrypt(ks, block, ad);
+        skinny_128_256_variant_encrypt(ks, block, in);
         lw_xor_block(tag, block, SKINNY_128_BLOCK_SIZE);
-        ad += SKINNY_128_BLOCK_SIZE;
         adlen -= SKINNY_128_BLOCK_SIZE;
         skinny_aead_128_256_update_lfsr(lfsr);
     }
@@ -585,10 +865,10 @@ static void skinny_aead_128_256_authenticate
         unsigned temp = (unsigned)adlen;
         skinny_aead_128_256_set_lfsr(ks, lfsr);
         skinny_aead_128_256_set_domain(ks, prefix | 3);
-        memcpy(block, ad, temp);
+        aead_iovec_read(ad, block, temp);
         block[temp] = 0x80;
         memset(block + temp + 1, 0, SKINNY_128_BLOCK_SIZE - temp - 1);
-        skinny_128_256_encrypt(ks, block, block);
+        skinny_128_256_variant_encrypt(ks, block, block);
         lw_xor_block(tag, block, SKINNY_128_BLOCK_SIZE);
     }
 }
@@ -599,44 +879,52 @@ static void skinny_aead_128_256_authenticate
  * \param ks The key schedule to use.
  * \param prefix Domain separation prefix for the family member.
  * \param sum Authenticated checksum over the plaintext.
- * \param c Points to the buffer to receive the ciphertext.
- * \param m Points to the plaintext buffer.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Number of bytes of plaintext to be encrypted.
  */
 static void skinny_aead_128_256_encrypt
-    (skinny_128_256_key_schedule_t *ks, unsigned char prefix,
-     unsigned char sum[SKINNY_128_BLOCK_SIZE], unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+    (skinny_128_256_variant_key_schedule_t *ks, unsigned char prefix,
+     unsigned char sum[SKINNY_128_BLOCK_SIZE], aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
     unsigned char block[SKINNY_128_BLOCK_SIZE];
+    unsigned char inbuf[SKINNY_128_BLOCK_SIZE];
+    unsigned char outbuf[SKINNY_128_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     uint32_t lfsr = 1;
     memset(sum, 0, SKINNY_128_BLOCK_SIZE);
     skinny_aead_128_256_set_domain(ks, prefix | 0);
     while (mlen >= SKINNY_128_BLOCK_SIZE) {
+        in = aead_iovec_load_block(m, inbuf, SKINNY_128_BLOCK_SIZE);
+        out = aead_iovec_store_begin(c, outbuf, SKINNY_128_BLOCK_SIZE);
         skinny_aead_128_256_set_lfsr(ks, lfsr);
-        lw_xor_block(sum, m, SKINNY_128_BLOCK_SIZE);
-        skinny_128_256_encrypt(ks, c, m);
-        c += SKINNY_128_BLOCK_SIZE;
-        m += SKINNY_128_BLOCK_SIZE;
+        lw_xor_block(sum, in, SKINNY_128_BLOCK_SIZE);
+        skinny_128_256_variant_encrypt(ks, out, in);
+        aead_iovec_store_end(c, outbuf, out, SKINNY_128_BLOCK_SIZE);
         mlen -= SKINNY_128_BLOCK_SIZE;
         skinny_aead_128_256_update_lfsr(lfsr);
     }
     skinny_aead_128_256_set_lfsr(ks, lfsr);
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
         skinny_aead_128_256_set_domain(ks, prefix | 1);
-        lw_xor_block(sum, m, temp);
+        lw_xor_block(sum, in, temp);
         sum[temp] ^= 0x80;
         memset(block, 0, SKINNY_128_BLOCK_SIZE);
-        skinny_128_256_encrypt(ks, block, block);
-        lw_xor_block_2_src(c, block, m, temp);
+        skinny_128_256_variant_encrypt(ks, block, block);
+        lw_xor_block_2_src(out, block, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
         skinny_aead_128_256_update_lfsr(lfsr);
         skinny_aead_128_256_set_lfsr(ks, lfsr);
         skinny_aead_128_256_set_domain(ks, prefix | 5);
     } else {
         skinny_aead_128_256_set_domain(ks, prefix | 4);
     }
-    skinny_128_256_encrypt(ks, sum, sum);
+    skinny_128_256_variant_encrypt(ks, sum, sum);
 }
 
 /**
@@ -645,132 +933,308 @@ static void skinny_aead_128_256_encrypt
  * \param ks The key schedule to use.
  * \param prefix Domain separation prefix for the family member.
  * \param sum Authenticated checksum over the plaintext.
- * \param m Points to the buffer to receive the plaintext.
- * \param c Points to the ciphertext buffer.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param mlen Number of bytes of ciphertext to be decrypted.
  */
 static void skinny_aead_128_256_decrypt
-    (skinny_128_256_key_schedule_t *ks, unsigned char prefix,
-     unsigned char sum[SKINNY_128_BLOCK_SIZE], unsigned char *m,
-     const unsigned char *c, unsigned long long mlen)
+    (skinny_128_256_variant_key_schedule_t *ks, unsigned char prefix,
+     unsigned char sum[SKINNY_128_BLOCK_SIZE], aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long mlen)
 {
     unsigned char block[SKINNY_128_BLOCK_SIZE];
+    unsigned char inbuf[SKINNY_128_BLOCK_SIZE];
+    unsigned char outbuf[SKINNY_128_BLOCK_SIZE];
+    const unsigned char *in;
+    unsigned char *out;
     uint32_t lfsr = 1;
     memset(sum, 0, SKINNY_128_BLOCK_SIZE);
     skinny_aead_128_256_set_domain(ks, prefix | 0);
     while (mlen >= SKINNY_128_BLOCK_SIZE) {
+        in = aead_iovec_load_block(c, inbuf, SKINNY_128_BLOCK_SIZE);
+        out = aead_iovec_store_begin(m, outbuf, SKINNY_128_BLOCK_SIZE);
         skinny_aead_128_256_set_lfsr(ks, lfsr);
-        skinny_128_256_decrypt(ks, m, c);
-        lw_xor_block(sum, m, SKINNY_128_BLOCK_SIZE);
-        c += SKINNY_128_BLOCK_SIZE;
-        m += SKINNY_128_BLOCK_SIZE;
+        skinny_128_256_variant_decrypt(ks, out, in);
+        lw_xor_block(sum, out, SKINNY_128_BLOCK_SIZE);
+        aead_iovec_store_end(m, outbuf, out, SKINNY_128_BLOCK_SIZE);
         mlen -= SKINNY_128_BLOCK_SIZE;
         skinny_aead_128_256_update_lfsr(lfsr);
     }
     skinny_aead_128_256_set_lfsr(ks, lfsr);
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
         skinny_aead_128_256_set_domain(ks, prefix | 1);
         memset(block, 0, SKINNY_128_BLOCK_SIZE);
-        skinny_128_256_encrypt(ks, block, block);
-        lw_xor_block_2_src(m, block, c, temp);
-        lw_xor_block(sum, m, temp);
+        skinny_128_256_variant_encrypt(ks, block, block);
+        lw_xor_block_2_src(out, block, in, temp);
+        lw_xor_block(sum, out, temp);
         sum[temp] ^= 0x80;
+        aead_iovec_store_end(m, outbuf, out, temp);
         skinny_aead_128_256_update_lfsr(lfsr);
         skinny_aead_128_256_set_lfsr(ks, lfsr);
         skinny_aead_128_256_set_domain(ks, prefix | 5);
     } else {
         skinny_aead_128_256_set_domain(ks, prefix | 4);
     }
-    skinny_128_256_encrypt(ks, sum, sum);
+    skinny_128_256_variant_encrypt(ks, sum, sum);
 }
 
-int skinny_aead_m5_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
-     const unsigned char *nsec,
+/**
+ * \brief Encrypts and authenticates a scatter/gather packet with a
+ * SKINNY-128-256 based AEAD using a key context.
+ *
+ * \param prefix Domain separation prefix for the family member.
+ * \param nonce_len Length of the nonce for the family member.
+ * \param tag_len Length of the tag for the family member.
+ * \param c Array of segments to receive the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param clen On exit, set to the length of the ciphertext and tag.
+ * \param m Array of segments that contain the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, or -2 if \a c is too small.
+ */
+static int skinny_aead_128_256_encrypt_vec
+    (unsigned char prefix, unsigned nonce_len, unsigned tag_len,
+     const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    skinny_128_256_key_schedule_t ks;
+    skinny_128_256_variant_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
     unsigned char sum[SKINNY_128_BLOCK_SIZE];
-    (void)nsec;
 
     /* Set the length of the returned ciphertext */
-    *clen = mlen + SKINNY_AEAD_M5_TAG_SIZE;
+    if (aead_iovec_length(c, c_count) < (mlen + tag_len))
+        return -2;
+    *clen = mlen + tag_len;
 
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_256_init(&ks, k, npub, SKINNY_AEAD_M5_NONCE_SIZE);
+    /* Copy the key schedule and then set the nonce */
+    skinny_aead_128_256_copy_key(&ks, ctx);
+    skinny_aead_128_256_set_nonce(&ks, npub, nonce_len);
 
     /* Encrypt to plaintext to produce the ciphertext */
-    skinny_aead_128_256_encrypt(&ks, DOMAIN_SEP_M5, sum, c, m, mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    skinny_aead_128_256_encrypt(&ks, prefix, sum, &ccur, &mcur, mlen);
 
     /* Process the associated data */
-    skinny_aead_128_256_authenticate(&ks, DOMAIN_SEP_M5, sum, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    skinny_aead_128_256_authenticate
+        (&ks, prefix, sum, &adcur, aead_iovec_length(ad, ad_count));
 
     /* Generate the authentication tag */
-    memcpy(c + mlen, sum, SKINNY_AEAD_M5_TAG_SIZE);
+    aead_iovec_write(&ccur, sum, tag_len);
     return 0;
 }
 
-int skinny_aead_m5_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+/**
+ * \brief Decrypts and authenticates a scatter/gather packet with a
+ * SKINNY-128-256 based AEAD using a key context.
+ *
+ * \param prefix Domain separation prefix for the family member.
+ * \param nonce_len Length of the nonce for the family member.
+ * \param tag_len Length of the tag for the family member.
+ * \param m Array of segments to receive the plaintext message.
+ * \param m_count Number of segments in \a m.
+ * \param mlen Receives the length of the plaintext message on output.
+ * \param c Array of segments that contain the ciphertext and tag.
+ * \param c_count Number of segments in \a c.
+ * \param ad Array of segments that contain the associated data.
+ * \param ad_count Number of segments in \a ad.
+ * \param npub Points to the public nonce for the packet.
+ * \param ctx The key context that was set up previously.
+ *
+ * \return 0 on success, -1 if the authentication tag was incorrect,
+ * or -2 if \a m is too small.
+ */
+static int skinny_aead_128_256_decrypt_vec
+    (unsigned char prefix, unsigned nonce_len, unsigned tag_len,
+     const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    skinny_128_256_key_schedule_t ks;
+    skinny_128_256_variant_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
     unsigned char sum[SKINNY_128_BLOCK_SIZE];
-    (void)nsec;
+    unsigned char tag[SKINNY_128_BLOCK_SIZE];
 
     /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < SKINNY_AEAD_M5_TAG_SIZE)
+    if (clen < tag_len)
         return -1;
-    *mlen = clen - SKINNY_AEAD_M5_TAG_SIZE;
+    *mlen = clen - tag_len;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
 
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_256_init(&ks, k, npub, SKINNY_AEAD_M5_NONCE_SIZE);
+    /* Copy the key schedule and then set the nonce */
+    skinny_aead_128_256_copy_key(&ks, ctx);
+    skinny_aead_128_256_set_nonce(&ks, npub, nonce_len);
 
     /* Decrypt to ciphertext to produce the plaintext */
-    skinny_aead_128_256_decrypt(&ks, DOMAIN_SEP_M5, sum, m, c, *mlen);
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    skinny_aead_128_256_decrypt(&ks, prefix, sum, &mcur, &ccur, *mlen);
 
     /* Process the associated data */
-    skinny_aead_128_256_authenticate(&ks, DOMAIN_SEP_M5, sum, ad, adlen);
+    aead_iovec_start(&adcur, ad, ad_count);
+    skinny_aead_128_256_authenticate
+        (&ks, prefix, sum, &adcur, aead_iovec_length(ad, ad_count));
 
     /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, sum, c + *mlen, SKINNY_AEAD_M5_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, tag_len);
+    return aead_check_tag_vec(m, m_count, *mlen, sum, tag, tag_len);
 }
 
-int skinny_aead_m6_encrypt
+/**
+ * \brief Encrypts and authenticates a packet with SKINNY-AEAD-M5 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int skinny_aead_m5_encrypt_ctx
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
-     const unsigned char *k)
+     const void *ctx)
 {
-    skinny_128_256_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    aead_iovec_t cvec, mvec, advec;
     (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + SKINNY_AEAD_M5_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_256_encrypt_vec
+        (DOMAIN_SEP_M5, SKINNY_AEAD_M5_NONCE_SIZE, SKINNY_AEAD_M5_TAG_SIZE,
+         &cvec, 1, clen, &mvec, 1, &advec, 1, npub, ctx);
+}
 
-    /* Set the length of the returned ciphertext */
-    *clen = mlen + SKINNY_AEAD_M6_TAG_SIZE;
+/**
+ * \brief Decrypts and authenticates a packet with SKINNY-AEAD-M5 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int skinny_aead_m5_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SKINNY_AEAD_M5_TAG_SIZE ?
+                   clen - SKINNY_AEAD_M5_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_256_decrypt_vec
+        (DOMAIN_SEP_M5, SKINNY_AEAD_M5_NONCE_SIZE, SKINNY_AEAD_M5_TAG_SIZE,
+         &mvec, 1, mlen, &cvec, 1, &advec, 1, npub, ctx);
+}
 
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_256_init(&ks, k, npub, SKINNY_AEAD_M6_NONCE_SIZE);
+/**
+ * \brief Encrypts and authenticates a packet with SKINNY-AEAD-M6 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_encrypt_ctx_t
+ */
+static int skinny_aead_m6_encrypt_ctx
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, mlen + SKINNY_AEAD_M6_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_256_encrypt_vec
+        (DOMAIN_SEP_M6, SKINNY_AEAD_M6_NONCE_SIZE, SKINNY_AEAD_M6_TAG_SIZE,
+         &cvec, 1, clen, &mvec, 1, &advec, 1, npub, ctx);
+}
 
-    /* Encrypt to plaintext to produce the ciphertext */
-    skinny_aead_128_256_encrypt(&ks, DOMAIN_SEP_M6, sum, c, m, mlen);
+/**
+ * \brief Decrypts and authenticates a packet with SKINNY-AEAD-M6 using a
+ * key context that was set up previously.
+ *
+ * \sa aead_cipher_decrypt_ctx_t
+ */
+static int skinny_aead_m6_decrypt_ctx
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const void *ctx)
+{
+    aead_iovec_t cvec, mvec, advec;
+    (void)nsec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SKINNY_AEAD_M6_TAG_SIZE ?
+                   clen - SKINNY_AEAD_M6_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return skinny_aead_128_256_decrypt_vec
+        (DOMAIN_SEP_M6, SKINNY_AEAD_M6_NONCE_SIZE, SKINNY_AEAD_M6_TAG_SIZE,
+         &mvec, 1, mlen, &cvec, 1, &advec, 1, npub, ctx);
+}
 
-    /* Process the associated data */
-    skinny_aead_128_256_authenticate(&ks, DOMAIN_SEP_M6, sum, ad, adlen);
+int skinny_aead_m5_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_m5_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
+}
 
-    /* Generate the authentication tag */
-    memcpy(c + mlen, sum, SKINNY_AEAD_M6_TAG_SIZE);
-    return 0;
+int skinny_aead_m5_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_m5_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int skinny_aead_m6_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_m6_encrypt_ctx
+        (c, clen, m, mlen, ad, adlen, nsec, npub, &ks);
 }
 
 int skinny_aead_m6_decrypt
@@ -781,24 +1245,198 @@ int skinny_aead_m6_decrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    skinny_128_256_key_schedule_t ks;
-    unsigned char sum[SKINNY_128_BLOCK_SIZE];
+    skinny_128_256_variant_key_schedule_t ks;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_m6_decrypt_ctx
+        (m, mlen, nsec, c, clen, ad, adlen, npub, &ks);
+}
+
+int skinny_aead_m5_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
     (void)nsec;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_128_256_encrypt_vec
+        (DOMAIN_SEP_M5, SKINNY_AEAD_M5_NONCE_SIZE, SKINNY_AEAD_M5_TAG_SIZE,
+         c, c_count, clen, m, m_count, ad, ad_count, npub, &ks);
+}
 
-    /* Validate the ciphertext length and set the return "mlen" value */
-    if (clen < SKINNY_AEAD_M6_TAG_SIZE)
-        return -1;
-    *mlen = clen - SKINNY_AEAD_M6_TAG_SIZE;
+int skinny_aead_m5_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
+    (void)nsec;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_128_256_decrypt_vec
+        (DOMAIN_SEP_M5, SKINNY_AEAD_M5_NONCE_SIZE, SKINNY_AEAD_M5_TAG_SIZE,
+         m, m_count, mlen, c, c_count, ad, ad_count, npub, &ks);
+}
 
-    /* Set up the key schedule with the key and the nonce */
-    skinny_aead_128_256_init(&ks, k, npub, SKINNY_AEAD_M6_NONCE_SIZE);
+int skinny_aead_m6_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
+    (void)nsec;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_128_256_encrypt_vec
+        (DOMAIN_SEP_M6, SKINNY_AEAD_M6_NONCE_SIZE, SKINNY_AEAD_M6_TAG_SIZE,
+         c, c_count, clen, m, m_count, ad, ad_count, npub, &ks);
+}
 
-    /* Decrypt to ciphertext to produce the plaintext */
-    skinny_aead_128_256_decrypt(&ks, DOMAIN_SEP_M6, sum, m, c, *mlen);
+int skinny_aead_m6_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    skinny_128_256_variant_key_schedule_t ks;
+    (void)nsec;
+    skinny_aead_128_256_setup_key(&ks, k);
+    return skinny_aead_128_256_decrypt_vec
+        (DOMAIN_SEP_M6, SKINNY_AEAD_M6_NONCE_SIZE, SKINNY_AEAD_M6_TAG_SIZE,
+         m, m_count, mlen, c, c_count, ad, ad_count, npub, &ks);
+}
 
-    /* Process the associated data */
-    skinny_aead_128_256_authenticate(&ks, DOMAIN_SEP_M6, sum, ad, adlen);
+aead_cipher_t const skinny_aead_m1_cipher = {
+    "SKINNY-AEAD-M1",
+    SKINNY_AEAD_KEY_SIZE,
+    SKINNY_AEAD_M1_NONCE_SIZE,
+    SKINNY_AEAD_M1_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    skinny_aead_m1_encrypt,
+    skinny_aead_m1_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    skinny_aead_m1_encrypt_vec,
+    skinny_aead_m1_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
 
-    /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, sum, c + *mlen, SKINNY_AEAD_M6_TAG_SIZE);
-}
+aead_cipher_t const skinny_aead_m2_cipher = {
+    "SKINNY-AEAD-M2",
+    SKINNY_AEAD_KEY_SIZE,
+    SKINNY_AEAD_M2_NONCE_SIZE,
+    SKINNY_AEAD_M2_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    skinny_aead_m2_encrypt,
+    skinny_aead_m2_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    skinny_aead_m2_encrypt_vec,
+    skinny_aead_m2_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const skinny_aead_m3_cipher = {
+    "SKINNY-AEAD-M3",
+    SKINNY_AEAD_KEY_SIZE,
+    SKINNY_AEAD_M3_NONCE_SIZE,
+    SKINNY_AEAD_M3_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    skinny_aead_m3_encrypt,
+    skinny_aead_m3_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    skinny_aead_m3_encrypt_vec,
+    skinny_aead_m3_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const skinny_aead_m4_cipher = {
+    "SKINNY-AEAD-M4",
+    SKINNY_AEAD_KEY_SIZE,
+    SKINNY_AEAD_M4_NONCE_SIZE,
+    SKINNY_AEAD_M4_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    skinny_aead_m4_encrypt,
+    skinny_aead_m4_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    skinny_aead_m4_encrypt_vec,
+    skinny_aead_m4_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
+};
+
+aead_cipher_t const skinny_aead_m5_cipher = {
+    "SKINNY-AEAD-M5",
+    SKINNY_AEAD_KEY_SIZE,
+    SKINNY_AEAD_M5_NONCE_SIZE,
+    SKINNY_AEAD_M5_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    skinny_aead_m5_encrypt,
+    skinny_aead_m5_decrypt,
+    sizeof(skinny_128_256_variant_key_schedule_t),
+    skinny_aead_128_256_setup_key,
+    skinny_aead_m5_encrypt_ctx,
+    skinny_aead_m5_decrypt_ctx,
+    skinny_aead_m5_encrypt_vec,
+    skinny_aead_m5_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    skinny_aead_128_256_schedule_size,
+    skinny_aead_128_256_setup_key_schedule
+};
+
+aead_cipher_t const skinny_aead_m6_cipher = {
+    "SKINNY-AEAD-M6",
+    SKINNY_AEAD_KEY_SIZE,
+    SKINNY_AEAD_M6_NONCE_SIZE,
+    SKINNY_AEAD_M6_TAG_SIZE,
+    AEAD_FLAG_LITTLE_ENDIAN,
+    skinny_aead_m6_encrypt,
+    skinny_aead_m6_decrypt,
+    sizeof(skinny_128_256_variant_key_schedule_t),
+    skinny_aead_128_256_setup_key,
+    skinny_aead_m6_encrypt_ctx,
+    skinny_aead_m6_decrypt_ctx,
+    skinny_aead_m6_encrypt_vec,
+    skinny_aead_m6_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    skinny_aead_128_256_schedule_size,
+    skinny_aead_128_256_setup_key_schedule
+};
@@ -239,6 +239,229 @@ void gift128t_decrypt
     (const gift128n_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input, uint32_t tweak);
 
+/**
+ * \brief Maximum number of round keys for any variant of the GIFT-128
+ * key schedule.
+ */
+#define GIFT128_ROUND_KEYS_MAX 80
+
+/**
+ * \brief Entry points for a variant of GIFT-128 that can be selected
+ * at runtime.
+ *
+ * The key schedule arguments point to the round keys for the variant,
+ * which occupy \a schedule_size bytes.
+ */
+typedef struct
+{
+    /** GIFT128_VARIANT_FULL, GIFT128_VARIANT_SMALL, or GIFT128_VARIANT_TINY */
+    int variant;
+
+    /** Size of the round keys for the variant in bytes */
+    unsigned schedule_size;
+
+    /** Initializes the key schedule for GIFT-128 (bit-sliced) */
+    void (*init_b)(void *ks, const unsigned char *key);
+
+    /** Initializes the key schedule for GIFT-128 (nibble-based) */
+    void (*init_n)(void *ks, const unsigned char *key);
+
+    /** Encrypts a block with GIFT-128 (bit-sliced) */
+    void (*encrypt_b)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+    /** Encrypts a pre-loaded block with GIFT-128 (bit-sliced) */
+    void (*encrypt_preloaded)
+        (const void *ks, uint32_t output[4], const uint32_t input[4]);
+
+    /** Decrypts a block with GIFT-128 (bit-sliced) */
+    void (*decrypt_b)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+    /** Encrypts a block with GIFT-128 (nibble-based) */
+    void (*encrypt_n)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+    /** Decrypts a block with GIFT-128 (nibble-based) */
+    void (*decrypt_n)
+        (const void *ks, unsigned char *output, const unsigned char *input);
+
+} gift128_variant_t;
+
+/**
+ * \brief Key schedule for GIFT-128 whose variant is chosen at runtime.
+ *
+ * Only the first gift128_variant_schedule_size() bytes of the structure
+ * are used, so key contexts for the smaller variants can be allocated
+ * with less memory than sizeof(gift128_variant_key_schedule_t).
+ */
+typedef struct
+{
+    /** Variant that was used to set up the key schedule */
+    const gift128_variant_t *variant;
+
+    /** Round keys for the variant */
+    uint32_t k[GIFT128_ROUND_KEYS_MAX];
+
+} gift128_variant_key_schedule_t;
+
+/**
+ * \brief Maps an AEAD key schedule selector to a variant of GIFT-128.
+ *
+ * \param schedule AEAD_SCHEDULE_DEFAULT, AEAD_SCHEDULE_FULL,
+ * AEAD_SCHEDULE_SMALL, or AEAD_SCHEDULE_TINY.
+ *
+ * \return The corresponding GIFT128_VARIANT_* value.
+ */
+int gift128_variant_for_schedule(unsigned schedule);
+
+#if !GIFT128_VARIANT_ASM
+
+/**
+ * \brief Gets the entry points for a variant of GIFT-128.
+ *
+ * \param variant GIFT128_VARIANT_FULL, GIFT128_VARIANT_SMALL, or
+ * GIFT128_VARIANT_TINY.
+ *
+ * \return The entry points for the variant.  If the variant is not
+ * available on this platform, then the default GIFT128_VARIANT is
+ * returned instead.
+ *
+ * Platforms with an assembly code version of GIFT-128 only have the
+ * default variant.
+ */
+const gift128_variant_t *gift128_get_variant(int variant);
+
+/**
+ * \brief Gets the number of bytes of a gift128_variant_key_schedule_t
+ * structure that are used by a specific variant.
+ *
+ * \param variant GIFT128_VARIANT_FULL, GIFT128_VARIANT_SMALL, or
+ * GIFT128_VARIANT_TINY.
+ *
+ * \return The size of the key schedule for the variant.
+ */
+size_t gift128_variant_schedule_size(int variant);
+
+/**
+ * \brief Initializes a runtime-selected key schedule for GIFT-128
+ * (bit-sliced).
+ *
+ * \param ks Points to the key schedule to initialize, which must be at
+ * least gift128_variant_schedule_size() bytes in size.
+ * \param key Points to the 16 bytes of the key data.
+ * \param variant Variant of the key schedule to use.
+ */
+void gift128b_variant_init
+    (gift128_variant_key_schedule_t *ks, const unsigned char *key,
+     int variant);
+
+/**
+ * \brief Encrypts a 128-bit block with a runtime-selected variant of
+ * GIFT-128 (bit-sliced).
+ *
+ * \param ks Points to the key schedule from gift128b_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void gift128b_variant_encrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+/**
+ * \brief Encrypts a pre-loaded 128-bit block with a runtime-selected
+ * variant of GIFT-128 (bit-sliced).
+ *
+ * \param ks Points to the key schedule from gift128b_variant_init().
+ * \param output Output words in host byte order.
+ * \param input Input words in host byte order.
+ *
+ * \sa gift128b_encrypt_preloaded()
+ */
+void gift128b_variant_encrypt_preloaded
+    (const gift128_variant_key_schedule_t *ks, uint32_t output[4],
+     const uint32_t input[4]);
+
+/**
+ * \brief Decrypts a 128-bit block with a runtime-selected variant of
+ * GIFT-128 (bit-sliced).
+ *
+ * \param ks Points to the key schedule from gift128b_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void gift128b_variant_decrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+/**
+ * \brief Initializes a runtime-selected key schedule for GIFT-128
+ * (nibble-based).
+ *
+ * \param ks Points to the key schedule to initialize, which must be at
+ * least gift128_variant_schedule_size() bytes in size.
+ * \param key Points to the 16 bytes of the key data.
+ * \param variant Variant of the key schedule to use.
+ */
+void gift128n_variant_init
+    (gift128_variant_key_schedule_t *ks, const unsigned char *key,
+     int variant);
+
+/**
+ * \brief Encrypts a 128-bit block with a runtime-selected variant of
+ * GIFT-128 (nibble-based).
+ *
+ * \param ks Points to the key schedule from gift128n_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void gift128n_variant_encrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+/**
+ * \brief Decrypts a 128-bit block with a runtime-selected variant of
+ * GIFT-128 (nibble-based).
+ *
+ * \param ks Points to the key schedule from gift128n_variant_init().
+ * \param output Output buffer which must be at least 16 bytes in length.
+ * \param input Input buffer which must be at least 16 bytes in length.
+ */
+void gift128n_variant_decrypt
+    (const gift128_variant_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input);
+
+#else /* GIFT128_VARIANT_ASM */
+
+/* The assembly code versions only provide the default variant, and only
+ * for the bit-sliced or nibble-based entry points that the cipher uses */
+#define gift128_variant_schedule_size(variant) \
+    ((void)(variant), offsetof(gift128_variant_key_schedule_t, k) + \
+     sizeof(gift128b_key_schedule_t))
+#define gift128b_variant_init(ks, key, variant) \
+    ((void)(variant), \
+     gift128b_init((gift128b_key_schedule_t *)((ks)->k), (key)))
+#define gift128b_variant_encrypt(ks, output, input) \
+    gift128b_encrypt \
+        ((const gift128b_key_schedule_t *)((ks)->k), (output), (input))
+#define gift128b_variant_encrypt_preloaded(ks, output, input) \
+    gift128b_encrypt_preloaded \
+        ((const gift128b_key_schedule_t *)((ks)->k), (output), (input))
+#define gift128b_variant_decrypt(ks, output, input) \
+    gift128b_decrypt \
+        ((const gift128b_key_schedule_t *)((ks)->k), (output), (input))
+#define gift128n_variant_init(ks, key, variant) \
+    ((void)(variant), \
+     gift128n_init((gift128n_key_schedule_t *)((ks)->k), (key)))
+#define gift128n_variant_encrypt(ks, output, input) \
+    gift128n_encrypt \
+        ((const gift128n_key_schedule_t *)((ks)->k), (output), (input))
+#define gift128n_variant_decrypt(ks, output, input) \
+    gift128n_decrypt \
+        ((const gift128n_key_schedule_t *)((ks)->k), (output), (input))
+
+#endif /* GIFT128_VARIANT_ASM */
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,7 +22,7 @@
 
 #include "sundae-gift.h"
 #include "internal-gift128.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const sundae_gift_0_cipher = {
@@ -32,7 +32,18 @@ aead_cipher_t const sundae_gift_0_cipher = {
     SUNDAE_GIFT_TAG_SIZE,
     AEAD_FLAG_NONE,
     sundae_gift_0_aead_encrypt,
-    sundae_gift_0_aead_decrypt
+    sundae_gift_0_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    sundae_gift_0_aead_encrypt_vec,
+    sundae_gift_0_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const sundae_gift_64_cipher = {
@@ -42,7 +53,18 @@ aead_cipher_t const sundae_gift_64_cipher = {
     SUNDAE_GIFT_TAG_SIZE,
     AEAD_FLAG_NONE,
     sundae_gift_64_aead_encrypt,
-    sundae_gift_64_aead_decrypt
+    sundae_gift_64_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    sundae_gift_64_aead_encrypt_vec,
+    sundae_gift_64_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const sundae_gift_96_cipher = {
@@ -52,7 +74,18 @@ aead_cipher_t const sundae_gift_96_cipher = {
     SUNDAE_GIFT_TAG_SIZE,
     AEAD_FLAG_NONE,
     sundae_gift_96_aead_encrypt,
-    sundae_gift_96_aead_decrypt
+    sundae_gift_96_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    sundae_gift_96_aead_encrypt_vec,
+    sundae_gift_96_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const sundae_gift_128_cipher = {
@@ -62,7 +95,18 @@ aead_cipher_t const sundae_gift_128_cipher = {
     SUNDAE_GIFT_TAG_SIZE,
     AEAD_FLAG_NONE,
     sundae_gift_128_aead_encrypt,
-    sundae_gift_128_aead_decrypt
+    sundae_gift_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    sundae_gift_128_aead_encrypt_vec,
+    sundae_gift_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /* Multiply a block value by 2 in the special byte field */
@@ -78,12 +122,15 @@ STATIC_INLINE void sundae_gift_multiply(unsigned char B[16])
     B[14] ^= B0;
 }
 
-/* Compute a MAC over the concatenation of two data buffers */
+/* Compute a MAC over the concatenation of a buffer and a packet segment
+ * list.  The segment list is read from the current cursor position. */
 static void sundae_gift_aead_mac
     (const gift128b_key_schedule_t *ks, unsigned char V[16],
      const unsigned char *data1, unsigned data1len,
-     const unsigned char *data2, unsigned long data2len)
+     aead_iovec_cursor_t *data2, unsigned long long data2len)
 {
+    unsigned char block[16];
+    const unsigned char *in;
     unsigned len;
 
     /* Nothing to do if the input is empty */
@@ -96,8 +143,8 @@ static void sundae_gift_aead_mac
     len = 16 - data1len;
     if (len > data2len)
         len = (unsigned)data2len;
-    lw_xor_block(V + data1len, data2, len);
-    data2 += len;
+    in = aead_iovec_load_block(data2, block, len);
+    lw_xor_block(V + data1len, in, len);
     data2len -= len;
     len += data1len;
 
@@ -107,8 +154,8 @@ static void sundae_gift_aead_mac
         len = 16;
         if (len > data2len)
             len = (unsigned)data2len;
-        lw_xor_block(V, data2, len);
-        data2 += len;
+        in = aead_iovec_load_block(data2, block, len);
+        lw_xor_block(V, in, len);
         data2len -= len;
     }
 
@@ -125,19 +172,29 @@ static void sundae_gift_aead_mac
 }
 
 static int sundae_gift_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub, unsigned npublen,
      const unsigned char *k, unsigned char domainsep)
 {
     gift128b_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
+    const unsigned char *in;
+    unsigned char inbuf[16];
     unsigned char V[16];
     unsigned char T[16];
     unsigned char P[16];
 
     /* Compute the length of the output ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SUNDAE_GIFT_TAG_SIZE))
+        return -2;
     *clen = mlen + SUNDAE_GIFT_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set the key schedule */
     gift128b_init(&ks, k);
@@ -152,10 +209,11 @@ static int sundae_gift_aead_encrypt
     gift128b_encrypt(&ks, T, V);
 
     /* Authenticate the nonce and the associated data */
-    sundae_gift_aead_mac(&ks, T, npub, npublen, ad, adlen);
+    sundae_gift_aead_mac(&ks, T, npub, npublen, &adcur, adlen);
 
     /* Authenticate the plaintext */
-    sundae_gift_aead_mac(&ks, T, 0, 0, m, mlen);
+    sundae_gift_aead_mac(&ks, T, 0, 0, &mcur, mlen);
+    aead_iovec_start(&mcur, m, m_count);
 
     /* Encrypt the plaintext to produce the ciphertext.  We need to be
      * careful how we manage the data because we could be doing in-place
@@ -166,62 +224,76 @@ static int sundae_gift_aead_encrypt
     memcpy(V, T, 16);
     while (mlen >= 16) {
         gift128b_encrypt(&ks, V, V);
-        lw_xor_block_2_src(P, V, m, 16);
-        memcpy(c, T, 16);
+        in = aead_iovec_load_block(&mcur, inbuf, 16);
+        lw_xor_block_2_src(P, V, in, 16);
+        aead_iovec_write(&ccur, T, 16);
         memcpy(T, P, 16);
-        c += 16;
-        m += 16;
         mlen -= 16;
     }
     if (mlen > 0) {
         unsigned leftover = (unsigned)mlen;
         gift128b_encrypt(&ks, V, V);
-        lw_xor_block(V, m, leftover);
-        memcpy(c, T, 16);
-        memcpy(c + 16, V, leftover);
+        in = aead_iovec_load_block(&mcur, inbuf, leftover);
+        lw_xor_block(V, in, leftover);
+        aead_iovec_write(&ccur, T, 16);
+        aead_iovec_write(&ccur, V, leftover);
     } else {
-        memcpy(c, T, 16);
+        aead_iovec_write(&ccur, T, 16);
     }
     return 0;
 }
 
 static int sundae_gift_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub, unsigned npublen,
      const unsigned char *k, unsigned char domainsep)
 {
     gift128b_key_schedule_t ks;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
+    const unsigned char *in;
+    unsigned char *out;
+    unsigned char inbuf[16];
+    unsigned char outbuf[16];
     unsigned char V[16];
     unsigned char T[16];
-    unsigned char *mtemp;
-    unsigned long len;
+    unsigned long long len;
 
     /* Bail out if the ciphertext is too short */
     if (clen < SUNDAE_GIFT_TAG_SIZE)
         return -1;
     len = *mlen = clen - SUNDAE_GIFT_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Set the key schedule */
     gift128b_init(&ks, k);
 
     /* Decrypt the ciphertext to produce the plaintext, using the
      * tag as the initialization vector for the decryption process */
-    memcpy(T, c, SUNDAE_GIFT_TAG_SIZE);
-    c += SUNDAE_GIFT_TAG_SIZE;
-    mtemp = m;
+    aead_iovec_read(&ccur, T, SUNDAE_GIFT_TAG_SIZE);
     memcpy(V, T, 16);
     while (len >= 16) {
         gift128b_encrypt(&ks, V, V);
-        lw_xor_block_2_src(mtemp, c, V, 16);
-        c += 16;
-        mtemp += 16;
+        in = aead_iovec_load_block(&ccur, inbuf, 16);
+        out = aead_iovec_store_begin(&mcur, outbuf, 16);
+        lw_xor_block_2_src(out, in, V, 16);
+        aead_iovec_store_end(&mcur, outbuf, out, 16);
         len -= 16;
     }
     if (len > 0) {
+        unsigned leftover = (unsigned)len;
         gift128b_encrypt(&ks, V, V);
-        lw_xor_block_2_src(mtemp, c, V, (unsigned)len);
+        in = aead_iovec_load_block(&ccur, inbuf, leftover);
+        out = aead_iovec_store_begin(&mcur, outbuf, leftover);
+        lw_xor_block_2_src(out, in, V, leftover);
+        aead_iovec_store_end(&mcur, outbuf, out, leftover);
     }
 
     /* Format and encrypt the initial domain separation block */
@@ -234,13 +306,42 @@ static int sundae_gift_aead_decrypt
     gift128b_encrypt(&ks, V, V);
 
     /* Authenticate the nonce and the associated data */
-    sundae_gift_aead_mac(&ks, V, npub, npublen, ad, adlen);
+    sundae_gift_aead_mac(&ks, V, npub, npublen, &adcur, adlen);
 
     /* Authenticate the plaintext */
-    sundae_gift_aead_mac(&ks, V, 0, 0, m, *mlen);
+    aead_iovec_start(&mcur, m, m_count);
+    sundae_gift_aead_mac(&ks, V, 0, 0, &mcur, *mlen);
 
     /* Check the authentication tag */
-    return aead_check_tag(m, *mlen, T, V, 16);
+    return aead_check_tag_vec(m, m_count, *mlen, T, V, 16);
+}
+
+int sundae_gift_0_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    (void)npub;
+    return sundae_gift_aead_encrypt
+        (c, c_count, clen, m, m_count, ad, ad_count, 0, 0, k, 0x00);
+}
+
+int sundae_gift_0_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    (void)npub;
+    return sundae_gift_aead_decrypt
+        (m, m_count, mlen, c, c_count, ad, ad_count, 0, 0, k, 0x00);
 }
 
 int sundae_gift_0_aead_encrypt
@@ -251,10 +352,12 @@ int sundae_gift_0_aead_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    (void)nsec;
-    (void)npub;
-    return sundae_gift_aead_encrypt
-        (c, clen, m, mlen, ad, adlen, 0, 0, k, 0x00);
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SUNDAE_GIFT_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_0_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
 }
 
 int sundae_gift_0_aead_decrypt
@@ -264,11 +367,42 @@ int sundae_gift_0_aead_decrypt
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SUNDAE_GIFT_TAG_SIZE ?
+                   clen - SUNDAE_GIFT_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_0_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int sundae_gift_64_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return sundae_gift_aead_encrypt
+        (c, c_count, clen, m, m_count, ad, ad_count,
+         npub, SUNDAE_GIFT_64_NONCE_SIZE, k, 0x90);
+}
+
+int sundae_gift_64_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     (void)nsec;
-    (void)npub;
     return sundae_gift_aead_decrypt
-        (m, mlen, c, clen, ad, adlen, 0, 0, k, 0x00);
+        (m, m_count, mlen, c, c_count, ad, ad_count,
+         npub, SUNDAE_GIFT_64_NONCE_SIZE, k, 0x90);
 }
 
 int sundae_gift_64_aead_encrypt
@@ -279,10 +413,12 @@ int sundae_gift_64_aead_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    (void)nsec;
-    return sundae_gift_aead_encrypt
-        (c, clen, m, mlen, ad, adlen,
-         npub, SUNDAE_GIFT_64_NONCE_SIZE, k, 0x90);
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SUNDAE_GIFT_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_64_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
 }
 
 int sundae_gift_64_aead_decrypt
@@ -292,11 +428,42 @@ int sundae_gift_64_aead_decrypt
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SUNDAE_GIFT_TAG_SIZE ?
+                   clen - SUNDAE_GIFT_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_64_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int sundae_gift_96_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return sundae_gift_aead_encrypt
+        (c, c_count, clen, m, m_count, ad, ad_count,
+         npub, SUNDAE_GIFT_96_NONCE_SIZE, k, 0xA0);
+}
+
+int sundae_gift_96_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     (void)nsec;
     return sundae_gift_aead_decrypt
-        (m, mlen, c, clen, ad, adlen,
-         npub, SUNDAE_GIFT_64_NONCE_SIZE, k, 0x90);
+        (m, m_count, mlen, c, c_count, ad, ad_count,
+         npub, SUNDAE_GIFT_96_NONCE_SIZE, k, 0xA0);
 }
 
 int sundae_gift_96_aead_encrypt
@@ -307,10 +474,12 @@ int sundae_gift_96_aead_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    (void)nsec;
-    return sundae_gift_aead_encrypt
-        (c, clen, m, mlen, ad, adlen,
-         npub, SUNDAE_GIFT_96_NONCE_SIZE, k, 0xA0);
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SUNDAE_GIFT_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_96_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
 }
 
 int sundae_gift_96_aead_decrypt
@@ -320,11 +489,42 @@ int sundae_gift_96_aead_decrypt
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SUNDAE_GIFT_TAG_SIZE ?
+                   clen - SUNDAE_GIFT_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_96_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int sundae_gift_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    (void)nsec;
+    return sundae_gift_aead_encrypt
+        (c, c_count, clen, m, m_count, ad, ad_count,
+         npub, SUNDAE_GIFT_128_NONCE_SIZE, k, 0xB0);
+}
+
+int sundae_gift_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     (void)nsec;
     return sundae_gift_aead_decrypt
-        (m, mlen, c, clen, ad, adlen,
-         npub, SUNDAE_GIFT_96_NONCE_SIZE, k, 0xA0);
+        (m, m_count, mlen, c, c_count, ad, ad_count,
+         npub, SUNDAE_GIFT_128_NONCE_SIZE, k, 0xB0);
 }
 
 int sundae_gift_128_aead_encrypt
@@ -335,10 +535,12 @@ int sundae_gift_128_aead_encrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    (void)nsec;
-    return sundae_gift_aead_encrypt
-        (c, clen, m, mlen, ad, adlen,
-         npub, SUNDAE_GIFT_128_NONCE_SIZE, k, 0xB0);
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SUNDAE_GIFT_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_128_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
 }
 
 int sundae_gift_128_aead_decrypt
@@ -349,8 +551,11 @@ int sundae_gift_128_aead_decrypt
      const unsigned char *npub,
      const unsigned char *k)
 {
-    (void)nsec;
-    return sundae_gift_aead_decrypt
-        (m, mlen, c, clen, ad, adlen,
-         npub, SUNDAE_GIFT_128_NONCE_SIZE, k, 0xB0);
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SUNDAE_GIFT_TAG_SIZE ?
+                   clen - SUNDAE_GIFT_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return sundae_gift_128_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
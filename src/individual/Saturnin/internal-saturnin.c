@@ -21,6 +21,7 @@
  */
 
 #include "internal-saturnin.h"
+#include "internal-cpu.h"
 
 #if !defined(__AVR__)
 
@@ -342,6 +343,7 @@ void saturnin_setup_key
 {
     int index;
     uint32_t temp;
+    aead_count_call(AEAD_PRIMITIVE_SATURNIN_SETUP_KEY);
     for (index = 0; index < 16; index += 2) {
         temp = saturnin_load_word32(key + index);
         ks->k[index / 2] = temp;
@@ -358,6 +360,8 @@ void saturnin_encrypt_block
     const uint32_t *rc = saturnin_rc + domain;
     uint32_t x0, x1, x2, x3, x4, x5, x6, x7, temp;
 
+    aead_count_call(AEAD_PRIMITIVE_SATURNIN_ENCRYPT);
+
     /* Load the input into local variables */
     x0 = saturnin_load_word32(input);
     x1 = saturnin_load_word32(input + 2);
@@ -423,6 +427,8 @@ void saturnin_decrypt_block
     const uint32_t *rc = saturnin_rc + domain + (rounds - 1) * 2;
     uint32_t x0, x1, x2, x3, x4, x5, x6, x7, temp;
 
+    aead_count_call(AEAD_PRIMITIVE_SATURNIN_DECRYPT);
+
     /* Load the input into local variables */
     x0 = saturnin_load_word32(input);
     x1 = saturnin_load_word32(input + 2);
@@ -480,4 +486,204 @@ void saturnin_decrypt_block
     saturnin_store_word32(output + 14, x7);
 }
 
-#endif /* !__AVR__ */
+/* Multi-lane kernels, instantiated from internal-saturnin-lanes.h for
+ * plain C and for each vector instruction set that we can target */
+#define SATURNIN_LANES_NAME _c
+#define SATURNIN_LANES_TARGET
+#define SATURNIN_LANES_TYPE uint32_t
+#define SATURNIN_LANES_WIDTH 1
+#define SATURNIN_LANES_LOAD(ptr) (*(ptr))
+#define SATURNIN_LANES_STORE(ptr, x) (*(ptr) = (x))
+#define SATURNIN_LANES_XOR(a, b) ((a) ^ (b))
+#define SATURNIN_LANES_AND(a, b) ((a) & (b))
+#define SATURNIN_LANES_OR(a, b) ((a) | (b))
+#define SATURNIN_LANES_SHL(a, bits) ((a) << (bits))
+#define SATURNIN_LANES_SHR(a, bits) ((a) >> (bits))
+#define SATURNIN_LANES_SWAP(a) (SWAP((a)))
+#define SATURNIN_LANES_SET1(value) ((uint32_t)(value))
+#include "internal-saturnin-lanes.h"
+
+#if defined(LW_CPU_HAVE_SSE2)
+#include <emmintrin.h>
+#define SATURNIN_LANES_NAME _sse2
+#define SATURNIN_LANES_TARGET LW_CPU_TARGET("sse2")
+#define SATURNIN_LANES_TYPE __m128i
+#define SATURNIN_LANES_WIDTH 4
+#define SATURNIN_LANES_LOAD(ptr) (_mm_loadu_si128((const __m128i *)(ptr)))
+#define SATURNIN_LANES_STORE(ptr, x) \
+    (_mm_storeu_si128((__m128i *)(ptr), (x)))
+#define SATURNIN_LANES_XOR _mm_xor_si128
+#define SATURNIN_LANES_AND _mm_and_si128
+#define SATURNIN_LANES_OR _mm_or_si128
+#define SATURNIN_LANES_SHL _mm_slli_epi32
+#define SATURNIN_LANES_SHR _mm_srli_epi32
+#define SATURNIN_LANES_SWAP(a) \
+    (_mm_shufflehi_epi16(_mm_shufflelo_epi16((a), 0xB1), 0xB1))
+#define SATURNIN_LANES_SET1(value) (_mm_set1_epi32((int)(value)))
+#include "internal-saturnin-lanes.h"
+#endif /* LW_CPU_HAVE_SSE2 */
+
+#if defined(LW_CPU_HAVE_AVX2)
+#include <immintrin.h>
+#define SATURNIN_LANES_NAME _avx2
+#define SATURNIN_LANES_TARGET LW_CPU_TARGET("avx2")
+#define SATURNIN_LANES_TYPE __m256i
+#define SATURNIN_LANES_WIDTH 8
+#define SATURNIN_LANES_LOAD(ptr) \
+    (_mm256_loadu_si256((const __m256i *)(ptr)))
+#define SATURNIN_LANES_STORE(ptr, x) \
+    (_mm256_storeu_si256((__m256i *)(ptr), (x)))
+#define SATURNIN_LANES_XOR _mm256_xor_si256
+#define SATURNIN_LANES_AND _mm256_and_si256
+#define SATURNIN_LANES_OR _mm256_or_si256
+#define SATURNIN_LANES_SHL _mm256_slli_epi32
+#define SATURNIN_LANES_SHR _mm256_srli_epi32
+#define SATURNIN_LANES_SWAP(a) \
+    (_mm256_shufflehi_epi16(_mm256_shufflelo_epi16((a), 0xB1), 0xB1))
+#define SATURNIN_LANES_SET1(value) (_mm256_set1_epi32((int)(value)))
+#include "internal-saturnin-lanes.h"
+#endif /* LW_CPU_HAVE_AVX2 */
+
+#if defined(LW_CPU_HAVE_AVX512F)
+#define SATURNIN_LANES_NAME _avx512
+#define SATURNIN_LANES_TARGET LW_CPU_TARGET("avx512f")
+#define SATURNIN_LANES_TYPE __m512i
+#define SATURNIN_LANES_WIDTH 16
+#define SATURNIN_LANES_LOAD(ptr) (_mm512_loadu_si512((ptr)))
+#define SATURNIN_LANES_STORE(ptr, x) (_mm512_storeu_si512((ptr), (x)))
+#define SATURNIN_LANES_XOR _mm512_xor_si512
+#define SATURNIN_LANES_AND _mm512_and_si512
+#define SATURNIN_LANES_OR _mm512_or_si512
+#define SATURNIN_LANES_SHL _mm512_slli_epi32
+#define SATURNIN_LANES_SHR _mm512_srli_epi32
+#define SATURNIN_LANES_SWAP(a) (_mm512_rol_epi32((a), 16))
+#define SATURNIN_LANES_SET1(value) (_mm512_set1_epi32((int)(value)))
+#include "internal-saturnin-lanes.h"
+#endif /* LW_CPU_HAVE_AVX512F */
+
+/**
+ * \brief Kernel for encrypting interleaved Saturnin blocks.
+ */
+typedef void (*saturnin_lanes_kernel_t)
+    (const uint32_t *k, const uint32_t *rc, unsigned rounds,
+     uint32_t *S, unsigned lanes);
+
+/**
+ * \brief Multi-lane kernel for a specific vector width.
+ */
+typedef struct
+{
+    unsigned width;                     /**< Number of lanes */
+    saturnin_lanes_kernel_t encrypt;    /**< Encryption kernel */
+
+} saturnin_lanes_t;
+
+static saturnin_lanes_t const saturnin_lanes_c = {
+    1, saturnin_encrypt_lanes_c
+};
+#if defined(LW_CPU_HAVE_SSE2)
+static saturnin_lanes_t const saturnin_lanes_sse2 = {
+    4, saturnin_encrypt_lanes_sse2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+static saturnin_lanes_t const saturnin_lanes_avx2 = {
+    8, saturnin_encrypt_lanes_avx2
+};
+#endif
+#if defined(LW_CPU_HAVE_AVX512F)
+static saturnin_lanes_t const saturnin_lanes_avx512 = {
+    16, saturnin_encrypt_lanes_avx512
+};
+#endif
+
+/**
+ * \brief Multi-lane kernel that has been bound for this CPU.
+ */
+static const saturnin_lanes_t *saturnin_lanes = 0;
+
+/**
+ * \brief Selects the widest multi-lane kernel for this CPU.
+ *
+ * \return The kernel to use.
+ */
+static const saturnin_lanes_t *saturnin_lanes_select(void)
+{
+    unsigned features = lw_cpu_features();
+#if defined(LW_CPU_HAVE_AVX512F)
+    if (features & LW_CPU_AVX512F)
+        return &saturnin_lanes_avx512;
+#endif
+#if defined(LW_CPU_HAVE_AVX2)
+    if (features & LW_CPU_AVX2)
+        return &saturnin_lanes_avx2;
+#endif
+#if defined(LW_CPU_HAVE_SSE2)
+    if (features & LW_CPU_SSE2)
+        return &saturnin_lanes_sse2;
+#endif
+    (void)features;
+    return &saturnin_lanes_c;
+}
+
+void saturnin_encrypt_blocks
+    (const saturnin_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count, unsigned domain)
+{
+    unsigned rounds = (domain >= SATURNIN_DOMAIN_16_7) ? 8 : 5;
+    const uint32_t *rc = saturnin_rc + domain;
+    uint32_t S[8 * SATURNIN_BLOCKS_MAX];
+    const saturnin_lanes_t *impl;
+    unsigned n, lanes, lane, word;
+
+    aead_count_calls(AEAD_PRIMITIVE_SATURNIN_ENCRYPT, count);
+
+    /* Bind the kernel for this CPU on first use */
+    impl = LW_CPU_LOAD(saturnin_lanes);
+    if (!impl) {
+        impl = saturnin_lanes_select();
+        LW_CPU_STORE(saturnin_lanes, impl);
+    }
+
+    /* Process the blocks in groups, padding the last group out to
+     * a whole number of vectors */
+    while (count > 0) {
+        n = count < SATURNIN_BLOCKS_MAX
+                ? (unsigned)count : SATURNIN_BLOCKS_MAX;
+        lanes = (n + impl->width - 1) / impl->width * impl->width;
+        for (lane = 0; lane < n; ++lane) {
+            for (word = 0; word < 8; ++word) {
+                S[word * lanes + lane] =
+                    saturnin_load_word32(input + lane * 32 + word * 2);
+            }
+        }
+        for (; lane < lanes; ++lane) {
+            for (word = 0; word < 8; ++word)
+                S[word * lanes + lane] = 0;
+        }
+        (*(impl->encrypt))(ks->k, rc, rounds, S, lanes);
+        for (lane = 0; lane < n; ++lane) {
+            for (word = 0; word < 8; ++word) {
+                saturnin_store_word32
+                    (output + lane * 32 + word * 2, S[word * lanes + lane]);
+            }
+        }
+        input += n * 32;
+        output += n * 32;
+        count -= n;
+    }
+}
+
+#else /* __AVR__ */
+
+/* The AVR version of the block cipher is in assembly code, so encrypt
+ * multiple blocks one at a time on top of that */
+void saturnin_encrypt_blocks
+    (const saturnin_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count, unsigned domain)
+{
+    for (; count > 0; --count, output += 32, input += 32)
+        saturnin_encrypt_block(ks, output, input, domain);
+}
+
+#endif /* __AVR__ */
@@ -130,6 +130,39 @@ void saturnin_decrypt_block
     (const saturnin_key_schedule_t *ks, unsigned char *output,
      const unsigned char *input, unsigned domain);
 
+/**
+ * \brief Maximum number of blocks that saturnin_encrypt_blocks()
+ * processes in one pass.
+ *
+ * Callers can pass any number of blocks, but passing a multiple of this
+ * value keeps all vector lanes busy.
+ */
+#if defined(__AVR__)
+#define SATURNIN_BLOCKS_MAX 1
+#else
+#define SATURNIN_BLOCKS_MAX 16
+#endif
+
+/**
+ * \brief Encrypts several 256-bit blocks with Saturnin in ECB mode.
+ *
+ * \param ks Points to the Saturnin key schedule.
+ * \param output Output buffer which must be at least 32 * count bytes.
+ * \param input Input buffer which must be at least 32 * count bytes.
+ * \param count Number of blocks to encrypt.
+ * \param domain Domain separator and round count indicator.
+ *
+ * The \a input and \a output buffers can be the same buffer for
+ * in-place encryption.
+ *
+ * The blocks are encrypted in parallel with the widest vector
+ * instructions that the CPU supports.  This is useful for generating
+ * the keystream for counter mode.
+ */
+void saturnin_encrypt_blocks
+    (const saturnin_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, size_t count, unsigned domain);
+
 #ifdef __cplusplus
 }
 #endif
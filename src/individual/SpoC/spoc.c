@@ -22,7 +22,7 @@
 
 #include "spoc.h"
 #include "internal-sliscp-light.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 /**
@@ -54,7 +54,18 @@ aead_cipher_t const spoc_128_cipher = {
     SPOC_128_TAG_SIZE,
     AEAD_FLAG_NONE,
     spoc_128_aead_encrypt,
-    spoc_128_aead_decrypt
+    spoc_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spoc_128_aead_encrypt_vec,
+    spoc_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const spoc_64_cipher = {
@@ -64,7 +75,18 @@ aead_cipher_t const spoc_64_cipher = {
     SPOC_64_TAG_SIZE,
     AEAD_FLAG_NONE,
     spoc_64_aead_encrypt,
-    spoc_64_aead_decrypt
+    spoc_64_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spoc_64_aead_encrypt_vec,
+    spoc_64_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /* Indices of where a rate byte is located to help with padding */
@@ -89,14 +111,16 @@ static unsigned char const spoc_64_mask_posn[8] = {
  * \param state sLiSCP-light-256 permutation state.
  * \param k Points to the 128-bit key.
  * \param npub Points to the 128-bit nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void spoc_128_init
     (unsigned char state[SPOC_128_STATE_SIZE],
      const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[SPOC_128_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Initialize the state by combining the key and nonce */
@@ -106,16 +130,17 @@ static void spoc_128_init
     /* Absorb the associated data into the state */
     if (adlen != 0) {
         while (adlen >= SPOC_128_RATE) {
+            in = aead_iovec_load_block(ad, block, SPOC_128_RATE);
             sliscp_light256_permute_spoc(state);
-            lw_xor_block(state + 16, ad, SPOC_128_RATE);
+            lw_xor_block(state + 16, in, SPOC_128_RATE);
             state[0] ^= 0x20; /* domain separation */
-            ad += SPOC_128_RATE;
             adlen -= SPOC_128_RATE;
         }
         temp = (unsigned)adlen;
         if (temp > 0) {
+            in = aead_iovec_load_block(ad, block, temp);
             sliscp_light256_permute_spoc(state);
-            lw_xor_block(state + 16, ad, temp);
+            lw_xor_block(state + 16, in, temp);
             state[temp + 16] ^= 0x80; /* padding */
             state[0] ^= 0x30; /* domain separation */
         }
@@ -128,14 +153,16 @@ static void spoc_128_init
  * \param state sLiSCP-light-192 permutation state.
  * \param k Points to the 128-bit key.
  * \param npub Points to the 128-bit nonce.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes.
  */
 static void spoc_64_init
     (unsigned char state[SPOC_64_STATE_SIZE],
      const unsigned char *k, const unsigned char *npub,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[SPOC_64_RATE];
+    const unsigned char *in;
     unsigned temp;
 
     /* Initialize the state by interleaving the key and nonce */
@@ -154,21 +181,22 @@ static void spoc_64_init
     /* Absorb the associated data into the state */
     if (adlen != 0) {
         while (adlen >= SPOC_64_RATE) {
+            in = aead_iovec_load_block(ad, block, SPOC_64_RATE);
             sliscp_light192_permute(state);
-            lw_xor_block(state + 6, ad, 4);
-            lw_xor_block(state + 18, ad + 4, 4);
+            lw_xor_block(state + 6, in, 4);
+            lw_xor_block(state + 18, in + 4, 4);
             state[0] ^= 0x20; /* domain separation */
-            ad += SPOC_64_RATE;
             adlen -= SPOC_64_RATE;
         }
         temp = (unsigned)adlen;
         if (temp > 0) {
+            in = aead_iovec_load_block(ad, block, temp);
             sliscp_light192_permute(state);
             state[spoc_64_mask_posn[temp]] ^= 0x80; /* padding */
             state[0] ^= 0x30; /* domain separation */
             while (temp > 0) {
                 --temp;
-                state[spoc_64_mask_posn[temp]] ^= ad[temp];
+                state[spoc_64_mask_posn[temp]] ^= in[temp];
             }
         }
     }
@@ -209,198 +237,330 @@ static void spoc_64_finalize
     memcpy(tag + 4, state + 18, 4);
 }
 
-int spoc_128_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int spoc_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[SPOC_128_STATE_SIZE];
+    unsigned char inbuf[SPOC_128_RATE];
+    unsigned char outbuf[SPOC_128_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPOC_128_TAG_SIZE))
+        return -2;
     *clen = mlen + SPOC_128_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the SpoC-128 state and absorb the associated data */
-    spoc_128_init(state, k, npub, ad, adlen);
+    spoc_128_init(state, k, npub, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen != 0) {
         while (mlen >= SPOC_128_RATE) {
+            in = aead_iovec_load_block(&mcur, inbuf, SPOC_128_RATE);
+            out = aead_iovec_store_begin(&ccur, outbuf, SPOC_128_RATE);
             sliscp_light256_permute_spoc(state);
-            lw_xor_block(state + 16, m, SPOC_128_RATE);
-            lw_xor_block_2_src(c, m, state, SPOC_128_RATE);
+            lw_xor_block(state + 16, in, SPOC_128_RATE);
+            lw_xor_block_2_src(out, in, state, SPOC_128_RATE);
             state[0] ^= 0x40; /* domain separation */
-            c += SPOC_128_RATE;
-            m += SPOC_128_RATE;
+            aead_iovec_store_end(&ccur, outbuf, out, SPOC_128_RATE);
             mlen -= SPOC_128_RATE;
         }
         if (mlen != 0) {
             unsigned temp = (unsigned)mlen;
+            in = aead_iovec_load_block(&mcur, inbuf, temp);
+            out = aead_iovec_store_begin(&ccur, outbuf, temp);
             sliscp_light256_permute_spoc(state);
-            lw_xor_block(state + 16, m, temp);
-            lw_xor_block_2_src(c, m, state, temp);
+            lw_xor_block(state + 16, in, temp);
+            lw_xor_block_2_src(out, in, state, temp);
             state[temp + 16] ^= 0x80; /* padding */
             state[0] ^= 0x50; /* domain separation */
-            c += mlen;
+            aead_iovec_store_end(&ccur, outbuf, out, (size_t)mlen);
         }
     }
 
     /* Finalize and generate the authentication tag */
-    spoc_128_finalize(state, c);
+    spoc_128_finalize(state, state);
+    aead_iovec_write(&ccur, state, SPOC_128_TAG_SIZE);
     return 0;
 }
 
-int spoc_128_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spoc_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[SPOC_128_STATE_SIZE];
-    unsigned char *mtemp = m;
+    unsigned char tag[SPOC_128_TAG_SIZE];
+    unsigned char inbuf[SPOC_128_RATE];
+    unsigned char outbuf[SPOC_128_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPOC_128_TAG_SIZE)
         return -1;
     *mlen = clen - SPOC_128_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Spoc-128 state and absorb the associated data */
-    spoc_128_init(state, k, npub, ad, adlen);
+    spoc_128_init(state, k, npub, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPOC_128_TAG_SIZE;
     if (clen != 0) {
         while (clen >= SPOC_128_RATE) {
+            in = aead_iovec_load_block(&ccur, inbuf, SPOC_128_RATE);
+            out = aead_iovec_store_begin(&mcur, outbuf, SPOC_128_RATE);
             sliscp_light256_permute_spoc(state);
-            lw_xor_block_2_src(m, c, state, SPOC_128_RATE);
-            lw_xor_block(state + 16, m, SPOC_128_RATE);
+            lw_xor_block_2_src(out, in, state, SPOC_128_RATE);
+            lw_xor_block(state + 16, out, SPOC_128_RATE);
             state[0] ^= 0x40; /* domain separation */
-            c += SPOC_128_RATE;
-            m += SPOC_128_RATE;
+            aead_iovec_store_end(&mcur, outbuf, out, SPOC_128_RATE);
             clen -= SPOC_128_RATE;
         }
         if (clen != 0) {
             unsigned temp = (unsigned)clen;
+            in = aead_iovec_load_block(&ccur, inbuf, temp);
+            out = aead_iovec_store_begin(&mcur, outbuf, temp);
             sliscp_light256_permute_spoc(state);
-            lw_xor_block_2_src(m, c, state, temp);
-            lw_xor_block(state + 16, m, temp);
+            lw_xor_block_2_src(out, in, state, temp);
+            lw_xor_block(state + 16, out, temp);
             state[temp + 16] ^= 0x80; /* padding */
             state[0] ^= 0x50; /* domain separation */
-            c += clen;
+            aead_iovec_store_end(&mcur, outbuf, out, (size_t)clen);
         }
     }
 
     /* Finalize and check the authentication tag */
     spoc_128_finalize(state, state);
-    return aead_check_tag(mtemp, *mlen, state, c, SPOC_128_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPOC_128_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, state, tag, SPOC_128_TAG_SIZE);
 }
 
-int spoc_64_aead_encrypt
+int spoc_128_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPOC_128_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spoc_128_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spoc_128_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPOC_128_TAG_SIZE ?
+                   clen - SPOC_128_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spoc_128_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int spoc_64_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     unsigned char state[SPOC_64_STATE_SIZE];
+    unsigned char inbuf[SPOC_64_RATE];
+    unsigned char outbuf[SPOC_64_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPOC_64_TAG_SIZE))
+        return -2;
     *clen = mlen + SPOC_64_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the SpoC-64 state and absorb the associated data */
-    spoc_64_init(state, k, npub, ad, adlen);
+    spoc_64_init(state, k, npub, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen != 0) {
         while (mlen >= SPOC_64_RATE) {
+            in = aead_iovec_load_block(&mcur, inbuf, SPOC_64_RATE);
+            out = aead_iovec_store_begin(&ccur, outbuf, SPOC_64_RATE);
             sliscp_light192_permute(state);
-            lw_xor_block(state + 6, m, 4);
-            lw_xor_block(state + 18, m + 4, 4);
-            lw_xor_block_2_src(c, m, state, 4);
-            lw_xor_block_2_src(c + 4, m + 4, state + 12, 4);
+            lw_xor_block(state + 6, in, 4);
+            lw_xor_block(state + 18, in + 4, 4);
+            lw_xor_block_2_src(out, in, state, 4);
+            lw_xor_block_2_src(out + 4, in + 4, state + 12, 4);
             state[0] ^= 0x40; /* domain separation */
-            c += SPOC_64_RATE;
-            m += SPOC_64_RATE;
+            aead_iovec_store_end(&ccur, outbuf, out, SPOC_64_RATE);
             mlen -= SPOC_64_RATE;
         }
         if (mlen != 0) {
             unsigned temp = (unsigned)mlen;
+            in = aead_iovec_load_block(&mcur, inbuf, temp);
+            out = aead_iovec_store_begin(&ccur, outbuf, temp);
             sliscp_light192_permute(state);
             state[spoc_64_mask_posn[temp]] ^= 0x80; /* padding */
             while (temp > 0) {
                 --temp;
-                unsigned char mbyte = m[temp];
+                unsigned char mbyte = in[temp];
                 state[spoc_64_mask_posn[temp]] ^= mbyte;
-                c[temp] = mbyte ^ state[spoc_64_rate_posn[temp]];
+                out[temp] = mbyte ^ state[spoc_64_rate_posn[temp]];
             }
             state[0] ^= 0x50; /* domain separation */
-            c += mlen;
+            aead_iovec_store_end(&ccur, outbuf, out, (size_t)mlen);
         }
     }
 
     /* Finalize and generate the authentication tag */
-    spoc_64_finalize(state, c);
+    spoc_64_finalize(state, state);
+    aead_iovec_write(&ccur, state, SPOC_64_TAG_SIZE);
     return 0;
 }
 
-int spoc_64_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spoc_64_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     unsigned char state[SPOC_64_STATE_SIZE];
-    unsigned char *mtemp = m;
+    unsigned char tag[SPOC_64_TAG_SIZE];
+    unsigned char inbuf[SPOC_64_RATE];
+    unsigned char outbuf[SPOC_64_RATE];
+    const unsigned char *in;
+    unsigned char *out;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPOC_64_TAG_SIZE)
         return -1;
     *mlen = clen - SPOC_64_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Spoc-64 state and absorb the associated data */
-    spoc_64_init(state, k, npub, ad, adlen);
+    spoc_64_init(state, k, npub, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPOC_64_TAG_SIZE;
     if (clen != 0) {
         while (clen >= SPOC_64_RATE) {
+            in = aead_iovec_load_block(&ccur, inbuf, SPOC_64_RATE);
+            out = aead_iovec_store_begin(&mcur, outbuf, SPOC_64_RATE);
             sliscp_light192_permute(state);
-            lw_xor_block_2_src(m, c, state, 4);
-            lw_xor_block_2_src(m + 4, c + 4, state + 12, 4);
-            lw_xor_block(state + 6, m, 4);
-            lw_xor_block(state + 18, m + 4, 4);
+            lw_xor_block_2_src(out, in, state, 4);
+            lw_xor_block_2_src(out + 4, in + 4, state + 12, 4);
+            lw_xor_block(state + 6, out, 4);
+            lw_xor_block(state + 18, out + 4, 4);
             state[0] ^= 0x40; /* domain separation */
-            c += SPOC_64_RATE;
-            m += SPOC_64_RATE;
+            aead_iovec_store_end(&mcur, outbuf, out, SPOC_64_RATE);
             clen -= SPOC_64_RATE;
         }
         if (clen != 0) {
             unsigned temp = (unsigned)clen;
+            in = aead_iovec_load_block(&ccur, inbuf, temp);
+            out = aead_iovec_store_begin(&mcur, outbuf, temp);
             sliscp_light192_permute(state);
             state[spoc_64_mask_posn[temp]] ^= 0x80; /* padding */
             while (temp > 0) {
                 --temp;
-                unsigned char mbyte = c[temp] ^ state[spoc_64_rate_posn[temp]];
+                unsigned char mbyte =
+                    in[temp] ^ state[spoc_64_rate_posn[temp]];
                 state[spoc_64_mask_posn[temp]] ^= mbyte;
-                m[temp] = mbyte;
+                out[temp] = mbyte;
             }
             state[0] ^= 0x50; /* domain separation */
-            c += clen;
+            aead_iovec_store_end(&mcur, outbuf, out, (size_t)clen);
         }
     }
 
     /* Finalize and check the authentication tag */
     spoc_64_finalize(state, state);
-    return aead_check_tag(mtemp, *mlen, state, c, SPOC_64_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPOC_64_TAG_SIZE);
+    return aead_check_tag_vec(m, m_count, *mlen, state, tag, SPOC_64_TAG_SIZE);
+}
+
+int spoc_64_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPOC_64_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spoc_64_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spoc_64_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPOC_64_TAG_SIZE ?
+                   clen - SPOC_64_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spoc_64_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
@@ -55,6 +55,8 @@ void clyde128_encrypt(const unsigned char key[CLYDE128_KEY_SIZE],
     uint32_t c, d;
     int step;
 
+    aead_count_call(AEAD_PRIMITIVE_CLYDE128_ENCRYPT);
+
     /* Unpack the key, tweak, and state */
     k0 = le_load_word32(key);
     k1 = le_load_word32(key + 4);
@@ -166,6 +168,8 @@ void clyde128_decrypt(const unsigned char key[CLYDE128_KEY_SIZE],
     uint32_t a, b, d;
     int step;
 
+    aead_count_call(AEAD_PRIMITIVE_CLYDE128_DECRYPT);
+
     /* Unpack the key, tweak, and state */
     k0 = le_load_word32(key);
     k1 = le_load_word32(key + 4);
@@ -274,6 +278,8 @@ void shadow512(shadow512_state_t *state)
     uint32_t c, d, w, x, y, z;
     int step;
 
+    aead_count_call(AEAD_PRIMITIVE_SHADOW512);
+
     /* Unpack the state into local variables */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     s00 = state->W[0];
@@ -437,6 +443,8 @@ void shadow384(shadow384_state_t *state)
     uint32_t c, d, x, y, z;
     int step;
 
+    aead_count_call(AEAD_PRIMITIVE_SHADOW384);
+
     /* Unpack the state into local variables */
 #if defined(LW_UTIL_LITTLE_ENDIAN)
     s00 = state->W[0];
@@ -22,7 +22,7 @@
 
 #include "spook.h"
 #include "internal-spook.h"
-#include "internal-util.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const spook_128_512_su_cipher = {
@@ -32,7 +32,18 @@ aead_cipher_t const spook_128_512_su_cipher = {
     SPOOK_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     spook_128_512_su_aead_encrypt,
-    spook_128_512_su_aead_decrypt
+    spook_128_512_su_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spook_128_512_su_aead_encrypt_vec,
+    spook_128_512_su_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const spook_128_384_su_cipher = {
@@ -42,7 +53,18 @@ aead_cipher_t const spook_128_384_su_cipher = {
     SPOOK_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     spook_128_384_su_aead_encrypt,
-    spook_128_384_su_aead_decrypt
+    spook_128_384_su_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spook_128_384_su_aead_encrypt_vec,
+    spook_128_384_su_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const spook_128_512_mu_cipher = {
@@ -52,7 +74,18 @@ aead_cipher_t const spook_128_512_mu_cipher = {
     SPOOK_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     spook_128_512_mu_aead_encrypt,
-    spook_128_512_mu_aead_decrypt
+    spook_128_512_mu_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spook_128_512_mu_aead_encrypt_vec,
+    spook_128_512_mu_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const spook_128_384_mu_cipher = {
@@ -62,7 +95,18 @@ aead_cipher_t const spook_128_384_mu_cipher = {
     SPOOK_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     spook_128_384_mu_aead_encrypt,
-    spook_128_384_mu_aead_decrypt
+    spook_128_384_mu_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    spook_128_384_mu_aead_encrypt_vec,
+    spook_128_384_mu_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -119,22 +163,25 @@ static void spook_128_384_init
  * \brief Absorbs associated data into the Shadow-512 sponge state.
  *
  * \param state The sponge state.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes, must be non-zero.
  */
 static void spook_128_512_absorb
     (shadow512_state_t *state,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[SHADOW512_RATE];
+    const unsigned char *in;
     while (adlen >= SHADOW512_RATE) {
-        lw_xor_block(state->B, ad, SHADOW512_RATE);
+        in = aead_iovec_load_block(ad, block, SHADOW512_RATE);
+        lw_xor_block(state->B, in, SHADOW512_RATE);
         shadow512(state);
-        ad += SHADOW512_RATE;
         adlen -= SHADOW512_RATE;
     }
     if (adlen > 0) {
         unsigned temp = (unsigned)adlen;
-        lw_xor_block(state->B, ad, temp);
+        in = aead_iovec_load_block(ad, block, temp);
+        lw_xor_block(state->B, in, temp);
         state->B[temp] ^= 0x01;
         state->B[SHADOW512_RATE] ^= 0x02;
         shadow512(state);
@@ -145,22 +192,25 @@ static void spook_128_512_absorb
  * \brief Absorbs associated data into the Shadow-384 sponge state.
  *
  * \param state The sponge state.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data.
  * \param adlen Length of the associated data in bytes, must be non-zero.
  */
 static void spook_128_384_absorb
     (shadow384_state_t *state,
-     const unsigned char *ad, unsigned long long adlen)
+     aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[SHADOW384_RATE];
+    const unsigned char *in;
     while (adlen >= SHADOW384_RATE) {
-        lw_xor_block(state->B, ad, SHADOW384_RATE);
+        in = aead_iovec_load_block(ad, block, SHADOW384_RATE);
+        lw_xor_block(state->B, in, SHADOW384_RATE);
         shadow384(state);
-        ad += SHADOW384_RATE;
         adlen -= SHADOW384_RATE;
     }
     if (adlen > 0) {
         unsigned temp = (unsigned)adlen;
-        lw_xor_block(state->B, ad, temp);
+        in = aead_iovec_load_block(ad, block, temp);
+        lw_xor_block(state->B, in, temp);
         state->B[temp] ^= 0x01;
         state->B[SHADOW384_RATE] ^= 0x02;
         shadow384(state);
@@ -171,25 +221,33 @@ static void spook_128_384_absorb
  * \brief Encrypts the plaintext with the Shadow-512 sponge state.
  *
  * \param state The sponge state.
- * \param c Points to the ciphertext output buffer.
- * \param m Points to the plaintext input buffer.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Number of bytes of plaintext to be encrypted.
  */
 static void spook_128_512_encrypt
-    (shadow512_state_t *state, unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+    (shadow512_state_t *state, aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char inbuf[SHADOW512_RATE];
+    unsigned char outbuf[SHADOW512_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     state->B[SHADOW512_RATE] ^= 0x01;
     while (mlen >= SHADOW512_RATE) {
-        lw_xor_block_2_dest(c, state->B, m, SHADOW512_RATE);
+        in = aead_iovec_load_block(m, inbuf, SHADOW512_RATE);
+        out = aead_iovec_store_begin(c, outbuf, SHADOW512_RATE);
+        lw_xor_block_2_dest(out, state->B, in, SHADOW512_RATE);
+        aead_iovec_store_end(c, outbuf, out, SHADOW512_RATE);
         shadow512(state);
-        c += SHADOW512_RATE;
-        m += SHADOW512_RATE;
         mlen -= SHADOW512_RATE;
     }
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
-        lw_xor_block_2_dest(c, state->B, m, temp);
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
+        lw_xor_block_2_dest(out, state->B, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
         state->B[temp] ^= 0x01;
         state->B[SHADOW512_RATE] ^= 0x02;
         shadow512(state);
@@ -200,25 +258,33 @@ static void spook_128_512_encrypt
  * \brief Encrypts the plaintext with the Shadow-384 sponge state.
  *
  * \param state The sponge state.
- * \param c Points to the ciphertext output buffer.
- * \param m Points to the plaintext input buffer.
+ * \param c Cursor for the ciphertext output.
+ * \param m Cursor for the plaintext input.
  * \param mlen Number of bytes of plaintext to be encrypted.
  */
 static void spook_128_384_encrypt
-    (shadow384_state_t *state, unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+    (shadow384_state_t *state, aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char inbuf[SHADOW384_RATE];
+    unsigned char outbuf[SHADOW384_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     state->B[SHADOW384_RATE] ^= 0x01;
     while (mlen >= SHADOW384_RATE) {
-        lw_xor_block_2_dest(c, state->B, m, SHADOW384_RATE);
+        in = aead_iovec_load_block(m, inbuf, SHADOW384_RATE);
+        out = aead_iovec_store_begin(c, outbuf, SHADOW384_RATE);
+        lw_xor_block_2_dest(out, state->B, in, SHADOW384_RATE);
+        aead_iovec_store_end(c, outbuf, out, SHADOW384_RATE);
         shadow384(state);
-        c += SHADOW384_RATE;
-        m += SHADOW384_RATE;
         mlen -= SHADOW384_RATE;
     }
     if (mlen > 0) {
         unsigned temp = (unsigned)mlen;
-        lw_xor_block_2_dest(c, state->B, m, temp);
+        in = aead_iovec_load_block(m, inbuf, temp);
+        out = aead_iovec_store_begin(c, outbuf, temp);
+        lw_xor_block_2_dest(out, state->B, in, temp);
+        aead_iovec_store_end(c, outbuf, out, temp);
         state->B[temp] ^= 0x01;
         state->B[SHADOW384_RATE] ^= 0x02;
         shadow384(state);
@@ -229,25 +295,33 @@ static void spook_128_384_encrypt
  * \brief Decrypts the ciphertext with the Shadow-512 sponge state.
  *
  * \param state The sponge state.
- * \param m Points to the plaintext output buffer.
- * \param c Points to the ciphertext input buffer.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param clen Number of bytes of ciphertext to be decrypted.
  */
 static void spook_128_512_decrypt
-    (shadow512_state_t *state, unsigned char *m,
-     const unsigned char *c, unsigned long long clen)
+    (shadow512_state_t *state, aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long clen)
 {
+    unsigned char inbuf[SHADOW512_RATE];
+    unsigned char outbuf[SHADOW512_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     state->B[SHADOW512_RATE] ^= 0x01;
     while (clen >= SHADOW512_RATE) {
-        lw_xor_block_swap(m, state->B, c, SHADOW512_RATE);
+        in = aead_iovec_load_block(c, inbuf, SHADOW512_RATE);
+        out = aead_iovec_store_begin(m, outbuf, SHADOW512_RATE);
+        lw_xor_block_swap(out, state->B, in, SHADOW512_RATE);
+        aead_iovec_store_end(m, outbuf, out, SHADOW512_RATE);
         shadow512(state);
-        c += SHADOW512_RATE;
-        m += SHADOW512_RATE;
         clen -= SHADOW512_RATE;
     }
     if (clen > 0) {
         unsigned temp = (unsigned)clen;
-        lw_xor_block_swap(m, state->B, c, temp);
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
+        lw_xor_block_swap(out, state->B, in, temp);
+        aead_iovec_store_end(m, outbuf, out, temp);
         state->B[temp] ^= 0x01;
         state->B[SHADOW512_RATE] ^= 0x02;
         shadow512(state);
@@ -258,295 +332,511 @@ static void spook_128_512_decrypt
  * \brief Decrypts the ciphertext with the Shadow-384 sponge state.
  *
  * \param state The sponge state.
- * \param m Points to the plaintext output buffer.
- * \param c Points to the ciphertext input buffer.
+ * \param m Cursor for the plaintext output.
+ * \param c Cursor for the ciphertext input.
  * \param clen Number of bytes of ciphertext to be decrypted.
  */
 static void spook_128_384_decrypt
-    (shadow384_state_t *state, unsigned char *m,
-     const unsigned char *c, unsigned long long clen)
+    (shadow384_state_t *state, aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long clen)
 {
+    unsigned char inbuf[SHADOW384_RATE];
+    unsigned char outbuf[SHADOW384_RATE];
+    const unsigned char *in;
+    unsigned char *out;
     state->B[SHADOW384_RATE] ^= 0x01;
     while (clen >= SHADOW384_RATE) {
-        lw_xor_block_swap(m, state->B, c, SHADOW384_RATE);
+        in = aead_iovec_load_block(c, inbuf, SHADOW384_RATE);
+        out = aead_iovec_store_begin(m, outbuf, SHADOW384_RATE);
+        lw_xor_block_swap(out, state->B, in, SHADOW384_RATE);
+        aead_iovec_store_end(m, outbuf, out, SHADOW384_RATE);
         shadow384(state);
-        c += SHADOW384_RATE;
-        m += SHADOW384_RATE;
         clen -= SHADOW384_RATE;
     }
     if (clen > 0) {
         unsigned temp = (unsigned)clen;
-        lw_xor_block_swap(m, state->B, c, temp);
+        in = aead_iovec_load_block(c, inbuf, temp);
+        out = aead_iovec_store_begin(m, outbuf, temp);
+        lw_xor_block_swap(out, state->B, in, temp);
+        aead_iovec_store_end(m, outbuf, out, temp);
         state->B[temp] ^= 0x01;
         state->B[SHADOW384_RATE] ^= 0x02;
         shadow384(state);
     }
 }
 
-int spook_128_512_su_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int spook_128_512_su_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     shadow512_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPOOK_TAG_SIZE))
+        return -2;
     *clen = mlen + SPOOK_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-512 sponge state */
     spook_128_512_init(&state, k, SPOOK_SU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_512_absorb(&state, ad, adlen);
+        spook_128_512_absorb(&state, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        spook_128_512_encrypt(&state, c, m, mlen);
+        spook_128_512_encrypt(&state, &ccur, &mcur, mlen);
 
     /* Compute the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
     clyde128_encrypt(k, state.W, state.W, state.W + 4);
-    memcpy(c + mlen, state.B, SPOOK_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, SPOOK_TAG_SIZE);
     return 0;
 }
 
-int spook_128_512_su_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spook_128_512_su_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     shadow512_state_t state;
+    unsigned char tag[SPOOK_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPOOK_TAG_SIZE)
         return -1;
     *mlen = clen - SPOOK_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-512 sponge state */
     spook_128_512_init(&state, k, SPOOK_SU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_512_absorb(&state, ad, adlen);
+        spook_128_512_absorb(&state, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPOOK_TAG_SIZE;
     if (clen > 0)
-        spook_128_512_decrypt(&state, m, c, clen);
+        spook_128_512_decrypt(&state, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
-    clyde128_decrypt(k, state.W + 4, c + clen, state.W + 4);
-    return aead_check_tag
-        (m, clen, state.B, state.B + CLYDE128_BLOCK_SIZE, SPOOK_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPOOK_TAG_SIZE);
+    clyde128_decrypt(k, state.W + 4, tag, state.W + 4);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, state.B + CLYDE128_BLOCK_SIZE,
+         SPOOK_TAG_SIZE);
 }
 
-int spook_128_384_su_aead_encrypt
+int spook_128_512_su_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPOOK_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_512_su_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spook_128_512_su_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPOOK_TAG_SIZE ?
+                   clen - SPOOK_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_512_su_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int spook_128_384_su_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     shadow384_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPOOK_TAG_SIZE))
+        return -2;
     *clen = mlen + SPOOK_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-384 sponge state */
     spook_128_384_init(&state, k, SPOOK_SU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_384_absorb(&state, ad, adlen);
+        spook_128_384_absorb(&state, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        spook_128_384_encrypt(&state, c, m, mlen);
+        spook_128_384_encrypt(&state, &ccur, &mcur, mlen);
 
     /* Compute the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
     clyde128_encrypt(k, state.W, state.W, state.W + 4);
-    memcpy(c + mlen, state.B, SPOOK_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, SPOOK_TAG_SIZE);
     return 0;
 }
 
-int spook_128_384_su_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spook_128_384_su_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     shadow384_state_t state;
+    unsigned char tag[SPOOK_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPOOK_TAG_SIZE)
         return -1;
     *mlen = clen - SPOOK_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-384 sponge state */
     spook_128_384_init(&state, k, SPOOK_SU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_384_absorb(&state, ad, adlen);
+        spook_128_384_absorb(&state, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPOOK_TAG_SIZE;
     if (clen > 0)
-        spook_128_384_decrypt(&state, m, c, clen);
+        spook_128_384_decrypt(&state, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
-    clyde128_decrypt(k, state.W + 4, c + clen, state.W + 4);
-    return aead_check_tag
-        (m, clen, state.B, state.B + CLYDE128_BLOCK_SIZE, SPOOK_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPOOK_TAG_SIZE);
+    clyde128_decrypt(k, state.W + 4, tag, state.W + 4);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, state.B + CLYDE128_BLOCK_SIZE,
+         SPOOK_TAG_SIZE);
 }
 
-int spook_128_512_mu_aead_encrypt
+int spook_128_384_su_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPOOK_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_384_su_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spook_128_384_su_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPOOK_TAG_SIZE ?
+                   clen - SPOOK_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_384_su_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int spook_128_512_mu_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     shadow512_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPOOK_TAG_SIZE))
+        return -2;
     *clen = mlen + SPOOK_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-512 sponge state */
     spook_128_512_init(&state, k, SPOOK_MU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_512_absorb(&state, ad, adlen);
+        spook_128_512_absorb(&state, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        spook_128_512_encrypt(&state, c, m, mlen);
+        spook_128_512_encrypt(&state, &ccur, &mcur, mlen);
 
     /* Compute the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
     clyde128_encrypt(k, state.W, state.W, state.W + 4);
-    memcpy(c + mlen, state.B, SPOOK_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, SPOOK_TAG_SIZE);
     return 0;
 }
 
-int spook_128_512_mu_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spook_128_512_mu_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     shadow512_state_t state;
+    unsigned char tag[SPOOK_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPOOK_TAG_SIZE)
         return -1;
     *mlen = clen - SPOOK_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-512 sponge state */
     spook_128_512_init(&state, k, SPOOK_MU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_512_absorb(&state, ad, adlen);
+        spook_128_512_absorb(&state, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPOOK_TAG_SIZE;
     if (clen > 0)
-        spook_128_512_decrypt(&state, m, c, clen);
+        spook_128_512_decrypt(&state, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
-    clyde128_decrypt(k, state.W + 4, c + clen, state.W + 4);
-    return aead_check_tag
-        (m, clen, state.B, state.B + CLYDE128_BLOCK_SIZE, SPOOK_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPOOK_TAG_SIZE);
+    clyde128_decrypt(k, state.W + 4, tag, state.W + 4);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, state.B + CLYDE128_BLOCK_SIZE,
+         SPOOK_TAG_SIZE);
 }
 
-int spook_128_384_mu_aead_encrypt
+int spook_128_512_mu_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPOOK_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_512_mu_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spook_128_512_mu_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPOOK_TAG_SIZE ?
+                   clen - SPOOK_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_512_mu_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int spook_128_384_mu_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     shadow384_state_t state;
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + SPOOK_TAG_SIZE))
+        return -2;
     *clen = mlen + SPOOK_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-384 sponge state */
     spook_128_384_init(&state, k, SPOOK_MU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_384_absorb(&state, ad, adlen);
+        spook_128_384_absorb(&state, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
     if (mlen > 0)
-        spook_128_384_encrypt(&state, c, m, mlen);
+        spook_128_384_encrypt(&state, &ccur, &mcur, mlen);
 
     /* Compute the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
     clyde128_encrypt(k, state.W, state.W, state.W + 4);
-    memcpy(c + mlen, state.B, SPOOK_TAG_SIZE);
+    aead_iovec_write(&ccur, state.B, SPOOK_TAG_SIZE);
     return 0;
 }
 
-int spook_128_384_mu_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int spook_128_384_mu_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     shadow384_state_t state;
+    unsigned char tag[SPOOK_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < SPOOK_TAG_SIZE)
         return -1;
     *mlen = clen - SPOOK_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Initialize the Shadow-384 sponge state */
     spook_128_384_init(&state, k, SPOOK_MU_KEY_SIZE, npub);
 
     /* Process the associated data */
     if (adlen > 0)
-        spook_128_384_absorb(&state, ad, adlen);
+        spook_128_384_absorb(&state, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
     clen -= SPOOK_TAG_SIZE;
     if (clen > 0)
-        spook_128_384_decrypt(&state, m, c, clen);
+        spook_128_384_decrypt(&state, &mcur, &ccur, clen);
 
     /* Check the authentication tag */
     state.B[CLYDE128_BLOCK_SIZE * 2 - 1] |= 0x80;
-    clyde128_decrypt(k, state.W + 4, c + clen, state.W + 4);
-    return aead_check_tag
-        (m, clen, state.B, state.B + CLYDE128_BLOCK_SIZE, SPOOK_TAG_SIZE);
+    aead_iovec_read(&ccur, tag, SPOOK_TAG_SIZE);
+    clyde128_decrypt(k, state.W + 4, tag, state.W + 4);
+    return aead_check_tag_vec
+        (m, m_count, clen, state.B, state.B + CLYDE128_BLOCK_SIZE,
+         SPOOK_TAG_SIZE);
+}
+
+int spook_128_384_mu_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + SPOOK_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_384_mu_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int spook_128_384_mu_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= SPOOK_TAG_SIZE ?
+                   clen - SPOOK_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return spook_128_384_mu_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
@@ -30,6 +30,8 @@ void subterranean_round(subterranean_state_t *state)
     uint32_t x0, x1, x2, x3, x4, x5, x6, x7, x8;
     uint32_t t0, t1;
 
+    aead_count_call(AEAD_PRIMITIVE_SUBTERRANEAN_ROUND);
+
     /* Load the state up into local variables */
     x0 = state->x[0];
     x1 = state->x[1];
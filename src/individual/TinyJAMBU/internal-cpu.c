@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "internal-cpu.h"
+
+#if defined(LW_CPU_DISPATCH)
+
+#include <cpuid.h>
+
+/**
+ * \brief Marks the cached feature value as valid, even if it has no
+ * other bits set.
+ */
+#define LW_CPU_DETECTED 0x80000000U
+
+/**
+ * \brief Cached CPU features, or zero if not detected yet.
+ */
+static unsigned lw_cpu_cached_features = 0;
+
+/**
+ * \brief Reads an extended control register to determine which vector
+ * register states the operating system saves on context switches.
+ *
+ * \param index Index of the register to read.
+ *
+ * \return The low 32 bits of the register.
+ */
+static unsigned lw_cpu_xgetbv(unsigned index)
+{
+    unsigned eax, edx;
+    __asm__ __volatile__ ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(index));
+    return eax;
+}
+
+/**
+ * \brief Detects the features of the CPU with CPUID.
+ *
+ * \return The feature bitmask.
+ */
+static unsigned lw_cpu_detect(void)
+{
+    unsigned eax, ebx, ecx, edx;
+    unsigned features = 0;
+    unsigned xcr0 = 0;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        return 0;
+    if (edx & bit_SSE2)
+        features |= LW_CPU_SSE2;
+    if (ecx & bit_SSSE3)
+        features |= LW_CPU_SSSE3;
+    if (ecx & bit_PCLMUL)
+        features |= LW_CPU_PCLMUL;
+
+    /* AVX registers are only usable if the OS saves them for us */
+    if ((ecx & bit_OSXSAVE) && (ecx & bit_AVX))
+        xcr0 = lw_cpu_xgetbv(0);
+    if (__get_cpuid_max(0, 0) < 7)
+        return features;
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    if ((ebx & bit_BMI) && (ebx & bit_BMI2))
+        features |= LW_CPU_BMI2;
+    if ((xcr0 & 0x06) != 0x06)
+        return features;
+    if (ebx & bit_AVX2)
+        features |= LW_CPU_AVX2;
+
+    /* AVX-512 also needs the opmask and upper ZMM register states */
+    if ((xcr0 & 0xE6) != 0xE6)
+        return features;
+    if (ebx & bit_AVX512F) {
+        features |= LW_CPU_AVX512F;
+        if (ebx & bit_AVX512VL)
+            features |= LW_CPU_AVX512VL;
+    }
+    return features;
+}
+
+unsigned lw_cpu_features(void)
+{
+    unsigned features = LW_CPU_LOAD(lw_cpu_cached_features);
+    if (!features) {
+        features = lw_cpu_detect() | LW_CPU_DETECTED;
+        LW_CPU_STORE(lw_cpu_cached_features, features);
+    }
+    return features & ~LW_CPU_DETECTED;
+}
+
+#else /* !LW_CPU_DISPATCH */
+
+unsigned lw_cpu_features(void)
+{
+    /* Report the features that the compiler was told to use */
+    unsigned features = 0;
+#if defined(__SSE2__)
+    features |= LW_CPU_SSE2;
+#endif
+#if defined(__SSSE3__)
+    features |= LW_CPU_SSSE3;
+#endif
+#if defined(__AVX2__)
+    features |= LW_CPU_AVX2;
+#endif
+#if defined(__AVX512F__)
+    features |= LW_CPU_AVX512F;
+#endif
+#if defined(__AVX512VL__)
+    features |= LW_CPU_AVX512VL;
+#endif
+#if defined(__BMI__) && defined(__BMI2__)
+    features |= LW_CPU_BMI2;
+#endif
+#if defined(__PCLMUL__)
+    features |= LW_CPU_PCLMUL;
+#endif
+    return features;
+}
+
+#endif /* !LW_CPU_DISPATCH */
@@ -22,6 +22,7 @@
 
 #include "tinyjambu.h"
 #include "internal-tinyjambu.h"
+#include "internal-iovec.h"
 #include <string.h>
 
 aead_cipher_t const tiny_jambu_128_cipher = {
@@ -31,7 +32,18 @@ aead_cipher_t const tiny_jambu_128_cipher = {
     TINY_JAMBU_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     tiny_jambu_128_aead_encrypt,
-    tiny_jambu_128_aead_decrypt
+    tiny_jambu_128_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    tiny_jambu_128_aead_encrypt_vec,
+    tiny_jambu_128_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const tiny_jambu_192_cipher = {
@@ -41,7 +53,18 @@ aead_cipher_t const tiny_jambu_192_cipher = {
     TINY_JAMBU_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     tiny_jambu_192_aead_encrypt,
-    tiny_jambu_192_aead_decrypt
+    tiny_jambu_192_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    tiny_jambu_192_aead_encrypt_vec,
+    tiny_jambu_192_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_cipher_t const tiny_jambu_256_cipher = {
@@ -51,7 +74,18 @@ aead_cipher_t const tiny_jambu_256_cipher = {
     TINY_JAMBU_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     tiny_jambu_256_aead_encrypt,
-    tiny_jambu_256_aead_decrypt
+    tiny_jambu_256_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    tiny_jambu_256_aead_encrypt_vec,
+    tiny_jambu_256_aead_decrypt_vec,
+    0, /* incremental */
+    0, /* encrypt_batch */
+    0, /* decrypt_batch */
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 /**
@@ -91,37 +125,41 @@ static void tiny_jambu_setup
  * \param state TinyJAMBU state to be permuted.
  * \param key Points to the key words.
  * \param key_words The number of words in the key.
- * \param ad Points to the associated data.
+ * \param ad Cursor for the associated data segments.
  * \param adlen Length of the associated data in bytes.
  */
 static void tiny_jambu_process_ad
     (uint32_t state[TINY_JAMBU_STATE_SIZE], const uint32_t *key,
-     unsigned key_words, const unsigned char *ad, unsigned long long adlen)
+     unsigned key_words, aead_iovec_cursor_t *ad, unsigned long long adlen)
 {
+    unsigned char block[4];
+    const unsigned char *in;
+
     /* Process as many full 32-bit words as we can */
     while (adlen >= 4) {
         state[1] ^= 0x30; /* Domain separator for associated data */
         tiny_jambu_permutation(state, key, key_words, TINYJAMBU_ROUNDS(384));
-        state[3] ^= le_load_word32(ad);
-        ad += 4;
+        in = aead_iovec_load_block(ad, block, 4);
+        state[3] ^= le_load_word32(in);
         adlen -= 4;
     }
 
     /* Handle the left-over associated data bytes, if any */
+    in = aead_iovec_load_block(ad, block, (unsigned)adlen);
     if (adlen == 1) {
         state[1] ^= 0x30;
         tiny_jambu_permutation(state, key, key_words, TINYJAMBU_ROUNDS(384));
-        state[3] ^= ad[0];
+        state[3] ^= in[0];
         state[1] ^= 0x01;
     } else if (adlen == 2) {
         state[1] ^= 0x30;
         tiny_jambu_permutation(state, key, key_words, TINYJAMBU_ROUNDS(384));
-        state[3] ^= le_load_word16(ad);
+        state[3] ^= le_load_word16(in);
         state[1] ^= 0x02;
     } else if (adlen == 3) {
         state[1] ^= 0x30;
         tiny_jambu_permutation(state, key, key_words, TINYJAMBU_ROUNDS(384));
-        state[3] ^= le_load_word16(ad) | (((uint32_t)(ad[2])) << 16);
+        state[3] ^= le_load_word16(in) | (((uint32_t)(in[2])) << 16);
         state[1] ^= 0x03;
     }
 }
@@ -133,57 +171,63 @@ static void tiny_jambu_process_ad
  * \param key Points to the key words.
  * \param key_words The number of words in the key.
  * \param rounds The number of rounds to perform to process the plaintext.
- * \param c Points to the ciphertext output buffer.
- * \param m Points to the plaintext input buffer.
+ * \param c Cursor for the ciphertext output segments.
+ * \param m Cursor for the plaintext input segments.
  * \param mlen Length of the plaintext in bytes.
  */
 static void tiny_jambu_encrypt
     (uint32_t state[TINY_JAMBU_STATE_SIZE], const uint32_t *key,
-     unsigned key_words, unsigned rounds, unsigned char *c,
-     const unsigned char *m, unsigned long long mlen)
+     unsigned key_words, unsigned rounds, aead_iovec_cursor_t *c,
+     aead_iovec_cursor_t *m, unsigned long long mlen)
 {
+    unsigned char block[4];
+    const unsigned char *in;
     uint32_t data;
 
     /* Process as many full 32-bit words as we can */
     while (mlen >= 4) {
         state[1] ^= 0x50; /* Domain separator for message data */
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = le_load_word32(m);
+        in = aead_iovec_load_block(m, block, 4);
+        data = le_load_word32(in);
         state[3] ^= data;
         data ^= state[2];
-        le_store_word32(c, data);
-        c += 4;
-        m += 4;
+        le_store_word32(block, data);
+        aead_iovec_write(c, block, 4);
         mlen -= 4;
     }
 
     /* Handle the left-over plaintext data bytes, if any */
+    in = aead_iovec_load_block(m, block, (unsigned)mlen);
     if (mlen == 1) {
         state[1] ^= 0x50;
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = m[0];
+        data = in[0];
         state[3] ^= data;
         state[1] ^= 0x01;
-        c[0] = (uint8_t)(state[2] ^ data);
+        block[0] = (uint8_t)(state[2] ^ data);
+        aead_iovec_write(c, block, 1);
     } else if (mlen == 2) {
         state[1] ^= 0x50;
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = le_load_word16(m);
+        data = le_load_word16(in);
         state[3] ^= data;
         state[1] ^= 0x02;
         data ^= state[2];
-        c[0] = (uint8_t)data;
-        c[1] = (uint8_t)(data >> 8);
+        block[0] = (uint8_t)data;
+        block[1] = (uint8_t)(data >> 8);
+        aead_iovec_write(c, block, 2);
     } else if (mlen == 3) {
         state[1] ^= 0x50;
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = le_load_word16(m) | (((uint32_t)(m[2])) << 16);
+        data = le_load_word16(in) | (((uint32_t)(in[2])) << 16);
         state[3] ^= data;
         state[1] ^= 0x03;
         data ^= state[2];
-        c[0] = (uint8_t)data;
-        c[1] = (uint8_t)(data >> 8);
-        c[2] = (uint8_t)(data >> 16);
+        block[0] = (uint8_t)data;
+        block[1] = (uint8_t)(data >> 8);
+        block[2] = (uint8_t)(data >> 16);
+        aead_iovec_write(c, block, 3);
     }
 }
 
@@ -194,55 +238,61 @@ static void tiny_jambu_encrypt
  * \param key Points to the key words.
  * \param key_words The number of words in the key.
  * \param rounds The number of rounds to perform to process the ciphertext.
- * \param m Points to the plaintext output buffer.
- * \param c Points to the ciphertext input buffer.
+ * \param m Cursor for the plaintext output segments.
+ * \param c Cursor for the ciphertext input segments.
  * \param mlen Length of the plaintext in bytes.
  */
 static void tiny_jambu_decrypt
     (uint32_t state[TINY_JAMBU_STATE_SIZE], const uint32_t *key,
-     unsigned key_words, unsigned rounds, unsigned char *m,
-     const unsigned char *c, unsigned long long mlen)
+     unsigned key_words, unsigned rounds, aead_iovec_cursor_t *m,
+     aead_iovec_cursor_t *c, unsigned long long mlen)
 {
+    unsigned char block[4];
+    const unsigned char *in;
     uint32_t data;
 
     /* Process as many full 32-bit words as we can */
     while (mlen >= 4) {
         state[1] ^= 0x50; /* Domain separator for message data */
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = le_load_word32(c) ^ state[2];
+        in = aead_iovec_load_block(c, block, 4);
+        data = le_load_word32(in) ^ state[2];
         state[3] ^= data;
-        le_store_word32(m, data);
-        c += 4;
-        m += 4;
+        le_store_word32(block, data);
+        aead_iovec_write(m, block, 4);
         mlen -= 4;
     }
 
     /* Handle the left-over ciphertext data bytes, if any */
+    in = aead_iovec_load_block(c, block, (unsigned)mlen);
     if (mlen == 1) {
         state[1] ^= 0x50;
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = (c[0] ^ state[2]) & 0xFFU;
+        data = (in[0] ^ state[2]) & 0xFFU;
         state[3] ^= data;
         state[1] ^= 0x01;
-        m[0] = (uint8_t)data;
+        block[0] = (uint8_t)data;
+        aead_iovec_write(m, block, 1);
     } else if (mlen == 2) {
         state[1] ^= 0x50;
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = (le_load_word16(c) ^ state[2]) & 0xFFFFU;
+        data = (le_load_word16(in) ^ state[2]) & 0xFFFFU;
         state[3] ^= data;
         state[1] ^= 0x02;
-        m[0] = (uint8_t)data;
-        m[1] = (uint8_t)(data >> 8);
+        block[0] = (uint8_t)data;
+        block[1] = (uint8_t)(data >> 8);
+        aead_iovec_write(m, block, 2);
     } else if (mlen == 3) {
         state[1] ^= 0x50;
         tiny_jambu_permutation(state, key, key_words, rounds);
-        data = le_load_word16(c) | (((uint32_t)(c[2])) << 16);
+        data = le_load_word16(in) | (((uint32_t)(in[2])) << 16);
         data = (data ^ state[2]) & 0xFFFFFFU;
         state[3] ^= data;
         state[1] ^= 0x03;
-        m[0] = (uint8_t)data;
-        m[1] = (uint8_t)(data >> 8);
-        m[2] = (uint8_t)(data >> 16);
+        block[0] = (uint8_t)data;
+        block[1] = (uint8_t)(data >> 8);
+        block[2] = (uint8_t)(data >> 16);
+        aead_iovec_write(m, block, 3);
     }
 }
 
@@ -267,20 +317,29 @@ static void tiny_jambu_generate_tag
     le_store_word32(tag + 4, state[2]);
 }
 
-int tiny_jambu_128_aead_encrypt
-    (unsigned char *c, unsigned long long *clen,
-     const unsigned char *m, unsigned long long mlen,
-     const unsigned char *ad, unsigned long long adlen,
+int tiny_jambu_128_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
 {
     uint32_t state[TINY_JAMBU_STATE_SIZE];
     uint32_t key[4];
+    unsigned char tag[TINY_JAMBU_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + TINY_JAMBU_TAG_SIZE))
+        return -2;
     *clen = mlen + TINY_JAMBU_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Unpack the key */
     key[0] = le_load_word32(k);
@@ -290,33 +349,44 @@ int tiny_jambu_128_aead_encrypt
 
     /* Set up the TinyJAMBU state with the key, nonce, and associated data */
     tiny_jambu_setup(state, key, 4, TINYJAMBU_ROUNDS(1024), npub);
-    tiny_jambu_process_ad(state, key, 4, ad, adlen);
+    tiny_jambu_process_ad(state, key, 4, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    tiny_jambu_encrypt(state, key, 4, TINYJAMBU_ROUNDS(1024), c, m, mlen);
+    tiny_jambu_encrypt
+        (state, key, 4, TINYJAMBU_ROUNDS(1024), &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    tiny_jambu_generate_tag(state, key, 4, TINYJAMBU_ROUNDS(1024), c + mlen);
+    tiny_jambu_generate_tag(state, key, 4, TINYJAMBU_ROUNDS(1024), tag);
+    aead_iovec_write(&ccur, tag, TINY_JAMBU_TAG_SIZE);
     return 0;
 }
 
-int tiny_jambu_128_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int tiny_jambu_128_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     uint32_t state[TINY_JAMBU_STATE_SIZE];
     uint32_t key[4];
     unsigned char tag[TINY_JAMBU_TAG_SIZE];
+    unsigned char received[TINY_JAMBU_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < TINY_JAMBU_TAG_SIZE)
         return -1;
     *mlen = clen - TINY_JAMBU_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Unpack the key */
     key[0] = le_load_word32(k);
@@ -326,30 +396,75 @@ int tiny_jambu_128_aead_decrypt
 
     /* Set up the TinyJAMBU state with the key, nonce, and associated data */
     tiny_jambu_setup(state, key, 4, TINYJAMBU_ROUNDS(1024), npub);
-    tiny_jambu_process_ad(state, key, 4, ad, adlen);
+    tiny_jambu_process_ad(state, key, 4, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
-    tiny_jambu_decrypt(state, key, 4, TINYJAMBU_ROUNDS(1024), m, c, *mlen);
+    tiny_jambu_decrypt
+        (state, key, 4, TINYJAMBU_ROUNDS(1024), &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
     tiny_jambu_generate_tag(state, key, 4, TINYJAMBU_ROUNDS(1024), tag);
-    return aead_check_tag(m, *mlen, tag, c + *mlen, TINY_JAMBU_TAG_SIZE);
+    aead_iovec_read(&ccur, received, TINY_JAMBU_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, TINY_JAMBU_TAG_SIZE);
 }
 
-int tiny_jambu_192_aead_encrypt
+int tiny_jambu_128_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + TINY_JAMBU_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return tiny_jambu_128_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int tiny_jambu_128_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= TINY_JAMBU_TAG_SIZE ?
+                   clen - TINY_JAMBU_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return tiny_jambu_128_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int tiny_jambu_192_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     uint32_t state[TINY_JAMBU_STATE_SIZE];
     uint32_t key[12];
+    unsigned char tag[TINY_JAMBU_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + TINY_JAMBU_TAG_SIZE))
+        return -2;
     *clen = mlen + TINY_JAMBU_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Unpack the key and duplicate it to make the length a multiple of 4 */
     key[6]  = key[0] = le_load_word32(k);
@@ -361,33 +476,44 @@ int tiny_jambu_192_aead_encrypt
 
     /* Set up the TinyJAMBU state with the key, nonce, and associated data */
     tiny_jambu_setup(state, key, 12, TINYJAMBU_ROUNDS(1152), npub);
-    tiny_jambu_process_ad(state, key, 12, ad, adlen);
+    tiny_jambu_process_ad(state, key, 12, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    tiny_jambu_encrypt(state, key, 12, TINYJAMBU_ROUNDS(1152), c, m, mlen);
+    tiny_jambu_encrypt
+        (state, key, 12, TINYJAMBU_ROUNDS(1152), &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    tiny_jambu_generate_tag(state, key, 12, TINYJAMBU_ROUNDS(1152), c + mlen);
+    tiny_jambu_generate_tag(state, key, 12, TINYJAMBU_ROUNDS(1152), tag);
+    aead_iovec_write(&ccur, tag, TINY_JAMBU_TAG_SIZE);
     return 0;
 }
 
-int tiny_jambu_192_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int tiny_jambu_192_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     uint32_t state[TINY_JAMBU_STATE_SIZE];
     uint32_t key[12];
     unsigned char tag[TINY_JAMBU_TAG_SIZE];
+    unsigned char received[TINY_JAMBU_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < TINY_JAMBU_TAG_SIZE)
         return -1;
     *mlen = clen - TINY_JAMBU_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Unpack the key and duplicate it to make the length a multiple of 4 */
     key[6]  = key[0] = le_load_word32(k);
@@ -399,30 +525,75 @@ int tiny_jambu_192_aead_decrypt
 
     /* Set up the TinyJAMBU state with the key, nonce, and associated data */
     tiny_jambu_setup(state, key, 12, TINYJAMBU_ROUNDS(1152), npub);
-    tiny_jambu_process_ad(state, key, 12, ad, adlen);
+    tiny_jambu_process_ad(state, key, 12, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
-    tiny_jambu_decrypt(state, key, 12, TINYJAMBU_ROUNDS(1152), m, c, *mlen);
+    tiny_jambu_decrypt
+        (state, key, 12, TINYJAMBU_ROUNDS(1152), &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
     tiny_jambu_generate_tag(state, key, 12, TINYJAMBU_ROUNDS(1152), tag);
-    return aead_check_tag(m, *mlen, tag, c + *mlen, TINY_JAMBU_TAG_SIZE);
+    aead_iovec_read(&ccur, received, TINY_JAMBU_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, TINY_JAMBU_TAG_SIZE);
 }
 
-int tiny_jambu_256_aead_encrypt
+int tiny_jambu_192_aead_encrypt
     (unsigned char *c, unsigned long long *clen,
      const unsigned char *m, unsigned long long mlen,
      const unsigned char *ad, unsigned long long adlen,
      const unsigned char *nsec,
      const unsigned char *npub,
      const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + TINY_JAMBU_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return tiny_jambu_192_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int tiny_jambu_192_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= TINY_JAMBU_TAG_SIZE ?
+                   clen - TINY_JAMBU_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return tiny_jambu_192_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
+}
+
+int tiny_jambu_256_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
 {
     uint32_t state[TINY_JAMBU_STATE_SIZE];
     uint32_t key[8];
+    unsigned char tag[TINY_JAMBU_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long mlen = aead_iovec_length(m, m_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Set the length of the returned ciphertext */
+    if (aead_iovec_length(c, c_count) < (mlen + TINY_JAMBU_TAG_SIZE))
+        return -2;
     *clen = mlen + TINY_JAMBU_TAG_SIZE;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Unpack the key */
     key[0] = le_load_word32(k);
@@ -436,33 +607,44 @@ int tiny_jambu_256_aead_encrypt
 
     /* Set up the TinyJAMBU state with the key, nonce, and associated data */
     tiny_jambu_setup(state, key, 8, TINYJAMBU_ROUNDS(1280), npub);
-    tiny_jambu_process_ad(state, key, 8, ad, adlen);
+    tiny_jambu_process_ad(state, key, 8, &adcur, adlen);
 
     /* Encrypt the plaintext to produce the ciphertext */
-    tiny_jambu_encrypt(state, key, 8, TINYJAMBU_ROUNDS(1280), c, m, mlen);
+    tiny_jambu_encrypt
+        (state, key, 8, TINYJAMBU_ROUNDS(1280), &ccur, &mcur, mlen);
 
     /* Generate the authentication tag */
-    tiny_jambu_generate_tag(state, key, 8, TINYJAMBU_ROUNDS(1280), c + mlen);
+    tiny_jambu_generate_tag(state, key, 8, TINYJAMBU_ROUNDS(1280), tag);
+    aead_iovec_write(&ccur, tag, TINY_JAMBU_TAG_SIZE);
     return 0;
 }
 
-int tiny_jambu_256_aead_decrypt
-    (unsigned char *m, unsigned long long *mlen,
+int tiny_jambu_256_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
      unsigned char *nsec,
-     const unsigned char *c, unsigned long long clen,
-     const unsigned char *ad, unsigned long long adlen,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
      const unsigned char *npub,
      const unsigned char *k)
 {
     uint32_t state[TINY_JAMBU_STATE_SIZE];
     uint32_t key[8];
     unsigned char tag[TINY_JAMBU_TAG_SIZE];
+    unsigned char received[TINY_JAMBU_TAG_SIZE];
+    aead_iovec_cursor_t ccur, mcur, adcur;
+    unsigned long long clen = aead_iovec_length(c, c_count);
+    unsigned long long adlen = aead_iovec_length(ad, ad_count);
     (void)nsec;
 
     /* Validate the ciphertext length and set the return "mlen" value */
     if (clen < TINY_JAMBU_TAG_SIZE)
         return -1;
     *mlen = clen - TINY_JAMBU_TAG_SIZE;
+    if (aead_iovec_length(m, m_count) < *mlen)
+        return -2;
+    aead_iovec_start(&ccur, c, c_count);
+    aead_iovec_start(&mcur, m, m_count);
+    aead_iovec_start(&adcur, ad, ad_count);
 
     /* Unpack the key */
     key[0] = le_load_word32(k);
@@ -476,12 +658,48 @@ int tiny_jambu_256_aead_decrypt
 
     /* Set up the TinyJAMBU state with the key, nonce, and associated data */
     tiny_jambu_setup(state, key, 8, TINYJAMBU_ROUNDS(1280), npub);
-    tiny_jambu_process_ad(state, key, 8, ad, adlen);
+    tiny_jambu_process_ad(state, key, 8, &adcur, adlen);
 
     /* Decrypt the ciphertext to produce the plaintext */
-    tiny_jambu_decrypt(state, key, 8, TINYJAMBU_ROUNDS(1280), m, c, *mlen);
+    tiny_jambu_decrypt
+        (state, key, 8, TINYJAMBU_ROUNDS(1280), &mcur, &ccur, *mlen);
 
     /* Check the authentication tag */
     tiny_jambu_generate_tag(state, key, 8, TINYJAMBU_ROUNDS(1280), tag);
-    return aead_check_tag(m, *mlen, tag, c + *mlen, TINY_JAMBU_TAG_SIZE);
+    aead_iovec_read(&ccur, received, TINY_JAMBU_TAG_SIZE);
+    return aead_check_tag_vec
+        (m, m_count, *mlen, tag, received, TINY_JAMBU_TAG_SIZE);
+}
+
+int tiny_jambu_256_aead_encrypt
+    (unsigned char *c, unsigned long long *clen,
+     const unsigned char *m, unsigned long long mlen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, mlen + TINY_JAMBU_TAG_SIZE);
+    aead_iovec_set(&mvec, m, mlen);
+    aead_iovec_set(&advec, ad, adlen);
+    return tiny_jambu_256_aead_encrypt_vec
+        (&cvec, 1, clen, &mvec, 1, &advec, 1, nsec, npub, k);
+}
+
+int tiny_jambu_256_aead_decrypt
+    (unsigned char *m, unsigned long long *mlen,
+     unsigned char *nsec,
+     const unsigned char *c, unsigned long long clen,
+     const unsigned char *ad, unsigned long long adlen,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    aead_iovec_t cvec, mvec, advec;
+    aead_iovec_set(&cvec, c, clen);
+    aead_iovec_set(&mvec, m, clen >= TINY_JAMBU_TAG_SIZE ?
+                   clen - TINY_JAMBU_TAG_SIZE : 0);
+    aead_iovec_set(&advec, ad, adlen);
+    return tiny_jambu_256_aead_decrypt_vec
+        (&mvec, 1, mlen, nsec, &cvec, 1, &advec, 1, npub, k);
 }
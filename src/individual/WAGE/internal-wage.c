@@ -119,6 +119,7 @@ void wage_permute(unsigned char s[WAGE_STATE_SIZE])
     unsigned char round;
     uint64_t x0, x1, x2, x3, x4;
     uint32_t fb, temp;
+    aead_count_call(AEAD_PRIMITIVE_WAGE_PERMUTE);
 
     /* Load the state into 64-bit words.  Each word will have up to eight
      * 7-bit components with the MSB of each component fixed at zero.
@@ -227,6 +228,7 @@ void wage_permute(unsigned char s[WAGE_STATE_SIZE])
     unsigned char round, index;
     unsigned char fb0, fb1, fb2;
     uint32_t temp;
+    aead_count_call(AEAD_PRIMITIVE_WAGE_PERMUTE);
 
     /* Perform all rounds 3 at a time to reduce the state rotation overhead */
     for (round = 0; round < (WAGE_NUM_ROUNDS / 3); ++round, rc += 6) {
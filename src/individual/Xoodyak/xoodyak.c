@@ -22,8 +22,19 @@
 
 #include "xoodyak.h"
 #include "internal-xoodoo.h"
+#include "internal-cpu.h"
 #include <string.h>
 
+static aead_cipher_incremental_t const xoodyak_incremental = {
+    sizeof(xoodyak_aead_state_t),
+    (aead_incremental_init_t)xoodyak_aead_init,
+    (aead_incremental_ad_t)xoodyak_aead_update_ad,
+    (aead_incremental_crypt_t)xoodyak_aead_encrypt_update,
+    (aead_incremental_crypt_t)xoodyak_aead_decrypt_update,
+    (aead_incremental_encrypt_final_t)xoodyak_aead_encrypt_final,
+    (aead_incremental_decrypt_final_t)xoodyak_aead_decrypt_final
+};
+
 aead_cipher_t const xoodyak_cipher = {
     "Xoodyak",
     XOODYAK_KEY_SIZE,
@@ -31,7 +42,18 @@ aead_cipher_t const xoodyak_cipher = {
     XOODYAK_TAG_SIZE,
     AEAD_FLAG_LITTLE_ENDIAN,
     xoodyak_aead_encrypt,
-    xoodyak_aead_decrypt
+    xoodyak_aead_decrypt,
+    0, /* context_size */
+    0, /* setup_key */
+    0, /* encrypt_ctx */
+    0, /* decrypt_ctx */
+    xoodyak_aead_encrypt_vec,
+    xoodyak_aead_decrypt_vec,
+    &xoodyak_incremental,
+    xoodyak_aead_encrypt_batch,
+    xoodyak_aead_decrypt_batch,
+    0, /* schedule_size */
+    0  /* setup_key_schedule */
 };
 
 aead_hash_algorithm_t const xoodyak_hash_algorithm = {
@@ -217,6 +239,489 @@ int xoodyak_aead_decrypt
     return aead_check_tag(mtemp, *mlen, state.B, c, XOODYAK_TAG_SIZE);
 }
 
+/**
+ * \brief Incremental mode while associated data is being absorbed.
+ */
+#define XOODYAK_AEAD_MODE_AD 0
+
+/**
+ * \brief Incremental mode while the payload is being encrypted or decrypted.
+ */
+#define XOODYAK_AEAD_MODE_PAYLOAD 1
+
+/**
+ * \brief Gets the Xoodoo permutation state from an incremental AEAD state.
+ */
+#define xoodyak_aead_state(state) ((xoodoo_state_t *)((state)->s.state))
+
+void xoodyak_aead_init
+    (xoodyak_aead_state_t *state, const unsigned char *npub,
+     const unsigned char *k)
+{
+    xoodoo_state_t *st = xoodyak_aead_state(state);
+    uint8_t phase;
+
+    /* Initialize the state with the key and absorb the nonce */
+    memcpy(st->B, k, XOODYAK_KEY_SIZE);
+    memset(st->B + XOODYAK_KEY_SIZE, 0, sizeof(st->B) - XOODYAK_KEY_SIZE);
+    st->B[XOODYAK_KEY_SIZE + 1] = 0x01; /* Padding */
+    st->B[sizeof(st->B) - 1] = 0x02;  /* Domain separation */
+    phase = XOODYAK_PHASE_DOWN;
+    xoodyak_absorb(st, &phase, npub, XOODYAK_NONCE_SIZE);
+
+    /* Start the first associated data block, which may end up empty */
+    xoodoo_permute(st);
+    state->s.count = 0;
+    state->s.mode = XOODYAK_AEAD_MODE_AD;
+    state->s.domain = 0x03;
+}
+
+void xoodyak_aead_update_ad
+    (xoodyak_aead_state_t *state, const unsigned char *ad,
+     unsigned long long adlen)
+{
+    xoodoo_state_t *st = xoodyak_aead_state(state);
+    unsigned temp;
+    while (adlen > 0) {
+        /* Blocks are only finished when we know that more data follows
+         * because the last block is padded differently */
+        if (state->s.count >= XOODYAK_ABSORB_RATE) {
+            st->B[XOODYAK_ABSORB_RATE] ^= 0x01; /* Padding */
+            st->B[sizeof(st->B) - 1] ^= state->s.domain;
+            xoodoo_permute(st);
+            state->s.count = 0;
+            state->s.domain = 0x00;
+        }
+        temp = XOODYAK_ABSORB_RATE - state->s.count;
+        if (temp > adlen)
+            temp = (unsigned)adlen;
+        lw_xor_block(st->B + state->s.count, ad, temp);
+        state->s.count += temp;
+        ad += temp;
+        adlen -= temp;
+    }
+}
+
+/**
+ * \brief Pads the associated data and switches an incremental Xoodyak
+ * state into payload mode if it is not in payload mode already.
+ *
+ * \param state The incremental AEAD state.
+ */
+static void xoodyak_aead_start_payload(xoodyak_aead_state_t *state)
+{
+    xoodoo_state_t *st = xoodyak_aead_state(state);
+    if (state->s.mode == XOODYAK_AEAD_MODE_PAYLOAD)
+        return;
+    st->B[state->s.count] ^= 0x01; /* Padding */
+    st->B[sizeof(st->B) - 1] ^= state->s.domain;
+    st->B[sizeof(st->B) - 1] ^= 0x80; /* Domain separation */
+    xoodoo_permute(st);
+    state->s.count = 0;
+    state->s.mode = XOODYAK_AEAD_MODE_PAYLOAD;
+}
+
+void xoodyak_aead_encrypt_update
+    (xoodyak_aead_state_t *state, unsigned char *c, const unsigned char *m,
+     unsigned long long len)
+{
+    xoodoo_state_t *st = xoodyak_aead_state(state);
+    unsigned temp;
+    xoodyak_aead_start_payload(state);
+    while (len > 0) {
+        if (state->s.count >= XOODYAK_SQUEEZE_RATE) {
+            st->B[XOODYAK_SQUEEZE_RATE] ^= 0x01; /* Padding */
+            xoodoo_permute(st);
+            state->s.count = 0;
+        }
+        temp = XOODYAK_SQUEEZE_RATE - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        lw_xor_block_2_dest(c, st->B + state->s.count, m, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+    }
+}
+
+void xoodyak_aead_decrypt_update
+    (xoodyak_aead_state_t *state, unsigned char *m, const unsigned char *c,
+     unsigned long long len)
+{
+    xoodoo_state_t *st = xoodyak_aead_state(state);
+    unsigned temp;
+    xoodyak_aead_start_payload(state);
+    while (len > 0) {
+        if (state->s.count >= XOODYAK_SQUEEZE_RATE) {
+            st->B[XOODYAK_SQUEEZE_RATE] ^= 0x01; /* Padding */
+            xoodoo_permute(st);
+            state->s.count = 0;
+        }
+        temp = XOODYAK_SQUEEZE_RATE - state->s.count;
+        if (temp > len)
+            temp = (unsigned)len;
+        lw_xor_block_swap(m, st->B + state->s.count, c, temp);
+        state->s.count += temp;
+        c += temp;
+        m += temp;
+        len -= temp;
+    }
+}
+
+void xoodyak_aead_encrypt_final
+    (xoodyak_aead_state_t *state, unsigned char *tag)
+{
+    xoodoo_state_t *st = xoodyak_aead_state(state);
+    xoodyak_aead_start_payload(state);
+    st->B[state->s.count] ^= 0x01; /* Padding */
+    st->B[sizeof(st->B) - 1] ^= 0x40; /* Domain separation */
+    xoodoo_permute(st);
+    memcpy(tag, st->B, XOODYAK_TAG_SIZE);
+}
+
+int xoodyak_aead_decrypt_final
+    (xoodyak_aead_state_t *state, const unsigned char *tag)
+{
+    unsigned char computed[XOODYAK_TAG_SIZE];
+    xoodyak_aead_encrypt_final(state, computed);
+    return aead_check_tag(0, 0, computed, tag, XOODYAK_TAG_SIZE);
+}
+
+int xoodyak_aead_encrypt_vec
+    (const aead_iovec_t *c, size_t c_count, unsigned long long *clen,
+     const aead_iovec_t *m, size_t m_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *nsec,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    xoodyak_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_encrypt_vec
+        (&xoodyak_incremental, &state,
+         XOODYAK_TAG_SIZE, c, c_count, clen,
+         m, m_count, ad, ad_count, npub, k);
+}
+
+int xoodyak_aead_decrypt_vec
+    (const aead_iovec_t *m, size_t m_count, unsigned long long *mlen,
+     unsigned char *nsec,
+     const aead_iovec_t *c, size_t c_count,
+     const aead_iovec_t *ad, size_t ad_count,
+     const unsigned char *npub,
+     const unsigned char *k)
+{
+    xoodyak_aead_state_t state;
+    (void)nsec;
+    return aead_incremental_decrypt_vec
+        (&xoodyak_incremental, &state,
+         XOODYAK_TAG_SIZE, m, m_count, mlen,
+         c, c_count, ad, ad_count, npub, k);
+}
+
+/**
+ * \def XOODYAK_BATCH_LANES
+ * \brief Number of packets or messages that are processed in lock-step
+ * by the batched Xoodyak functions.
+ *
+ * This is the widest group that the vector kernels on this CPU might use;
+ * narrower kernels are applied to the group several times.
+ */
+#if defined(LW_CPU_HAVE_AVX512F)
+#define XOODYAK_BATCH_LANES 16
+typedef xoodoo_x16_state_t xoodyak_batch_state_t;
+#define xoodyak_batch_permute(state) xoodoo_x16_permute((state))
+#elif defined(LW_CPU_HAVE_AVX2)
+#define XOODYAK_BATCH_LANES 8
+typedef xoodoo_x8_state_t xoodyak_batch_state_t;
+#define xoodyak_batch_permute(state) xoodoo_x8_permute((state))
+#else
+#define XOODYAK_BATCH_LANES 4
+typedef xoodoo_x4_state_t xoodyak_batch_state_t;
+#define xoodyak_batch_permute(state) xoodoo_x4_permute((state))
+#endif
+
+/**
+ * \brief Information about one lane of a batched Xoodyak AEAD operation.
+ */
+typedef struct
+{
+    aead_packet_t *packet;      /**< Packet in this lane, or NULL if idle */
+    unsigned long long mlen;    /**< Length of the plaintext */
+    unsigned long long ad_blocks; /**< Number of associated data blocks */
+    unsigned long long m_blocks;  /**< Number of payload blocks */
+
+} xoodyak_batch_lane_t;
+
+/**
+ * \brief Gets the state for one lane of a batched Xoodyak operation.
+ *
+ * \param state The interleaved Xoodoo states.
+ * \param lane The lane to get.
+ * \param st Receives the Xoodoo state for the lane.
+ */
+static void xoodyak_batch_get
+    (const xoodyak_batch_state_t *state, unsigned lane, xoodoo_state_t *st)
+{
+    unsigned index;
+    for (index = 0; index < 12; ++index)
+        le_store_word32(st->B + index * 4, state->S[index][lane]);
+}
+
+/**
+ * \brief Sets the state for one lane of a batched Xoodyak operation.
+ *
+ * \param state The interleaved Xoodoo states.
+ * \param lane The lane to set.
+ * \param st Points to the new Xoodoo state for the lane.
+ */
+static void xoodyak_batch_set
+    (xoodyak_batch_state_t *state, unsigned lane, const xoodoo_state_t *st)
+{
+    unsigned index;
+    for (index = 0; index < 12; ++index)
+        state->S[index][lane] = le_load_word32(st->B + index * 4);
+}
+
+/**
+ * \brief Permutes the active lanes of a batched Xoodyak state.
+ *
+ * \param state The interleaved Xoodoo states.
+ * \param active Flags that indicate which lanes should be permuted.
+ *
+ * All lanes are permuted together and then the inactive lanes are
+ * restored, which is cheaper than splitting the batch.
+ */
+static void xoodyak_batch_permute_active
+    (xoodyak_batch_state_t *state, const unsigned char *active)
+{
+    xoodyak_batch_state_t saved;
+    unsigned lane, word;
+    int all = 1;
+    for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane) {
+        if (!active[lane])
+            all = 0;
+    }
+    if (!all)
+        saved = *state;
+    xoodyak_batch_permute(state);
+    if (!all) {
+        for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane) {
+            if (active[lane])
+                continue;
+            for (word = 0; word < 12; ++word)
+                state->S[word][lane] = saved.S[word][lane];
+        }
+    }
+}
+
+/**
+ * \brief Gets the number of blocks that Xoodyak uses to process data.
+ *
+ * \param len Length of the data in bytes.
+ * \param rate Block rate for the data.
+ *
+ * \return The number of blocks, which is always at least 1 because
+ * empty data is processed as a single empty block.
+ */
+static unsigned long long xoodyak_batch_blocks
+    (unsigned long long len, unsigned rate)
+{
+    if (len <= rate)
+        return 1;
+    return (len + rate - 1) / rate;
+}
+
+/**
+ * \brief Encrypts or decrypts a group of packets with Xoodyak in lock-step.
+ *
+ * \param packets Points to the packets in the group.
+ * \param count Number of packets, between 1 and XOODYAK_BATCH_LANES.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ *
+ * \return 0 if every packet succeeded, or the result of the first
+ * packet that failed.
+ */
+static int xoodyak_batch_group
+    (aead_packet_t *packets, unsigned count, int encrypt)
+{
+    xoodyak_batch_state_t state;
+    xoodyak_batch_lane_t lanes[XOODYAK_BATCH_LANES];
+    unsigned char active[XOODYAK_BATCH_LANES];
+    xoodoo_state_t st;
+    aead_packet_t *packet;
+    const unsigned char *k;
+    unsigned long long posn;
+    unsigned long long max_blocks;
+    unsigned long long offset;
+    unsigned lane, len;
+    int result = 0;
+
+    /* Load the key into each lane.  Unused lanes and ciphertexts that
+     * are too short for a tag are left idle */
+    memset(&state, 0, sizeof(state));
+    memset(lanes, 0, sizeof(lanes));
+    for (lane = 0; lane < count; ++lane) {
+        packet = &(packets[lane]);
+        if (!encrypt && packet->inlen < XOODYAK_TAG_SIZE) {
+            packet->outlen = 0;
+            packet->result = -1;
+            if (result == 0)
+                result = -1;
+            continue;
+        }
+        lanes[lane].packet = packet;
+        lanes[lane].mlen = encrypt ? packet->inlen
+                                   : packet->inlen - XOODYAK_TAG_SIZE;
+        lanes[lane].ad_blocks =
+            xoodyak_batch_blocks(packet->adlen, XOODYAK_ABSORB_RATE);
+        lanes[lane].m_blocks =
+            xoodyak_batch_blocks(lanes[lane].mlen, XOODYAK_SQUEEZE_RATE);
+        k = packet->ctx ? (const unsigned char *)(packet->ctx) : packet->key;
+        memcpy(st.B, k, XOODYAK_KEY_SIZE);
+        memset(st.B + XOODYAK_KEY_SIZE, 0, sizeof(st.B) - XOODYAK_KEY_SIZE);
+        st.B[XOODYAK_KEY_SIZE + 1] = 0x01; /* Padding */
+        st.B[sizeof(st.B) - 1] = 0x02;  /* Domain separation */
+        xoodyak_batch_set(&state, lane, &st);
+    }
+
+    /* Absorb the nonce */
+    xoodyak_batch_permute(&state);
+    for (lane = 0; lane < count; ++lane) {
+        if (!lanes[lane].packet)
+            continue;
+        xoodyak_batch_get(&state, lane, &st);
+        lw_xor_block(st.B, lanes[lane].packet->npub, XOODYAK_NONCE_SIZE);
+        st.B[XOODYAK_NONCE_SIZE] ^= 0x01; /* Padding */
+        st.B[sizeof(st.B) - 1] ^= 0x03; /* Domain separation */
+        xoodyak_batch_set(&state, lane, &st);
+    }
+
+    /* Absorb the associated data, which is at least one empty block */
+    max_blocks = 0;
+    for (lane = 0; lane < count; ++lane) {
+        if (lanes[lane].ad_blocks > max_blocks)
+            max_blocks = lanes[lane].ad_blocks;
+    }
+    for (posn = 0; posn < max_blocks; ++posn) {
+        for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane)
+            active[lane] = (posn < lanes[lane].ad_blocks);
+        xoodyak_batch_permute_active(&state, active);
+        for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane) {
+            if (!active[lane])
+                continue;
+            packet = lanes[lane].packet;
+            offset = posn * XOODYAK_ABSORB_RATE;
+            len = XOODYAK_ABSORB_RATE;
+            if ((packet->adlen - offset) < len)
+                len = (unsigned)(packet->adlen - offset);
+            xoodyak_batch_get(&state, lane, &st);
+            lw_xor_block(st.B, packet->ad + offset, len);
+            st.B[len] ^= 0x01; /* Padding */
+            if (posn == 0)
+                st.B[sizeof(st.B) - 1] ^= 0x03; /* Domain separation */
+            if ((posn + 1) == lanes[lane].ad_blocks)
+                st.B[sizeof(st.B) - 1] ^= 0x80; /* Start of payload */
+            xoodyak_batch_set(&state, lane, &st);
+        }
+    }
+
+    /* Encrypt or decrypt the payload, which is at least one empty block */
+    max_blocks = 0;
+    for (lane = 0; lane < count; ++lane) {
+        if (lanes[lane].m_blocks > max_blocks)
+            max_blocks = lanes[lane].m_blocks;
+    }
+    for (posn = 0; posn < max_blocks; ++posn) {
+        for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane)
+            active[lane] = (posn < lanes[lane].m_blocks);
+        xoodyak_batch_permute_active(&state, active);
+        for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane) {
+            if (!active[lane])
+                continue;
+            packet = lanes[lane].packet;
+            offset = posn * XOODYAK_SQUEEZE_RATE;
+            len = XOODYAK_SQUEEZE_RATE;
+            if ((lanes[lane].mlen - offset) < len)
+                len = (unsigned)(lanes[lane].mlen - offset);
+            xoodyak_batch_get(&state, lane, &st);
+            if (encrypt) {
+                lw_xor_block_2_dest
+                    (packet->out + offset, st.B, packet->in + offset, len);
+            } else {
+                lw_xor_block_swap
+                    (packet->out + offset, st.B, packet->in + offset, len);
+            }
+            st.B[len] ^= 0x01; /* Padding */
+            if ((posn + 1) == lanes[lane].m_blocks)
+                st.B[sizeof(st.B) - 1] ^= 0x40; /* Domain separation */
+            xoodyak_batch_set(&state, lane, &st);
+        }
+    }
+
+    /* Generate or check the authentication tags */
+    xoodyak_batch_permute(&state);
+    for (lane = 0; lane < count; ++lane) {
+        if (!lanes[lane].packet)
+            continue;
+        packet = lanes[lane].packet;
+        xoodyak_batch_get(&state, lane, &st);
+        if (encrypt) {
+            memcpy(packet->out + lanes[lane].mlen, st.B, XOODYAK_TAG_SIZE);
+            packet->outlen = lanes[lane].mlen + XOODYAK_TAG_SIZE;
+            packet->result = 0;
+        } else {
+            packet->outlen = lanes[lane].mlen;
+            packet->result = aead_check_tag
+                (packet->out, lanes[lane].mlen, st.B,
+                 packet->in + lanes[lane].mlen, XOODYAK_TAG_SIZE);
+            if (packet->result != 0 && result == 0)
+                result = packet->result;
+        }
+    }
+    return result;
+}
+
+/**
+ * \brief Encrypts or decrypts a batch of packets with Xoodyak,
+ * XOODYAK_BATCH_LANES packets at a time.
+ *
+ * \param packets Points to the array of packet descriptors.
+ * \param count Number of packets in the batch.
+ * \param encrypt Non-zero to encrypt or zero to decrypt.
+ *
+ * \return 0 if every packet succeeded, or the result of the first
+ * packet that failed.
+ */
+static int xoodyak_batch
+    (aead_packet_t *packets, size_t count, int encrypt)
+{
+    unsigned group;
+    int result = 0;
+    int group_result;
+    while (count > 0) {
+        group = (count > XOODYAK_BATCH_LANES) ? XOODYAK_BATCH_LANES
+                                              : (unsigned)count;
+        group_result = xoodyak_batch_group(packets, group, encrypt);
+        if (group_result != 0 && result == 0)
+            result = group_result;
+        packets += group;
+        count -= group;
+    }
+    return result;
+}
+
+int xoodyak_aead_encrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return xoodyak_batch(packets, count, 1);
+}
+
+int xoodyak_aead_decrypt_batch(aead_packet_t *packets, size_t count)
+{
+    return xoodyak_batch(packets, count, 0);
+}
+
 int xoodyak_hash
     (unsigned char *out, const unsigned char *in, unsigned long long inlen)
 {
@@ -319,3 +824,84 @@ void xoodyak_hash_finalize
 {
     xoodyak_hash_squeeze(state, out, XOODYAK_HASH_SIZE);
 }
+
+/**
+ * \brief Hashes a group of messages with Xoodyak in lock-step.
+ *
+ * \param out Points to the output buffers for the hash values.
+ * \param in Points to the messages to be hashed.
+ * \param inlen Points to the lengths of the messages.
+ * \param count Number of messages, between 1 and XOODYAK_BATCH_LANES.
+ */
+static void xoodyak_hash_batch_group
+    (unsigned char *const *out, const unsigned char *const *in,
+     const unsigned long long *inlen, unsigned count)
+{
+    xoodyak_batch_state_t state;
+    unsigned long long blocks[XOODYAK_BATCH_LANES];
+    unsigned char active[XOODYAK_BATCH_LANES];
+    xoodoo_state_t st;
+    unsigned long long posn;
+    unsigned long long max_blocks;
+    unsigned long long offset;
+    unsigned lane, len;
+
+    /* Absorb the input messages, which are at least one empty block */
+    memset(&state, 0, sizeof(state));
+    memset(blocks, 0, sizeof(blocks));
+    max_blocks = 0;
+    for (lane = 0; lane < count; ++lane) {
+        blocks[lane] = xoodyak_batch_blocks(inlen[lane], XOODYAK_HASH_RATE);
+        if (blocks[lane] > max_blocks)
+            max_blocks = blocks[lane];
+    }
+    for (posn = 0; posn < max_blocks; ++posn) {
+        for (lane = 0; lane < XOODYAK_BATCH_LANES; ++lane) {
+            active[lane] = (posn < blocks[lane]);
+            if (!active[lane])
+                continue;
+            offset = posn * XOODYAK_HASH_RATE;
+            len = XOODYAK_HASH_RATE;
+            if ((inlen[lane] - offset) < len)
+                len = (unsigned)(inlen[lane] - offset);
+            xoodyak_batch_get(&state, lane, &st);
+            lw_xor_block(st.B, in[lane] + offset, len);
+            st.B[len] ^= 0x01; /* Padding */
+            if (posn == 0)
+                st.B[sizeof(st.B) - 1] ^= 0x01; /* Domain separation */
+            xoodyak_batch_set(&state, lane, &st);
+        }
+        xoodyak_batch_permute_active(&state, active);
+    }
+
+    /* Squeeze out the two halves of each hash value */
+    for (lane = 0; lane < count; ++lane) {
+        xoodyak_batch_get(&state, lane, &st);
+        memcpy(out[lane], st.B, XOODYAK_HASH_RATE);
+        st.B[0] ^= 0x01; /* Padding */
+        xoodyak_batch_set(&state, lane, &st);
+    }
+    xoodyak_batch_permute(&state);
+    for (lane = 0; lane < count; ++lane) {
+        xoodyak_batch_get(&state, lane, &st);
+        memcpy(out[lane] + XOODYAK_HASH_RATE, st.B,
+               XOODYAK_HASH_SIZE - XOODYAK_HASH_RATE);
+    }
+}
+
+int xoodyak_hash_batch
+    (unsigned char *const *out, const unsigned char *const *in,
+     const unsigned long long *inlen, size_t count)
+{
+    unsigned group;
+    while (count > 0) {
+        group = (count > XOODYAK_BATCH_LANES) ? XOODYAK_BATCH_LANES
+                                              : (unsigned)count;
+        xoodyak_hash_batch_group(out, in, inlen, group);
+        out += group;
+        in += group;
+        inlen += group;
+        count -= group;
+    }
+    return 0;
+}
@@ -182,6 +182,20 @@ const aead_hash_algorithm_t *find_hash_algorithm(const char *name)
     return 0;
 }
 
+const aead_cipher_t *get_cipher(int index)
+{
+    if (index < 0 || index >= (int)(sizeof(ciphers) / sizeof(ciphers[0])))
+        return 0;
+    return ciphers[index];
+}
+
+const aead_hash_algorithm_t *get_hash_algorithm(int index)
+{
+    if (index < 0 || index >= (int)(sizeof(hashes) / sizeof(hashes[0])))
+        return 0;
+    return hashes[index];
+}
+
 static void print_cipher_details(const aead_cipher_t *cipher)
 {
     printf("%-30s %8u   %8u   %8u\n",
@@ -350,8 +350,10 @@ int main(int argc, char *argv[])
         return 1;
     }
 
-    /* Open the output file */
-    if ((file = fopen(output_filename, "w")) == NULL) {
+    /* Open the output file, or use stdout if the filename is "-" */
+    if (!strcmp(output_filename, "-")) {
+        file = stdout;
+    } else if ((file = fopen(output_filename, "w")) == NULL) {
         perror(output_filename);
         return 1;
     }
@@ -363,6 +365,7 @@ int main(int argc, char *argv[])
         generate_kats_for_hash(alg_hash, file);
 
     /* Clean up and exit */
-    fclose(file);
+    if (file != stdout)
+        fclose(file);
     return 0;
 }
@@ -20,33 +20,90 @@
  * DEALINGS IN THE SOFTWARE.
  */
 
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "aead-common.h"
 #include "algorithms.h"
 
-/* Dynamically-allocated test string that was converted from hexadecimal */
+/* Test string that was converted from hexadecimal.  The data points into
+ * the decode buffer of the KAT file and is valid until the next vector
+ * is read from the file. */
 typedef struct {
     size_t size;
-    unsigned char data[1];
+    const unsigned char *data;
 } test_string_t;
 
-/* Create a test string from a hexadecimal string */
-static test_string_t *create_test_string(const char *in)
+/* Memory-mapped KAT file that is being parsed */
+typedef struct {
+    const char *data;
+    size_t size;
+    size_t posn;
+    unsigned char *buffer;
+    size_t buffer_posn;
+
+} test_file_t;
+
+/* Maps a KAT file into memory, returns zero on error */
+static int test_file_open(test_file_t *file, const char *filename)
+{
+    struct stat st;
+    int fd;
+    memset(file, 0, sizeof(test_file_t));
+    if ((fd = open(filename, O_RDONLY)) < 0)
+        return 0;
+    if (fstat(fd, &st) < 0) {
+        close(fd);
+        return 0;
+    }
+    file->size = (size_t)(st.st_size);
+    if (file->size > 0) {
+        void *data = mmap(0, file->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return 0;
+        }
+        file->data = (const char *)data;
+    }
+    close(fd);
+
+    /* The hex strings in a vector cannot decode to more than half of
+     * the file's size, so one buffer is enough for every vector */
+    file->buffer = (unsigned char *)malloc(file->size / 2 + 1);
+    if (!(file->buffer))
+        exit(2);
+    return 1;
+}
+
+/* Unmaps a KAT file from memory */
+static void test_file_close(test_file_t *file)
+{
+    if (file->size > 0)
+        munmap((void *)(file->data), file->size);
+    free(file->buffer);
+    memset(file, 0, sizeof(test_file_t));
+}
+
+/* Create a test string from hexadecimal, decoding into the file's buffer */
+static void create_test_string
+    (test_string_t *out, test_file_t *file, const char *in, const char *end)
 {
+    unsigned char *data = file->buffer + file->buffer_posn;
     int value;
     int nibble;
     int phase;
-    test_string_t *out;
-    out = (test_string_t *)malloc(sizeof(test_string_t) + (strlen(in) / 2));
-    if (!out)
-        exit(2);
     out->size = 0;
+    out->data = data;
     value = 0;
     phase = 0;
-    while (*in != '\0') {
+    while (in < end) {
         int ch = *in++;
         if (ch >= '0' && ch <= '9')
             nibble = ch - '0';
@@ -60,16 +117,13 @@ static test_string_t *create_test_string(const char *in)
             value = nibble << 4;
             phase = 1;
         } else {
-            out->data[(out->size)++] = value | nibble;
+            data[(out->size)++] = value | nibble;
             phase = 0;
         }
     }
-    return out;
+    file->buffer_posn += out->size;
 }
 
-/* Frees a dynamically-allocated test string */
-#define free_test_string(str) (free((str)))
-
 /* Maximum number of parameters to a KAT vector */
 #define MAX_TEST_PARAMS 16
 
@@ -78,36 +132,51 @@ typedef struct
 {
     int test_number;
     char names[MAX_TEST_PARAMS][16];
-    test_string_t *values[MAX_TEST_PARAMS];
+    test_string_t values[MAX_TEST_PARAMS];
     size_t count;
 
 } test_vector_t;
 
-/* Reads a dynamically-allocated KAT vector from an input file */
-static int test_vector_read(test_vector_t *vec, FILE *file)
+/* Reads the next KAT vector from a memory-mapped input file */
+static int test_vector_read(test_vector_t *vec, test_file_t *file)
 {
-    char buffer[8192];
     memset(vec, 0, sizeof(test_vector_t));
-    while (fgets(buffer, sizeof(buffer), file)) {
-        if (buffer[0] == '\n' || buffer[0] == '\r' || buffer[0] == '\0') {
+    file->buffer_posn = 0;
+    while (file->posn < file->size) {
+        const char *line = file->data + file->posn;
+        size_t len = file->size - file->posn;
+        const char *nl = (const char *)memchr(line, '\n', len);
+        if (nl) {
+            len = nl - line;
+            file->posn += len + 1;
+        } else {
+            file->posn += len;
+        }
+        if (len == 0 || line[0] == '\r') {
             /* Blank line terminates the vector unless it is the first line */
             if (vec->count > 0)
                 return 1;
-        } else if (!strncmp(buffer, "Count = ", 8)) {
+        } else if (len >= 8 && !strncmp(line, "Count = ", 8)) {
             /* Number of the test rather than a vector parameter */
-            vec->test_number = atoi(buffer + 8);
-        } else if (buffer[0] >= 'A' && buffer[0] <= 'Z' && vec->count < MAX_TEST_PARAMS) {
+            size_t posn = 8;
+            while (posn < len && line[posn] >= '0' && line[posn] <= '9') {
+                vec->test_number = vec->test_number * 10 + line[posn] - '0';
+                ++posn;
+            }
+        } else if (line[0] >= 'A' && line[0] <= 'Z' &&
+                   vec->count < MAX_TEST_PARAMS) {
             /* Name = Value test string */
-            const char *eq = strchr(buffer, '=');
+            const char *eq = (const char *)memchr(line, '=', len);
             if (eq) {
-                int posn = eq - buffer;
-                while (posn > 0 && buffer[posn - 1] == ' ')
+                int posn = eq - line;
+                while (posn > 0 && line[posn - 1] == ' ')
                     --posn;
                 if (posn > 15)
                     posn = 15;
-                memcpy(vec->names[vec->count], buffer, posn);
+                memcpy(vec->names[vec->count], line, posn);
                 vec->names[vec->count][posn] = '\0';
-                vec->values[vec->count] = create_test_string(eq + 1);
+                create_test_string
+                    (&(vec->values[vec->count]), file, eq + 1, line + len);
                 ++(vec->count);
             }
         }
@@ -115,64 +184,56 @@ static int test_vector_read(test_vector_t *vec, FILE *file)
     return vec->count > 0;
 }
 
-/* Frees a dynamically-allocated KAT vector */
-static void test_vector_free(test_vector_t *vec)
-{
-    size_t index;
-    for (index = 0; index < vec->count; ++index)
-        free_test_string(vec->values[index]);
-    memset(vec, 0, sizeof(test_vector_t));
-}
-
 /* Gets a parameter from a test vector, NULL if parameter is not present */
-static test_string_t *get_test_string
-    (const test_vector_t *vec, const char *name)
+static const test_string_t *get_test_string
+    (const test_vector_t *vec, const char *name, FILE *out)
 {
     size_t index;
     for (index = 0; index < vec->count; ++index) {
         if (!strcmp(vec->names[index], name))
-            return vec->values[index];
+            return &(vec->values[index]);
     }
-    fprintf(stderr, "Could not find '%s' in test vector %d\n",
+    fprintf(out, "Could not find '%s' in test vector %d\n",
             name, vec->test_number);
-    exit(3);
     return 0;
 }
 
 /* Print an error for a failed test */
 static void test_print_error
-    (const char *alg, const test_vector_t *vec, const char *format, ...)
+    (FILE *out, const char *alg, const test_vector_t *vec,
+     const char *format, ...)
 {
     va_list va;
-    printf("%s [%d]: ", alg, vec->test_number);
+    fprintf(out, "%s [%d]: ", alg, vec->test_number);
     va_start(va, format);
-    vprintf(format, va);
+    vfprintf(out, format, va);
     va_end(va);
-    printf("\n");
+    fprintf(out, "\n");
 }
 
 static void test_print_hex
-    (const char *tag, const unsigned char *data, unsigned long long len)
+    (FILE *out, const char *tag, const unsigned char *data,
+     unsigned long long len)
 {
-    printf("%s =", tag);
+    fprintf(out, "%s =", tag);
     while (len > 0) {
-        printf(" %02x", data[0]);
+        fprintf(out, " %02x", data[0]);
         ++data;
         --len;
     }
-    printf("\n");
+    fprintf(out, "\n");
 }
 
 static int test_compare
-    (const unsigned char *actual, const unsigned char *expected,
+    (FILE *out, const unsigned char *actual, const unsigned char *expected,
      unsigned long long len)
 {
     int cmp = memcmp(actual, expected, (size_t)len);
     if (cmp == 0)
         return 1;
-    printf("\n");
-    test_print_hex("actual  ", actual, len);
-    test_print_hex("expected", expected, len);
+    fprintf(out, "\n");
+    test_print_hex(out, "actual  ", actual, len);
+    test_print_hex(out, "expected", expected, len);
     return 0;
 }
 
@@ -187,9 +248,751 @@ static int test_all_zeroes(const unsigned char *buf, unsigned long long len)
     return 1;
 }
 
+/* Test a cipher algorithm on a specific test vector using a key context
+ * that was set up with a specific key schedule variant */
+static int test_cipher_context
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_string_t *plaintext, const test_string_t *ciphertext,
+     const test_string_t *ad, unsigned char *temp, unsigned schedule)
+{
+    void *ctx;
+    unsigned long long len;
+    int result;
+
+    /* Set up the key context */
+    ctx = malloc(aead_cipher_context_size_schedule(alg, schedule));
+    if (!ctx)
+        exit(2);
+    aead_cipher_setup_key_schedule(alg, ctx, key->data, schedule);
+
+    /* Test encryption */
+    memset(temp, 0xAA, ciphertext->size);
+    len = 0xBADBEEF;
+    result = aead_cipher_encrypt_with_context
+        (alg, temp, &len, plaintext->data, plaintext->size,
+         ad->data, ad->size, 0, nonce->data, ctx);
+    if (result != 0 || len != ciphertext->size ||
+            !test_compare(out, temp, ciphertext->data, len)) {
+        test_print_error(out, alg->name, vec, "context encryption failed");
+        free(ctx);
+        return 0;
+    }
+
+    /* Test decryption, twice to check that the context is not modified */
+    memset(temp, 0xAA, ciphertext->size);
+    len = 0xBADBEEF;
+    result = aead_cipher_decrypt_with_context
+        (alg, temp, &len, 0, ciphertext->data, ciphertext->size,
+         ad->data, ad->size, nonce->data, ctx);
+    if (result == 0) {
+        memset(temp, 0xAA, ciphertext->size);
+        len = 0xBADBEEF;
+        result = aead_cipher_decrypt_with_context
+            (alg, temp, &len, 0, ciphertext->data, ciphertext->size,
+             ad->data, ad->size, nonce->data, ctx);
+    }
+    if (result != 0 || len != plaintext->size ||
+            !test_compare(out, temp, plaintext->data, len)) {
+        test_print_error(out, alg->name, vec, "context decryption failed");
+        free(ctx);
+        return 0;
+    }
+    free(ctx);
+    return 1;
+}
+
+/* Split a buffer into uneven scatter/gather segments, including empty
+ * segments, and return the number of segments.  The "vec" array must
+ * have space for at least (len + 1) * 2 entries */
+static size_t test_split
+    (aead_iovec_t *vec, unsigned char *data, size_t len, unsigned variant)
+{
+    static size_t const sizes[] = {0, 1, 7, 16, 3, 33, 2};
+    size_t count = 0;
+    size_t size;
+    do {
+        size = sizes[variant++ % (sizeof(sizes) / sizeof(sizes[0]))];
+        if (size > len)
+            size = len;
+        vec[count].data = data;
+        vec[count].len = size;
+        ++count;
+        data += size;
+        len -= size;
+    } while (len > 0);
+    return count;
+}
+
+/* Test a cipher algorithm on a specific test vector using scatter/gather */
+static int test_cipher_vec
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_string_t *plaintext, const test_string_t *ciphertext,
+     const test_string_t *ad, unsigned char *temp1, unsigned char *temp2)
+{
+    aead_iovec_t *vecs;
+    aead_iovec_t *in;
+    aead_iovec_t *outv;
+    aead_iovec_t *adv;
+    size_t max_vecs, in_count, out_count, ad_count;
+    unsigned long long len;
+    int result;
+
+    /* Allocate the segment arrays */
+    max_vecs = (ciphertext->size + 1) * 2;
+    if (max_vecs < (size_t)((ad->size + 1) * 2))
+        max_vecs = (size_t)((ad->size + 1) * 2);
+    vecs = malloc(max_vecs * 3 * sizeof(aead_iovec_t));
+    if (!vecs)
+        exit(2);
+    in = vecs;
+    outv = vecs + max_vecs;
+    adv = vecs + max_vecs * 2;
+    ad_count = test_split(adv, (unsigned char *)(ad->data), ad->size, 0);
+
+    /* Test encryption with different segment boundaries on each side */
+    memset(temp1, 0xAA, ciphertext->size);
+    in_count = test_split
+        (in, (unsigned char *)(plaintext->data), plaintext->size, 1);
+    out_count = test_split(outv, temp1, ciphertext->size, 4);
+    len = 0xBADBEEF;
+    result = aead_cipher_encrypt_vec
+        (alg, outv, out_count, &len, in, in_count, adv, ad_count,
+         0, nonce->data, key->data);
+    if (result != 0 || len != ciphertext->size ||
+            !test_compare(out, temp1, ciphertext->data, len)) {
+        test_print_error(out, alg->name, vec, "vector encryption failed");
+        free(vecs);
+        return 0;
+    }
+
+    /* Test decryption */
+    memset(temp1, 0xAA, ciphertext->size);
+    in_count = test_split
+        (in, (unsigned char *)(ciphertext->data), ciphertext->size, 2);
+    out_count = test_split(outv, temp1, ciphertext->size, 5);
+    len = 0xBADBEEF;
+    result = aead_cipher_decrypt_vec
+        (alg, outv, out_count, &len, 0, in, in_count, adv, ad_count,
+         nonce->data, key->data);
+    if (result != 0 || len != plaintext->size ||
+            !test_compare(out, temp1, plaintext->data, len)) {
+        test_print_error(out, alg->name, vec, "vector decryption failed");
+        free(vecs);
+        return 0;
+    }
+
+    /* Test decryption with a failed tag check */
+    memset(temp1, 0xAA, ciphertext->size);
+    memcpy(temp2, ciphertext->data, ciphertext->size);
+    temp2[ciphertext->size - 1] ^= 0x01;
+    in_count = test_split(in, temp2, ciphertext->size, 3);
+    len = 0xBADBEEF;
+    result = aead_cipher_decrypt_vec
+        (alg, outv, out_count, &len, 0, in, in_count, adv, ad_count,
+         nonce->data, key->data);
+    if (result != -1) {
+        test_print_error
+            (out, alg->name, vec, "vector corrupt tag check failed");
+        free(vecs);
+        return 0;
+    }
+    if (!test_all_zeroes(temp1, plaintext->size)) {
+        test_print_error
+            (out, alg->name, vec, "vector plaintext not destroyed");
+        free(vecs);
+        return 0;
+    }
+    free(vecs);
+    return 1;
+}
+
+/* Test a cipher algorithm on a specific test vector with a detached tag,
+ * encrypting and decrypting in-place */
+static int test_cipher_detached
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_string_t *plaintext, const test_string_t *ciphertext,
+     const test_string_t *ad, unsigned char *temp1, unsigned char *temp2)
+{
+    int result;
+
+    /* Ciphers without a separate tag must reject the detached functions */
+    if (alg->flags & AEAD_FLAG_NO_DETACHED_TAG) {
+        result = aead_cipher_encrypt_detached
+            (alg, temp1, temp2, plaintext->data, plaintext->size,
+             ad->data, ad->size, 0, nonce->data, key->data);
+        if (result != -2) {
+            test_print_error
+                (out, alg->name, vec, "detached tag was not rejected");
+            return 0;
+        }
+        return 1;
+    }
+
+    /* Test in-place encryption */
+    memset(temp1, 0xAA, ciphertext->size);
+    memset(temp2, 0xAA, ciphertext->size);
+    memcpy(temp1, plaintext->data, plaintext->size);
+    result = aead_cipher_encrypt_detached
+        (alg, temp1, temp2, temp1, plaintext->size,
+         ad->data, ad->size, 0, nonce->data, key->data);
+    if (result != 0 ||
+            !test_compare(out, temp1, ciphertext->data, plaintext->size) ||
+            !test_compare(out, temp2, ciphertext->data + plaintext->size,
+                          alg->tag_len)) {
+        test_print_error(out, alg->name, vec, "detached encryption failed");
+        return 0;
+    }
+
+    /* Test in-place decryption */
+    memset(temp1, 0xAA, ciphertext->size);
+    memcpy(temp1, ciphertext->data, plaintext->size);
+    result = aead_cipher_decrypt_detached
+        (alg, temp1, 0, temp1, plaintext->size,
+         ciphertext->data + plaintext->size,
+         ad->data, ad->size, nonce->data, key->data);
+    if (result != 0 ||
+            !test_compare(out, temp1, plaintext->data, plaintext->size)) {
+        test_print_error(out, alg->name, vec, "detached decryption failed");
+        return 0;
+    }
+
+    /* Test in-place encryption and decryption with the tag directly
+     * after the ciphertext, which is the only layout that ciphers
+     * without a native scatter/gather implementation support */
+    memset(temp1, 0xAA, ciphertext->size);
+    memcpy(temp1, plaintext->data, plaintext->size);
+    result = aead_cipher_encrypt_detached
+        (alg, temp1, temp1 + plaintext->size, temp1, plaintext->size,
+         ad->data, ad->size, 0, nonce->data, key->data);
+    if (result != 0 ||
+            !test_compare(out, temp1, ciphertext->data, ciphertext->size)) {
+        test_print_error(out, alg->name, vec, "adjacent encryption failed");
+        return 0;
+    }
+    result = aead_cipher_decrypt_detached
+        (alg, temp1, 0, temp1, plaintext->size, temp1 + plaintext->size,
+         ad->data, ad->size, nonce->data, key->data);
+    if (result != 0 ||
+            !test_compare(out, temp1, plaintext->data, plaintext->size)) {
+        test_print_error(out, alg->name, vec, "adjacent decryption failed");
+        return 0;
+    }
+    return 1;
+}
+
+/* Buffers for testing a cipher algorithm on large packets */
+typedef struct {
+    unsigned char *m;           /* Plaintext */
+    unsigned char *ad;          /* Associated data */
+    unsigned char *expected;    /* Expected ciphertext and tag */
+    unsigned char *temp1;       /* Output buffer */
+    unsigned char *temp2;       /* Second output buffer */
+    unsigned char *tag;         /* Detached tag */
+    aead_iovec_t *in;           /* Input segments */
+    aead_iovec_t *outv;         /* Output segments */
+    aead_iovec_t *adv;          /* Associated data segments */
+    size_t ad_count;            /* Number of associated data segments */
+    size_t adlen;               /* Length of the associated data */
+
+} test_large_t;
+
+/* Test a cipher algorithm on one large packet.  The contiguous one-shot
+ * function provides the expected output */
+static int test_cipher_large_packet
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_large_t *bufs, size_t mlen)
+{
+    size_t clen = mlen + alg->tag_len;
+    size_t in_count, out_count;
+    unsigned long long len;
+    int result;
+
+    /* Generate the expected output with the one-shot function */
+    len = 0xBADBEEF;
+    result = (*(alg->encrypt))
+        (bufs->expected, &len, bufs->m, mlen, bufs->ad, bufs->adlen,
+         0, nonce->data, key->data);
+    if (result != 0 || len != clen) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte encryption failed", (unsigned)mlen);
+        return 0;
+    }
+
+    /* Encrypt with fragmented segments on both sides */
+    memset(bufs->temp1, 0xAA, clen);
+    in_count = test_split(bufs->in, bufs->m, mlen, 1);
+    out_count = test_split(bufs->outv, bufs->temp1, clen, 4);
+    len = 0xBADBEEF;
+    result = aead_cipher_encrypt_vec
+        (alg, bufs->outv, out_count, &len, bufs->in, in_count,
+         bufs->adv, bufs->ad_count, 0, nonce->data, key->data);
+    if (result != 0 || len != clen ||
+            !test_compare(out, bufs->temp1, bufs->expected, clen)) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte vector encryption failed", (unsigned)mlen);
+        return 0;
+    }
+
+    /* Decrypt with fragmented segments on both sides */
+    memset(bufs->temp1, 0xAA, clen);
+    in_count = test_split(bufs->in, bufs->expected, clen, 2);
+    out_count = test_split(bufs->outv, bufs->temp1, mlen, 5);
+    len = 0xBADBEEF;
+    result = aead_cipher_decrypt_vec
+        (alg, bufs->outv, out_count, &len, 0, bufs->in, in_count,
+         bufs->adv, bufs->ad_count, nonce->data, key->data);
+    if (result != 0 || len != mlen ||
+            !test_compare(out, bufs->temp1, bufs->m, mlen)) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte vector decryption failed", (unsigned)mlen);
+        return 0;
+    }
+
+    /* Decrypt with fragmented segments and a corrupted tag */
+    memcpy(bufs->temp2, bufs->expected, clen);
+    bufs->temp2[clen - 1] ^= 0x01;
+    in_count = test_split(bufs->in, bufs->temp2, clen, 3);
+    result = aead_cipher_decrypt_vec
+        (alg, bufs->outv, out_count, &len, 0, bufs->in, in_count,
+         bufs->adv, bufs->ad_count, nonce->data, key->data);
+    if (result != -1 || !test_all_zeroes(bufs->temp1, mlen)) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte vector corrupt tag check failed",
+                         (unsigned)mlen);
+        return 0;
+    }
+
+    /* Encrypt into a separate buffer with a detached tag */
+    memset(bufs->temp1, 0xAA, mlen);
+    memset(bufs->tag, 0xAA, alg->tag_len);
+    result = aead_cipher_encrypt_detached
+        (alg, bufs->temp1, bufs->tag, bufs->m, mlen, bufs->ad, bufs->adlen,
+         0, nonce->data, key->data);
+    if (result != 0 ||
+            !test_compare(out, bufs->temp1, bufs->expected, mlen) ||
+            !test_compare(out, bufs->tag, bufs->expected + mlen,
+                          alg->tag_len)) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte detached encryption failed",
+                         (unsigned)mlen);
+        return 0;
+    }
+
+    /* Decrypt into a separate buffer with a detached tag */
+    memset(bufs->temp2, 0xAA, mlen);
+    result = aead_cipher_decrypt_detached
+        (alg, bufs->temp2, 0, bufs->temp1, mlen, bufs->tag,
+         bufs->ad, bufs->adlen, nonce->data, key->data);
+    if (result != 0 || !test_compare(out, bufs->temp2, bufs->m, mlen)) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte detached decryption failed",
+                         (unsigned)mlen);
+        return 0;
+    }
+
+    /* Decrypt in-place with a detached tag that has been corrupted */
+    bufs->tag[0] ^= 0x01;
+    result = aead_cipher_decrypt_detached
+        (alg, bufs->temp1, 0, bufs->temp1, mlen, bufs->tag,
+         bufs->ad, bufs->adlen, nonce->data, key->data);
+    if (result != -1 || !test_all_zeroes(bufs->temp1, mlen)) {
+        test_print_error(out, alg->name, vec,
+                         "%u byte detached corrupt tag check failed",
+                         (unsigned)mlen);
+        return 0;
+    }
+    return 1;
+}
+
+/* Test a cipher algorithm on packets that are larger than a network MTU,
+ * fragmented into many small scatter/gather segments, and with the tag
+ * detached from the ciphertext */
+static int test_cipher_large
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce)
+{
+    static size_t const sizes[] = {1500, 4099};
+    size_t max_len = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+    size_t max_clen = max_len + alg->tag_len;
+    size_t max_vecs = (max_clen + 1) * 2;
+    unsigned char *buffers;
+    aead_iovec_t *vecs;
+    test_large_t bufs;
+    size_t index;
+    int ok = 1;
+
+    /* SATURNIN-Short only accepts short packets with no separate tag */
+    if (alg->flags & AEAD_FLAG_NO_DETACHED_TAG)
+        return 1;
+
+    /* Allocate the buffers and segment arrays */
+    bufs.adlen = 1000;
+    buffers = malloc(max_len + bufs.adlen + max_clen * 3 + alg->tag_len);
+    vecs = malloc(max_vecs * 3 * sizeof(aead_iovec_t));
+    if (!buffers || !vecs)
+        exit(2);
+    bufs.m = buffers;
+    bufs.ad = bufs.m + max_len;
+    bufs.expected = bufs.ad + bufs.adlen;
+    bufs.temp1 = bufs.expected + max_clen;
+    bufs.temp2 = bufs.temp1 + max_clen;
+    bufs.tag = bufs.temp2 + max_clen;
+    bufs.in = vecs;
+    bufs.outv = vecs + max_vecs;
+    bufs.adv = vecs + max_vecs * 2;
+    for (index = 0; index < max_len; ++index)
+        bufs.m[index] = (unsigned char)(index * 7 + 3);
+    for (index = 0; index < bufs.adlen; ++index)
+        bufs.ad[index] = (unsigned char)(index * 13 + 5);
+    bufs.ad_count = test_split(bufs.adv, bufs.ad, bufs.adlen, 0);
+
+    /* Test each of the packet sizes */
+    for (index = 0; ok && index < sizeof(sizes) / sizeof(sizes[0]);
+            ++index) {
+        ok = test_cipher_large_packet
+            (alg, vec, out, key, nonce, &bufs, sizes[index]);
+    }
+    free(buffers);
+    free(vecs);
+    return ok;
+}
+
+/* Test a cipher algorithm on a specific test vector using the batch API,
+ * with packets that use both raw keys and key contexts and that have
+ * different lengths */
+static int test_cipher_batch
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_string_t *plaintext, const test_string_t *ciphertext,
+     const test_string_t *ad)
+{
+    aead_packet_t packets[3];
+    const unsigned char *expected[3];
+    unsigned long long expected_len[3];
+    unsigned long long mlen[3];
+    unsigned char *temp;
+    unsigned char *short_ct;
+    unsigned char *corrupt;
+    void *ctx;
+    int index;
+    int result;
+
+    /* Set up the key context and the output buffers */
+    ctx = malloc(aead_cipher_context_size(alg));
+    temp = malloc(ciphertext->size * 3);
+    short_ct = malloc(ciphertext->size);
+    corrupt = malloc(ciphertext->size);
+    if (!ctx || !temp || !short_ct || !corrupt)
+        exit(2);
+    aead_cipher_setup_key(alg, ctx, key->data);
+
+    /* The last packet has half the plaintext and associated data, so the
+     * packets in the batch finish at different times */
+    mlen[0] = mlen[1] = plaintext->size;
+    mlen[2] = plaintext->size / 2;
+    result = (*(alg->encrypt))
+        (short_ct, &(expected_len[2]), plaintext->data, mlen[2],
+         ad->data, ad->size / 2, 0, nonce->data, key->data);
+    if (result != 0) {
+        test_print_error(out, alg->name, vec, "batch setup failed");
+        free(ctx);
+        free(temp);
+        free(short_ct);
+        free(corrupt);
+        return 0;
+    }
+    expected[0] = expected[1] = ciphertext->data;
+    expected[2] = short_ct;
+    expected_len[0] = expected_len[1] = ciphertext->size;
+    memset(packets, 0, sizeof(packets));
+    for (index = 0; index < 3; ++index) {
+        packets[index].key = key->data;
+        packets[index].ctx = (index == 1) ? ctx : 0;
+        packets[index].npub = nonce->data;
+        packets[index].ad = ad->data;
+        packets[index].adlen = (index == 2) ? ad->size / 2 : ad->size;
+        packets[index].out = temp + index * ciphertext->size;
+    }
+
+    /* Test encryption */
+    memset(temp, 0xAA, ciphertext->size * 3);
+    for (index = 0; index < 3; ++index) {
+        packets[index].in = plaintext->data;
+        packets[index].inlen = mlen[index];
+        packets[index].outlen = 0xBADBEEF;
+        packets[index].result = 0xBAD;
+    }
+    result = aead_cipher_encrypt_batch(alg, packets, 3);
+    for (index = 0; index < 3; ++index) {
+        if (result != 0 || packets[index].result != 0 ||
+                packets[index].outlen != expected_len[index] ||
+                !test_compare(out, packets[index].out, expected[index],
+                              expected_len[index])) {
+            test_print_error(out, alg->name, vec, "batch encryption failed");
+            free(ctx);
+            free(temp);
+            free(short_ct);
+            free(corrupt);
+            return 0;
+        }
+    }
+
+    /* Test decryption, with the middle packet's ciphertext corrupted */
+    memset(temp, 0xAA, ciphertext->size * 3);
+    memcpy(corrupt, ciphertext->data, ciphertext->size);
+    corrupt[0] ^= 0x01;
+    for (index = 0; index < 3; ++index) {
+        packets[index].in = (index == 1) ? corrupt : expected[index];
+        packets[index].inlen = expected_len[index];
+        packets[index].outlen = 0xBADBEEF;
+        packets[index].result = 0xBAD;
+    }
+    result = aead_cipher_decrypt_batch(alg, packets, 3);
+    for (index = 0; index < 3; index += 2) {
+        if (packets[index].result != 0 ||
+                packets[index].outlen != mlen[index] ||
+                !test_compare(out, packets[index].out, plaintext->data,
+                              mlen[index])) {
+            test_print_error(out, alg->name, vec, "batch decryption failed");
+            free(ctx);
+            free(temp);
+            free(short_ct);
+            free(corrupt);
+            return 0;
+        }
+    }
+    if (result != -1 || packets[1].result != -1 ||
+            !test_all_zeroes(packets[1].out, plaintext->size)) {
+        test_print_error
+            (out, alg->name, vec, "batch corrupt ciphertext check failed");
+        free(ctx);
+        free(temp);
+        free(short_ct);
+        free(corrupt);
+        return 0;
+    }
+    free(ctx);
+    free(temp);
+    free(short_ct);
+    free(corrupt);
+    return 1;
+}
+
+/* Test a cipher algorithm on a specific test vector using the STREAM
+ * layer, with segments that are smaller than most of the plaintexts */
+static int test_cipher_stream
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_string_t *plaintext, const test_string_t *ad)
+{
+    static size_t const segment_size = 7;
+    unsigned char segment_nonce[AEAD_STREAM_MAX_NONCE_LEN];
+    unsigned char *stream;
+    unsigned char *temp;
+    unsigned long long stream_len;
+    unsigned long long count;
+    unsigned long long index;
+    unsigned long long len;
+    void *ctx;
+    int result;
+
+    /* Set up the key context and the output buffers */
+    ctx = malloc(aead_cipher_context_size(alg));
+    stream_len = aead_stream_ciphertext_length
+        (alg, segment_size, plaintext->size);
+    stream = malloc(stream_len);
+    temp = malloc(stream_len);
+    if (!ctx || !stream || !temp)
+        exit(2);
+    aead_cipher_setup_key(alg, ctx, key->data);
+
+    /* Ciphers with short nonces or no separate tag must be rejected */
+    if (alg->nonce_len < AEAD_STREAM_NONCE_OVERHEAD ||
+            (alg->flags & AEAD_FLAG_NO_DETACHED_TAG) != 0) {
+        result = aead_stream_encrypt
+            (alg, stream, &len, plaintext->data, plaintext->size,
+             ad->data, ad->size, nonce->data, segment_size, ctx);
+        free(ctx);
+        free(stream);
+        free(temp);
+        if (result != -2) {
+            test_print_error
+                (out, alg->name, vec, "STREAM cipher was not rejected");
+            return 0;
+        }
+        return 1;
+    }
+
+    /* Test encryption of the whole object */
+    len = 0xBADBEEF;
+    result = aead_stream_encrypt
+        (alg, stream, &len, plaintext->data, plaintext->size,
+         ad->data, ad->size, nonce->data, segment_size, ctx);
+    count = aead_stream_segment_count(alg, segment_size, stream_len);
+    if (result != 0 || len != stream_len || count == 0) {
+        test_print_error(out, alg->name, vec, "STREAM encryption failed");
+        free(ctx);
+        free(stream);
+        free(temp);
+        return 0;
+    }
+
+    /* The first segment must be an ordinary packet with a derived nonce */
+    aead_stream_segment_nonce(alg, segment_nonce, nonce->data, 0, count == 1);
+    len = 0xBADBEEF;
+    result = aead_cipher_encrypt_with_context
+        (alg, temp, &len, plaintext->data,
+         plaintext->size < segment_size ? plaintext->size : segment_size,
+         ad->data, ad->size, 0, segment_nonce, ctx);
+    if (result != 0 || !test_compare(out, temp, stream, len)) {
+        test_print_error(out, alg->name, vec, "STREAM nonce check failed");
+        free(ctx);
+        free(stream);
+        free(temp);
+        return 0;
+    }
+
+    /* Test decryption of the whole object */
+    memset(temp, 0xAA, stream_len);
+    len = 0xBADBEEF;
+    result = aead_stream_decrypt
+        (alg, temp, &len, stream, stream_len, ad->data, ad->size,
+         nonce->data, segment_size, ctx);
+    if (result != 0 || len != plaintext->size ||
+            !test_compare(out, temp, plaintext->data, len)) {
+        test_print_error(out, alg->name, vec, "STREAM decryption failed");
+        free(ctx);
+        free(stream);
+        free(temp);
+        return 0;
+    }
+
+    /* Test random-access decryption of every segment, last one first */
+    for (index = count; index > 0; --index) {
+        memset(temp, 0xAA, stream_len);
+        len = 0xBADBEEF;
+        result = aead_stream_decrypt_at
+            (alg, temp, &len, stream, stream_len, ad->data, ad->size,
+             nonce->data, segment_size, index - 1, ctx);
+        if (result != 0 || (index < count && len != segment_size) ||
+                !test_compare(out, temp, plaintext->data +
+                              (index - 1) * segment_size, len)) {
+            test_print_error
+                (out, alg->name, vec, "STREAM random access failed");
+            free(ctx);
+            free(stream);
+            free(temp);
+            return 0;
+        }
+    }
+
+    /* Dropping the last segment must be detected */
+    if (count > 1) {
+        result = aead_stream_decrypt
+            (alg, temp, &len, stream, (count - 1) * (segment_size +
+             alg->tag_len), ad->data, ad->size, nonce->data,
+             segment_size, ctx);
+        if (result != -1 || len != 0) {
+            test_print_error
+                (out, alg->name, vec, "STREAM truncation not detected");
+            free(ctx);
+            free(stream);
+            free(temp);
+            return 0;
+        }
+    }
+    free(ctx);
+    free(stream);
+    free(temp);
+    return 1;
+}
+
+/* Test a cipher algorithm on a specific test vector using its incremental
+ * mode, feeding the input in uneven chunks */
+static int test_cipher_incremental
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out,
+     const test_string_t *key, const test_string_t *nonce,
+     const test_string_t *plaintext, const test_string_t *ciphertext,
+     const test_string_t *ad, unsigned char *temp1, unsigned char *temp2)
+{
+    static size_t const chunks[] = {1, 0, 7, 33, 2, 16, 5};
+    const aead_cipher_incremental_t *inc = alg->incremental;
+    void *state;
+    size_t posn, len, index;
+    int result;
+
+    /* Bail out if the cipher does not have an incremental mode */
+    if (!inc)
+        return 1;
+    state = malloc(inc->state_size);
+    if (!state)
+        exit(2);
+
+    /* Test encryption */
+    memset(temp1, 0xAA, ciphertext->size);
+    (*(inc->init))(state, nonce->data, key->data);
+    for (posn = 0, index = 0; posn < ad->size; posn += len, ++index) {
+        len = chunks[index % (sizeof(chunks) / sizeof(chunks[0]))];
+        if (len > (ad->size - posn))
+            len = ad->size - posn;
+        (*(inc->update_ad))(state, ad->data + posn, len);
+    }
+    for (posn = 0; posn < plaintext->size; posn += len, ++index) {
+        len = chunks[index % (sizeof(chunks) / sizeof(chunks[0]))];
+        if (len > (plaintext->size - posn))
+            len = plaintext->size - posn;
+        (*(inc->encrypt_update))
+            (state, temp1 + posn, plaintext->data + posn, len);
+    }
+    (*(inc->encrypt_final))(state, temp1 + plaintext->size);
+    if (!test_compare(out, temp1, ciphertext->data, ciphertext->size)) {
+        test_print_error(out, alg->name, vec, "incremental encryption failed");
+        free(state);
+        return 0;
+    }
+
+    /* Test in-place decryption */
+    memcpy(temp1, ciphertext->data, ciphertext->size);
+    (*(inc->init))(state, nonce->data, key->data);
+    (*(inc->update_ad))(state, ad->data, ad->size);
+    for (posn = 0, index = 3; posn < plaintext->size; posn += len, ++index) {
+        len = chunks[index % (sizeof(chunks) / sizeof(chunks[0]))];
+        if (len > (plaintext->size - posn))
+            len = plaintext->size - posn;
+        (*(inc->decrypt_update))(state, temp1 + posn, temp1 + posn, len);
+    }
+    result = (*(inc->decrypt_final))(state, temp1 + plaintext->size);
+    if (result != 0 ||
+            !test_compare(out, temp1, plaintext->data, plaintext->size)) {
+        test_print_error(out, alg->name, vec, "incremental decryption failed");
+        free(state);
+        return 0;
+    }
+
+    /* Test decryption with a failed tag check */
+    memcpy(temp2, ciphertext->data, ciphertext->size);
+    temp2[ciphertext->size - 1] ^= 0x01;
+    (*(inc->init))(state, nonce->data, key->data);
+    (*(inc->update_ad))(state, ad->data, ad->size);
+    (*(inc->decrypt_update))(state, temp1, temp2, plaintext->size);
+    result = (*(inc->decrypt_final))(state, temp2 + plaintext->size);
+    if (result != -1) {
+        test_print_error
+            (out, alg->name, vec, "incremental corrupt tag check failed");
+        free(state);
+        return 0;
+    }
+    free(state);
+    return 1;
+}
+
 /* Test a cipher algorithm on a specific test vector */
 static int test_cipher_inner
-    (const aead_cipher_t *alg, const test_vector_t *vec)
+    (const aead_cipher_t *alg, const test_vector_t *vec, FILE *out)
 {
     const test_string_t *key;
     const test_string_t *nonce;
@@ -199,25 +1002,31 @@ static int test_cipher_inner
     unsigned char *temp1;
     unsigned char *temp2;
     unsigned long long len;
+    unsigned schedule;
     int result;
 
     /* Get the parameters for the test */
-    key = get_test_string(vec, "Key");
-    nonce = get_test_string(vec, "Nonce");
-    plaintext = get_test_string(vec, "PT");
-    ciphertext = get_test_string(vec, "CT");
-    ad = get_test_string(vec, "AD");
+    key = get_test_string(vec, "Key", out);
+    nonce = get_test_string(vec, "Nonce", out);
+    plaintext = get_test_string(vec, "PT", out);
+    ciphertext = get_test_string(vec, "CT", out);
+    ad = get_test_string(vec, "AD", out);
+    if (!key || !nonce || !plaintext || !ciphertext || !ad)
+        return 0;
     if (key->size != alg->key_len) {
-        test_print_error(alg->name, vec, "incorrect key size in test data");
+        test_print_error
+            (out, alg->name, vec, "incorrect key size in test data");
         return 0;
     }
     if (nonce->size != alg->nonce_len) {
-        test_print_error(alg->name, vec, "incorrect nonce size in test data");
+        test_print_error
+            (out, alg->name, vec, "incorrect nonce size in test data");
         return 0;
     }
     /* Check doesn't work for SATURNIN-Short - disable it.
     if (ciphertext->size != (plaintext->size + alg->tag_len)) {
-        test_print_error(alg->name, vec, "incorrect tag size in test data");
+        test_print_error
+            (out, alg->name, vec, "incorrect tag size in test data");
         return 0;
     }*/
 
@@ -236,8 +1045,8 @@ static int test_cipher_inner
         (temp1, &len, plaintext->data, plaintext->size,
          ad->data, ad->size, 0, nonce->data, key->data);
     if (result != 0 || len != ciphertext->size ||
-            !test_compare(temp1, ciphertext->data, len)) {
-        test_print_error(alg->name, vec, "encryption failed");
+            !test_compare(out, temp1, ciphertext->data, len)) {
+        test_print_error(out, alg->name, vec, "encryption failed");
         free(temp1);
         free(temp2);
         return 0;
@@ -251,8 +1060,8 @@ static int test_cipher_inner
         (temp1, &len, temp1, plaintext->size,
          ad->size ? ad->data : 0, ad->size, 0, nonce->data, key->data);
     if (result != 0 || len != ciphertext->size ||
-            !test_compare(temp1, ciphertext->data, len)) {
-        test_print_error(alg->name, vec, "in-place encryption failed");
+            !test_compare(out, temp1, ciphertext->data, len)) {
+        test_print_error(out, alg->name, vec, "in-place encryption failed");
         free(temp1);
         free(temp2);
         return 0;
@@ -265,8 +1074,8 @@ static int test_cipher_inner
         (temp1, &len, 0, ciphertext->data, ciphertext->size,
          ad->data, ad->size, nonce->data, key->data);
     if (result != 0 || len != plaintext->size ||
-            !test_compare(temp1, plaintext->data, len)) {
-        test_print_error(alg->name, vec, "decryption failed");
+            !test_compare(out, temp1, plaintext->data, len)) {
+        test_print_error(out, alg->name, vec, "decryption failed");
         free(temp1);
         free(temp2);
         return 0;
@@ -279,8 +1088,69 @@ static int test_cipher_inner
         (temp1, &len, 0, temp1, ciphertext->size,
          ad->data, ad->size, nonce->data, key->data);
     if (result != 0 || len != plaintext->size ||
-            !test_compare(temp1, plaintext->data, len)) {
-        test_print_error(alg->name, vec, "in-place decryption failed");
+            !test_compare(out, temp1, plaintext->data, len)) {
+        test_print_error(out, alg->name, vec, "in-place decryption failed");
+        free(temp1);
+        free(temp2);
+        return 0;
+    }
+
+    /* Test encryption and decryption with a key context, for every
+     * key schedule variant if the cipher has more than one */
+    for (schedule = AEAD_SCHEDULE_DEFAULT; schedule <= AEAD_SCHEDULE_TINY;
+            ++schedule) {
+        if (schedule != AEAD_SCHEDULE_DEFAULT && !alg->setup_key_schedule)
+            break;
+        if (!test_cipher_context(alg, vec, out, key, nonce, plaintext,
+                                 ciphertext, ad, temp1, schedule)) {
+            free(temp1);
+            free(temp2);
+            return 0;
+        }
+    }
+
+    /* Test encryption and decryption with scatter/gather segments */
+    if (!test_cipher_vec(alg, vec, out, key, nonce, plaintext,
+                         ciphertext, ad, temp1, temp2)) {
+        free(temp1);
+        free(temp2);
+        return 0;
+    }
+
+    /* Test in-place encryption and decryption with a detached tag */
+    if (!test_cipher_detached(alg, vec, out, key, nonce, plaintext,
+                              ciphertext, ad, temp1, temp2)) {
+        free(temp1);
+        free(temp2);
+        return 0;
+    }
+
+    /* Test large fragmented packets once for each cipher */
+    if (vec->test_number == 1 &&
+            !test_cipher_large(alg, vec, out, key, nonce)) {
+        free(temp1);
+        free(temp2);
+        return 0;
+    }
+
+    /* Test encryption and decryption with the incremental mode */
+    if (!test_cipher_incremental(alg, vec, out, key, nonce, plaintext,
+                                 ciphertext, ad, temp1, temp2)) {
+        free(temp1);
+        free(temp2);
+        return 0;
+    }
+
+    /* Test encryption and decryption of several packets in a batch */
+    if (!test_cipher_batch(alg, vec, out, key, nonce, plaintext,
+                           ciphertext, ad)) {
+        free(temp1);
+        free(temp2);
+        return 0;
+    }
+
+    /* Test segmented encryption and decryption with the STREAM layer */
+    if (!test_cipher_stream(alg, vec, out, key, nonce, plaintext, ad)) {
         free(temp1);
         free(temp2);
         return 0;
@@ -295,13 +1165,14 @@ static int test_cipher_inner
         (temp1, &len, 0, temp2, ciphertext->size,
          ad->data, ad->size, nonce->data, key->data);
     if (result != -1) {
-        test_print_error(alg->name, vec, "corrupt ciphertext check failed");
+        test_print_error
+            (out, alg->name, vec, "corrupt ciphertext check failed");
         free(temp1);
         free(temp2);
         return 0;
     }
     if (!test_all_zeroes(temp1, plaintext->size)) {
-        test_print_error(alg->name, vec, "plaintext not destroyed");
+        test_print_error(out, alg->name, vec, "plaintext not destroyed");
         free(temp1);
         free(temp2);
         return 0;
@@ -314,13 +1185,13 @@ static int test_cipher_inner
         (temp1, &len, 0, temp2, ciphertext->size,
          ad->data, ad->size, nonce->data, key->data);
     if (result != -1) {
-        test_print_error(alg->name, vec, "corrupt tag check failed");
+        test_print_error(out, alg->name, vec, "corrupt tag check failed");
         free(temp1);
         free(temp2);
         return 0;
     }
     if (!test_all_zeroes(temp1, plaintext->size)) {
-        test_print_error(alg->name, vec, "plaintext not destroyed");
+        test_print_error(out, alg->name, vec, "plaintext not destroyed");
         free(temp1);
         free(temp2);
         return 0;
@@ -333,28 +1204,28 @@ static int test_cipher_inner
 }
 
 /* Test a cipher algorithm */
-static int test_cipher(const aead_cipher_t *alg, FILE *file)
+static int test_cipher
+    (const aead_cipher_t *alg, test_file_t *file, FILE *out)
 {
     test_vector_t vec;
     int success = 0;
     int fail = 0;
     while (test_vector_read(&vec, file)) {
-        if (test_cipher_inner(alg, &vec))
+        if (test_cipher_inner(alg, &vec, out))
             ++success;
         else
             ++fail;
-        test_vector_free(&vec);
     }
-    printf("%s: %d tests succeeded, %d tests failed\n",
-           alg->name, success, fail);
+    fprintf(out, "%s: %d tests succeeded, %d tests failed\n",
+            alg->name, success, fail);
     return fail != 0;
 }
 
 /* Test a hash algorithm on a specific test vector */
 static int test_hash_inner
-    (const aead_hash_algorithm_t *alg, const test_vector_t *vec)
+    (const aead_hash_algorithm_t *alg, const test_vector_t *vec, FILE *out)
 {
-    unsigned char out[alg->hash_len];
+    unsigned char digest[alg->hash_len];
     void *state;
     const test_string_t *msg;
     const test_string_t *md;
@@ -363,22 +1234,26 @@ static int test_hash_inner
     size_t inc;
 
     /* Get the parameters for the test */
-    msg = get_test_string(vec, "Msg");
-    md = get_test_string(vec, "MD");
+    msg = get_test_string(vec, "Msg", out);
+    md = get_test_string(vec, "MD", out);
+    if (!msg || !md)
+        return 0;
     if (md->size != alg->hash_len) {
-        test_print_error(alg->name, vec, "incorrect hash size in test data");
+        test_print_error
+            (out, alg->name, vec, "incorrect hash size in test data");
         return 0;
     }
 
     /* Hash the input message with the all-in-one function */
-    memset(out, 0xAA, alg->hash_len);
-    result = (*(alg->hash))(out, msg->data, msg->size);
+    memset(digest, 0xAA, alg->hash_len);
+    result = (*(alg->hash))(digest, msg->data, msg->size);
     if (result != 0) {
-        test_print_error(alg->name, vec, "all-in-one hash returned %d", result);
+        test_print_error
+            (out, alg->name, vec, "all-in-one hash returned %d", result);
         return 0;
     }
-    if (!test_compare(out, md->data, md->size)) {
-        test_print_error(alg->name, vec, "all-in-one hash failed");
+    if (!test_compare(out, digest, md->data, md->size)) {
+        test_print_error(out, alg->name, vec, "all-in-one hash failed");
         return 0;
     }
 
@@ -399,10 +1274,11 @@ static int test_hash_inner
                     temp = inc;
                 (*(alg->update))(state, msg->data + index, temp);
             }
-            memset(out, 0xAA, alg->hash_len);
-            (*(alg->finalize))(state, out);
-            if (!test_compare(out, md->data, md->size)) {
-                test_print_error(alg->name, vec, "incremental hash failed");
+            memset(digest, 0xAA, alg->hash_len);
+            (*(alg->finalize))(state, digest);
+            if (!test_compare(out, digest, md->data, md->size)) {
+                test_print_error
+                    (out, alg->name, vec, "incremental hash failed");
                 free(state);
                 return 0;
             }
@@ -418,10 +1294,11 @@ static int test_hash_inner
                     temp = inc;
                 (*(alg->absorb))(state, msg->data + index, temp);
             }
-            memset(out, 0xAA, alg->hash_len);
-            (*(alg->squeeze))(state, out, alg->hash_len);
-            if (!test_compare(out, md->data, md->size)) {
-                test_print_error(alg->name, vec, "incremental absorb failed");
+            memset(digest, 0xAA, alg->hash_len);
+            (*(alg->squeeze))(state, digest, alg->hash_len);
+            if (!test_compare(out, digest, md->data, md->size)) {
+                test_print_error
+                    (out, alg->name, vec, "incremental absorb failed");
                 free(state);
                 return 0;
             }
@@ -431,15 +1308,16 @@ static int test_hash_inner
         for (inc = 1; inc <= md->size; ADVANCE_INC(inc)) {
             (*(alg->init))(state);
             (*(alg->absorb))(state, msg->data, msg->size);
-            memset(out, 0xAA, alg->hash_len);
+            memset(digest, 0xAA, alg->hash_len);
             for (index = 0; index < md->size; index += inc) {
                 size_t temp = md->size - index;
                 if (temp > inc)
                     temp = inc;
-                (*(alg->squeeze))(state, out + index, temp);
+                (*(alg->squeeze))(state, digest + index, temp);
             }
-            if (!test_compare(out, md->data, md->size)) {
-                test_print_error(alg->name, vec, "incremental squeeze failed");
+            if (!test_compare(out, digest, md->data, md->size)) {
+                test_print_error
+                    (out, alg->name, vec, "incremental squeeze failed");
                 free(state);
                 return 0;
             }
@@ -452,29 +1330,241 @@ static int test_hash_inner
 }
 
 /* Test a hash algorithm */
-static int test_hash(const aead_hash_algorithm_t *alg, FILE *file)
+static int test_hash
+    (const aead_hash_algorithm_t *alg, test_file_t *file, FILE *out)
 {
     test_vector_t vec;
     int success = 0;
     int fail = 0;
     while (test_vector_read(&vec, file)) {
-        if (test_hash_inner(alg, &vec))
+        if (test_hash_inner(alg, &vec, out))
             ++success;
         else
             ++fail;
-        test_vector_free(&vec);
     }
-    printf("%s: %d tests succeeded, %d tests failed\n",
-           alg->name, success, fail);
+    fprintf(out, "%s: %d tests succeeded, %d tests failed\n",
+            alg->name, success, fail);
     return fail != 0;
 }
 
-int main(int argc, char *argv[])
+/* Runs the KAT vectors in a file against an algorithm */
+static int test_algorithm
+    (const char *alg_name, test_file_t *file, FILE *out)
 {
     const aead_cipher_t *cipher;
     const aead_hash_algorithm_t *hash;
-    int exit_val;
+
+    /* Look for a cipher with the specified name */
+    cipher = find_cipher(alg_name);
+    if (cipher)
+        return test_cipher(cipher, file, out);
+
+    /* Look for a hash algorithm with the specified name */
+    hash = find_hash_algorithm(alg_name);
+    if (hash)
+        return test_hash(hash, file, out);
+
+    /* Unknown algorithm name */
+    fprintf(out, "Unknown algorithm '%s'\n", alg_name);
+    return 1;
+}
+
+/* Compares the output of "kat-gen" with a KAT file, ignoring the
+ * carriage returns at the ends of lines in the file */
+static int test_generate
+    (const char *kat_gen, const char *alg_name, const char *options,
+     const char *filename, const test_file_t *file, FILE *out)
+{
+    char command[1024];
+    char buffer[8192];
+    FILE *gen;
+    size_t posn = 0;
+    size_t len, index;
+    int line = 1;
+    int same = 1;
+    snprintf(command, sizeof(command), "%s %s '%s' -",
+             kat_gen, options, alg_name);
+    if ((gen = popen(command, "r")) == NULL) {
+        fprintf(out, "%s: could not run '%s'\n", alg_name, command);
+        return 1;
+    }
+    while (same && (len = fread(buffer, 1, sizeof(buffer), gen)) > 0) {
+        for (index = 0; index < len; ++index) {
+            if (buffer[index] == '\n' && posn < file->size &&
+                    file->data[posn] == '\r')
+                ++posn;
+            if (posn >= file->size || file->data[posn] != buffer[index]) {
+                same = 0;
+                break;
+            }
+            if (buffer[index] == '\n')
+                ++line;
+            ++posn;
+        }
+    }
+    while (fread(buffer, 1, sizeof(buffer), gen) > 0)
+        ; /* Drain the rest of the output before closing the pipe */
+    if (pclose(gen) != 0) {
+        fprintf(out, "******* '%s' failed\n", command);
+        return 1;
+    }
+    if (posn < file->size && file->data[posn] == '\r')
+        ++posn;
+    if (same && posn == file->size)
+        return 0;
+    fprintf(out, "******* KAT vectors for %s were not generated correctly\n",
+            alg_name);
+    fprintf(out, "******* Generated output differs from %s at line %d\n",
+            filename, line);
+    return 1;
+}
+
+/* Job for checking one algorithm against one KAT file */
+typedef struct
+{
+    char *alg_name;         /* Name of the algorithm to test */
+    char *filename;         /* Name of the KAT file */
+    char *options;          /* Options to pass to kat-gen */
+    char *output;           /* Buffered output from running the job */
+    size_t output_len;      /* Length of the buffered output */
+    int result;             /* Exit status for the job */
+
+} test_job_t;
+
+/* Queue of jobs to be processed by the thread pool */
+static test_job_t *jobs = 0;
+static int num_jobs = 0;
+static int next_job = 0;
+static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static const char *kat_gen = "./kat-gen";
+static int generate = 1;
+
+/* Runs a single job, collecting its output in memory */
+static void test_job_run(test_job_t *job)
+{
+    test_file_t file;
+    FILE *out = open_memstream(&(job->output), &(job->output_len));
+    if (!out)
+        exit(2);
+    if (!test_file_open(&file, job->filename)) {
+        fprintf(out, "%s: could not open %s\n", job->alg_name, job->filename);
+        job->result = 1;
+    } else {
+        job->result = test_algorithm(job->alg_name, &file, out);
+        if (job->result == 0 && generate) {
+            job->result = test_generate
+                (kat_gen, job->alg_name, job->options,
+                 job->filename, &file, out);
+        }
+        test_file_close(&file);
+    }
+    fclose(out);
+}
+
+/* Main function for a thread in the pool: pull jobs until none are left */
+static void *test_worker(void *arg)
+{
+    (void)arg;
+    for (;;) {
+        int index;
+        pthread_mutex_lock(&job_mutex);
+        index = next_job++;
+        pthread_mutex_unlock(&job_mutex);
+        if (index >= num_jobs)
+            break;
+        test_job_run(&(jobs[index]));
+    }
+    return 0;
+}
+
+/* Loads the jobs from a list file with "ALG FILE [kat-gen options]" lines */
+static int test_jobs_load(const char *filename)
+{
+    char line[1024];
     FILE *file;
+    int max_jobs = 0;
+    if ((file = fopen(filename, "r")) == NULL) {
+        perror(filename);
+        return 0;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        char *alg_name = strtok(line, " \t\r\n");
+        char *kat_file = strtok(0, " \t\r\n");
+        char *options = strtok(0, "\r\n");
+        if (!alg_name || alg_name[0] == '#')
+            continue;
+        if (!kat_file) {
+            fprintf(stderr, "%s: missing KAT file for %s\n",
+                    filename, alg_name);
+            fclose(file);
+            return 0;
+        }
+        if (num_jobs >= max_jobs) {
+            max_jobs = max_jobs ? max_jobs * 2 : 64;
+            jobs = (test_job_t *)realloc(jobs, max_jobs * sizeof(test_job_t));
+            if (!jobs)
+                exit(2);
+        }
+        memset(&(jobs[num_jobs]), 0, sizeof(test_job_t));
+        jobs[num_jobs].alg_name = strdup(alg_name);
+        jobs[num_jobs].filename = strdup(kat_file);
+        jobs[num_jobs].options = strdup(options ? options : "");
+        ++num_jobs;
+    }
+    fclose(file);
+    return 1;
+}
+
+/* Runs all jobs in a list file on a pool of threads */
+static int test_jobs_run(const char *filename, int num_threads)
+{
+    pthread_t *threads;
+    int index, failed = 0;
+    if (!test_jobs_load(filename))
+        return 1;
+    if (num_threads <= 0)
+        num_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (num_threads > num_jobs)
+        num_threads = num_jobs;
+    if (num_threads < 1)
+        num_threads = 1;
+    threads = (pthread_t *)calloc(num_threads, sizeof(pthread_t));
+    if (!threads)
+        exit(2);
+    for (index = 0; index < num_threads; ++index) {
+        if (pthread_create(&(threads[index]), 0, test_worker, 0) != 0) {
+            perror("pthread_create");
+            exit(2);
+        }
+    }
+    for (index = 0; index < num_threads; ++index)
+        pthread_join(threads[index], 0);
+    free(threads);
+
+    /* Report the results in the order of the list file */
+    for (index = 0; index < num_jobs; ++index) {
+        fwrite(jobs[index].output, 1, jobs[index].output_len, stdout);
+        if (jobs[index].result != 0)
+            ++failed;
+        free(jobs[index].alg_name);
+        free(jobs[index].filename);
+        free(jobs[index].options);
+        free(jobs[index].output);
+    }
+    free(jobs);
+    if (failed) {
+        printf("%d of %d KAT files failed\n", failed, num_jobs);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *list = 0;
+    int num_threads = 0;
+    test_file_t file;
+    int exit_val;
 
     /* If "--algorithms" is supplied, then list all supported algorithms */
     if (argc > 1 && !strcmp(argv[1], "--algorithms")) {
@@ -482,37 +1572,48 @@ int main(int argc, char *argv[])
         return 0;
     }
 
+    /* Process the options for running a list of KAT files */
+    while (argc > 1 && !strncmp(argv[1], "--", 2)) {
+        const char *name = argv[1] + 2;
+        if (!strncmp(name, "list=", 5)) {
+            list = name + 5;
+        } else if (!strncmp(name, "jobs=", 5)) {
+            num_threads = atoi(name + 5);
+        } else if (!strncmp(name, "kat-gen=", 8)) {
+            kat_gen = name + 8;
+        } else if (!strcmp(name, "no-generate")) {
+            generate = 0;
+        } else {
+            fprintf(stderr, "Unknown option '%s'\n", argv[1]);
+            return 1;
+        }
+        ++argv;
+        --argc;
+    }
+    if (list)
+        return test_jobs_run(list, num_threads);
+
     /* Check that we have all command-line arguments that we need */
     if (argc < 3) {
         fprintf(stderr, "Usage: %s Algorithm KAT-file\n", argv[0]);
+        fprintf(stderr, "       %s [--jobs=N] [--kat-gen=PROG] "
+                        "[--no-generate] --list=FILE\n", argv[0]);
         return 1;
     }
 
-    /* Open the KAT input file */
-    if ((file = fopen(argv[2], "r")) == NULL) {
-        perror(argv[2]);
+    /* Check that the algorithm name is valid */
+    if (!find_cipher(argv[1]) && !find_hash_algorithm(argv[1])) {
+        fprintf(stderr, "Unknown algorithm '%s'\n", argv[1]);
+        print_algorithm_names();
         return 1;
     }
 
-    /* Look for a cipher with the specified name */
-    cipher = find_cipher(argv[1]);
-    if (cipher) {
-        exit_val = test_cipher(cipher, file);
-        fclose(file);
-        return exit_val;
-    }
-
-    /* Look for a hash algorithm with the specified name */
-    hash = find_hash_algorithm(argv[1]);
-    if (hash) {
-        exit_val = test_hash(hash, file);
-        fclose(file);
-        return exit_val;
+    /* Map the KAT input file into memory and run the tests */
+    if (!test_file_open(&file, argv[2])) {
+        perror(argv[2]);
+        return 1;
     }
-
-    /* Unknown algorithm name */
-    fclose(file);
-    fprintf(stderr, "Unknown algorithm '%s'\n", argv[1]);
-    print_algorithm_names();
-    return 1;
+    exit_val = test_algorithm(argv[1], &file, stdout);
+    test_file_close(&file);
+    return exit_val;
 }
@@ -0,0 +1,1138 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#define _GNU_SOURCE
+#include "aead-common.h"
+#include "algorithms.h"
+#include "internal-blake2s.h"
+#include "internal-chachapoly.h"
+#include "perf-histogram.h"
+#include "perf-report.h"
+#include "perf-timer.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Maximum number of message or associated data sizes to test */
+#define MAX_SIZES 16
+
+/* Maximum tag size across all algorithms, to size the output buffer */
+#define MAX_TAG_SIZE 32
+
+/* Maximum hash output size across all algorithms */
+#define MAX_HASH_SIZE 64
+
+/* Command-line parameters */
+static unsigned long msg_sizes[MAX_SIZES] = {
+    0, 16, 64, 256, 1500, 65536, 1048576
+};
+static int num_msg_sizes = 7;
+static unsigned long ad_sizes[MAX_SIZES] = {
+    0, 16, 64, 256, 1500, 65536, 1048576
+};
+static int num_ad_sizes = 7;
+static uint64_t min_time = 0; /* Nanoseconds per measurement, 0 = default */
+static int max_threads = 0; /* Maximum threads for scaling tests, 0 = off */
+static unsigned long latency_calls = 0; /* Calls per latency test, 0 = off */
+static int msg_sizes_set = 0; /* Non-zero if --msg-sizes was supplied */
+static int count_calls = 0; /* Non-zero to count primitive calls */
+static int format = PERF_FORMAT_TEXT; /* Output format for the results */
+static const char *baseline_file = 0; /* Baseline to compare against */
+static int threshold_set = 0; /* Non-zero if --threshold was supplied */
+static int use_context = 0; /* Non-zero to encrypt with a key context */
+
+/* Default packet sizes and number of calls for latency tests */
+static unsigned long const latency_msg_sizes[] = {16, 32, 64, 128};
+#define DEFAULT_LATENCY_CALLS 20000UL
+
+/* Default measurement times for the single-threaded and scaling tests */
+#define DEFAULT_MIN_TIME 20000000ULL
+#define DEFAULT_THREAD_TIME 200000000ULL
+
+/* Buffers for the key, nonce, plaintext, ciphertext, and associated data */
+static unsigned char key[32];
+static unsigned char nonce[32];
+static unsigned char *plaintext = 0;
+static unsigned char *ciphertext = 0;
+static unsigned char *ad = 0;
+static unsigned long max_msg_size = 0;
+static unsigned long max_ad_size = 0;
+
+/* Key context for the cipher being measured in "--context" mode */
+static void *key_context = 0;
+
+/* Result of timing a single operation, per call */
+typedef struct
+{
+    double cycles;      /* Cycles per call, or < 0 if not supported */
+    unsigned long len;  /* Number of bytes processed by the call */
+
+} perf_result_t;
+
+/* Reference results for ChaChaPoly and BLAKE2s */
+static perf_result_t ref_encrypt[MAX_SIZES][MAX_SIZES];
+static perf_result_t ref_decrypt[MAX_SIZES][MAX_SIZES];
+static perf_result_t ref_hash[MAX_SIZES];
+
+/**
+ * \brief Parses a size with an optional K or M suffix.
+ *
+ * \param str Points to the string to parse.
+ * \param end Returns a pointer to the character after the size.
+ *
+ * \return The size that was parsed.
+ */
+static unsigned long parse_size(const char *str, char **end)
+{
+    unsigned long size = strtoul(str, end, 10);
+    if (**end == 'K' || **end == 'k') {
+        size *= 1024UL;
+        ++(*end);
+    } else if (**end == 'M' || **end == 'm') {
+        size *= 1024UL * 1024UL;
+        ++(*end);
+    }
+    return size;
+}
+
+/**
+ * \brief Parses a comma-separated list of sizes.
+ *
+ * \param str Points to the string to parse.
+ * \param sizes Returns the list of sizes.
+ *
+ * \return The number of sizes that were parsed, or zero on error.
+ */
+static int parse_size_list(const char *str, unsigned long *sizes)
+{
+    int count = 0;
+    char *end;
+    while (*str != '\0' && count < MAX_SIZES) {
+        sizes[count++] = parse_size(str, &end);
+        if (*end == ',')
+            ++end;
+        else if (*end != '\0')
+            return 0;
+        str = end;
+    }
+    return count;
+}
+
+/**
+ * \brief Prints usage information for this program.
+ *
+ * \param progname Name of the program from the argv[0] argument.
+ */
+static void usage(const char *progname)
+{
+    fprintf(stderr, "Usage: %s [options] [ALGORITHM ...]\n\n", progname);
+
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "    --msg-sizes=LIST\n");
+    fprintf(stderr, "        Comma-separated list of message sizes to test, with optional\n");
+    fprintf(stderr, "        K or M suffixes.  Default is 0,16,64,256,1500,64K,1M.\n\n");
+
+    fprintf(stderr, "    --ad-sizes=LIST\n");
+    fprintf(stderr, "        Comma-separated list of associated data sizes to test.\n");
+    fprintf(stderr, "        Default is 0,16,64,256,1500,64K,1M.\n\n");
+
+    fprintf(stderr, "    --min-time=MS\n");
+    fprintf(stderr, "        Minimum time to spend on each measurement in milliseconds,\n");
+    fprintf(stderr, "        default is 20, or 200 when measuring thread scaling.\n\n");
+
+    fprintf(stderr, "    --threads\n");
+    fprintf(stderr, "    --threads=N\n");
+    fprintf(stderr, "        Measure the aggregate throughput of 1 to N threads that are\n");
+    fprintf(stderr, "        encrypting and decrypting independent packets.  The default\n");
+    fprintf(stderr, "        for N is the number of online CPU cores.  The packet sizes are\n");
+    fprintf(stderr, "        taken from --msg-sizes and the first entry of --ad-sizes.\n\n");
+
+    fprintf(stderr, "    --context\n");
+    fprintf(stderr, "        Expand the key once with aead_cipher_setup_key() and then\n");
+    fprintf(stderr, "        measure encryption and decryption with the key context.\n\n");
+
+    fprintf(stderr, "    --count-calls\n");
+    fprintf(stderr, "        Report the number of calls to each block cipher, permutation,\n");
+    fprintf(stderr, "        and key setup function per packet and per byte.  The counters\n");
+    fprintf(stderr, "        only exist if the library was compiled with\n");
+    fprintf(stderr, "        -DAEAD_INSTRUMENT=1; otherwise this option reports an error.\n\n");
+
+    fprintf(stderr, "    --format=FORMAT\n");
+    fprintf(stderr, "        Output format: \"text\" (the default), \"csv\", or \"json\".\n");
+    fprintf(stderr, "        The csv and json formats write one record per result.\n\n");
+
+    fprintf(stderr, "    --baseline=FILE\n");
+    fprintf(stderr, "        Compare every result against a CSV file from a previous run\n");
+    fprintf(stderr, "        on the same machine with the same options.  Results that are\n");
+    fprintf(stderr, "        slower than the baseline by more than the threshold are\n");
+    fprintf(stderr, "        reported on stderr and the program exits with status 2.\n\n");
+
+    fprintf(stderr, "    --threshold=PERCENT\n");
+    fprintf(stderr, "        Percentage slowdown relative to --baseline that counts as a\n");
+    fprintf(stderr, "        regression, default is 5.\n\n");
+
+    fprintf(stderr, "    --latency\n");
+    fprintf(stderr, "    --latency=N\n");
+    fprintf(stderr, "        Time N individual encrypt and decrypt calls, default 20000,\n");
+    fprintf(stderr, "        and report the 50th, 99th, and 99.9th percentile and maximum\n");
+    fprintf(stderr, "        latency in cycles per call.  The packet sizes default to\n");
+    fprintf(stderr, "        16,32,64,128 unless --msg-sizes is given, and the first\n");
+    fprintf(stderr, "        entry of --ad-sizes is used for the associated data.\n\n");
+
+    fprintf(stderr, "If no algorithms are specified, then all algorithms are tested.\n");
+
+    print_algorithm_names();
+}
+
+/**
+ * \brief Parses the command-line parameters.
+ *
+ * \param argc Number of arguments.
+ * \param argv Array of arguments.
+ *
+ * \return The index of the first non-option argument, or zero on error.
+ */
+static int parse_command_line(int argc, char **argv)
+{
+    int index = 1;
+    while (index < argc && !strncmp(argv[index], "--", 2)) {
+        const char *name = argv[index++] + 2;
+        if (*name == '\0') /* "--" on its own terminates the options */
+            break;
+        if (!strncmp(name, "msg-sizes=", 10)) {
+            num_msg_sizes = parse_size_list(name + 10, msg_sizes);
+            if (!num_msg_sizes)
+                return 0;
+            msg_sizes_set = 1;
+            continue;
+        } else if (!strncmp(name, "ad-sizes=", 9)) {
+            num_ad_sizes = parse_size_list(name + 9, ad_sizes);
+            if (!num_ad_sizes)
+                return 0;
+            continue;
+        } else if (!strncmp(name, "min-time=", 9)) {
+            min_time = strtoul(name + 9, NULL, 10) * 1000000ULL;
+            continue;
+        } else if (!strcmp(name, "threads")) {
+            max_threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+            if (max_threads < 1)
+                max_threads = 1;
+            continue;
+        } else if (!strncmp(name, "threads=", 8)) {
+            max_threads = atoi(name + 8);
+            if (max_threads < 1)
+                return 0;
+            continue;
+        } else if (!strncmp(name, "format=", 7)) {
+            if (!strcmp(name + 7, "text"))
+                format = PERF_FORMAT_TEXT;
+            else if (!strcmp(name + 7, "csv"))
+                format = PERF_FORMAT_CSV;
+            else if (!strcmp(name + 7, "json"))
+                format = PERF_FORMAT_JSON;
+            else
+                return 0;
+            continue;
+        } else if (!strncmp(name, "baseline=", 9)) {
+            baseline_file = name + 9;
+            continue;
+        } else if (!strncmp(name, "threshold=", 10)) {
+            perf_report_set_threshold(atof(name + 10));
+            threshold_set = 1;
+            continue;
+        } else if (!strcmp(name, "context")) {
+            use_context = 1;
+            continue;
+        } else if (!strcmp(name, "count-calls")) {
+            count_calls = 1;
+            continue;
+        } else if (!strcmp(name, "latency")) {
+            latency_calls = DEFAULT_LATENCY_CALLS;
+            continue;
+        } else if (!strncmp(name, "latency=", 8)) {
+            latency_calls = strtoul(name + 8, NULL, 10);
+            if (!latency_calls)
+                return 0;
+            continue;
+        }
+        if (strcmp(name, "help") != 0)
+            fprintf(stderr, "Unknown option '--%s'\n", name);
+        return 0;
+    }
+    return index;
+}
+
+/**
+ * \brief Allocates the data buffers for the largest requested sizes.
+ */
+static void alloc_buffers(void)
+{
+    unsigned long index;
+    for (index = 0; index < (unsigned long)num_msg_sizes; ++index) {
+        if (msg_sizes[index] > max_msg_size)
+            max_msg_size = msg_sizes[index];
+    }
+    for (index = 0; index < (unsigned long)num_ad_sizes; ++index) {
+        if (ad_sizes[index] > max_ad_size)
+            max_ad_size = ad_sizes[index];
+    }
+    plaintext = (unsigned char *)malloc(max_msg_size + MAX_TAG_SIZE);
+    ciphertext = (unsigned char *)malloc(max_msg_size + MAX_TAG_SIZE);
+    ad = (unsigned char *)malloc(max_ad_size + 1);
+    if (!plaintext || !ciphertext || !ad)
+        exit(2);
+    for (index = 0; index < sizeof(key); ++index)
+        key[index] = (unsigned char)index;
+    for (index = 0; index < sizeof(nonce); ++index)
+        nonce[index] = (unsigned char)(0xA0 + index);
+    for (index = 0; index < max_msg_size; ++index)
+        plaintext[index] = (unsigned char)index;
+    for (index = 0; index < max_ad_size; ++index)
+        ad[index] = (unsigned char)(index * 7);
+}
+
+/**
+ * \brief Encrypts a packet from the plaintext buffer to the ciphertext buffer.
+ *
+ * \param cipher The cipher to use.
+ * \param clen Returns the length of the ciphertext.
+ * \param mlen Length of the plaintext.
+ * \param adlen Length of the associated data.
+ *
+ * \return Zero on success or non-zero if the sizes are not supported.
+ */
+static int perf_encrypt
+    (const aead_cipher_t *cipher, unsigned long long *clen,
+     unsigned long mlen, unsigned long adlen)
+{
+    if (key_context) {
+        return aead_cipher_encrypt_with_context
+            (cipher, ciphertext, clen, plaintext, mlen, ad, adlen,
+             0, nonce, key_context);
+    }
+    return (*(cipher->encrypt))
+        (ciphertext, clen, plaintext, mlen, ad, adlen, 0, nonce, key);
+}
+
+/**
+ * \brief Decrypts a packet from the ciphertext buffer to the plaintext buffer.
+ *
+ * \param cipher The cipher to use.
+ * \param plen Returns the length of the plaintext.
+ * \param clen Length of the ciphertext.
+ * \param adlen Length of the associated data.
+ *
+ * \return Zero on success or non-zero if decryption failed.
+ */
+static int perf_decrypt
+    (const aead_cipher_t *cipher, unsigned long long *plen,
+     unsigned long long clen, unsigned long adlen)
+{
+    if (key_context) {
+        return aead_cipher_decrypt_with_context
+            (cipher, plaintext, plen, 0, ciphertext, clen, ad, adlen,
+             nonce, key_context);
+    }
+    return (*(cipher->decrypt))
+        (plaintext, plen, 0, ciphertext, clen, ad, adlen, nonce, key);
+}
+
+/**
+ * \brief Measures the time taken to encrypt a packet.
+ *
+ * \param cipher The cipher to measure.
+ * \param mlen Length of the plaintext.
+ * \param adlen Length of the associated data.
+ *
+ * \return The average number of cycles per call.
+ */
+static perf_result_t perf_cipher_encrypt
+    (const aead_cipher_t *cipher, unsigned long mlen, unsigned long adlen)
+{
+    perf_result_t result;
+    unsigned long long clen;
+    unsigned long count, loops;
+    uint64_t start, end, start_ns, elapsed_ns;
+
+    /* Some algorithms limit the sizes they can process */
+    result.len = mlen + adlen;
+    result.cycles = -1;
+    if (perf_encrypt(cipher, &clen, mlen, adlen))
+        return result;
+
+    /* Keep doubling the number of loops until we hit the minimum time */
+    for (loops = 1;; loops *= 2) {
+        start_ns = perf_timer_nanos();
+        start = perf_timer_cycles();
+        for (count = 0; count < loops; ++count)
+            perf_encrypt(cipher, &clen, mlen, adlen);
+        end = perf_timer_cycles();
+        elapsed_ns = perf_timer_nanos() - start_ns;
+        if (elapsed_ns >= min_time)
+            break;
+    }
+    result.cycles = ((double)(end - start)) / loops;
+    return result;
+}
+
+/**
+ * \brief Measures the time taken to decrypt a packet.
+ *
+ * \param cipher The cipher to measure.
+ * \param mlen Length of the plaintext.
+ * \param adlen Length of the associated data.
+ *
+ * \return The average number of cycles per call.
+ */
+static perf_result_t perf_cipher_decrypt
+    (const aead_cipher_t *cipher, unsigned long mlen, unsigned long adlen)
+{
+    perf_result_t result;
+    unsigned long long clen;
+    unsigned long long plen;
+    unsigned long count, loops;
+    uint64_t start, end, start_ns, elapsed_ns;
+
+    /* Encrypt the packet first and check that decryption works */
+    result.len = mlen + adlen;
+    result.cycles = -1;
+    if (perf_encrypt(cipher, &clen, mlen, adlen))
+        return result;
+    if (perf_decrypt(cipher, &plen, clen, adlen))
+        return result;
+
+    /* Keep doubling the number of loops until we hit the minimum time */
+    for (loops = 1;; loops *= 2) {
+        start_ns = perf_timer_nanos();
+        start = perf_timer_cycles();
+        for (count = 0; count < loops; ++count)
+            perf_decrypt(cipher, &plen, clen, adlen);
+        end = perf_timer_cycles();
+        elapsed_ns = perf_timer_nanos() - start_ns;
+        if (elapsed_ns >= min_time)
+            break;
+    }
+    result.cycles = ((double)(end - start)) / loops;
+    return result;
+}
+
+/**
+ * \brief Measures the time taken to hash a message.
+ *
+ * \param hash The hash algorithm to measure.
+ * \param mlen Length of the message to hash.
+ *
+ * \return The average number of cycles per call.
+ */
+static perf_result_t perf_hash_message
+    (const aead_hash_algorithm_t *hash, unsigned long mlen)
+{
+    perf_result_t result;
+    unsigned char out[MAX_HASH_SIZE];
+    unsigned long count, loops;
+    uint64_t start, end, start_ns, elapsed_ns;
+
+    result.len = mlen;
+    result.cycles = -1;
+    if ((*(hash->hash))(out, plaintext, mlen))
+        return result;
+
+    /* Keep doubling the number of loops until we hit the minimum time */
+    for (loops = 1;; loops *= 2) {
+        start_ns = perf_timer_nanos();
+        start = perf_timer_cycles();
+        for (count = 0; count < loops; ++count)
+            (*(hash->hash))(out, plaintext, mlen);
+        end = perf_timer_cycles();
+        elapsed_ns = perf_timer_nanos() - start_ns;
+        if (elapsed_ns >= min_time)
+            break;
+    }
+    result.cycles = ((double)(end - start)) / loops;
+    return result;
+}
+
+/**
+ * \brief Prints a single result column.
+ *
+ * \param result The result to print.
+ * \param ref The reference result to compare against for the units.
+ */
+static void print_result(perf_result_t result, perf_result_t ref)
+{
+    if (format != PERF_FORMAT_TEXT)
+        return;
+    if (result.cycles < 0) {
+        printf("  %12s %10s %7s", "-", "-", "-");
+        return;
+    }
+    printf("  %12.0f", result.cycles);
+    if (result.len > 0)
+        printf(" %10.2f", result.cycles / result.len);
+    else
+        printf(" %10s", "-");
+    if (ref.cycles > 0 && result.cycles > 0)
+        printf(" %7.2f", ref.cycles / result.cycles);
+    else
+        printf(" %7s", "-");
+}
+
+/**
+ * \brief Adds a result to the machine-readable report.
+ *
+ * \param name Name of the algorithm.
+ * \param op Name of the operation.
+ * \param mlen Length of the message.
+ * \param adlen Length of the associated data.
+ * \param result The result to add.
+ * \param ref The reference result to compare against for the units.
+ */
+static void report_result
+    (const char *name, const char *op, unsigned long mlen,
+     unsigned long adlen, perf_result_t result, perf_result_t ref)
+{
+    if (result.cycles < 0)
+        return;
+    perf_report_record
+        (name, op, mlen, adlen, result.cycles,
+         (ref.cycles > 0 && result.cycles > 0) ? ref.cycles / result.cycles : 0);
+}
+
+/**
+ * \brief Measures and prints the performance of an AEAD cipher.
+ *
+ * \param cipher The cipher to measure.
+ * \param is_ref Non-zero if this is the ChaChaPoly reference cipher.
+ */
+static void perf_cipher(const aead_cipher_t *cipher, int is_ref)
+{
+    perf_result_t enc, dec;
+    int msg, adi;
+    const char *unit = perf_timer_unit();
+    if (use_context) {
+        key_context = malloc(aead_cipher_context_size(cipher));
+        if (!key_context)
+            exit(2);
+        aead_cipher_setup_key(cipher, key_context, key);
+    }
+    if (format == PERF_FORMAT_TEXT) {
+        printf("%s:\n", cipher->name);
+        printf("%10s %10s  %12s %10s %7s  %12s %10s %7s\n",
+               "Msg", "AD", "Encrypt", "per byte", "Units",
+               "Decrypt", "per byte", "Units");
+    }
+    for (msg = 0; msg < num_msg_sizes; ++msg) {
+        for (adi = 0; adi < num_ad_sizes; ++adi) {
+            enc = perf_cipher_encrypt(cipher, msg_sizes[msg], ad_sizes[adi]);
+            dec = perf_cipher_decrypt(cipher, msg_sizes[msg], ad_sizes[adi]);
+            if (is_ref) {
+                ref_encrypt[msg][adi] = enc;
+                ref_decrypt[msg][adi] = dec;
+            }
+            report_result(cipher->name, "encrypt", msg_sizes[msg],
+                          ad_sizes[adi], enc, ref_encrypt[msg][adi]);
+            report_result(cipher->name, "decrypt", msg_sizes[msg],
+                          ad_sizes[adi], dec, ref_decrypt[msg][adi]);
+            if (format != PERF_FORMAT_TEXT)
+                continue;
+            printf("%10lu %10lu", msg_sizes[msg], ad_sizes[adi]);
+            print_result(enc, ref_encrypt[msg][adi]);
+            print_result(dec, ref_decrypt[msg][adi]);
+            printf("\n");
+            fflush(stdout);
+        }
+    }
+    if (format == PERF_FORMAT_TEXT)
+        printf("(%s per packet, %s per byte, ChaChaPoly units)\n\n", unit, unit);
+    free(key_context);
+    key_context = 0;
+}
+
+/**
+ * \brief Measures and prints the performance of a hash algorithm.
+ *
+ * \param hash The hash algorithm to measure.
+ * \param is_ref Non-zero if this is the BLAKE2s reference algorithm.
+ */
+static void perf_hash(const aead_hash_algorithm_t *hash, int is_ref)
+{
+    perf_result_t result;
+    int msg;
+    const char *unit = perf_timer_unit();
+    if (format == PERF_FORMAT_TEXT) {
+        printf("%s:\n", hash->name);
+        printf("%10s %10s  %12s %10s %7s\n",
+               "Msg", "", "Hash", "per byte", "Units");
+    }
+    for (msg = 0; msg < num_msg_sizes; ++msg) {
+        result = perf_hash_message(hash, msg_sizes[msg]);
+        if (is_ref)
+            ref_hash[msg] = result;
+        report_result(hash->name, "hash", msg_sizes[msg], 0,
+                      result, ref_hash[msg]);
+        if (format != PERF_FORMAT_TEXT)
+            continue;
+        printf("%10lu %10s", msg_sizes[msg], "");
+        print_result(result, ref_hash[msg]);
+        printf("\n");
+        fflush(stdout);
+    }
+    if (format == PERF_FORMAT_TEXT)
+        printf("(%s per message, %s per byte, BLAKE2s units)\n\n", unit, unit);
+}
+
+/**
+ * \brief Prints the primitive calls that were made by an operation.
+ *
+ * \param mlen Length of the plaintext.
+ * \param adlen Length of the associated data.
+ * \param op Name of the operation.
+ */
+static void print_calls(unsigned long mlen, unsigned long adlen, const char *op)
+{
+    unsigned long calls;
+    unsigned long len = mlen + adlen;
+    int prim;
+    for (prim = 0; prim < AEAD_PRIMITIVE_COUNT; ++prim) {
+        calls = aead_instrument_get((aead_primitive_t)prim);
+        if (!calls)
+            continue;
+        printf("%10lu %10lu  %-8s %-28s %8lu", mlen, adlen, op,
+               aead_instrument_name((aead_primitive_t)prim), calls);
+        if (len > 0)
+            printf(" %10.4f\n", (double)calls / len);
+        else
+            printf(" %10s\n", "-");
+    }
+}
+
+/**
+ * \brief Counts and prints the primitive calls made by an AEAD cipher.
+ *
+ * \param cipher The cipher to measure.
+ */
+static void perf_count_calls(const aead_cipher_t *cipher)
+{
+    unsigned long long clen;
+    unsigned long long plen;
+    int msg, adi;
+    printf("%s:\n", cipher->name);
+    printf("%10s %10s  %-8s %-28s %8s %10s\n",
+           "Msg", "AD", "Op", "Primitive", "Calls", "per byte");
+    for (msg = 0; msg < num_msg_sizes; ++msg) {
+        for (adi = 0; adi < num_ad_sizes; ++adi) {
+            aead_instrument_reset();
+            if ((*(cipher->encrypt))
+                    (ciphertext, &clen, plaintext, msg_sizes[msg],
+                     ad, ad_sizes[adi], 0, nonce, key)) {
+                printf("%10lu %10lu  not supported\n",
+                       msg_sizes[msg], ad_sizes[adi]);
+                continue;
+            }
+            print_calls(msg_sizes[msg], ad_sizes[adi], "encrypt");
+            aead_instrument_reset();
+            (*(cipher->decrypt))
+                (plaintext, &plen, 0, ciphertext, clen,
+                 ad, ad_sizes[adi], nonce, key);
+            print_calls(msg_sizes[msg], ad_sizes[adi], "decrypt");
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * \brief Counts and prints the primitive calls made by a hash algorithm.
+ *
+ * \param hash The hash algorithm to measure.
+ */
+static void perf_count_hash_calls(const aead_hash_algorithm_t *hash)
+{
+    unsigned char out[MAX_HASH_SIZE];
+    int msg;
+    printf("%s:\n", hash->name);
+    printf("%10s %10s  %-8s %-28s %8s %10s\n",
+           "Msg", "", "Op", "Primitive", "Calls", "per byte");
+    for (msg = 0; msg < num_msg_sizes; ++msg) {
+        aead_instrument_reset();
+        (*(hash->hash))(out, plaintext, msg_sizes[msg]);
+        print_calls(msg_sizes[msg], 0, "hash");
+    }
+    printf("\n");
+}
+
+/* Histograms for the latency tests */
+static perf_histogram_t encrypt_hist;
+static perf_histogram_t decrypt_hist;
+
+/**
+ * \brief Measures the overhead of reading the cycle counter.
+ *
+ * \return The minimum overhead in cycles.
+ */
+static uint64_t perf_counter_overhead(void)
+{
+    uint64_t start, elapsed, overhead = ~((uint64_t)0);
+    int count;
+    for (count = 0; count < 1000; ++count) {
+        start = perf_timer_cycles();
+        elapsed = perf_timer_cycles() - start;
+        if (elapsed < overhead)
+            overhead = elapsed;
+    }
+    return overhead;
+}
+
+/**
+ * \brief Records the latency of a single call in a histogram.
+ *
+ * \param hist The histogram to record the latency in.
+ * \param elapsed The elapsed cycles for the call.
+ * \param overhead The overhead of reading the cycle counter.
+ */
+static void perf_record_latency
+    (perf_histogram_t *hist, uint64_t elapsed, uint64_t overhead)
+{
+    perf_histogram_record(hist, elapsed > overhead ? elapsed - overhead : 0);
+}
+
+/**
+ * \brief Prints the latency percentiles for a histogram.
+ *
+ * \param mlen Length of the plaintext.
+ * \param adlen Length of the associated data.
+ * \param op Name of the operation.
+ * \param hist The histogram to print.
+ */
+static void print_latency
+    (unsigned long mlen, unsigned long adlen, const char *op,
+     const perf_histogram_t *hist)
+{
+    printf("%10lu %10lu  %-8s %10llu %10llu %10llu %10llu\n",
+           mlen, adlen, op,
+           (unsigned long long)perf_histogram_percentile(hist, 50.0),
+           (unsigned long long)perf_histogram_percentile(hist, 99.0),
+           (unsigned long long)perf_histogram_percentile(hist, 99.9),
+           (unsigned long long)(hist->max));
+}
+
+/**
+ * \brief Measures and prints the per-call latency of an AEAD cipher.
+ *
+ * \param cipher The cipher to measure.
+ * \param overhead The overhead of reading the cycle counter.
+ */
+static void perf_latency(const aead_cipher_t *cipher, uint64_t overhead)
+{
+    unsigned long long clen;
+    unsigned long long plen;
+    unsigned long mlen;
+    unsigned long adlen = ad_sizes[0];
+    unsigned long count;
+    uint64_t start, elapsed;
+    int msg;
+
+    printf("%s:\n", cipher->name);
+    printf("%10s %10s  %-8s %10s %10s %10s %10s\n",
+           "Msg", "AD", "Op", "p50", "p99", "p99.9", "Max");
+    for (msg = 0; msg < num_msg_sizes; ++msg) {
+        mlen = msg_sizes[msg];
+        if ((*(cipher->encrypt))
+                (ciphertext, &clen, plaintext, mlen, ad, adlen,
+                 0, nonce, key)) {
+            printf("%10lu %10lu  not supported\n", mlen, adlen);
+            continue;
+        }
+
+        /* Time each encryption call individually */
+        perf_histogram_clear(&encrypt_hist);
+        for (count = 0; count < latency_calls; ++count) {
+            start = perf_timer_cycles();
+            (*(cipher->encrypt))
+                (ciphertext, &clen, plaintext, mlen, ad, adlen,
+                 0, nonce, key);
+            elapsed = perf_timer_cycles() - start;
+            perf_record_latency(&encrypt_hist, elapsed, overhead);
+        }
+
+        /* Time each decryption call individually */
+        perf_histogram_clear(&decrypt_hist);
+        for (count = 0; count < latency_calls; ++count) {
+            start = perf_timer_cycles();
+            (*(cipher->decrypt))
+                (plaintext, &plen, 0, ciphertext, clen, ad, adlen,
+                 nonce, key);
+            elapsed = perf_timer_cycles() - start;
+            perf_record_latency(&decrypt_hist, elapsed, overhead);
+        }
+
+        print_latency(mlen, adlen, "encrypt", &encrypt_hist);
+        print_latency(mlen, adlen, "decrypt", &decrypt_hist);
+        fflush(stdout);
+    }
+    printf("(%s per call over %lu calls)\n\n",
+           perf_timer_unit(), latency_calls);
+}
+
+/* State for a worker thread in the scaling test */
+typedef struct
+{
+    const aead_cipher_t *cipher;    /* Cipher to use */
+    unsigned long mlen;             /* Length of each packet's plaintext */
+    unsigned long adlen;            /* Length of each packet's AD */
+    int index;                      /* Index of this worker thread */
+    unsigned long long packets;     /* Number of packets processed */
+    int error;                      /* Non-zero if a packet failed */
+    pthread_t thread;               /* Thread identifier */
+
+} perf_worker_t;
+
+/* Synchronization between the main thread and the worker threads */
+static pthread_barrier_t worker_barrier;
+static int worker_stop = 0;
+
+/**
+ * \brief Main function for a worker thread in the scaling test.
+ *
+ * \param arg Points to the perf_worker_t state for the thread.
+ *
+ * \return NULL.
+ *
+ * Every worker has its own buffers, key, and nonce so that the only state
+ * shared between threads is whatever is hidden inside the library.
+ */
+static void *perf_worker(void *arg)
+{
+    perf_worker_t *worker = (perf_worker_t *)arg;
+    const aead_cipher_t *cipher = worker->cipher;
+    unsigned char wkey[32];
+    unsigned char wnonce[32];
+    unsigned char *pt;
+    unsigned char *ct;
+    unsigned char *wad;
+    unsigned long long clen, plen;
+    unsigned long long packets = 0;
+    unsigned long index;
+
+    /* Allocate and initialize the per-thread buffers */
+    pt = (unsigned char *)malloc(worker->mlen + MAX_TAG_SIZE);
+    ct = (unsigned char *)malloc(worker->mlen + MAX_TAG_SIZE);
+    wad = (unsigned char *)malloc(worker->adlen + 1);
+    if (!pt || !ct || !wad)
+        exit(2);
+    for (index = 0; index < sizeof(wkey); ++index)
+        wkey[index] = (unsigned char)(index + worker->index);
+    memset(wnonce, 0, sizeof(wnonce));
+    wnonce[0] = (unsigned char)(worker->index);
+    for (index = 0; index < worker->mlen; ++index)
+        pt[index] = (unsigned char)index;
+    for (index = 0; index < worker->adlen; ++index)
+        wad[index] = (unsigned char)(index * 7);
+
+    /* Wait for all threads to be ready, then encrypt and decrypt
+     * independent packets until we are told to stop */
+    pthread_barrier_wait(&worker_barrier);
+    while (!__atomic_load_n(&worker_stop, __ATOMIC_RELAXED)) {
+        /* Use a different nonce for every packet */
+        wnonce[1] = (unsigned char)packets;
+        wnonce[2] = (unsigned char)(packets >> 8);
+        wnonce[3] = (unsigned char)(packets >> 16);
+        (*(cipher->encrypt))
+            (ct, &clen, pt, worker->mlen, wad, worker->adlen,
+             0, wnonce, wkey);
+        if ((*(cipher->decrypt))
+                (pt, &plen, 0, ct, clen, wad, worker->adlen,
+                 wnonce, wkey) != 0) {
+            worker->error = 1;
+            break;
+        }
+        ++packets;
+    }
+    worker->packets = packets;
+
+    /* Clean up and exit */
+    free(pt);
+    free(ct);
+    free(wad);
+    return 0;
+}
+
+/**
+ * \brief Measures the aggregate throughput of a number of worker threads.
+ *
+ * \param cipher The cipher to measure.
+ * \param mlen Length of the plaintext for each packet.
+ * \param adlen Length of the associated data for each packet.
+ * \param num_threads Number of worker threads to run.
+ *
+ * \return The number of packets per second across all threads,
+ * or a negative value if one of the workers failed.
+ */
+static double perf_threads_run
+    (const aead_cipher_t *cipher, unsigned long mlen, unsigned long adlen,
+     int num_threads)
+{
+    perf_worker_t *workers;
+    unsigned long long packets = 0;
+    uint64_t start, elapsed;
+    struct timespec ts;
+    int index, error = 0;
+
+    workers = (perf_worker_t *)calloc(num_threads, sizeof(perf_worker_t));
+    if (!workers)
+        exit(2);
+    worker_stop = 0;
+    pthread_barrier_init(&worker_barrier, 0, num_threads + 1);
+    for (index = 0; index < num_threads; ++index) {
+        workers[index].cipher = cipher;
+        workers[index].mlen = mlen;
+        workers[index].adlen = adlen;
+        workers[index].index = index;
+        if (pthread_create(&(workers[index].thread), 0,
+                           perf_worker, &(workers[index])) != 0) {
+            perror("pthread_create");
+            exit(2);
+        }
+    }
+
+    /* Release the workers and let them run for the measurement time */
+    pthread_barrier_wait(&worker_barrier);
+    start = perf_timer_nanos();
+    ts.tv_sec = (time_t)(min_time / 1000000000ULL);
+    ts.tv_nsec = (long)(min_time % 1000000000ULL);
+    nanosleep(&ts, 0);
+    __atomic_store_n(&worker_stop, 1, __ATOMIC_RELAXED);
+    for (index = 0; index < num_threads; ++index) {
+        pthread_join(workers[index].thread, 0);
+        packets += workers[index].packets;
+        error |= workers[index].error;
+    }
+    elapsed = perf_timer_nanos() - start;
+    pthread_barrier_destroy(&worker_barrier);
+    free(workers);
+    if (error)
+        return -1;
+    return (packets * 1000000000.0) / elapsed;
+}
+
+/**
+ * \brief Measures and prints the thread scaling of an AEAD cipher.
+ *
+ * \param cipher The cipher to measure.
+ */
+static void perf_threads(const aead_cipher_t *cipher)
+{
+    unsigned long long clen;
+    unsigned long mlen;
+    unsigned long adlen = ad_sizes[0];
+    double rate, base;
+    int msg, threads;
+    for (msg = 0; msg < num_msg_sizes; ++msg) {
+        mlen = msg_sizes[msg];
+        printf("%s, %lu byte packets, %lu bytes of AD:\n",
+               cipher->name, mlen, adlen);
+        if ((*(cipher->encrypt))
+                (ciphertext, &clen, plaintext, mlen, ad, adlen,
+                 0, nonce, key)) {
+            printf("   not supported\n\n");
+            continue;
+        }
+        printf("%10s %14s %10s %10s\n",
+               "Threads", "Packets/s", "GB/s", "Scaling");
+        base = 0;
+        for (threads = 1; threads <= max_threads;) {
+            rate = perf_threads_run(cipher, mlen, adlen, threads);
+            if (rate < 0) {
+                printf("%10d   decryption failed\n", threads);
+                break;
+            }
+            if (threads == 1)
+                base = rate;
+            printf("%10d %14.0f %10.3f %10.2f\n", threads, rate,
+                   (rate * (mlen + adlen)) / 1e9,
+                   base > 0 ? rate / (base * threads) : 0.0);
+            fflush(stdout);
+            if (threads == max_threads)
+                break;
+            threads *= 2;
+            if (threads > max_threads)
+                threads = max_threads;
+        }
+        printf("(packets are encrypted and decrypted; scaling is relative\n"
+               " to perfect linear scaling of the single-threaded rate)\n\n");
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const aead_cipher_t *cipher;
+    const aead_hash_algorithm_t *hash;
+    int first, index, exit_val;
+
+    /* Parse the command-line options */
+    first = parse_command_line(argc, argv);
+    if (!first) {
+        usage(argv[0]);
+        return 1;
+    }
+    if ((count_calls || latency_calls || max_threads > 0) &&
+            (format != PERF_FORMAT_TEXT || baseline_file || threshold_set)) {
+        /* The other modes have their own output and do not produce
+         * results that can be compared against a baseline */
+        fprintf(stderr, "--format, --baseline, and --threshold cannot be "
+                        "combined with --count-calls, --latency, or "
+                        "--threads\n");
+        return 1;
+    }
+    if (latency_calls && !msg_sizes_set) {
+        num_msg_sizes = sizeof(latency_msg_sizes) / sizeof(unsigned long);
+        memcpy(msg_sizes, latency_msg_sizes, sizeof(latency_msg_sizes));
+    }
+    alloc_buffers();
+
+    /* Count primitive calls instead of measuring performance? */
+    if (count_calls) {
+        if (!aead_instrument_enabled()) {
+            fprintf(stderr, "The library was not compiled with "
+                            "-DAEAD_INSTRUMENT=1\n");
+            exit_val = 1;
+        } else if (first >= argc) {
+            exit_val = 0;
+            for (index = 0; (cipher = get_cipher(index)) != 0; ++index)
+                perf_count_calls(cipher);
+            for (index = 0; (hash = get_hash_algorithm(index)) != 0; ++index)
+                perf_count_hash_calls(hash);
+        } else {
+            exit_val = 0;
+            for (index = first; index < argc; ++index) {
+                if ((cipher = find_cipher(argv[index])) != 0) {
+                    perf_count_calls(cipher);
+                } else if ((hash = find_hash_algorithm(argv[index])) != 0) {
+                    perf_count_hash_calls(hash);
+                } else {
+                    fprintf(stderr, "Unknown algorithm '%s'\n", argv[index]);
+                    exit_val = 1;
+                }
+            }
+        }
+        free(plaintext);
+        free(ciphertext);
+        free(ad);
+        return exit_val;
+    }
+
+    /* Measure per-call latency instead of average performance? */
+    if (latency_calls) {
+        uint64_t overhead = perf_counter_overhead();
+        exit_val = 0;
+        if (first >= argc) {
+            for (index = 0; (cipher = get_cipher(index)) != 0; ++index)
+                perf_latency(cipher, overhead);
+        } else {
+            for (index = first; index < argc; ++index) {
+                if ((cipher = find_cipher(argv[index])) != 0) {
+                    perf_latency(cipher, overhead);
+                } else {
+                    fprintf(stderr, "Unknown cipher '%s'\n", argv[index]);
+                    exit_val = 1;
+                }
+            }
+        }
+        free(plaintext);
+        free(ciphertext);
+        free(ad);
+        return exit_val;
+    }
+
+    /* Measure thread scaling instead of single-threaded performance? */
+    if (max_threads > 0) {
+        if (!min_time)
+            min_time = DEFAULT_THREAD_TIME;
+        exit_val = 0;
+        if (first >= argc) {
+            for (index = 0; (cipher = get_cipher(index)) != 0; ++index)
+                perf_threads(cipher);
+        } else {
+            for (index = first; index < argc; ++index) {
+                if ((cipher = find_cipher(argv[index])) != 0) {
+                    perf_threads(cipher);
+                } else {
+                    fprintf(stderr, "Unknown cipher '%s'\n", argv[index]);
+                    exit_val = 1;
+                }
+            }
+        }
+        free(plaintext);
+        free(ciphertext);
+        free(ad);
+        return exit_val;
+    }
+    if (!min_time)
+        min_time = DEFAULT_MIN_TIME;
+    if (baseline_file && perf_report_load_baseline(baseline_file) < 0) {
+        free(plaintext);
+        free(ciphertext);
+        free(ad);
+        return 1;
+    }
+    perf_report_begin(format);
+
+    /* Measure the reference algorithms first to get the units */
+    perf_cipher(&internal_chachapoly_cipher, 1);
+    perf_hash(&internal_blake2s_hash_algorithm, 1);
+
+    /* Measure all algorithms or only those named on the command-line */
+    exit_val = 0;
+    if (first >= argc) {
+        for (index = 0; (cipher = get_cipher(index)) != 0; ++index)
+            perf_cipher(cipher, 0);
+        for (index = 0; (hash = get_hash_algorithm(index)) != 0; ++index)
+            perf_hash(hash, 0);
+    } else {
+        for (index = first; index < argc; ++index) {
+            if ((cipher = find_cipher(argv[index])) != 0) {
+                perf_cipher(cipher, 0);
+            } else if ((hash = find_hash_algorithm(argv[index])) != 0) {
+                perf_hash(hash, 0);
+            } else {
+                fprintf(stderr, "Unknown algorithm '%s'\n", argv[index]);
+                exit_val = 1;
+            }
+        }
+    }
+    perf_report_end();
+    if (perf_report_regressions() > 0) {
+        fprintf(stderr, "%d regressions compared with %s\n",
+                perf_report_regressions(), baseline_file);
+        if (!exit_val)
+            exit_val = 2;
+    }
+
+    /* Clean up and exit */
+    free(plaintext);
+    free(ciphertext);
+    free(ad);
+    return exit_val;
+}
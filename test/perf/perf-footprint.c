@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#define _GNU_SOURCE
+#include "aead-common.h"
+#include "algorithms.h"
+#include "internal-ascon.h"
+#include "internal-drysponge.h"
+#include "internal-forkskinny.h"
+#include "internal-gift128.h"
+#include "internal-gift64.h"
+#include "internal-grain128.h"
+#include "internal-keccak.h"
+#include "internal-knot.h"
+#include "internal-pyjamask.h"
+#include "internal-saturnin.h"
+#include "internal-skinny128.h"
+#include "internal-spongent.h"
+#include "internal-spook.h"
+#include "internal-subterranean.h"
+#include "internal-xoodoo.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <dlfcn.h>
+
+/* Size of the stack for measuring the stack depth of a call */
+#define FOOTPRINT_STACK_SIZE (256 * 1024)
+
+/* Value that the stack is painted with before the call */
+#define FOOTPRINT_PAINT 0xA5
+
+/* Message and associated data sizes for the measured calls.  Ciphers that
+ * cannot handle these sizes, such as SATURNIN-Short, use the short sizes */
+#define FOOTPRINT_MSG_SIZE 64
+#define FOOTPRINT_AD_SIZE 16
+#define FOOTPRINT_SHORT_MSG_SIZE 15
+#define FOOTPRINT_SHORT_AD_SIZE 0
+
+/* Maximum tag size across all algorithms, to size the output buffer */
+#define MAX_TAG_SIZE 32
+
+/* Maximum hash output size across all algorithms */
+#define MAX_HASH_SIZE 64
+
+/* Key schedules and states that are kept per session or per call */
+typedef struct
+{
+    const char *name;
+    size_t size;
+
+} footprint_struct_t;
+#define FOOTPRINT_STRUCT(type) {#type, sizeof(type)}
+static footprint_struct_t const structs[] = {
+    FOOTPRINT_STRUCT(ascon_state_t),
+    FOOTPRINT_STRUCT(drysponge128_state_t),
+    FOOTPRINT_STRUCT(drysponge256_state_t),
+    FOOTPRINT_STRUCT(forkskinny_128_256_state_t),
+    FOOTPRINT_STRUCT(forkskinny_128_384_state_t),
+    FOOTPRINT_STRUCT(forkskinny_64_192_state_t),
+    FOOTPRINT_STRUCT(gift128b_key_schedule_t),
+    FOOTPRINT_STRUCT(gift128n_key_schedule_t),
+    FOOTPRINT_STRUCT(gift64n_key_schedule_t),
+    FOOTPRINT_STRUCT(grain128_state_t),
+    FOOTPRINT_STRUCT(keccakp_200_state_t),
+    FOOTPRINT_STRUCT(keccakp_400_state_t),
+    FOOTPRINT_STRUCT(knot256_state_t),
+    FOOTPRINT_STRUCT(knot384_state_t),
+    FOOTPRINT_STRUCT(knot512_state_t),
+    FOOTPRINT_STRUCT(pyjamask_128_key_schedule_t),
+    FOOTPRINT_STRUCT(pyjamask_96_key_schedule_t),
+    FOOTPRINT_STRUCT(pyjamask_masked_128_key_schedule_t),
+    FOOTPRINT_STRUCT(pyjamask_masked_96_key_schedule_t),
+    FOOTPRINT_STRUCT(saturnin_key_schedule_t),
+    FOOTPRINT_STRUCT(shadow384_state_t),
+    FOOTPRINT_STRUCT(shadow512_state_t),
+    FOOTPRINT_STRUCT(skinny_128_256_key_schedule_t),
+    FOOTPRINT_STRUCT(skinny_128_384_key_schedule_t),
+    FOOTPRINT_STRUCT(spongent160_state_t),
+    FOOTPRINT_STRUCT(spongent176_state_t),
+    FOOTPRINT_STRUCT(subterranean_state_t),
+    FOOTPRINT_STRUCT(xoodoo_state_t),
+    {0, 0}
+};
+
+/* Stack frame size for a single function from the "-fstack-usage" output */
+typedef struct
+{
+    char *name;
+    unsigned long size;
+    int dynamic;
+
+} footprint_frame_t;
+static footprint_frame_t *frames = 0;
+static size_t num_frames = 0;
+static size_t max_frames = 0;
+
+/**
+ * \brief Loads the stack frame sizes from a "-fstack-usage" output file.
+ *
+ * \param filename Name of the ".su" file to load.
+ *
+ * Each line of the file has the form "file:line:column:function",
+ * followed by the frame size and the qualifiers, separated by tabs.
+ */
+static void load_frames(const char *filename)
+{
+    char line[1024];
+    FILE *file;
+    if ((file = fopen(filename, "r")) == NULL)
+        return;
+    while (fgets(line, sizeof(line), file)) {
+        char *location = strtok(line, "\t");
+        char *size = strtok(0, "\t");
+        char *qualifiers = strtok(0, "\r\n");
+        char *name;
+        if (!location || !size)
+            continue;
+        name = strrchr(location, ':');
+        name = name ? name + 1 : location;
+        if (num_frames >= max_frames) {
+            max_frames = max_frames ? max_frames * 2 : 256;
+            frames = (footprint_frame_t *)realloc
+                (frames, max_frames * sizeof(footprint_frame_t));
+            if (!frames)
+                exit(2);
+        }
+        frames[num_frames].name = strdup(name);
+        frames[num_frames].size = strtoul(size, 0, 10);
+        frames[num_frames].dynamic =
+            (qualifiers && strstr(qualifiers, "dynamic") != 0);
+        ++num_frames;
+    }
+    fclose(file);
+}
+
+/**
+ * \brief Loads all of the "-fstack-usage" output files in a directory.
+ *
+ * \param dirname Name of the directory containing the ".su" files.
+ */
+static void load_all_frames(const char *dirname)
+{
+    char filename[1024];
+    struct dirent *entry;
+    DIR *dir;
+    if ((dir = opendir(dirname)) == NULL)
+        return;
+    while ((entry = readdir(dir)) != NULL) {
+        size_t len = strlen(entry->d_name);
+        if (len > 3 && !strcmp(entry->d_name + len - 3, ".su")) {
+            snprintf(filename, sizeof(filename), "%s/%s",
+                     dirname, entry->d_name);
+            load_frames(filename);
+        }
+    }
+    closedir(dir);
+}
+
+/**
+ * \brief Finds the stack frame for a function.
+ *
+ * \param name Name of the function.
+ *
+ * \return The frame, or NULL if the function is not known.
+ */
+static const footprint_frame_t *find_frame(const char *name)
+{
+    size_t index;
+    for (index = 0; index < num_frames; ++index) {
+        if (!strcmp(frames[index].name, name))
+            return &(frames[index]);
+    }
+    return 0;
+}
+
+/* Call to be made on a measurement thread */
+typedef struct
+{
+    const aead_cipher_t *cipher;
+    const aead_hash_algorithm_t *hash;
+    int decrypt;
+    unsigned long mlen;
+    unsigned long adlen;
+    int result;
+
+} footprint_call_t;
+
+/* Buffers for the calls */
+static unsigned char key[32];
+static unsigned char nonce[32];
+static unsigned char plaintext[FOOTPRINT_MSG_SIZE + MAX_TAG_SIZE];
+static unsigned char ciphertext[FOOTPRINT_MSG_SIZE + MAX_TAG_SIZE];
+static unsigned char ad[FOOTPRINT_AD_SIZE];
+static unsigned char digest[MAX_HASH_SIZE];
+static unsigned long long clen;
+
+/**
+ * \brief Main function for a measurement thread.
+ *
+ * \param arg Points to the footprint_call_t to make, or NULL to make
+ * no call at all and measure the baseline for the thread itself.
+ *
+ * \return NULL.
+ */
+static void *footprint_thread(void *arg)
+{
+    footprint_call_t *call = (footprint_call_t *)arg;
+    unsigned long long len;
+    if (!call)
+        return 0;
+    if (call->hash) {
+        call->result = (*(call->hash->hash))(digest, plaintext, call->mlen);
+    } else if (call->decrypt) {
+        call->result = (*(call->cipher->decrypt))
+            (plaintext, &len, 0, ciphertext, clen,
+             ad, call->adlen, nonce, key);
+    } else {
+        call->result = (*(call->cipher->encrypt))
+            (ciphertext, &clen, plaintext, call->mlen,
+             ad, call->adlen, 0, nonce, key);
+    }
+    return 0;
+}
+
+/**
+ * \brief Measures the stack depth of a call, including all callees.
+ *
+ * \param call The call to make, or NULL for the baseline.
+ *
+ * \return The number of bytes of stack that were touched.
+ *
+ * The call is made on a thread whose stack has been painted with a
+ * known value.  Afterwards, the lowest byte that no longer has the
+ * paint value gives the deepest point that the stack reached.
+ */
+static size_t measure_stack(footprint_call_t *call)
+{
+    pthread_attr_t attr;
+    pthread_t thread;
+    unsigned char *stack;
+    size_t index;
+    if (posix_memalign((void **)&stack, 4096, FOOTPRINT_STACK_SIZE) != 0)
+        exit(2);
+    memset(stack, FOOTPRINT_PAINT, FOOTPRINT_STACK_SIZE);
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, stack, FOOTPRINT_STACK_SIZE);
+    if (pthread_create(&thread, &attr, footprint_thread, call) != 0) {
+        perror("pthread_create");
+        exit(2);
+    }
+    pthread_join(thread, 0);
+    pthread_attr_destroy(&attr);
+    for (index = 0; index < FOOTPRINT_STACK_SIZE; ++index) {
+        if (stack[index] != FOOTPRINT_PAINT)
+            break;
+    }
+    free(stack);
+    return FOOTPRINT_STACK_SIZE - index;
+}
+
+/* Stack depth of the measurement thread when no call is made */
+static size_t baseline = 0;
+
+/**
+ * \brief Prints a row of the footprint table for an entry point.
+ *
+ * \param alg_name Name of the algorithm.
+ * \param func Pointer to the entry point function.
+ * \param call The call to make to measure the stack depth.
+ * \param state_size Size of the per-session state, or zero if none.
+ *
+ * The call is made once on the main thread before it is measured so
+ * that lazy symbol binding does not add to the measured stack depth.
+ */
+static void print_entry_point
+    (const char *alg_name, void *func, footprint_call_t *call,
+     size_t state_size)
+{
+    const footprint_frame_t *frame = 0;
+    const char *func_name = "?";
+    char frame_size[32];
+    char state[32];
+    size_t depth;
+    Dl_info info;
+
+    /* Look up the name of the entry point and its stack frame */
+    if (dladdr(func, &info) && info.dli_sname) {
+        func_name = info.dli_sname;
+        frame = find_frame(func_name);
+    }
+    if (frame) {
+        snprintf(frame_size, sizeof(frame_size), "%lu%s",
+                 frame->size, frame->dynamic ? "+" : "");
+    } else {
+        strcpy(frame_size, "-");
+    }
+    if (state_size)
+        snprintf(state, sizeof(state), "%lu", (unsigned long)state_size);
+    else
+        strcpy(state, "-");
+
+    /* Measure the stack depth of a call to the entry point */
+    footprint_thread(call);
+    depth = measure_stack(call);
+    depth = (depth > baseline) ? depth - baseline : 0;
+
+    printf("%-36s %-36s %7s %7lu %7s\n", alg_name, func_name,
+           frame_size, (unsigned long)depth, state);
+}
+
+/**
+ * \brief Prints the footprint of an AEAD cipher.
+ *
+ * \param cipher The cipher.
+ */
+static void print_cipher(const aead_cipher_t *cipher)
+{
+    footprint_call_t call;
+    memset(&call, 0, sizeof(call));
+    call.cipher = cipher;
+    call.mlen = FOOTPRINT_MSG_SIZE;
+    call.adlen = FOOTPRINT_AD_SIZE;
+    footprint_thread(&call);
+    if (call.result != 0) {
+        call.mlen = FOOTPRINT_SHORT_MSG_SIZE;
+        call.adlen = FOOTPRINT_SHORT_AD_SIZE;
+    }
+    print_entry_point(cipher->name, (void *)(cipher->encrypt), &call, 0);
+    call.decrypt = 1;
+    print_entry_point(cipher->name, (void *)(cipher->decrypt), &call, 0);
+}
+
+/**
+ * \brief Prints the footprint of a hash algorithm.
+ *
+ * \param hash The hash algorithm.
+ */
+static void print_hash(const aead_hash_algorithm_t *hash)
+{
+    footprint_call_t call;
+    memset(&call, 0, sizeof(call));
+    call.hash = hash;
+    call.mlen = FOOTPRINT_MSG_SIZE;
+    print_entry_point(hash->name, (void *)(hash->hash), &call,
+                      hash->state_size);
+}
+
+/* Determine if an algorithm name matches one from the command-line */
+static int name_matches(const char *name, int argc, char *argv[], int first)
+{
+    int arg;
+    if (first >= argc)
+        return 1;
+    for (arg = first; arg < argc; ++arg) {
+        if (!strcmp(name, argv[arg]))
+            return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *su_dir = "../../build-footprint/combined";
+    const aead_cipher_t *cipher;
+    const aead_hash_algorithm_t *hash;
+    int first = 1;
+    int index;
+
+    /* Parse the command-line options */
+    while (first < argc && !strncmp(argv[first], "--", 2)) {
+        const char *name = argv[first++] + 2;
+        if (*name == '\0') {
+            break;
+        } else if (!strncmp(name, "su-dir=", 7)) {
+            su_dir = name + 7;
+        } else {
+            if (strcmp(name, "help") != 0)
+                fprintf(stderr, "Unknown option '--%s'\n", name);
+            fprintf(stderr, "Usage: %s [--su-dir=DIR] [algorithm ...]\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    /* Load the stack frame sizes that were produced by the compiler */
+    load_all_frames(su_dir);
+    if (num_frames == 0) {
+        fprintf(stderr, "No -fstack-usage output in %s; "
+                        "frame sizes will not be reported\n", su_dir);
+    }
+
+    /* Set up the inputs and measure the baseline for the thread */
+    for (index = 0; index < (int)sizeof(key); ++index) {
+        key[index] = (unsigned char)index;
+        nonce[index] = (unsigned char)(index + 32);
+    }
+    for (index = 0; index < FOOTPRINT_MSG_SIZE; ++index)
+        plaintext[index] = (unsigned char)index;
+    for (index = 0; index < FOOTPRINT_AD_SIZE; ++index)
+        ad[index] = (unsigned char)(index * 7);
+    baseline = measure_stack(0);
+
+    /* Print the table */
+    printf("%-36s %-36s %7s %7s %7s\n",
+           "Name", "Entry Point", "Frame", "Stack", "State");
+    for (index = 0; (cipher = get_cipher(index)) != 0; ++index) {
+        if (name_matches(cipher->name, argc, argv, first))
+            print_cipher(cipher);
+    }
+    for (index = 0; (hash = get_hash_algorithm(index)) != 0; ++index) {
+        if (name_matches(hash->name, argc, argv, first))
+            print_hash(hash);
+    }
+    for (index = 0; structs[index].name != 0; ++index) {
+        if (name_matches(structs[index].name, argc, argv, first)) {
+            printf("%-36s %-36s %7s %7s %7lu\n", structs[index].name,
+                   "-", "-", "-", (unsigned long)(structs[index].size));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "perf-histogram.h"
+#include <string.h>
+
+void perf_histogram_clear(perf_histogram_t *hist)
+{
+    memset(hist, 0, sizeof(perf_histogram_t));
+    hist->min = ~((uint64_t)0);
+}
+
+/* Maps a value to its bucket index */
+static unsigned perf_histogram_index(uint64_t value)
+{
+    unsigned shift;
+    if (value < PERF_HISTOGRAM_SUB_COUNT)
+        return (unsigned)value;
+    shift = 63 - __builtin_clzll(value) - PERF_HISTOGRAM_SUB_BITS;
+    return (shift + 1) * PERF_HISTOGRAM_SUB_COUNT +
+           (unsigned)((value >> shift) - PERF_HISTOGRAM_SUB_COUNT);
+}
+
+/* Maps a bucket index to the highest value that falls into the bucket */
+static uint64_t perf_histogram_value(unsigned index)
+{
+    unsigned shift, sub;
+    if (index < PERF_HISTOGRAM_SUB_COUNT)
+        return index;
+    shift = index / PERF_HISTOGRAM_SUB_COUNT - 1;
+    sub = index % PERF_HISTOGRAM_SUB_COUNT;
+    return ((((uint64_t)(PERF_HISTOGRAM_SUB_COUNT + sub)) << shift) +
+            (((uint64_t)1) << shift) - 1);
+}
+
+void perf_histogram_record(perf_histogram_t *hist, uint64_t value)
+{
+    ++(hist->counts[perf_histogram_index(value)]);
+    ++(hist->total);
+    if (value < hist->min)
+        hist->min = value;
+    if (value > hist->max)
+        hist->max = value;
+}
+
+uint64_t perf_histogram_percentile
+    (const perf_histogram_t *hist, double percentile)
+{
+    uint64_t target, count;
+    uint64_t value;
+    unsigned index;
+    if (!hist->total)
+        return 0;
+    target = (uint64_t)((percentile / 100.0) * hist->total + 0.5);
+    if (target < 1)
+        target = 1;
+    count = 0;
+    for (index = 0; index < PERF_HISTOGRAM_BUCKETS; ++index) {
+        count += hist->counts[index];
+        if (count >= target) {
+            /* Don't report more than the largest value actually seen */
+            value = perf_histogram_value(index);
+            return value < hist->max ? value : hist->max;
+        }
+    }
+    return hist->max;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PERF_HISTOGRAM_H
+#define PERF_HISTOGRAM_H
+
+#include <stdint.h>
+
+/* Number of bits of sub-bucket precision within each power of two.
+ * 5 bits gives 32 sub-buckets, for a worst-case error of about 3% */
+#define PERF_HISTOGRAM_SUB_BITS 5
+
+/* Number of sub-buckets within each power of two */
+#define PERF_HISTOGRAM_SUB_COUNT (1 << PERF_HISTOGRAM_SUB_BITS)
+
+/* Total number of buckets, enough for any 64-bit value */
+#define PERF_HISTOGRAM_BUCKETS \
+    ((64 - PERF_HISTOGRAM_SUB_BITS + 1) * PERF_HISTOGRAM_SUB_COUNT)
+
+/* HDR-style log-linear histogram of latency values.  Values less than
+ * PERF_HISTOGRAM_SUB_COUNT are recorded exactly; larger values are
+ * recorded with PERF_HISTOGRAM_SUB_BITS bits of precision */
+typedef struct
+{
+    uint64_t counts[PERF_HISTOGRAM_BUCKETS];
+    uint64_t total;
+    uint64_t min;
+    uint64_t max;
+
+} perf_histogram_t;
+
+/* Clears a histogram */
+void perf_histogram_clear(perf_histogram_t *hist);
+
+/* Records a single value in a histogram */
+void perf_histogram_record(perf_histogram_t *hist, uint64_t value);
+
+/* Gets the value at a given percentile (0 to 100) of a histogram.
+ * The highest value that is equivalent to the bucket is returned */
+uint64_t perf_histogram_percentile
+    (const perf_histogram_t *hist, double percentile);
+
+#endif
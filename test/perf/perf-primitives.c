@@ -0,0 +1,846 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#include "internal-ascon.h"
+#include "internal-cham.h"
+#include "internal-drysponge.h"
+#include "internal-forkskinny.h"
+#include "internal-gift128.h"
+#include "internal-gift64.h"
+#include "internal-gimli24.h"
+#include "internal-keccak.h"
+#include "internal-knot.h"
+#include "internal-photon256.h"
+#include "internal-pyjamask.h"
+#include "internal-saturnin.h"
+#include "internal-simp.h"
+#include "internal-skinny128.h"
+#include "internal-sliscp-light.h"
+#include "internal-sparkle.h"
+#include "internal-speck64.h"
+#include "internal-spongent.h"
+#include "internal-spook.h"
+#include "internal-subterranean.h"
+#include "internal-tinyjambu.h"
+#include "internal-wage.h"
+#include "internal-xoodoo.h"
+#include "perf-timer.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+/* Number of warmup calls to make before taking any samples */
+#define PERF_WARMUP_CALLS 1000
+
+/* Maximum number of timing samples to take for each primitive */
+#define MAX_SAMPLES 1001
+
+/* Minimum number of counter units in a single sample.  Calls are batched
+ * until a sample is at least this long to amortize the counter overhead */
+#define MIN_SAMPLE_UNITS 20000
+
+/* Command-line parameters */
+static int num_samples = 201;
+static int use_perf_event = 0;
+
+/* Key material for block ciphers and tweakable block ciphers */
+static unsigned char const key[48] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+    0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27,
+    0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F
+};
+
+/* State for all primitives.  Block ciphers encrypt the block in place
+ * over and over so that every call depends upon the previous one */
+typedef union
+{
+    ascon_state_t ascon;
+    drysponge128_state_t drysponge128;
+    knot256_state_t knot256;
+    knot384_state_t knot384;
+    knot512_state_t knot512;
+    keccakp_200_state_t keccakp_200;
+    keccakp_400_state_t keccakp_400;
+    shadow384_state_t shadow384;
+    shadow512_state_t shadow512;
+    spongent160_state_t spongent160;
+    spongent176_state_t spongent176;
+    subterranean_state_t subterranean;
+    xoodoo_state_t xoodoo;
+    uint32_t words[16];
+    unsigned char bytes[64];
+    struct {
+        gift128b_key_schedule_t ks;
+        unsigned char block[16];
+    } gift128;
+    struct {
+        gift128_variant_key_schedule_t ks;
+        unsigned char block[16];
+        int variant;
+    } gift128v;
+    struct {
+        gift64n_key_schedule_t ks;
+        unsigned char block[8];
+    } gift64;
+    struct {
+        skinny_128_384_key_schedule_t ks;
+        unsigned char block[16];
+    } skinny384;
+    struct {
+        skinny_128_256_key_schedule_t ks;
+        unsigned char block[16];
+    } skinny256;
+    struct {
+        skinny_128_384_variant_key_schedule_t ks;
+        unsigned char block[16];
+        int schedule;
+    } skinny384v;
+    struct {
+        skinny_128_384_key_schedule_t ks;
+        unsigned char blocks[16 * SKINNY_128_384_BLOCKS_MAX];
+        unsigned char tk1[16 * SKINNY_128_384_BLOCKS_MAX];
+    } skinny384x;
+    struct {
+        pyjamask_128_key_schedule_t ks;
+        unsigned char block[16];
+    } pyjamask128;
+    struct {
+        pyjamask_96_key_schedule_t ks;
+        unsigned char block[12];
+    } pyjamask96;
+    struct {
+        saturnin_key_schedule_t ks;
+        unsigned char block[32];
+    } saturnin;
+    struct {
+        saturnin_key_schedule_t ks;
+        unsigned char blocks[32 * SATURNIN_BLOCKS_MAX];
+    } saturninx;
+    struct {
+        uint32_t state[TINY_JAMBU_STATE_SIZE];
+        uint32_t key[4];
+    } tinyjambu;
+    struct {
+        unsigned char left[16];
+        unsigned char right[16];
+    } fork;
+
+} perf_state_t;
+
+/* Information about a primitive to be measured */
+typedef struct
+{
+    const char *name;           /* Name of the primitive */
+    unsigned size;              /* Size of the state or block in bytes */
+    void (*setup)(perf_state_t *state); /* Set up the state, may be NULL */
+    void (*run)(perf_state_t *state);   /* Run the primitive once */
+
+} perf_primitive_t;
+
+/* Wrappers for the primitives, to give them all the same signature */
+
+static void run_ascon_12(perf_state_t *s)
+{
+    ascon_permute(&(s->ascon), 0);
+}
+
+static void run_ascon_6(perf_state_t *s)
+{
+    ascon_permute(&(s->ascon), 6);
+}
+
+static void run_cham128(perf_state_t *s)
+{
+    cham128_128_encrypt(key, s->bytes, s->bytes);
+}
+
+static void run_cham64(perf_state_t *s)
+{
+    cham64_128_encrypt(key, s->bytes, s->bytes);
+}
+
+static void setup_drysponge128(perf_state_t *s)
+{
+    s->drysponge128.rounds = DRYSPONGE128_ROUNDS;
+}
+
+static void run_drysponge128(perf_state_t *s)
+{
+    drysponge128_g(&(s->drysponge128));
+}
+
+static void run_forkskinny_128_256(perf_state_t *s)
+{
+    forkskinny_128_256_encrypt
+        (key, s->fork.left, s->fork.right, s->fork.left);
+}
+
+static void run_forkskinny_128_384(perf_state_t *s)
+{
+    forkskinny_128_384_encrypt
+        (key, s->fork.left, s->fork.right, s->fork.left);
+}
+
+static void run_forkskinny_64_192(perf_state_t *s)
+{
+    forkskinny_64_192_encrypt
+        (key, s->fork.left, s->fork.right, s->fork.left);
+}
+
+static void setup_gift128b(perf_state_t *s)
+{
+    gift128b_init(&(s->gift128.ks), key);
+}
+
+static void run_gift128b(perf_state_t *s)
+{
+    gift128b_encrypt(&(s->gift128.ks), s->gift128.block, s->gift128.block);
+}
+
+static void run_gift128b_preloaded(perf_state_t *s)
+{
+    uint32_t *block = (uint32_t *)(s->gift128.block);
+    gift128b_encrypt_preloaded(&(s->gift128.ks), block, block);
+}
+
+static void run_gift128n(perf_state_t *s)
+{
+    gift128n_encrypt(&(s->gift128.ks), s->gift128.block, s->gift128.block);
+}
+
+static void run_gift128b_init(perf_state_t *s)
+{
+    gift128b_init(&(s->gift128.ks), key);
+}
+
+static void setup_gift128b_variant(perf_state_t *s, int variant)
+{
+    s->gift128v.variant = variant;
+    gift128b_variant_init(&(s->gift128v.ks), key, variant);
+}
+
+static void setup_gift128b_full(perf_state_t *s)
+{
+    setup_gift128b_variant(s, GIFT128_VARIANT_FULL);
+}
+
+static void setup_gift128b_small(perf_state_t *s)
+{
+    setup_gift128b_variant(s, GIFT128_VARIANT_SMALL);
+}
+
+static void setup_gift128b_tiny(perf_state_t *s)
+{
+    setup_gift128b_variant(s, GIFT128_VARIANT_TINY);
+}
+
+static void run_gift128b_variant(perf_state_t *s)
+{
+    gift128b_variant_encrypt
+        (&(s->gift128v.ks), s->gift128v.block, s->gift128v.block);
+}
+
+static void run_gift128b_variant_decrypt(perf_state_t *s)
+{
+    gift128b_variant_decrypt
+        (&(s->gift128v.ks), s->gift128v.block, s->gift128v.block);
+}
+
+static void run_gift128b_variant_init(perf_state_t *s)
+{
+    gift128b_variant_init(&(s->gift128v.ks), key, s->gift128v.variant);
+}
+
+static void setup_gift64n(perf_state_t *s)
+{
+    gift64n_init(&(s->gift64.ks), key);
+}
+
+static void run_gift64n(perf_state_t *s)
+{
+    gift64n_encrypt(&(s->gift64.ks), s->gift64.block, s->gift64.block);
+}
+
+static void run_gimli24(perf_state_t *s)
+{
+    gimli24_permute(s->words);
+}
+
+static void run_keccakp_200(perf_state_t *s)
+{
+    keccakp_200_permute(&(s->keccakp_200));
+}
+
+static void run_keccakp_400(perf_state_t *s)
+{
+    keccakp_400_permute(&(s->keccakp_400), 20);
+}
+
+static void run_knot256_6(perf_state_t *s)
+{
+    knot256_permute_6(&(s->knot256), 52);
+}
+
+static void run_knot256_7(perf_state_t *s)
+{
+    knot256_permute_7(&(s->knot256), 68);
+}
+
+static void run_knot384_7(perf_state_t *s)
+{
+    knot384_permute_7(&(s->knot384), 76);
+}
+
+static void run_knot512_7(perf_state_t *s)
+{
+    knot512_permute_7(&(s->knot512), 100);
+}
+
+static void run_knot512_8(perf_state_t *s)
+{
+    knot512_permute_8(&(s->knot512), 140);
+}
+
+static void run_photon256(perf_state_t *s)
+{
+    photon256_permute(s->bytes);
+}
+
+static void setup_pyjamask_128(perf_state_t *s)
+{
+    pyjamask_128_setup_key(&(s->pyjamask128.ks), key);
+}
+
+static void run_pyjamask_128(perf_state_t *s)
+{
+    pyjamask_128_encrypt
+        (&(s->pyjamask128.ks), s->pyjamask128.block, s->pyjamask128.block);
+}
+
+static void setup_pyjamask_96(perf_state_t *s)
+{
+    pyjamask_96_setup_key(&(s->pyjamask96.ks), key);
+}
+
+static void run_pyjamask_96(perf_state_t *s)
+{
+    pyjamask_96_encrypt
+        (&(s->pyjamask96.ks), s->pyjamask96.block, s->pyjamask96.block);
+}
+
+static void setup_saturnin(perf_state_t *s)
+{
+    saturnin_setup_key(&(s->saturnin.ks), key);
+}
+
+static void run_saturnin(perf_state_t *s)
+{
+    saturnin_encrypt_block
+        (&(s->saturnin.ks), s->saturnin.block, s->saturnin.block, 1);
+}
+
+static void setup_saturnin_blocks(perf_state_t *s)
+{
+    saturnin_setup_key(&(s->saturninx.ks), key);
+}
+
+static void run_saturnin_blocks(perf_state_t *s)
+{
+    saturnin_encrypt_blocks
+        (&(s->saturninx.ks), s->saturninx.blocks, s->saturninx.blocks,
+         SATURNIN_BLOCKS_MAX, 1);
+}
+
+static void run_shadow384(perf_state_t *s)
+{
+    shadow384(&(s->shadow384));
+}
+
+static void run_shadow512(perf_state_t *s)
+{
+    shadow512(&(s->shadow512));
+}
+
+static void run_simp_192(perf_state_t *s)
+{
+    simp_192_permute(s->bytes, 4);
+}
+
+static void run_simp_256(perf_state_t *s)
+{
+    simp_256_permute(s->bytes, 4);
+}
+
+static void setup_skinny_128_256(perf_state_t *s)
+{
+    skinny_128_256_init(&(s->skinny256.ks), key);
+}
+
+static void run_skinny_128_256(perf_state_t *s)
+{
+    skinny_128_256_encrypt
+        (&(s->skinny256.ks), s->skinny256.block, s->skinny256.block);
+}
+
+static void setup_skinny_128_384(perf_state_t *s)
+{
+    skinny_128_384_init(&(s->skinny384.ks), key);
+}
+
+static void run_skinny_128_384(perf_state_t *s)
+{
+    skinny_128_384_encrypt
+        (&(s->skinny384.ks), s->skinny384.block, s->skinny384.block);
+}
+
+static void run_skinny_128_384_init(perf_state_t *s)
+{
+    skinny_128_384_init(&(s->skinny384.ks), key);
+}
+
+static void setup_skinny_128_384_blocks(perf_state_t *s)
+{
+    skinny_128_384_init(&(s->skinny384x.ks), key);
+}
+
+static void run_skinny_128_384_blocks(perf_state_t *s)
+{
+    skinny_128_384_encrypt_tk1_blocks
+        (&(s->skinny384x.ks), s->skinny384x.blocks, s->skinny384x.blocks,
+         s->skinny384x.tk1, SKINNY_128_384_BLOCKS_MAX);
+}
+
+static void setup_skinny_128_384_variant(perf_state_t *s, int schedule)
+{
+    s->skinny384v.schedule = schedule;
+    skinny_128_384_variant_init(&(s->skinny384v.ks), key, schedule);
+}
+
+static void setup_skinny_128_384_full(perf_state_t *s)
+{
+    setup_skinny_128_384_variant(s, SKINNY_128_SCHEDULE_FULL);
+}
+
+static void setup_skinny_128_384_small(perf_state_t *s)
+{
+    setup_skinny_128_384_variant(s, SKINNY_128_SCHEDULE_SMALL);
+}
+
+static void run_skinny_128_384_variant(perf_state_t *s)
+{
+    skinny_128_384_variant_encrypt
+        (&(s->skinny384v.ks), s->skinny384v.block, s->skinny384v.block);
+}
+
+static void run_skinny_128_384_variant_decrypt(perf_state_t *s)
+{
+    skinny_128_384_variant_decrypt
+        (&(s->skinny384v.ks), s->skinny384v.block, s->skinny384v.block);
+}
+
+static void run_skinny_128_384_variant_init(perf_state_t *s)
+{
+    skinny_128_384_variant_init
+        (&(s->skinny384v.ks), key, s->skinny384v.schedule);
+}
+
+static void run_skinny_128_384_tk_full(perf_state_t *s)
+{
+    skinny_128_384_encrypt_tk_full
+        (key, s->skinny384.block, s->skinny384.block);
+}
+
+static void run_sliscp_light192(perf_state_t *s)
+{
+    sliscp_light192_permute(s->bytes);
+}
+
+static void run_sliscp_light256(perf_state_t *s)
+{
+    sliscp_light256_permute_spix(s->bytes, 18);
+}
+
+static void run_sliscp_light320(perf_state_t *s)
+{
+    sliscp_light320_permute(s->bytes);
+}
+
+static void run_sparkle_256(perf_state_t *s)
+{
+    sparkle_256(s->words, 10);
+}
+
+static void run_sparkle_384(perf_state_t *s)
+{
+    sparkle_384(s->words, 11);
+}
+
+static void run_sparkle_384_slim(perf_state_t *s)
+{
+    sparkle_384(s->words, 7);
+}
+
+static void run_sparkle_512(perf_state_t *s)
+{
+    sparkle_512(s->words, 12);
+}
+
+static void run_speck64(perf_state_t *s)
+{
+    speck64_128_encrypt(key, s->bytes, s->bytes);
+}
+
+static void run_spongent160(perf_state_t *s)
+{
+    spongent160_permute(&(s->spongent160));
+}
+
+static void run_spongent176(perf_state_t *s)
+{
+    spongent176_permute(&(s->spongent176));
+}
+
+static void run_subterranean(perf_state_t *s)
+{
+    subterranean_round(&(s->subterranean));
+}
+
+static void run_tinyjambu(perf_state_t *s)
+{
+    tiny_jambu_permutation
+        (s->tinyjambu.state, s->tinyjambu.key, 4, TINYJAMBU_ROUNDS(1024));
+}
+
+static void run_wage(perf_state_t *s)
+{
+    wage_permute(s->bytes);
+}
+
+static void run_xoodoo(perf_state_t *s)
+{
+    xoodoo_permute(&(s->xoodoo));
+}
+
+/* List of all primitives to be measured */
+static const perf_primitive_t primitives[] = {
+    {"ASCON (12 rounds)",           40, 0, run_ascon_12},
+    {"ASCON (6 rounds)",            40, 0, run_ascon_6},
+    {"CHAM-128/128",                16, 0, run_cham128},
+    {"CHAM-64/128",                  8, 0, run_cham64},
+    {"DrySPONGE128-G",              40, setup_drysponge128, run_drysponge128},
+    {"ForkSkinny-128-256",          16, 0, run_forkskinny_128_256},
+    {"ForkSkinny-128-384",          16, 0, run_forkskinny_128_384},
+    {"ForkSkinny-64-192",            8, 0, run_forkskinny_64_192},
+    {"GIFT-128b",                   16, setup_gift128b, run_gift128b},
+    {"GIFT-128b (preloaded)",       16, setup_gift128b, run_gift128b_preloaded},
+    {"GIFT-128n",                   16, setup_gift128b, run_gift128n},
+    {"GIFT-128b key setup",         16, 0, run_gift128b_init},
+    {"GIFT-128b full",              16, setup_gift128b_full, run_gift128b_variant},
+    {"GIFT-128b full decrypt",      16, setup_gift128b_full, run_gift128b_variant_decrypt},
+    {"GIFT-128b full key setup",    16, setup_gift128b_full, run_gift128b_variant_init},
+    {"GIFT-128b small",             16, setup_gift128b_small, run_gift128b_variant},
+    {"GIFT-128b small decrypt",     16, setup_gift128b_small, run_gift128b_variant_decrypt},
+    {"GIFT-128b small key setup",   16, setup_gift128b_small, run_gift128b_variant_init},
+    {"GIFT-128b tiny",              16, setup_gift128b_tiny, run_gift128b_variant},
+    {"GIFT-128b tiny decrypt",      16, setup_gift128b_tiny, run_gift128b_variant_decrypt},
+    {"GIFT-128b tiny key setup",    16, setup_gift128b_tiny, run_gift128b_variant_init},
+    {"GIFT-64n",                     8, setup_gift64n, run_gift64n},
+    {"GIMLI-24",                    48, 0, run_gimli24},
+    {"Keccak-p[200]",               25, 0, run_keccakp_200},
+    {"Keccak-p[400] (20 rounds)",   50, 0, run_keccakp_400},
+    {"KNOT-256 (6-bit rc)",         32, 0, run_knot256_6},
+    {"KNOT-256 (7-bit rc)",         32, 0, run_knot256_7},
+    {"KNOT-384 (7-bit rc)",         48, 0, run_knot384_7},
+    {"KNOT-512 (7-bit rc)",         64, 0, run_knot512_7},
+    {"KNOT-512 (8-bit rc)",         64, 0, run_knot512_8},
+    {"PHOTON-256",                  32, 0, run_photon256},
+    {"Pyjamask-128",                16, setup_pyjamask_128, run_pyjamask_128},
+    {"Pyjamask-96",                 12, setup_pyjamask_96, run_pyjamask_96},
+    {"Saturnin",                    32, setup_saturnin, run_saturnin},
+    {"Saturnin x16",               512, setup_saturnin_blocks, run_saturnin_blocks},
+    {"Shadow-384",                  48, 0, run_shadow384},
+    {"Shadow-512",                  64, 0, run_shadow512},
+    {"SimP-192 (4 steps)",          24, 0, run_simp_192},
+    {"SimP-256 (4 steps)",          32, 0, run_simp_256},
+    {"SKINNY-128-256",              16, setup_skinny_128_256, run_skinny_128_256},
+    {"SKINNY-128-384",              16, setup_skinny_128_384, run_skinny_128_384},
+    {"SKINNY-128-384 key setup",    16, 0, run_skinny_128_384_init},
+    {"SKINNY-128-384 x16",         256, setup_skinny_128_384_blocks, run_skinny_128_384_blocks},
+    {"SKINNY-128-384 (tk_full)",    16, 0, run_skinny_128_384_tk_full},
+    {"SKINNY-128-384 full",         16, setup_skinny_128_384_full, run_skinny_128_384_variant},
+    {"SKINNY-128-384 full decrypt", 16, setup_skinny_128_384_full, run_skinny_128_384_variant_decrypt},
+    {"SKINNY-128-384 full key setup", 16, setup_skinny_128_384_full, run_skinny_128_384_variant_init},
+    {"SKINNY-128-384 small",        16, setup_skinny_128_384_small, run_skinny_128_384_variant},
+    {"SKINNY-128-384 small decrypt", 16, setup_skinny_128_384_small, run_skinny_128_384_variant_decrypt},
+    {"SKINNY-128-384 small key setup", 16, setup_skinny_128_384_small, run_skinny_128_384_variant_init},
+    {"sLiSCP-light-192",            24, 0, run_sliscp_light192},
+    {"sLiSCP-light-256 (18 rounds)", 32, 0, run_sliscp_light256},
+    {"sLiSCP-light-320",            40, 0, run_sliscp_light320},
+    {"SPARKLE-256 (10 steps)",      32, 0, run_sparkle_256},
+    {"SPARKLE-384 (11 steps)",      48, 0, run_sparkle_384},
+    {"SPARKLE-384 (7 steps)",       48, 0, run_sparkle_384_slim},
+    {"SPARKLE-512 (12 steps)",      64, 0, run_sparkle_512},
+    {"SPECK-64/128",                 8, 0, run_speck64},
+    {"Spongent-pi[160]",            20, 0, run_spongent160},
+    {"Spongent-pi[176]",            22, 0, run_spongent176},
+    {"Subterranean (1 round)",      33, 0, run_subterranean},
+    {"TinyJAMBU (1024 steps)",      16, 0, run_tinyjambu},
+    {"WAGE",                        37, 0, run_wage},
+    {"Xoodoo",                      48, 0, run_xoodoo},
+    {0,                              0, 0, 0}
+};
+
+/* Timing samples for the current primitive */
+static uint64_t samples[MAX_SAMPLES];
+
+/**
+ * \brief Compares two samples for qsort().
+ */
+static int compare_samples(const void *a, const void *b)
+{
+    uint64_t x = *((const uint64_t *)a);
+    uint64_t y = *((const uint64_t *)b);
+    return (x < y) ? -1 : ((x > y) ? 1 : 0);
+}
+
+/**
+ * \brief Times a batch of calls to a primitive.
+ *
+ * \param prim The primitive to time, or NULL to time an empty batch.
+ * \param state The state to pass to the primitive.
+ * \param batch The number of calls in the batch.
+ *
+ * \return The elapsed counter units for the batch.
+ */
+static uint64_t time_batch
+    (const perf_primitive_t *prim, perf_state_t *state, unsigned batch)
+{
+    uint64_t start, end;
+    unsigned count;
+    if (prim) {
+        start = perf_timer_cycles();
+        for (count = 0; count < batch; ++count)
+            (*(prim->run))(state);
+        end = perf_timer_cycles();
+    } else {
+        start = perf_timer_cycles();
+        end = perf_timer_cycles();
+    }
+    return end - start;
+}
+
+/* Summary statistics for a set of timing samples */
+typedef struct
+{
+    double median;      /* Median of all samples */
+    double min;         /* Minimum of all samples */
+    double mean;        /* Mean of the samples after outlier rejection */
+    int rejected;       /* Number of samples that were rejected */
+
+} perf_stats_t;
+
+/**
+ * \brief Computes summary statistics for the timing samples.
+ *
+ * \param count The number of samples.
+ * \param batch The number of calls per sample.
+ * \param overhead Counter overhead to subtract from every sample.
+ *
+ * \return The summary statistics, per call.
+ *
+ * Outliers caused by interrupts or context switches are rejected using
+ * Tukey's fences: anything above Q3 + 1.5 * IQR is discarded before
+ * computing the mean.  The median and minimum use all samples.
+ */
+static perf_stats_t compute_stats(int count, unsigned batch, double overhead)
+{
+    perf_stats_t stats;
+    uint64_t q1, q3, fence;
+    double total;
+    int index, kept;
+
+    qsort(samples, count, sizeof(uint64_t), compare_samples);
+    q1 = samples[count / 4];
+    q3 = samples[(count * 3) / 4];
+    fence = q3 + ((q3 - q1) * 3) / 2;
+    total = 0;
+    kept = 0;
+    for (index = 0; index < count; ++index) {
+        if (samples[index] <= fence) {
+            total += (double)(samples[index]);
+            ++kept;
+        }
+    }
+    stats.median = ((double)(samples[count / 2]) - overhead) / batch;
+    stats.min = ((double)(samples[0]) - overhead) / batch;
+    stats.mean = (total / kept - overhead) / batch;
+    stats.rejected = count - kept;
+    return stats;
+}
+
+/**
+ * \brief Measures the counter overhead of an empty batch.
+ *
+ * \return The median counter overhead.
+ */
+static double measure_overhead(void)
+{
+    int index;
+    for (index = 0; index < num_samples; ++index)
+        samples[index] = time_batch(0, 0, 0);
+    qsort(samples, num_samples, sizeof(uint64_t), compare_samples);
+    return (double)(samples[num_samples / 2]);
+}
+
+/**
+ * \brief Measures and prints the performance of a primitive.
+ *
+ * \param prim The primitive to measure.
+ * \param overhead Counter overhead to subtract from every sample.
+ */
+static void perf_primitive(const perf_primitive_t *prim, double overhead)
+{
+    perf_state_t state;
+    perf_stats_t stats;
+    unsigned batch;
+    int index;
+
+    /* Set up the state for the primitive */
+    memset(&state, 0, sizeof(state));
+    if (prim->setup)
+        (*(prim->setup))(&state);
+
+    /* Warm up the caches and the branch predictors */
+    for (index = 0; index < PERF_WARMUP_CALLS; ++index)
+        (*(prim->run))(&state);
+
+    /* Find a batch size that makes each sample long enough to measure */
+    batch = 1;
+    while (batch < 65536 &&
+           time_batch(prim, &state, batch) < MIN_SAMPLE_UNITS)
+        batch *= 2;
+
+    /* Collect the samples and report the results */
+    for (index = 0; index < num_samples; ++index)
+        samples[index] = time_batch(prim, &state, batch);
+    stats = compute_stats(num_samples, batch, overhead);
+    printf("%-30s %5u %11.1f %11.1f %11.1f %9.2f %5d\n",
+           prim->name, prim->size, stats.median, stats.min, stats.mean,
+           stats.median / prim->size, stats.rejected);
+    fflush(stdout);
+}
+
+/**
+ * \brief Determine if a primitive name matches a command-line argument.
+ *
+ * \param name The name of the primitive.
+ * \param arg The command-line argument, which matches any primitive
+ * whose name starts with the argument.
+ */
+static int name_matches(const char *name, const char *arg)
+{
+    return !strncmp(name, arg, strlen(arg));
+}
+
+/**
+ * \brief Prints usage information for this program.
+ *
+ * \param progname Name of the program from the argv[0] argument.
+ */
+static void usage(const char *progname)
+{
+    int index;
+    fprintf(stderr, "Usage: %s [options] [PRIMITIVE ...]\n\n", progname);
+
+    fprintf(stderr, "Options:\n");
+    fprintf(stderr, "    --samples=N\n");
+    fprintf(stderr, "        Number of timing samples to take, default is 201.\n\n");
+
+    fprintf(stderr, "    --perf-event\n");
+    fprintf(stderr, "        Use the Linux perf_event_open() cycle counter instead of the\n");
+    fprintf(stderr, "        default time stamp counter.\n\n");
+
+    fprintf(stderr, "Primitive names may be prefixes; e.g. \"SKINNY\" for all SKINNY variants.\n");
+    fprintf(stderr, "If no primitives are specified, then all primitives are measured.\n\n");
+
+    fprintf(stderr, "Primitives:\n");
+    for (index = 0; primitives[index].name != 0; ++index)
+        fprintf(stderr, "    %s\n", primitives[index].name);
+}
+
+int main(int argc, char *argv[])
+{
+    double overhead;
+    int first = 1;
+    int index, arg;
+
+    /* Parse the command-line options */
+    while (first < argc && !strncmp(argv[first], "--", 2)) {
+        const char *name = argv[first++] + 2;
+        if (*name == '\0') {
+            break;
+        } else if (!strncmp(name, "samples=", 8)) {
+            num_samples = atoi(name + 8);
+            if (num_samples < 5)
+                num_samples = 5;
+            else if (num_samples > MAX_SAMPLES)
+                num_samples = MAX_SAMPLES;
+        } else if (!strcmp(name, "perf-event")) {
+            use_perf_event = 1;
+        } else {
+            if (strcmp(name, "help") != 0)
+                fprintf(stderr, "Unknown option '--%s'\n", name);
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (use_perf_event && !perf_timer_use_perf_event()) {
+        fprintf(stderr, "perf_event_open() is not available, using %s\n",
+                perf_timer_unit());
+    }
+
+    /* Measure the overhead of reading the counter */
+    overhead = measure_overhead();
+    printf("Counter: %s, overhead %.0f per sample\n\n",
+           perf_timer_unit(), overhead);
+    printf("%-30s %5s %11s %11s %11s %9s %5s\n",
+           "Primitive", "Bytes", "Median", "Min", "Mean", "Per byte",
+           "Outl");
+
+    /* Measure all primitives or only those named on the command-line */
+    for (index = 0; primitives[index].name != 0; ++index) {
+        if (first < argc) {
+            for (arg = first; arg < argc; ++arg) {
+                if (name_matches(primitives[index].name, argv[arg]))
+                    break;
+            }
+            if (arg >= argc)
+                continue;
+        }
+        perf_primitive(&(primitives[index]), overhead);
+    }
+    return 0;
+}
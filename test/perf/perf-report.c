@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "perf-report.h"
+#include "perf-timer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Maximum length of an algorithm or operation name in the baseline */
+#define MAX_NAME_LEN 64
+
+/* Maximum length of a line in the baseline file */
+#define MAX_LINE_LEN 512
+
+/* Result record from the baseline file */
+typedef struct
+{
+    char algorithm[MAX_NAME_LEN];
+    char operation[MAX_NAME_LEN];
+    unsigned long msg_len;
+    unsigned long ad_len;
+    double cycles;
+
+} perf_baseline_t;
+
+static int report_format = PERF_FORMAT_TEXT;
+static int report_count = 0;
+static perf_baseline_t *baseline = 0;
+static size_t baseline_count = 0;
+static double threshold = 5.0;
+static int regressions = 0;
+
+/* Compares two baseline records for sorting and searching */
+static int compare_baseline(const void *a, const void *b)
+{
+    const perf_baseline_t *x = (const perf_baseline_t *)a;
+    const perf_baseline_t *y = (const perf_baseline_t *)b;
+    int cmp = strcmp(x->algorithm, y->algorithm);
+    if (cmp)
+        return cmp;
+    cmp = strcmp(x->operation, y->operation);
+    if (cmp)
+        return cmp;
+    if (x->msg_len != y->msg_len)
+        return x->msg_len < y->msg_len ? -1 : 1;
+    if (x->ad_len != y->ad_len)
+        return x->ad_len < y->ad_len ? -1 : 1;
+    return 0;
+}
+
+/* Writes a string to stdout as a JSON string literal */
+static void print_json_string(const char *str)
+{
+    putchar('"');
+    while (*str != '\0') {
+        if (*str == '"' || *str == '\\')
+            putchar('\\');
+        putchar(*str++);
+    }
+    putchar('"');
+}
+
+/* Compares a result against the baseline and reports regressions */
+static void check_baseline
+    (const char *algorithm, const char *operation,
+     unsigned long msg_len, unsigned long ad_len, double cycles)
+{
+    perf_baseline_t key;
+    const perf_baseline_t *base;
+    double change;
+    if (!baseline_count || strlen(algorithm) >= MAX_NAME_LEN)
+        return;
+    strcpy(key.algorithm, algorithm);
+    strcpy(key.operation, operation);
+    key.msg_len = msg_len;
+    key.ad_len = ad_len;
+    base = (const perf_baseline_t *)bsearch
+        (&key, baseline, baseline_count, sizeof(perf_baseline_t),
+         compare_baseline);
+    if (!base || base->cycles <= 0)
+        return;
+    change = (cycles - base->cycles) * 100.0 / base->cycles;
+    if (change > threshold) {
+        fprintf(stderr, "REGRESSION: %s %s msg=%lu ad=%lu: "
+                        "%.0f -> %.0f %s (+%.1f%%)\n",
+                algorithm, operation, msg_len, ad_len,
+                base->cycles, cycles, perf_timer_unit(), change);
+        ++regressions;
+    }
+}
+
+void perf_report_begin(int format)
+{
+    report_format = format;
+    report_count = 0;
+    if (format == PERF_FORMAT_CSV)
+        printf("algorithm,operation,msg_len,ad_len,cycles,"
+               "cycles_per_byte,units,unit\n");
+    else if (format == PERF_FORMAT_JSON)
+        printf("[\n");
+}
+
+void perf_report_record
+    (const char *algorithm, const char *operation,
+     unsigned long msg_len, unsigned long ad_len,
+     double cycles, double units)
+{
+    unsigned long len = msg_len + ad_len;
+    double per_byte = len ? cycles / len : 0;
+    if (report_format == PERF_FORMAT_CSV) {
+        printf("%s,%s,%lu,%lu,%.0f,%.4f,%.4f,%s\n",
+               algorithm, operation, msg_len, ad_len,
+               cycles, per_byte, units, perf_timer_unit());
+    } else if (report_format == PERF_FORMAT_JSON) {
+        printf("%s  {\"algorithm\": ", report_count ? ",\n" : "");
+        print_json_string(algorithm);
+        printf(", \"operation\": \"%s\", \"msg_len\": %lu, \"ad_len\": %lu, "
+               "\"cycles\": %.0f, \"cycles_per_byte\": %.4f, "
+               "\"units\": %.4f, \"unit\": \"%s\"}",
+               operation, msg_len, ad_len, cycles, per_byte, units,
+               perf_timer_unit());
+    }
+    ++report_count;
+    fflush(stdout);
+    check_baseline(algorithm, operation, msg_len, ad_len, cycles);
+}
+
+void perf_report_end(void)
+{
+    if (report_format == PERF_FORMAT_JSON)
+        printf("%s]\n", report_count ? "\n" : "");
+}
+
+int perf_report_load_baseline(const char *filename)
+{
+    FILE *file;
+    char line[MAX_LINE_LEN];
+    char *fields[5];
+    char *ptr;
+    size_t max_count = 0;
+    int lineno = 0;
+    int index;
+
+    if ((file = fopen(filename, "r")) == NULL) {
+        perror(filename);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), file)) {
+        ++lineno;
+        if (lineno == 1 && !strncmp(line, "algorithm,", 10))
+            continue; /* Skip the header line */
+
+        /* Split the line into the fields that we need */
+        ptr = line;
+        for (index = 0; index < 5; ++index) {
+            fields[index] = ptr;
+            ptr = strchr(ptr, ',');
+            if (!ptr)
+                break;
+            *ptr++ = '\0';
+        }
+        if (index < 4) {
+            if (line[0] != '\n' && line[0] != '\0')
+                fprintf(stderr, "%s:%d: malformed record\n", filename, lineno);
+            continue;
+        }
+        if (strlen(fields[0]) >= MAX_NAME_LEN ||
+                strlen(fields[1]) >= MAX_NAME_LEN)
+            continue;
+
+        /* Add the record to the baseline */
+        if (baseline_count >= max_count) {
+            max_count = max_count ? max_count * 2 : 256;
+            baseline = (perf_baseline_t *)realloc
+                (baseline, max_count * sizeof(perf_baseline_t));
+            if (!baseline) {
+                fprintf(stderr, "out of memory\n");
+                exit(1);
+            }
+        }
+        strcpy(baseline[baseline_count].algorithm, fields[0]);
+        strcpy(baseline[baseline_count].operation, fields[1]);
+        baseline[baseline_count].msg_len = strtoul(fields[2], NULL, 10);
+        baseline[baseline_count].ad_len = strtoul(fields[3], NULL, 10);
+        baseline[baseline_count].cycles = strtod(fields[4], NULL);
+        ++baseline_count;
+    }
+    fclose(file);
+    qsort(baseline, baseline_count, sizeof(perf_baseline_t), compare_baseline);
+    return 0;
+}
+
+void perf_report_set_threshold(double percent)
+{
+    threshold = percent;
+}
+
+int perf_report_regressions(void)
+{
+    return regressions;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef PERF_REPORT_H
+#define PERF_REPORT_H
+
+/* Output formats for benchmark results */
+#define PERF_FORMAT_TEXT    0   /* Human-readable tables */
+#define PERF_FORMAT_CSV     1   /* Comma-separated values with a header */
+#define PERF_FORMAT_JSON    2   /* JSON array of result objects */
+
+/* Starts a report in the given format, writing any header to stdout */
+void perf_report_begin(int format);
+
+/* Adds a result record to the report.  The operation is "encrypt",
+ * "decrypt", or "hash".  The units value is relative to the reference
+ * algorithm, or zero if not known.  The result is also compared against
+ * the baseline if one has been loaded */
+void perf_report_record
+    (const char *algorithm, const char *operation,
+     unsigned long msg_len, unsigned long ad_len,
+     double cycles, double units);
+
+/* Ends the report, writing any trailer to stdout */
+void perf_report_end(void);
+
+/* Loads a baseline from a CSV file written by a previous run with
+ * "--format=csv".  Returns zero on success or -1 on error */
+int perf_report_load_baseline(const char *filename);
+
+/* Sets the percentage by which a result must exceed the baseline
+ * before it is flagged as a regression */
+void perf_report_set_threshold(double percent);
+
+/* Gets the number of regressions that have been flagged so far */
+int perf_report_regressions(void);
+
+#endif
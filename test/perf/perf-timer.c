@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#define _GNU_SOURCE
+#include "perf-timer.h"
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PERF_HAVE_RDTSC 1
+#endif
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <string.h>
+#include <unistd.h>
+#define PERF_HAVE_PERF_EVENT 1
+#endif
+
+/* File descriptor for the perf_event_open() cycle counter, or -1 */
+static int perf_event_fd = -1;
+
+uint64_t perf_timer_nanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)(ts.tv_sec)) * 1000000000ULL + (uint64_t)(ts.tv_nsec);
+}
+
+uint64_t perf_timer_cycles(void)
+{
+#if defined(PERF_HAVE_PERF_EVENT)
+    if (perf_event_fd >= 0) {
+        uint64_t count = 0;
+        if (read(perf_event_fd, &count, sizeof(count)) == sizeof(count))
+            return count;
+    }
+#endif
+#if defined(PERF_HAVE_RDTSC)
+    return __rdtsc();
+#else
+    return perf_timer_nanos();
+#endif
+}
+
+const char *perf_timer_unit(void)
+{
+    if (perf_event_fd >= 0)
+        return "cycles";
+#if defined(PERF_HAVE_RDTSC)
+    return "cycles";
+#else
+    return "ns";
+#endif
+}
+
+int perf_timer_use_perf_event(void)
+{
+#if defined(PERF_HAVE_PERF_EVENT)
+    struct perf_event_attr attr;
+    if (perf_event_fd >= 0)
+        return 1;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_CPU_CYCLES;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    perf_event_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    return perf_event_fd >= 0;
+#else
+    return 0;
+#endif
+}
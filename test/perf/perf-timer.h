@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2020 Southern Storm Software, Pty Ltd.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+
+#ifndef PERF_TIMER_H
+#define PERF_TIMER_H
+
+#include <stdint.h>
+
+/* Reads the current value of the cycle counter.  On platforms without
+ * an accessible cycle counter this falls back to nanoseconds */
+uint64_t perf_timer_cycles(void);
+
+/* Reads the current value of the monotonic clock in nanoseconds */
+uint64_t perf_timer_nanos(void);
+
+/* Name of the unit that is returned by perf_timer_cycles() */
+const char *perf_timer_unit(void);
+
+/* Switches perf_timer_cycles() to the hardware cycle counter from the
+ * Linux perf_event_open() system call.  Returns zero if not available */
+int perf_timer_use_perf_event(void);
+
+#endif
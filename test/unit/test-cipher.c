@@ -167,6 +167,63 @@ void test_block_cipher_other
     free(ks);
 }
 
+void test_block_cipher_blocks
+    (const block_cipher_blocks_t *cipher, const void *ks)
+{
+    static unsigned char input
+        [TEST_BLOCKS_MAX_COUNT * TEST_BLOCKS_MAX_BLOCK_SIZE];
+    static unsigned char output
+        [TEST_BLOCKS_MAX_COUNT * TEST_BLOCKS_MAX_BLOCK_SIZE + 1];
+    static unsigned char expected
+        [TEST_BLOCKS_MAX_COUNT * TEST_BLOCKS_MAX_BLOCK_SIZE];
+    static unsigned char tweak
+        [TEST_BLOCKS_MAX_COUNT * TEST_BLOCKS_MAX_TWEAK_SIZE];
+    unsigned block_size = cipher->block_size;
+    unsigned count, index;
+    size_t len;
+    int ok = 1;
+
+    printf("    %s ... ", cipher->name);
+    fflush(stdout);
+
+    /* Encrypt the blocks one at a time to get the expected output */
+    for (index = 0; index < sizeof(input); ++index)
+        input[index] = (unsigned char)(index * 7 + 3);
+    for (index = 0; index < sizeof(tweak); ++index)
+        tweak[index] = (unsigned char)(index * 13 + 1);
+    for (index = 0; index < TEST_BLOCKS_MAX_COUNT; ++index) {
+        (*(cipher->encrypt))
+            (ks, expected + index * block_size, input + index * block_size,
+             tweak + index * cipher->tweak_size);
+    }
+
+    /* Check with several block counts that the multi-block version
+     * gives the same output and does not write past the last block */
+    for (count = 1; count <= TEST_BLOCKS_MAX_COUNT; count += 9) {
+        len = count * block_size;
+        memset(output, 0xAA, sizeof(output));
+        (*(cipher->encrypt_blocks))(ks, output, input, tweak, count);
+        if (test_memcmp(output, expected, len) != 0 || output[len] != 0xAA)
+            ok = 0;
+        memcpy(output, input, len);
+        (*(cipher->encrypt_blocks))(ks, output, output, tweak, count);
+        if (test_memcmp(output, expected, len) != 0 || output[len] != 0xAA)
+            ok = 0;
+        if (cipher->decrypt_blocks) {
+            (*(cipher->decrypt_blocks))(ks, output, output, tweak, count);
+            if (test_memcmp(output, input, len) != 0 || output[len] != 0xAA)
+                ok = 0;
+        }
+    }
+
+    if (ok) {
+        printf("ok\n");
+    } else {
+        printf("failed\n");
+        test_exit_result = 1;
+    }
+}
+
 void test_aead_cipher_start(const aead_cipher_t *cipher)
 {
     if (first_test) {
@@ -44,6 +44,33 @@ typedef struct
 
 } block_cipher_t;
 
+typedef void (*block_cipher_encrypt_tweak_t)
+    (const void *ks, unsigned char *output, const unsigned char *input,
+     const unsigned char *tweak);
+typedef void (*block_cipher_crypt_blocks_t)
+    (const void *ks, unsigned char *output, const unsigned char *input,
+     const unsigned char *tweak, size_t count);
+
+/* Maximum block size, tweak size, and number of blocks for testing the
+ * multi-block version of a block cipher */
+#define TEST_BLOCKS_MAX_BLOCK_SIZE 32
+#define TEST_BLOCKS_MAX_TWEAK_SIZE 48
+#define TEST_BLOCKS_MAX_COUNT 37
+
+/* Information about the multi-block version of a block cipher, with a
+ * single-block version to check it against.  Each block has its own
+ * tweak if tweak_size is non-zero */
+typedef struct
+{
+    const char *name;
+    unsigned block_size;
+    unsigned tweak_size;
+    block_cipher_encrypt_tweak_t encrypt;
+    block_cipher_crypt_blocks_t encrypt_blocks;
+    block_cipher_crypt_blocks_t decrypt_blocks; /* May be NULL */
+
+} block_cipher_blocks_t;
+
 /* Information about a test vector for a 128-bit block cipher,
  * with variable key sizes up to 384-bit */
 typedef struct
@@ -112,6 +139,10 @@ void test_block_cipher_other
      const block_cipher_test_vector_128_t *test_vector,
      unsigned block_size);
 
+/* Tests the multi-block version of a block cipher */
+void test_block_cipher_blocks
+    (const block_cipher_blocks_t *cipher, const void *ks);
+
 /* Start a batch of tests on an AEAD cipher */
 void test_aead_cipher_start(const aead_cipher_t *cipher);
 
@@ -527,6 +527,114 @@ static block_cipher_t const forkskinny_64_192_invert_right = {
     (block_cipher_decrypt_t)0
 };
 
+typedef void (*forkskinny_128_block_func_t)
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input);
+typedef void (*forkskinny_128_blocks_func_t)
+    (const unsigned char *key, unsigned char *output_left,
+     unsigned char *output_right, const unsigned char *input, size_t count);
+
+/* Single-block and multi-block functions for a ForkSkinny-128 variant */
+typedef struct
+{
+    forkskinny_128_block_func_t encrypt;
+    forkskinny_128_block_func_t decrypt;
+    forkskinny_128_blocks_func_t encrypt_blocks;
+    forkskinny_128_blocks_func_t decrypt_blocks;
+
+} forkskinny_128_funcs_t;
+
+/* Wrappers that select one of the outputs, with the tweakey for each
+ * block passed as the tweak.  The other output goes to a scratch buffer */
+static unsigned char forkskinny_other[TEST_BLOCKS_MAX_COUNT * 16];
+static void forkskinny_128_encrypt_left
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key)
+{
+    (*(f->encrypt))(key, output, forkskinny_other, input);
+}
+static void forkskinny_128_encrypt_right
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key)
+{
+    (*(f->encrypt))(key, 0, output, input);
+}
+static void forkskinny_128_decrypt_right
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key)
+{
+    (*(f->decrypt))(key, forkskinny_other, output, input);
+}
+static void forkskinny_128_encrypt_blocks_left
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key, size_t count)
+{
+    (*(f->encrypt_blocks))(key, output, forkskinny_other, input, count);
+}
+static void forkskinny_128_encrypt_blocks_right
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key, size_t count)
+{
+    (*(f->encrypt_blocks))(key, 0, output, input, count);
+}
+static void forkskinny_128_decrypt_blocks_left
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key, size_t count)
+{
+    (*(f->decrypt_blocks))(key, output, forkskinny_other, input, count);
+}
+static void forkskinny_128_decrypt_blocks_right
+    (const forkskinny_128_funcs_t *f, unsigned char *output,
+     const unsigned char *input, const unsigned char *key, size_t count)
+{
+    (*(f->decrypt_blocks))(key, forkskinny_other, output, input, count);
+}
+
+static void test_forkskinny_128_blocks
+    (const forkskinny_128_funcs_t *f, unsigned key_size)
+{
+    block_cipher_blocks_t left = {
+        "Multi-block Left",
+        16,
+        key_size,
+        (block_cipher_encrypt_tweak_t)forkskinny_128_encrypt_left,
+        (block_cipher_crypt_blocks_t)forkskinny_128_encrypt_blocks_left,
+        (block_cipher_crypt_blocks_t)forkskinny_128_decrypt_blocks_left
+    };
+    block_cipher_blocks_t right = {
+        "Multi-block Right",
+        16,
+        key_size,
+        (block_cipher_encrypt_tweak_t)forkskinny_128_encrypt_right,
+        (block_cipher_crypt_blocks_t)forkskinny_128_encrypt_blocks_right,
+        (block_cipher_crypt_blocks_t)0
+    };
+    block_cipher_blocks_t invert_right = {
+        "Multi-block Invert Right",
+        16,
+        key_size,
+        (block_cipher_encrypt_tweak_t)forkskinny_128_decrypt_right,
+        (block_cipher_crypt_blocks_t)forkskinny_128_decrypt_blocks_right,
+        (block_cipher_crypt_blocks_t)0
+    };
+    test_block_cipher_blocks(&left, f);
+    test_block_cipher_blocks(&right, f);
+    test_block_cipher_blocks(&invert_right, f);
+}
+
+static forkskinny_128_funcs_t const forkskinny_128_256_funcs = {
+    forkskinny_128_256_encrypt,
+    forkskinny_128_256_decrypt,
+    forkskinny_128_256_encrypt_blocks,
+    forkskinny_128_256_decrypt_blocks
+};
+static forkskinny_128_funcs_t const forkskinny_128_384_funcs = {
+    forkskinny_128_384_encrypt,
+    forkskinny_128_384_decrypt,
+    forkskinny_128_384_encrypt_blocks,
+    forkskinny_128_384_decrypt_blocks
+};
+
 void test_forkskinny(void)
 {
     test_block_cipher_start(&forkskinny_128_256_left_only);
@@ -536,6 +644,7 @@ void test_forkskinny(void)
     test_block_cipher_128(&forkskinny_128_256_both_right, &forkskinny_128_256_4);
     test_block_cipher_128(&forkskinny_128_256_invert_left, &forkskinny_128_256_5);
     test_block_cipher_128(&forkskinny_128_256_invert_right, &forkskinny_128_256_6);
+    test_forkskinny_128_blocks(&forkskinny_128_256_funcs, 32);
     test_block_cipher_end(&forkskinny_128_256_left_only);
 
     test_block_cipher_start(&forkskinny_128_384_left_only);
@@ -545,6 +654,7 @@ void test_forkskinny(void)
     test_block_cipher_128(&forkskinny_128_384_both_right, &forkskinny_128_384_4);
     test_block_cipher_128(&forkskinny_128_384_invert_left, &forkskinny_128_384_5);
     test_block_cipher_128(&forkskinny_128_384_invert_right, &forkskinny_128_384_6);
+    test_forkskinny_128_blocks(&forkskinny_128_384_funcs, 48);
     test_block_cipher_end(&forkskinny_128_384_left_only);
 
     test_block_cipher_start(&forkskinny_64_192_left_only);
@@ -203,8 +203,41 @@ static block_cipher_test_vector_128_t const gift128t_4 = {
     /* tweak = 0 */
 };
 
+/* GIFT-128 with a key schedule variant that is selected at runtime */
+static int gift128_variant_value = GIFT128_VARIANT_FULL;
+
+static void gift128b_variant_init_wrapper
+    (gift128_variant_key_schedule_t *ks, const unsigned char *key)
+{
+    gift128b_variant_init(ks, key, gift128_variant_value);
+}
+
+static void gift128n_variant_init_wrapper
+    (gift128_variant_key_schedule_t *ks, const unsigned char *key)
+{
+    gift128n_variant_init(ks, key, gift128_variant_value);
+}
+
+static block_cipher_t const gift128b_variant = {
+    "GIFT-128-b-Variant",
+    sizeof(gift128_variant_key_schedule_t),
+    (block_cipher_init_t)gift128b_variant_init_wrapper,
+    (block_cipher_encrypt_t)gift128b_variant_encrypt,
+    (block_cipher_decrypt_t)gift128b_variant_decrypt
+};
+
+static block_cipher_t const gift128n_variant = {
+    "GIFT-128-n-Variant",
+    sizeof(gift128_variant_key_schedule_t),
+    (block_cipher_init_t)gift128n_variant_init_wrapper,
+    (block_cipher_encrypt_t)gift128n_variant_encrypt,
+    (block_cipher_decrypt_t)gift128n_variant_decrypt
+};
+
 void test_gift128(void)
 {
+    int variant;
+
     test_block_cipher_start(&gift128b);
     test_block_cipher_128(&gift128b, &gift128b_1);
     test_block_cipher_128(&gift128b, &gift128b_2);
@@ -231,4 +264,22 @@ void test_gift128(void)
     test_block_cipher_128(&gift128t, &gift128t_4);
     test_block_cipher_128(&gift128n, &gift128t_4);
     test_block_cipher_end(&gift128t);
+
+    test_block_cipher_start(&gift128b_variant);
+    for (variant = GIFT128_VARIANT_FULL; variant <= GIFT128_VARIANT_TINY;
+            ++variant) {
+        gift128_variant_value = variant;
+        test_block_cipher_128(&gift128b_variant, &gift128b_1);
+        test_block_cipher_128(&gift128b_variant, &gift128b_5);
+    }
+    test_block_cipher_end(&gift128b_variant);
+
+    test_block_cipher_start(&gift128n_variant);
+    for (variant = GIFT128_VARIANT_FULL; variant <= GIFT128_VARIANT_TINY;
+            ++variant) {
+        gift128_variant_value = variant;
+        test_block_cipher_128(&gift128n_variant, &gift128n_1);
+        test_block_cipher_128(&gift128n_variant, &gift128n_3);
+    }
+    test_block_cipher_end(&gift128n_variant);
 }
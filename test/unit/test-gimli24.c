@@ -61,9 +61,35 @@ static void test_gimli24_permutation(void)
     }
 }
 
+static void test_gimli24_permutation_x2(void)
+{
+    uint32_t state0[12];
+    uint32_t state1[12];
+    uint32_t expected[12];
+
+    printf("    Permutation x2 ... ");
+    fflush(stdout);
+
+    /* The second state is the output of the first permutation, so the
+     * two halves of the vectors hold different data */
+    memcpy(state0, gimli24_input, sizeof(gimli24_input));
+    memcpy(state1, gimli24_output, sizeof(gimli24_output));
+    memcpy(expected, gimli24_output, sizeof(gimli24_output));
+    gimli24_permute(expected);
+    gimli24_x2_permute(state0, state1);
+    if (memcmp(state0, gimli24_output, sizeof(gimli24_output)) != 0 ||
+            memcmp(state1, expected, sizeof(expected)) != 0) {
+        printf("failed\n");
+        test_exit_result = 1;
+    } else {
+        printf("ok\n");
+    }
+}
+
 void test_gimli24(void)
 {
     test_aead_cipher_start(&gimli24_cipher);
     test_gimli24_permutation();
+    test_gimli24_permutation_x2();
     test_aead_cipher_end(&gimli24_cipher);
 }
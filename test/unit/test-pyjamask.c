@@ -82,14 +82,82 @@ static block_cipher_test_vector_128_t const pyjamask_96_1 = {
      0x27, 0x07, 0x3d, 0xa6}
 };
 
+/* Multi-block versions of Pyjamask, with wrappers that give the
+ * functions the signatures from block_cipher_blocks_t */
+static void pyjamask_128_encrypt_one
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak)
+{
+    (void)tweak;
+    pyjamask_128_encrypt(ks, output, input);
+}
+static void pyjamask_128_encrypt_many
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak, size_t count)
+{
+    (void)tweak;
+    pyjamask_128_encrypt_blocks(ks, output, input, count);
+}
+static void pyjamask_128_decrypt_many
+    (const pyjamask_128_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak, size_t count)
+{
+    (void)tweak;
+    pyjamask_128_decrypt_blocks(ks, output, input, count);
+}
+static void pyjamask_96_encrypt_one
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak)
+{
+    (void)tweak;
+    pyjamask_96_encrypt(ks, output, input);
+}
+static void pyjamask_96_encrypt_many
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak, size_t count)
+{
+    (void)tweak;
+    pyjamask_96_encrypt_blocks(ks, output, input, count);
+}
+static void pyjamask_96_decrypt_many
+    (const pyjamask_96_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak, size_t count)
+{
+    (void)tweak;
+    pyjamask_96_decrypt_blocks(ks, output, input, count);
+}
+static block_cipher_blocks_t const pyjamask_128_blocks = {
+    "Multi-block",
+    16,
+    0,
+    (block_cipher_encrypt_tweak_t)pyjamask_128_encrypt_one,
+    (block_cipher_crypt_blocks_t)pyjamask_128_encrypt_many,
+    (block_cipher_crypt_blocks_t)pyjamask_128_decrypt_many
+};
+static block_cipher_blocks_t const pyjamask_96_blocks = {
+    "Multi-block",
+    12,
+    0,
+    (block_cipher_encrypt_tweak_t)pyjamask_96_encrypt_one,
+    (block_cipher_crypt_blocks_t)pyjamask_96_encrypt_many,
+    (block_cipher_crypt_blocks_t)pyjamask_96_decrypt_many
+};
+
 void test_pyjamask(void)
 {
+    pyjamask_128_key_schedule_t ks128;
+    pyjamask_96_key_schedule_t ks96;
+
     test_block_cipher_start(&pyjamask_128);
     test_block_cipher_128(&pyjamask_128, &pyjamask_128_1);
+    pyjamask_128_setup_key(&ks128, pyjamask_128_1.key);
+    test_block_cipher_blocks(&pyjamask_128_blocks, &ks128);
     test_block_cipher_end(&pyjamask_128);
 
     test_block_cipher_start(&pyjamask_96);
     test_block_cipher_other(&pyjamask_96, &pyjamask_96_1, 12);
+    pyjamask_96_setup_key(&ks96, pyjamask_96_1.key);
+    test_block_cipher_blocks(&pyjamask_96_blocks, &ks96);
     test_block_cipher_end(&pyjamask_96);
 
     test_block_cipher_start(&pyjamask_masked_128);
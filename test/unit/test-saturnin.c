@@ -48,6 +48,48 @@ static unsigned char const saturnin_test_ciphertext[SATURNIN_BLOCK_SIZE] = {
     0xe0, 0x67, 0xac, 0xf4, 0x91, 0xf6, 0xba, 0xfd
 };
 
+/* Key schedule and domain separator for testing saturnin_encrypt_blocks()
+ * against saturnin_encrypt_block() */
+typedef struct
+{
+    const saturnin_key_schedule_t *ks;
+    unsigned domain;
+
+} saturnin_blocks_test_t;
+
+static void saturnin_encrypt_one
+    (const saturnin_blocks_test_t *test, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak)
+{
+    (void)tweak;
+    saturnin_encrypt_block(test->ks, output, input, test->domain);
+}
+
+static void saturnin_encrypt_many
+    (const saturnin_blocks_test_t *test, unsigned char *output,
+     const unsigned char *input, const unsigned char *tweak, size_t count)
+{
+    (void)tweak;
+    saturnin_encrypt_blocks(test->ks, output, input, count, test->domain);
+}
+
+static void test_saturnin_blocks
+    (const saturnin_key_schedule_t *ks, const char *name, unsigned domain)
+{
+    block_cipher_blocks_t blocks = {
+        name,
+        SATURNIN_BLOCK_SIZE,
+        0,
+        (block_cipher_encrypt_tweak_t)saturnin_encrypt_one,
+        (block_cipher_crypt_blocks_t)saturnin_encrypt_many,
+        (block_cipher_crypt_blocks_t)0
+    };
+    saturnin_blocks_test_t test;
+    test.ks = ks;
+    test.domain = domain;
+    test_block_cipher_blocks(&blocks, &test);
+}
+
 void test_saturnin(void)
 {
     saturnin_key_schedule_t ks;
@@ -82,5 +124,10 @@ void test_saturnin(void)
         printf("ok\n");
     }
 
+    test_saturnin_blocks
+        (&ks, "Multi-block, 10 rounds", SATURNIN_DOMAIN_10_1);
+    test_saturnin_blocks
+        (&ks, "Multi-block, 16 rounds", SATURNIN_DOMAIN_16_7);
+
     printf("\n");
 }
@@ -123,8 +123,56 @@ static block_cipher_t const skinny128_256_tk_full = {
     (block_cipher_decrypt_t)0
 };
 
+/* SKINNY-128 with a key schedule variant that is selected at runtime */
+static int skinny_128_variant_schedule = SKINNY_128_SCHEDULE_FULL;
+static void variant_skinny_128_256_init
+    (skinny_128_256_variant_key_schedule_t *ks, const unsigned char *key)
+{
+    skinny_128_256_variant_init(ks, key, skinny_128_variant_schedule);
+}
+static void variant_skinny_128_384_init
+    (skinny_128_384_variant_key_schedule_t *ks, const unsigned char *key)
+{
+    skinny_128_384_variant_init(ks, key, skinny_128_variant_schedule);
+}
+static block_cipher_t const skinny128_256_variant = {
+    "SKINNY-128-256-Variant",
+    sizeof(skinny_128_256_variant_key_schedule_t),
+    (block_cipher_init_t)variant_skinny_128_256_init,
+    (block_cipher_encrypt_t)skinny_128_256_variant_encrypt,
+    (block_cipher_decrypt_t)skinny_128_256_variant_decrypt
+};
+static block_cipher_t const skinny128_384_variant = {
+    "SKINNY-128-384-Variant",
+    sizeof(skinny_128_384_variant_key_schedule_t),
+    (block_cipher_init_t)variant_skinny_128_384_init,
+    (block_cipher_encrypt_t)skinny_128_384_variant_encrypt,
+    (block_cipher_decrypt_t)skinny_128_384_variant_decrypt
+};
+
+/* Multi-block version of SKINNY-128-384 with a different TK1 value for
+ * every block, checked against the single-block version */
+static void tk1_skinny_128_384_encrypt
+    (const skinny_128_384_key_schedule_t *ks, unsigned char *output,
+     const unsigned char *input, const unsigned char *tk1)
+{
+    skinny_128_384_key_schedule_t ks2 = *ks;
+    memcpy(ks2.TK1, tk1, 16);
+    skinny_128_384_encrypt(&ks2, output, input);
+}
+static block_cipher_blocks_t const skinny128_384_tk1_blocks = {
+    "Multi-block",
+    16,
+    16,
+    (block_cipher_encrypt_tweak_t)tk1_skinny_128_384_encrypt,
+    (block_cipher_crypt_blocks_t)skinny_128_384_encrypt_tk1_blocks,
+    (block_cipher_crypt_blocks_t)skinny_128_384_decrypt_tk1_blocks
+};
+
 void test_skinny128(void)
 {
+    skinny_128_384_key_schedule_t ks;
+
     test_block_cipher_start(&skinny128_256);
     test_block_cipher_128(&skinny128_256, &skinny128_256_1);
     test_block_cipher_end(&skinny128_256);
@@ -135,6 +183,8 @@ void test_skinny128(void)
 
     test_block_cipher_start(&skinny128_384);
     test_block_cipher_128(&skinny128_384, &skinny128_384_1);
+    skinny_128_384_init(&ks, skinny128_384_1.key);
+    test_block_cipher_blocks(&skinny128_384_tk1_blocks, &ks);
     test_block_cipher_end(&skinny128_384);
 
     test_block_cipher_start(&skinny128_384_tk2);
@@ -144,4 +194,18 @@ void test_skinny128(void)
     test_block_cipher_start(&skinny128_384_tk_full);
     test_block_cipher_128(&skinny128_384_tk_full, &skinny128_384_1);
     test_block_cipher_end(&skinny128_384_tk_full);
+
+    test_block_cipher_start(&skinny128_256_variant);
+    skinny_128_variant_schedule = SKINNY_128_SCHEDULE_FULL;
+    test_block_cipher_128(&skinny128_256_variant, &skinny128_256_1);
+    skinny_128_variant_schedule = SKINNY_128_SCHEDULE_SMALL;
+    test_block_cipher_128(&skinny128_256_variant, &skinny128_256_1);
+    test_block_cipher_end(&skinny128_256_variant);
+
+    test_block_cipher_start(&skinny128_384_variant);
+    skinny_128_variant_schedule = SKINNY_128_SCHEDULE_FULL;
+    test_block_cipher_128(&skinny128_384_variant, &skinny128_384_1);
+    skinny_128_variant_schedule = SKINNY_128_SCHEDULE_SMALL;
+    test_block_cipher_128(&skinny128_384_variant, &skinny128_384_1);
+    test_block_cipher_end(&skinny128_384_variant);
 }
@@ -21,6 +21,7 @@
  */
 
 #include "internal-xoodoo.h"
+#include "xoodyak.h"
 #include "test-cipher.h"
 #include <stdio.h>
 #include <string.h>
@@ -60,9 +61,93 @@ static void test_xoodoo_permutation(void)
     }
 }
 
+/* Checks every lane of a multi-lane permutation against xoodoo_permute() */
+#define test_xoodoo_lanes_check(name, type, lanes, permute) \
+    do { \
+        type x; \
+        xoodoo_state_t states[lanes]; \
+        unsigned lane, word; \
+        int ok = 1; \
+        printf("    " name " ... "); \
+        fflush(stdout); \
+        for (lane = 0; lane < (lanes); ++lane) { \
+            memcpy(states[lane].B, xoodoo_input, sizeof(xoodoo_input)); \
+            states[lane].B[lane] ^= 0x80; \
+            states[lane].B[47 - lane] ^= (uint8_t)lane; \
+            for (word = 0; word < 12; ++word) { \
+                x.S[word][lane] = \
+                    le_load_word32(states[lane].B + word * 4); \
+            } \
+            xoodoo_permute(&(states[lane])); \
+        } \
+        permute(&x); \
+        for (lane = 0; lane < (lanes); ++lane) { \
+            for (word = 0; word < 12; ++word) { \
+                if (x.S[word][lane] != \
+                        le_load_word32(states[lane].B + word * 4)) \
+                    ok = 0; \
+            } \
+        } \
+        if (!ok) { \
+            printf("failed\n"); \
+            test_exit_result = 1; \
+        } else { \
+            printf("ok\n"); \
+        } \
+    } while (0)
+
+static void test_xoodoo_lanes(void)
+{
+    test_xoodoo_lanes_check
+        ("Permutation x4", xoodoo_x4_state_t, 4, xoodoo_x4_permute);
+    test_xoodoo_lanes_check
+        ("Permutation x8", xoodoo_x8_state_t, 8, xoodoo_x8_permute);
+    test_xoodoo_lanes_check
+        ("Permutation x16", xoodoo_x16_state_t, 16, xoodoo_x16_permute);
+}
+
+static void test_xoodyak_hash_batch(void)
+{
+    unsigned char data[80];
+    unsigned char hashes[20][XOODYAK_HASH_SIZE];
+    unsigned char expected[XOODYAK_HASH_SIZE];
+    unsigned char *out[20];
+    const unsigned char *in[20];
+    unsigned long long inlen[20];
+    unsigned index;
+    int ok = 1;
+
+    printf("    Xoodyak-Hash Batch ... ");
+    fflush(stdout);
+
+    /* Hash messages of different lengths, including the empty message
+     * and lengths either side of the 16 byte block boundaries */
+    for (index = 0; index < sizeof(data); ++index)
+        data[index] = (unsigned char)(index * 7 + 1);
+    for (index = 0; index < 20; ++index) {
+        out[index] = hashes[index];
+        in[index] = data + index;
+        inlen[index] = (index * 13) % (sizeof(data) - 19);
+    }
+    xoodyak_hash_batch(out, in, inlen, 20);
+    for (index = 0; index < 20; ++index) {
+        xoodyak_hash(expected, in[index], inlen[index]);
+        if (memcmp(hashes[index], expected, XOODYAK_HASH_SIZE) != 0)
+            ok = 0;
+    }
+    if (!ok) {
+        printf("failed\n");
+        test_exit_result = 1;
+    } else {
+        printf("ok\n");
+    }
+}
+
 void test_xoodoo(void)
 {
     printf("Xoodoo:\n");
     test_xoodoo_permutation();
+    test_xoodoo_lanes();
+    test_xoodyak_hash_batch();
     printf("\n");
 }